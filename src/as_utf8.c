@@ -43,16 +43,44 @@ static const char *encoding_name(cetype_t ce)
 }
 
 
+/*
+ * Report an entry that does not convert to valid UTF-8. Set `raw` if the
+ * entry's bytes got validated without translation.
+ */
+void rutf8_encoding_error(R_xlen_t i, cetype_t ce, int raw, const char *msg)
+{
+	if (ce == CE_BYTES) {
+		Rf_error("entry %"PRIu64
+			 " cannot be converted from \"bytes\""
+			 " Encoding to \"UTF-8\"; %s",
+			 (uint64_t)i + 1, msg);
+	} else if (raw) {
+		Rf_error("entry %"PRIu64
+			 " has wrong Encoding;"
+			 " marked as \"UTF-8\""
+			 " but %s",
+			 (uint64_t)i + 1, msg);
+	} else {
+		Rf_error("entry %"PRIu64
+			 " cannot be converted"
+			 " from \"%s\" Encoding to \"UTF-8\";"
+			 " %s in converted string",
+			 (uint64_t)i + 1, encoding_name(ce), msg);
+	}
+}
+
+
 SEXP rutf8_as_utf8(SEXP sx)
 {
 	SEXP ans, sstr;
 	PROTECT_INDEX ipx;
+	struct rutf8_dedup dedup;
 	struct utf8lite_message msg;
 	struct utf8lite_text text;
 	const uint8_t *str;
 	cetype_t ce;
 	size_t size;
-	R_xlen_t i, n;
+	R_xlen_t first, i, n;
 	int nprot = 0, duped = 0, raw;
 
 	if (sx == R_NilValue) {
@@ -66,6 +94,8 @@ SEXP rutf8_as_utf8(SEXP sx)
 	PROTECT_WITH_INDEX(ans = sx, &ipx); nprot++;
 
 	n = XLENGTH(sx);
+	rutf8_dedup_init(&dedup, n);
+
 	for (i = 0; i < n; i++) {
 		CHECK_INTERRUPT(i);
 
@@ -75,6 +105,17 @@ SEXP rutf8_as_utf8(SEXP sx)
 			continue;
 		}
 
+		first = rutf8_dedup_first(&dedup, sstr, i);
+		if (first != i) {
+			// repeated value: already validated, and converted
+			// if it needed to be
+			if (duped) {
+				SET_STRING_ELT(ans, i, STRING_ELT(ans, first));
+			}
+			UNPROTECT(1); nprot--;
+			continue;
+		}
+
 		ce = getCharCE(sstr);
 		raw = rutf8_encodes_utf8(ce) || ce == CE_BYTES;
 
@@ -87,27 +128,7 @@ SEXP rutf8_as_utf8(SEXP sx)
 		}
 
 		if (utf8lite_text_assign(&text, str, size, 0, &msg)) {
-			if (ce == CE_BYTES) {
-				Rf_error("entry %"PRIu64
-					 " cannot be converted from \"bytes\""
-					 " Encoding to \"UTF-8\"; %s",
-					 (uint64_t)i + 1, msg.string);
-			} else if (raw) {
-				Rf_error("entry %"PRIu64
-					 " has wrong Encoding;"
-					 " marked as \"UTF-8\""
-					 " but %s",
-					 (uint64_t)i + 1,
-					 msg.string);
-			} else {
-				Rf_error("entry %"PRIu64
-					 " cannot be converted"
-					 " from \"%s\" Encoding to \"UTF-8\";"
-					 " %s in converted string",
-					 (uint64_t)i + 1,
-					 encoding_name(ce),
-					 msg.string);
-			}
+			rutf8_encoding_error(i, ce, raw, msg.string);
 		}
 
 		if (!raw || ce == CE_BYTES || ce == CE_NATIVE) {
@@ -25,6 +25,19 @@ static void render_byte(struct utf8lite_render *r, uint8_t byte);
 
 
 int rutf8_bytes_width(const struct rutf8_bytes *bytes, int flags)
+{
+	int err, width;
+
+	err = rutf8_bytes_measure(bytes, flags, &width);
+	if (err == UTF8LITE_ERROR_OVERFLOW) {
+		Rf_error("width exceeds maximum (%d)", INT_MAX);
+	}
+	return width;
+}
+
+
+int rutf8_bytes_measure(const struct rutf8_bytes *bytes, int flags,
+			int *widthptr)
 {
 	const uint8_t *ptr = bytes->ptr;
 	const uint8_t *end = ptr + bytes->size;
@@ -36,15 +49,18 @@ int rutf8_bytes_width(const struct rutf8_bytes *bytes, int flags)
 		byte = *ptr++;
 		w = byte_width(byte, flags);
 		if (w < 0) {
-			return -1;
+			*widthptr = -1;
+			return 0;
 		}
 		if (width > INT_MAX - w) {
-			Rf_error("width exceeds maximum (%d)", INT_MAX);
+			*widthptr = -1;
+			return UTF8LITE_ERROR_OVERFLOW;
 		}
 		width += w;
 	}
 
-	return width;
+	*widthptr = width;
+	return 0;
 }
 
 
@@ -252,7 +268,7 @@ static SEXP rutf8_bytes_lformat(struct utf8lite_render *r,
 		TRY(utf8lite_render_chars(r, ' ', efill));
 	}
 
-	ans = mkCharLenCE((char *)r->string, r->length, CE_BYTES);
+	ans = rutf8_render_mkchar(r, CE_BYTES);
 	utf8lite_render_clear(r);
 exit:
 	CHECK_ERROR(err);
@@ -302,7 +318,7 @@ static SEXP rutf8_bytes_rformat(struct utf8lite_render *r,
 		render_byte(r, byte);
 	}
 
-	ans = mkCharLenCE((char *)r->string, r->length, CE_BYTES);
+	ans = rutf8_render_mkchar(r, CE_BYTES);
 	utf8lite_render_clear(r);
 exit:
 	CHECK_ERROR(err);
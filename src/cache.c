@@ -0,0 +1,312 @@
+/*
+ * Copyright 2017 Patrick O. Perry.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "rutf8.h"
+
+#define CACHE_SIZE_DEFAULT 16384
+#define CACHE_NWIDTH 4
+
+// strings shorter than this get truncated by rescanning them
+#define CACHE_INDEX_MINLEN 256
+
+// graphemes between width index samples
+#define CACHE_INDEX_STEP 16
+
+/*
+ * Process-wide cache of string metadata, keyed on CHARSXP address.
+ *
+ * The cache is direct-mapped: each CHARSXP has a single slot, and a new
+ * string evicts whatever was there. Every cached CHARSXP also gets stored
+ * in the matching element of `cache_pins`, a preserved list, so that it
+ * cannot get garbage collected (and its address reused by another string)
+ * while it is in the cache. R has no weak references to CHARSXPs, so
+ * pinning is the only way to make the address a safe key; to bound the
+ * memory this holds on to, long strings do not get cached.
+ *
+ * An entry may also own a width index for one set of width flags, for
+ * strings that get truncated more than once.
+ *
+ * The cache is not thread-safe; only use it from the main thread.
+ */
+struct cache_entry {
+	SEXP key;		// NULL if empty
+	int type;
+	int ascii;
+	int nwidth;		// number of (flags, width) pairs in use
+	int next;		// pair to replace when all are in use
+	int flags[CACHE_NWIDTH];
+	int width[CACHE_NWIDTH];
+	struct utf8lite_widthindex *index; // NULL if not built yet
+	int index_flags;	// flags for `index` and `ntrunc`
+	int ntrunc;		// requests for an index with these flags
+};
+
+static struct cache_entry *cache;
+static SEXP cache_pins;
+static size_t cache_size;
+static int cache_on;
+
+static struct cache_entry *cache_find(SEXP charsxp);
+static void cache_drop_index(struct cache_entry *entry);
+
+
+/*
+ * Read the `utf8.cache` and `utf8.cache_size` options, and resize or
+ * drop the cache to match. Entry points that use the cache call this
+ * first, so the options take effect on the next call.
+ */
+void rutf8_cache_begin(void)
+{
+	SEXP opt;
+	size_t size;
+	int n;
+
+	opt = GetOption1(install("utf8.cache"));
+	if (opt != R_NilValue && asLogical(opt) != TRUE) {
+		rutf8_cache_clear();
+		return;
+	}
+
+	opt = GetOption1(install("utf8.cache_size"));
+	if (opt == R_NilValue) {
+		n = CACHE_SIZE_DEFAULT;
+	} else {
+		n = asInteger(opt);
+		if (n == NA_INTEGER || n < 0) {
+			Rf_error("'utf8.cache_size' option must be"
+				 " a non-negative integer");
+		}
+	}
+
+	// round down to a power of 2
+	size = 0;
+	if (n > 0) {
+		size = 1;
+		while (size <= (size_t)n / 2) {
+			size *= 2;
+		}
+	}
+
+	if (cache_on && size == cache_size) {
+		return;
+	}
+
+	rutf8_cache_clear();
+	if (size == 0) {
+		return;
+	}
+
+	cache = calloc(size, sizeof(*cache));
+	if (!cache) {
+		Rf_error("memory allocation failure");
+	}
+	cache_pins = allocVector(VECSXP, (R_xlen_t)size);
+	R_PreserveObject(cache_pins);
+	cache_size = size;
+	cache_on = 1;
+}
+
+
+/*
+ * Test whether a string's metadata may go in the cache.
+ */
+int rutf8_cache_accepts(SEXP charsxp)
+{
+	cetype_t ce;
+
+	if (!cache_on || XLENGTH(charsxp) > RUTF8_CACHE_MAXLEN) {
+		return 0;
+	}
+
+	// translated strings would need translating again anyway
+	ce = getCharCE(charsxp);
+	return rutf8_encodes_utf8(ce) || ce == CE_BYTES;
+}
+
+
+int rutf8_cache_lookup(SEXP charsxp, int *typeptr, int *asciiptr)
+{
+	struct cache_entry *entry;
+
+	if (!(entry = cache_find(charsxp))) {
+		return 0;
+	}
+
+	*typeptr = entry->type;
+	*asciiptr = entry->ascii;
+	return 1;
+}
+
+
+void rutf8_cache_insert(SEXP charsxp, int type, int ascii)
+{
+	struct cache_entry *entry;
+	size_t pos;
+
+	if (!cache_on || cache_find(charsxp)) {
+		return;
+	}
+
+	pos = rutf8_hash_pointer(charsxp) & (cache_size - 1);
+	entry = &cache[pos];
+	cache_drop_index(entry);
+	entry->key = charsxp;
+	entry->type = type;
+	entry->ascii = ascii;
+	entry->nwidth = 0;
+	entry->next = 0;
+	SET_VECTOR_ELT(cache_pins, (R_xlen_t)pos, charsxp);
+}
+
+
+int rutf8_cache_width(SEXP charsxp, int flags, int *widthptr)
+{
+	struct cache_entry *entry;
+	int i;
+
+	if (!(entry = cache_find(charsxp))) {
+		return 0;
+	}
+
+	for (i = 0; i < entry->nwidth; i++) {
+		if (entry->flags[i] == flags) {
+			*widthptr = entry->width[i];
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+
+void rutf8_cache_set_width(SEXP charsxp, int flags, int width)
+{
+	struct cache_entry *entry;
+	int i;
+
+	if (!(entry = cache_find(charsxp))) {
+		return;
+	}
+
+	for (i = 0; i < entry->nwidth; i++) {
+		if (entry->flags[i] == flags) {
+			entry->width[i] = width;
+			return;
+		}
+	}
+
+	if (entry->nwidth < CACHE_NWIDTH) {
+		i = entry->nwidth++;
+	} else {
+		i = entry->next;
+		entry->next = (entry->next + 1) % CACHE_NWIDTH;
+	}
+	entry->flags[i] = flags;
+	entry->width[i] = width;
+}
+
+
+/*
+ * Get the width index for a cached text, building it the second time
+ * that the text gets truncated with the same flags; a text truncated
+ * only once is cheaper to scan. Returns NULL if the text is not in the
+ * cache, is too short to need an index, or does not have one yet.
+ */
+const struct utf8lite_widthindex *rutf8_cache_widthindex(
+		SEXP charsxp, const struct utf8lite_text *text, int flags)
+{
+	struct cache_entry *entry;
+	struct utf8lite_widthindex *index;
+
+	if (UTF8LITE_TEXT_SIZE(text) < CACHE_INDEX_MINLEN
+			|| !(entry = cache_find(charsxp))) {
+		return NULL;
+	}
+
+	if (entry->index_flags != flags) {
+		cache_drop_index(entry);
+		entry->index_flags = flags;
+	}
+
+	if (entry->index) {
+		return entry->index;
+	}
+
+	if (++entry->ntrunc < 2) {
+		return NULL;
+	}
+
+	// the index is an optimization; skip it if out of memory
+	if (!(index = malloc(sizeof(*index)))) {
+		return NULL;
+	}
+	if (utf8lite_widthindex_init(index, text, flags, CACHE_INDEX_STEP)) {
+		free(index);
+		return NULL;
+	}
+
+	entry->index = index;
+	return index;
+}
+
+
+/*
+ * Empty the cache and release the strings it holds.
+ */
+void rutf8_cache_clear(void)
+{
+	size_t i;
+
+	for (i = 0; i < cache_size; i++) {
+		cache_drop_index(&cache[i]);
+	}
+
+	if (cache_pins) {
+		R_ReleaseObject(cache_pins);
+		cache_pins = NULL;
+	}
+	free(cache);
+	cache = NULL;
+	cache_size = 0;
+	cache_on = 0;
+}
+
+
+struct cache_entry *cache_find(SEXP charsxp)
+{
+	struct cache_entry *entry;
+
+	if (!cache_on) {
+		return NULL;
+	}
+
+	entry = &cache[rutf8_hash_pointer(charsxp) & (cache_size - 1)];
+	return entry->key == charsxp ? entry : NULL;
+}
+
+
+void cache_drop_index(struct cache_entry *entry)
+{
+	if (entry->index) {
+		utf8lite_widthindex_destroy(entry->index);
+		free(entry->index);
+		entry->index = NULL;
+	}
+	entry->ntrunc = 0;
+}
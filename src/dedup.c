@@ -0,0 +1,120 @@
+/*
+ * Copyright 2017 Patrick O. Perry.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include "rutf8.h"
+
+// initial number of slots; must be a power of 2
+#define DEDUP_INIT 1024
+
+// give up if, after this many elements, more than half are distinct
+#define DEDUP_TRIAL 4096
+
+static void dedup_grow(struct rutf8_dedup *dedup);
+
+
+size_t rutf8_hash_pointer(const void *ptr)
+{
+	uint64_t h = (uint64_t)(uintptr_t)ptr;
+
+	// Fibonacci hashing; the low bits of the address are all zero
+	h *= UINT64_C(0x9E3779B97F4A7C15);
+	return (size_t)(h >> 32);
+}
+
+
+void rutf8_dedup_init(struct rutf8_dedup *dedup, R_xlen_t n)
+{
+	dedup->keys = NULL;
+	dedup->first = NULL;
+	dedup->mask = 0;
+	dedup->count = 0;
+	dedup->seen = 0;
+
+	// with fewer elements than this, hashing is not worth the effort
+	dedup->enabled = (n >= 16);
+}
+
+
+/*
+ * Look up the element at index `i`, which must increase from one call to
+ * the next. Returns the index of the first element with the same
+ * CHARSXP, or `i` if this is the first one (or the table is disabled).
+ */
+R_xlen_t rutf8_dedup_first(struct rutf8_dedup *dedup, SEXP charsxp,
+			   R_xlen_t i)
+{
+	size_t pos;
+
+	if (!dedup->enabled) {
+		return i;
+	}
+
+	if (dedup->seen++ == DEDUP_TRIAL && dedup->count > DEDUP_TRIAL / 2) {
+		// mostly unique: stop paying for the lookups
+		dedup->enabled = 0;
+		return i;
+	}
+
+	if (dedup->count >= dedup->mask / 2) {
+		dedup_grow(dedup);
+	}
+
+	pos = rutf8_hash_pointer(charsxp) & dedup->mask;
+	while (dedup->keys[pos]) {
+		if (dedup->keys[pos] == charsxp) {
+			return dedup->first[pos];
+		}
+		pos = (pos + 1) & dedup->mask;
+	}
+
+	dedup->keys[pos] = charsxp;
+	dedup->first[pos] = i;
+	dedup->count++;
+	return i;
+}
+
+
+void dedup_grow(struct rutf8_dedup *dedup)
+{
+	SEXP *keys = dedup->keys;
+	R_xlen_t *first = dedup->first;
+	size_t i, n, pos, size;
+
+	n = keys ? dedup->mask + 1 : 0;
+	size = n ? 2 * n : DEDUP_INIT;
+
+	// the old arrays get freed when the .Call returns
+	dedup->keys = (void *)R_alloc(size, sizeof(*dedup->keys));
+	dedup->first = (void *)R_alloc(size, sizeof(*dedup->first));
+	dedup->mask = size - 1;
+	for (i = 0; i < size; i++) {
+		dedup->keys[i] = NULL;
+	}
+
+	for (i = 0; i < n; i++) {
+		if (!keys[i]) {
+			continue;
+		}
+		pos = rutf8_hash_pointer(keys[i]) & dedup->mask;
+		while (dedup->keys[pos]) {
+			pos = (pos + 1) & dedup->mask;
+		}
+		dedup->keys[pos] = keys[i];
+		dedup->first[pos] = first[i];
+	}
+}
@@ -23,7 +23,8 @@
 
 static const R_CallMethodDef CallEntries[] = {
 	CALLDEF(rutf8_as_utf8, 1),
-        CALLDEF(rutf8_render_table, 14),
+	CALLDEF(rutf8_normcache_stats, 0),
+        CALLDEF(rutf8_render_table, 15),
 	CALLDEF(rutf8_utf8_encode, 7),
 	CALLDEF(rutf8_utf8_format, 11),
 	CALLDEF(rutf8_utf8_normalize, 5),
@@ -38,3 +39,12 @@ void R_init_utf8(DllInfo *dll)
 	R_useDynamicSymbols(dll, FALSE);
 	R_forceSymbols(dll, TRUE);
 }
+
+void R_unload_utf8(DllInfo *dll)
+{
+	(void)dll;
+	rutf8_threads_stop();
+	rutf8_cache_clear();
+	rutf8_normcache_clear();
+	rutf8_pool_clear();
+}
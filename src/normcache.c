@@ -0,0 +1,353 @@
+/*
+ * Copyright 2017 Patrick O. Perry.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "rutf8.h"
+
+#define NORMCACHE_SIZE_DEFAULT 0
+
+/*
+ * Process-wide cache of normalization results, keyed on the UTF-8 bytes
+ * of the input and the map type, with least-recently-used eviction.
+ *
+ * The entries live in a fixed array. Each one owns a copy of its key, and
+ * stores its result CHARSXP in the matching element of `normcache_values`,
+ * a preserved list. A hash table with chaining finds the entries, and a
+ * doubly-linked list in order of use picks the one to evict once the
+ * cache is full.
+ *
+ * The cache is not thread-safe; only use it from the main thread.
+ */
+struct normcache_entry {
+	uint8_t *key;
+	size_t size;
+	size_t hash;
+	int type;
+	int chain;		// next entry in the same bucket, or -1
+	int newer;		// next more recently used entry, or -1
+	int older;		// next less recently used entry, or -1
+};
+
+static struct normcache_entry *normcache;
+static int *normcache_buckets;
+static SEXP normcache_values;
+static size_t normcache_nbucket;
+static int normcache_size;
+static int normcache_count;
+static int normcache_newest;
+static int normcache_oldest;
+static double normcache_hits;
+static double normcache_misses;
+
+static size_t normcache_hash(const uint8_t *ptr, size_t size, int type);
+static int normcache_find(const uint8_t *ptr, size_t size, int type,
+			  size_t hash);
+static void normcache_unlink(int i);
+static void normcache_push(int i);
+static void normcache_evict(int i);
+
+
+/*
+ * Read the `utf8.cache` and `utf8.normalize_cache_size` options, and
+ * resize or drop the cache to match. Resizing empties the cache and
+ * resets the counters.
+ */
+void rutf8_normcache_begin(void)
+{
+	SEXP opt;
+	size_t nbucket;
+	int n, i;
+
+	opt = GetOption1(install("utf8.cache"));
+	if (opt != R_NilValue && asLogical(opt) != TRUE) {
+		rutf8_normcache_clear();
+		return;
+	}
+
+	opt = GetOption1(install("utf8.normalize_cache_size"));
+	if (opt == R_NilValue) {
+		n = NORMCACHE_SIZE_DEFAULT;
+	} else {
+		n = asInteger(opt);
+		if (n == NA_INTEGER || n < 0) {
+			Rf_error("'utf8.normalize_cache_size' option must be"
+				 " a non-negative integer");
+		}
+	}
+
+	if (n == normcache_size) {
+		return;
+	}
+
+	rutf8_normcache_clear();
+	if (n == 0) {
+		return;
+	}
+
+	// keep the chains short: at least two buckets per entry
+	nbucket = 1;
+	while (nbucket < 2 * (size_t)n) {
+		nbucket *= 2;
+	}
+
+	normcache = calloc((size_t)n, sizeof(*normcache));
+	normcache_buckets = malloc(nbucket * sizeof(*normcache_buckets));
+	if (!normcache || !normcache_buckets) {
+		rutf8_normcache_clear();
+		Rf_error("memory allocation failure");
+	}
+	for (i = 0; i < (int)nbucket; i++) {
+		normcache_buckets[i] = -1;
+	}
+
+	normcache_values = allocVector(VECSXP, (R_xlen_t)n);
+	R_PreserveObject(normcache_values);
+	normcache_nbucket = nbucket;
+	normcache_size = n;
+	normcache_newest = -1;
+	normcache_oldest = -1;
+}
+
+
+/*
+ * Look up the normalization of a UTF-8 string with a given map type.
+ * Returns the cached result, or NULL if there is none.
+ */
+SEXP rutf8_normcache_lookup(const uint8_t *ptr, size_t size, int type)
+{
+	int i;
+
+	if (!normcache_size || size > RUTF8_CACHE_MAXLEN) {
+		return NULL;
+	}
+
+	i = normcache_find(ptr, size, type, normcache_hash(ptr, size, type));
+	if (i < 0) {
+		normcache_misses++;
+		return NULL;
+	}
+
+	normcache_hits++;
+	if (i != normcache_newest) {
+		normcache_unlink(i);
+		normcache_push(i);
+	}
+	return VECTOR_ELT(normcache_values, i);
+}
+
+
+/*
+ * Add a normalization result to the cache, evicting the least recently
+ * used entry if the cache is full. Strings longer than
+ * RUTF8_CACHE_MAXLEN do not get cached.
+ */
+void rutf8_normcache_insert(const uint8_t *ptr, size_t size, int type,
+			    SEXP value)
+{
+	struct normcache_entry *entry;
+	uint8_t *key;
+	size_t hash, b;
+	int i;
+
+	if (!normcache_size || size > RUTF8_CACHE_MAXLEN) {
+		return;
+	}
+
+	hash = normcache_hash(ptr, size, type);
+	if (normcache_find(ptr, size, type, hash) >= 0) {
+		return;
+	}
+
+	// the cache is an optimization; skip the entry if out of memory
+	if (!(key = malloc(size ? size : 1))) {
+		return;
+	}
+	if (size) {
+		memcpy(key, ptr, size);
+	}
+
+	if (normcache_count < normcache_size) {
+		i = normcache_count++;
+	} else {
+		i = normcache_oldest;
+		normcache_evict(i);
+	}
+
+	entry = &normcache[i];
+	entry->key = key;
+	entry->size = size;
+	entry->hash = hash;
+	entry->type = type;
+
+	b = hash & (normcache_nbucket - 1);
+	entry->chain = normcache_buckets[b];
+	normcache_buckets[b] = i;
+
+	normcache_push(i);
+	SET_VECTOR_ELT(normcache_values, i, value);
+}
+
+
+/*
+ * Empty the cache, release the strings it holds, and reset the counters.
+ */
+void rutf8_normcache_clear(void)
+{
+	int i;
+
+	if (normcache_values) {
+		R_ReleaseObject(normcache_values);
+		normcache_values = NULL;
+	}
+	if (normcache) {
+		for (i = 0; i < normcache_count; i++) {
+			free(normcache[i].key);
+		}
+	}
+	free(normcache);
+	free(normcache_buckets);
+	normcache = NULL;
+	normcache_buckets = NULL;
+	normcache_nbucket = 0;
+	normcache_size = 0;
+	normcache_count = 0;
+	normcache_newest = -1;
+	normcache_oldest = -1;
+	normcache_hits = 0;
+	normcache_misses = 0;
+}
+
+
+SEXP rutf8_normcache_stats(void)
+{
+	SEXP ans, names;
+	double *val;
+
+	PROTECT(ans = allocVector(REALSXP, 4));
+	val = REAL(ans);
+	val[0] = normcache_hits;
+	val[1] = normcache_misses;
+	val[2] = (double)normcache_count;
+	val[3] = (double)normcache_size;
+
+	PROTECT(names = allocVector(STRSXP, 4));
+	SET_STRING_ELT(names, 0, mkChar("hits"));
+	SET_STRING_ELT(names, 1, mkChar("misses"));
+	SET_STRING_ELT(names, 2, mkChar("count"));
+	SET_STRING_ELT(names, 3, mkChar("size"));
+	setAttrib(ans, R_NamesSymbol, names);
+
+	UNPROTECT(2);
+	return ans;
+}
+
+
+size_t normcache_hash(const uint8_t *ptr, size_t size, int type)
+{
+	struct utf8lite_text text;
+
+	text.ptr = (uint8_t *)ptr;
+	text.attr = size;
+	return utf8lite_text_hash(&text) ^ ((size_t)type * 0x9E3779B9u);
+}
+
+
+int normcache_find(const uint8_t *ptr, size_t size, int type, size_t hash)
+{
+	const struct normcache_entry *entry;
+	struct utf8lite_text text, key;
+	int i;
+
+	text.ptr = (uint8_t *)ptr;
+	text.attr = size;
+
+	i = normcache_buckets[hash & (normcache_nbucket - 1)];
+	while (i >= 0) {
+		entry = &normcache[i];
+		if (entry->hash == hash && entry->type == type) {
+			key.ptr = entry->key;
+			key.attr = entry->size;
+			if (utf8lite_text_equals(&key, &text)) {
+				return i;
+			}
+		}
+		i = entry->chain;
+	}
+
+	return -1;
+}
+
+
+/*
+ * Remove an entry from the use list.
+ */
+void normcache_unlink(int i)
+{
+	struct normcache_entry *entry = &normcache[i];
+
+	if (entry->newer >= 0) {
+		normcache[entry->newer].older = entry->older;
+	} else {
+		normcache_newest = entry->older;
+	}
+
+	if (entry->older >= 0) {
+		normcache[entry->older].newer = entry->newer;
+	} else {
+		normcache_oldest = entry->newer;
+	}
+}
+
+
+/*
+ * Put an entry at the front of the use list.
+ */
+void normcache_push(int i)
+{
+	struct normcache_entry *entry = &normcache[i];
+
+	entry->newer = -1;
+	entry->older = normcache_newest;
+	if (normcache_newest >= 0) {
+		normcache[normcache_newest].newer = i;
+	} else {
+		normcache_oldest = i;
+	}
+	normcache_newest = i;
+}
+
+
+/*
+ * Remove an entry from its bucket and the use list, and free its key.
+ */
+void normcache_evict(int i)
+{
+	struct normcache_entry *entry = &normcache[i];
+	int *link;
+
+	link = &normcache_buckets[entry->hash & (normcache_nbucket - 1)];
+	while (*link != i) {
+		link = &normcache[*link].chain;
+	}
+	*link = entry->chain;
+
+	normcache_unlink(i);
+	free(entry->key);
+	entry->key = NULL;
+}
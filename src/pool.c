@@ -0,0 +1,161 @@
+/*
+ * Copyright 2017 Patrick O. Perry.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stddef.h>
+#include <stdlib.h>
+#include "rutf8.h"
+
+// number of idle objects of each kind to keep between calls
+#define POOL_RENDER_MAX 4
+#define POOL_TEXTMAP_MAX 64
+
+// largest buffer (in bytes) to keep; free bigger objects instead
+#define POOL_KEEP_SIZE (1 << 16)
+
+/*
+ * Process-wide pools of render and text map objects, so that calls on
+ * short vectors reuse buffers that earlier calls already grew instead of
+ * starting from empty ones.
+ *
+ * Each pool is a stack of idle objects. Getting an object pops one or
+ * makes a new one; putting it back resets it and pushes it, unless the
+ * pool is full or the object's buffers grew past POOL_KEEP_SIZE.
+ *
+ * The pools are not thread-safe; only get and put objects from the main
+ * thread.
+ */
+static struct utf8lite_render *pool_render[POOL_RENDER_MAX];
+static int pool_nrender;
+
+static struct utf8lite_textmap *pool_textmap[POOL_TEXTMAP_MAX];
+static int pool_ntextmap;
+
+
+int rutf8_pool_get_render(struct utf8lite_render **rptr, int flags)
+{
+	struct utf8lite_render *r = NULL;
+	int err = 0;
+
+	if (pool_nrender > 0) {
+		r = pool_render[--pool_nrender];
+	} else {
+		TRY_ALLOC(r = malloc(sizeof(*r)));
+		if ((err = utf8lite_render_init(r, 0))) {
+			free(r);
+			r = NULL;
+			goto exit;
+		}
+	}
+
+	TRY(utf8lite_render_set_flags(r, flags));
+
+exit:
+	if (err && r) {
+		rutf8_pool_put_render(r);
+		r = NULL;
+	}
+	*rptr = r;
+	return err;
+}
+
+
+void rutf8_pool_put_render(struct utf8lite_render *r)
+{
+	if (!r) {
+		return;
+	}
+
+	if (pool_nrender == POOL_RENDER_MAX
+			|| r->length_max > POOL_KEEP_SIZE) {
+		utf8lite_render_destroy(r);
+		free(r);
+		return;
+	}
+
+	// go back to the state after utf8lite_render_init()
+	utf8lite_render_clear(r);
+	utf8lite_render_set_flags(r, 0);
+	utf8lite_render_set_tab(r, "\t");
+	utf8lite_render_set_newline(r, "\n");
+	utf8lite_render_set_style(r, NULL, NULL);
+	utf8lite_render_set_flush(r, NULL, NULL, 0);
+
+	pool_render[pool_nrender++] = r;
+}
+
+
+int rutf8_pool_get_textmap(struct utf8lite_textmap **mapptr, int type)
+{
+	struct utf8lite_textmap *map = NULL;
+	int err = 0;
+
+	if (pool_ntextmap > 0) {
+		map = pool_textmap[--pool_ntextmap];
+		TRY(utf8lite_textmap_set_type(map, type));
+	} else {
+		TRY_ALLOC(map = malloc(sizeof(*map)));
+		if ((err = utf8lite_textmap_init(map, type))) {
+			free(map);
+			map = NULL;
+			goto exit;
+		}
+	}
+
+exit:
+	if (err && map) {
+		rutf8_pool_put_textmap(map);
+		map = NULL;
+	}
+	*mapptr = map;
+	return err;
+}
+
+
+void rutf8_pool_put_textmap(struct utf8lite_textmap *map)
+{
+	if (!map) {
+		return;
+	}
+
+	if (pool_ntextmap == POOL_TEXTMAP_MAX
+			|| map->size_max > POOL_KEEP_SIZE
+			|| map->ncode_max > POOL_KEEP_SIZE / sizeof(int32_t)) {
+		utf8lite_textmap_destroy(map);
+		free(map);
+		return;
+	}
+
+	pool_textmap[pool_ntextmap++] = map;
+}
+
+
+/*
+ * Free the idle objects.
+ */
+void rutf8_pool_clear(void)
+{
+	while (pool_nrender > 0) {
+		pool_nrender--;
+		utf8lite_render_destroy(pool_render[pool_nrender]);
+		free(pool_render[pool_nrender]);
+	}
+
+	while (pool_ntextmap > 0) {
+		pool_ntextmap--;
+		utf8lite_textmap_destroy(pool_textmap[pool_ntextmap]);
+		free(pool_textmap[pool_ntextmap]);
+	}
+}
@@ -14,15 +14,18 @@
  * limitations under the License.
  */
 
+#include <limits.h>
 #include <stddef.h>
 #include <stdlib.h>
 #include "rutf8.h"
 
 #define RENDER_TAG install("utf8::render")
 
+// most bytes to reserve ahead of rendering
+#define RENDER_RESERVE_MAX (1 << 16)
+
 struct rutf8_render {
-	struct utf8lite_render render;
-	int has_render;
+	struct utf8lite_render *render;	// from the pool, or NULL
 };
 
 
@@ -31,9 +34,7 @@ void rutf8_free_render(SEXP x)
         struct rutf8_render *obj = R_ExternalPtrAddr(x);
         R_SetExternalPtrAddr(x, NULL);
 	if (obj) {
-		if (obj->has_render) {
-			utf8lite_render_destroy(&obj->render);
-		}
+		rutf8_pool_put_render(obj->render);
 		free(obj);
 	}
 }
@@ -51,8 +52,7 @@ SEXP rutf8_alloc_render(int flags)
 	TRY_ALLOC(obj = calloc(1, sizeof(*obj)));
         R_SetExternalPtrAddr(ans, obj);
 
-	TRY(utf8lite_render_init(&obj->render, flags));
-	obj->has_render = 1;
+	TRY(rutf8_pool_get_render(&obj->render, flags));
 exit:
 	CHECK_ERROR(err);
 	UNPROTECT(1);
@@ -76,5 +76,35 @@ struct utf8lite_render *rutf8_as_render(SEXP x)
 	}
 
 	obj = R_ExternalPtrAddr(x);
-	return (obj->has_render) ? &obj->render : NULL;
+	return obj->render;
+}
+
+
+/*
+ * Make a CHARSXP from the rendered string. R strings hold at most
+ * INT_MAX bytes, even though the render buffer can be longer.
+ */
+SEXP rutf8_render_mkchar(const struct utf8lite_render *r, cetype_t ce)
+{
+	if (r->length > INT_MAX) {
+		Rf_error("string size exceeds maximum (%d bytes)", INT_MAX);
+	}
+	return mkCharLenCE(r->string, (int)r->length, ce);
+}
+
+
+/*
+ * Pre-size the render buffer for output of a known minimum size, so that
+ * it does not grow a few bytes at a time. Large sizes are capped; the
+ * buffer still grows as needed past them.
+ */
+void rutf8_render_reserve(struct utf8lite_render *r, size_t size)
+{
+	int err;
+
+	if (size > RENDER_RESERVE_MAX) {
+		size = RENDER_RESERVE_MAX;
+	}
+	err = utf8lite_render_reserve(r, size);
+	CHECK_ERROR(err);
 }
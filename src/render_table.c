@@ -22,6 +22,13 @@
 #include <string.h>
 #include "rutf8.h"
 
+// size of the output buffer when streaming
+#define RENDER_BUFSIZE 4096
+
+// maximum size of a returned piece of output; R strings hold at most
+// INT_MAX bytes
+#define RENDER_CHUNK_MAX ((size_t)1 << 30)
+
 enum cell_type {
 	CELL_ENTRY,
 	CELL_NA,
@@ -48,6 +55,66 @@ struct style {
 };
 
 
+static int render_flush(void *context, const char *bytes, size_t size)
+{
+	(void)context;
+	Rprintf("%.*s", (int)size, bytes);
+	return 0;
+}
+
+
+/*
+ * Size of the next piece of output, ending on a character boundary so
+ * that each piece is valid UTF-8.
+ */
+static size_t chunk_size(const char *ptr, const char *end)
+{
+	size_t size = (size_t)(end - ptr);
+
+	if (size <= RENDER_CHUNK_MAX) {
+		return size;
+	}
+
+	size = RENDER_CHUNK_MAX;
+	while (((uint8_t)ptr[size] & 0xC0) == 0x80) {
+		size--;
+	}
+	return size;
+}
+
+
+/*
+ * Split the output into a character vector of pieces to print in order.
+ */
+static SEXP render_chunks(const struct utf8lite_render *r)
+{
+	SEXP ans;
+	const char *ptr, *end = r->string + r->length;
+	size_t size;
+	R_xlen_t i, n;
+
+	n = 0;
+	for (ptr = r->string; ptr != end; ptr += chunk_size(ptr, end)) {
+		n++;
+	}
+
+	PROTECT(ans = allocVector(STRSXP, n ? n : 1));
+	if (!n) {
+		SET_STRING_ELT(ans, 0, mkChar(""));
+	}
+
+	ptr = r->string;
+	for (i = 0; i < n; i++) {
+		size = chunk_size(ptr, end);
+		SET_STRING_ELT(ans, i, mkCharLenCE(ptr, (int)size, CE_UTF8));
+		ptr += size;
+	}
+
+	UNPROTECT(1);
+	return ans;
+}
+
+
 static int flags_get(const struct flags *f, enum cell_type t)
 {
 	switch (t) {
@@ -250,18 +317,19 @@ SEXP rutf8_render_table(SEXP sx, SEXP swidth, SEXP squote, SEXP sna_print,
 			SEXP sprint_gap, SEXP sright, SEXP smax,
 			SEXP snames, SEXP srownames, SEXP sescapes,
 			SEXP sdisplay, SEXP sstyle, SEXP sutf8,
-			SEXP slinewidth)
+			SEXP slinewidth, SEXP sstream)
 {
-	SEXP ans, na_print, str, srender, elt, dim_names, row_names, col_names;
+	SEXP ans, na_print, srender, elt, dim_names, row_names, col_names;
 	struct utf8lite_render *render;
 	struct style s;
 	R_xlen_t ix, nx;
 	int i, j, nrow, ncol;
 	int width, quote, print_gap, max, display, style, linewidth, utf8;
-	int begin, end, w, nprint, lw, namewidth, *colwidths;
-	int nprot = 0;
+	int stream, begin, end, w, nprint, lw, namewidth, *colwidths;
+	int err = 0, nprot = 0;
 
 	memset(&s, 0, sizeof(s));
+	rutf8_cache_begin();
 
 	PROTECT(dim_names = getAttrib(sx, R_DimNamesSymbol)); nprot++;
 	row_names = VECTOR_ELT(dim_names, 0);
@@ -280,6 +348,7 @@ SEXP rutf8_render_table(SEXP sx, SEXP swidth, SEXP squote, SEXP sna_print,
 	style = LOGICAL(sstyle)[0] == TRUE;
 	utf8 = LOGICAL(sutf8)[0] == TRUE;
 	linewidth = INTEGER(slinewidth)[0];
+	stream = LOGICAL(sstream)[0] == TRUE;
 
 	s.flags.entry = (UTF8LITE_ESCAPE_CONTROL | UTF8LITE_ENCODE_C);
 	if (quote) {
@@ -310,6 +379,13 @@ SEXP rutf8_render_table(SEXP sx, SEXP swidth, SEXP squote, SEXP sna_print,
 	PROTECT(srender = rutf8_alloc_render(0)); nprot++;
 	render = rutf8_as_render(srender);
 
+	// write the output as we go instead of returning it all at once
+	if (stream) {
+		err = utf8lite_render_set_flush(render, render_flush, NULL,
+						RENDER_BUFSIZE);
+		CHECK_ERROR(err);
+	}
+
 	if (style) {
 		if ((s.esc_open = rutf8_as_style(sescapes))) {
 			s.esc_close = RUTF8_STYLE_CLOSE;
@@ -417,9 +493,13 @@ SEXP rutf8_render_table(SEXP sx, SEXP swidth, SEXP squote, SEXP sna_print,
 	}
 
 exit:
-	PROTECT(str = mkCharLenCE(render->string, render->length, CE_UTF8));
-	nprot++;
-	PROTECT(ans = ScalarString(str)); nprot++;
+	if (stream) {
+		err = utf8lite_render_flush(render);
+		CHECK_ERROR(err);
+		ans = R_NilValue;
+	} else {
+		PROTECT(ans = render_chunks(render)); nprot++;
+	}
 
 	rutf8_free_render(srender);
 	UNPROTECT(nprot);
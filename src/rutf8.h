@@ -34,6 +34,16 @@
 		} \
 	} while (0)
 
+// Number of elements to gather from an R vector before handing them
+// to the worker threads, and the smallest number given to one thread
+#define RUTF8_BATCH_SIZE 65536
+#define RUTF8_BATCH_GRAIN 1024
+
+// Strings at least this long get split into chunks of about
+// RUTF8_SPLIT_CHUNK bytes, to spread a single string over the threads
+#define RUTF8_SPLIT_SIZE (1 << 20)
+#define RUTF8_SPLIT_CHUNK (1 << 18)
+
 #define TRY(x) \
 	do { \
 		if ((err = (x))) { \
@@ -107,7 +117,8 @@ enum rutf8_justify_type {
 enum rutf8_string_type {
 	RUTF8_STRING_NONE = 0,	/**< missing value */
 	RUTF8_STRING_BYTES,	/**< unknown encoding, not valid UTF-8 */
-	RUTF8_STRING_TEXT	/**< valid UTF-8 */
+	RUTF8_STRING_TEXT,	/**< valid UTF-8 */
+	RUTF8_STRING_UNCHECKED	/**< supposed to be UTF-8, not validated */
 };
 
 /**
@@ -127,10 +138,17 @@ struct rutf8_string {
 		struct rutf8_bytes bytes;	/**< raw bytes */
 	} value;				/**< string value */
 	enum rutf8_string_type type;		/**< type indicator */
+	SEXP key;				/**< CHARSXP for the metadata
+						  cache, or NULL */
 };
 
 void rutf8_string_init(struct rutf8_string *str, SEXP charsxp);
+void rutf8_string_gather(struct rutf8_string *str, SEXP charsxp);
+void rutf8_string_finish(struct rutf8_string *str, int nthread);
+void rutf8_string_remember(const struct rutf8_string *str);
 int rutf8_string_width(const struct rutf8_string *str, int flags);
+int rutf8_string_measure(const struct rutf8_string *str, int flags,
+			 int nthread, int *widthptr);
 int rutf8_string_lwidth(const struct rutf8_string *str, int flags,
 			int limit, int ellipsis);
 int rutf8_string_rwidth(const struct rutf8_string *str, int flags,
@@ -145,6 +163,10 @@ SEXP rutf8_string_format(struct utf8lite_render *r,
 			 int wellipsis, int flags, int width_max);
 
 int rutf8_text_width(const struct utf8lite_text *text, int flags);
+int rutf8_text_measure(const struct utf8lite_text *text, int flags,
+		       int nthread, int *widthptr);
+int rutf8_text_assign(struct utf8lite_text *text, const uint8_t *ptr,
+		      size_t size, int nthread);
 int rutf8_text_lwidth(const struct utf8lite_text *text, int flags,
 		      int limit, int ellipsis);
 int rutf8_text_rwidth(const struct utf8lite_text *text, int flags,
@@ -154,11 +176,14 @@ void rutf8_text_render(struct utf8lite_render *r,
 		       int width, int quote, enum rutf8_justify_type justify);
 SEXP rutf8_text_format(struct utf8lite_render *r,
 		       const struct utf8lite_text *text,
+		       const struct utf8lite_widthindex *index,
 		       int trim, int chars, enum rutf8_justify_type justify,
 		       int quote, const char *ellipsis, size_t nellipsis,
 		       int wellipsis, int flags, int width_max);
 
 int rutf8_bytes_width(const struct rutf8_bytes *bytes, int flags);
+int rutf8_bytes_measure(const struct rutf8_bytes *bytes, int flags,
+			int *widthptr);
 int rutf8_bytes_lwidth(const struct rutf8_bytes *bytes, int flags, int limit);
 int rutf8_bytes_rwidth(const struct rutf8_bytes *bytes, int flags, int limit);
 void rutf8_bytes_render(struct utf8lite_render *r,
@@ -176,20 +201,89 @@ void rutf8_free_context(SEXP x);
 void *rutf8_as_context(SEXP x);
 int rutf8_is_context(SEXP x);
 
+/* metadata cache */
+
+// Longest string (in bytes) that the cache holds on to
+#define RUTF8_CACHE_MAXLEN 1024
+
+void rutf8_cache_begin(void);
+void rutf8_cache_clear(void);
+int rutf8_cache_accepts(SEXP charsxp);
+int rutf8_cache_lookup(SEXP charsxp, int *typeptr, int *asciiptr);
+void rutf8_cache_insert(SEXP charsxp, int type, int ascii);
+int rutf8_cache_width(SEXP charsxp, int flags, int *widthptr);
+void rutf8_cache_set_width(SEXP charsxp, int flags, int width);
+const struct utf8lite_widthindex *rutf8_cache_widthindex(
+		SEXP charsxp, const struct utf8lite_text *text, int flags);
+
+/* object pools */
+int rutf8_pool_get_render(struct utf8lite_render **rptr, int flags);
+void rutf8_pool_put_render(struct utf8lite_render *r);
+int rutf8_pool_get_textmap(struct utf8lite_textmap **mapptr, int type);
+void rutf8_pool_put_textmap(struct utf8lite_textmap *map);
+void rutf8_pool_clear(void);
+
+/* normalization cache */
+void rutf8_normcache_begin(void);
+void rutf8_normcache_clear(void);
+SEXP rutf8_normcache_lookup(const uint8_t *ptr, size_t size, int type);
+void rutf8_normcache_insert(const uint8_t *ptr, size_t size, int type,
+			    SEXP value);
+SEXP rutf8_normcache_stats(void);
+
+/* deduplication */
+
+size_t rutf8_hash_pointer(const void *ptr);
+
+/**
+ * Table mapping the CHARSXPs of a character vector to the index of their
+ * first occurrence, so that repeated values only get processed once.
+ */
+struct rutf8_dedup {
+	SEXP *keys;		/**< CHARSXP in each slot, or NULL */
+	R_xlen_t *first;	/**< first index for the key in each slot */
+	size_t mask;		/**< number of slots, minus one */
+	size_t count;		/**< number of occupied slots */
+	size_t seen;		/**< number of lookups */
+	int enabled;		/**< whether the table is in use */
+};
+
+void rutf8_dedup_init(struct rutf8_dedup *dedup, R_xlen_t n);
+R_xlen_t rutf8_dedup_first(struct rutf8_dedup *dedup, SEXP charsxp,
+			   R_xlen_t i);
+
+/* worker threads */
+
+/**
+ * Work function for #rutf8_parallel_for. Gets called with the half-open
+ * index range [begin, end) and the id of the calling thread, from 0 to
+ * one less than the requested number of threads. Must not call into R.
+ */
+typedef void (*rutf8_worker_func)(void *data, int tid, R_xlen_t begin,
+				  R_xlen_t end);
+
+int rutf8_nthread(void);
+void rutf8_parallel_for(R_xlen_t n, R_xlen_t grain, int nthread,
+			rutf8_worker_func func, void *data);
+void rutf8_threads_stop(void);
+
 /* render object */
 SEXP rutf8_alloc_render(int flags);
 void rutf8_free_render(SEXP x);
 struct utf8lite_render *rutf8_as_render(SEXP x);
 int rutf8_is_render(SEXP x);
+SEXP rutf8_render_mkchar(const struct utf8lite_render *r, cetype_t ce);
+void rutf8_render_reserve(struct utf8lite_render *r, size_t size);
 
 /* printing */
 SEXP rutf8_render_table(SEXP x, SEXP width, SEXP quote, SEXP na_print,
 			SEXP print_gap, SEXP right, SEXP max, SEXP names,
 			SEXP rownames, SEXP escapes, SEXP display, SEXP style,
-			SEXP utf8, SEXP linewidth);
+			SEXP utf8, SEXP linewidth, SEXP stream);
 
 /* utf8 */
 SEXP rutf8_as_utf8(SEXP x);
+void rutf8_encoding_error(R_xlen_t i, cetype_t ce, int raw, const char *msg);
 SEXP rutf8_utf8_encode(SEXP x, SEXP width, SEXP quote, SEXP justify,
 		       SEXP escapes, SEXP display, SEXP utf8);
 SEXP rutf8_utf8_format(SEXP x, SEXP trim, SEXP chars, SEXP justify,
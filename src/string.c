@@ -17,74 +17,229 @@
 #include <assert.h>
 #include "rutf8.h"
 
-static void bytes_init(struct rutf8_bytes *bytes, SEXP charsxp);
-static int text_init(struct utf8lite_text *text, SEXP charsxp);
+static const uint8_t *text_source(SEXP charsxp, size_t *sizeptr);
+static int string_cached(struct rutf8_string *str, SEXP charsxp);
+static const struct utf8lite_widthindex *string_index(
+		const struct rutf8_string *str, int flags, int limit);
 
 
 void rutf8_string_init(struct rutf8_string *str, SEXP charsxp)
 {
+	rutf8_string_gather(str, charsxp);
+	if (str->type == RUTF8_STRING_UNCHECKED) {
+		rutf8_string_finish(str, 1);
+		rutf8_string_remember(str);
+	}
+}
+
+
+/*
+ * Get the raw data for a string, translating to UTF-8 if necessary.
+ * Calls into R, so this must run on the main thread. Strings that are
+ * supposed to be UTF-8 get type RUTF8_STRING_UNCHECKED, with the bytes
+ * in `value.bytes`; call rutf8_string_finish() to validate them. Strings
+ * that are in the metadata cache come out already validated.
+ */
+void rutf8_string_gather(struct rutf8_string *str, SEXP charsxp)
+{
+	const uint8_t *ptr;
+	size_t size;
+
+	str->key = NULL;
+
 	if (charsxp == NA_STRING) {
 		str->type = RUTF8_STRING_NONE;
-	} else if (!text_init(&str->value.text, charsxp)) {
-		str->type = RUTF8_STRING_TEXT;
+		return;
+	}
+
+	if (rutf8_cache_accepts(charsxp)) {
+		str->key = charsxp;
+		if (string_cached(str, charsxp)) {
+			return;
+		}
+	}
+
+	if ((ptr = text_source(charsxp, &size))) {
+		str->value.bytes.ptr = ptr;
+		str->value.bytes.size = size;
+		str->type = RUTF8_STRING_UNCHECKED;
 	} else {
-		bytes_init(&str->value.bytes, charsxp);
+		str->value.bytes.ptr = (const uint8_t *)CHAR(charsxp);
+		str->value.bytes.size = (size_t)XLENGTH(charsxp);
 		str->type = RUTF8_STRING_BYTES;
 	}
 }
 
 
-void bytes_init(struct rutf8_bytes *bytes, SEXP charsxp)
+/*
+ * Validate a gathered string, demoting it to bytes if it is not valid
+ * UTF-8. Does not call into R, so this can run on a worker thread.
+ */
+void rutf8_string_finish(struct rutf8_string *str, int nthread)
 {
-	assert(charsxp != NA_STRING);
-	bytes->ptr = (const uint8_t *)CHAR(charsxp);
-	bytes->size = (size_t)XLENGTH(charsxp);
+	struct rutf8_bytes bytes;
+
+	if (str->type != RUTF8_STRING_UNCHECKED) {
+		return;
+	}
+
+	bytes = str->value.bytes;
+	if (rutf8_text_assign(&str->value.text, bytes.ptr, bytes.size,
+			      nthread)) {
+		str->value.bytes = bytes;
+		str->type = RUTF8_STRING_BYTES;
+	} else {
+		str->type = RUTF8_STRING_TEXT;
+	}
 }
 
 
-int text_init(struct utf8lite_text *text, SEXP charsxp)
+/*
+ * Add a finished string to the metadata cache, if it is eligible. Must
+ * run on the main thread.
+ */
+void rutf8_string_remember(const struct rutf8_string *str)
+{
+	int ascii;
+
+	if (!str->key) {
+		return;
+	}
+
+	switch (str->type) {
+	case RUTF8_STRING_TEXT:
+		ascii = utf8lite_text_isascii(&str->value.text);
+		rutf8_cache_insert(str->key, RUTF8_STRING_TEXT, ascii);
+		break;
+	case RUTF8_STRING_BYTES:
+		rutf8_cache_insert(str->key, RUTF8_STRING_BYTES, 0);
+		break;
+	default:
+		break;
+	}
+}
+
+
+int string_cached(struct rutf8_string *str, SEXP charsxp)
 {
 	const uint8_t *ptr;
 	size_t size;
+	int ascii, type;
+
+	if (!rutf8_cache_lookup(charsxp, &type, &ascii)) {
+		return 0;
+	}
+
+	// cached strings do not need translation
+	ptr = (const uint8_t *)CHAR(charsxp);
+	size = (size_t)XLENGTH(charsxp);
+
+	// the size must fit in the text attributes
+	if (type == RUTF8_STRING_TEXT && size > UTF8LITE_TEXT_SIZE_MAX) {
+		return 0;
+	}
+
+	if (type == RUTF8_STRING_TEXT) {
+		str->value.text.ptr = (uint8_t *)ptr;
+		str->value.text.attr = size;
+		if (ascii) {
+			str->value.text.attr |= UTF8LITE_TEXT_ASCII_BIT;
+		}
+	} else {
+		str->value.bytes.ptr = ptr;
+		str->value.bytes.size = size;
+	}
+	str->type = type;
+	return 1;
+}
+
+
+const uint8_t *text_source(SEXP charsxp, size_t *sizeptr)
+{
+	const uint8_t *ptr;
 	cetype_t ce;
-	int err = 0;
 
 	assert(charsxp != NA_STRING);
 
 	ce = getCharCE(charsxp);
 	if (rutf8_encodes_utf8(ce)) {
 		ptr = (const uint8_t *)CHAR(charsxp);
-		size = (size_t)XLENGTH(charsxp);
+		*sizeptr = (size_t)XLENGTH(charsxp);
 	} else if (ce == CE_LATIN1 || ce == CE_NATIVE) {
 		ptr = (const uint8_t *)rutf8_translate_utf8(charsxp);
-		size = strlen((const char *)ptr);
+		*sizeptr = strlen((const char *)ptr);
 	} else {
-		err = UTF8LITE_ERROR_INVAL; // bytes or other encoding
-		goto exit;
+		ptr = NULL; // bytes or other encoding
 	}
 
-	TRY(utf8lite_text_assign(text, ptr, size, 0, NULL));
-exit:
-	return err;
+	return ptr;
 }
 
 
 int rutf8_string_width(const struct rutf8_string *str, int flags)
 {
+	int width;
+
+	if (str->key && rutf8_cache_width(str->key, flags, &width)) {
+		return width;
+	}
+
 	switch (str->type) {
 	case RUTF8_STRING_TEXT:
-		return rutf8_text_width(&str->value.text, flags);
+		width = rutf8_text_width(&str->value.text, flags);
+		break;
 	case RUTF8_STRING_BYTES:
-		return rutf8_bytes_width(&str->value.bytes, flags);
+		width = rutf8_bytes_width(&str->value.bytes, flags);
+		break;
 	default:
 		return -1;
 	}
+
+	if (str->key) {
+		rutf8_cache_set_width(str->key, flags, width);
+	}
+	return width;
+}
+
+
+int rutf8_string_measure(const struct rutf8_string *str, int flags,
+			 int nthread, int *widthptr)
+{
+	switch (str->type) {
+	case RUTF8_STRING_TEXT:
+		return rutf8_text_measure(&str->value.text, flags, nthread,
+					  widthptr);
+	case RUTF8_STRING_BYTES:
+		return rutf8_bytes_measure(&str->value.bytes, flags, widthptr);
+	default:
+		*widthptr = -1;
+		return 0;
+	}
 }
 
 
 int rutf8_string_lwidth(const struct rutf8_string *str, int flags,
 			int limit, int ellipsis)
 {
+	const struct utf8lite_widthindex *index;
+	size_t size;
+	int width;
+
+	// a string that fits within the limit does not get truncated
+	if (str->key) {
+		width = rutf8_string_width(str, flags);
+		if (0 <= width && width <= limit) {
+			return width;
+		}
+	}
+
+	if ((index = string_index(str, flags, limit))) {
+		if (utf8lite_widthindex_prefix(index, limit, &size, &width)) {
+			return width + ellipsis;
+		}
+		return width;
+	}
+
 	switch (str->type) {
 	case RUTF8_STRING_TEXT:
 		return rutf8_text_lwidth(&str->value.text, flags, limit,
@@ -100,6 +255,24 @@ int rutf8_string_lwidth(const struct rutf8_string *str, int flags,
 int rutf8_string_rwidth(const struct rutf8_string *str, int flags,
 			int limit, int ellipsis)
 {
+	const struct utf8lite_widthindex *index;
+	size_t begin;
+	int width;
+
+	if (str->key) {
+		width = rutf8_string_width(str, flags);
+		if (0 <= width && width <= limit) {
+			return width;
+		}
+	}
+
+	if ((index = string_index(str, flags, limit))) {
+		if (utf8lite_widthindex_suffix(index, limit, &begin, &width)) {
+			return width + ellipsis;
+		}
+		return width;
+	}
+
 	switch (str->type) {
 	case RUTF8_STRING_TEXT:
 		return rutf8_text_rwidth(&str->value.text, flags,
@@ -137,9 +310,11 @@ SEXP rutf8_string_format(struct utf8lite_render *r,
 {
 	switch (str->type) {
 	case RUTF8_STRING_TEXT:
-		return rutf8_text_format(r, &str->value.text, trim, chars,
-					 justify, quote, ellipsis, nellipsis,
-					 wellipsis, flags, width_max);
+		return rutf8_text_format(r, &str->value.text,
+					 string_index(str, flags, chars),
+					 trim, chars, justify, quote,
+					 ellipsis, nellipsis, wellipsis,
+					 flags, width_max);
 
 	case RUTF8_STRING_BYTES:
 		// always use ASCII for byte formatting; UTF-8 isn't allowed
@@ -149,3 +324,27 @@ SEXP rutf8_string_format(struct utf8lite_render *r,
 		return NA_STRING;
 	}
 }
+
+
+/*
+ * Get the width index for a cached text that gets truncated to `limit`,
+ * or NULL if there is none.
+ */
+const struct utf8lite_widthindex *string_index(
+		const struct rutf8_string *str, int flags, int limit)
+{
+	int width;
+
+	if (!str->key || str->type != RUTF8_STRING_TEXT) {
+		return NULL;
+	}
+
+	// texts that fit do not need an index; neither do texts with
+	// width -1, which the format code scans grapheme by grapheme
+	width = rutf8_string_width(str, flags);
+	if (width <= limit) {
+		return NULL;
+	}
+
+	return rutf8_cache_widthindex(str->key, &str->value.text, flags);
+}
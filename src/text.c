@@ -15,51 +15,277 @@
  */
 
 #include <assert.h>
+#include <stdlib.h>
 #include "rutf8.h"
 
 
-int rutf8_text_width(const struct utf8lite_text *text, int flags)
+struct split_job {
+	const struct utf8lite_text *text;
+	const uint8_t *ptr;
+	const size_t *bound;	// chunk i is [bound[i], bound[i + 1])
+	int *err;
+	int *val;
+	int flags;
+};
+
+static size_t *split_bounds(size_t size, size_t *nchunkptr);
+static void assign_work(void *data, int tid, R_xlen_t begin, R_xlen_t end);
+static void measure_work(void *data, int tid, R_xlen_t begin, R_xlen_t end);
+static int text_measure(const struct utf8lite_text *text, int flags,
+			int *widthptr);
+
+
+/*
+ * Validate and assign a text, like utf8lite_text_assign() with no flags.
+ * Long inputs get split before non-continuation bytes, where every
+ * valid character lies within a single chunk, and the chunks get
+ * validated in parallel. Safe to call from a worker thread (nested
+ * calls run serially).
+ */
+int rutf8_text_assign(struct utf8lite_text *text, const uint8_t *ptr,
+		      size_t size, int nthread)
 {
-	struct utf8lite_graphscan scan;
-	int err = 0, width, w;
+	struct split_job job;
+	size_t *bound = NULL, i, nchunk, pos, k;
+	int *err = NULL, *val = NULL, ascii, valid;
+
+	if (size > UTF8LITE_TEXT_SIZE_MAX) {
+		text->ptr = NULL;
+		text->attr = 0;
+		return UTF8LITE_ERROR_OVERFLOW;
+	}
 
-	utf8lite_graphscan_make(&scan, text);
-	width = 0;
-	while (utf8lite_graphscan_advance(&scan)) {
-		TRY(utf8lite_graph_measure(&scan.current, flags, &w));
-		if (w < 0) {
-			return -1;
-		}
-		if (width > INT_MAX - w) {
-			Rf_error("width exceeds maximum (%d)", INT_MAX);
+	if (nthread <= 1 || size < RUTF8_SPLIT_SIZE) {
+		goto serial;
+	}
+
+	if (!(bound = split_bounds(size, &nchunk))
+			|| !(err = calloc(nchunk, sizeof(*err)))
+			|| !(val = calloc(nchunk, sizeof(*val)))) {
+		goto serial;
+	}
+
+	for (i = 1; i < nchunk; i++) {
+		pos = bound[i];
+		// a run of 4 or more continuation bytes is invalid no matter
+		// where it gets split
+		for (k = 0; k < 3 && (ptr[pos] & 0xC0) == 0x80; k++) {
+			pos++;
 		}
-		width += w;
+		bound[i] = pos;
+	}
+
+	job.text = NULL;
+	job.ptr = ptr;
+	job.bound = bound;
+	job.err = err;
+	job.val = val;
+	job.flags = 0;
+	rutf8_parallel_for((R_xlen_t)nchunk, 1, nthread, assign_work, &job);
+
+	valid = 1;
+	ascii = 1;
+	for (i = 0; i < nchunk; i++) {
+		valid = valid && !err[i];
+		ascii = ascii && val[i];
+	}
+
+	free(val);
+	free(err);
+	free(bound);
+
+	if (!valid) {
+		// get the error from the serial version
+		return utf8lite_text_assign(text, ptr, size, 0, NULL);
+	}
+
+	text->ptr = (uint8_t *)ptr;
+	text->attr = size | (ascii ? UTF8LITE_TEXT_ASCII_BIT : 0);
+	return 0;
+
+serial:
+	free(val);
+	free(err);
+	free(bound);
+	return utf8lite_text_assign(text, ptr, size, 0, NULL);
+}
+
+
+int rutf8_text_width(const struct utf8lite_text *text, int flags)
+{
+	int err, nthread, width;
+
+	nthread = 1;
+	if (UTF8LITE_TEXT_SIZE(text) >= RUTF8_SPLIT_SIZE) {
+		nthread = rutf8_nthread();
+	}
+
+	err = rutf8_text_measure(text, flags, nthread, &width);
+	if (err == UTF8LITE_ERROR_OVERFLOW) {
+		Rf_error("width exceeds maximum (%d)", INT_MAX);
 	}
-exit:
 	CHECK_ERROR(err);
 	return width;
 }
 
 
-int rutf8_text_lwidth(const struct utf8lite_text *text, int flags,
-		      int limit, int ellipsis)
+/*
+ * Like rutf8_text_width(), but reports overflow through the return value
+ * instead of raising an R error, so that it is safe to call from a
+ * worker thread. Long texts get split at context-free grapheme
+ * boundaries, and the pieces get measured in parallel.
+ */
+int rutf8_text_measure(const struct utf8lite_text *text, int flags,
+		       int nthread, int *widthptr)
 {
-	struct utf8lite_graphscan scan;
-	int err = 0, width, w;
+	struct split_job job;
+	const uint8_t *pos, *prev;
+	size_t *bound = NULL, i, nchunk, size = UTF8LITE_TEXT_SIZE(text);
+	int *err = NULL, *val = NULL, ret = 0, width;
+
+	if (nthread <= 1 || size < RUTF8_SPLIT_SIZE
+			|| UTF8LITE_TEXT_HAS_ESC(text)) {
+		goto serial;
+	}
+
+	if (!(bound = split_bounds(size, &nchunk))
+			|| !(err = calloc(nchunk, sizeof(*err)))
+			|| !(val = calloc(nchunk, sizeof(*val)))) {
+		goto serial;
+	}
+
+	prev = text->ptr;
+	for (i = 1; i < nchunk; i++) {
+		pos = utf8lite_graph_boundary(text, text->ptr + bound[i]);
+		if (pos < prev) {
+			pos = prev;
+		}
+		bound[i] = (size_t)(pos - text->ptr);
+		prev = pos;
+	}
+
+	job.text = text;
+	job.ptr = text->ptr;
+	job.bound = bound;
+	job.err = err;
+	job.val = val;
+	job.flags = flags;
+	rutf8_parallel_for((R_xlen_t)nchunk, 1, nthread, measure_work, &job);
 
-	utf8lite_graphscan_make(&scan, text);
 	width = 0;
-	while (utf8lite_graphscan_advance(&scan)) {
-		TRY(utf8lite_graph_measure(&scan.current, flags, &w));
-		if (w < 0) {
-			return -1;
+	for (i = 0; i < nchunk; i++) {
+		if ((ret = err[i])) {
+			width = -1;
+			break;
 		}
-		if (width > limit - w) {
-			return width + ellipsis;
+		if (val[i] < 0) {
+			width = -1;
+			break;
 		}
-		width += w;
+		if (width > INT_MAX - val[i]) {
+			ret = UTF8LITE_ERROR_OVERFLOW;
+			width = -1;
+			break;
+		}
+		width += val[i];
+	}
+
+	free(val);
+	free(err);
+	free(bound);
+	*widthptr = width;
+	return ret;
+
+serial:
+	free(val);
+	free(err);
+	free(bound);
+	return text_measure(text, flags, widthptr);
+}
+
+
+size_t *split_bounds(size_t size, size_t *nchunkptr)
+{
+	size_t *bound, i, nchunk;
+
+	nchunk = size / RUTF8_SPLIT_CHUNK;
+	if (nchunk == 0) {
+		nchunk = 1;
+	}
+
+	if (!(bound = malloc((nchunk + 1) * sizeof(*bound)))) {
+		return NULL;
+	}
+
+	for (i = 0; i < nchunk; i++) {
+		bound[i] = i * RUTF8_SPLIT_CHUNK;
+	}
+	bound[nchunk] = size;
+
+	*nchunkptr = nchunk;
+	return bound;
+}
+
+
+void assign_work(void *data, int tid, R_xlen_t begin, R_xlen_t end)
+{
+	const struct split_job *job = data;
+	struct utf8lite_text text;
+	R_xlen_t i;
+
+	(void)tid;
+
+	for (i = begin; i < end; i++) {
+		job->err[i] = utf8lite_text_assign(&text,
+						   job->ptr + job->bound[i],
+						   job->bound[i + 1]
+						   - job->bound[i], 0, NULL);
+		job->val[i] = !job->err[i] && utf8lite_text_isascii(&text);
+	}
+}
+
+
+void measure_work(void *data, int tid, R_xlen_t begin, R_xlen_t end)
+{
+	const struct split_job *job = data;
+	struct utf8lite_text text;
+	R_xlen_t i;
+
+	(void)tid;
+
+	for (i = begin; i < end; i++) {
+		text.ptr = (uint8_t *)job->ptr + job->bound[i];
+		text.attr = ((job->bound[i + 1] - job->bound[i])
+			     | UTF8LITE_TEXT_BITS(job->text));
+		job->err[i] = text_measure(&text, job->flags, &job->val[i]);
+	}
+}
+
+
+int text_measure(const struct utf8lite_text *text, int flags, int *widthptr)
+{
+	int err, width;
+
+	// with no limit, exceeding the limit means overflow
+	err = utf8lite_text_width(text, flags, INT_MAX, &width);
+	if (err == UTF8LITE_ERROR_RANGE) {
+		err = UTF8LITE_ERROR_OVERFLOW;
+	}
+
+	*widthptr = err ? -1 : width;
+	return err;
+}
+
+
+int rutf8_text_lwidth(const struct utf8lite_text *text, int flags,
+		      int limit, int ellipsis)
+{
+	int err, width;
+
+	err = utf8lite_text_width(text, flags, limit, &width);
+	if (err == UTF8LITE_ERROR_RANGE) {
+		return width + ellipsis;
 	}
-exit:
 	CHECK_ERROR(err);
 	return width;
 }
@@ -71,6 +297,13 @@ int rutf8_text_rwidth(const struct utf8lite_text *text, int flags,
 	struct utf8lite_graphscan scan;
 	int err = 0, width, w;
 
+	// if the whole text fits, the width does not depend on the direction
+	err = utf8lite_text_width(text, flags, limit, &width);
+	if (!err && width >= 0) {
+		return width;
+	}
+	err = 0;
+
 	utf8lite_graphscan_make(&scan, text);
 	utf8lite_graphscan_skip(&scan);
 	width = 0;
@@ -93,7 +326,6 @@ static void rutf8_text_lrender(struct utf8lite_render *r,
 			       const struct utf8lite_text *text,
 			       int width_min, int quote, int centre)
 {
-	struct utf8lite_graphscan scan;
 	int err = 0, w, fullwidth, width, quotes;
 
 	assert(width_min >= 0);
@@ -116,18 +348,20 @@ static void rutf8_text_lrender(struct utf8lite_render *r,
 		width++;
 	}
 
-	utf8lite_graphscan_make(&scan, text);
-	while (utf8lite_graphscan_advance(&scan)) {
-		TRY(utf8lite_graph_measure(&scan.current, r->flags, &w));
-		TRY(utf8lite_render_graph(r, &scan.current));
-
-		assert(w >= 0);
-		if (width <= width_min - w) {
-			width += w;
-		} else {
+	// past the padding, the width no longer matters
+	if (width < width_min) {
+		err = utf8lite_text_width(text, r->flags, width_min - width,
+					  &w);
+		if (err == UTF8LITE_ERROR_RANGE) {
+			err = 0;
 			width = width_min; // truncate to avoid overflow
+		} else {
+			TRY(err);
+			assert(w >= 0);
+			width += w;
 		}
 	}
+	TRY(utf8lite_render_text(r, text));
 
 	if (quote) {
 		TRY(utf8lite_render_raw(r, "\"", 1));
@@ -146,7 +380,6 @@ static void rutf8_text_rrender(struct utf8lite_render *r,
 			       const struct utf8lite_text *text,
 			       int width_min, int quote)
 {
-	struct utf8lite_graphscan scan;
 	int err = 0, fullwidth, quotes;
 
 	quotes = quote ? 2 : 0;
@@ -165,10 +398,7 @@ static void rutf8_text_rrender(struct utf8lite_render *r,
 		TRY(utf8lite_render_raw(r, "\"", 1));
 	}
 
-	utf8lite_graphscan_make(&scan, text);
-	while (utf8lite_graphscan_advance(&scan)) {
-		TRY(utf8lite_render_graph(r, &scan.current));
-	}
+	TRY(utf8lite_render_text(r, text));
 
 	if (quote) {
 		TRY(utf8lite_render_raw(r, "\"", 1));
@@ -193,6 +423,7 @@ void rutf8_text_render(struct utf8lite_render *r,
 
 static SEXP rutf8_text_lformat(struct utf8lite_render *r,
 			       const struct utf8lite_text *text,
+			       const struct utf8lite_widthindex *index,
 			       int trim, int chars, int quote,
 			       const char *ellipsis, size_t nellipsis,
 			       int wellipsis, int flags, int width_max,
@@ -200,20 +431,53 @@ static SEXP rutf8_text_lformat(struct utf8lite_render *r,
 {
 	SEXP ans = R_NilValue;
 	struct utf8lite_graphscan scan;
-	int err = 0, w, trunc, bfill, efill, fullwidth, width, quotes;
+	struct utf8lite_text head;
+	size_t size = 0;
+	int err = 0, w, trunc, bfill, efill, fullwidth, width, quotes, fits;
 
 	quotes = quote ? 2 : 0;
 
+	// measure in one pass; the same result as rutf8_text_lwidth()
+	if (index) {
+		err = utf8lite_widthindex_prefix(index, chars, &size, &width);
+	} else {
+		err = utf8lite_text_width(text, flags, chars, &width);
+	}
+	trunc = (err == UTF8LITE_ERROR_RANGE);
+	if (trunc) {
+		err = 0;
+		width += wellipsis;
+		fits = 0;
+	} else {
+		TRY(err);
+		fits = (width >= 0);
+	}
+
 	bfill = 0;
 	if (centre && !trim) {
-		fullwidth = (rutf8_text_lwidth(text, flags, chars, wellipsis)
-			     + quotes);
+		fullwidth = width + quotes;
 		if (fullwidth < width_max) {
 			bfill = (width_max - fullwidth) / 2;
 			TRY(utf8lite_render_chars(r, ' ', bfill));
 		}
 	}
 
+	// if nothing gets truncated, render the text without measuring
+	// each grapheme again
+	if (fits) {
+		TRY(utf8lite_render_text(r, text));
+		goto fill;
+	}
+
+	// the index knows where the truncated text ends
+	if (index && trunc) {
+		head.ptr = text->ptr;
+		head.attr = size | UTF8LITE_TEXT_BITS(text);
+		TRY(utf8lite_render_text(r, &head));
+		TRY(utf8lite_render_raw(r, ellipsis, nellipsis));
+		goto fill;
+	}
+
 	width = 0;
 	trunc = 0;
 	utf8lite_graphscan_make(&scan, text);
@@ -232,12 +496,13 @@ static SEXP rutf8_text_lformat(struct utf8lite_render *r,
 		width += w;
 	}
 
+fill:
 	if (!trim) {
 		efill = width_max - width - quotes - bfill;
 		TRY(utf8lite_render_chars(r, ' ', efill));
 	}
 
-	ans = mkCharLenCE((char *)r->string, r->length, CE_UTF8);
+	ans = rutf8_render_mkchar(r, CE_UTF8);
 	utf8lite_render_clear(r);
 exit:
 	CHECK_ERROR(err);
@@ -247,16 +512,52 @@ exit:
 
 static SEXP rutf8_text_rformat(struct utf8lite_render *r,
 			       const struct utf8lite_text *text,
+			       const struct utf8lite_widthindex *index,
 			       int trim, int chars, int quote,
 			       const char *ellipsis, size_t nellipsis,
 			       int wellipsis, int flags, int width_max)
 {
 	SEXP ans = R_NilValue;
 	struct utf8lite_graphscan scan;
+	struct utf8lite_text tail;
+	size_t begin = 0;
 	int err = 0, w, width, quotes, trunc;
 
 	quotes = quote ? 2 : 0;
 
+	// if nothing gets truncated, measure in one pass and render the
+	// whole text
+	if (index) {
+		err = utf8lite_widthindex_suffix(index, chars, &begin, &width);
+	} else {
+		err = utf8lite_text_width(text, flags, chars, &width);
+	}
+	if (!err && width >= 0) {
+		if (!trim) {
+			TRY(utf8lite_render_chars(r, ' ',
+						  width_max - width - quotes));
+		}
+		TRY(utf8lite_render_text(r, text));
+		goto out;
+	}
+
+	// the index knows where the truncated text starts
+	if (index && err == UTF8LITE_ERROR_RANGE) {
+		err = 0;
+		width += wellipsis;
+		if (!trim) {
+			TRY(utf8lite_render_chars(r, ' ',
+						  width_max - width - quotes));
+		}
+		TRY(utf8lite_render_raw(r, ellipsis, nellipsis));
+		tail.ptr = text->ptr + begin;
+		tail.attr = ((UTF8LITE_TEXT_SIZE(text) - begin)
+			     | UTF8LITE_TEXT_BITS(text));
+		TRY(utf8lite_render_text(r, &tail));
+		goto out;
+	}
+	err = 0;
+
 	utf8lite_graphscan_make(&scan, text);
 	utf8lite_graphscan_skip(&scan);
 	width = 0;
@@ -285,7 +586,8 @@ static SEXP rutf8_text_rformat(struct utf8lite_render *r,
 		TRY(utf8lite_render_graph(r, &scan.current));
 	}
 
-	ans = mkCharLenCE((char *)r->string, r->length, CE_UTF8);
+out:
+	ans = rutf8_render_mkchar(r, CE_UTF8);
 	utf8lite_render_clear(r);
 exit:
 	CHECK_ERROR(err);
@@ -295,6 +597,7 @@ exit:
 
 SEXP rutf8_text_format(struct utf8lite_render *r,
 		       const struct utf8lite_text *text,
+		       const struct utf8lite_widthindex *index,
 		       int trim, int chars, enum rutf8_justify_type justify,
 		       int quote, const char *ellipsis, size_t nellipsis,
 		       int wellipsis, int flags, int width_max)
@@ -302,12 +605,12 @@ SEXP rutf8_text_format(struct utf8lite_render *r,
 	int centre;
 
 	if (justify == RUTF8_JUSTIFY_RIGHT) {
-		return rutf8_text_rformat(r, text, trim, chars, quote,
+		return rutf8_text_rformat(r, text, index, trim, chars, quote,
 					  ellipsis, nellipsis, wellipsis,
 					  flags, width_max);
 	} else {
 		centre = (justify == RUTF8_JUSTIFY_CENTRE);
-		return rutf8_text_lformat(r, text, trim, chars, quote,
+		return rutf8_text_lformat(r, text, index, trim, chars, quote,
 					  ellipsis, nellipsis, wellipsis,
 					  flags, width_max, centre);
 	}
@@ -0,0 +1,280 @@
+/*
+ * Copyright 2017 Patrick O. Perry.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <pthread.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include "rutf8.h"
+
+#define THREADS_MAX 256
+
+/*
+ * Worker pool. The main thread always takes part in a job as thread 0;
+ * the pool holds the other `nworker` threads, numbered 1 to `nworker`.
+ * Workers sleep on `start` until the job generation changes, claim
+ * chunks of the index range under the mutex, and signal `done` when the
+ * last one of them runs out of work.
+ *
+ * The pool gets created on first use, and re-created when the
+ * `utf8.threads` option changes or after a fork (the child process does
+ * not inherit the worker threads).
+ */
+struct pool {
+	pthread_mutex_t mutex;
+	pthread_cond_t start;
+	pthread_cond_t done;
+	pthread_t *threads;
+	int nworker;
+	int shutdown;
+	int busy;
+	int nactive;
+	unsigned long generation;
+	pid_t pid;
+
+	rutf8_worker_func func;
+	void *data;
+	R_xlen_t next;
+	R_xlen_t end;
+	R_xlen_t chunk;
+};
+
+static struct pool pool;
+static int pool_init;
+
+static void pool_work(int tid);
+static void *pool_main(void *arg);
+static int pool_start(int nworker);
+static void pool_stop(void);
+
+
+int rutf8_nthread(void)
+{
+	SEXP opt;
+	int n;
+
+	opt = GetOption1(install("utf8.threads"));
+	if (opt == R_NilValue) {
+		return 1;
+	}
+
+	n = asInteger(opt);
+	if (n == NA_INTEGER || n < 1) {
+		Rf_error("'utf8.threads' option must be a positive integer");
+	}
+
+	return n > THREADS_MAX ? THREADS_MAX : n;
+}
+
+
+void rutf8_parallel_for(R_xlen_t n, R_xlen_t grain, int nthread,
+			rutf8_worker_func func, void *data)
+{
+	R_xlen_t chunk;
+
+	if (grain < 1) {
+		grain = 1;
+	}
+
+	if (nthread <= 1 || n <= grain || (pool_init && pool.busy)
+			|| pool_start(nthread - 1)) {
+		func(data, 0, 0, n);
+		return;
+	}
+
+	// aim for a few chunks per thread, so that uneven elements balance
+	chunk = n / (4 * (R_xlen_t)nthread);
+	if (chunk < grain) {
+		chunk = grain;
+	}
+
+	pthread_mutex_lock(&pool.mutex);
+	pool.busy = 1;
+	pool.func = func;
+	pool.data = data;
+	pool.next = 0;
+	pool.end = n;
+	pool.chunk = chunk;
+	pool.nactive = pool.nworker;
+	pool.generation++;
+	pthread_cond_broadcast(&pool.start);
+
+	pool_work(0);
+
+	while (pool.nactive > 0) {
+		pthread_cond_wait(&pool.done, &pool.mutex);
+	}
+	pool.busy = 0;
+	pool.func = NULL;
+	pool.data = NULL;
+	pthread_mutex_unlock(&pool.mutex);
+}
+
+
+void rutf8_threads_stop(void)
+{
+	if (pool_init) {
+		pool_stop();
+	}
+}
+
+
+// called with the mutex held; returns with it held
+void pool_work(int tid)
+{
+	rutf8_worker_func func = pool.func;
+	void *data = pool.data;
+	R_xlen_t begin, end;
+
+	while (pool.next < pool.end) {
+		begin = pool.next;
+		if (pool.end - begin > pool.chunk) {
+			end = begin + pool.chunk;
+		} else {
+			end = pool.end;
+		}
+		pool.next = end;
+
+		pthread_mutex_unlock(&pool.mutex);
+		func(data, tid, begin, end);
+		pthread_mutex_lock(&pool.mutex);
+	}
+}
+
+
+void *pool_main(void *arg)
+{
+	int tid = (int)(intptr_t)arg;
+	unsigned long seen = 0; // the pool starts at generation 0
+
+	pthread_mutex_lock(&pool.mutex);
+
+	for (;;) {
+		while (!pool.shutdown && pool.generation == seen) {
+			pthread_cond_wait(&pool.start, &pool.mutex);
+		}
+		if (pool.shutdown) {
+			break;
+		}
+		seen = pool.generation;
+
+		pool_work(tid);
+
+		if (--pool.nactive == 0) {
+			pthread_cond_signal(&pool.done);
+		}
+	}
+
+	pthread_mutex_unlock(&pool.mutex);
+	return NULL;
+}
+
+
+/*
+ * Make sure the pool has `nworker` threads. Returns non-zero if the
+ * threads could not be created, in which case the caller should run
+ * serially.
+ */
+int pool_start(int nworker)
+{
+#ifndef _WIN32
+	sigset_t mask, oldmask;
+#endif
+	int err = 0, i;
+
+	if (pool_init && pool.pid != getpid()) {
+		// forked child: the workers only exist in the parent, and
+		// the synchronization objects may be in an arbitrary state
+		free(pool.threads);
+		pool.threads = NULL;
+		pool.nworker = 0;
+		pool_init = 0;
+	}
+
+	if (pool_init && pool.nworker == nworker) {
+		return 0;
+	}
+
+	if (pool_init) {
+		pool_stop();
+	}
+
+	pool.threads = malloc((size_t)nworker * sizeof(*pool.threads));
+	if (!pool.threads) {
+		return UTF8LITE_ERROR_NOMEM;
+	}
+
+	pthread_mutex_init(&pool.mutex, NULL);
+	pthread_cond_init(&pool.start, NULL);
+	pthread_cond_init(&pool.done, NULL);
+	pool.nworker = 0;
+	pool.shutdown = 0;
+	pool.busy = 0;
+	pool.nactive = 0;
+	pool.generation = 0;
+	pool.pid = getpid();
+	pool_init = 1;
+
+#ifndef _WIN32
+	// keep signals (in particular SIGINT) on the main thread
+	sigfillset(&mask);
+	pthread_sigmask(SIG_SETMASK, &mask, &oldmask);
+#endif
+
+	for (i = 0; i < nworker; i++) {
+		if (pthread_create(&pool.threads[i], NULL, pool_main,
+				   (void *)(intptr_t)(i + 1))) {
+			err = UTF8LITE_ERROR_OS;
+			break;
+		}
+		pool.nworker++;
+	}
+
+#ifndef _WIN32
+	pthread_sigmask(SIG_SETMASK, &oldmask, NULL);
+#endif
+
+	if (err) {
+		pool_stop();
+	}
+
+	return err;
+}
+
+
+void pool_stop(void)
+{
+	int i;
+
+	pthread_mutex_lock(&pool.mutex);
+	pool.shutdown = 1;
+	pthread_cond_broadcast(&pool.start);
+	pthread_mutex_unlock(&pool.mutex);
+
+	for (i = 0; i < pool.nworker; i++) {
+		pthread_join(pool.threads[i], NULL);
+	}
+
+	pthread_cond_destroy(&pool.done);
+	pthread_cond_destroy(&pool.start);
+	pthread_mutex_destroy(&pool.mutex);
+	free(pool.threads);
+	pool.threads = NULL;
+	pool.nworker = 0;
+	pool_init = 0;
+}
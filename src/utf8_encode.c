@@ -38,6 +38,7 @@ SEXP rutf8_utf8_encode(SEXP sx, SEXP swidth, SEXP squote, SEXP sjustify,
 		Rf_error("argument is not a character object");
 	}
 	n = XLENGTH(sx);
+	rutf8_cache_begin();
 
 	if (swidth == R_NilValue || INTEGER(swidth)[0] == NA_INTEGER) {
 		width = -1;
@@ -105,6 +106,9 @@ SEXP rutf8_utf8_encode(SEXP sx, SEXP swidth, SEXP squote, SEXP sjustify,
 					      RUTF8_STYLE_CLOSE));
 	}
 
+	// justified elements take at least `width` bytes
+	rutf8_render_reserve(render, (size_t)width);
+
 	PROTECT(ans = duplicate(sx)); nprot++;
 
 	for (i = 0; i < n; i++) {
@@ -117,8 +121,7 @@ SEXP rutf8_utf8_encode(SEXP sx, SEXP swidth, SEXP squote, SEXP sjustify,
 		} else {
 			rutf8_string_render(render, &elt, width, quote,
 					    justify);
-			ans_i = mkCharLenCE(render->string, render->length,
-					    CE_UTF8);
+			ans_i = rutf8_render_mkchar(render, CE_UTF8);
 			utf8lite_render_clear(render);
 		}
 
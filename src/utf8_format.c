@@ -30,11 +30,12 @@ SEXP rutf8_utf8_format(SEXP sx, SEXP strim, SEXP schars, SEXP sjustify,
 {
 	SEXP ans, selt, srender, na_print, ans_i = NA_STRING;
 	struct utf8lite_render *render;
+	struct rutf8_dedup dedup;
 	enum rutf8_justify_type justify;
 	struct rutf8_string elt, na;
 	const char *ellipsis;
 	size_t nellipsis;
-	R_xlen_t i, n;
+	R_xlen_t *src, first, i, n, nsrc;
 	int chars, chars_i, wellipsis, width, width_max, trim, na_encode,
 	    quote, quote_i, quotes, na_width, utf8, nprot, flags;
 
@@ -47,6 +48,7 @@ SEXP rutf8_utf8_format(SEXP sx, SEXP strim, SEXP schars, SEXP sjustify,
 	if (!isString(sx)) {
 		error("argument is not a character vector");
 	}
+	rutf8_cache_begin();
 	PROTECT(ans = duplicate(sx)); nprot++;
 	n = XLENGTH(ans);
 
@@ -121,10 +123,22 @@ SEXP rutf8_utf8_format(SEXP sx, SEXP strim, SEXP schars, SEXP sjustify,
         PROTECT(srender = rutf8_alloc_render(0)); nprot++;
 	render = rutf8_as_render(srender);
 
+	// a repeated value has the same width and formatted result as its
+	// first occurrence; record where that is on the first pass
+	rutf8_dedup_init(&dedup, n);
+	src = (void *)R_alloc(n ? n : 1, sizeof(*src));
+	nsrc = 0;
+
 	for (i = 0; i < n; i++) {
 		CHECK_INTERRUPT(i);
 
 		PROTECT(selt = STRING_ELT(sx, i)); nprot++;
+		src[i] = rutf8_dedup_first(&dedup, selt, i);
+		nsrc = i + 1;
+		if (src[i] != i) {
+			UNPROTECT(1); nprot--;
+			continue;
+		}
 		rutf8_string_init(&elt, selt);
 
 		if (elt.type == RUTF8_STRING_NONE) {
@@ -150,10 +164,25 @@ SEXP rutf8_utf8_format(SEXP sx, SEXP strim, SEXP schars, SEXP sjustify,
 		UNPROTECT(1); nprot--;
 	}
 
+	// the width pass can stop early; look up the rest of the elements
+	for (i = nsrc; i < n; i++) {
+		CHECK_INTERRUPT(i);
+		src[i] = rutf8_dedup_first(&dedup, STRING_ELT(sx, i), i);
+	}
+
+	// each formatted element takes at least width_max bytes
+	rutf8_render_reserve(render, (size_t)width_max + nellipsis);
+
 	for (i = 0; i < n; i++) {
 		CHECK_INTERRUPT(i);
 
 		PROTECT(selt = STRING_ELT(sx, i)); nprot++;
+		first = src[i];
+		if (first != i) {
+			UNPROTECT(1); nprot--;
+			SET_STRING_ELT(ans, i, STRING_ELT(ans, first));
+			continue;
+		}
 		rutf8_string_init(&elt, selt);
 
 		if (elt.type == RUTF8_STRING_NONE) {
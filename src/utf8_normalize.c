@@ -17,19 +17,45 @@
 #include <limits.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 #include "rutf8.h"
 
+struct worker {
+	struct utf8lite_textmap *map;	// from the pool, or NULL
+	uint8_t *buf;		// mapped text for the current batch
+	size_t nbuf;
+	size_t nbuf_max;
+	int err;
+	R_xlen_t err_index;	// first entry with an error
+	struct utf8lite_message msg;
+};
+
 struct context {
-	struct utf8lite_textmap map;
-	int has_map;
+	struct worker *workers;
+	int nworker;
+	int type;		// the map type
+};
+
+struct output {
+	size_t off;		// offset in the worker's buffer
+	size_t size;
+	int tid;
+	int same;		// whether the output equals the input
+	int ascii;		// whether the input is ASCII
+};
+
+struct normalize_job {
+	struct context *ctx;
+	const struct rutf8_bytes *elts;	// NULL ptr for NA
+	struct output *out;
 };
 
 
 static void context_init(struct context *ctx, SEXP map_case, SEXP map_compat,
-			 SEXP map_quote, SEXP remove_ignorable)
+			 SEXP map_quote, SEXP remove_ignorable, int nthread)
 {
-	int err = 0, type;
+	int err = 0, type, t;
 
 	type = UTF8LITE_TEXTMAP_NORMAL;
 
@@ -49,8 +75,14 @@ static void context_init(struct context *ctx, SEXP map_case, SEXP map_compat,
 		type |= UTF8LITE_TEXTMAP_RMDI;
 	}
 
-	TRY(utf8lite_textmap_init(&ctx->map, type));
-	ctx->has_map = 1;
+	ctx->type = type;
+	TRY_ALLOC(ctx->workers = calloc((size_t)nthread,
+					sizeof(*ctx->workers)));
+	ctx->nworker = nthread;
+
+	for (t = 0; t < nthread; t++) {
+		TRY(rutf8_pool_get_textmap(&ctx->workers[t].map, type));
+	}
 exit:
 	CHECK_ERROR(err);
 }
@@ -59,9 +91,93 @@ exit:
 static void context_destroy(void *obj)
 {
 	struct context *ctx = obj;
+	int t;
 
-	if (ctx->has_map) {
-		utf8lite_textmap_destroy(&ctx->map);
+	for (t = 0; t < ctx->nworker; t++) {
+		rutf8_pool_put_textmap(ctx->workers[t].map);
+		free(ctx->workers[t].buf);
+	}
+	free(ctx->workers);
+}
+
+
+static int worker_append(struct worker *w, const uint8_t *ptr, size_t size)
+{
+	uint8_t *buf;
+	size_t nbuf_max;
+
+	if (!w->buf || size > w->nbuf_max - w->nbuf) {
+		nbuf_max = w->nbuf_max ? w->nbuf_max : 256;
+		while (size > nbuf_max - w->nbuf) {
+			if (nbuf_max > SIZE_MAX / 2) {
+				return UTF8LITE_ERROR_OVERFLOW;
+			}
+			nbuf_max *= 2;
+		}
+		if (!(buf = realloc(w->buf, nbuf_max))) {
+			return UTF8LITE_ERROR_NOMEM;
+		}
+		w->buf = buf;
+		w->nbuf_max = nbuf_max;
+	}
+
+	if (size) {
+		memcpy(w->buf + w->nbuf, ptr, size);
+	}
+	w->nbuf += size;
+	return 0;
+}
+
+
+static void normalize_work(void *data, int tid, R_xlen_t begin,
+			   R_xlen_t end)
+{
+	const struct normalize_job *job = data;
+	struct worker *w = &job->ctx->workers[tid];
+	const struct rutf8_bytes *elt;
+	struct utf8lite_message msg;
+	R_xlen_t i;
+	int err = 0;
+
+	for (i = begin; i < end; i++) {
+		elt = &job->elts[i];
+		if (!elt->ptr) {
+			continue;
+		}
+
+		// validate and map in one pass over the input
+		TRY(utf8lite_textmap_set_utf8(w->map, elt->ptr, elt->size,
+					      &msg));
+
+		job->out[i].off = w->nbuf;
+		job->out[i].size = UTF8LITE_TEXT_SIZE(&w->map->text);
+		job->out[i].tid = tid;
+
+		// the map aliases its input when it is already normalized
+		if (w->map->text.ptr == elt->ptr
+				|| (job->out[i].size == elt->size
+				    && !memcmp(w->map->text.ptr, elt->ptr,
+					       elt->size))) {
+			// the output equals the input, so it has the same
+			// character set
+			job->out[i].ascii = utf8lite_text_isascii(&w->map->text);
+			job->out[i].same = 1;
+			continue;
+		}
+
+		job->out[i].ascii = 0;
+		job->out[i].same = 0;
+		TRY(worker_append(w, w->map->text.ptr, job->out[i].size));
+	}
+
+exit:
+	// report the first error in the worker's range
+	if (err && (!w->err || i < w->err_index)) {
+		w->err = err;
+		w->err_index = i;
+		if (err == UTF8LITE_ERROR_INVAL) {
+			w->msg = msg;
+		}
 	}
 }
 
@@ -69,47 +185,167 @@ static void context_destroy(void *obj)
 SEXP rutf8_utf8_normalize(SEXP x, SEXP map_case, SEXP map_compat,
 			  SEXP map_quote, SEXP remove_ignorable)
 {
-	SEXP ans, sctx, elt;
+	SEXP ans, sctx, elt, hit;
+	PROTECT_INDEX ipx;
 	struct context *ctx;
-	struct utf8lite_text text;
+	struct normalize_job job;
+	struct rutf8_bytes *elts;
+	struct rutf8_dedup dedup;
+	const struct output *out;
+	const struct worker *w;
 	const uint8_t *ptr;
-	size_t size;
-	R_xlen_t i, n;
-	int err = 0, nprot = 0;
+	const void *vmax;
+	R_xlen_t *src, i, m, n, off;
+	cetype_t ce;
+	int err = 0, nprot = 0, duped = 0, nthread, t, tbad;
 
 	if (x == R_NilValue) {
 		return R_NilValue;
 	}
+	if (!isString(x)) {
+		error("argument is not a character object");
+	}
+
+	nthread = rutf8_nthread();
+	rutf8_normcache_begin();
 
 	PROTECT(sctx = rutf8_alloc_context(sizeof(*ctx), context_destroy));
 	nprot++;
         ctx = rutf8_as_context(sctx);
-	context_init(ctx, map_case, map_compat, map_quote, remove_ignorable);
+	context_init(ctx, map_case, map_compat, map_quote, remove_ignorable,
+		     nthread);
 
-	PROTECT(ans = duplicate(x)); nprot++;
-	n = XLENGTH(ans);
+	// only duplicate the input when an element changes
+	PROTECT_WITH_INDEX(ans = x, &ipx); nprot++;
+	n = XLENGTH(x);
 
-	for (i = 0; i < n; i++) {
-		CHECK_INTERRUPT(i);
+	rutf8_dedup_init(&dedup, n);
+	m = n < RUTF8_BATCH_SIZE ? n : RUTF8_BATCH_SIZE;
+	src = (void *)R_alloc(m ? m : 1, sizeof(*src));
+	elts = (void *)R_alloc(m ? m : 1, sizeof(*elts));
+	job.ctx = ctx;
+	job.elts = elts;
+	job.out = (void *)R_alloc(m ? m : 1, sizeof(*job.out));
 
-		PROTECT(elt = STRING_ELT(ans, i)); nprot++;
-		if (elt == NA_STRING) {
-			UNPROTECT(1); nprot--;
-			continue;
+	for (off = 0; off < n; off += m) {
+		m = n - off < RUTF8_BATCH_SIZE ? n - off : RUTF8_BATCH_SIZE;
+
+		// the table grows with R_alloc, so look up before vmaxget()
+		for (i = 0; i < m; i++) {
+			src[i] = rutf8_dedup_first(&dedup,
+						   STRING_ELT(x, off + i),
+						   off + i);
 		}
 
-		ptr = (const uint8_t *)rutf8_translate_utf8(elt);
-		size = strlen((const char *)ptr);
-		TRY(utf8lite_text_assign(&text, ptr, size, 0, NULL));
-		TRY(utf8lite_textmap_set(&ctx->map, &text));
+		vmax = vmaxget();
+		for (i = 0; i < m; i++) {
+			CHECK_INTERRUPT(off + i);
 
-		ptr = ctx->map.text.ptr;
-		size = UTF8LITE_TEXT_SIZE(&ctx->map.text);
-		TRY(size > INT_MAX ? UTF8LITE_ERROR_OVERFLOW : 0);
+			elt = STRING_ELT(x, off + i);
+			if (elt == NA_STRING || src[i] != off + i) {
+				elts[i].ptr = NULL;
+				continue;
+			}
+
+			// convert to UTF-8 as in as_utf8(); the workers
+			// validate the result
+			ce = getCharCE(elt);
+			if (rutf8_encodes_utf8(ce) || ce == CE_BYTES) {
+				ptr = (const uint8_t *)CHAR(elt);
+				elts[i].size = (size_t)XLENGTH(elt);
+			} else {
+				ptr = (const uint8_t *)rutf8_translate_utf8(elt);
+				elts[i].size = strlen((const char *)ptr);
+			}
+			elts[i].ptr = ptr;
+
+			// a value from an earlier call needs no more work
+			hit = rutf8_normcache_lookup(ptr, elts[i].size,
+						     ctx->type);
+			if (hit) {
+				if (hit != elt) {
+					if (!duped) {
+						REPROTECT(ans = duplicate(ans),
+							  ipx);
+						duped = 1;
+					}
+					SET_STRING_ELT(ans, off + i, hit);
+				}
+				elts[i].ptr = NULL;
+			}
+		}
+		for (t = 0; t < nthread; t++) {
+			ctx->workers[t].nbuf = 0;
+		}
+
+		rutf8_parallel_for(m, RUTF8_BATCH_GRAIN, nthread,
+				   normalize_work, &job);
+
+		tbad = -1;
+		for (t = 0; t < nthread; t++) {
+			w = &ctx->workers[t];
+			if (w->err && (tbad < 0 || w->err_index
+				       < ctx->workers[tbad].err_index)) {
+				tbad = t;
+			}
+		}
+		if (tbad >= 0) {
+			w = &ctx->workers[tbad];
+			if (w->err == UTF8LITE_ERROR_INVAL) {
+				i = off + w->err_index;
+				ce = getCharCE(STRING_ELT(x, i));
+				rutf8_encoding_error(i, ce,
+						     rutf8_encodes_utf8(ce)
+						     || ce == CE_BYTES,
+						     w->msg.string);
+			}
+			TRY(w->err);
+		}
+
+		for (i = 0; i < m; i++) {
+			if (src[i] != off + i) {
+				// repeated value; its first copy is done
+				if (duped) {
+					elt = STRING_ELT(ans, src[i]);
+					SET_STRING_ELT(ans, off + i, elt);
+				}
+				continue;
+			} else if (!elts[i].ptr) {
+				continue;
+			}
+
+			out = &job.out[i];
+			elt = STRING_ELT(x, off + i);
+			if (out->same && (out->ascii
+					  || getCharCE(elt) == CE_UTF8)) {
+				// keep the original CHARSXP
+				rutf8_normcache_insert(elts[i].ptr,
+						       elts[i].size,
+						       ctx->type, elt);
+				continue;
+			}
+
+			TRY(out->size > INT_MAX ? UTF8LITE_ERROR_OVERFLOW : 0);
+			if (out->same) {
+				ptr = elts[i].ptr;
+			} else {
+				ptr = ctx->workers[out->tid].buf + out->off;
+			}
+
+			if (!duped) {
+				REPROTECT(ans = duplicate(ans), ipx);
+				duped = 1;
+			}
+
+			elt = mkCharLenCE((const char *)ptr, (int)out->size,
+					  CE_UTF8);
+			SET_STRING_ELT(ans, off + i, elt);
+			rutf8_normcache_insert(elts[i].ptr, elts[i].size,
+					       ctx->type, elt);
+		}
 
-		elt = mkCharLenCE((const char *)ptr, (int)size, CE_UTF8);
-		SET_STRING_ELT(ans, i, elt);
-		UNPROTECT(1); nprot--;
+		// unchanged outputs point into the translated inputs
+		vmaxset(vmax);
 	}
 
 exit:
@@ -16,18 +16,54 @@
 
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 #include "rutf8.h"
 
 
+struct valid_job {
+	const struct rutf8_bytes *elts;	// NULL ptr for NA
+	int *ans;
+	int nthread;
+};
+
+
+static void valid_work(void *data, int tid, R_xlen_t begin, R_xlen_t end)
+{
+	const struct valid_job *job = data;
+	const struct rutf8_bytes *bytes;
+	struct utf8lite_text text;
+	R_xlen_t i;
+	int val;
+
+	(void)tid;
+
+	for (i = begin; i < end; i++) {
+		bytes = &job->elts[i];
+		if (!bytes->ptr) {
+			job->ans[i] = NA_LOGICAL;
+			continue;
+		}
+
+		if (rutf8_text_assign(&text, bytes->ptr, bytes->size,
+				      job->nthread)) {
+			val = FALSE;
+		} else {
+			val = TRUE;
+		}
+		job->ans[i] = val;
+	}
+}
+
+
 SEXP rutf8_utf8_valid(SEXP sx)
 {
 	SEXP ans, sstr;
-	const uint8_t *str;
-	struct utf8lite_text text;
+	struct rutf8_bytes *elts;
+	struct valid_job job;
+	const void *vmax;
 	cetype_t ce;
-	size_t size;
-	R_xlen_t i, n;
-	int raw, val;
+	R_xlen_t i, m, n, off;
+	int nthread;
 
 	if (sx == R_NilValue) {
 		return R_NilValue;
@@ -42,35 +78,41 @@ SEXP rutf8_utf8_valid(SEXP sx)
 	setAttrib(ans, R_DimSymbol, getAttrib(sx, R_DimSymbol));
 	setAttrib(ans, R_DimNamesSymbol, getAttrib(sx, R_DimNamesSymbol));
 
-	n = XLENGTH(sx);
-	for (i = 0; i < n; i++) {
-		CHECK_INTERRUPT(i);
+	nthread = rutf8_nthread();
+	m = n < RUTF8_BATCH_SIZE ? n : RUTF8_BATCH_SIZE;
+	elts = (void *)R_alloc(m ? m : 1, sizeof(*elts));
 
-		PROTECT(sstr = STRING_ELT(sx, i));
-		if (sstr == NA_STRING) {
-			LOGICAL(ans)[i] = NA_LOGICAL;
-			UNPROTECT(1);
-			continue;
-		}
+	for (off = 0; off < n; off += m) {
+		m = n - off < RUTF8_BATCH_SIZE ? n - off : RUTF8_BATCH_SIZE;
+		vmax = vmaxget();
 
-		ce = getCharCE(sstr);
-		raw = rutf8_encodes_utf8(ce) || ce == CE_BYTES;
+		// gather on the main thread: the R API is not thread-safe
+		for (i = 0; i < m; i++) {
+			CHECK_INTERRUPT(off + i);
 
-		if (raw) {
-			str = (const uint8_t *)CHAR(sstr);
-			size = (size_t)XLENGTH(sstr);
-		} else {
-			str = (const uint8_t *)rutf8_translate_utf8(sstr);
-			size = strlen((const char *)str);
-		}
+			sstr = STRING_ELT(sx, off + i);
+			if (sstr == NA_STRING) {
+				elts[i].ptr = NULL;
+				continue;
+			}
 
-		if (utf8lite_text_assign(&text, str, size, 0, NULL)) {
-			val = FALSE;
-		} else {
-			val = TRUE;
+			ce = getCharCE(sstr);
+			if (rutf8_encodes_utf8(ce) || ce == CE_BYTES) {
+				elts[i].ptr = (const uint8_t *)CHAR(sstr);
+				elts[i].size = (size_t)XLENGTH(sstr);
+			} else {
+				elts[i].ptr = (const uint8_t *)
+					rutf8_translate_utf8(sstr);
+				elts[i].size = strlen((const char *)elts[i].ptr);
+			}
 		}
-		LOGICAL(ans)[i] = val;
-		UNPROTECT(1);
+
+		job.elts = elts;
+		job.ans = LOGICAL(ans) + off;
+		job.nthread = nthread;
+		rutf8_parallel_for(m, RUTF8_BATCH_GRAIN, nthread, valid_work,
+				   &job);
+		vmaxset(vmax);
 	}
 
 	UNPROTECT(1);
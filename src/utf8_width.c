@@ -17,13 +17,88 @@
 #include <limits.h>
 #include "rutf8.h"
 
+#define WIDTH_UNKNOWN INT_MIN
+
+
+struct width_job {
+	struct rutf8_string *elts;
+	int *width;	// measured width, from the cache or the workers
+	int *ans;
+	int *err;	// first error, for each thread
+	int nthread;
+	int flags;
+	int encode;
+	int utf8;
+	int quotes;
+};
+
+
+static int width_measure(const struct width_job *job, R_xlen_t i,
+			 int *widthptr)
+{
+	int err;
+
+	if (job->width[i] != WIDTH_UNKNOWN) {
+		*widthptr = job->width[i];
+		return 0;
+	}
+
+	if ((err = rutf8_string_measure(&job->elts[i], job->flags,
+					job->nthread, widthptr))) {
+		return err;
+	}
+
+	job->width[i] = *widthptr;
+	return 0;
+}
+
+
+static void width_work(void *data, int tid, R_xlen_t begin, R_xlen_t end)
+{
+	const struct width_job *job = data;
+	struct rutf8_string *elt;
+	R_xlen_t i;
+	int err, w;
+
+	for (i = begin; i < end; i++) {
+		elt = &job->elts[i];
+		rutf8_string_finish(elt, job->nthread);
+
+		if (elt->type == RUTF8_STRING_NONE) {
+			w = NA_INTEGER;
+		} else if (elt->type == RUTF8_STRING_TEXT && !job->encode
+				&& !job->utf8
+				&& !utf8lite_text_isascii(&elt->value.text)) {
+			w = NA_INTEGER;
+		} else if ((err = width_measure(job, i, &w))) {
+			if (!job->err[tid]) {
+				job->err[tid] = err;
+			}
+			w = NA_INTEGER;
+		} else if (w < 0) {
+			w = NA_INTEGER;
+		} else if (w > INT_MAX - job->quotes) {
+			if (!job->err[tid]) {
+				job->err[tid] = UTF8LITE_ERROR_OVERFLOW;
+			}
+			w = NA_INTEGER;
+		} else {
+			w += job->quotes;
+		}
+		job->ans[i] = w;
+	}
+}
+
 
 SEXP rutf8_utf8_width(SEXP sx, SEXP sencode, SEXP squote, SEXP sutf8)
 {
 	SEXP ans, selt;
-	struct rutf8_string elt;
-	R_xlen_t i, n;
-	int flags, encode, quote, quotes, utf8, w;
+	struct width_job job;
+	struct rutf8_dedup dedup;
+	const void *vmax;
+	R_xlen_t *src, i, m, n, off;
+	int *val;
+	int err = 0, flags, encode, quote, utf8, nthread, t;
 
 	if (sx == R_NilValue) {
 		return R_NilValue;
@@ -49,39 +124,86 @@ SEXP rutf8_utf8_width(SEXP sx, SEXP sencode, SEXP squote, SEXP sutf8)
 	if (quote) {
 		flags |= UTF8LITE_ESCAPE_DQUOTE;
 	}
-	quotes = quote ? 2 : 0;
 
 	PROTECT(ans = allocVector(INTSXP, n));
 	setAttrib(ans, R_NamesSymbol, getAttrib(sx, R_NamesSymbol));
 	setAttrib(ans, R_DimSymbol, getAttrib(sx, R_DimSymbol));
 	setAttrib(ans, R_DimNamesSymbol, getAttrib(sx, R_DimNamesSymbol));
 
-	for (i = 0; i < n; i++) {
-		CHECK_INTERRUPT(i);
+	nthread = rutf8_nthread();
+	rutf8_cache_begin();
+	rutf8_dedup_init(&dedup, n);
+	val = INTEGER(ans);
+	m = n < RUTF8_BATCH_SIZE ? n : RUTF8_BATCH_SIZE;
+	src = (void *)R_alloc(m ? m : 1, sizeof(*src));
+	job.elts = (void *)R_alloc(m ? m : 1, sizeof(*job.elts));
+	job.width = (void *)R_alloc(m ? m : 1, sizeof(*job.width));
+	job.err = (void *)R_alloc(nthread, sizeof(*job.err));
+	job.nthread = nthread;
+	job.flags = flags;
+	job.encode = encode;
+	job.utf8 = utf8;
+	job.quotes = quote ? 2 : 0;
 
-		PROTECT(selt = STRING_ELT(sx, i));
-		rutf8_string_init(&elt, selt);
-		
-		if (elt.type == RUTF8_STRING_NONE) {
-			w = NA_INTEGER;
-		} else if (elt.type == RUTF8_STRING_TEXT && !encode && !utf8
-				&& !utf8lite_text_isascii(&elt.value.text)) {
-			w = NA_INTEGER;
-		} else {
-			w = rutf8_string_width(&elt, flags);
-			if (w < 0) {
-				w = NA_INTEGER;
-			} else if (w > INT_MAX - quotes) {
-				Rf_error("width exceeds maximum (%d)",
-					 INT_MAX);
-			} else {
-				w += quotes;
+	for (off = 0; off < n; off += m) {
+		m = n - off < RUTF8_BATCH_SIZE ? n - off : RUTF8_BATCH_SIZE;
+
+		// the table grows with R_alloc, so look up before vmaxget()
+		for (i = 0; i < m; i++) {
+			src[i] = rutf8_dedup_first(&dedup,
+						   STRING_ELT(sx, off + i),
+						   off + i);
+		}
+
+		vmax = vmaxget();
+		for (i = 0; i < m; i++) {
+			CHECK_INTERRUPT(off + i);
+			if (src[i] != off + i) {
+				// repeated value; copy the result later
+				job.elts[i].type = RUTF8_STRING_NONE;
+				continue;
+			}
+			selt = STRING_ELT(sx, off + i);
+			rutf8_string_gather(&job.elts[i], selt);
+
+			job.width[i] = WIDTH_UNKNOWN;
+			if (job.elts[i].key) {
+				rutf8_cache_width(job.elts[i].key, flags,
+						  &job.width[i]);
+			}
+		}
+		for (t = 0; t < nthread; t++) {
+			job.err[t] = 0;
+		}
+
+		job.ans = val + off;
+		rutf8_parallel_for(m, RUTF8_BATCH_GRAIN, nthread, width_work,
+				   &job);
+		vmaxset(vmax);
+
+		for (t = 0; t < nthread; t++) {
+			TRY(job.err[t]);
+		}
+
+		for (i = 0; i < m; i++) {
+			if (src[i] != off + i) {
+				val[off + i] = val[src[i]];
+				continue;
+			}
+
+			rutf8_string_remember(&job.elts[i]);
+			if (job.elts[i].key && job.width[i] != WIDTH_UNKNOWN) {
+				rutf8_cache_set_width(job.elts[i].key, flags,
+						      job.width[i]);
 			}
 		}
-		INTEGER(ans)[i] = w;
-		UNPROTECT(1);
 	}
 
+exit:
+	if (err == UTF8LITE_ERROR_OVERFLOW) {
+		Rf_error("width exceeds maximum (%d)", INT_MAX);
+	}
+	CHECK_ERROR(err);
 	UNPROTECT(1);
 	return ans;
 }
@@ -16,7 +16,7 @@
 
 
 #include <assert.h>
-#include "private/charwidth.h"
+#include "private/charprop.h"
 #include "utf8lite.h"
 
 
@@ -45,41 +45,16 @@ int utf8lite_charwidth(int32_t code)
 }
 
 
-// TODO: use character class lookup table
 int utf8lite_isspace(int32_t code)
 {
 	if (code <= 0x7F) {
 		return (code == 0x20 || (0x09 <= code && code < 0x0E));
-	} else if (code <= 0x1FFF) {
-		switch (code) {
-		case 0x0085:
-		case 0x00A0:
-		case 0x1680:
-			return 1;
-		default:
-			return 0;
-		}
-	} else if (code <= 0x200A) {
-		return 1;
-	} else if (code <= 0x3000) {
-		switch (code) {
-		case 0x2028:
-		case 0x2029:
-		case 0x202F:
-		case 0x205F:
-		case 0x3000:
-			return 1;
-		default:
-			return 0;
-		}
-	} else {
-		return 0;
 	}
+	return CHARPROP_SPACE(charprop(code));
 }
 
 
 int utf8lite_isignorable(int32_t code)
 {
-    int prop = utf8lite_charwidth(code);
-    return (prop == UTF8LITE_CHARWIDTH_IGNORABLE);
+	return (charwidth(code) == CHARWIDTH_IGNORABLE);
 }
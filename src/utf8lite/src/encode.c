@@ -15,6 +15,7 @@
  */
 
 #include <assert.h>
+#include "private/utf8dfa.h"
 #include "utf8lite.h"
 
 /*
@@ -45,134 +46,37 @@ int utf8lite_scan_utf8(const uint8_t **bufptr, const uint8_t *end,
 {
 	const uint8_t *ptr = *bufptr;
 	uint_fast8_t ch, ch1;
-	unsigned nc;
+	unsigned state;
+	int32_t code;
 	int err;
 
 	assert(ptr < end);
 
-	/* First byte
-	 * ----------
-	 *
-	 * 1-byte sequence:
-	 * 00: 0000 0000
-	 * 7F: 0111 1111
-	 * (ch1 & 0x80 == 0)
-	 *
-	 * Invalid:
-	 * 80: 1000 0000
-	 * BF: 1011 1111
-	 * C0: 1100 0000
-	 * C1: 1100 0001
-	 * (ch & 0xF0 == 0x80 || ch == 0xC0 || ch == 0xC1)
-	 *
-	 * 2-byte sequence:
-	 * C2: 1100 0010
-	 * DF: 1101 1111
-	 * (ch & 0xE0 == 0xC0 && ch > 0xC1)
-	 *
-	 * 3-byte sequence
-	 * E0: 1110 0000
-	 * EF: 1110 1111
-	 * (ch & 0xF0 == E0)
-	 *
-	 * 4-byte sequence:
-	 * F0: 1111 0000
-	 * F4: 1111 0100
-	 * (ch & 0xFC == 0xF0 || ch == 0xF4)
-	 */
-
 	ch1 = *ptr++;
+	state = utf8lite_dfa_step(UTF8LITE_DFA_ACCEPT, &code, ch1);
 
-	if ((ch1 & 0x80) == 0) {
+	if (state == UTF8LITE_DFA_ACCEPT) {
 		goto success;
-	} else if ((ch1 & 0xC0) == 0x80) {
-		goto inval_lead;
-	} else if ((ch1 & 0xE0) == 0xC0) {
-		if (ch1 == 0xC0 || ch1 == 0xC1) {
-			goto inval_lead;
-		}
-		nc = 1;
-	} else if ((ch1 & 0xF0) == 0xE0) {
-		nc = 2;
-	} else if ((ch1 & 0xFC) == 0xF0 || ch1 == 0xF4) {
-		nc = 3;
-	} else {
+	} else if (state == UTF8LITE_DFA_REJECT) {
 		// expecting bytes in the following ranges: 00..7F C2..F4
 		goto inval_lead;
 	}
 
 	// ensure string is long enough
-	if (ptr + nc > end) {
+	if (ptr + UTF8LITE_UTF8_TAIL_LEN(ch1) > end) {
 		// expecting another continuation byte
 		goto inval_incomplete;
 	}
 
-	/* First Continuation byte
-	 * -----------
-	 * X  + 80..BF:
-	 * 80: 1000 0000
-	 * BF: 1011 1111
-	 * (ch & 0xC0 == 0x80)
-	 *
-	 * E0 + A0..BF:
-	 * A0: 1010 0000
-	 * BF: 1011 1111
-	 * (ch & 0xE0 == 0xA0)
-	 *
-	 * ED + 80..9F:
-	 * 80: 1000 0000
-	 * 9F: 1001 1111
-	 * (ch & 0xE0 == 0x80)
-	 *
-	 * F0 + 90..BF:
-	 * 90: 1001 0000
-	 * BF: 1011 1111
-	 * (ch & 0xF0 == 0x90 || ch & 0xE0 == A0)
-	 *
-	 */
-
-	// validate the first continuation byte
-	ch = *ptr++;
-	switch (ch1) {
-	case 0xE0:
-		if ((ch & 0xE0) != 0xA0) {
-			// expecting a byte between A0 and BF
-			goto inval_cont;
-		}
-		break;
-	case 0xED:
-		if ((ch & 0xE0) != 0x80) {
-			// expecting a byte between A0 and 9F
-			goto inval_cont;
-		}
-		break;
-	case 0xF0:
-		if ((ch & 0xE0) != 0xA0 && (ch & 0xF0) != 0x90) {
-			// expecting a byte between 90 and BF
-			goto inval_cont;
-		}
-		break;
-	case 0xF4:
-		if ((ch & 0xF0) != 0x80) {
-			// expecting a byte between 80 and 8F
-			goto inval_cont;
-		}
-	default:
-		if ((ch & 0xC0) != 0x80) {
-			// expecting a byte between 80 and BF
-			goto inval_cont;
-		}
-		break;
-	}
-	nc--;
-
-	// validate the trailing continuation bytes
-	while (nc-- > 0) {
+	// validate the continuation bytes; the allowed range for the
+	// first one depends on the leading byte (see Table 3-7)
+	do {
 		ch = *ptr++;
-		if ((ch & 0xC0) != 0x80) {
-			// expecting a byte between 80 and BF
-			goto inval_cont;
-		}
+		state = utf8lite_dfa_step(state, &code, ch);
+	} while (state > UTF8LITE_DFA_REJECT);
+
+	if (state == UTF8LITE_DFA_REJECT) {
+		goto inval_cont;
 	}
 
 success:
@@ -208,28 +112,13 @@ out:
 void utf8lite_decode_utf8(const uint8_t **bufptr, int32_t *codeptr)
 {
 	const uint8_t *ptr = *bufptr;
+	unsigned state;
 	int32_t code;
-	uint_fast8_t ch;
-	unsigned nc;
-
-	ch = *ptr++;
-	if (!(ch & 0x80)) {
-		code = ch;
-		nc = 0;
-	} else if (!(ch & 0x20)) {
-		code = ch & 0x1F;
-		nc = 1;
-	} else if (!(ch & 0x10)) {
-		code = ch & 0x0F;
-		nc = 2;
-	} else {
-		code = ch & 0x07;
-		nc = 3;
-	}
 
-	while (nc-- > 0) {
-		ch = *ptr++;
-		code = (code << 6) + (ch & 0x3F);
+	// the input is valid, so the machine never rejects
+	state = utf8lite_dfa_step(UTF8LITE_DFA_ACCEPT, &code, *ptr++);
+	while (state > UTF8LITE_DFA_REJECT) {
+		state = utf8lite_dfa_step(state, &code, *ptr++);
 	}
 
 	*bufptr = ptr;
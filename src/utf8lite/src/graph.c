@@ -15,6 +15,10 @@
  */
 
 #include <limits.h>
+#include <stdlib.h>
+#include "private/charprop.h"
+#include "private/inline.h"
+#include "private/simd.h"
 #include "utf8lite.h"
 
 /*
@@ -41,9 +45,53 @@ graph               Ambiguous  Emoji Ignorable Narrow   Mark   None   Wide
 */
 
 
-static int ascii_width(int32_t ch, int flags);
-static int utf8_escape_width(int32_t ch, int flags);
-static int utf8_width(int32_t ch, int cw, int flags);
+/*
+ * Grapheme scanner states for utf8lite_text_width(), one for each label
+ * in utf8lite_graphscan_advance() that reads another character.
+ */
+enum graph_state {
+	GRAPH_END = -1,	// the grapheme ends before the next character
+	GRAPH_CR,
+	GRAPH_CONTROL,
+	GRAPH_L,
+	GRAPH_V,
+	GRAPH_T,
+	GRAPH_PREPEND,
+	GRAPH_PICTO,
+	GRAPH_PICTO_ZWJ,
+	GRAPH_RI,
+	GRAPH_EXTEND
+};
+
+/*
+ * Extra width, beyond 1, of the ASCII characters that may get escaped.
+ * Escaped control characters take 1 extra (\b, \f, \n, \r, \t) or
+ * 5 extra (\uXXXX), except for \a and \v, which depend on the flags.
+ */
+struct ascii_cost {
+	uint8_t bell;	// \a and \v
+	uint8_t dquote;	// "
+	uint8_t squote;	// '
+	uint8_t bslash;	// \ (backslash)
+};
+
+static uint64_t ascii_cost(const uint8_t *ptr, size_t n,
+			   const struct ascii_cost *cost, int *controlptr);
+
+static int ascii_text_width(const uint8_t *ptr, size_t n, int flags,
+			    int limit, int *widthptr);
+static UTF8LITE_ALWAYS_INLINE int text_width(
+		const struct utf8lite_text *text, int flags, int limit,
+		int *widthptr);
+static UTF8LITE_ALWAYS_INLINE int ascii_width(int32_t ch, int flags);
+static UTF8LITE_ALWAYS_INLINE int utf8_escape_width(int32_t ch, int flags);
+static UTF8LITE_ALWAYS_INLINE int utf8_width(int32_t ch, int cw, int flags);
+static int index_scan(const struct utf8lite_widthindex *index,
+		      size_t begin, int width, int limit, int suffix,
+		      size_t *endptr, int *widthptr);
+static int graph_start(int prop);
+static int graph_next(int state, int prop);
+static int graph_extend(int prop);
 
 
 int utf8lite_graph_measure(const struct utf8lite_graph *g,
@@ -67,8 +115,9 @@ int utf8lite_graph_measure(const struct utf8lite_graph *g,
 				&& (ch > 0xFFFF)) {
 			w = utf8_escape_width(ch, flags);
 		} else {
-			cw = utf8lite_charwidth(ch);
-			if (cw == UTF8LITE_CHARWIDTH_EMOJI) {
+			// the property values match utf8lite_charwidth_type
+			cw = charwidth(ch);
+			if (cw == CHARWIDTH_EMOJI) {
 				width = 2;
 				goto exit;
 			}
@@ -95,6 +144,787 @@ exit:
 }
 
 
+/*
+ * The flags that change character widths. With UTF8LITE_ESCAPE_UTF8,
+ * UTF8LITE_ESCAPE_EXTENDED has no effect.
+ */
+#define WIDTH_FLAGS \
+	(UTF8LITE_ESCAPE_CONTROL | UTF8LITE_ESCAPE_DQUOTE \
+	 | UTF8LITE_ESCAPE_SQUOTE | UTF8LITE_ESCAPE_EXTENDED \
+	 | UTF8LITE_ESCAPE_UTF8 | UTF8LITE_ENCODE_JSON \
+	 | UTF8LITE_ENCODE_AMBIGWIDE)
+
+/*
+ * Copies of the width loop for the flag combinations that utf8_width(),
+ * utf8_format(), utf8_encode(), and utf8_print() use, with the flag
+ * tests folded into constants. Other combinations test the flags for
+ * each character.
+ */
+#define TEXT_WIDTH_KERNEL(name, kflags) \
+	static int name(const struct utf8lite_text *text, int limit, \
+			int *widthptr) \
+	{ \
+		return text_width(text, kflags, limit, widthptr); \
+	}
+
+TEXT_WIDTH_KERNEL(text_width_none, 0)
+TEXT_WIDTH_KERNEL(text_width_q, UTF8LITE_ESCAPE_DQUOTE)
+TEXT_WIDTH_KERNEL(text_width_c, UTF8LITE_ESCAPE_CONTROL)
+TEXT_WIDTH_KERNEL(text_width_cq,
+		  UTF8LITE_ESCAPE_CONTROL | UTF8LITE_ESCAPE_DQUOTE)
+TEXT_WIDTH_KERNEL(text_width_cu,
+		  UTF8LITE_ESCAPE_CONTROL | UTF8LITE_ESCAPE_UTF8)
+TEXT_WIDTH_KERNEL(text_width_cqu,
+		  UTF8LITE_ESCAPE_CONTROL | UTF8LITE_ESCAPE_DQUOTE
+		  | UTF8LITE_ESCAPE_UTF8)
+TEXT_WIDTH_KERNEL(text_width_cx,
+		  UTF8LITE_ESCAPE_CONTROL | UTF8LITE_ESCAPE_EXTENDED)
+TEXT_WIDTH_KERNEL(text_width_cqx,
+		  UTF8LITE_ESCAPE_CONTROL | UTF8LITE_ESCAPE_DQUOTE
+		  | UTF8LITE_ESCAPE_EXTENDED)
+
+
+int utf8lite_text_width(const struct utf8lite_text *text, int flags,
+			int limit, int *widthptr)
+{
+	int err, width;
+
+	flags &= WIDTH_FLAGS;
+	if (flags & UTF8LITE_ESCAPE_UTF8) {
+		flags &= ~UTF8LITE_ESCAPE_EXTENDED;
+	}
+
+	// the only ASCII grapheme with more than one character is CR LF,
+	// so the width of unescaped ASCII text comes from counting bytes
+	if (utf8lite_text_isascii(text) && !UTF8LITE_TEXT_HAS_ESC(text)) {
+		err = ascii_text_width(text->ptr, UTF8LITE_TEXT_SIZE(text),
+				       flags, limit, &width);
+		if (widthptr) {
+			*widthptr = width;
+		}
+		return err;
+	}
+
+	switch (flags) {
+	case 0:
+		return text_width_none(text, limit, widthptr);
+	case UTF8LITE_ESCAPE_DQUOTE:
+		return text_width_q(text, limit, widthptr);
+	case UTF8LITE_ESCAPE_CONTROL:
+		return text_width_c(text, limit, widthptr);
+	case UTF8LITE_ESCAPE_CONTROL | UTF8LITE_ESCAPE_DQUOTE:
+		return text_width_cq(text, limit, widthptr);
+	case UTF8LITE_ESCAPE_CONTROL | UTF8LITE_ESCAPE_UTF8:
+		return text_width_cu(text, limit, widthptr);
+	case UTF8LITE_ESCAPE_CONTROL | UTF8LITE_ESCAPE_DQUOTE
+			| UTF8LITE_ESCAPE_UTF8:
+		return text_width_cqu(text, limit, widthptr);
+	case UTF8LITE_ESCAPE_CONTROL | UTF8LITE_ESCAPE_EXTENDED:
+		return text_width_cx(text, limit, widthptr);
+	case UTF8LITE_ESCAPE_CONTROL | UTF8LITE_ESCAPE_DQUOTE
+			| UTF8LITE_ESCAPE_EXTENDED:
+		return text_width_cqx(text, limit, widthptr);
+	default:
+		return text_width(text, flags, limit, widthptr);
+	}
+}
+
+
+int text_width(const struct utf8lite_text *text, int flags, int limit,
+	       int *widthptr)
+{
+	struct utf8lite_text_iter it;
+	int32_t ch;
+	int err = 0, prop, cw, gw, w, width, state, done;
+
+	width = 0;
+	gw = 0;
+	done = 0;
+	state = GRAPH_END;
+	utf8lite_text_iter_make(&it, text);
+
+	while (utf8lite_text_iter_advance(&it)) {
+		ch = it.current;
+		prop = charprop(ch);
+
+		if (state != GRAPH_END) {
+			state = graph_next(state, CHARPROP_GRAPH_BREAK(prop));
+		}
+
+		if (state == GRAPH_END) {
+			// the previous grapheme ends here; add its width
+			if (gw < 0) {
+				width = -1;
+				goto exit;
+			} else if (width > limit - gw) {
+				err = UTF8LITE_ERROR_RANGE;
+				goto exit;
+			}
+			width += gw;
+
+			state = graph_start(CHARPROP_GRAPH_BREAK(prop));
+			gw = 0;
+			done = 0;
+		}
+
+		// measure the character the same way utf8lite_graph_measure()
+		// does; emoji and non-displayable characters fix the width
+		// of the rest of the grapheme
+		if (done) {
+			continue;
+		}
+
+		if (ch <= 0x7F) {
+			w = ascii_width(ch, flags);
+		} else if (flags & UTF8LITE_ESCAPE_UTF8) {
+			w = utf8_escape_width(ch, flags);
+		} else if ((flags & UTF8LITE_ESCAPE_EXTENDED)
+				&& (ch > 0xFFFF)) {
+			w = utf8_escape_width(ch, flags);
+		} else {
+			cw = CHARPROP_CHARWIDTH(prop);
+			if (cw == CHARWIDTH_EMOJI) {
+				gw = 2;
+				done = 1;
+				continue;
+			}
+			w = utf8_width(ch, cw, flags);
+		}
+
+		if (w < 0) {
+			gw = w;
+			done = 1;
+		} else if (w > INT_MAX - gw) {
+			width = -1;
+			err = UTF8LITE_ERROR_OVERFLOW;
+			goto exit;
+		} else {
+			gw += w;
+		}
+	}
+
+	// add the width of the last grapheme
+	if (state != GRAPH_END) {
+		if (gw < 0) {
+			width = -1;
+		} else if (width > limit - gw) {
+			err = UTF8LITE_ERROR_RANGE;
+		} else {
+			width += gw;
+		}
+	}
+
+exit:
+	if (widthptr) {
+		*widthptr = width;
+	}
+	return err;
+}
+
+
+int utf8lite_widthindex_init(struct utf8lite_widthindex *index,
+			     const struct utf8lite_text *text, int flags,
+			     int step)
+{
+	struct utf8lite_graphscan scan;
+	size_t ngraph, nsample, i, pos;
+	int err = 0, w, width;
+
+	index->offset = NULL;
+	index->cumwidth = NULL;
+
+	if (step <= 0) {
+		err = UTF8LITE_ERROR_INVAL;
+		goto error;
+	}
+
+	ngraph = 0;
+	utf8lite_graphscan_make(&scan, text);
+	while (utf8lite_graphscan_advance(&scan)) {
+		ngraph++;
+	}
+
+	// one sample every `step` graphemes, plus one for the end
+	nsample = (ngraph + (size_t)step - 1) / (size_t)step + 1;
+	if (nsample > INT_MAX) {
+		err = UTF8LITE_ERROR_OVERFLOW;
+		goto error;
+	}
+	if (!(index->offset = malloc(nsample * sizeof(*index->offset)))
+			|| !(index->cumwidth = malloc(nsample
+						* sizeof(*index->cumwidth)))) {
+		err = UTF8LITE_ERROR_NOMEM;
+		goto error;
+	}
+
+	index->text = *text;
+	index->flags = flags;
+	index->step = step;
+	index->nbad = 0;
+	index->bad_begin = 0;
+	index->bad_end = 0;
+
+	width = 0;
+	ngraph = 0;
+	i = 0;
+	utf8lite_graphscan_reset(&scan);
+
+	while (utf8lite_graphscan_advance(&scan)) {
+		pos = (size_t)(scan.current.text.ptr - text->ptr);
+		if (ngraph % (size_t)step == 0) {
+			index->offset[i] = pos;
+			index->cumwidth[i] = width;
+			i++;
+		}
+		ngraph++;
+
+		if ((err = utf8lite_graph_measure(&scan.current, flags, &w))) {
+			goto error;
+		}
+
+		if (w < 0) {
+			if (!index->nbad) {
+				index->bad_begin = pos;
+			}
+			if (index->nbad < INT_MAX) {
+				index->nbad++;
+			}
+			index->bad_end = (pos + UTF8LITE_TEXT_SIZE(
+						&scan.current.text));
+		} else if (width > INT_MAX - w) {
+			err = UTF8LITE_ERROR_OVERFLOW;
+			goto error;
+		} else {
+			width += w;
+		}
+	}
+
+	index->offset[i] = UTF8LITE_TEXT_SIZE(text);
+	index->cumwidth[i] = width;
+	index->nsample = (int)(i + 1);
+	index->width = width;
+	return 0;
+
+error:
+	free(index->cumwidth);
+	free(index->offset);
+	index->offset = NULL;
+	index->cumwidth = NULL;
+	return err;
+}
+
+
+void utf8lite_widthindex_destroy(struct utf8lite_widthindex *index)
+{
+	free(index->cumwidth);
+	free(index->offset);
+}
+
+
+int utf8lite_widthindex_prefix(const struct utf8lite_widthindex *index,
+			       int limit, size_t *sizeptr, int *widthptr)
+{
+	size_t end;
+	int err, lo, hi, mid, width;
+
+	// find the last sample that fits, or the first if none do
+	lo = 0;
+	hi = index->nsample - 1;
+	while (lo < hi) {
+		mid = lo + (hi - lo + 1) / 2;
+		if (index->cumwidth[mid] <= limit) {
+			lo = mid;
+		} else {
+			hi = mid - 1;
+		}
+	}
+
+	// the first grapheme that does not fit comes before the next sample
+	err = index_scan(index, index->offset[lo], index->cumwidth[lo],
+			 limit, 0, &end, &width);
+
+	// a grapheme with width -1 that comes first wins, even if it is
+	// the one that does not fit
+	if (index->nbad && index->bad_begin <= end) {
+		err = 0;
+		end = index->bad_begin;
+		width = -1;
+	}
+
+	*sizeptr = end;
+	*widthptr = width;
+	return err;
+}
+
+
+int utf8lite_widthindex_suffix(const struct utf8lite_widthindex *index,
+			       int limit, size_t *beginptr, int *widthptr)
+{
+	size_t begin, size = UTF8LITE_TEXT_SIZE(&index->text);
+	int err, lo, hi, mid, width;
+
+	if (limit < 0) {
+		// not even the last grapheme fits
+		begin = size;
+		width = 0;
+		err = size ? UTF8LITE_ERROR_RANGE : 0;
+	} else {
+		// find the first sample where the rest of the text fits
+		lo = 0;
+		hi = index->nsample - 1;
+		while (lo < hi) {
+			mid = lo + (hi - lo) / 2;
+			if (index->width - index->cumwidth[mid] <= limit) {
+				hi = mid;
+			} else {
+				lo = mid + 1;
+			}
+		}
+
+		if (lo == 0) {
+			begin = 0;
+			width = index->width;
+			err = 0;
+		} else {
+			// the last grapheme that does not fit comes after
+			// the previous sample
+			err = index_scan(index, index->offset[lo - 1],
+					 index->cumwidth[lo - 1], limit, 1,
+					 &begin, &width);
+		}
+	}
+
+	if (index->nbad && index->bad_end >= begin) {
+		err = 0;
+		begin = index->bad_end;
+		width = -1;
+	}
+
+	*beginptr = begin;
+	*widthptr = width;
+	return err;
+}
+
+
+/*
+ * Scan an indexed text from a sample at `begin`, where the width before
+ * is `width`. For a prefix, stop at the first grapheme that does not
+ * fit within the limit; for a suffix, stop once the rest of the text
+ * fits. Graphemes with width -1 count as zero.
+ */
+int index_scan(const struct utf8lite_widthindex *index, size_t begin,
+	       int width, int limit, int suffix, size_t *endptr,
+	       int *widthptr)
+{
+	struct utf8lite_graphscan scan;
+	struct utf8lite_text tail;
+	size_t size = UTF8LITE_TEXT_SIZE(&index->text);
+	size_t end = begin;
+	int err = 0, w;
+
+	// graphemes do not depend on the text before a boundary
+	tail.ptr = index->text.ptr + begin;
+	tail.attr = (size - begin) | UTF8LITE_TEXT_BITS(&index->text);
+
+	utf8lite_graphscan_make(&scan, &tail);
+	while (!suffix || index->width - width > limit) {
+		if (!utf8lite_graphscan_advance(&scan)) {
+			break;
+		}
+
+		// the index build measured this grapheme without error
+		utf8lite_graph_measure(&scan.current, index->flags, &w);
+		if (w < 0) {
+			w = 0;
+		}
+
+		if (!suffix && width > limit - w) {
+			err = UTF8LITE_ERROR_RANGE;
+			break;
+		}
+		width += w;
+		end += UTF8LITE_TEXT_SIZE(&scan.current.text);
+	}
+
+	if (suffix) {
+		width = index->width - width;
+		err = UTF8LITE_ERROR_RANGE;
+	}
+
+	*endptr = end;
+	*widthptr = width;
+	return err;
+}
+
+
+/*
+ * Get the scanner state after the first character of a grapheme.
+ */
+int graph_start(int prop)
+{
+	switch ((enum graph_break_prop)prop) {
+	case GRAPH_BREAK_CR:
+		return GRAPH_CR;
+
+	case GRAPH_BREAK_CONTROL:
+	case GRAPH_BREAK_LF:
+		return GRAPH_CONTROL;
+
+	case GRAPH_BREAK_L:
+		return GRAPH_L;
+
+	case GRAPH_BREAK_LV:
+	case GRAPH_BREAK_V:
+		return GRAPH_V;
+
+	case GRAPH_BREAK_LVT:
+	case GRAPH_BREAK_T:
+		return GRAPH_T;
+
+	case GRAPH_BREAK_PREPEND:
+		return GRAPH_PREPEND;
+
+	case GRAPH_BREAK_EXTENDED_PICTOGRAPHIC:
+		return GRAPH_PICTO;
+
+	case GRAPH_BREAK_REGIONAL_INDICATOR:
+		return GRAPH_RI;
+
+	default:
+		return GRAPH_EXTEND;
+	}
+}
+
+
+/*
+ * Get the scanner state after the next character, or GRAPH_END if the
+ * character starts a new grapheme. See utf8lite_graphscan_advance() for
+ * the rules.
+ */
+int graph_next(int state, int prop)
+{
+	switch ((enum graph_state)state) {
+	case GRAPH_CR:
+		return (prop == GRAPH_BREAK_LF) ? GRAPH_CONTROL : GRAPH_END;
+
+	case GRAPH_CONTROL:
+		return GRAPH_END;
+
+	case GRAPH_L:
+		switch (prop) {
+		case GRAPH_BREAK_L:
+			return GRAPH_L;
+		case GRAPH_BREAK_V:
+		case GRAPH_BREAK_LV:
+			return GRAPH_V;
+		case GRAPH_BREAK_LVT:
+			return GRAPH_T;
+		default:
+			return graph_extend(prop);
+		}
+
+	case GRAPH_V:
+		switch (prop) {
+		case GRAPH_BREAK_V:
+			return GRAPH_V;
+		case GRAPH_BREAK_T:
+			return GRAPH_T;
+		default:
+			return graph_extend(prop);
+		}
+
+	case GRAPH_T:
+		return ((prop == GRAPH_BREAK_T) ? GRAPH_T
+			: graph_extend(prop));
+
+	case GRAPH_PREPEND:
+		switch (prop) {
+		case GRAPH_BREAK_CONTROL:
+		case GRAPH_BREAK_CR:
+		case GRAPH_BREAK_LF:
+			return GRAPH_END;
+		default:
+			return graph_start(prop);
+		}
+
+	case GRAPH_PICTO:
+		switch (prop) {
+		case GRAPH_BREAK_EXTEND:
+			return GRAPH_PICTO;
+		case GRAPH_BREAK_ZWJ:
+			return GRAPH_PICTO_ZWJ;
+		default:
+			return graph_extend(prop);
+		}
+
+	case GRAPH_PICTO_ZWJ:
+		return ((prop == GRAPH_BREAK_EXTENDED_PICTOGRAPHIC)
+			? GRAPH_PICTO : graph_extend(prop));
+
+	case GRAPH_RI:
+		return ((prop == GRAPH_BREAK_REGIONAL_INDICATOR)
+			? GRAPH_EXTEND : graph_extend(prop));
+
+	default:
+		return graph_extend(prop);
+	}
+}
+
+
+/*
+ * GB9, GB9a: do not break before extending characters, ZWJ, or
+ * SpacingMark; GB999: otherwise, break everywhere.
+ */
+int graph_extend(int prop)
+{
+	switch (prop) {
+	case GRAPH_BREAK_EXTEND:
+	case GRAPH_BREAK_SPACINGMARK:
+	case GRAPH_BREAK_ZWJ:
+		return GRAPH_EXTEND;
+	default:
+		return GRAPH_END;
+	}
+}
+
+
+int ascii_text_width(const uint8_t *ptr, size_t n, int flags, int limit,
+		     int *widthptr)
+{
+	struct ascii_cost cost;
+	uint64_t total;
+	size_t i;
+	int err = 0, control = 0, width, w;
+
+	cost.bell = (flags & UTF8LITE_ENCODE_JSON) ? 5 : 1;
+	cost.dquote = (flags & UTF8LITE_ESCAPE_DQUOTE) ? 1 : 0;
+	cost.squote = (flags & UTF8LITE_ESCAPE_SQUOTE) ? 1 : 0;
+	cost.bslash = (flags & (UTF8LITE_ESCAPE_CONTROL
+				| UTF8LITE_ESCAPE_DQUOTE
+				| UTF8LITE_ESCAPE_SQUOTE
+				| UTF8LITE_ESCAPE_EXTENDED
+				| UTF8LITE_ESCAPE_UTF8)) ? 1 : 0;
+
+	total = (uint64_t)n + ascii_cost(ptr, n, &cost, &control);
+	if ((!control || (flags & UTF8LITE_ESCAPE_CONTROL))
+			&& limit >= 0 && total <= (uint64_t)limit) {
+		*widthptr = (int)total;
+		return 0;
+	}
+
+	// The text does not fit, or it has a control character that does
+	// not get escaped; find out which comes first.
+	width = 0;
+	for (i = 0; i < n; i++) {
+		w = ascii_width(ptr[i], flags);
+		if (ptr[i] == '\r' && i + 1 < n && ptr[i + 1] == '\n') {
+			i++;
+			if (w >= 0) {
+				w += ascii_width('\n', flags);
+			}
+		}
+
+		if (w < 0) {
+			width = -1;
+			goto exit;
+		} else if (width > limit - w) {
+			err = UTF8LITE_ERROR_RANGE;
+			goto exit;
+		}
+		width += w;
+	}
+
+exit:
+	*widthptr = width;
+	return err;
+}
+
+
+/*
+ * ASCII width kernels. Sum the extra width of the escaped characters,
+ * assuming that control characters get escaped, and set `*controlptr`
+ * if there are any control characters.
+ */
+
+static uint64_t ascii_cost_scalar(const uint8_t *ptr, size_t n,
+				  const struct ascii_cost *cost,
+				  int *controlptr)
+{
+	uint64_t extra = 0;
+	int control = 0;
+	uint8_t ch;
+
+	while (n-- > 0) {
+		ch = *ptr++;
+		if (ch < 0x20 || ch == 0x7F) {
+			control = 1;
+			switch (ch) {
+			case '\a':
+			case '\v':
+				extra += cost->bell;
+				break;
+			case '\b':
+			case '\f':
+			case '\n':
+			case '\r':
+			case '\t':
+				extra += 1;
+				break;
+			default:
+				extra += 5;
+				break;
+			}
+		} else if (ch == '\"') {
+			extra += cost->dquote;
+		} else if (ch == '\'') {
+			extra += cost->squote;
+		} else if (ch == '\\') {
+			extra += cost->bslash;
+		}
+	}
+
+	if (control) {
+		*controlptr = 1;
+	}
+	return extra;
+}
+
+
+#ifdef UTF8LITE_HAVE_SSE2
+
+static uint64_t ascii_cost_sse2(const uint8_t *ptr, size_t n,
+				const struct ascii_cost *cost,
+				int *controlptr)
+{
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i space = _mm_set1_epi8(0x20);
+	const __m128i del = _mm_set1_epi8(0x7F);
+	const __m128i before_b = _mm_set1_epi8('\b' - 1);
+	const __m128i after_r = _mm_set1_epi8('\r' + 1);
+	const __m128i bell = _mm_set1_epi8('\a');
+	const __m128i vtab = _mm_set1_epi8('\v');
+	const __m128i dquote = _mm_set1_epi8('\"');
+	const __m128i squote = _mm_set1_epi8('\'');
+	const __m128i bslash = _mm_set1_epi8('\\');
+	const __m128i five = _mm_set1_epi8(5);
+	const __m128i four = _mm_set1_epi8(4);
+	const __m128i bell_cost = _mm_set1_epi8((char)(5 - cost->bell));
+	const __m128i dquote_cost = _mm_set1_epi8((char)cost->dquote);
+	const __m128i squote_cost = _mm_set1_epi8((char)cost->squote);
+	const __m128i bslash_cost = _mm_set1_epi8((char)cost->bslash);
+	__m128i block, ctrl, bel, esc, extra, sum = zero, any = zero;
+	uint64_t lane[2];
+
+	// ASCII bytes are non-negative, so the signed compares work. A
+	// control starts at 5 extra; the short escapes (\b through \r,
+	// other than \v) take away 4, and \a and \v take away 5 - bell.
+	while (n >= 16) {
+		block = _mm_loadu_si128((const __m128i *)ptr);
+		ctrl = _mm_or_si128(_mm_cmplt_epi8(block, space),
+				    _mm_cmpeq_epi8(block, del));
+		bel = _mm_or_si128(_mm_cmpeq_epi8(block, bell),
+				   _mm_cmpeq_epi8(block, vtab));
+		esc = _mm_andnot_si128(bel,
+				_mm_and_si128(_mm_cmpgt_epi8(block, before_b),
+					      _mm_cmplt_epi8(block, after_r)));
+
+		extra = _mm_sub_epi8(_mm_and_si128(ctrl, five),
+				     _mm_and_si128(esc, four));
+		extra = _mm_sub_epi8(extra, _mm_and_si128(bel, bell_cost));
+		extra = _mm_add_epi8(extra, _mm_and_si128(
+				_mm_cmpeq_epi8(block, dquote), dquote_cost));
+		extra = _mm_add_epi8(extra, _mm_and_si128(
+				_mm_cmpeq_epi8(block, squote), squote_cost));
+		extra = _mm_add_epi8(extra, _mm_and_si128(
+				_mm_cmpeq_epi8(block, bslash), bslash_cost));
+
+		sum = _mm_add_epi64(sum, _mm_sad_epu8(extra, zero));
+		any = _mm_or_si128(any, ctrl);
+		ptr += 16;
+		n -= 16;
+	}
+
+	if (_mm_movemask_epi8(any)) {
+		*controlptr = 1;
+	}
+	_mm_storeu_si128((__m128i *)lane, sum);
+	return lane[0] + lane[1] + ascii_cost_scalar(ptr, n, cost, controlptr);
+}
+
+#endif /* UTF8LITE_HAVE_SSE2 */
+
+
+#ifdef UTF8LITE_HAVE_AVX2
+
+UTF8LITE_TARGET_AVX2
+static uint64_t ascii_cost_avx2(const uint8_t *ptr, size_t n,
+				const struct ascii_cost *cost,
+				int *controlptr)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i space = _mm256_set1_epi8(0x20);
+	const __m256i del = _mm256_set1_epi8(0x7F);
+	const __m256i before_b = _mm256_set1_epi8('\b' - 1);
+	const __m256i after_r = _mm256_set1_epi8('\r' + 1);
+	const __m256i bell = _mm256_set1_epi8('\a');
+	const __m256i vtab = _mm256_set1_epi8('\v');
+	const __m256i dquote = _mm256_set1_epi8('\"');
+	const __m256i squote = _mm256_set1_epi8('\'');
+	const __m256i bslash = _mm256_set1_epi8('\\');
+	const __m256i five = _mm256_set1_epi8(5);
+	const __m256i four = _mm256_set1_epi8(4);
+	const __m256i bell_cost = _mm256_set1_epi8((char)(5 - cost->bell));
+	const __m256i dquote_cost = _mm256_set1_epi8((char)cost->dquote);
+	const __m256i squote_cost = _mm256_set1_epi8((char)cost->squote);
+	const __m256i bslash_cost = _mm256_set1_epi8((char)cost->bslash);
+	__m256i block, ctrl, bel, esc, extra, sum = zero, any = zero;
+	uint64_t lane[4];
+
+	while (n >= 32) {
+		block = _mm256_loadu_si256((const __m256i *)ptr);
+		ctrl = _mm256_or_si256(_mm256_cmpgt_epi8(space, block),
+				       _mm256_cmpeq_epi8(block, del));
+		bel = _mm256_or_si256(_mm256_cmpeq_epi8(block, bell),
+				      _mm256_cmpeq_epi8(block, vtab));
+		esc = _mm256_andnot_si256(bel, _mm256_and_si256(
+				_mm256_cmpgt_epi8(block, before_b),
+				_mm256_cmpgt_epi8(after_r, block)));
+
+		extra = _mm256_sub_epi8(_mm256_and_si256(ctrl, five),
+					_mm256_and_si256(esc, four));
+		extra = _mm256_sub_epi8(extra,
+					_mm256_and_si256(bel, bell_cost));
+		extra = _mm256_add_epi8(extra, _mm256_and_si256(
+				_mm256_cmpeq_epi8(block, dquote), dquote_cost));
+		extra = _mm256_add_epi8(extra, _mm256_and_si256(
+				_mm256_cmpeq_epi8(block, squote), squote_cost));
+		extra = _mm256_add_epi8(extra, _mm256_and_si256(
+				_mm256_cmpeq_epi8(block, bslash), bslash_cost));
+
+		sum = _mm256_add_epi64(sum, _mm256_sad_epu8(extra, zero));
+		any = _mm256_or_si256(any, ctrl);
+		ptr += 32;
+		n -= 32;
+	}
+
+	if (_mm256_movemask_epi8(any)) {
+		*controlptr = 1;
+	}
+	_mm256_storeu_si256((__m256i *)lane, sum);
+	return (lane[0] + lane[1] + lane[2] + lane[3]
+		+ ascii_cost_sse2(ptr, n, cost, controlptr));
+}
+
+#endif /* UTF8LITE_HAVE_AVX2 */
+
+
+uint64_t ascii_cost(const uint8_t *ptr, size_t n,
+		    const struct ascii_cost *cost, int *controlptr)
+{
+	return UTF8LITE_SIMD_KERNEL(ascii_cost)(ptr, n, cost, controlptr);
+}
+
+
 int ascii_width(int32_t ch, int flags)
 {
 	// handle control characters
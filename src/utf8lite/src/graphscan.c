@@ -16,7 +16,7 @@
 
 #include <assert.h>
 #include <stdio.h>
-#include "private/graphbreak.h"
+#include "private/charprop.h"
 #include "utf8lite.h"
 
 
@@ -31,6 +31,85 @@
 	} while (0)
 
 
+/*
+ * Test whether there is a break between characters with properties
+ * `prev` and `next`, no matter what comes before `prev`. The rules that
+ * look further back (GB11, GB12, GB13) all require `prev` to be ZWJ,
+ * Extend, or Regional_Indicator, so excluding those is enough.
+ */
+static int graph_break_certain(int prev, int next)
+{
+	switch (next) {
+	case GRAPH_BREAK_EXTEND:
+	case GRAPH_BREAK_SPACINGMARK:
+	case GRAPH_BREAK_ZWJ:
+		// GB9, GB9a: do not break before extending characters,
+		// unless after a control (GB4)
+		return (prev == GRAPH_BREAK_CR
+			|| prev == GRAPH_BREAK_CONTROL
+			|| prev == GRAPH_BREAK_LF);
+	case GRAPH_BREAK_LF:
+		// GB3: Do not break within CRLF
+		return prev != GRAPH_BREAK_CR;
+	default:
+		break;
+	}
+
+	switch (prev) {
+	case GRAPH_BREAK_CR:
+	case GRAPH_BREAK_CONTROL:
+	case GRAPH_BREAK_LF:
+		// GB4: Break after controls
+		return 1;
+	case GRAPH_BREAK_OTHER:
+		// GB999: Otherwise, break everywhere
+		return 1;
+	default:
+		// GB5: Break before controls
+		return (next == GRAPH_BREAK_CR
+			|| next == GRAPH_BREAK_CONTROL);
+	}
+}
+
+
+const uint8_t *utf8lite_graph_boundary(const struct utf8lite_text *text,
+				       const uint8_t *ptr)
+{
+	const uint8_t *end = text->ptr + UTF8LITE_TEXT_SIZE(text);
+	const uint8_t *next;
+	int32_t code;
+	int prev, prop;
+
+	if (UTF8LITE_TEXT_HAS_ESC(text)) {
+		return end;
+	}
+
+	// move to the start of a character
+	while (ptr != end && (*ptr & 0xC0) == 0x80) {
+		ptr++;
+	}
+	if (ptr == end) {
+		return end;
+	}
+
+	next = ptr;
+	utf8lite_decode_utf8(&next, &code);
+	prev = graph_break(code);
+
+	while (next != end) {
+		ptr = next;
+		utf8lite_decode_utf8(&next, &code);
+		prop = graph_break(code);
+		if (graph_break_certain(prev, prop)) {
+			return ptr;
+		}
+		prev = prop;
+	}
+
+	return end;
+}
+
+
 void utf8lite_graphscan_make(struct utf8lite_graphscan *scan,
 			     const struct utf8lite_text *text)
 {
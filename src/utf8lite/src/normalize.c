@@ -14,11 +14,12 @@
  * limitations under the License.
  */
 
-#include <stdlib.h>
 #include "private/casefold.h"
+#include "private/charprop.h"
 #include "private/compose.h"
-#include "private/combining.h"
 #include "private/decompose.h"
+#include "private/normalization.h"
+#include "private/normmap.h"
 #include "utf8lite.h"
 
 /* From Unicode-8.0 Section 3.12 Conjoining Jamo Behavior */
@@ -30,7 +31,7 @@
 #define HANGUL_VCOUNT 21
 #define HANGUL_TCOUNT 28
 #define HANGUL_NCOUNT (HANGUL_VCOUNT * HANGUL_TCOUNT)
-#define HANTUL_SCOUNT (HANGUL_LCOUNT * HANGUL_NCOUNT)
+#define HANGUL_SCOUNT (HANGUL_LCOUNT * HANGUL_NCOUNT)
 
 
 static void hangul_decompose(int32_t code, int32_t **bufp)
@@ -86,6 +87,9 @@ static int32_t hangul_compose_lvt(int32_t lvpart, int32_t tpart)
 }
 
 
+static void decompose_map(int type, int32_t code, int32_t **bufptr);
+
+
 static void casefold(int type, int32_t code, int32_t **bufp)
 {
 	const int32_t block_size = CASEFOLD_BLOCK_SIZE;
@@ -100,19 +104,75 @@ static void casefold(int type, int32_t code, int32_t **bufp)
 		*dst++ = code;
 		*bufp = dst;
 	} else if (length == 1) {
-		utf8lite_map(type, (int32_t)c.data, bufp);
+		decompose_map(type, (int32_t)c.data, bufp);
 	} else {
 		src = &casefold_mapping[c.data];
 		while (length-- > 0) {
-			utf8lite_map(type, *src, bufp);
+			decompose_map(type, *src, bufp);
 			src++;
 		}
 	}
 }
 
 
-
 void utf8lite_map(int type, int32_t code, int32_t **bufptr)
+{
+	const int32_t block_size = NORMMAP_BLOCK_SIZE;
+	const int32_t *src;
+	int32_t *dst;
+	struct normmap m;
+	unsigned i, length;
+	int kind;
+
+	switch (type) {
+	case UTF8LITE_DECOMP_NORMAL:
+		kind = NORMMAP_NFD;
+		break;
+	case UTF8LITE_CASEFOLD_ALL:
+		kind = NORMMAP_NFD_CASEFOLD;
+		break;
+	case UTF8LITE_DECOMP_ALL:
+		kind = NORMMAP_NFKD;
+		break;
+	case UTF8LITE_DECOMP_ALL | UTF8LITE_CASEFOLD_ALL:
+		kind = NORMMAP_NFKD_CASEFOLD;
+		break;
+	default:
+		// partial compatibility maps are not in the table
+		decompose_map(type, code, bufptr);
+		return;
+	}
+
+	if (HANGUL_SBASE <= code && code < HANGUL_SBASE + HANGUL_SCOUNT) {
+		hangul_decompose(code, bufptr);
+		return;
+	}
+
+	i = normmap_stage1[code / block_size];
+	m = normmap_stage2[i][code % block_size][kind];
+	length = m.length;
+	dst = *bufptr;
+
+	if (length == 0) {
+		*dst++ = code;
+	} else if (length == 1) {
+		*dst++ = (int32_t)m.data;
+	} else {
+		src = &normmap_mapping[m.data];
+		while (length-- > 0) {
+			*dst++ = *src++;
+		}
+	}
+
+	*bufptr = dst;
+}
+
+
+/*
+ * Apply the maps one step at a time, recursing on the results. This
+ * handles the map types that are not in the expanded table.
+ */
+void decompose_map(int type, int32_t code, int32_t **bufptr)
 {
 	const int32_t block_size = DECOMPOSITION_BLOCK_SIZE;
 	unsigned i = decomposition_stage1[code / block_size];
@@ -130,11 +190,11 @@ void utf8lite_map(int type, int32_t code, int32_t **bufptr)
 			*bufptr = dst;
 		}
 	} else if (length == 1) {
-		utf8lite_map(type, d.data, bufptr);
+		decompose_map(type, d.data, bufptr);
 	} else if (d.type >= 0) {
 		src = &decomposition_mapping[d.data];
 		while (length-- > 0) {
-			utf8lite_map(type, *src, bufptr);
+			decompose_map(type, *src, bufptr);
 			src++;
 		}
 	} else {
@@ -235,53 +295,14 @@ static int has_compose(int32_t code, int *offsetptr, int *lengthptr)
 }
 
 
-static int code_cmp(const void *x1, const void *x2)
+static int has_combiner(int32_t left, int offset, int32_t code,
+			int32_t *primaryptr)
 {
-	int32_t y1 = *(const int32_t *)x1;
-	int32_t y2 = *(const int32_t *)x2;
-
-	if (y1 < y2) {
-		return -1;
-	} else if (y1 > y2) {
-		return +1;
-	} else {
-		return 0;
-	}
-}
-
-
-static int combiner_find(int offset, int length, int32_t code)
-{
-	const int32_t *base = composition_combiner + offset;
-	const int32_t *ptr;
-
-	// handle empty and singleton case
-	if (length == 0) {
-		return -1;
-	} else if (length == 1) {
-		return (*base == code) ? 0 : -1;
-	}
-
-	// handle general case
-	ptr = bsearch(&code, base, (size_t)length, sizeof(*base), code_cmp);
-
-	if (ptr == NULL) {
-		return -1;
-	} else {
-		return (int)(ptr - base);
-	}
-}
-
-
-static int has_combiner(int32_t left, int offset, int length, int32_t code,
-		        int32_t *primaryptr)
-{
-	int i;
+	int32_t prim;
 
 	if (offset < COMPOSITION_HANGUL_LPART) {
-		i = combiner_find(offset, length, code);
-		if (i >= 0) {
-			*primaryptr = composition_primary[offset + i];
+		if ((prim = composition_find(left, code))) {
+			*primaryptr = prim;
 			return 1;
 		}
 	} else if (offset == COMPOSITION_HANGUL_LPART) {
@@ -340,7 +361,7 @@ void utf8lite_compose(int32_t *ptr, size_t *lenptr)
 			blocked = 0;
 		}
 
-		if (!blocked && has_combiner(left, moff, mlen, code, &prim)) {
+		if (!blocked && has_combiner(left, moff, code, &prim)) {
 			// replace L by P
 			*leftptr = prim;
 			left = prim;
@@ -378,3 +399,62 @@ void utf8lite_compose(int32_t *ptr, size_t *lenptr)
 out:
 	*lenptr = len;
 }
+
+
+int utf8lite_normal_boundary(int32_t code)
+{
+	if (code <= 0x7F) {
+		return 1;
+	}
+
+	return (combining_class(code) == 0
+		&& !(normalization_prop(code) & NORMALIZATION_NFC_MAYBE));
+}
+
+
+int utf8lite_normal_check(int32_t code, int type, uint8_t *clptr)
+{
+	uint8_t cl;
+	int mask;
+
+	// a partial compatibility map leaves the NFKC_QC=Yes characters
+	// unchanged, so it is safe to use the NFKC properties for it
+	if (type & UTF8LITE_DECOMP_ALL) {
+		mask = NORMALIZATION_NFKC_NO | NORMALIZATION_NFKC_MAYBE;
+	} else {
+		mask = NORMALIZATION_NFC_NO | NORMALIZATION_NFC_MAYBE;
+	}
+
+	if (type & UTF8LITE_CASEFOLD_ALL) {
+		mask |= NORMALIZATION_CASEFOLD_NO;
+	}
+
+	// treat Maybe like No; deciding would take a full compose
+	if (normalization_prop(code) & mask) {
+		return 0;
+	}
+
+	cl = combining_class(code);
+	if (cl != 0 && *clptr > cl) {
+		return 0;
+	}
+	*clptr = cl;
+
+	return 1;
+}
+
+
+int utf8lite_text_isnormal(const struct utf8lite_text *text, int type)
+{
+	struct utf8lite_text_iter it;
+	uint8_t cl = 0;
+
+	utf8lite_text_iter_make(&it, text);
+	while (utf8lite_text_iter_advance(&it)) {
+		if (!utf8lite_normal_check(it.current, type, &cl)) {
+			return 0;
+		}
+	}
+
+	return 1;
+}
@@ -0,0 +1,3460 @@
+/* This file is automatically generated. DO NOT EDIT!
+   Instead, edit gen-charprop.py and re-run.  */
+
+/*
+ * Character properties used for segmentation, width, and
+ * normalization, packed into one record per character so that
+ * looking up several of them for the same character touches the
+ * same cache lines:
+ *
+ *   Grapheme_Cluster_Break, defined in UAX #29 "Unicode Text
+ *   Segmentation", Section 4.1, Table 3, with Extended_Pictographic
+ *   as an extra value;
+ *
+ *   the character width, derived from East_Asian_Width (UAX #11),
+ *   Default_Ignorable_Code_Point, the Emoji properties (UTS #51),
+ *   and the General_Category;
+ *
+ *   White_Space;
+ *
+ *   Canonical_Combining_Class, defined in UAX #44, Section 5.7.4.
+ *
+ *
+ * We use the two-stage lookup strategy described at
+ *
+ *     http://www.strchr.com/multi-stage_tables
+ *
+ * with the second stage holding indices into a table of the
+ * distinct records.
+ */
+
+#ifndef UNICODE_CHARPROP_H
+#define UNICODE_CHARPROP_H
+
+#include <stdint.h>
+
+enum graph_break_prop {
+	GRAPH_BREAK_OTHER = 0,
+	GRAPH_BREAK_CR = 1,
+	GRAPH_BREAK_CONTROL = 2,
+	GRAPH_BREAK_EXTEND = 3,
+	GRAPH_BREAK_EXTENDED_PICTOGRAPHIC = 4,
+	GRAPH_BREAK_L = 5,
+	GRAPH_BREAK_LF = 6,
+	GRAPH_BREAK_LV = 7,
+	GRAPH_BREAK_LVT = 8,
+	GRAPH_BREAK_PREPEND = 9,
+	GRAPH_BREAK_REGIONAL_INDICATOR = 10,
+	GRAPH_BREAK_SPACINGMARK = 11,
+	GRAPH_BREAK_T = 12,
+	GRAPH_BREAK_V = 13,
+	GRAPH_BREAK_ZWJ = 14
+};
+
+enum charwidth_prop {
+	CHARWIDTH_NONE = 0,
+	CHARWIDTH_IGNORABLE = 1,
+	CHARWIDTH_MARK = 2,
+	CHARWIDTH_NARROW = 3,
+	CHARWIDTH_AMBIGUOUS = 4,
+	CHARWIDTH_WIDE = 5,
+	CHARWIDTH_EMOJI = 6
+};
+
+#define CHARPROP_GRAPH_BREAK(prop) ((prop) & 0xF)
+#define CHARPROP_CHARWIDTH(prop) (((prop) >> 4) & 0x7)
+#define CHARPROP_SPACE(prop) (((prop) >> 7) & 0x1)
+#define CHARPROP_COMBINING_CLASS(prop) ((prop) >> 8)
+
+static const uint16_t charprop_record[] = {
+/*   0 */ 0x0000,0x0002,0x0004,0x0010,0x0012,0x0013,0x0015,0x001D,
+/*   8 */ 0x001E,0x0022,0x0023,0x0029,0x0030,0x0033,0x0034,0x0039,
+/*  16 */ 0x003A,0x003B,0x003C,0x003D,0x0040,0x0044,0x0050,0x0053,
+/*  24 */ 0x0054,0x0055,0x0057,0x0058,0x0064,0x0081,0x0082,0x0086,
+/*  32 */ 0x00B0,0x00D0,0x0123,0x065B,0x0723,0x0823,0x0923,0x093B,
+/*  40 */ 0x0A23,0x0B23,0x0C23,0x0D23,0x0E23,0x0F23,0x1023,0x1123,
+/*  48 */ 0x1223,0x1323,0x1423,0x1523,0x1623,0x1723,0x1823,0x1923,
+/*  56 */ 0x1A23,0x1B23,0x1C23,0x1D23,0x1E23,0x1F23,0x2023,0x2123,
+/*  64 */ 0x2223,0x2323,0x2423,0x5423,0x5B23,0x6723,0x6B23,0x7623,
+/*  72 */ 0x7A23,0x8123,0x8223,0x8423,0xCA23,0xD623,0xD823,0xD833,
+/*  80 */ 0xD83B,0xDA23,0xDC23,0xDE23,0xE053,0xE23B,0xE423,0xE623,
+/*  88 */ 0xE823,0xE923,0xEA23,0xF023
+};
+
+static const uint8_t charprop_stage1[] = {
+/* U+0000 */  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15,
+/* U+0800 */ 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+/* U+1000 */ 32, 33, 34, 35, 36, 37, 38, 39, 40, 40, 40, 40, 40, 41, 42, 43,
+/* U+1800 */ 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 40, 54, 40, 40, 55, 56,
+/* U+2000 */ 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72,
+/* U+2800 */ 40, 40, 73, 40, 40, 40, 74, 75, 40, 76, 77, 78, 79, 80, 81, 82,
+/* U+3000 */ 83, 84, 85, 86, 87, 88, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+3800 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+4000 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+4800 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 89, 81, 81, 81, 81,
+/* U+5000 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+5800 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+6000 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+6800 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+7000 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+7800 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+8000 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+8800 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+9000 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+9800 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+A000 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 90, 40, 40, 91, 92, 40, 93,
+/* U+A800 */ 94, 95, 96, 97, 98, 99,100,101,102,103,104,105,106,107,108,102,
+/* U+B000 */103,104,105,106,107,108,102,103,104,105,106,107,108,102,103,104,
+/* U+B800 */105,106,107,108,102,103,104,105,106,107,108,102,103,104,105,106,
+/* U+C000 */107,108,102,103,104,105,106,107,108,102,103,104,105,106,107,108,
+/* U+C800 */102,103,104,105,106,107,108,102,103,104,105,106,107,108,102,103,
+/* U+D000 */104,105,106,107,108,102,103,104,105,106,107,108,102,103,104,109,
+/* U+D800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+E000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+E800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+F000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+F800 */110,110, 81, 81,111,112,113,114, 40, 40, 40,115,116,117,118,119,
+/* U+10000 */120,121,122,123,110,124,125,126, 40,127,128,129, 40, 40,130,131,
+/* U+10800 */132,133,134,135,136,137,138,139,140,141,142,110,143,144,145,146,
+/* U+11000 */147,148,149,150,151,152,153,110,154,155,110,156,157,158,159,110,
+/* U+11800 */160,161,162,163,164,165,110,110,166,167,168,169,110,170,110,171,
+/* U+12000 */ 40, 40, 40, 40, 40, 40, 40,172,173, 40,174,110,110,110,110,110,
+/* U+12800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,175,
+/* U+13000 */ 40, 40, 40, 40, 40, 40, 40, 40,176,110,110,110,110,110,110,110,
+/* U+13800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+14000 */110,110,110,110,110,110,110,110, 40, 40, 40, 40,177,110,110,110,
+/* U+14800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+15000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+15800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+16000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+16800 */ 40, 40, 40, 40,178,179,180,181,110,110,110,110,182,183,184,185,
+/* U+17000 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+17800 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+18000 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,186,
+/* U+18800 */ 81, 81, 81, 81, 81, 81, 81, 81, 81,187,188,110,110,110,110,110,
+/* U+19000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+19800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+1A000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+1A800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,189,
+/* U+1B000 */ 81, 81,190, 81, 81,191,110,110,110,110,110,110,110,110,110,110,
+/* U+1B800 */110,110,110,110,110,110,110,110,192,193,110,110,110,110,110,110,
+/* U+1C000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+1C800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,194,174,
+/* U+1D000 */ 40,195,196,197,198,199,200,110,201,202,203, 40, 40,204, 40,205,
+/* U+1D800 */ 40, 40, 40, 40,206,207,110,110,110,110,110,110,110,110,208,110,
+/* U+1E000 */209,110,210,110,110,211,110,110,110,110,110,110,110,110,110,212,
+/* U+1E800 */ 40,213,214,110,110,110,110,110,215,216,217,110,218,219,110,110,
+/* U+1F000 */220,221,222,223,224,225,226,227,228,229,230,231,232,233,234,235,
+/* U+1F800 */236,237,238,239,240,241, 40,242,225,225,225,225,225,225,225,243,
+/* U+20000 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+20800 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+21000 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+21800 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+22000 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+22800 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+23000 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+23800 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+24000 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+24800 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+25000 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+25800 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+26000 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+26800 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+27000 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+27800 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+28000 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+28800 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+29000 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+29800 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+2A000 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,244, 81, 81,
+/* U+2A800 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+2B000 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,245, 81,
+/* U+2B800 */246, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+2C000 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+2C800 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,247, 81, 81,
+/* U+2D000 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+2D800 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+2E000 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+2E800 */ 81, 81, 81, 81, 81, 81, 81,248,110,110,110,110,110,110,110,110,
+/* U+2F000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+2F800 */ 81, 81, 81, 81,249,110,110,110,110,110,110,110,110,110,110,110,
+/* U+30000 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+30800 */ 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+/* U+31000 */ 81, 81, 81, 81, 81, 81,250,110,110,110,110,110,110,110,110,110,
+/* U+31800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+32000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+32800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+33000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+33800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+34000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+34800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+35000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+35800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+36000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+36800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+37000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+37800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+38000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+38800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+39000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+39800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+3A000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+3A800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+3B000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+3B800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+3C000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+3C800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+3D000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+3D800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+3E000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+3E800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+3F000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+3F800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+40000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+40800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+41000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+41800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+42000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+42800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+43000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+43800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+44000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+44800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+45000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+45800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+46000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+46800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+47000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+47800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+48000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+48800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+49000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+49800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+4A000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+4A800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+4B000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+4B800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+4C000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+4C800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+4D000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+4D800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+4E000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+4E800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+4F000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+4F800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+50000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+50800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+51000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+51800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+52000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+52800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+53000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+53800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+54000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+54800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+55000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+55800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+56000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+56800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+57000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+57800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+58000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+58800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+59000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+59800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+5A000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+5A800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+5B000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+5B800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+5C000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+5C800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+5D000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+5D800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+5E000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+5E800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+5F000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+5F800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+60000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+60800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+61000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+61800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+62000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+62800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+63000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+63800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+64000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+64800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+65000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+65800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+66000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+66800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+67000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+67800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+68000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+68800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+69000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+69800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+6A000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+6A800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+6B000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+6B800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+6C000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+6C800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+6D000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+6D800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+6E000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+6E800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+6F000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+6F800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+70000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+70800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+71000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+71800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+72000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+72800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+73000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+73800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+74000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+74800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+75000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+75800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+76000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+76800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+77000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+77800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+78000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+78800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+79000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+79800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+7A000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+7A800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+7B000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+7B800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+7C000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+7C800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+7D000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+7D800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+7E000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+7E800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+7F000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+7F800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+80000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+80800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+81000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+81800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+82000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+82800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+83000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+83800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+84000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+84800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+85000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+85800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+86000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+86800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+87000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+87800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+88000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+88800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+89000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+89800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+8A000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+8A800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+8B000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+8B800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+8C000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+8C800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+8D000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+8D800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+8E000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+8E800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+8F000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+8F800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+90000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+90800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+91000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+91800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+92000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+92800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+93000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+93800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+94000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+94800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+95000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+95800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+96000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+96800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+97000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+97800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+98000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+98800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+99000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+99800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+9A000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+9A800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+9B000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+9B800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+9C000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+9C800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+9D000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+9D800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+9E000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+9E800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+9F000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+9F800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+A0000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+A0800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+A1000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+A1800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+A2000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+A2800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+A3000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+A3800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+A4000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+A4800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+A5000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+A5800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+A6000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+A6800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+A7000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+A7800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+A8000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+A8800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+A9000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+A9800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+AA000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+AA800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+AB000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+AB800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+AC000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+AC800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+AD000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+AD800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+AE000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+AE800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+AF000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+AF800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+B0000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+B0800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+B1000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+B1800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+B2000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+B2800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+B3000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+B3800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+B4000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+B4800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+B5000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+B5800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+B6000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+B6800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+B7000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+B7800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+B8000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+B8800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+B9000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+B9800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+BA000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+BA800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+BB000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+BB800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+BC000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+BC800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+BD000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+BD800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+BE000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+BE800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+BF000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+BF800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+C0000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+C0800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+C1000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+C1800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+C2000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+C2800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+C3000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+C3800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+C4000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+C4800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+C5000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+C5800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+C6000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+C6800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+C7000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+C7800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+C8000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+C8800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+C9000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+C9800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+CA000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+CA800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+CB000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+CB800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+CC000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+CC800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+CD000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+CD800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+CE000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+CE800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+CF000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+CF800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+D0000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+D0800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+D1000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+D1800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+D2000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+D2800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+D3000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+D3800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+D4000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+D4800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+D5000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+D5800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+D6000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+D6800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+D7000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+D7800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+D8000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+D8800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+D9000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+D9800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+DA000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+DA800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+DB000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+DB800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+DC000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+DC800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+DD000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+DD800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+DE000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+DE800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+DF000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+DF800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+E0000 */251,252,253,254,252,252,252,252,252,252,252,252,252,252,252,252,
+/* U+E0800 */252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+/* U+E1000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+E1800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+E2000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+E2800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+E3000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+E3800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+E4000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+E4800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+E5000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+E5800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+E6000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+E6800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+E7000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+E7800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+E8000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+E8800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+E9000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+E9800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+EA000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+EA800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+EB000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+EB800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+EC000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+EC800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+ED000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+ED800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+EE000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+EE800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+EF000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+EF800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+F0000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+F0800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+F1000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+F1800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+F2000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+F2800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+F3000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+F3800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+F4000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+F4800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+F5000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+F5800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+F6000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+F6800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+F7000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+F7800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+F8000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+F8800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+F9000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+F9800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+FA000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+FA800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+FB000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+FB800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+FC000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+FC800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+FD000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+FD800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+FE000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+FE800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+FF000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+FF800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+100000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+100800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+101000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+101800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+102000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+102800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+103000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+103800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+104000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+104800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+105000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+105800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+106000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+106800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+107000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+107800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+108000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+108800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+109000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+109800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+10A000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+10A800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+10B000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+10B800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+10C000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+10C800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+10D000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+10D800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+10E000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+10E800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+10F000 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+/* U+10F800 */110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110
+};
+
+static const uint8_t charprop_stage2[][128] = {
+  /* block 0 */
+  {  1,  1,  1,  1,  1,  1,  1,  1,  1, 30, 31, 30, 30, 29,  1,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+    32, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  1
+  },
+
+  /* block 1 */
+  {  1,  1,  1,  1,  1, 30,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+    32, 20, 12, 12, 20, 12, 12, 20, 20, 14, 20, 12, 12,  4, 21, 12,
+    20, 20, 20, 20, 20, 12, 20, 20, 20, 20, 20, 12, 20, 20, 20, 20,
+    12, 12, 12, 12, 12, 12, 20, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    20, 12, 12, 12, 12, 12, 12, 20, 20, 12, 12, 12, 12, 12, 20, 20,
+    20, 20, 12, 12, 12, 12, 20, 12, 20, 20, 20, 12, 20, 20, 12, 12,
+    20, 12, 20, 20, 12, 12, 12, 20, 20, 20, 20, 12, 20, 12, 20, 12
+  },
+
+  /* block 2 */
+  { 12, 20, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 20, 12, 20, 12, 12, 12, 12, 12, 12, 12, 20, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 20, 20, 12, 12, 12, 20, 12, 12, 12, 12,
+    12, 20, 20, 20, 12, 12, 12, 12, 20, 12, 12, 12, 12, 12, 12, 20,
+    20, 20, 20, 12, 20, 12, 12, 12, 20, 20, 20, 20, 12, 20, 12, 12,
+    12, 12, 20, 20, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 20, 20, 12, 12, 12, 20, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 3 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 20, 12,
+    20, 12, 20, 12, 20, 12, 20, 12, 20, 12, 20, 12, 20, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 4 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 20, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 20, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 5 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 20, 12, 12, 20, 12, 20, 20, 20, 12, 20, 12, 12,
+    20, 12, 12, 12, 12, 12, 12, 12, 20, 20, 20, 20, 12, 20, 12, 20,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 6 */
+  { 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 88, 82, 82, 82, 82, 88, 78, 82, 82, 82, 82,
+    82, 76, 76, 82, 82, 82, 82, 76, 76, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 34, 34, 34, 34, 34, 82, 82, 82, 82, 87, 87, 87,
+    87, 87, 87, 87, 87, 91, 87, 82, 82, 82, 87, 87, 87, 82, 82,  5,
+    87, 87, 87, 82, 82, 82, 82, 87, 88, 82, 82, 87, 89, 90, 90, 89,
+    90, 90, 89, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    12, 12, 12, 12, 12, 12, 12, 12,  0,  0, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 7 */
+  {  0,  0,  0,  0, 12, 12, 12, 12, 12, 12, 12,  0, 12,  0, 12, 12,
+    12, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20,  0, 20, 20, 20, 20, 20, 20, 20, 12, 12, 12, 12, 12, 12,
+    12, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 12, 20, 20, 20, 20, 20, 20, 20, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 8 */
+  { 12, 20, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    12, 20, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 9 */
+  { 12, 12, 12, 87, 87, 87, 87, 87, 10, 10, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 10 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+     0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12,  0,  0, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 11 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0, 12, 12, 12,
+     0, 82, 87, 87, 87, 87, 82, 87, 87, 87, 83, 82, 87, 87, 87, 87,
+    87, 87, 82, 82, 82, 82, 82, 82, 87, 87, 82, 87, 87, 83, 86, 87,
+    40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 49, 50, 51, 52, 12, 53,
+    12, 54, 55, 12, 87, 82, 12, 48,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0, 12,
+    12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 12 */
+  { 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    87, 87, 87, 87, 87, 87, 87, 87, 60, 61, 62, 12,  4, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 57, 58, 59, 60, 61,
+    62, 63, 64, 87, 87, 82, 82, 87, 87, 87, 87, 87, 82, 87, 87, 82,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    65, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 13 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 87, 87, 87, 87, 87, 87, 87, 11, 12, 87,
+    87, 87, 87, 82, 87, 12, 12, 87, 87, 12, 82, 87, 87, 82, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 14 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0, 11,
+    12, 66, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    87, 82, 87, 87, 82, 87, 87, 82, 82, 82, 87, 82, 82, 87, 82, 87,
+    87, 87, 82, 87, 82, 87, 82, 87, 82, 87, 87,  0,  0, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 15 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 87, 87, 87, 87, 87,
+    87, 87, 82, 87, 12, 12, 12, 12, 12, 12, 12,  0,  0, 82, 12, 12
+  },
+
+  /* block 16 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 87, 87, 87, 87, 12, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 12, 87, 87, 87, 12, 87, 87, 87, 87, 87,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 82, 82, 82,  0,  0, 12,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 17 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,
+    11, 11,  0,  0,  0,  0,  0,  0, 87, 82, 82, 82, 87, 87, 87, 87,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 87, 87, 87, 87, 87, 82,
+    82, 82, 82, 82, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 11, 82, 87, 87, 82, 87, 87, 82, 87, 87, 87, 82, 82, 82,
+    57, 58, 59, 87, 87, 87, 82, 87, 87, 82, 82, 87, 87, 87, 87, 87
+  },
+
+  /* block 18 */
+  { 10, 10, 10, 17, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 17, 36, 12, 17, 17,
+    17, 10, 10, 10, 10, 10, 10, 10, 10, 17, 17, 17, 17, 38, 17, 17,
+    12, 87, 82, 87, 87, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 19 */
+  { 12, 10, 17, 17,  0, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0, 12,
+    12,  0,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12,  0, 12, 12, 12, 12, 12, 12,
+    12,  0, 12,  0,  0,  0, 12, 12, 12, 12,  0,  0, 36, 12, 13, 17,
+    17, 10, 10, 10, 10,  0,  0, 17, 17,  0,  0, 17, 17, 38, 12,  0,
+     0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,  0, 12, 12,  0, 12,
+    12, 12, 10, 10,  0,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 87,  0
+  },
+
+  /* block 20 */
+  {  0, 10, 10, 17,  0, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0, 12,
+    12,  0,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12,  0, 12, 12, 12, 12, 12, 12,
+    12,  0, 12, 12,  0, 12, 12,  0, 12, 12,  0,  0, 36,  0, 17, 17,
+    17, 10, 10,  0,  0,  0,  0, 10, 10,  0,  0, 10, 10, 38,  0,  0,
+     0, 10,  0,  0,  0,  0,  0,  0,  0, 12, 12, 12, 12,  0, 12,  0,
+     0,  0,  0,  0,  0,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    10, 10, 12, 12, 12, 10, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 21 */
+  {  0, 10, 10, 17,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0, 12,
+    12, 12,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12,  0, 12, 12, 12, 12, 12, 12,
+    12,  0, 12, 12,  0, 12, 12, 12, 12, 12,  0,  0, 36, 12, 17, 17,
+    17, 10, 10, 10, 10, 10,  0, 10, 10, 17,  0, 17, 17, 38,  0,  0,
+    12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 10, 10,  0,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12,  0,  0,  0,  0,  0,  0,  0, 12, 10, 10, 10, 10, 10, 10
+  },
+
+  /* block 22 */
+  {  0, 10, 17, 17,  0, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0, 12,
+    12,  0,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12,  0, 12, 12, 12, 12, 12, 12,
+    12,  0, 12, 12,  0, 12, 12, 12, 12, 12,  0,  0, 36, 12, 13, 10,
+    17, 10, 10, 10, 10,  0,  0, 17, 17,  0,  0, 17, 17, 38,  0,  0,
+     0,  0,  0,  0,  0, 10, 10, 13,  0,  0,  0,  0, 12, 12,  0, 12,
+    12, 12, 10, 10,  0,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 23 */
+  {  0,  0, 10, 12,  0, 12, 12, 12, 12, 12, 12,  0,  0,  0, 12, 12,
+    12,  0, 12, 12, 12, 12,  0,  0,  0, 12, 12,  0, 12,  0, 12, 12,
+     0,  0,  0, 12, 12,  0,  0,  0, 12, 12, 12,  0,  0,  0, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0, 13, 17,
+    10, 17, 17,  0,  0,  0, 17, 17, 17,  0, 17, 17, 17, 38,  0,  0,
+    12,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0
+  },
+
+  /* block 24 */
+  { 10, 17, 17, 17, 10, 12, 12, 12, 12, 12, 12, 12, 12,  0, 12, 12,
+    12,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12,  0, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0, 36, 12, 10, 10,
+    10, 17, 17, 17, 17,  0, 10, 10, 10,  0, 10, 10, 10, 38,  0,  0,
+     0,  0,  0,  0,  0, 67, 68,  0, 12, 12, 12,  0,  0, 12,  0,  0,
+    12, 12, 10, 10,  0,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+     0,  0,  0,  0,  0,  0,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 25 */
+  { 12, 10, 17, 17, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0, 12, 12,
+    12,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12,  0, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12,  0, 12, 12, 12, 12, 12,  0,  0, 36, 12, 17, 10,
+    17, 17, 13, 17, 17,  0, 10, 17, 17,  0, 17, 17, 10, 38,  0,  0,
+     0,  0,  0,  0,  0, 13, 13,  0,  0,  0,  0,  0,  0, 12, 12,  0,
+    12, 12, 10, 10,  0,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+     0, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 26 */
+  { 10, 10, 17, 17, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0, 12, 12,
+    12,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 38, 38, 12, 13, 17,
+    17, 10, 10, 10, 10,  0, 17, 17, 17,  0, 17, 17, 17, 38, 15, 12,
+     0,  0,  0,  0, 12, 12, 12, 13, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 10, 10,  0,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 27 */
+  {  0, 10, 17, 17,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12,  0,  0,  0, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0, 12,  0,  0,
+    12, 12, 12, 12, 12, 12, 12,  0,  0,  0, 38,  0,  0,  0,  0, 13,
+    17, 17, 10, 10, 10,  0, 10,  0, 17, 17, 17, 17, 17, 17, 17, 13,
+     0,  0,  0,  0,  0,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+     0,  0, 17, 17, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 28 */
+  {  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 10, 12, 17, 10, 10, 10, 10, 69, 69, 38,  0,  0,  0,  0, 12,
+    12, 12, 12, 12, 12, 12, 12, 10, 70, 70, 70, 70, 10, 10, 10, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 29 */
+  {  0, 12, 12,  0, 12,  0, 12, 12, 12, 12, 12,  0, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12,  0, 12,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 10, 12, 17, 10, 10, 10, 10, 71, 71, 38, 10, 10, 12,  0,  0,
+    12, 12, 12, 12, 12,  0, 12,  0, 72, 72, 72, 72, 10, 10,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0, 12, 12, 12, 12,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 30 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 82, 82, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 82, 12, 82, 12, 78, 12, 12, 12, 12, 17, 17,
+    12, 12, 12, 12, 12, 12, 12, 12,  0, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,
+     0, 73, 74, 10, 75, 10, 10, 10, 10, 10, 74, 74, 74, 74, 10, 17
+  },
+
+  /* block 31 */
+  { 74, 10, 87, 87, 38, 12, 87, 87, 12, 12, 12, 12, 12, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10,  0, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,  0, 12, 12,
+    12, 12, 12, 12, 12, 12, 82, 12, 12, 12, 12, 12, 12,  0, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 32 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10,
+    10, 17, 10, 10, 10, 10, 10, 36, 12, 38, 38, 17, 17, 10, 10, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 17, 17, 10, 10, 12, 12, 12, 12, 10, 10,
+    10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 10, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 33 */
+  { 12, 12, 10, 12, 17, 10, 10, 12, 12, 12, 12, 12, 12, 82, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12,  0, 12,  0,  0,  0,  0,  0, 12,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 34 */
+  { 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,  6,
+     7, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19
+  },
+
+  /* block 35 */
+  { 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18
+  },
+
+  /* block 36 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12,  0, 12, 12, 12, 12,  0,  0,
+    12, 12, 12, 12, 12, 12, 12,  0, 12,  0, 12, 12, 12, 12,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 37 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12,  0, 12, 12, 12, 12,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12,  0, 12, 12, 12, 12,  0,  0, 12, 12, 12, 12, 12, 12, 12,  0,
+    12,  0, 12, 12, 12, 12,  0,  0, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12,  0, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 38 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12,  0, 12, 12, 12, 12,  0,  0, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0, 87, 87, 87,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0
+  },
+
+  /* block 39 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12,  0,  0, 12, 12, 12, 12, 12, 12,  0,  0
+  },
+
+  /* block 40 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 41 */
+  { 32, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 42 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 10, 10, 38, 39,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 10, 10, 39, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 10, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0, 12, 12,
+    12,  0, 10, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 43 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12,  5,  5, 17, 10, 10, 10, 10, 10, 10, 10, 17, 17,
+    17, 17, 17, 17, 17, 17, 10, 17, 17, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 38, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 87,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 44 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  5,  5,  5,  4,  5,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 45 */
+  { 12, 12, 12, 12, 12, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 86, 12,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 46 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,
+    10, 10, 10, 17, 17, 17, 17, 10, 10, 17, 17, 17,  0,  0,  0,  0,
+    17, 17, 10, 17, 17, 17, 17, 17, 17, 83, 87, 82,  0,  0,  0,  0,
+    12,  0,  0,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,
+    12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 47 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 48 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 87, 82, 17, 17, 10,  0,  0, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 17, 10, 17, 10, 10, 10, 10, 10, 10, 10,  0,
+    38, 12, 10, 12, 12, 10, 10, 10, 10, 10, 10, 10, 10, 17, 17, 17,
+    17, 17, 17, 10, 10, 87, 87, 87, 87, 87, 87, 87, 87,  0,  0, 82
+  },
+
+  /* block 49 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,
+    87, 87, 87, 87, 87, 82, 82, 82, 82, 82, 82, 87, 87, 82, 10, 82,
+    82, 87, 87, 82, 82, 87, 87, 87, 87, 87, 82, 87, 87, 87, 87,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 50 */
+  { 10, 10, 10, 10, 17, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 36, 13, 10, 10, 10, 10, 10, 17, 10, 17, 17, 17,
+    17, 17, 10, 17, 39, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 87, 82, 87, 87, 87,
+    87, 87, 87, 87, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0
+  },
+
+  /* block 51 */
+  { 10, 10, 17, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 17, 10, 10, 10, 10, 17, 17, 10, 10, 39, 38, 10, 10, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 36, 17, 10, 10, 17, 17, 17, 10, 17, 10,
+    10, 10, 39, 39,  0,  0,  0,  0,  0,  0,  0,  0, 12, 12, 12, 12
+  },
+
+  /* block 52 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 17, 17, 17, 17, 17, 17, 17, 17, 10, 10, 10, 10,
+    10, 10, 10, 10, 17, 17, 10, 36,  0,  0,  0, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 53 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,
+    87, 87, 87, 12, 34, 82, 82, 82, 82, 82, 87, 87, 82, 82, 82, 82,
+    87, 17, 34, 34, 34, 34, 34, 34, 34, 12, 12, 12, 12, 82, 12, 12,
+    12, 12, 12, 12, 87, 12, 12, 17, 87, 87, 12,  0,  0,  0,  0,  0
+  },
+
+  /* block 54 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    87, 87, 82, 87, 87, 87, 87, 87, 87, 87, 82, 87, 87, 90, 77, 82,
+    76, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 88, 86, 86, 82, 81, 87, 89, 82, 87, 82
+  },
+
+  /* block 55 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12,  0,  0, 12, 12, 12, 12, 12, 12,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12,  0,  0, 12, 12, 12, 12, 12, 12,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12,  0, 12,  0, 12,  0, 12,  0, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0
+  },
+
+  /* block 56 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12,  0,  0, 12, 12, 12, 12, 12, 12,  0, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+     0,  0, 12, 12, 12,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0
+  },
+
+  /* block 57 */
+  { 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,  4,  5,  8,  4,  4,
+    20, 12, 12, 20, 20, 20, 20, 12, 20, 20, 12, 12, 20, 20, 12, 12,
+    20, 20, 20, 12, 20, 20, 20, 20, 30, 30,  4,  4,  4,  4,  4, 32,
+    20, 12, 20, 20, 12, 20, 12, 12, 12, 12, 12, 20, 14, 12, 20, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 14, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 32,
+     4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+    12, 12,  0,  0, 20, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 20
+  },
+
+  /* block 58 */
+  { 12, 20, 20, 20, 20, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 20, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    87, 87, 34, 34, 87, 87, 87, 87, 34, 34, 34, 87, 87, 10, 10, 10,
+    10, 87, 10, 10, 10, 34, 34, 87, 82, 87, 34, 34, 82, 82, 82, 82,
+    87,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 59 */
+  { 12, 12, 12, 20, 12, 20, 12, 12, 12, 20, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 20, 12, 12, 20, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 20, 21, 12, 12, 12, 20, 12, 12, 12, 12, 20, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 14, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 20, 20, 12, 12, 12, 12, 12, 12, 20, 20, 20, 20, 12,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 12, 12, 12, 12,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 60 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 20, 12, 12,  0,  0,  0,  0,
+    20, 20, 20, 20, 21, 21, 21, 21, 21, 21, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 14, 14, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 20, 20, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 20, 12, 20, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 20, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 61 */
+  { 20, 12, 20, 20, 12, 12, 12, 20, 20, 12, 12, 20, 12, 12, 12, 20,
+    12, 20, 12, 12, 12, 20, 12, 12, 12, 12, 20, 12, 12, 20, 20, 20,
+    20, 12, 12, 20, 12, 20, 12, 20, 20, 20, 20, 20, 20, 12, 20, 12,
+    12, 12, 12, 12, 20, 20, 20, 20, 12, 12, 12, 12, 20, 20, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 20, 12, 12, 12, 20, 12, 12, 12,
+    12, 12, 20, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    20, 20, 12, 12, 20, 20, 20, 20, 12, 12, 20, 20, 12, 12, 20, 20,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 62 */
+  { 12, 12, 20, 20, 12, 12, 20, 20, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 20, 12, 12, 12, 20, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 20, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 20,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 63 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 20, 12, 12, 12, 12, 12, 12, 12, 28, 28, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 14, 22, 22, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 64 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 14, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 14,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 28, 28, 28, 28, 14, 14, 14,
+    28, 14, 14, 28, 12, 12, 12, 12, 14, 14, 14, 12, 12, 12, 12, 12
+  },
+
+  /* block 65 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20
+  },
+
+  /* block 66 */
+  { 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 21, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 12, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20
+  },
+
+  /* block 67 */
+  { 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 12, 12, 12, 12,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 68 */
+  { 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    12, 12, 20, 20, 20, 20, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    20, 20, 12, 20, 20, 20, 20, 20, 20, 20, 14, 14, 12, 12, 12, 12,
+    12, 12, 20, 20, 12, 12, 21, 20, 12, 12, 12, 12, 20, 20, 12, 12,
+    21, 20, 12, 12, 12, 12, 20, 20, 20, 12, 12, 20, 12, 12, 20, 20,
+    20, 20, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 20, 20, 20, 20, 12, 12, 12, 12, 12, 12, 12, 12, 12, 20,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 14, 14, 28, 28, 12
+  },
+
+  /* block 69 */
+  { 14, 14, 14, 14, 14, 21, 20, 14, 14, 21, 14, 14, 14, 14, 21, 21,
+    14, 14, 14, 12, 28, 28, 14, 14, 14, 14, 14, 14, 21, 14, 21, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    21, 14, 21, 14, 14, 14, 14, 14, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    21, 21, 14, 21, 21, 21, 14, 21, 21, 21, 21, 14, 21, 21, 14, 21,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 28
+  },
+
+  /* block 70 */
+  { 14, 14, 14, 14, 14, 14, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    14, 14, 14, 28, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 21, 21,
+    14, 28, 14, 14, 14, 14, 14, 14, 14, 14, 28, 28, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 28, 28, 21,
+    14, 14, 14, 14, 28, 28, 21, 21, 21, 21, 21, 21, 21, 21, 28, 21,
+    21, 21, 21, 21, 28, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 14, 21, 14, 14, 14, 14, 21, 21, 28, 21, 21, 21, 21, 21,
+    21, 21, 28, 28, 21, 28, 21, 21, 21, 21, 28, 21, 21, 28, 21, 21
+  },
+
+  /* block 71 */
+  { 14, 14, 14, 14, 14, 28, 12, 12, 14, 14, 28, 28, 14, 14, 14, 14,
+    14, 14, 14, 12, 14, 12, 14, 12, 12, 12, 12, 12, 12, 14, 12, 12,
+    12, 14, 12, 12, 12, 12, 12, 12, 28, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 14, 14, 12, 12, 12, 12, 12, 12, 12, 12, 20, 12, 12,
+    12, 12, 12, 12, 14, 12, 12, 14, 12, 12, 12, 12, 28, 12, 28, 12,
+    12, 12, 12, 28, 28, 28, 12, 28, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 14, 14, 14, 14, 14, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20
+  },
+
+  /* block 72 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 28, 28, 28, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 14, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    28, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 28,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 73 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 14, 14, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 74 */
+  { 12, 12, 12, 12, 12, 14, 14, 14, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 28, 28, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    28, 12, 12, 12, 12, 28, 20, 20, 20, 20, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12,  0,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 75 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 76 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 87,
+    87, 87, 12, 12,  0,  0,  0,  0,  0, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 77 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12,  0, 12,  0,  0,  0,  0,  0, 12,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0, 12,
+    12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 38
+  },
+
+  /* block 78 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12,  0, 12, 12, 12, 12, 12, 12, 12,  0,
+    12, 12, 12, 12, 12, 12, 12,  0, 12, 12, 12, 12, 12, 12, 12,  0,
+    12, 12, 12, 12, 12, 12, 12,  0, 12, 12, 12, 12, 12, 12, 12,  0,
+    12, 12, 12, 12, 12, 12, 12,  0, 12, 12, 12, 12, 12, 12, 12,  0,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87
+  },
+
+  /* block 79 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 80 */
+  { 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22,  0, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 81 */
+  { 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22
+  },
+
+  /* block 82 */
+  { 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,  0,  0,  0,  0
+  },
+
+  /* block 83 */
+  { 33, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 81, 86, 88, 83, 84, 84,
+    24, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 24, 22, 12,
+     0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22
+  },
+
+  /* block 84 */
+  { 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22,  0,  0, 37, 37, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22
+  },
+
+  /* block 85 */
+  {  0,  0,  0,  0,  0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+     0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22,  3, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22
+  },
+
+  /* block 86 */
+  { 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,  0,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22
+  },
+
+  /* block 87 */
+  { 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,  0,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 20, 20, 20, 20, 20, 20, 20, 20,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22
+  },
+
+  /* block 88 */
+  { 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 24, 22, 24, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22
+  },
+
+  /* block 89 */
+  { 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 90 */
+  { 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,  0,  0,  0,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 91 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 87,
+    10, 10, 10, 12, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 12, 12
+  },
+
+  /* block 92 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 87, 87,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    87, 87, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 93 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,
+    12, 12,  0, 12,  0, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 94 */
+  { 12, 12, 10, 12, 12, 12, 38, 12, 12, 12, 12, 10, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 17, 17, 10, 10, 17, 12, 12, 12, 12, 38,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 95 */
+  { 17, 17, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 38, 10,  0,  0,  0,  0,  0,  0,  0,  0, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10
+  },
+
+  /* block 96 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 10, 10, 10, 10, 10, 82, 82, 82, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 17, 39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,  0,  0,  0
+  },
+
+  /* block 97 */
+  { 10, 10, 10, 17, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 36, 17, 17, 10, 10, 10, 10, 17, 17, 10, 10, 17, 17,
+    39, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0, 12, 12,
+    12, 12, 12, 12, 12, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0
+  },
+
+  /* block 98 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 10, 10, 10, 17,
+    17, 10, 10, 17, 17, 10, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 10, 12, 12, 12, 12, 12, 12, 12, 12, 10, 17,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 12, 12, 12
+  },
+
+  /* block 99 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    87, 12, 87, 87, 82, 12, 12, 87, 87, 12, 12, 12, 12, 12, 87, 87,
+    12, 87, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 17, 10, 10, 17, 17,
+    12, 12, 12, 12, 12, 17, 38,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 100 */
+  {  0, 12, 12, 12, 12, 12, 12,  0,  0, 12, 12, 12, 12, 12, 12,  0,
+     0, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12,  0, 12, 12, 12, 12, 12, 12, 12,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 101 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 17, 17, 10, 17, 17, 10, 17, 17, 12, 17, 38,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 102 */
+  { 26, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 26, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 26, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 26, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    26, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27
+  },
+
+  /* block 103 */
+  { 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 26, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 26, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 26, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    26, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 26, 27, 27, 27
+  },
+
+  /* block 104 */
+  { 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 26, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 26, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    26, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 26, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27
+  },
+
+  /* block 105 */
+  { 27, 27, 27, 27, 27, 27, 27, 27, 26, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 26, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    26, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 26, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 26, 27, 27, 27, 27, 27, 27, 27
+  },
+
+  /* block 106 */
+  { 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 26, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    26, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 26, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 26, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27
+  },
+
+  /* block 107 */
+  { 27, 27, 27, 27, 26, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    26, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 26, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 26, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 26, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27
+  },
+
+  /* block 108 */
+  { 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    26, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 26, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 26, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 26, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27
+  },
+
+  /* block 109 */
+  { 27, 27, 27, 27, 27, 27, 27, 27, 26, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19,  0,  0,  0,  0, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,  0,  0,  0,  0
+  },
+
+  /* block 110 */
+  {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 111 */
+  { 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,  0,  0,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22
+  },
+
+  /* block 112 */
+  { 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 113 */
+  { 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0, 12, 56, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12,  0, 12, 12, 12, 12, 12,  0, 12,  0,
+    12, 12,  0, 12, 12,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 114 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 115 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+     0,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0, 12,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 116 */
+  {  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22,  0,  0,  0,  0,  0,  0,
+    87, 87, 87, 87, 87, 87, 87, 82, 82, 82, 82, 82, 82, 82, 87, 87,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22,  0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22,  0, 22, 22, 22, 22,  0,  0,  0,  0,
+    12, 12, 12, 12, 12,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 117 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  4
+  },
+
+  /* block 118 */
+  {  0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 119 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 13, 13,
+     3, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,
+     0,  0, 12, 12, 12, 12, 12, 12,  0,  0, 12, 12, 12, 12, 12, 12,
+     0,  0, 12, 12, 12, 12, 12, 12,  0,  0, 12, 12, 12,  0,  0,  0,
+    22, 22, 22, 22, 22, 22, 22,  0, 12, 12, 12, 12, 12, 12, 12,  0,
+     4,  4,  4,  4,  4,  4,  4,  4,  4,  1,  1,  1, 12, 20,  0,  0
+  },
+
+  /* block 120 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12,  0, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0, 12, 12,  0, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 121 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0
+  },
+
+  /* block 122 */
+  { 12, 12, 12,  0,  0,  0,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12,  0,  0,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 123 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,
+    12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 82,  0,  0
+  },
+
+  /* block 124 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    82, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0
+  },
+
+  /* block 125 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 87, 87, 87, 87, 87,  0,  0,  0,  0,  0
+  },
+
+  /* block 126 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12,  0,  0,  0,  0, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 127 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12,  0,  0,  0,  0, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0
+  },
+
+  /* block 128 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0, 12, 12, 12, 12
+  },
+
+  /* block 129 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0, 12, 12, 12, 12,
+    12, 12, 12,  0, 12, 12,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12,  0, 12, 12, 12, 12, 12, 12, 12,  0, 12, 12,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 130 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 131 */
+  { 12, 12, 12, 12, 12, 12,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 132 */
+  { 12, 12, 12, 12, 12, 12,  0,  0, 12,  0, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12,  0, 12, 12,  0,  0,  0, 12,  0,  0, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 133 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,
+     0,  0,  0,  0,  0,  0,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12,  0, 12, 12,  0,  0,  0,  0,  0, 12, 12, 12, 12, 12
+  },
+
+  /* block 134 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0, 12,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 135 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+     0,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 136 */
+  { 12, 10, 10, 10,  0, 10, 10,  0,  0,  0,  0,  0, 10, 82, 10, 87,
+    12, 12, 12, 12,  0, 12, 12, 12,  0, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12,  0,  0, 87, 34, 82,  0,  0,  0,  0, 38,
+    12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 137 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 87, 82,  0,  0,  0,  0, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 138 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12,  0,  0,  0, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12,  0,  0, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12,  0,  0,  0,  0,  0, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 139 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12,  0,  0,  0,  0,  0,  0,  0, 12, 12, 12, 12,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0, 12, 12, 12, 12, 12, 12, 12,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 140 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 141 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12,  0,  0,  0,  0,  0,  0,  0, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 142 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 87, 87, 87, 87,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 143 */
+  {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0
+  },
+
+  /* block 144 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0, 87, 87, 12,  0,  0,
+    12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 145 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 82, 82, 87, 87, 87, 82, 87, 82, 82, 82,
+    82, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 146 */
+  { 12, 12, 87, 82, 87, 82, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 147 */
+  { 17, 10, 17, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 38, 12, 12, 12, 12, 12, 12, 12,  0,  0,
+     0,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    38, 12, 12, 10, 10, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0, 38
+  },
+
+  /* block 148 */
+  { 10, 10, 17, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    17, 17, 17, 10, 10, 10, 10, 17, 17, 38, 36, 12, 12, 11, 12, 12,
+    12, 12, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 149 */
+  { 87, 87, 87, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 10, 10, 17, 10, 10, 10,
+    10, 10, 10, 38, 38,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 17, 17, 12,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 36, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 150 */
+  { 10, 10, 17, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 17, 17, 17, 10, 10, 10, 10, 10, 10, 10, 10, 10, 17,
+    39, 12, 15, 15, 12, 12, 12, 12, 12, 10, 36, 10, 10, 12, 17, 10,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+     0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 151 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 17, 17, 17, 10,
+    10, 10, 17, 17, 10, 39, 36, 10, 12, 12, 12, 12, 12, 12, 10,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 152 */
+  { 12, 12, 12, 12, 12, 12, 12,  0, 12,  0, 12, 12, 12, 12,  0, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
+    17, 17, 17, 10, 10, 10, 10, 10, 10, 36, 38,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 153 */
+  { 10, 10, 17, 17,  0, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0, 12,
+    12,  0,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12,  0, 12, 12, 12, 12, 12, 12,
+    12,  0, 12, 12,  0, 12, 12, 12, 12, 12,  0, 36, 36, 12, 13, 17,
+    10, 17, 17, 17, 17,  0,  0, 17, 17,  0,  0, 17, 17, 39,  0,  0,
+    12,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,  0,  0, 12, 12, 12,
+    12, 12, 17, 17,  0,  0, 87, 87, 87, 87, 87, 87, 87,  0,  0,  0,
+    87, 87, 87, 87, 87,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 154 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 17, 17, 17, 10, 10, 10, 10, 10, 10, 10, 10,
+    17, 17, 38, 10, 10, 17, 36, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0, 12, 87, 12,
+    12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 155 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    13, 17, 17, 10, 10, 10, 10, 10, 10, 17, 10, 17, 17, 13, 17, 10,
+    10, 17, 38, 36, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 156 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 13,
+    17, 17, 10, 10, 10, 10,  0,  0, 17, 17, 17, 17, 10, 10, 17, 38,
+    36, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 157 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    17, 17, 17, 10, 10, 10, 10, 10, 10, 10, 10, 17, 17, 10, 17, 38,
+    10, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 158 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 17, 10, 17, 17,
+    10, 10, 10, 10, 10, 10, 39, 36, 12, 12,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 159 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0, 10, 10, 10,
+    12, 12, 10, 10, 10, 10, 17, 10, 10, 10, 10, 38,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 160 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 17, 17, 17, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 17, 38, 36, 12,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 161 */
+  {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12
+  },
+
+  /* block 162 */
+  { 12, 12, 12, 12, 12, 12, 12,  0,  0, 12,  0,  0, 12, 12, 12, 12,
+    12, 12, 12, 12,  0, 12, 12,  0, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    13, 17, 17, 17, 17, 17,  0, 17, 17,  0,  0, 10, 10, 39, 38, 15,
+    17, 15, 17, 36, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 163 */
+  {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12,  0,  0, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 17, 17, 17, 10, 10, 10, 10,  0,  0, 10, 10, 17, 17, 17, 17,
+    38, 12, 12, 12, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 164 */
+  { 12, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 10, 38, 10, 10, 10, 10, 17, 15, 10, 10, 10, 10, 12,
+    12, 12, 12, 12, 12, 12, 12, 38,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 10, 10, 10, 10, 10, 10, 17, 17, 10, 10, 10, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 165 */
+  { 12, 12, 12, 12, 15, 15, 15, 15, 15, 15, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 17, 10, 38, 12, 12, 12, 12, 12, 12,
+    12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 166 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12,  0, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 17,
+    10, 10, 10, 10, 10, 10, 10,  0, 10, 10, 10, 10, 10, 10, 17, 38,
+    12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 167 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+     0,  0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10,  0, 17, 10, 10, 10, 10, 10, 10,
+    10, 17, 10, 10, 17, 10, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 168 */
+  { 12, 12, 12, 12, 12, 12, 12,  0, 12, 12,  0, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 10, 10, 10, 10, 10, 10,  0,  0,  0, 10,  0, 10, 10,  0, 10,
+    10, 10, 36, 10, 38, 38, 15, 10,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12,  0, 12, 12,  0, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 169 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 17, 17, 17, 17, 17,  0,
+    10, 10,  0, 17, 17, 10, 17, 38, 12,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 170 */
+  {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 10, 10, 17, 17, 12, 12,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 171 */
+  {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12
+  },
+
+  /* block 172 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 173 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,
+    12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 174 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 175 */
+  {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 176 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,
+     9,  9,  9,  9,  9,  9,  9,  9,  9,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 177 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 178 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 179 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,
+    34, 34, 34, 34, 34, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 180 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    87, 87, 87, 87, 87, 87, 87, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0, 12, 12, 12, 12, 12,
+    12, 12,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0, 12, 12, 12
+  },
+
+  /* block 181 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 182 */
+  {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 183 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 184 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0, 10,
+    12, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17
+  },
+
+  /* block 185 */
+  { 17, 17, 17, 17, 17, 17, 17, 17,  0,  0,  0,  0,  0,  0,  0, 10,
+    10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    22, 22, 22, 22, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    35, 35,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 186 */
+  { 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 187 */
+  { 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 188 */
+  { 22, 22, 22, 22, 22, 22, 22, 22, 22,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 189 */
+  {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    22, 22, 22, 22,  0, 22, 22, 22, 22, 22, 22, 22,  0, 22, 22,  0
+  },
+
+  /* block 190 */
+  { 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    22, 22, 22,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0, 22, 22, 22, 22,  0,  0,  0,  0,  0,  0,  0,  0,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22
+  },
+
+  /* block 191 */
+  { 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,  0,  0,  0,  0
+  },
+
+  /* block 192 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0
+  },
+
+  /* block 193 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0, 12, 10, 34, 12,
+     4,  4,  4,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 194 */
+  { 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,  0,  0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 195 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 196 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12,  0,  0, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 79, 80, 34, 34, 34, 12, 12, 12, 85, 79, 79,
+    79, 79, 79,  4,  4,  4,  4,  4,  4,  4,  4, 82, 82, 82, 82, 82
+  },
+
+  /* block 197 */
+  { 82, 82, 82, 12, 12, 87, 87, 87, 87, 87, 82, 82, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 87, 87, 87, 87, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 198 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 87, 87, 87, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 199 */
+  {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 200 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 201 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 202 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0, 12, 12,
+     0,  0, 12,  0,  0, 12, 12,  0,  0, 12, 12, 12, 12,  0, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0, 12,  0, 12, 12, 12,
+    12, 12, 12, 12,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 203 */
+  { 12, 12, 12, 12, 12, 12,  0, 12, 12, 12, 12,  0,  0, 12, 12, 12,
+    12, 12, 12, 12, 12,  0, 12, 12, 12, 12, 12, 12, 12,  0, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0, 12, 12, 12, 12,  0,
+    12, 12, 12, 12, 12,  0, 12,  0,  0,  0, 12, 12, 12, 12, 12, 12,
+    12,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 204 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12,  0,  0, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 205 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 206 */
+  { 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 12, 12, 12, 12, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 12, 12, 12,
+    12, 12, 12, 12, 12, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 207 */
+  { 12, 12, 12, 12, 10, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 10, 10, 10, 10, 10,
+     0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 208 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 209 */
+  { 87, 87, 87, 87, 87, 87, 87,  0, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87,  0,  0, 87, 87, 87, 87, 87,
+    87, 87,  0, 87, 87,  0, 87, 87, 87, 87, 87,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 210 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,
+    87, 87, 87, 87, 87, 87, 87, 12, 12, 12, 12, 12, 12, 12,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0, 12, 12,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 211 */
+  {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 87,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 87, 87, 87, 87,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0, 12
+  },
+
+  /* block 212 */
+  {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12,  0, 12, 12, 12, 12,  0, 12, 12,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0
+  },
+
+  /* block 213 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12,  0,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    82, 82, 82, 82, 82, 82, 82,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 214 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 87, 87, 87, 87, 87, 87, 36, 12,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0, 12, 12,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 215 */
+  {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 216 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 217 */
+  {  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 218 */
+  { 12, 12, 12, 12,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+     0, 12, 12,  0, 12,  0,  0, 12,  0, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12,  0, 12, 12, 12, 12,  0, 12,  0, 12,  0,  0,  0,  0,
+     0,  0, 12,  0,  0,  0,  0, 12,  0, 12,  0, 12,  0, 12, 12, 12,
+     0, 12, 12,  0, 12,  0,  0, 12,  0, 12,  0, 12,  0, 12,  0, 12,
+     0, 12, 12,  0, 12,  0,  0, 12, 12, 12, 12,  0, 12, 12, 12, 12,
+    12, 12, 12,  0, 12, 12, 12, 12,  0, 12, 12, 12, 12,  0, 12,  0
+  },
+
+  /* block 219 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,
+     0, 12, 12, 12,  0, 12, 12, 12, 12, 12,  0, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 220 */
+  { 14, 14, 14, 14, 28, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,  2,  2,  2,  2,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14
+  },
+
+  /* block 221 */
+  { 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,  2,
+     2, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+     2, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 28,
+     2, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2
+  },
+
+  /* block 222 */
+  { 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 12, 12, 14, 14, 14,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 12, 14,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 12, 12, 14, 14, 14, 14,
+    21, 21, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 21, 21
+  },
+
+  /* block 223 */
+  { 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 28, 20,
+    20, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 14,  2,  2,
+     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+     2,  2,  2,  2,  2,  2, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16
+  },
+
+  /* block 224 */
+  { 22, 28, 24,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 28, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 28,
+    22, 22, 28, 28, 28, 28, 28, 24, 28, 28, 28, 22,  2,  2,  2,  2,
+    22, 22, 22, 22, 22, 22, 22, 22, 22,  2,  2,  2,  2,  2,  2,  2,
+    28, 28,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+    24, 24, 24, 24, 24, 24,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2
+  },
+
+  /* block 225 */
+  {  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2
+  },
+
+  /* block 226 */
+  { 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 14, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 14, 28, 28
+  },
+
+  /* block 227 */
+  { 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 14, 14, 14, 14, 28,
+    28, 28, 28, 28, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 14, 14, 14, 28, 14, 14, 14, 28, 28, 28, 23, 23, 23, 23, 23
+  },
+
+  /* block 228 */
+  { 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 14,
+    28, 14, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28
+  },
+
+  /* block 229 */
+  { 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 14, 14, 28
+  },
+
+  /* block 230 */
+  { 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 12, 12,
+    12, 12, 12, 12, 12, 12, 14, 14, 14, 14, 14, 28, 28, 28, 28, 14,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 28, 14, 14, 14, 14, 14
+  },
+
+  /* block 231 */
+  { 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 28, 28, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 28, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 28, 28, 28, 28, 28
+  },
+
+  /* block 232 */
+  { 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 233 */
+  { 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 14, 14, 14, 14, 14, 14, 28, 14, 14, 14,
+    28, 28, 28, 14, 14, 28, 28, 28,  2,  2,  2,  2,  2, 28, 28, 28,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 28, 28,  2,  2,  2,
+    14, 14, 14, 14, 28, 28, 28, 28, 28, 28, 28, 28, 28,  2,  2,  2
+  },
+
+  /* block 234 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2
+  },
+
+  /* block 235 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 14, 14, 14, 14,  2,  2,  2,  2,  2,  2,  2,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,  2,  2,  2,  2,
+    28,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2
+  },
+
+  /* block 236 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  2,  2,  2,  2,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12,  2,  2,  2,  2,  2,  2,  2,  2,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  2,  2,  2,  2,  2,  2,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+  },
+
+  /* block 237 */
+  { 12, 12, 12, 12, 12, 12, 12, 12,  2,  2,  2,  2,  2,  2,  2,  2,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  2,  2,
+    14, 14,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2
+  },
+
+  /* block 238 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 12, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 12, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28
+  },
+
+  /* block 239 */
+  { 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    24, 24, 24, 24, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28
+  },
+
+  /* block 240 */
+  { 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,  2,  2,
+    28, 28, 28, 28, 28,  2,  2,  2, 28, 28, 28, 28, 28,  2,  2,  2
+  },
+
+  /* block 241 */
+  { 28, 28, 28, 28, 28, 28, 28,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,  2,  2,  2,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,  2,  2,  2,  2,  2,
+    28, 28, 28, 28, 28, 28,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28,  2,  2,  2,  2,  2,  2,
+    28, 28, 28, 28, 28, 28, 28, 28,  2,  2,  2,  2,  2,  2,  2,  2,
+    28, 28, 28, 28, 28, 28, 28,  2,  2,  2,  2,  2,  2,  2,  2,  2
+  },
+
+  /* block 242 */
+  { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12,  0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 243 */
+  {  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  0,  0
+  },
+
+  /* block 244 */
+  { 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 245 */
+  { 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22,  0,  0,  0,  0,  0,  0,  0,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22
+  },
+
+  /* block 246 */
+  { 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,  0,  0,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22
+  },
+
+  /* block 247 */
+  { 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22
+  },
+
+  /* block 248 */
+  { 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 249 */
+  { 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 250 */
+  { 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+  },
+
+  /* block 251 */
+  {  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+     4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5
+  },
+
+  /* block 252 */
+  {  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+     4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+     4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+     4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+     4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+     4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+     4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+     4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4
+  },
+
+  /* block 253 */
+  {  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5
+  },
+
+  /* block 254 */
+  {  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4
+  }
+};
+
+static inline int charprop(int32_t code)
+{
+	const int32_t block_size = 128;
+	uint8_t i = charprop_stage1[code / block_size];
+	return charprop_record[charprop_stage2[i][code % block_size]];
+}
+
+static inline int graph_break(int32_t code)
+{
+	return CHARPROP_GRAPH_BREAK(charprop(code));
+}
+
+static inline int charwidth(int32_t code)
+{
+	return CHARPROP_CHARWIDTH(charprop(code));
+}
+
+static inline uint8_t combining_class(int32_t code)
+{
+	return (uint8_t)CHARPROP_COMBINING_CLASS(charprop(code));
+}
+
+#endif /* UNICODE_CHARPROP_H */
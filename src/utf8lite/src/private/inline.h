@@ -0,0 +1,39 @@
+/*
+ * Copyright 2017 Patrick O. Perry.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTF8LITE_INLINE_H
+#define UTF8LITE_INLINE_H
+
+/**
+ * \file inline.h
+ *
+ * Forced inlining, for kernels that get specialized by calling them
+ * with constant arguments.
+ */
+
+/**
+ * Mark a static function for inlining at every call site, so that the
+ * compiler can fold the tests on its constant arguments.
+ */
+#if defined(__GNUC__)
+#  define UTF8LITE_ALWAYS_INLINE inline __attribute__((always_inline))
+#elif defined(_MSC_VER)
+#  define UTF8LITE_ALWAYS_INLINE __forceinline
+#else
+#  define UTF8LITE_ALWAYS_INLINE inline
+#endif
+
+#endif /* UTF8LITE_INLINE_H */
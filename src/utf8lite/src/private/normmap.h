@@ -0,0 +1,8594 @@
+/* This file is automatically generated. DO NOT EDIT!
+   Instead, edit gen-normmap.py and re-run.  */
+
+/*
+ * Fully expanded normalization mappings: the canonical or
+ * compatibility decomposition of each character, optionally
+ * followed by case folding, applied until nothing changes. This
+ * lets utf8lite_map() find the result with a single lookup.
+ *
+ * Hangul syllables are not in the table; decompose them
+ * algorithmically.
+ *
+ *
+ * We use a two-stage lookup strategy as described at
+ *
+ *     http://www.strchr.com/multi-stage_tables
+ *
+ */
+
+#ifndef UNICODE_NORMMAP_H
+#define UNICODE_NORMMAP_H
+
+#include <stdint.h>
+
+/* normmap_kind
+ * ------------
+ * index of the map in a table entry
+ */
+enum normmap_kind {
+	NORMMAP_NFD = 0,
+	NORMMAP_NFD_CASEFOLD = 1,
+	NORMMAP_NFKD = 2,
+	NORMMAP_NFKD_CASEFOLD = 3
+};
+
+/* normmap
+ * -------
+ * length: the length (in codepoints) of the mapping,
+ *         or 0 if the character maps to itself
+ *
+ * data:   the mapped-to codepoint (length = 1), or
+ *         an index into the `normmap_mapping` array, pointing
+ *         to the first codepoint in the mapping (length > 1)
+ */
+struct normmap {
+	unsigned length : 5;
+	unsigned data : 21;
+};
+
+#define NORMMAP_BLOCK_SIZE 64
+
+static const uint8_t normmap_stage1[] = {
+/* U+0000 */  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11,  0, 12, 13, 14,
+/* U+0400 */ 15, 16, 17, 18, 19, 20, 21,  0, 22, 23,  0, 24,  0,  0,  0,  0,
+/* U+0800 */  0,  0,  0,  0, 25, 26,  0, 27, 28, 29,  0,  0,  0, 30, 31, 32,
+/* U+0C00 */  0, 33,  0, 34,  0, 35,  0, 36, 37,  0, 38, 39, 40, 41, 42,  0,
+/* U+1000 */ 43,  0, 44, 45,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 46,
+/* U+1400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+1800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 47, 48,  0,  0,
+/* U+1C00 */  0,  0, 49,  0, 50, 51, 52,  0, 53, 54, 55, 56, 57, 58, 59, 60,
+/* U+2000 */ 61, 62, 63,  0, 64, 65, 66, 67, 68, 69, 70, 71, 72,  0,  0,  0,
+/* U+2400 */  0, 73, 74, 75,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+2800 */  0,  0,  0,  0,  0,  0,  0,  0, 76, 77,  0, 78,  0,  0,  0,  0,
+/* U+2C00 */ 79, 80, 81, 82,  0, 83,  0,  0,  0,  0, 84, 85, 86, 87, 88, 89,
+/* U+3000 */ 90, 91, 92, 93, 94, 95, 96,  0, 97, 98, 99,100,101,102,103,104,
+/* U+3400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+3800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+3C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+4000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+4400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+4800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+4C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+5000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+5400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+5800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+5C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+6000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+6400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+6800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+6C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+7000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+7400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+7800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+7C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+8000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+8400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+8800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+8C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+9000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+9400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+9800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+9C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,105,106,  0,107,108,109,110,
+/* U+A800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,111,112,  0,
+/* U+AC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+BC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+CC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+DC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+EC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F800 */  0,  0,  0,  0,113,114,115,116,117,118,119,120,121,122,123,124,
+/* U+FC00 */125,126,127,128,129,130,131,132,133,134,135,136,137,138,139,140,
+/* U+10000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+10400 */141,  0,142,143,  0,144,145,  0,  0,  0,  0,  0,  0,  0,146,  0,
+/* U+10800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+10C00 */  0,  0,147,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+11000 */  0,  0,148,  0,149,  0,  0,  0,  0,  0,  0,  0,  0,150,  0,  0,
+/* U+11400 */  0,  0,151,  0,  0,  0,152,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+11800 */  0,  0,153,  0,154,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+11C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+12000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+12400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+12800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+12C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+13000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+13400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+13800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+13C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+14000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+14400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+14800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+14C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+15000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+15400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+15800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+15C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+16000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+16400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+16800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+16C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,155,  0,  0,  0,  0,  0,  0,
+/* U+17000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+17400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+17800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+17C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+18000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+18400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+18800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+18C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+19000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+19400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+19800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+19C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+1A000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+1A400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+1A800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+1AC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+1B000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+1B400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+1B800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+1BC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+1C000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+1C400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+1C800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+1CC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+1D000 */  0,  0,  0,  0,  0,156,157,158,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+1D400 */159,160,161,162,163,164,165,166,167,168,169,170,171,172,173,174,
+/* U+1D800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+1DC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+1E000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+1E400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+1E800 */  0,  0,  0,  0,175,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+1EC00 */  0,  0,  0,  0,  0,  0,  0,  0,176,177,178,  0,  0,  0,  0,  0,
+/* U+1F000 */  0,  0,  0,  0,179,180,181,  0,182,183,  0,  0,  0,  0,  0,  0,
+/* U+1F400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+1F800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,184,
+/* U+1FC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+20000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+20400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+20800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+20C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+21000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+21400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+21800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+21C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+22000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+22400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+22800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+22C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+23000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+23400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+23800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+23C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+24000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+24400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+24800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+24C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+25000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+25400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+25800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+25C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+26000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+26400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+26800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+26C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+27000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+27400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+27800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+27C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+28000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+28400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+28800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+28C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+29000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+29400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+29800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+29C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+2A000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+2A400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+2A800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+2AC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+2B000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+2B400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+2B800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+2BC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+2C000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+2C400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+2C800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+2CC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+2D000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+2D400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+2D800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+2DC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+2E000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+2E400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+2E800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+2EC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+2F000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+2F400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+2F800 */185,186,187,188,189,190,191,192,193,  0,  0,  0,  0,  0,  0,  0,
+/* U+2FC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+30000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+30400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+30800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+30C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+31000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+31400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+31800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+31C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+32000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+32400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+32800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+32C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+33000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+33400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+33800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+33C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+34000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+34400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+34800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+34C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+35000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+35400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+35800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+35C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+36000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+36400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+36800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+36C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+37000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+37400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+37800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+37C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+38000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+38400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+38800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+38C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+39000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+39400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+39800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+39C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+3A000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+3A400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+3A800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+3AC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+3B000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+3B400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+3B800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+3BC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+3C000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+3C400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+3C800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+3CC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+3D000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+3D400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+3D800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+3DC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+3E000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+3E400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+3E800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+3EC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+3F000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+3F400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+3F800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+3FC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+40000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+40400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+40800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+40C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+41000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+41400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+41800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+41C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+42000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+42400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+42800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+42C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+43000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+43400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+43800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+43C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+44000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+44400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+44800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+44C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+45000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+45400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+45800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+45C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+46000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+46400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+46800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+46C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+47000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+47400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+47800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+47C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+48000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+48400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+48800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+48C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+49000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+49400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+49800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+49C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+4A000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+4A400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+4A800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+4AC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+4B000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+4B400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+4B800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+4BC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+4C000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+4C400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+4C800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+4CC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+4D000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+4D400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+4D800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+4DC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+4E000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+4E400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+4E800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+4EC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+4F000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+4F400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+4F800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+4FC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+50000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+50400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+50800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+50C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+51000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+51400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+51800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+51C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+52000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+52400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+52800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+52C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+53000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+53400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+53800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+53C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+54000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+54400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+54800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+54C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+55000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+55400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+55800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+55C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+56000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+56400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+56800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+56C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+57000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+57400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+57800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+57C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+58000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+58400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+58800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+58C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+59000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+59400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+59800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+59C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+5A000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+5A400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+5A800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+5AC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+5B000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+5B400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+5B800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+5BC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+5C000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+5C400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+5C800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+5CC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+5D000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+5D400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+5D800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+5DC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+5E000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+5E400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+5E800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+5EC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+5F000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+5F400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+5F800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+5FC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+60000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+60400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+60800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+60C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+61000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+61400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+61800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+61C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+62000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+62400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+62800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+62C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+63000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+63400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+63800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+63C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+64000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+64400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+64800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+64C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+65000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+65400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+65800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+65C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+66000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+66400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+66800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+66C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+67000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+67400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+67800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+67C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+68000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+68400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+68800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+68C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+69000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+69400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+69800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+69C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+6A000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+6A400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+6A800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+6AC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+6B000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+6B400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+6B800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+6BC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+6C000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+6C400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+6C800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+6CC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+6D000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+6D400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+6D800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+6DC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+6E000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+6E400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+6E800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+6EC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+6F000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+6F400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+6F800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+6FC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+70000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+70400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+70800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+70C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+71000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+71400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+71800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+71C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+72000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+72400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+72800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+72C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+73000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+73400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+73800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+73C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+74000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+74400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+74800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+74C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+75000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+75400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+75800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+75C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+76000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+76400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+76800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+76C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+77000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+77400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+77800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+77C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+78000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+78400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+78800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+78C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+79000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+79400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+79800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+79C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+7A000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+7A400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+7A800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+7AC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+7B000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+7B400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+7B800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+7BC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+7C000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+7C400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+7C800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+7CC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+7D000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+7D400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+7D800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+7DC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+7E000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+7E400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+7E800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+7EC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+7F000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+7F400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+7F800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+7FC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+80000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+80400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+80800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+80C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+81000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+81400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+81800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+81C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+82000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+82400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+82800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+82C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+83000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+83400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+83800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+83C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+84000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+84400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+84800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+84C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+85000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+85400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+85800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+85C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+86000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+86400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+86800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+86C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+87000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+87400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+87800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+87C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+88000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+88400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+88800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+88C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+89000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+89400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+89800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+89C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+8A000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+8A400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+8A800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+8AC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+8B000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+8B400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+8B800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+8BC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+8C000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+8C400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+8C800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+8CC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+8D000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+8D400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+8D800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+8DC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+8E000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+8E400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+8E800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+8EC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+8F000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+8F400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+8F800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+8FC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+90000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+90400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+90800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+90C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+91000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+91400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+91800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+91C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+92000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+92400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+92800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+92C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+93000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+93400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+93800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+93C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+94000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+94400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+94800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+94C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+95000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+95400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+95800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+95C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+96000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+96400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+96800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+96C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+97000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+97400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+97800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+97C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+98000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+98400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+98800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+98C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+99000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+99400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+99800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+99C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+9A000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+9A400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+9A800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+9AC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+9B000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+9B400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+9B800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+9BC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+9C000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+9C400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+9C800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+9CC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+9D000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+9D400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+9D800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+9DC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+9E000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+9E400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+9E800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+9EC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+9F000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+9F400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+9F800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+9FC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A0000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A0400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A0800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A0C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A1000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A1400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A1800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A1C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A2000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A2400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A2800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A2C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A3000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A3400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A3800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A3C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A4000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A4400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A4800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A4C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A5000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A5400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A5800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A5C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A6000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A6400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A6800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A6C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A7000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A7400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A7800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A7C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A8000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A8400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A8800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A8C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A9000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A9400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A9800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+A9C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+AA000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+AA400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+AA800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+AAC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+AB000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+AB400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+AB800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+ABC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+AC000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+AC400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+AC800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+ACC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+AD000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+AD400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+AD800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+ADC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+AE000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+AE400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+AE800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+AEC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+AF000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+AF400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+AF800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+AFC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B0000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B0400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B0800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B0C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B1000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B1400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B1800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B1C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B2000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B2400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B2800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B2C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B3000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B3400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B3800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B3C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B4000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B4400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B4800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B4C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B5000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B5400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B5800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B5C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B6000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B6400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B6800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B6C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B7000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B7400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B7800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B7C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B8000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B8400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B8800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B8C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B9000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B9400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B9800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+B9C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+BA000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+BA400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+BA800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+BAC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+BB000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+BB400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+BB800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+BBC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+BC000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+BC400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+BC800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+BCC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+BD000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+BD400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+BD800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+BDC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+BE000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+BE400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+BE800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+BEC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+BF000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+BF400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+BF800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+BFC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C0000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C0400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C0800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C0C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C1000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C1400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C1800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C1C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C2000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C2400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C2800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C2C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C3000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C3400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C3800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C3C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C4000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C4400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C4800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C4C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C5000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C5400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C5800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C5C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C6000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C6400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C6800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C6C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C7000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C7400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C7800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C7C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C8000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C8400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C8800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C8C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C9000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C9400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C9800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+C9C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+CA000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+CA400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+CA800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+CAC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+CB000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+CB400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+CB800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+CBC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+CC000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+CC400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+CC800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+CCC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+CD000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+CD400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+CD800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+CDC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+CE000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+CE400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+CE800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+CEC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+CF000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+CF400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+CF800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+CFC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D0000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D0400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D0800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D0C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D1000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D1400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D1800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D1C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D2000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D2400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D2800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D2C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D3000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D3400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D3800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D3C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D4000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D4400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D4800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D4C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D5000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D5400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D5800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D5C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D6000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D6400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D6800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D6C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D7000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D7400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D7800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D7C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D8000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D8400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D8800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D8C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D9000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D9400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D9800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+D9C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+DA000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+DA400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+DA800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+DAC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+DB000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+DB400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+DB800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+DBC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+DC000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+DC400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+DC800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+DCC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+DD000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+DD400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+DD800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+DDC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+DE000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+DE400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+DE800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+DEC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+DF000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+DF400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+DF800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+DFC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E0000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E0400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E0800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E0C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E1000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E1400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E1800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E1C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E2000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E2400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E2800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E2C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E3000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E3400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E3800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E3C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E4000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E4400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E4800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E4C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E5000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E5400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E5800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E5C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E6000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E6400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E6800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E6C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E7000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E7400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E7800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E7C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E8000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E8400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E8800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E8C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E9000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E9400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E9800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+E9C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+EA000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+EA400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+EA800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+EAC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+EB000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+EB400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+EB800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+EBC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+EC000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+EC400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+EC800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+ECC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+ED000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+ED400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+ED800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+EDC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+EE000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+EE400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+EE800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+EEC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+EF000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+EF400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+EF800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+EFC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F0000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F0400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F0800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F0C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F1000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F1400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F1800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F1C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F2000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F2400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F2800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F2C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F3000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F3400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F3800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F3C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F4000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F4400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F4800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F4C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F5000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F5400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F5800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F5C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F6000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F6400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F6800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F6C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F7000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F7400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F7800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F7C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F8000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F8400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F8800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F8C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F9000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F9400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F9800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+F9C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+FA000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+FA400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+FA800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+FAC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+FB000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+FB400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+FB800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+FBC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+FC000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+FC400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+FC800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+FCC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+FD000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+FD400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+FD800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+FDC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+FE000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+FE400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+FE800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+FEC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+FF000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+FF400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+FF800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+FFC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+100000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+100400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+100800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+100C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+101000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+101400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+101800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+101C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+102000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+102400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+102800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+102C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+103000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+103400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+103800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+103C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+104000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+104400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+104800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+104C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+105000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+105400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+105800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+105C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+106000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+106400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+106800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+106C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+107000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+107400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+107800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+107C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+108000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+108400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+108800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+108C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+109000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+109400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+109800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+109C00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+10A000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+10A400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+10A800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+10AC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+10B000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+10B400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+10B800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+10BC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+10C000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+10C400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+10C800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+10CC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+10D000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+10D400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+10D800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+10DC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+10E000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+10E400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+10E800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+10EC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+10F000 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+10F400 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+10F800 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* U+10FC00 */  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+};
+
+static const struct normmap normmap_stage2[][64][4] = {
+  /* block 0 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 1 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x00061},{0,0x00000},{1,0x00061}},
+   {{0,0x00000},{1,0x00062},{0,0x00000},{1,0x00062}},{{0,0x00000},{1,0x00063},{0,0x00000},{1,0x00063}},
+   {{0,0x00000},{1,0x00064},{0,0x00000},{1,0x00064}},{{0,0x00000},{1,0x00065},{0,0x00000},{1,0x00065}},
+   {{0,0x00000},{1,0x00066},{0,0x00000},{1,0x00066}},{{0,0x00000},{1,0x00067},{0,0x00000},{1,0x00067}},
+   {{0,0x00000},{1,0x00068},{0,0x00000},{1,0x00068}},{{0,0x00000},{1,0x00069},{0,0x00000},{1,0x00069}},
+   {{0,0x00000},{1,0x0006A},{0,0x00000},{1,0x0006A}},{{0,0x00000},{1,0x0006B},{0,0x00000},{1,0x0006B}},
+   {{0,0x00000},{1,0x0006C},{0,0x00000},{1,0x0006C}},{{0,0x00000},{1,0x0006D},{0,0x00000},{1,0x0006D}},
+   {{0,0x00000},{1,0x0006E},{0,0x00000},{1,0x0006E}},{{0,0x00000},{1,0x0006F},{0,0x00000},{1,0x0006F}},
+   {{0,0x00000},{1,0x00070},{0,0x00000},{1,0x00070}},{{0,0x00000},{1,0x00071},{0,0x00000},{1,0x00071}},
+   {{0,0x00000},{1,0x00072},{0,0x00000},{1,0x00072}},{{0,0x00000},{1,0x00073},{0,0x00000},{1,0x00073}},
+   {{0,0x00000},{1,0x00074},{0,0x00000},{1,0x00074}},{{0,0x00000},{1,0x00075},{0,0x00000},{1,0x00075}},
+   {{0,0x00000},{1,0x00076},{0,0x00000},{1,0x00076}},{{0,0x00000},{1,0x00077},{0,0x00000},{1,0x00077}},
+   {{0,0x00000},{1,0x00078},{0,0x00000},{1,0x00078}},{{0,0x00000},{1,0x00079},{0,0x00000},{1,0x00079}},
+   {{0,0x00000},{1,0x0007A},{0,0x00000},{1,0x0007A}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 2 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x00020},{1,0x00020}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{2,0x00000},{2,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x00061},{1,0x00061}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{2,0x00002},{2,0x00002}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x00032},{1,0x00032}},{{0,0x00000},{0,0x00000},{1,0x00033},{1,0x00033}},
+   {{0,0x00000},{0,0x00000},{2,0x00004},{2,0x00004}},{{0,0x00000},{1,0x003BC},{1,0x003BC},{1,0x003BC}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{2,0x00006},{2,0x00006}},{{0,0x00000},{0,0x00000},{1,0x00031},{1,0x00031}},
+   {{0,0x00000},{0,0x00000},{1,0x0006F},{1,0x0006F}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{3,0x00008},{3,0x00008}},{{0,0x00000},{0,0x00000},{3,0x0000B},{3,0x0000B}},
+   {{0,0x00000},{0,0x00000},{3,0x0000E},{3,0x0000E}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 3 */
+  {{{2,0x00011},{2,0x00013},{2,0x00011},{2,0x00013}},{{2,0x00015},{2,0x00017},{2,0x00015},{2,0x00017}},
+   {{2,0x00019},{2,0x0001B},{2,0x00019},{2,0x0001B}},{{2,0x0001D},{2,0x0001F},{2,0x0001D},{2,0x0001F}},
+   {{2,0x00021},{2,0x00023},{2,0x00021},{2,0x00023}},{{2,0x00025},{2,0x00027},{2,0x00025},{2,0x00027}},
+   {{0,0x00000},{1,0x000E6},{0,0x00000},{1,0x000E6}},{{2,0x00029},{2,0x0002B},{2,0x00029},{2,0x0002B}},
+   {{2,0x0002D},{2,0x0002F},{2,0x0002D},{2,0x0002F}},{{2,0x00031},{2,0x00033},{2,0x00031},{2,0x00033}},
+   {{2,0x00035},{2,0x00037},{2,0x00035},{2,0x00037}},{{2,0x00039},{2,0x0003B},{2,0x00039},{2,0x0003B}},
+   {{2,0x0003D},{2,0x0003F},{2,0x0003D},{2,0x0003F}},{{2,0x00041},{2,0x00043},{2,0x00041},{2,0x00043}},
+   {{2,0x00045},{2,0x00047},{2,0x00045},{2,0x00047}},{{2,0x00049},{2,0x0004B},{2,0x00049},{2,0x0004B}},
+   {{0,0x00000},{1,0x000F0},{0,0x00000},{1,0x000F0}},{{2,0x0004D},{2,0x0004F},{2,0x0004D},{2,0x0004F}},
+   {{2,0x00051},{2,0x00053},{2,0x00051},{2,0x00053}},{{2,0x00055},{2,0x00057},{2,0x00055},{2,0x00057}},
+   {{2,0x00059},{2,0x0005B},{2,0x00059},{2,0x0005B}},{{2,0x0005D},{2,0x0005F},{2,0x0005D},{2,0x0005F}},
+   {{2,0x00061},{2,0x00063},{2,0x00061},{2,0x00063}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x000F8},{0,0x00000},{1,0x000F8}},{{2,0x00065},{2,0x00067},{2,0x00065},{2,0x00067}},
+   {{2,0x00069},{2,0x0006B},{2,0x00069},{2,0x0006B}},{{2,0x0006D},{2,0x0006F},{2,0x0006D},{2,0x0006F}},
+   {{2,0x00071},{2,0x00073},{2,0x00071},{2,0x00073}},{{2,0x00075},{2,0x00077},{2,0x00075},{2,0x00077}},
+   {{0,0x00000},{1,0x000FE},{0,0x00000},{1,0x000FE}},{{0,0x00000},{2,0x00079},{0,0x00000},{2,0x00079}},
+   {{2,0x00013},{2,0x00013},{2,0x00013},{2,0x00013}},{{2,0x00017},{2,0x00017},{2,0x00017},{2,0x00017}},
+   {{2,0x0001B},{2,0x0001B},{2,0x0001B},{2,0x0001B}},{{2,0x0001F},{2,0x0001F},{2,0x0001F},{2,0x0001F}},
+   {{2,0x00023},{2,0x00023},{2,0x00023},{2,0x00023}},{{2,0x00027},{2,0x00027},{2,0x00027},{2,0x00027}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x0002B},{2,0x0002B},{2,0x0002B},{2,0x0002B}},
+   {{2,0x0002F},{2,0x0002F},{2,0x0002F},{2,0x0002F}},{{2,0x00033},{2,0x00033},{2,0x00033},{2,0x00033}},
+   {{2,0x00037},{2,0x00037},{2,0x00037},{2,0x00037}},{{2,0x0003B},{2,0x0003B},{2,0x0003B},{2,0x0003B}},
+   {{2,0x0003F},{2,0x0003F},{2,0x0003F},{2,0x0003F}},{{2,0x00043},{2,0x00043},{2,0x00043},{2,0x00043}},
+   {{2,0x00047},{2,0x00047},{2,0x00047},{2,0x00047}},{{2,0x0004B},{2,0x0004B},{2,0x0004B},{2,0x0004B}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x0004F},{2,0x0004F},{2,0x0004F},{2,0x0004F}},
+   {{2,0x00053},{2,0x00053},{2,0x00053},{2,0x00053}},{{2,0x00057},{2,0x00057},{2,0x00057},{2,0x00057}},
+   {{2,0x0005B},{2,0x0005B},{2,0x0005B},{2,0x0005B}},{{2,0x0005F},{2,0x0005F},{2,0x0005F},{2,0x0005F}},
+   {{2,0x00063},{2,0x00063},{2,0x00063},{2,0x00063}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x00067},{2,0x00067},{2,0x00067},{2,0x00067}},
+   {{2,0x0006B},{2,0x0006B},{2,0x0006B},{2,0x0006B}},{{2,0x0006F},{2,0x0006F},{2,0x0006F},{2,0x0006F}},
+   {{2,0x00073},{2,0x00073},{2,0x00073},{2,0x00073}},{{2,0x00077},{2,0x00077},{2,0x00077},{2,0x00077}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x0007B},{2,0x0007B},{2,0x0007B},{2,0x0007B}}
+  },
+
+  /* block 4 */
+  {{{2,0x0007D},{2,0x0007F},{2,0x0007D},{2,0x0007F}},{{2,0x0007F},{2,0x0007F},{2,0x0007F},{2,0x0007F}},
+   {{2,0x00081},{2,0x00083},{2,0x00081},{2,0x00083}},{{2,0x00083},{2,0x00083},{2,0x00083},{2,0x00083}},
+   {{2,0x00085},{2,0x00087},{2,0x00085},{2,0x00087}},{{2,0x00087},{2,0x00087},{2,0x00087},{2,0x00087}},
+   {{2,0x00089},{2,0x0008B},{2,0x00089},{2,0x0008B}},{{2,0x0008B},{2,0x0008B},{2,0x0008B},{2,0x0008B}},
+   {{2,0x0008D},{2,0x0008F},{2,0x0008D},{2,0x0008F}},{{2,0x0008F},{2,0x0008F},{2,0x0008F},{2,0x0008F}},
+   {{2,0x00091},{2,0x00093},{2,0x00091},{2,0x00093}},{{2,0x00093},{2,0x00093},{2,0x00093},{2,0x00093}},
+   {{2,0x00095},{2,0x00097},{2,0x00095},{2,0x00097}},{{2,0x00097},{2,0x00097},{2,0x00097},{2,0x00097}},
+   {{2,0x00099},{2,0x0009B},{2,0x00099},{2,0x0009B}},{{2,0x0009B},{2,0x0009B},{2,0x0009B},{2,0x0009B}},
+   {{0,0x00000},{1,0x00111},{0,0x00000},{1,0x00111}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x0009D},{2,0x0009F},{2,0x0009D},{2,0x0009F}},{{2,0x0009F},{2,0x0009F},{2,0x0009F},{2,0x0009F}},
+   {{2,0x000A1},{2,0x000A3},{2,0x000A1},{2,0x000A3}},{{2,0x000A3},{2,0x000A3},{2,0x000A3},{2,0x000A3}},
+   {{2,0x000A5},{2,0x000A7},{2,0x000A5},{2,0x000A7}},{{2,0x000A7},{2,0x000A7},{2,0x000A7},{2,0x000A7}},
+   {{2,0x000A9},{2,0x000AB},{2,0x000A9},{2,0x000AB}},{{2,0x000AB},{2,0x000AB},{2,0x000AB},{2,0x000AB}},
+   {{2,0x000AD},{2,0x000AF},{2,0x000AD},{2,0x000AF}},{{2,0x000AF},{2,0x000AF},{2,0x000AF},{2,0x000AF}},
+   {{2,0x000B1},{2,0x000B3},{2,0x000B1},{2,0x000B3}},{{2,0x000B3},{2,0x000B3},{2,0x000B3},{2,0x000B3}},
+   {{2,0x000B5},{2,0x000B7},{2,0x000B5},{2,0x000B7}},{{2,0x000B7},{2,0x000B7},{2,0x000B7},{2,0x000B7}},
+   {{2,0x000B9},{2,0x000BB},{2,0x000B9},{2,0x000BB}},{{2,0x000BB},{2,0x000BB},{2,0x000BB},{2,0x000BB}},
+   {{2,0x000BD},{2,0x000BF},{2,0x000BD},{2,0x000BF}},{{2,0x000BF},{2,0x000BF},{2,0x000BF},{2,0x000BF}},
+   {{2,0x000C1},{2,0x000C3},{2,0x000C1},{2,0x000C3}},{{2,0x000C3},{2,0x000C3},{2,0x000C3},{2,0x000C3}},
+   {{0,0x00000},{1,0x00127},{0,0x00000},{1,0x00127}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x000C5},{2,0x000C7},{2,0x000C5},{2,0x000C7}},{{2,0x000C7},{2,0x000C7},{2,0x000C7},{2,0x000C7}},
+   {{2,0x000C9},{2,0x000CB},{2,0x000C9},{2,0x000CB}},{{2,0x000CB},{2,0x000CB},{2,0x000CB},{2,0x000CB}},
+   {{2,0x000CD},{2,0x000CF},{2,0x000CD},{2,0x000CF}},{{2,0x000CF},{2,0x000CF},{2,0x000CF},{2,0x000CF}},
+   {{2,0x000D1},{2,0x000D3},{2,0x000D1},{2,0x000D3}},{{2,0x000D3},{2,0x000D3},{2,0x000D3},{2,0x000D3}},
+   {{2,0x000D5},{2,0x000D7},{2,0x000D5},{2,0x000D7}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00133},{2,0x000D9},{2,0x000DB}},{{0,0x00000},{0,0x00000},{2,0x000DB},{2,0x000DB}},
+   {{2,0x000DD},{2,0x000DF},{2,0x000DD},{2,0x000DF}},{{2,0x000DF},{2,0x000DF},{2,0x000DF},{2,0x000DF}},
+   {{2,0x000E1},{2,0x000E3},{2,0x000E1},{2,0x000E3}},{{2,0x000E3},{2,0x000E3},{2,0x000E3},{2,0x000E3}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x000E5},{2,0x000E7},{2,0x000E5},{2,0x000E7}},
+   {{2,0x000E7},{2,0x000E7},{2,0x000E7},{2,0x000E7}},{{2,0x000E9},{2,0x000EB},{2,0x000E9},{2,0x000EB}},
+   {{2,0x000EB},{2,0x000EB},{2,0x000EB},{2,0x000EB}},{{2,0x000ED},{2,0x000EF},{2,0x000ED},{2,0x000EF}},
+   {{2,0x000EF},{2,0x000EF},{2,0x000EF},{2,0x000EF}},{{0,0x00000},{1,0x00140},{2,0x000F1},{2,0x000F3}}
+  },
+
+  /* block 5 */
+  {{{0,0x00000},{0,0x00000},{2,0x000F3},{2,0x000F3}},{{0,0x00000},{1,0x00142},{0,0x00000},{1,0x00142}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x000F5},{2,0x000F7},{2,0x000F5},{2,0x000F7}},
+   {{2,0x000F7},{2,0x000F7},{2,0x000F7},{2,0x000F7}},{{2,0x000F9},{2,0x000FB},{2,0x000F9},{2,0x000FB}},
+   {{2,0x000FB},{2,0x000FB},{2,0x000FB},{2,0x000FB}},{{2,0x000FD},{2,0x000FF},{2,0x000FD},{2,0x000FF}},
+   {{2,0x000FF},{2,0x000FF},{2,0x000FF},{2,0x000FF}},{{0,0x00000},{2,0x00101},{2,0x00101},{2,0x00101}},
+   {{0,0x00000},{1,0x0014B},{0,0x00000},{1,0x0014B}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00103},{2,0x00105},{2,0x00103},{2,0x00105}},{{2,0x00105},{2,0x00105},{2,0x00105},{2,0x00105}},
+   {{2,0x00107},{2,0x00109},{2,0x00107},{2,0x00109}},{{2,0x00109},{2,0x00109},{2,0x00109},{2,0x00109}},
+   {{2,0x0010B},{2,0x0010D},{2,0x0010B},{2,0x0010D}},{{2,0x0010D},{2,0x0010D},{2,0x0010D},{2,0x0010D}},
+   {{0,0x00000},{1,0x00153},{0,0x00000},{1,0x00153}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x0010F},{2,0x00111},{2,0x0010F},{2,0x00111}},{{2,0x00111},{2,0x00111},{2,0x00111},{2,0x00111}},
+   {{2,0x00113},{2,0x00115},{2,0x00113},{2,0x00115}},{{2,0x00115},{2,0x00115},{2,0x00115},{2,0x00115}},
+   {{2,0x00117},{2,0x00119},{2,0x00117},{2,0x00119}},{{2,0x00119},{2,0x00119},{2,0x00119},{2,0x00119}},
+   {{2,0x0011B},{2,0x0011D},{2,0x0011B},{2,0x0011D}},{{2,0x0011D},{2,0x0011D},{2,0x0011D},{2,0x0011D}},
+   {{2,0x0011F},{2,0x00121},{2,0x0011F},{2,0x00121}},{{2,0x00121},{2,0x00121},{2,0x00121},{2,0x00121}},
+   {{2,0x00123},{2,0x00125},{2,0x00123},{2,0x00125}},{{2,0x00125},{2,0x00125},{2,0x00125},{2,0x00125}},
+   {{2,0x00127},{2,0x00129},{2,0x00127},{2,0x00129}},{{2,0x00129},{2,0x00129},{2,0x00129},{2,0x00129}},
+   {{2,0x0012B},{2,0x0012D},{2,0x0012B},{2,0x0012D}},{{2,0x0012D},{2,0x0012D},{2,0x0012D},{2,0x0012D}},
+   {{2,0x0012F},{2,0x00131},{2,0x0012F},{2,0x00131}},{{2,0x00131},{2,0x00131},{2,0x00131},{2,0x00131}},
+   {{0,0x00000},{1,0x00167},{0,0x00000},{1,0x00167}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00133},{2,0x00135},{2,0x00133},{2,0x00135}},{{2,0x00135},{2,0x00135},{2,0x00135},{2,0x00135}},
+   {{2,0x00137},{2,0x00139},{2,0x00137},{2,0x00139}},{{2,0x00139},{2,0x00139},{2,0x00139},{2,0x00139}},
+   {{2,0x0013B},{2,0x0013D},{2,0x0013B},{2,0x0013D}},{{2,0x0013D},{2,0x0013D},{2,0x0013D},{2,0x0013D}},
+   {{2,0x0013F},{2,0x00141},{2,0x0013F},{2,0x00141}},{{2,0x00141},{2,0x00141},{2,0x00141},{2,0x00141}},
+   {{2,0x00143},{2,0x00145},{2,0x00143},{2,0x00145}},{{2,0x00145},{2,0x00145},{2,0x00145},{2,0x00145}},
+   {{2,0x00147},{2,0x00149},{2,0x00147},{2,0x00149}},{{2,0x00149},{2,0x00149},{2,0x00149},{2,0x00149}},
+   {{2,0x0014B},{2,0x0014D},{2,0x0014B},{2,0x0014D}},{{2,0x0014D},{2,0x0014D},{2,0x0014D},{2,0x0014D}},
+   {{2,0x0014F},{2,0x00151},{2,0x0014F},{2,0x00151}},{{2,0x00151},{2,0x00151},{2,0x00151},{2,0x00151}},
+   {{2,0x00153},{2,0x0007B},{2,0x00153},{2,0x0007B}},{{2,0x00155},{2,0x00157},{2,0x00155},{2,0x00157}},
+   {{2,0x00157},{2,0x00157},{2,0x00157},{2,0x00157}},{{2,0x00159},{2,0x0015B},{2,0x00159},{2,0x0015B}},
+   {{2,0x0015B},{2,0x0015B},{2,0x0015B},{2,0x0015B}},{{2,0x0015D},{2,0x0015F},{2,0x0015D},{2,0x0015F}},
+   {{2,0x0015F},{2,0x0015F},{2,0x0015F},{2,0x0015F}},{{0,0x00000},{1,0x00073},{1,0x00073},{1,0x00073}}
+  },
+
+  /* block 6 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x00253},{0,0x00000},{1,0x00253}},
+   {{0,0x00000},{1,0x00183},{0,0x00000},{1,0x00183}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00185},{0,0x00000},{1,0x00185}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00254},{0,0x00000},{1,0x00254}},{{0,0x00000},{1,0x00188},{0,0x00000},{1,0x00188}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x00256},{0,0x00000},{1,0x00256}},
+   {{0,0x00000},{1,0x00257},{0,0x00000},{1,0x00257}},{{0,0x00000},{1,0x0018C},{0,0x00000},{1,0x0018C}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x001DD},{0,0x00000},{1,0x001DD}},{{0,0x00000},{1,0x00259},{0,0x00000},{1,0x00259}},
+   {{0,0x00000},{1,0x0025B},{0,0x00000},{1,0x0025B}},{{0,0x00000},{1,0x00192},{0,0x00000},{1,0x00192}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x00260},{0,0x00000},{1,0x00260}},
+   {{0,0x00000},{1,0x00263},{0,0x00000},{1,0x00263}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00269},{0,0x00000},{1,0x00269}},{{0,0x00000},{1,0x00268},{0,0x00000},{1,0x00268}},
+   {{0,0x00000},{1,0x00199},{0,0x00000},{1,0x00199}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0026F},{0,0x00000},{1,0x0026F}},{{0,0x00000},{1,0x00272},{0,0x00000},{1,0x00272}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x00275},{0,0x00000},{1,0x00275}},
+   {{2,0x00161},{2,0x00163},{2,0x00161},{2,0x00163}},{{2,0x00163},{2,0x00163},{2,0x00163},{2,0x00163}},
+   {{0,0x00000},{1,0x001A3},{0,0x00000},{1,0x001A3}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x001A5},{0,0x00000},{1,0x001A5}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00280},{0,0x00000},{1,0x00280}},{{0,0x00000},{1,0x001A8},{0,0x00000},{1,0x001A8}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x00283},{0,0x00000},{1,0x00283}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x001AD},{0,0x00000},{1,0x001AD}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00288},{0,0x00000},{1,0x00288}},{{2,0x00165},{2,0x00167},{2,0x00165},{2,0x00167}},
+   {{2,0x00167},{2,0x00167},{2,0x00167},{2,0x00167}},{{0,0x00000},{1,0x0028A},{0,0x00000},{1,0x0028A}},
+   {{0,0x00000},{1,0x0028B},{0,0x00000},{1,0x0028B}},{{0,0x00000},{1,0x001B4},{0,0x00000},{1,0x001B4}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x001B6},{0,0x00000},{1,0x001B6}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x00292},{0,0x00000},{1,0x00292}},
+   {{0,0x00000},{1,0x001B9},{0,0x00000},{1,0x001B9}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x001BD},{0,0x00000},{1,0x001BD}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 7 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x001C6},{3,0x00169},{3,0x0016C}},{{0,0x00000},{1,0x001C6},{3,0x0016F},{3,0x0016C}},
+   {{0,0x00000},{0,0x00000},{3,0x0016C},{3,0x0016C}},{{0,0x00000},{1,0x001C9},{2,0x00172},{2,0x00174}},
+   {{0,0x00000},{1,0x001C9},{2,0x00176},{2,0x00174}},{{0,0x00000},{0,0x00000},{2,0x00174},{2,0x00174}},
+   {{0,0x00000},{1,0x001CC},{2,0x00178},{2,0x0017A}},{{0,0x00000},{1,0x001CC},{2,0x0017C},{2,0x0017A}},
+   {{0,0x00000},{0,0x00000},{2,0x0017A},{2,0x0017A}},{{2,0x0017E},{2,0x00180},{2,0x0017E},{2,0x00180}},
+   {{2,0x00180},{2,0x00180},{2,0x00180},{2,0x00180}},{{2,0x00182},{2,0x00184},{2,0x00182},{2,0x00184}},
+   {{2,0x00184},{2,0x00184},{2,0x00184},{2,0x00184}},{{2,0x00186},{2,0x00188},{2,0x00186},{2,0x00188}},
+   {{2,0x00188},{2,0x00188},{2,0x00188},{2,0x00188}},{{2,0x0018A},{2,0x0018C},{2,0x0018A},{2,0x0018C}},
+   {{2,0x0018C},{2,0x0018C},{2,0x0018C},{2,0x0018C}},{{3,0x0018E},{3,0x00191},{3,0x0018E},{3,0x00191}},
+   {{3,0x00191},{3,0x00191},{3,0x00191},{3,0x00191}},{{3,0x00194},{3,0x00197},{3,0x00194},{3,0x00197}},
+   {{3,0x00197},{3,0x00197},{3,0x00197},{3,0x00197}},{{3,0x0019A},{3,0x0019D},{3,0x0019A},{3,0x0019D}},
+   {{3,0x0019D},{3,0x0019D},{3,0x0019D},{3,0x0019D}},{{3,0x001A0},{3,0x001A3},{3,0x001A0},{3,0x001A3}},
+   {{3,0x001A3},{3,0x001A3},{3,0x001A3},{3,0x001A3}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{3,0x001A6},{3,0x001A9},{3,0x001A6},{3,0x001A9}},{{3,0x001A9},{3,0x001A9},{3,0x001A9},{3,0x001A9}},
+   {{3,0x001AC},{3,0x001AF},{3,0x001AC},{3,0x001AF}},{{3,0x001AF},{3,0x001AF},{3,0x001AF},{3,0x001AF}},
+   {{2,0x001B2},{2,0x001B4},{2,0x001B2},{2,0x001B4}},{{2,0x001B4},{2,0x001B4},{2,0x001B4},{2,0x001B4}},
+   {{0,0x00000},{1,0x001E5},{0,0x00000},{1,0x001E5}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x001B6},{2,0x001B8},{2,0x001B6},{2,0x001B8}},{{2,0x001B8},{2,0x001B8},{2,0x001B8},{2,0x001B8}},
+   {{2,0x001BA},{2,0x001BC},{2,0x001BA},{2,0x001BC}},{{2,0x001BC},{2,0x001BC},{2,0x001BC},{2,0x001BC}},
+   {{2,0x001BE},{2,0x001C0},{2,0x001BE},{2,0x001C0}},{{2,0x001C0},{2,0x001C0},{2,0x001C0},{2,0x001C0}},
+   {{3,0x001C2},{3,0x001C5},{3,0x001C2},{3,0x001C5}},{{3,0x001C5},{3,0x001C5},{3,0x001C5},{3,0x001C5}},
+   {{2,0x001C8},{2,0x001CA},{2,0x001C8},{2,0x001CA}},{{2,0x001CA},{2,0x001CA},{2,0x001CA},{2,0x001CA}},
+   {{2,0x001CC},{2,0x001CC},{2,0x001CC},{2,0x001CC}},{{0,0x00000},{1,0x001F3},{2,0x001CE},{2,0x001D0}},
+   {{0,0x00000},{1,0x001F3},{2,0x001D2},{2,0x001D0}},{{0,0x00000},{0,0x00000},{2,0x001D0},{2,0x001D0}},
+   {{2,0x001D4},{2,0x001D6},{2,0x001D4},{2,0x001D6}},{{2,0x001D6},{2,0x001D6},{2,0x001D6},{2,0x001D6}},
+   {{0,0x00000},{1,0x00195},{0,0x00000},{1,0x00195}},{{0,0x00000},{1,0x001BF},{0,0x00000},{1,0x001BF}},
+   {{2,0x001D8},{2,0x001DA},{2,0x001D8},{2,0x001DA}},{{2,0x001DA},{2,0x001DA},{2,0x001DA},{2,0x001DA}},
+   {{3,0x001DC},{3,0x001DF},{3,0x001DC},{3,0x001DF}},{{3,0x001DF},{3,0x001DF},{3,0x001DF},{3,0x001DF}},
+   {{2,0x001E2},{2,0x001E4},{2,0x001E2},{2,0x001E4}},{{2,0x001E4},{2,0x001E4},{2,0x001E4},{2,0x001E4}},
+   {{2,0x001E6},{2,0x001E8},{2,0x001E6},{2,0x001E8}},{{2,0x001E8},{2,0x001E8},{2,0x001E8},{2,0x001E8}}
+  },
+
+  /* block 8 */
+  {{{2,0x001EA},{2,0x001EC},{2,0x001EA},{2,0x001EC}},{{2,0x001EC},{2,0x001EC},{2,0x001EC},{2,0x001EC}},
+   {{2,0x001EE},{2,0x001F0},{2,0x001EE},{2,0x001F0}},{{2,0x001F0},{2,0x001F0},{2,0x001F0},{2,0x001F0}},
+   {{2,0x001F2},{2,0x001F4},{2,0x001F2},{2,0x001F4}},{{2,0x001F4},{2,0x001F4},{2,0x001F4},{2,0x001F4}},
+   {{2,0x001F6},{2,0x001F8},{2,0x001F6},{2,0x001F8}},{{2,0x001F8},{2,0x001F8},{2,0x001F8},{2,0x001F8}},
+   {{2,0x001FA},{2,0x001FC},{2,0x001FA},{2,0x001FC}},{{2,0x001FC},{2,0x001FC},{2,0x001FC},{2,0x001FC}},
+   {{2,0x001FE},{2,0x00200},{2,0x001FE},{2,0x00200}},{{2,0x00200},{2,0x00200},{2,0x00200},{2,0x00200}},
+   {{2,0x00202},{2,0x00204},{2,0x00202},{2,0x00204}},{{2,0x00204},{2,0x00204},{2,0x00204},{2,0x00204}},
+   {{2,0x00206},{2,0x00208},{2,0x00206},{2,0x00208}},{{2,0x00208},{2,0x00208},{2,0x00208},{2,0x00208}},
+   {{2,0x0020A},{2,0x0020C},{2,0x0020A},{2,0x0020C}},{{2,0x0020C},{2,0x0020C},{2,0x0020C},{2,0x0020C}},
+   {{2,0x0020E},{2,0x00210},{2,0x0020E},{2,0x00210}},{{2,0x00210},{2,0x00210},{2,0x00210},{2,0x00210}},
+   {{2,0x00212},{2,0x00214},{2,0x00212},{2,0x00214}},{{2,0x00214},{2,0x00214},{2,0x00214},{2,0x00214}},
+   {{2,0x00216},{2,0x00218},{2,0x00216},{2,0x00218}},{{2,0x00218},{2,0x00218},{2,0x00218},{2,0x00218}},
+   {{2,0x0021A},{2,0x0021C},{2,0x0021A},{2,0x0021C}},{{2,0x0021C},{2,0x0021C},{2,0x0021C},{2,0x0021C}},
+   {{2,0x0021E},{2,0x00220},{2,0x0021E},{2,0x00220}},{{2,0x00220},{2,0x00220},{2,0x00220},{2,0x00220}},
+   {{0,0x00000},{1,0x0021D},{0,0x00000},{1,0x0021D}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00222},{2,0x00224},{2,0x00222},{2,0x00224}},{{2,0x00224},{2,0x00224},{2,0x00224},{2,0x00224}},
+   {{0,0x00000},{1,0x0019E},{0,0x00000},{1,0x0019E}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00223},{0,0x00000},{1,0x00223}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00225},{0,0x00000},{1,0x00225}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00226},{2,0x00228},{2,0x00226},{2,0x00228}},{{2,0x00228},{2,0x00228},{2,0x00228},{2,0x00228}},
+   {{2,0x0022A},{2,0x0022C},{2,0x0022A},{2,0x0022C}},{{2,0x0022C},{2,0x0022C},{2,0x0022C},{2,0x0022C}},
+   {{3,0x0022E},{3,0x00231},{3,0x0022E},{3,0x00231}},{{3,0x00231},{3,0x00231},{3,0x00231},{3,0x00231}},
+   {{3,0x00234},{3,0x00237},{3,0x00234},{3,0x00237}},{{3,0x00237},{3,0x00237},{3,0x00237},{3,0x00237}},
+   {{2,0x0023A},{2,0x0023C},{2,0x0023A},{2,0x0023C}},{{2,0x0023C},{2,0x0023C},{2,0x0023C},{2,0x0023C}},
+   {{3,0x0023E},{3,0x00241},{3,0x0023E},{3,0x00241}},{{3,0x00241},{3,0x00241},{3,0x00241},{3,0x00241}},
+   {{2,0x00244},{2,0x00246},{2,0x00244},{2,0x00246}},{{2,0x00246},{2,0x00246},{2,0x00246},{2,0x00246}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02C65},{0,0x00000},{1,0x02C65}},{{0,0x00000},{1,0x0023C},{0,0x00000},{1,0x0023C}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x0019A},{0,0x00000},{1,0x0019A}},
+   {{0,0x00000},{1,0x02C66},{0,0x00000},{1,0x02C66}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 9 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x00242},{0,0x00000},{1,0x00242}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x00180},{0,0x00000},{1,0x00180}},
+   {{0,0x00000},{1,0x00289},{0,0x00000},{1,0x00289}},{{0,0x00000},{1,0x0028C},{0,0x00000},{1,0x0028C}},
+   {{0,0x00000},{1,0x00247},{0,0x00000},{1,0x00247}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00249},{0,0x00000},{1,0x00249}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0024B},{0,0x00000},{1,0x0024B}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0024D},{0,0x00000},{1,0x0024D}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0024F},{0,0x00000},{1,0x0024F}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 10 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x00068},{1,0x00068}},{{0,0x00000},{0,0x00000},{1,0x00266},{1,0x00266}},
+   {{0,0x00000},{0,0x00000},{1,0x0006A},{1,0x0006A}},{{0,0x00000},{0,0x00000},{1,0x00072},{1,0x00072}},
+   {{0,0x00000},{0,0x00000},{1,0x00279},{1,0x00279}},{{0,0x00000},{0,0x00000},{1,0x0027B},{1,0x0027B}},
+   {{0,0x00000},{0,0x00000},{1,0x00281},{1,0x00281}},{{0,0x00000},{0,0x00000},{1,0x00077},{1,0x00077}},
+   {{0,0x00000},{0,0x00000},{1,0x00079},{1,0x00079}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 11 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{2,0x00248},{2,0x00248}},{{0,0x00000},{0,0x00000},{2,0x0024A},{2,0x0024A}},
+   {{0,0x00000},{0,0x00000},{2,0x0024C},{2,0x0024C}},{{0,0x00000},{0,0x00000},{2,0x0024E},{2,0x0024E}},
+   {{0,0x00000},{0,0x00000},{2,0x00250},{2,0x00250}},{{0,0x00000},{0,0x00000},{2,0x00252},{2,0x00252}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x00263},{1,0x00263}},{{0,0x00000},{0,0x00000},{1,0x0006C},{1,0x0006C}},
+   {{0,0x00000},{0,0x00000},{1,0x00073},{1,0x00073}},{{0,0x00000},{0,0x00000},{1,0x00078},{1,0x00078}},
+   {{0,0x00000},{0,0x00000},{1,0x00295},{1,0x00295}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 12 */
+  {{{1,0x00300},{1,0x00300},{1,0x00300},{1,0x00300}},{{1,0x00301},{1,0x00301},{1,0x00301},{1,0x00301}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{1,0x00313},{1,0x00313},{1,0x00313},{1,0x00313}},
+   {{2,0x00254},{2,0x00254},{2,0x00254},{2,0x00254}},{{0,0x00000},{1,0x003B9},{0,0x00000},{1,0x003B9}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00371},{0,0x00000},{1,0x00371}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00373},{0,0x00000},{1,0x00373}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{1,0x002B9},{1,0x002B9},{1,0x002B9},{1,0x002B9}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00377},{0,0x00000},{1,0x00377}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{2,0x00256},{2,0x00258}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{1,0x0003B},{1,0x0003B},{1,0x0003B},{1,0x0003B}},{{0,0x00000},{1,0x003F3},{0,0x00000},{1,0x003F3}}
+  },
+
+  /* block 13 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{2,0x00004},{2,0x00004}},{{2,0x0025A},{2,0x0025A},{3,0x0025C},{3,0x0025C}},
+   {{2,0x0025F},{2,0x00261},{2,0x0025F},{2,0x00261}},{{1,0x000B7},{1,0x000B7},{1,0x000B7},{1,0x000B7}},
+   {{2,0x00263},{2,0x00265},{2,0x00263},{2,0x00265}},{{2,0x00267},{2,0x00269},{2,0x00267},{2,0x00269}},
+   {{2,0x0026B},{2,0x0026D},{2,0x0026B},{2,0x0026D}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x0026F},{2,0x00271},{2,0x0026F},{2,0x00271}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00273},{2,0x00275},{2,0x00273},{2,0x00275}},{{2,0x00277},{2,0x00279},{2,0x00277},{2,0x00279}},
+   {{3,0x0027B},{3,0x0027B},{3,0x0027B},{3,0x0027B}},{{0,0x00000},{1,0x003B1},{0,0x00000},{1,0x003B1}},
+   {{0,0x00000},{1,0x003B2},{0,0x00000},{1,0x003B2}},{{0,0x00000},{1,0x003B3},{0,0x00000},{1,0x003B3}},
+   {{0,0x00000},{1,0x003B4},{0,0x00000},{1,0x003B4}},{{0,0x00000},{1,0x003B5},{0,0x00000},{1,0x003B5}},
+   {{0,0x00000},{1,0x003B6},{0,0x00000},{1,0x003B6}},{{0,0x00000},{1,0x003B7},{0,0x00000},{1,0x003B7}},
+   {{0,0x00000},{1,0x003B8},{0,0x00000},{1,0x003B8}},{{0,0x00000},{1,0x003B9},{0,0x00000},{1,0x003B9}},
+   {{0,0x00000},{1,0x003BA},{0,0x00000},{1,0x003BA}},{{0,0x00000},{1,0x003BB},{0,0x00000},{1,0x003BB}},
+   {{0,0x00000},{1,0x003BC},{0,0x00000},{1,0x003BC}},{{0,0x00000},{1,0x003BD},{0,0x00000},{1,0x003BD}},
+   {{0,0x00000},{1,0x003BE},{0,0x00000},{1,0x003BE}},{{0,0x00000},{1,0x003BF},{0,0x00000},{1,0x003BF}},
+   {{0,0x00000},{1,0x003C0},{0,0x00000},{1,0x003C0}},{{0,0x00000},{1,0x003C1},{0,0x00000},{1,0x003C1}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x003C3},{0,0x00000},{1,0x003C3}},
+   {{0,0x00000},{1,0x003C4},{0,0x00000},{1,0x003C4}},{{0,0x00000},{1,0x003C5},{0,0x00000},{1,0x003C5}},
+   {{0,0x00000},{1,0x003C6},{0,0x00000},{1,0x003C6}},{{0,0x00000},{1,0x003C7},{0,0x00000},{1,0x003C7}},
+   {{0,0x00000},{1,0x003C8},{0,0x00000},{1,0x003C8}},{{0,0x00000},{1,0x003C9},{0,0x00000},{1,0x003C9}},
+   {{2,0x0027E},{2,0x00280},{2,0x0027E},{2,0x00280}},{{2,0x00282},{2,0x00284},{2,0x00282},{2,0x00284}},
+   {{2,0x00261},{2,0x00261},{2,0x00261},{2,0x00261}},{{2,0x00265},{2,0x00265},{2,0x00265},{2,0x00265}},
+   {{2,0x00269},{2,0x00269},{2,0x00269},{2,0x00269}},{{2,0x0026D},{2,0x0026D},{2,0x0026D},{2,0x0026D}},
+   {{3,0x00286},{3,0x00286},{3,0x00286},{3,0x00286}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 14 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x003C3},{0,0x00000},{1,0x003C3}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00280},{2,0x00280},{2,0x00280},{2,0x00280}},{{2,0x00284},{2,0x00284},{2,0x00284},{2,0x00284}},
+   {{2,0x00271},{2,0x00271},{2,0x00271},{2,0x00271}},{{2,0x00275},{2,0x00275},{2,0x00275},{2,0x00275}},
+   {{2,0x00279},{2,0x00279},{2,0x00279},{2,0x00279}},{{0,0x00000},{1,0x003D7},{0,0x00000},{1,0x003D7}},
+   {{0,0x00000},{1,0x003B2},{1,0x003B2},{1,0x003B2}},{{0,0x00000},{1,0x003B8},{1,0x003B8},{1,0x003B8}},
+   {{0,0x00000},{0,0x00000},{1,0x003A5},{1,0x003C5}},{{2,0x00289},{2,0x00289},{2,0x00273},{2,0x00275}},
+   {{2,0x0028B},{2,0x0028B},{2,0x00282},{2,0x00284}},{{0,0x00000},{1,0x003C6},{1,0x003C6},{1,0x003C6}},
+   {{0,0x00000},{1,0x003C0},{1,0x003C0},{1,0x003C0}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x003D9},{0,0x00000},{1,0x003D9}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x003DB},{0,0x00000},{1,0x003DB}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x003DD},{0,0x00000},{1,0x003DD}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x003DF},{0,0x00000},{1,0x003DF}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x003E1},{0,0x00000},{1,0x003E1}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x003E3},{0,0x00000},{1,0x003E3}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x003E5},{0,0x00000},{1,0x003E5}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x003E7},{0,0x00000},{1,0x003E7}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x003E9},{0,0x00000},{1,0x003E9}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x003EB},{0,0x00000},{1,0x003EB}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x003ED},{0,0x00000},{1,0x003ED}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x003EF},{0,0x00000},{1,0x003EF}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x003BA},{1,0x003BA},{1,0x003BA}},{{0,0x00000},{1,0x003C1},{1,0x003C1},{1,0x003C1}},
+   {{0,0x00000},{0,0x00000},{1,0x003C2},{1,0x003C3}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x003B8},{1,0x00398},{1,0x003B8}},{{0,0x00000},{1,0x003B5},{1,0x003B5},{1,0x003B5}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x003F8},{0,0x00000},{1,0x003F8}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x003F2},{1,0x003A3},{1,0x003C3}},
+   {{0,0x00000},{1,0x003FB},{0,0x00000},{1,0x003FB}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x0037B},{0,0x00000},{1,0x0037B}},
+   {{0,0x00000},{1,0x0037C},{0,0x00000},{1,0x0037C}},{{0,0x00000},{1,0x0037D},{0,0x00000},{1,0x0037D}}
+  },
+
+  /* block 15 */
+  {{{2,0x0028D},{2,0x0028F},{2,0x0028D},{2,0x0028F}},{{2,0x00291},{2,0x00293},{2,0x00291},{2,0x00293}},
+   {{0,0x00000},{1,0x00452},{0,0x00000},{1,0x00452}},{{2,0x00295},{2,0x00297},{2,0x00295},{2,0x00297}},
+   {{0,0x00000},{1,0x00454},{0,0x00000},{1,0x00454}},{{0,0x00000},{1,0x00455},{0,0x00000},{1,0x00455}},
+   {{0,0x00000},{1,0x00456},{0,0x00000},{1,0x00456}},{{2,0x00299},{2,0x0029B},{2,0x00299},{2,0x0029B}},
+   {{0,0x00000},{1,0x00458},{0,0x00000},{1,0x00458}},{{0,0x00000},{1,0x00459},{0,0x00000},{1,0x00459}},
+   {{0,0x00000},{1,0x0045A},{0,0x00000},{1,0x0045A}},{{0,0x00000},{1,0x0045B},{0,0x00000},{1,0x0045B}},
+   {{2,0x0029D},{2,0x0029F},{2,0x0029D},{2,0x0029F}},{{2,0x002A1},{2,0x002A3},{2,0x002A1},{2,0x002A3}},
+   {{2,0x002A5},{2,0x002A7},{2,0x002A5},{2,0x002A7}},{{0,0x00000},{1,0x0045F},{0,0x00000},{1,0x0045F}},
+   {{0,0x00000},{1,0x00430},{0,0x00000},{1,0x00430}},{{0,0x00000},{1,0x00431},{0,0x00000},{1,0x00431}},
+   {{0,0x00000},{1,0x00432},{0,0x00000},{1,0x00432}},{{0,0x00000},{1,0x00433},{0,0x00000},{1,0x00433}},
+   {{0,0x00000},{1,0x00434},{0,0x00000},{1,0x00434}},{{0,0x00000},{1,0x00435},{0,0x00000},{1,0x00435}},
+   {{0,0x00000},{1,0x00436},{0,0x00000},{1,0x00436}},{{0,0x00000},{1,0x00437},{0,0x00000},{1,0x00437}},
+   {{0,0x00000},{1,0x00438},{0,0x00000},{1,0x00438}},{{2,0x002A9},{2,0x002AB},{2,0x002A9},{2,0x002AB}},
+   {{0,0x00000},{1,0x0043A},{0,0x00000},{1,0x0043A}},{{0,0x00000},{1,0x0043B},{0,0x00000},{1,0x0043B}},
+   {{0,0x00000},{1,0x0043C},{0,0x00000},{1,0x0043C}},{{0,0x00000},{1,0x0043D},{0,0x00000},{1,0x0043D}},
+   {{0,0x00000},{1,0x0043E},{0,0x00000},{1,0x0043E}},{{0,0x00000},{1,0x0043F},{0,0x00000},{1,0x0043F}},
+   {{0,0x00000},{1,0x00440},{0,0x00000},{1,0x00440}},{{0,0x00000},{1,0x00441},{0,0x00000},{1,0x00441}},
+   {{0,0x00000},{1,0x00442},{0,0x00000},{1,0x00442}},{{0,0x00000},{1,0x00443},{0,0x00000},{1,0x00443}},
+   {{0,0x00000},{1,0x00444},{0,0x00000},{1,0x00444}},{{0,0x00000},{1,0x00445},{0,0x00000},{1,0x00445}},
+   {{0,0x00000},{1,0x00446},{0,0x00000},{1,0x00446}},{{0,0x00000},{1,0x00447},{0,0x00000},{1,0x00447}},
+   {{0,0x00000},{1,0x00448},{0,0x00000},{1,0x00448}},{{0,0x00000},{1,0x00449},{0,0x00000},{1,0x00449}},
+   {{0,0x00000},{1,0x0044A},{0,0x00000},{1,0x0044A}},{{0,0x00000},{1,0x0044B},{0,0x00000},{1,0x0044B}},
+   {{0,0x00000},{1,0x0044C},{0,0x00000},{1,0x0044C}},{{0,0x00000},{1,0x0044D},{0,0x00000},{1,0x0044D}},
+   {{0,0x00000},{1,0x0044E},{0,0x00000},{1,0x0044E}},{{0,0x00000},{1,0x0044F},{0,0x00000},{1,0x0044F}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x002AB},{2,0x002AB},{2,0x002AB},{2,0x002AB}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 16 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x0028F},{2,0x0028F},{2,0x0028F},{2,0x0028F}},{{2,0x00293},{2,0x00293},{2,0x00293},{2,0x00293}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x00297},{2,0x00297},{2,0x00297},{2,0x00297}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x0029B},{2,0x0029B},{2,0x0029B},{2,0x0029B}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x0029F},{2,0x0029F},{2,0x0029F},{2,0x0029F}},{{2,0x002A3},{2,0x002A3},{2,0x002A3},{2,0x002A3}},
+   {{2,0x002A7},{2,0x002A7},{2,0x002A7},{2,0x002A7}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00461},{0,0x00000},{1,0x00461}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00463},{0,0x00000},{1,0x00463}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00465},{0,0x00000},{1,0x00465}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00467},{0,0x00000},{1,0x00467}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00469},{0,0x00000},{1,0x00469}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0046B},{0,0x00000},{1,0x0046B}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0046D},{0,0x00000},{1,0x0046D}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0046F},{0,0x00000},{1,0x0046F}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00471},{0,0x00000},{1,0x00471}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00473},{0,0x00000},{1,0x00473}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00475},{0,0x00000},{1,0x00475}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x002AD},{2,0x002AF},{2,0x002AD},{2,0x002AF}},{{2,0x002AF},{2,0x002AF},{2,0x002AF},{2,0x002AF}},
+   {{0,0x00000},{1,0x00479},{0,0x00000},{1,0x00479}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0047B},{0,0x00000},{1,0x0047B}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0047D},{0,0x00000},{1,0x0047D}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0047F},{0,0x00000},{1,0x0047F}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 17 */
+  {{{0,0x00000},{1,0x00481},{0,0x00000},{1,0x00481}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0048B},{0,0x00000},{1,0x0048B}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0048D},{0,0x00000},{1,0x0048D}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0048F},{0,0x00000},{1,0x0048F}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00491},{0,0x00000},{1,0x00491}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00493},{0,0x00000},{1,0x00493}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00495},{0,0x00000},{1,0x00495}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00497},{0,0x00000},{1,0x00497}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00499},{0,0x00000},{1,0x00499}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0049B},{0,0x00000},{1,0x0049B}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0049D},{0,0x00000},{1,0x0049D}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0049F},{0,0x00000},{1,0x0049F}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x004A1},{0,0x00000},{1,0x004A1}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x004A3},{0,0x00000},{1,0x004A3}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x004A5},{0,0x00000},{1,0x004A5}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x004A7},{0,0x00000},{1,0x004A7}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x004A9},{0,0x00000},{1,0x004A9}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x004AB},{0,0x00000},{1,0x004AB}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x004AD},{0,0x00000},{1,0x004AD}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x004AF},{0,0x00000},{1,0x004AF}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x004B1},{0,0x00000},{1,0x004B1}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x004B3},{0,0x00000},{1,0x004B3}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x004B5},{0,0x00000},{1,0x004B5}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x004B7},{0,0x00000},{1,0x004B7}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x004B9},{0,0x00000},{1,0x004B9}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x004BB},{0,0x00000},{1,0x004BB}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x004BD},{0,0x00000},{1,0x004BD}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x004BF},{0,0x00000},{1,0x004BF}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 18 */
+  {{{0,0x00000},{1,0x004CF},{0,0x00000},{1,0x004CF}},{{2,0x002B1},{2,0x002B3},{2,0x002B1},{2,0x002B3}},
+   {{2,0x002B3},{2,0x002B3},{2,0x002B3},{2,0x002B3}},{{0,0x00000},{1,0x004C4},{0,0x00000},{1,0x004C4}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x004C6},{0,0x00000},{1,0x004C6}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x004C8},{0,0x00000},{1,0x004C8}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x004CA},{0,0x00000},{1,0x004CA}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x004CC},{0,0x00000},{1,0x004CC}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x004CE},{0,0x00000},{1,0x004CE}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x002B5},{2,0x002B7},{2,0x002B5},{2,0x002B7}},{{2,0x002B7},{2,0x002B7},{2,0x002B7},{2,0x002B7}},
+   {{2,0x002B9},{2,0x002BB},{2,0x002B9},{2,0x002BB}},{{2,0x002BB},{2,0x002BB},{2,0x002BB},{2,0x002BB}},
+   {{0,0x00000},{1,0x004D5},{0,0x00000},{1,0x004D5}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x002BD},{2,0x002BF},{2,0x002BD},{2,0x002BF}},{{2,0x002BF},{2,0x002BF},{2,0x002BF},{2,0x002BF}},
+   {{0,0x00000},{1,0x004D9},{0,0x00000},{1,0x004D9}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x002C1},{2,0x002C3},{2,0x002C1},{2,0x002C3}},{{2,0x002C3},{2,0x002C3},{2,0x002C3},{2,0x002C3}},
+   {{2,0x002C5},{2,0x002C7},{2,0x002C5},{2,0x002C7}},{{2,0x002C7},{2,0x002C7},{2,0x002C7},{2,0x002C7}},
+   {{2,0x002C9},{2,0x002CB},{2,0x002C9},{2,0x002CB}},{{2,0x002CB},{2,0x002CB},{2,0x002CB},{2,0x002CB}},
+   {{0,0x00000},{1,0x004E1},{0,0x00000},{1,0x004E1}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x002CD},{2,0x002CF},{2,0x002CD},{2,0x002CF}},{{2,0x002CF},{2,0x002CF},{2,0x002CF},{2,0x002CF}},
+   {{2,0x002D1},{2,0x002D3},{2,0x002D1},{2,0x002D3}},{{2,0x002D3},{2,0x002D3},{2,0x002D3},{2,0x002D3}},
+   {{2,0x002D5},{2,0x002D7},{2,0x002D5},{2,0x002D7}},{{2,0x002D7},{2,0x002D7},{2,0x002D7},{2,0x002D7}},
+   {{0,0x00000},{1,0x004E9},{0,0x00000},{1,0x004E9}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x002D9},{2,0x002DB},{2,0x002D9},{2,0x002DB}},{{2,0x002DB},{2,0x002DB},{2,0x002DB},{2,0x002DB}},
+   {{2,0x002DD},{2,0x002DF},{2,0x002DD},{2,0x002DF}},{{2,0x002DF},{2,0x002DF},{2,0x002DF},{2,0x002DF}},
+   {{2,0x002E1},{2,0x002E3},{2,0x002E1},{2,0x002E3}},{{2,0x002E3},{2,0x002E3},{2,0x002E3},{2,0x002E3}},
+   {{2,0x002E5},{2,0x002E7},{2,0x002E5},{2,0x002E7}},{{2,0x002E7},{2,0x002E7},{2,0x002E7},{2,0x002E7}},
+   {{2,0x002E9},{2,0x002EB},{2,0x002E9},{2,0x002EB}},{{2,0x002EB},{2,0x002EB},{2,0x002EB},{2,0x002EB}},
+   {{2,0x002ED},{2,0x002EF},{2,0x002ED},{2,0x002EF}},{{2,0x002EF},{2,0x002EF},{2,0x002EF},{2,0x002EF}},
+   {{0,0x00000},{1,0x004F7},{0,0x00000},{1,0x004F7}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x002F1},{2,0x002F3},{2,0x002F1},{2,0x002F3}},{{2,0x002F3},{2,0x002F3},{2,0x002F3},{2,0x002F3}},
+   {{0,0x00000},{1,0x004FB},{0,0x00000},{1,0x004FB}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x004FD},{0,0x00000},{1,0x004FD}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x004FF},{0,0x00000},{1,0x004FF}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 19 */
+  {{{0,0x00000},{1,0x00501},{0,0x00000},{1,0x00501}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00503},{0,0x00000},{1,0x00503}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00505},{0,0x00000},{1,0x00505}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00507},{0,0x00000},{1,0x00507}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00509},{0,0x00000},{1,0x00509}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0050B},{0,0x00000},{1,0x0050B}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0050D},{0,0x00000},{1,0x0050D}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0050F},{0,0x00000},{1,0x0050F}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00511},{0,0x00000},{1,0x00511}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00513},{0,0x00000},{1,0x00513}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00515},{0,0x00000},{1,0x00515}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00517},{0,0x00000},{1,0x00517}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00519},{0,0x00000},{1,0x00519}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0051B},{0,0x00000},{1,0x0051B}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0051D},{0,0x00000},{1,0x0051D}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0051F},{0,0x00000},{1,0x0051F}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00521},{0,0x00000},{1,0x00521}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00523},{0,0x00000},{1,0x00523}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00525},{0,0x00000},{1,0x00525}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00527},{0,0x00000},{1,0x00527}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00529},{0,0x00000},{1,0x00529}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0052B},{0,0x00000},{1,0x0052B}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0052D},{0,0x00000},{1,0x0052D}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0052F},{0,0x00000},{1,0x0052F}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x00561},{0,0x00000},{1,0x00561}},
+   {{0,0x00000},{1,0x00562},{0,0x00000},{1,0x00562}},{{0,0x00000},{1,0x00563},{0,0x00000},{1,0x00563}},
+   {{0,0x00000},{1,0x00564},{0,0x00000},{1,0x00564}},{{0,0x00000},{1,0x00565},{0,0x00000},{1,0x00565}},
+   {{0,0x00000},{1,0x00566},{0,0x00000},{1,0x00566}},{{0,0x00000},{1,0x00567},{0,0x00000},{1,0x00567}},
+   {{0,0x00000},{1,0x00568},{0,0x00000},{1,0x00568}},{{0,0x00000},{1,0x00569},{0,0x00000},{1,0x00569}},
+   {{0,0x00000},{1,0x0056A},{0,0x00000},{1,0x0056A}},{{0,0x00000},{1,0x0056B},{0,0x00000},{1,0x0056B}},
+   {{0,0x00000},{1,0x0056C},{0,0x00000},{1,0x0056C}},{{0,0x00000},{1,0x0056D},{0,0x00000},{1,0x0056D}},
+   {{0,0x00000},{1,0x0056E},{0,0x00000},{1,0x0056E}},{{0,0x00000},{1,0x0056F},{0,0x00000},{1,0x0056F}}
+  },
+
+  /* block 20 */
+  {{{0,0x00000},{1,0x00570},{0,0x00000},{1,0x00570}},{{0,0x00000},{1,0x00571},{0,0x00000},{1,0x00571}},
+   {{0,0x00000},{1,0x00572},{0,0x00000},{1,0x00572}},{{0,0x00000},{1,0x00573},{0,0x00000},{1,0x00573}},
+   {{0,0x00000},{1,0x00574},{0,0x00000},{1,0x00574}},{{0,0x00000},{1,0x00575},{0,0x00000},{1,0x00575}},
+   {{0,0x00000},{1,0x00576},{0,0x00000},{1,0x00576}},{{0,0x00000},{1,0x00577},{0,0x00000},{1,0x00577}},
+   {{0,0x00000},{1,0x00578},{0,0x00000},{1,0x00578}},{{0,0x00000},{1,0x00579},{0,0x00000},{1,0x00579}},
+   {{0,0x00000},{1,0x0057A},{0,0x00000},{1,0x0057A}},{{0,0x00000},{1,0x0057B},{0,0x00000},{1,0x0057B}},
+   {{0,0x00000},{1,0x0057C},{0,0x00000},{1,0x0057C}},{{0,0x00000},{1,0x0057D},{0,0x00000},{1,0x0057D}},
+   {{0,0x00000},{1,0x0057E},{0,0x00000},{1,0x0057E}},{{0,0x00000},{1,0x0057F},{0,0x00000},{1,0x0057F}},
+   {{0,0x00000},{1,0x00580},{0,0x00000},{1,0x00580}},{{0,0x00000},{1,0x00581},{0,0x00000},{1,0x00581}},
+   {{0,0x00000},{1,0x00582},{0,0x00000},{1,0x00582}},{{0,0x00000},{1,0x00583},{0,0x00000},{1,0x00583}},
+   {{0,0x00000},{1,0x00584},{0,0x00000},{1,0x00584}},{{0,0x00000},{1,0x00585},{0,0x00000},{1,0x00585}},
+   {{0,0x00000},{1,0x00586},{0,0x00000},{1,0x00586}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 21 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{2,0x002F5},{2,0x002F5},{2,0x002F5}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 22 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x002F7},{2,0x002F7},{2,0x002F7},{2,0x002F7}},{{2,0x002F9},{2,0x002F9},{2,0x002F9},{2,0x002F9}},
+   {{2,0x002FB},{2,0x002FB},{2,0x002FB},{2,0x002FB}},{{2,0x002FD},{2,0x002FD},{2,0x002FD},{2,0x002FD}},
+   {{2,0x002FF},{2,0x002FF},{2,0x002FF},{2,0x002FF}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 23 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{2,0x00301},{2,0x00301}},
+   {{0,0x00000},{0,0x00000},{2,0x00303},{2,0x00303}},{{0,0x00000},{0,0x00000},{2,0x00305},{2,0x00305}},
+   {{0,0x00000},{0,0x00000},{2,0x00307},{2,0x00307}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 24 */
+  {{{2,0x00309},{2,0x00309},{2,0x00309},{2,0x00309}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x0030B},{2,0x0030B},{2,0x0030B},{2,0x0030B}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x0030D},{2,0x0030D},{2,0x0030D},{2,0x0030D}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 25 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x0030F},{2,0x0030F},{2,0x0030F},{2,0x0030F}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x00311},{2,0x00311},{2,0x00311},{2,0x00311}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00313},{2,0x00313},{2,0x00313},{2,0x00313}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 26 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00315},{2,0x00315},{2,0x00315},{2,0x00315}},{{2,0x00317},{2,0x00317},{2,0x00317},{2,0x00317}},
+   {{2,0x00319},{2,0x00319},{2,0x00319},{2,0x00319}},{{2,0x0031B},{2,0x0031B},{2,0x0031B},{2,0x0031B}},
+   {{2,0x0031D},{2,0x0031D},{2,0x0031D},{2,0x0031D}},{{2,0x0031F},{2,0x0031F},{2,0x0031F},{2,0x0031F}},
+   {{2,0x00321},{2,0x00321},{2,0x00321},{2,0x00321}},{{2,0x00323},{2,0x00323},{2,0x00323},{2,0x00323}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 27 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x00325},{2,0x00325},{2,0x00325},{2,0x00325}},
+   {{2,0x00327},{2,0x00327},{2,0x00327},{2,0x00327}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00329},{2,0x00329},{2,0x00329},{2,0x00329}},{{2,0x0032B},{2,0x0032B},{2,0x0032B},{2,0x0032B}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x0032D},{2,0x0032D},{2,0x0032D},{2,0x0032D}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 28 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x0032F},{2,0x0032F},{2,0x0032F},{2,0x0032F}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00331},{2,0x00331},{2,0x00331},{2,0x00331}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 29 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x00333},{2,0x00333},{2,0x00333},{2,0x00333}},
+   {{2,0x00335},{2,0x00335},{2,0x00335},{2,0x00335}},{{2,0x00337},{2,0x00337},{2,0x00337},{2,0x00337}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00339},{2,0x00339},{2,0x00339},{2,0x00339}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 30 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x0033B},{2,0x0033B},{2,0x0033B},{2,0x0033B}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x0033D},{2,0x0033D},{2,0x0033D},{2,0x0033D}},
+   {{2,0x0033F},{2,0x0033F},{2,0x0033F},{2,0x0033F}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00341},{2,0x00341},{2,0x00341},{2,0x00341}},{{2,0x00343},{2,0x00343},{2,0x00343},{2,0x00343}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 31 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00345},{2,0x00345},{2,0x00345},{2,0x00345}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 32 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00347},{2,0x00347},{2,0x00347},{2,0x00347}},{{2,0x00349},{2,0x00349},{2,0x00349},{2,0x00349}},
+   {{2,0x0034B},{2,0x0034B},{2,0x0034B},{2,0x0034B}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 33 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x0034D},{2,0x0034D},{2,0x0034D},{2,0x0034D}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 34 */
+  {{{2,0x0034F},{2,0x0034F},{2,0x0034F},{2,0x0034F}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x00351},{2,0x00351},{2,0x00351},{2,0x00351}},
+   {{2,0x00353},{2,0x00353},{2,0x00353},{2,0x00353}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00355},{2,0x00355},{2,0x00355},{2,0x00355}},{{3,0x00357},{3,0x00357},{3,0x00357},{3,0x00357}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 35 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x0035A},{2,0x0035A},{2,0x0035A},{2,0x0035A}},{{2,0x0035C},{2,0x0035C},{2,0x0035C},{2,0x0035C}},
+   {{2,0x0035E},{2,0x0035E},{2,0x0035E},{2,0x0035E}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 36 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00360},{2,0x00360},{2,0x00360},{2,0x00360}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00362},{2,0x00362},{2,0x00362},{2,0x00362}},{{3,0x00364},{3,0x00364},{3,0x00364},{3,0x00364}},
+   {{2,0x00367},{2,0x00367},{2,0x00367},{2,0x00367}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 37 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{2,0x00369},{2,0x00369}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 38 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{2,0x0036B},{2,0x0036B}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 39 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{2,0x0036D},{2,0x0036D}},{{0,0x00000},{0,0x00000},{2,0x0036F},{2,0x0036F}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 40 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x00F0B},{1,0x00F0B}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 41 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x00371},{2,0x00371},{2,0x00371},{2,0x00371}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x00373},{2,0x00373},{2,0x00373},{2,0x00373}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00375},{2,0x00375},{2,0x00375},{2,0x00375}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x00377},{2,0x00377},{2,0x00377},{2,0x00377}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00379},{2,0x00379},{2,0x00379},{2,0x00379}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x0037B},{2,0x0037B},{2,0x0037B},{2,0x0037B}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x0037D},{2,0x0037D},{2,0x0037D},{2,0x0037D}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x0037F},{2,0x0037F},{2,0x0037F},{2,0x0037F}},
+   {{2,0x00381},{2,0x00381},{2,0x00381},{2,0x00381}},{{0,0x00000},{0,0x00000},{3,0x00383},{3,0x00383}},
+   {{2,0x00386},{2,0x00386},{2,0x00386},{2,0x00386}},{{0,0x00000},{0,0x00000},{3,0x00388},{3,0x00388}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 42 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x0038B},{2,0x0038B},{2,0x0038B},{2,0x0038B}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x0038D},{2,0x0038D},{2,0x0038D},{2,0x0038D}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x0038F},{2,0x0038F},{2,0x0038F},{2,0x0038F}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00391},{2,0x00391},{2,0x00391},{2,0x00391}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x00393},{2,0x00393},{2,0x00393},{2,0x00393}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00395},{2,0x00395},{2,0x00395},{2,0x00395}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x00397},{2,0x00397},{2,0x00397},{2,0x00397}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 43 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00399},{2,0x00399},{2,0x00399},{2,0x00399}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 44 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02D00},{0,0x00000},{1,0x02D00}},{{0,0x00000},{1,0x02D01},{0,0x00000},{1,0x02D01}},
+   {{0,0x00000},{1,0x02D02},{0,0x00000},{1,0x02D02}},{{0,0x00000},{1,0x02D03},{0,0x00000},{1,0x02D03}},
+   {{0,0x00000},{1,0x02D04},{0,0x00000},{1,0x02D04}},{{0,0x00000},{1,0x02D05},{0,0x00000},{1,0x02D05}},
+   {{0,0x00000},{1,0x02D06},{0,0x00000},{1,0x02D06}},{{0,0x00000},{1,0x02D07},{0,0x00000},{1,0x02D07}},
+   {{0,0x00000},{1,0x02D08},{0,0x00000},{1,0x02D08}},{{0,0x00000},{1,0x02D09},{0,0x00000},{1,0x02D09}},
+   {{0,0x00000},{1,0x02D0A},{0,0x00000},{1,0x02D0A}},{{0,0x00000},{1,0x02D0B},{0,0x00000},{1,0x02D0B}},
+   {{0,0x00000},{1,0x02D0C},{0,0x00000},{1,0x02D0C}},{{0,0x00000},{1,0x02D0D},{0,0x00000},{1,0x02D0D}},
+   {{0,0x00000},{1,0x02D0E},{0,0x00000},{1,0x02D0E}},{{0,0x00000},{1,0x02D0F},{0,0x00000},{1,0x02D0F}},
+   {{0,0x00000},{1,0x02D10},{0,0x00000},{1,0x02D10}},{{0,0x00000},{1,0x02D11},{0,0x00000},{1,0x02D11}},
+   {{0,0x00000},{1,0x02D12},{0,0x00000},{1,0x02D12}},{{0,0x00000},{1,0x02D13},{0,0x00000},{1,0x02D13}},
+   {{0,0x00000},{1,0x02D14},{0,0x00000},{1,0x02D14}},{{0,0x00000},{1,0x02D15},{0,0x00000},{1,0x02D15}},
+   {{0,0x00000},{1,0x02D16},{0,0x00000},{1,0x02D16}},{{0,0x00000},{1,0x02D17},{0,0x00000},{1,0x02D17}},
+   {{0,0x00000},{1,0x02D18},{0,0x00000},{1,0x02D18}},{{0,0x00000},{1,0x02D19},{0,0x00000},{1,0x02D19}},
+   {{0,0x00000},{1,0x02D1A},{0,0x00000},{1,0x02D1A}},{{0,0x00000},{1,0x02D1B},{0,0x00000},{1,0x02D1B}},
+   {{0,0x00000},{1,0x02D1C},{0,0x00000},{1,0x02D1C}},{{0,0x00000},{1,0x02D1D},{0,0x00000},{1,0x02D1D}},
+   {{0,0x00000},{1,0x02D1E},{0,0x00000},{1,0x02D1E}},{{0,0x00000},{1,0x02D1F},{0,0x00000},{1,0x02D1F}}
+  },
+
+  /* block 45 */
+  {{{0,0x00000},{1,0x02D20},{0,0x00000},{1,0x02D20}},{{0,0x00000},{1,0x02D21},{0,0x00000},{1,0x02D21}},
+   {{0,0x00000},{1,0x02D22},{0,0x00000},{1,0x02D22}},{{0,0x00000},{1,0x02D23},{0,0x00000},{1,0x02D23}},
+   {{0,0x00000},{1,0x02D24},{0,0x00000},{1,0x02D24}},{{0,0x00000},{1,0x02D25},{0,0x00000},{1,0x02D25}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x02D27},{0,0x00000},{1,0x02D27}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x02D2D},{0,0x00000},{1,0x02D2D}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x010DC},{1,0x010DC}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 46 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x013F0},{0,0x00000},{1,0x013F0}},{{0,0x00000},{1,0x013F1},{0,0x00000},{1,0x013F1}},
+   {{0,0x00000},{1,0x013F2},{0,0x00000},{1,0x013F2}},{{0,0x00000},{1,0x013F3},{0,0x00000},{1,0x013F3}},
+   {{0,0x00000},{1,0x013F4},{0,0x00000},{1,0x013F4}},{{0,0x00000},{1,0x013F5},{0,0x00000},{1,0x013F5}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 47 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x0039B},{2,0x0039B},{2,0x0039B},{2,0x0039B}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x0039D},{2,0x0039D},{2,0x0039D},{2,0x0039D}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x0039F},{2,0x0039F},{2,0x0039F},{2,0x0039F}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x003A1},{2,0x003A1},{2,0x003A1},{2,0x003A1}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x003A3},{2,0x003A3},{2,0x003A3},{2,0x003A3}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x003A5},{2,0x003A5},{2,0x003A5},{2,0x003A5}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x003A7},{2,0x003A7},{2,0x003A7},{2,0x003A7}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x003A9},{2,0x003A9},{2,0x003A9},{2,0x003A9}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 48 */
+  {{{2,0x003AB},{2,0x003AB},{2,0x003AB},{2,0x003AB}},{{2,0x003AD},{2,0x003AD},{2,0x003AD},{2,0x003AD}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x003AF},{2,0x003AF},{2,0x003AF},{2,0x003AF}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 49 */
+  {{{0,0x00000},{1,0x00432},{0,0x00000},{1,0x00432}},{{0,0x00000},{1,0x00434},{0,0x00000},{1,0x00434}},
+   {{0,0x00000},{1,0x0043E},{0,0x00000},{1,0x0043E}},{{0,0x00000},{1,0x00441},{0,0x00000},{1,0x00441}},
+   {{0,0x00000},{1,0x00442},{0,0x00000},{1,0x00442}},{{0,0x00000},{1,0x00442},{0,0x00000},{1,0x00442}},
+   {{0,0x00000},{1,0x0044A},{0,0x00000},{1,0x0044A}},{{0,0x00000},{1,0x00463},{0,0x00000},{1,0x00463}},
+   {{0,0x00000},{1,0x0A64B},{0,0x00000},{1,0x0A64B}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x010D0},{0,0x00000},{1,0x010D0}},{{0,0x00000},{1,0x010D1},{0,0x00000},{1,0x010D1}},
+   {{0,0x00000},{1,0x010D2},{0,0x00000},{1,0x010D2}},{{0,0x00000},{1,0x010D3},{0,0x00000},{1,0x010D3}},
+   {{0,0x00000},{1,0x010D4},{0,0x00000},{1,0x010D4}},{{0,0x00000},{1,0x010D5},{0,0x00000},{1,0x010D5}},
+   {{0,0x00000},{1,0x010D6},{0,0x00000},{1,0x010D6}},{{0,0x00000},{1,0x010D7},{0,0x00000},{1,0x010D7}},
+   {{0,0x00000},{1,0x010D8},{0,0x00000},{1,0x010D8}},{{0,0x00000},{1,0x010D9},{0,0x00000},{1,0x010D9}},
+   {{0,0x00000},{1,0x010DA},{0,0x00000},{1,0x010DA}},{{0,0x00000},{1,0x010DB},{0,0x00000},{1,0x010DB}},
+   {{0,0x00000},{1,0x010DC},{0,0x00000},{1,0x010DC}},{{0,0x00000},{1,0x010DD},{0,0x00000},{1,0x010DD}},
+   {{0,0x00000},{1,0x010DE},{0,0x00000},{1,0x010DE}},{{0,0x00000},{1,0x010DF},{0,0x00000},{1,0x010DF}},
+   {{0,0x00000},{1,0x010E0},{0,0x00000},{1,0x010E0}},{{0,0x00000},{1,0x010E1},{0,0x00000},{1,0x010E1}},
+   {{0,0x00000},{1,0x010E2},{0,0x00000},{1,0x010E2}},{{0,0x00000},{1,0x010E3},{0,0x00000},{1,0x010E3}},
+   {{0,0x00000},{1,0x010E4},{0,0x00000},{1,0x010E4}},{{0,0x00000},{1,0x010E5},{0,0x00000},{1,0x010E5}},
+   {{0,0x00000},{1,0x010E6},{0,0x00000},{1,0x010E6}},{{0,0x00000},{1,0x010E7},{0,0x00000},{1,0x010E7}},
+   {{0,0x00000},{1,0x010E8},{0,0x00000},{1,0x010E8}},{{0,0x00000},{1,0x010E9},{0,0x00000},{1,0x010E9}},
+   {{0,0x00000},{1,0x010EA},{0,0x00000},{1,0x010EA}},{{0,0x00000},{1,0x010EB},{0,0x00000},{1,0x010EB}},
+   {{0,0x00000},{1,0x010EC},{0,0x00000},{1,0x010EC}},{{0,0x00000},{1,0x010ED},{0,0x00000},{1,0x010ED}},
+   {{0,0x00000},{1,0x010EE},{0,0x00000},{1,0x010EE}},{{0,0x00000},{1,0x010EF},{0,0x00000},{1,0x010EF}},
+   {{0,0x00000},{1,0x010F0},{0,0x00000},{1,0x010F0}},{{0,0x00000},{1,0x010F1},{0,0x00000},{1,0x010F1}},
+   {{0,0x00000},{1,0x010F2},{0,0x00000},{1,0x010F2}},{{0,0x00000},{1,0x010F3},{0,0x00000},{1,0x010F3}},
+   {{0,0x00000},{1,0x010F4},{0,0x00000},{1,0x010F4}},{{0,0x00000},{1,0x010F5},{0,0x00000},{1,0x010F5}},
+   {{0,0x00000},{1,0x010F6},{0,0x00000},{1,0x010F6}},{{0,0x00000},{1,0x010F7},{0,0x00000},{1,0x010F7}},
+   {{0,0x00000},{1,0x010F8},{0,0x00000},{1,0x010F8}},{{0,0x00000},{1,0x010F9},{0,0x00000},{1,0x010F9}},
+   {{0,0x00000},{1,0x010FA},{0,0x00000},{1,0x010FA}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x010FD},{0,0x00000},{1,0x010FD}},
+   {{0,0x00000},{1,0x010FE},{0,0x00000},{1,0x010FE}},{{0,0x00000},{1,0x010FF},{0,0x00000},{1,0x010FF}}
+  },
+
+  /* block 50 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x00041},{1,0x00061}},{{0,0x00000},{0,0x00000},{1,0x000C6},{1,0x000E6}},
+   {{0,0x00000},{0,0x00000},{1,0x00042},{1,0x00062}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x00044},{1,0x00064}},{{0,0x00000},{0,0x00000},{1,0x00045},{1,0x00065}},
+   {{0,0x00000},{0,0x00000},{1,0x0018E},{1,0x001DD}},{{0,0x00000},{0,0x00000},{1,0x00047},{1,0x00067}},
+   {{0,0x00000},{0,0x00000},{1,0x00048},{1,0x00068}},{{0,0x00000},{0,0x00000},{1,0x00049},{1,0x00069}},
+   {{0,0x00000},{0,0x00000},{1,0x0004A},{1,0x0006A}},{{0,0x00000},{0,0x00000},{1,0x0004B},{1,0x0006B}},
+   {{0,0x00000},{0,0x00000},{1,0x0004C},{1,0x0006C}},{{0,0x00000},{0,0x00000},{1,0x0004D},{1,0x0006D}},
+   {{0,0x00000},{0,0x00000},{1,0x0004E},{1,0x0006E}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x0004F},{1,0x0006F}},{{0,0x00000},{0,0x00000},{1,0x00222},{1,0x00223}},
+   {{0,0x00000},{0,0x00000},{1,0x00050},{1,0x00070}},{{0,0x00000},{0,0x00000},{1,0x00052},{1,0x00072}}
+  },
+
+  /* block 51 */
+  {{{0,0x00000},{0,0x00000},{1,0x00054},{1,0x00074}},{{0,0x00000},{0,0x00000},{1,0x00055},{1,0x00075}},
+   {{0,0x00000},{0,0x00000},{1,0x00057},{1,0x00077}},{{0,0x00000},{0,0x00000},{1,0x00061},{1,0x00061}},
+   {{0,0x00000},{0,0x00000},{1,0x00250},{1,0x00250}},{{0,0x00000},{0,0x00000},{1,0x00251},{1,0x00251}},
+   {{0,0x00000},{0,0x00000},{1,0x01D02},{1,0x01D02}},{{0,0x00000},{0,0x00000},{1,0x00062},{1,0x00062}},
+   {{0,0x00000},{0,0x00000},{1,0x00064},{1,0x00064}},{{0,0x00000},{0,0x00000},{1,0x00065},{1,0x00065}},
+   {{0,0x00000},{0,0x00000},{1,0x00259},{1,0x00259}},{{0,0x00000},{0,0x00000},{1,0x0025B},{1,0x0025B}},
+   {{0,0x00000},{0,0x00000},{1,0x0025C},{1,0x0025C}},{{0,0x00000},{0,0x00000},{1,0x00067},{1,0x00067}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x0006B},{1,0x0006B}},
+   {{0,0x00000},{0,0x00000},{1,0x0006D},{1,0x0006D}},{{0,0x00000},{0,0x00000},{1,0x0014B},{1,0x0014B}},
+   {{0,0x00000},{0,0x00000},{1,0x0006F},{1,0x0006F}},{{0,0x00000},{0,0x00000},{1,0x00254},{1,0x00254}},
+   {{0,0x00000},{0,0x00000},{1,0x01D16},{1,0x01D16}},{{0,0x00000},{0,0x00000},{1,0x01D17},{1,0x01D17}},
+   {{0,0x00000},{0,0x00000},{1,0x00070},{1,0x00070}},{{0,0x00000},{0,0x00000},{1,0x00074},{1,0x00074}},
+   {{0,0x00000},{0,0x00000},{1,0x00075},{1,0x00075}},{{0,0x00000},{0,0x00000},{1,0x01D1D},{1,0x01D1D}},
+   {{0,0x00000},{0,0x00000},{1,0x0026F},{1,0x0026F}},{{0,0x00000},{0,0x00000},{1,0x00076},{1,0x00076}},
+   {{0,0x00000},{0,0x00000},{1,0x01D25},{1,0x01D25}},{{0,0x00000},{0,0x00000},{1,0x003B2},{1,0x003B2}},
+   {{0,0x00000},{0,0x00000},{1,0x003B3},{1,0x003B3}},{{0,0x00000},{0,0x00000},{1,0x003B4},{1,0x003B4}},
+   {{0,0x00000},{0,0x00000},{1,0x003C6},{1,0x003C6}},{{0,0x00000},{0,0x00000},{1,0x003C7},{1,0x003C7}},
+   {{0,0x00000},{0,0x00000},{1,0x00069},{1,0x00069}},{{0,0x00000},{0,0x00000},{1,0x00072},{1,0x00072}},
+   {{0,0x00000},{0,0x00000},{1,0x00075},{1,0x00075}},{{0,0x00000},{0,0x00000},{1,0x00076},{1,0x00076}},
+   {{0,0x00000},{0,0x00000},{1,0x003B2},{1,0x003B2}},{{0,0x00000},{0,0x00000},{1,0x003B3},{1,0x003B3}},
+   {{0,0x00000},{0,0x00000},{1,0x003C1},{1,0x003C1}},{{0,0x00000},{0,0x00000},{1,0x003C6},{1,0x003C6}},
+   {{0,0x00000},{0,0x00000},{1,0x003C7},{1,0x003C7}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x0043D},{1,0x0043D}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 52 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x00252},{1,0x00252}},
+   {{0,0x00000},{0,0x00000},{1,0x00063},{1,0x00063}},{{0,0x00000},{0,0x00000},{1,0x00255},{1,0x00255}},
+   {{0,0x00000},{0,0x00000},{1,0x000F0},{1,0x000F0}},{{0,0x00000},{0,0x00000},{1,0x0025C},{1,0x0025C}},
+   {{0,0x00000},{0,0x00000},{1,0x00066},{1,0x00066}},{{0,0x00000},{0,0x00000},{1,0x0025F},{1,0x0025F}},
+   {{0,0x00000},{0,0x00000},{1,0x00261},{1,0x00261}},{{0,0x00000},{0,0x00000},{1,0x00265},{1,0x00265}},
+   {{0,0x00000},{0,0x00000},{1,0x00268},{1,0x00268}},{{0,0x00000},{0,0x00000},{1,0x00269},{1,0x00269}},
+   {{0,0x00000},{0,0x00000},{1,0x0026A},{1,0x0026A}},{{0,0x00000},{0,0x00000},{1,0x01D7B},{1,0x01D7B}},
+   {{0,0x00000},{0,0x00000},{1,0x0029D},{1,0x0029D}},{{0,0x00000},{0,0x00000},{1,0x0026D},{1,0x0026D}},
+   {{0,0x00000},{0,0x00000},{1,0x01D85},{1,0x01D85}},{{0,0x00000},{0,0x00000},{1,0x0029F},{1,0x0029F}},
+   {{0,0x00000},{0,0x00000},{1,0x00271},{1,0x00271}},{{0,0x00000},{0,0x00000},{1,0x00270},{1,0x00270}},
+   {{0,0x00000},{0,0x00000},{1,0x00272},{1,0x00272}},{{0,0x00000},{0,0x00000},{1,0x00273},{1,0x00273}},
+   {{0,0x00000},{0,0x00000},{1,0x00274},{1,0x00274}},{{0,0x00000},{0,0x00000},{1,0x00275},{1,0x00275}},
+   {{0,0x00000},{0,0x00000},{1,0x00278},{1,0x00278}},{{0,0x00000},{0,0x00000},{1,0x00282},{1,0x00282}},
+   {{0,0x00000},{0,0x00000},{1,0x00283},{1,0x00283}},{{0,0x00000},{0,0x00000},{1,0x001AB},{1,0x001AB}},
+   {{0,0x00000},{0,0x00000},{1,0x00289},{1,0x00289}},{{0,0x00000},{0,0x00000},{1,0x0028A},{1,0x0028A}},
+   {{0,0x00000},{0,0x00000},{1,0x01D1C},{1,0x01D1C}},{{0,0x00000},{0,0x00000},{1,0x0028B},{1,0x0028B}},
+   {{0,0x00000},{0,0x00000},{1,0x0028C},{1,0x0028C}},{{0,0x00000},{0,0x00000},{1,0x0007A},{1,0x0007A}},
+   {{0,0x00000},{0,0x00000},{1,0x00290},{1,0x00290}},{{0,0x00000},{0,0x00000},{1,0x00291},{1,0x00291}},
+   {{0,0x00000},{0,0x00000},{1,0x00292},{1,0x00292}},{{0,0x00000},{0,0x00000},{1,0x003B8},{1,0x003B8}}
+  },
+
+  /* block 53 */
+  {{{2,0x003B1},{2,0x003B3},{2,0x003B1},{2,0x003B3}},{{2,0x003B3},{2,0x003B3},{2,0x003B3},{2,0x003B3}},
+   {{2,0x003B5},{2,0x003B7},{2,0x003B5},{2,0x003B7}},{{2,0x003B7},{2,0x003B7},{2,0x003B7},{2,0x003B7}},
+   {{2,0x003B9},{2,0x003BB},{2,0x003B9},{2,0x003BB}},{{2,0x003BB},{2,0x003BB},{2,0x003BB},{2,0x003BB}},
+   {{2,0x003BD},{2,0x003BF},{2,0x003BD},{2,0x003BF}},{{2,0x003BF},{2,0x003BF},{2,0x003BF},{2,0x003BF}},
+   {{3,0x003C1},{3,0x003C4},{3,0x003C1},{3,0x003C4}},{{3,0x003C4},{3,0x003C4},{3,0x003C4},{3,0x003C4}},
+   {{2,0x003C7},{2,0x003C9},{2,0x003C7},{2,0x003C9}},{{2,0x003C9},{2,0x003C9},{2,0x003C9},{2,0x003C9}},
+   {{2,0x003CB},{2,0x003CD},{2,0x003CB},{2,0x003CD}},{{2,0x003CD},{2,0x003CD},{2,0x003CD},{2,0x003CD}},
+   {{2,0x003CF},{2,0x003D1},{2,0x003CF},{2,0x003D1}},{{2,0x003D1},{2,0x003D1},{2,0x003D1},{2,0x003D1}},
+   {{2,0x003D3},{2,0x003D5},{2,0x003D3},{2,0x003D5}},{{2,0x003D5},{2,0x003D5},{2,0x003D5},{2,0x003D5}},
+   {{2,0x003D7},{2,0x003D9},{2,0x003D7},{2,0x003D9}},{{2,0x003D9},{2,0x003D9},{2,0x003D9},{2,0x003D9}},
+   {{3,0x003DB},{3,0x003DE},{3,0x003DB},{3,0x003DE}},{{3,0x003DE},{3,0x003DE},{3,0x003DE},{3,0x003DE}},
+   {{3,0x003E1},{3,0x003E4},{3,0x003E1},{3,0x003E4}},{{3,0x003E4},{3,0x003E4},{3,0x003E4},{3,0x003E4}},
+   {{2,0x003E7},{2,0x003E9},{2,0x003E7},{2,0x003E9}},{{2,0x003E9},{2,0x003E9},{2,0x003E9},{2,0x003E9}},
+   {{2,0x003EB},{2,0x003ED},{2,0x003EB},{2,0x003ED}},{{2,0x003ED},{2,0x003ED},{2,0x003ED},{2,0x003ED}},
+   {{3,0x003EF},{3,0x003F2},{3,0x003EF},{3,0x003F2}},{{3,0x003F2},{3,0x003F2},{3,0x003F2},{3,0x003F2}},
+   {{2,0x003F5},{2,0x003F7},{2,0x003F5},{2,0x003F7}},{{2,0x003F7},{2,0x003F7},{2,0x003F7},{2,0x003F7}},
+   {{2,0x003F9},{2,0x003FB},{2,0x003F9},{2,0x003FB}},{{2,0x003FB},{2,0x003FB},{2,0x003FB},{2,0x003FB}},
+   {{2,0x003FD},{2,0x003FF},{2,0x003FD},{2,0x003FF}},{{2,0x003FF},{2,0x003FF},{2,0x003FF},{2,0x003FF}},
+   {{2,0x00401},{2,0x00403},{2,0x00401},{2,0x00403}},{{2,0x00403},{2,0x00403},{2,0x00403},{2,0x00403}},
+   {{2,0x00405},{2,0x00407},{2,0x00405},{2,0x00407}},{{2,0x00407},{2,0x00407},{2,0x00407},{2,0x00407}},
+   {{2,0x00409},{2,0x0040B},{2,0x00409},{2,0x0040B}},{{2,0x0040B},{2,0x0040B},{2,0x0040B},{2,0x0040B}},
+   {{2,0x0040D},{2,0x0040F},{2,0x0040D},{2,0x0040F}},{{2,0x0040F},{2,0x0040F},{2,0x0040F},{2,0x0040F}},
+   {{2,0x00411},{2,0x00413},{2,0x00411},{2,0x00413}},{{2,0x00413},{2,0x00413},{2,0x00413},{2,0x00413}},
+   {{3,0x00415},{3,0x00418},{3,0x00415},{3,0x00418}},{{3,0x00418},{3,0x00418},{3,0x00418},{3,0x00418}},
+   {{2,0x0041B},{2,0x0041D},{2,0x0041B},{2,0x0041D}},{{2,0x0041D},{2,0x0041D},{2,0x0041D},{2,0x0041D}},
+   {{2,0x0041F},{2,0x00421},{2,0x0041F},{2,0x00421}},{{2,0x00421},{2,0x00421},{2,0x00421},{2,0x00421}},
+   {{2,0x00423},{2,0x00425},{2,0x00423},{2,0x00425}},{{2,0x00425},{2,0x00425},{2,0x00425},{2,0x00425}},
+   {{2,0x00427},{2,0x00429},{2,0x00427},{2,0x00429}},{{2,0x00429},{2,0x00429},{2,0x00429},{2,0x00429}},
+   {{3,0x0042B},{3,0x0042E},{3,0x0042B},{3,0x0042E}},{{3,0x0042E},{3,0x0042E},{3,0x0042E},{3,0x0042E}},
+   {{2,0x00431},{2,0x00433},{2,0x00431},{2,0x00433}},{{2,0x00433},{2,0x00433},{2,0x00433},{2,0x00433}},
+   {{2,0x00435},{2,0x00437},{2,0x00435},{2,0x00437}},{{2,0x00437},{2,0x00437},{2,0x00437},{2,0x00437}},
+   {{2,0x00439},{2,0x0043B},{2,0x00439},{2,0x0043B}},{{2,0x0043B},{2,0x0043B},{2,0x0043B},{2,0x0043B}}
+  },
+
+  /* block 54 */
+  {{{2,0x0043D},{2,0x0043F},{2,0x0043D},{2,0x0043F}},{{2,0x0043F},{2,0x0043F},{2,0x0043F},{2,0x0043F}},
+   {{2,0x00441},{2,0x00443},{2,0x00441},{2,0x00443}},{{2,0x00443},{2,0x00443},{2,0x00443},{2,0x00443}},
+   {{2,0x00445},{2,0x00447},{2,0x00445},{2,0x00447}},{{2,0x00447},{2,0x00447},{2,0x00447},{2,0x00447}},
+   {{2,0x00449},{2,0x0044B},{2,0x00449},{2,0x0044B}},{{2,0x0044B},{2,0x0044B},{2,0x0044B},{2,0x0044B}},
+   {{2,0x0044D},{2,0x0044F},{2,0x0044D},{2,0x0044F}},{{2,0x0044F},{2,0x0044F},{2,0x0044F},{2,0x0044F}},
+   {{2,0x00451},{2,0x00453},{2,0x00451},{2,0x00453}},{{2,0x00453},{2,0x00453},{2,0x00453},{2,0x00453}},
+   {{3,0x00455},{3,0x00458},{3,0x00455},{3,0x00458}},{{3,0x00458},{3,0x00458},{3,0x00458},{3,0x00458}},
+   {{3,0x0045B},{3,0x0045E},{3,0x0045B},{3,0x0045E}},{{3,0x0045E},{3,0x0045E},{3,0x0045E},{3,0x0045E}},
+   {{3,0x00461},{3,0x00464},{3,0x00461},{3,0x00464}},{{3,0x00464},{3,0x00464},{3,0x00464},{3,0x00464}},
+   {{3,0x00467},{3,0x0046A},{3,0x00467},{3,0x0046A}},{{3,0x0046A},{3,0x0046A},{3,0x0046A},{3,0x0046A}},
+   {{2,0x0046D},{2,0x0046F},{2,0x0046D},{2,0x0046F}},{{2,0x0046F},{2,0x0046F},{2,0x0046F},{2,0x0046F}},
+   {{2,0x00471},{2,0x00473},{2,0x00471},{2,0x00473}},{{2,0x00473},{2,0x00473},{2,0x00473},{2,0x00473}},
+   {{2,0x00475},{2,0x00477},{2,0x00475},{2,0x00477}},{{2,0x00477},{2,0x00477},{2,0x00477},{2,0x00477}},
+   {{2,0x00479},{2,0x0047B},{2,0x00479},{2,0x0047B}},{{2,0x0047B},{2,0x0047B},{2,0x0047B},{2,0x0047B}},
+   {{3,0x0047D},{3,0x00480},{3,0x0047D},{3,0x00480}},{{3,0x00480},{3,0x00480},{3,0x00480},{3,0x00480}},
+   {{2,0x00483},{2,0x00485},{2,0x00483},{2,0x00485}},{{2,0x00485},{2,0x00485},{2,0x00485},{2,0x00485}},
+   {{2,0x00487},{2,0x00489},{2,0x00487},{2,0x00489}},{{2,0x00489},{2,0x00489},{2,0x00489},{2,0x00489}},
+   {{2,0x0048B},{2,0x0048D},{2,0x0048B},{2,0x0048D}},{{2,0x0048D},{2,0x0048D},{2,0x0048D},{2,0x0048D}},
+   {{3,0x0048F},{3,0x00492},{3,0x0048F},{3,0x00492}},{{3,0x00492},{3,0x00492},{3,0x00492},{3,0x00492}},
+   {{3,0x00495},{3,0x00498},{3,0x00495},{3,0x00498}},{{3,0x00498},{3,0x00498},{3,0x00498},{3,0x00498}},
+   {{3,0x0049B},{3,0x0049E},{3,0x0049B},{3,0x0049E}},{{3,0x0049E},{3,0x0049E},{3,0x0049E},{3,0x0049E}},
+   {{2,0x004A1},{2,0x004A3},{2,0x004A1},{2,0x004A3}},{{2,0x004A3},{2,0x004A3},{2,0x004A3},{2,0x004A3}},
+   {{2,0x004A5},{2,0x004A7},{2,0x004A5},{2,0x004A7}},{{2,0x004A7},{2,0x004A7},{2,0x004A7},{2,0x004A7}},
+   {{2,0x004A9},{2,0x004AB},{2,0x004A9},{2,0x004AB}},{{2,0x004AB},{2,0x004AB},{2,0x004AB},{2,0x004AB}},
+   {{2,0x004AD},{2,0x004AF},{2,0x004AD},{2,0x004AF}},{{2,0x004AF},{2,0x004AF},{2,0x004AF},{2,0x004AF}},
+   {{2,0x004B1},{2,0x004B3},{2,0x004B1},{2,0x004B3}},{{2,0x004B3},{2,0x004B3},{2,0x004B3},{2,0x004B3}},
+   {{2,0x004B5},{2,0x004B7},{2,0x004B5},{2,0x004B7}},{{2,0x004B7},{2,0x004B7},{2,0x004B7},{2,0x004B7}},
+   {{2,0x004B9},{2,0x004BB},{2,0x004B9},{2,0x004BB}},{{2,0x004BB},{2,0x004BB},{2,0x004BB},{2,0x004BB}},
+   {{3,0x004BD},{3,0x004C0},{3,0x004BD},{3,0x004C0}},{{3,0x004C0},{3,0x004C0},{3,0x004C0},{3,0x004C0}},
+   {{3,0x004C3},{3,0x004C6},{3,0x004C3},{3,0x004C6}},{{3,0x004C6},{3,0x004C6},{3,0x004C6},{3,0x004C6}},
+   {{2,0x004C9},{2,0x004CB},{2,0x004C9},{2,0x004CB}},{{2,0x004CB},{2,0x004CB},{2,0x004CB},{2,0x004CB}},
+   {{2,0x004CD},{2,0x004CF},{2,0x004CD},{2,0x004CF}},{{2,0x004CF},{2,0x004CF},{2,0x004CF},{2,0x004CF}}
+  },
+
+  /* block 55 */
+  {{{2,0x004D1},{2,0x004D3},{2,0x004D1},{2,0x004D3}},{{2,0x004D3},{2,0x004D3},{2,0x004D3},{2,0x004D3}},
+   {{2,0x004D5},{2,0x004D7},{2,0x004D5},{2,0x004D7}},{{2,0x004D7},{2,0x004D7},{2,0x004D7},{2,0x004D7}},
+   {{2,0x004D9},{2,0x004DB},{2,0x004D9},{2,0x004DB}},{{2,0x004DB},{2,0x004DB},{2,0x004DB},{2,0x004DB}},
+   {{2,0x004DD},{2,0x004DF},{2,0x004DD},{2,0x004DF}},{{2,0x004DF},{2,0x004DF},{2,0x004DF},{2,0x004DF}},
+   {{2,0x004E1},{2,0x004E3},{2,0x004E1},{2,0x004E3}},{{2,0x004E3},{2,0x004E3},{2,0x004E3},{2,0x004E3}},
+   {{2,0x004E5},{2,0x004E7},{2,0x004E5},{2,0x004E7}},{{2,0x004E7},{2,0x004E7},{2,0x004E7},{2,0x004E7}},
+   {{2,0x004E9},{2,0x004EB},{2,0x004E9},{2,0x004EB}},{{2,0x004EB},{2,0x004EB},{2,0x004EB},{2,0x004EB}},
+   {{2,0x004ED},{2,0x004EF},{2,0x004ED},{2,0x004EF}},{{2,0x004EF},{2,0x004EF},{2,0x004EF},{2,0x004EF}},
+   {{2,0x004F1},{2,0x004F3},{2,0x004F1},{2,0x004F3}},{{2,0x004F3},{2,0x004F3},{2,0x004F3},{2,0x004F3}},
+   {{2,0x004F5},{2,0x004F7},{2,0x004F5},{2,0x004F7}},{{2,0x004F7},{2,0x004F7},{2,0x004F7},{2,0x004F7}},
+   {{2,0x004F9},{2,0x004FB},{2,0x004F9},{2,0x004FB}},{{2,0x004FB},{2,0x004FB},{2,0x004FB},{2,0x004FB}},
+   {{2,0x004FD},{2,0x004FD},{2,0x004FD},{2,0x004FD}},{{2,0x004FF},{2,0x004FF},{2,0x004FF},{2,0x004FF}},
+   {{2,0x00501},{2,0x00501},{2,0x00501},{2,0x00501}},{{2,0x00503},{2,0x00503},{2,0x00503},{2,0x00503}},
+   {{0,0x00000},{2,0x00505},{2,0x00505},{2,0x00505}},{{2,0x00507},{2,0x00489},{2,0x00489},{2,0x00489}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{2,0x00079},{0,0x00000},{2,0x00079}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00509},{2,0x0050B},{2,0x00509},{2,0x0050B}},{{2,0x0050B},{2,0x0050B},{2,0x0050B},{2,0x0050B}},
+   {{2,0x0050D},{2,0x0050F},{2,0x0050D},{2,0x0050F}},{{2,0x0050F},{2,0x0050F},{2,0x0050F},{2,0x0050F}},
+   {{3,0x00511},{3,0x00514},{3,0x00511},{3,0x00514}},{{3,0x00514},{3,0x00514},{3,0x00514},{3,0x00514}},
+   {{3,0x00517},{3,0x0051A},{3,0x00517},{3,0x0051A}},{{3,0x0051A},{3,0x0051A},{3,0x0051A},{3,0x0051A}},
+   {{3,0x0051D},{3,0x00520},{3,0x0051D},{3,0x00520}},{{3,0x00520},{3,0x00520},{3,0x00520},{3,0x00520}},
+   {{3,0x00523},{3,0x00526},{3,0x00523},{3,0x00526}},{{3,0x00526},{3,0x00526},{3,0x00526},{3,0x00526}},
+   {{3,0x00529},{3,0x0052C},{3,0x00529},{3,0x0052C}},{{3,0x0052C},{3,0x0052C},{3,0x0052C},{3,0x0052C}},
+   {{3,0x0052F},{3,0x00532},{3,0x0052F},{3,0x00532}},{{3,0x00532},{3,0x00532},{3,0x00532},{3,0x00532}},
+   {{3,0x00535},{3,0x00538},{3,0x00535},{3,0x00538}},{{3,0x00538},{3,0x00538},{3,0x00538},{3,0x00538}},
+   {{3,0x0053B},{3,0x0053E},{3,0x0053B},{3,0x0053E}},{{3,0x0053E},{3,0x0053E},{3,0x0053E},{3,0x0053E}},
+   {{3,0x00541},{3,0x00544},{3,0x00541},{3,0x00544}},{{3,0x00544},{3,0x00544},{3,0x00544},{3,0x00544}},
+   {{3,0x00547},{3,0x0054A},{3,0x00547},{3,0x0054A}},{{3,0x0054A},{3,0x0054A},{3,0x0054A},{3,0x0054A}},
+   {{2,0x0054D},{2,0x0054F},{2,0x0054D},{2,0x0054F}},{{2,0x0054F},{2,0x0054F},{2,0x0054F},{2,0x0054F}},
+   {{2,0x00551},{2,0x00553},{2,0x00551},{2,0x00553}},{{2,0x00553},{2,0x00553},{2,0x00553},{2,0x00553}},
+   {{2,0x00555},{2,0x00557},{2,0x00555},{2,0x00557}},{{2,0x00557},{2,0x00557},{2,0x00557},{2,0x00557}},
+   {{3,0x00559},{3,0x0055C},{3,0x00559},{3,0x0055C}},{{3,0x0055C},{3,0x0055C},{3,0x0055C},{3,0x0055C}}
+  },
+
+  /* block 56 */
+  {{{3,0x0055F},{3,0x00562},{3,0x0055F},{3,0x00562}},{{3,0x00562},{3,0x00562},{3,0x00562},{3,0x00562}},
+   {{3,0x00565},{3,0x00568},{3,0x00565},{3,0x00568}},{{3,0x00568},{3,0x00568},{3,0x00568},{3,0x00568}},
+   {{3,0x0056B},{3,0x0056E},{3,0x0056B},{3,0x0056E}},{{3,0x0056E},{3,0x0056E},{3,0x0056E},{3,0x0056E}},
+   {{3,0x00571},{3,0x00574},{3,0x00571},{3,0x00574}},{{3,0x00574},{3,0x00574},{3,0x00574},{3,0x00574}},
+   {{2,0x00577},{2,0x00579},{2,0x00577},{2,0x00579}},{{2,0x00579},{2,0x00579},{2,0x00579},{2,0x00579}},
+   {{2,0x0057B},{2,0x0057D},{2,0x0057B},{2,0x0057D}},{{2,0x0057D},{2,0x0057D},{2,0x0057D},{2,0x0057D}},
+   {{2,0x0057F},{2,0x00581},{2,0x0057F},{2,0x00581}},{{2,0x00581},{2,0x00581},{2,0x00581},{2,0x00581}},
+   {{2,0x00583},{2,0x00585},{2,0x00583},{2,0x00585}},{{2,0x00585},{2,0x00585},{2,0x00585},{2,0x00585}},
+   {{3,0x00587},{3,0x0058A},{3,0x00587},{3,0x0058A}},{{3,0x0058A},{3,0x0058A},{3,0x0058A},{3,0x0058A}},
+   {{3,0x0058D},{3,0x00590},{3,0x0058D},{3,0x00590}},{{3,0x00590},{3,0x00590},{3,0x00590},{3,0x00590}},
+   {{3,0x00593},{3,0x00596},{3,0x00593},{3,0x00596}},{{3,0x00596},{3,0x00596},{3,0x00596},{3,0x00596}},
+   {{3,0x00599},{3,0x0059C},{3,0x00599},{3,0x0059C}},{{3,0x0059C},{3,0x0059C},{3,0x0059C},{3,0x0059C}},
+   {{3,0x0059F},{3,0x005A2},{3,0x0059F},{3,0x005A2}},{{3,0x005A2},{3,0x005A2},{3,0x005A2},{3,0x005A2}},
+   {{3,0x005A5},{3,0x005A8},{3,0x005A5},{3,0x005A8}},{{3,0x005A8},{3,0x005A8},{3,0x005A8},{3,0x005A8}},
+   {{3,0x005AB},{3,0x005AE},{3,0x005AB},{3,0x005AE}},{{3,0x005AE},{3,0x005AE},{3,0x005AE},{3,0x005AE}},
+   {{3,0x005B1},{3,0x005B4},{3,0x005B1},{3,0x005B4}},{{3,0x005B4},{3,0x005B4},{3,0x005B4},{3,0x005B4}},
+   {{3,0x005B7},{3,0x005BA},{3,0x005B7},{3,0x005BA}},{{3,0x005BA},{3,0x005BA},{3,0x005BA},{3,0x005BA}},
+   {{3,0x005BD},{3,0x005C0},{3,0x005BD},{3,0x005C0}},{{3,0x005C0},{3,0x005C0},{3,0x005C0},{3,0x005C0}},
+   {{2,0x005C3},{2,0x005C5},{2,0x005C3},{2,0x005C5}},{{2,0x005C5},{2,0x005C5},{2,0x005C5},{2,0x005C5}},
+   {{2,0x005C7},{2,0x005C9},{2,0x005C7},{2,0x005C9}},{{2,0x005C9},{2,0x005C9},{2,0x005C9},{2,0x005C9}},
+   {{3,0x005CB},{3,0x005CE},{3,0x005CB},{3,0x005CE}},{{3,0x005CE},{3,0x005CE},{3,0x005CE},{3,0x005CE}},
+   {{3,0x005D1},{3,0x005D4},{3,0x005D1},{3,0x005D4}},{{3,0x005D4},{3,0x005D4},{3,0x005D4},{3,0x005D4}},
+   {{3,0x005D7},{3,0x005DA},{3,0x005D7},{3,0x005DA}},{{3,0x005DA},{3,0x005DA},{3,0x005DA},{3,0x005DA}},
+   {{3,0x005DD},{3,0x005E0},{3,0x005DD},{3,0x005E0}},{{3,0x005E0},{3,0x005E0},{3,0x005E0},{3,0x005E0}},
+   {{3,0x005E3},{3,0x005E6},{3,0x005E3},{3,0x005E6}},{{3,0x005E6},{3,0x005E6},{3,0x005E6},{3,0x005E6}},
+   {{2,0x005E9},{2,0x005EB},{2,0x005E9},{2,0x005EB}},{{2,0x005EB},{2,0x005EB},{2,0x005EB},{2,0x005EB}},
+   {{2,0x005ED},{2,0x005EF},{2,0x005ED},{2,0x005EF}},{{2,0x005EF},{2,0x005EF},{2,0x005EF},{2,0x005EF}},
+   {{2,0x005F1},{2,0x005F3},{2,0x005F1},{2,0x005F3}},{{2,0x005F3},{2,0x005F3},{2,0x005F3},{2,0x005F3}},
+   {{2,0x005F5},{2,0x005F7},{2,0x005F5},{2,0x005F7}},{{2,0x005F7},{2,0x005F7},{2,0x005F7},{2,0x005F7}},
+   {{0,0x00000},{1,0x01EFB},{0,0x00000},{1,0x01EFB}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x01EFD},{0,0x00000},{1,0x01EFD}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x01EFF},{0,0x00000},{1,0x01EFF}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 57 */
+  {{{2,0x005F9},{2,0x005F9},{2,0x005F9},{2,0x005F9}},{{2,0x005FB},{2,0x005FB},{2,0x005FB},{2,0x005FB}},
+   {{3,0x005FD},{3,0x005FD},{3,0x005FD},{3,0x005FD}},{{3,0x00600},{3,0x00600},{3,0x00600},{3,0x00600}},
+   {{3,0x00603},{3,0x00603},{3,0x00603},{3,0x00603}},{{3,0x00606},{3,0x00606},{3,0x00606},{3,0x00606}},
+   {{3,0x00609},{3,0x00609},{3,0x00609},{3,0x00609}},{{3,0x0060C},{3,0x0060C},{3,0x0060C},{3,0x0060C}},
+   {{2,0x0060F},{2,0x005F9},{2,0x0060F},{2,0x005F9}},{{2,0x00611},{2,0x005FB},{2,0x00611},{2,0x005FB}},
+   {{3,0x00613},{3,0x005FD},{3,0x00613},{3,0x005FD}},{{3,0x00616},{3,0x00600},{3,0x00616},{3,0x00600}},
+   {{3,0x00619},{3,0x00603},{3,0x00619},{3,0x00603}},{{3,0x0061C},{3,0x00606},{3,0x0061C},{3,0x00606}},
+   {{3,0x0061F},{3,0x00609},{3,0x0061F},{3,0x00609}},{{3,0x00622},{3,0x0060C},{3,0x00622},{3,0x0060C}},
+   {{2,0x00625},{2,0x00625},{2,0x00625},{2,0x00625}},{{2,0x00627},{2,0x00627},{2,0x00627},{2,0x00627}},
+   {{3,0x00629},{3,0x00629},{3,0x00629},{3,0x00629}},{{3,0x0062C},{3,0x0062C},{3,0x0062C},{3,0x0062C}},
+   {{3,0x0062F},{3,0x0062F},{3,0x0062F},{3,0x0062F}},{{3,0x00632},{3,0x00632},{3,0x00632},{3,0x00632}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00635},{2,0x00625},{2,0x00635},{2,0x00625}},{{2,0x00637},{2,0x00627},{2,0x00637},{2,0x00627}},
+   {{3,0x00639},{3,0x00629},{3,0x00639},{3,0x00629}},{{3,0x0063C},{3,0x0062C},{3,0x0063C},{3,0x0062C}},
+   {{3,0x0063F},{3,0x0062F},{3,0x0063F},{3,0x0062F}},{{3,0x00642},{3,0x00632},{3,0x00642},{3,0x00632}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00645},{2,0x00645},{2,0x00645},{2,0x00645}},{{2,0x00647},{2,0x00647},{2,0x00647},{2,0x00647}},
+   {{3,0x00649},{3,0x00649},{3,0x00649},{3,0x00649}},{{3,0x0064C},{3,0x0064C},{3,0x0064C},{3,0x0064C}},
+   {{3,0x0064F},{3,0x0064F},{3,0x0064F},{3,0x0064F}},{{3,0x00652},{3,0x00652},{3,0x00652},{3,0x00652}},
+   {{3,0x00655},{3,0x00655},{3,0x00655},{3,0x00655}},{{3,0x00658},{3,0x00658},{3,0x00658},{3,0x00658}},
+   {{2,0x0065B},{2,0x00645},{2,0x0065B},{2,0x00645}},{{2,0x0065D},{2,0x00647},{2,0x0065D},{2,0x00647}},
+   {{3,0x0065F},{3,0x00649},{3,0x0065F},{3,0x00649}},{{3,0x00662},{3,0x0064C},{3,0x00662},{3,0x0064C}},
+   {{3,0x00665},{3,0x0064F},{3,0x00665},{3,0x0064F}},{{3,0x00668},{3,0x00652},{3,0x00668},{3,0x00652}},
+   {{3,0x0066B},{3,0x00655},{3,0x0066B},{3,0x00655}},{{3,0x0066E},{3,0x00658},{3,0x0066E},{3,0x00658}},
+   {{2,0x00671},{2,0x00671},{2,0x00671},{2,0x00671}},{{2,0x00673},{2,0x00673},{2,0x00673},{2,0x00673}},
+   {{3,0x00675},{3,0x00675},{3,0x00675},{3,0x00675}},{{3,0x00678},{3,0x00678},{3,0x00678},{3,0x00678}},
+   {{3,0x0067B},{3,0x0067B},{3,0x0067B},{3,0x0067B}},{{3,0x0067E},{3,0x0067E},{3,0x0067E},{3,0x0067E}},
+   {{3,0x00681},{3,0x00681},{3,0x00681},{3,0x00681}},{{3,0x00684},{3,0x00684},{3,0x00684},{3,0x00684}},
+   {{2,0x00687},{2,0x00671},{2,0x00687},{2,0x00671}},{{2,0x00689},{2,0x00673},{2,0x00689},{2,0x00673}},
+   {{3,0x0068B},{3,0x00675},{3,0x0068B},{3,0x00675}},{{3,0x0068E},{3,0x00678},{3,0x0068E},{3,0x00678}},
+   {{3,0x00691},{3,0x0067B},{3,0x00691},{3,0x0067B}},{{3,0x00694},{3,0x0067E},{3,0x00694},{3,0x0067E}},
+   {{3,0x00697},{3,0x00681},{3,0x00697},{3,0x00681}},{{3,0x0069A},{3,0x00684},{3,0x0069A},{3,0x00684}}
+  },
+
+  /* block 58 */
+  {{{2,0x0069D},{2,0x0069D},{2,0x0069D},{2,0x0069D}},{{2,0x0069F},{2,0x0069F},{2,0x0069F},{2,0x0069F}},
+   {{3,0x006A1},{3,0x006A1},{3,0x006A1},{3,0x006A1}},{{3,0x006A4},{3,0x006A4},{3,0x006A4},{3,0x006A4}},
+   {{3,0x006A7},{3,0x006A7},{3,0x006A7},{3,0x006A7}},{{3,0x006AA},{3,0x006AA},{3,0x006AA},{3,0x006AA}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x006AD},{2,0x0069D},{2,0x006AD},{2,0x0069D}},{{2,0x006AF},{2,0x0069F},{2,0x006AF},{2,0x0069F}},
+   {{3,0x006B1},{3,0x006A1},{3,0x006B1},{3,0x006A1}},{{3,0x006B4},{3,0x006A4},{3,0x006B4},{3,0x006A4}},
+   {{3,0x006B7},{3,0x006A7},{3,0x006B7},{3,0x006A7}},{{3,0x006BA},{3,0x006AA},{3,0x006BA},{3,0x006AA}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x006BD},{2,0x006BD},{2,0x006BD},{2,0x006BD}},{{2,0x006BF},{2,0x006BF},{2,0x006BF},{2,0x006BF}},
+   {{3,0x006C1},{3,0x006C1},{3,0x006C1},{3,0x006C1}},{{3,0x006C4},{3,0x006C4},{3,0x006C4},{3,0x006C4}},
+   {{3,0x006C7},{3,0x006C7},{3,0x006C7},{3,0x006C7}},{{3,0x006CA},{3,0x006CA},{3,0x006CA},{3,0x006CA}},
+   {{3,0x006CD},{3,0x006CD},{3,0x006CD},{3,0x006CD}},{{3,0x006D0},{3,0x006D0},{3,0x006D0},{3,0x006D0}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x006D3},{2,0x006BF},{2,0x006D3},{2,0x006BF}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{3,0x006D5},{3,0x006C4},{3,0x006D5},{3,0x006C4}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{3,0x006D8},{3,0x006CA},{3,0x006D8},{3,0x006CA}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{3,0x006DB},{3,0x006D0},{3,0x006DB},{3,0x006D0}},
+   {{2,0x006DE},{2,0x006DE},{2,0x006DE},{2,0x006DE}},{{2,0x006E0},{2,0x006E0},{2,0x006E0},{2,0x006E0}},
+   {{3,0x006E2},{3,0x006E2},{3,0x006E2},{3,0x006E2}},{{3,0x006E5},{3,0x006E5},{3,0x006E5},{3,0x006E5}},
+   {{3,0x006E8},{3,0x006E8},{3,0x006E8},{3,0x006E8}},{{3,0x006EB},{3,0x006EB},{3,0x006EB},{3,0x006EB}},
+   {{3,0x006EE},{3,0x006EE},{3,0x006EE},{3,0x006EE}},{{3,0x006F1},{3,0x006F1},{3,0x006F1},{3,0x006F1}},
+   {{2,0x006F4},{2,0x006DE},{2,0x006F4},{2,0x006DE}},{{2,0x006F6},{2,0x006E0},{2,0x006F6},{2,0x006E0}},
+   {{3,0x006F8},{3,0x006E2},{3,0x006F8},{3,0x006E2}},{{3,0x006FB},{3,0x006E5},{3,0x006FB},{3,0x006E5}},
+   {{3,0x006FE},{3,0x006E8},{3,0x006FE},{3,0x006E8}},{{3,0x00701},{3,0x006EB},{3,0x00701},{3,0x006EB}},
+   {{3,0x00704},{3,0x006EE},{3,0x00704},{3,0x006EE}},{{3,0x00707},{3,0x006F1},{3,0x00707},{3,0x006F1}},
+   {{2,0x0070A},{2,0x0070A},{2,0x0070A},{2,0x0070A}},{{2,0x00261},{2,0x00261},{2,0x00261},{2,0x00261}},
+   {{2,0x0070C},{2,0x0070C},{2,0x0070C},{2,0x0070C}},{{2,0x00265},{2,0x00265},{2,0x00265},{2,0x00265}},
+   {{2,0x0070E},{2,0x0070E},{2,0x0070E},{2,0x0070E}},{{2,0x00269},{2,0x00269},{2,0x00269},{2,0x00269}},
+   {{2,0x00710},{2,0x00710},{2,0x00710},{2,0x00710}},{{2,0x0026D},{2,0x0026D},{2,0x0026D},{2,0x0026D}},
+   {{2,0x00712},{2,0x00712},{2,0x00712},{2,0x00712}},{{2,0x00271},{2,0x00271},{2,0x00271},{2,0x00271}},
+   {{2,0x00714},{2,0x00714},{2,0x00714},{2,0x00714}},{{2,0x00275},{2,0x00275},{2,0x00275},{2,0x00275}},
+   {{2,0x00716},{2,0x00716},{2,0x00716},{2,0x00716}},{{2,0x00279},{2,0x00279},{2,0x00279},{2,0x00279}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 59 */
+  {{{3,0x00718},{3,0x0071B},{3,0x00718},{3,0x0071B}},{{3,0x0071E},{3,0x00721},{3,0x0071E},{3,0x00721}},
+   {{4,0x00724},{4,0x00728},{4,0x00724},{4,0x00728}},{{4,0x0072C},{4,0x00730},{4,0x0072C},{4,0x00730}},
+   {{4,0x00734},{4,0x00738},{4,0x00734},{4,0x00738}},{{4,0x0073C},{4,0x00740},{4,0x0073C},{4,0x00740}},
+   {{4,0x00744},{4,0x00748},{4,0x00744},{4,0x00748}},{{4,0x0074C},{4,0x00750},{4,0x0074C},{4,0x00750}},
+   {{3,0x00754},{3,0x0071B},{3,0x00754},{3,0x0071B}},{{3,0x00757},{3,0x00721},{3,0x00757},{3,0x00721}},
+   {{4,0x0075A},{4,0x00728},{4,0x0075A},{4,0x00728}},{{4,0x0075E},{4,0x00730},{4,0x0075E},{4,0x00730}},
+   {{4,0x00762},{4,0x00738},{4,0x00762},{4,0x00738}},{{4,0x00766},{4,0x00740},{4,0x00766},{4,0x00740}},
+   {{4,0x0076A},{4,0x00748},{4,0x0076A},{4,0x00748}},{{4,0x0076E},{4,0x00750},{4,0x0076E},{4,0x00750}},
+   {{3,0x00772},{3,0x00775},{3,0x00772},{3,0x00775}},{{3,0x00778},{3,0x0077B},{3,0x00778},{3,0x0077B}},
+   {{4,0x0077E},{4,0x00782},{4,0x0077E},{4,0x00782}},{{4,0x00786},{4,0x0078A},{4,0x00786},{4,0x0078A}},
+   {{4,0x0078E},{4,0x00792},{4,0x0078E},{4,0x00792}},{{4,0x00796},{4,0x0079A},{4,0x00796},{4,0x0079A}},
+   {{4,0x0079E},{4,0x007A2},{4,0x0079E},{4,0x007A2}},{{4,0x007A6},{4,0x007AA},{4,0x007A6},{4,0x007AA}},
+   {{3,0x007AE},{3,0x00775},{3,0x007AE},{3,0x00775}},{{3,0x007B1},{3,0x0077B},{3,0x007B1},{3,0x0077B}},
+   {{4,0x007B4},{4,0x00782},{4,0x007B4},{4,0x00782}},{{4,0x007B8},{4,0x0078A},{4,0x007B8},{4,0x0078A}},
+   {{4,0x007BC},{4,0x00792},{4,0x007BC},{4,0x00792}},{{4,0x007C0},{4,0x0079A},{4,0x007C0},{4,0x0079A}},
+   {{4,0x007C4},{4,0x007A2},{4,0x007C4},{4,0x007A2}},{{4,0x007C8},{4,0x007AA},{4,0x007C8},{4,0x007AA}},
+   {{3,0x007CC},{3,0x007CF},{3,0x007CC},{3,0x007CF}},{{3,0x007D2},{3,0x007D5},{3,0x007D2},{3,0x007D5}},
+   {{4,0x007D8},{4,0x007DC},{4,0x007D8},{4,0x007DC}},{{4,0x007E0},{4,0x007E4},{4,0x007E0},{4,0x007E4}},
+   {{4,0x007E8},{4,0x007EC},{4,0x007E8},{4,0x007EC}},{{4,0x007F0},{4,0x007F4},{4,0x007F0},{4,0x007F4}},
+   {{4,0x007F8},{4,0x007FC},{4,0x007F8},{4,0x007FC}},{{4,0x00800},{4,0x00804},{4,0x00800},{4,0x00804}},
+   {{3,0x00808},{3,0x007CF},{3,0x00808},{3,0x007CF}},{{3,0x0080B},{3,0x007D5},{3,0x0080B},{3,0x007D5}},
+   {{4,0x0080E},{4,0x007DC},{4,0x0080E},{4,0x007DC}},{{4,0x00812},{4,0x007E4},{4,0x00812},{4,0x007E4}},
+   {{4,0x00816},{4,0x007EC},{4,0x00816},{4,0x007EC}},{{4,0x0081A},{4,0x007F4},{4,0x0081A},{4,0x007F4}},
+   {{4,0x0081E},{4,0x007FC},{4,0x0081E},{4,0x007FC}},{{4,0x00822},{4,0x00804},{4,0x00822},{4,0x00804}},
+   {{2,0x00826},{2,0x00826},{2,0x00826},{2,0x00826}},{{2,0x00828},{2,0x00828},{2,0x00828},{2,0x00828}},
+   {{3,0x0082A},{3,0x0082D},{3,0x0082A},{3,0x0082D}},{{2,0x00830},{2,0x00832},{2,0x00830},{2,0x00832}},
+   {{3,0x00834},{3,0x00837},{3,0x00834},{3,0x00837}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x0083A},{2,0x0083A},{2,0x0083A},{2,0x0083A}},{{3,0x0083C},{3,0x0083F},{3,0x0083C},{3,0x0083F}},
+   {{2,0x00842},{2,0x00826},{2,0x00842},{2,0x00826}},{{2,0x00844},{2,0x00828},{2,0x00844},{2,0x00828}},
+   {{2,0x00846},{2,0x0070A},{2,0x00846},{2,0x0070A}},{{2,0x0025F},{2,0x00261},{2,0x0025F},{2,0x00261}},
+   {{2,0x00848},{2,0x00832},{2,0x00848},{2,0x00832}},{{0,0x00000},{0,0x00000},{2,0x0084A},{2,0x0084A}},
+   {{1,0x003B9},{1,0x003B9},{1,0x003B9},{1,0x003B9}},{{0,0x00000},{0,0x00000},{2,0x0084A},{2,0x0084A}}
+  },
+
+  /* block 60 */
+  {{{0,0x00000},{0,0x00000},{2,0x0084C},{2,0x0084C}},{{2,0x0084E},{2,0x0084E},{3,0x00850},{3,0x00850}},
+   {{3,0x00853},{3,0x00856},{3,0x00853},{3,0x00856}},{{2,0x00859},{2,0x0085B},{2,0x00859},{2,0x0085B}},
+   {{3,0x0085D},{3,0x00860},{3,0x0085D},{3,0x00860}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00863},{2,0x00863},{2,0x00863},{2,0x00863}},{{3,0x00865},{3,0x00868},{3,0x00865},{3,0x00868}},
+   {{2,0x0086B},{2,0x0070C},{2,0x0086B},{2,0x0070C}},{{2,0x00263},{2,0x00265},{2,0x00263},{2,0x00265}},
+   {{2,0x0086D},{2,0x0070E},{2,0x0086D},{2,0x0070E}},{{2,0x00267},{2,0x00269},{2,0x00267},{2,0x00269}},
+   {{2,0x0086F},{2,0x0085B},{2,0x0086F},{2,0x0085B}},{{2,0x00871},{2,0x00871},{3,0x00873},{3,0x00873}},
+   {{2,0x00876},{2,0x00876},{3,0x00878},{3,0x00878}},{{2,0x0087B},{2,0x0087B},{3,0x0087D},{3,0x0087D}},
+   {{2,0x00880},{2,0x00880},{2,0x00880},{2,0x00880}},{{2,0x00882},{2,0x00882},{2,0x00882},{2,0x00882}},
+   {{3,0x00884},{3,0x00884},{3,0x00884},{3,0x00884}},{{3,0x0027B},{3,0x0027B},{3,0x0027B},{3,0x0027B}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00887},{2,0x00887},{2,0x00887},{2,0x00887}},{{3,0x00889},{3,0x00889},{3,0x00889},{3,0x00889}},
+   {{2,0x0088C},{2,0x00880},{2,0x0088C},{2,0x00880}},{{2,0x0088E},{2,0x00882},{2,0x0088E},{2,0x00882}},
+   {{2,0x00890},{2,0x00710},{2,0x00890},{2,0x00710}},{{2,0x0026B},{2,0x0026D},{2,0x0026B},{2,0x0026D}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x00892},{2,0x00892},{3,0x00894},{3,0x00894}},
+   {{2,0x00897},{2,0x00897},{3,0x00899},{3,0x00899}},{{2,0x0089C},{2,0x0089C},{3,0x0089E},{3,0x0089E}},
+   {{2,0x008A1},{2,0x008A1},{2,0x008A1},{2,0x008A1}},{{2,0x008A3},{2,0x008A3},{2,0x008A3},{2,0x008A3}},
+   {{3,0x008A5},{3,0x008A5},{3,0x008A5},{3,0x008A5}},{{3,0x00286},{3,0x00286},{3,0x00286},{3,0x00286}},
+   {{2,0x008A8},{2,0x008A8},{2,0x008A8},{2,0x008A8}},{{2,0x008AA},{2,0x008AA},{2,0x008AA},{2,0x008AA}},
+   {{2,0x008AC},{2,0x008AC},{2,0x008AC},{2,0x008AC}},{{3,0x008AE},{3,0x008AE},{3,0x008AE},{3,0x008AE}},
+   {{2,0x008B1},{2,0x008A1},{2,0x008B1},{2,0x008A1}},{{2,0x008B3},{2,0x008A3},{2,0x008B3},{2,0x008A3}},
+   {{2,0x008B5},{2,0x00714},{2,0x008B5},{2,0x00714}},{{2,0x00273},{2,0x00275},{2,0x00273},{2,0x00275}},
+   {{2,0x008B7},{2,0x008AA},{2,0x008B7},{2,0x008AA}},{{2,0x008B9},{2,0x008B9},{3,0x008BB},{3,0x008BB}},
+   {{2,0x0025A},{2,0x0025A},{3,0x0025C},{3,0x0025C}},{{1,0x00060},{1,0x00060},{1,0x00060},{1,0x00060}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{3,0x008BE},{3,0x008C1},{3,0x008BE},{3,0x008C1}},{{2,0x008C4},{2,0x008C6},{2,0x008C4},{2,0x008C6}},
+   {{3,0x008C8},{3,0x008CB},{3,0x008C8},{3,0x008CB}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x008CE},{2,0x008CE},{2,0x008CE},{2,0x008CE}},{{3,0x008D0},{3,0x008D3},{3,0x008D0},{3,0x008D3}},
+   {{2,0x008D6},{2,0x00712},{2,0x008D6},{2,0x00712}},{{2,0x0026F},{2,0x00271},{2,0x0026F},{2,0x00271}},
+   {{2,0x008D8},{2,0x00716},{2,0x008D8},{2,0x00716}},{{2,0x00277},{2,0x00279},{2,0x00277},{2,0x00279}},
+   {{2,0x008DA},{2,0x008C6},{2,0x008DA},{2,0x008C6}},{{1,0x000B4},{1,0x000B4},{2,0x00004},{2,0x00004}},
+   {{0,0x00000},{0,0x00000},{2,0x008DC},{2,0x008DC}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 61 */
+  {{{1,0x02002},{1,0x02002},{1,0x00020},{1,0x00020}},{{1,0x02003},{1,0x02003},{1,0x00020},{1,0x00020}},
+   {{0,0x00000},{0,0x00000},{1,0x00020},{1,0x00020}},{{0,0x00000},{0,0x00000},{1,0x00020},{1,0x00020}},
+   {{0,0x00000},{0,0x00000},{1,0x00020},{1,0x00020}},{{0,0x00000},{0,0x00000},{1,0x00020},{1,0x00020}},
+   {{0,0x00000},{0,0x00000},{1,0x00020},{1,0x00020}},{{0,0x00000},{0,0x00000},{1,0x00020},{1,0x00020}},
+   {{0,0x00000},{0,0x00000},{1,0x00020},{1,0x00020}},{{0,0x00000},{0,0x00000},{1,0x00020},{1,0x00020}},
+   {{0,0x00000},{0,0x00000},{1,0x00020},{1,0x00020}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x02010},{1,0x02010}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{2,0x008DE},{2,0x008DE}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x0002E},{1,0x0002E}},{{0,0x00000},{0,0x00000},{2,0x008E0},{2,0x008E0}},
+   {{0,0x00000},{0,0x00000},{3,0x008E2},{3,0x008E2}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x00020},{1,0x00020}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{2,0x008E5},{2,0x008E5}},
+   {{0,0x00000},{0,0x00000},{3,0x008E7},{3,0x008E7}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{2,0x008EA},{2,0x008EA}},{{0,0x00000},{0,0x00000},{3,0x008EC},{3,0x008EC}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{2,0x008EF},{2,0x008EF}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{2,0x008F1},{2,0x008F1}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 62 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{2,0x008F3},{2,0x008F3}},
+   {{0,0x00000},{0,0x00000},{2,0x008F5},{2,0x008F5}},{{0,0x00000},{0,0x00000},{2,0x008F7},{2,0x008F7}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{4,0x008F9},{4,0x008F9}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x00020},{1,0x00020}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x00030},{1,0x00030}},{{0,0x00000},{0,0x00000},{1,0x00069},{1,0x00069}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x00034},{1,0x00034}},{{0,0x00000},{0,0x00000},{1,0x00035},{1,0x00035}},
+   {{0,0x00000},{0,0x00000},{1,0x00036},{1,0x00036}},{{0,0x00000},{0,0x00000},{1,0x00037},{1,0x00037}},
+   {{0,0x00000},{0,0x00000},{1,0x00038},{1,0x00038}},{{0,0x00000},{0,0x00000},{1,0x00039},{1,0x00039}},
+   {{0,0x00000},{0,0x00000},{1,0x0002B},{1,0x0002B}},{{0,0x00000},{0,0x00000},{1,0x02212},{1,0x02212}},
+   {{0,0x00000},{0,0x00000},{1,0x0003D},{1,0x0003D}},{{0,0x00000},{0,0x00000},{1,0x00028},{1,0x00028}},
+   {{0,0x00000},{0,0x00000},{1,0x00029},{1,0x00029}},{{0,0x00000},{0,0x00000},{1,0x0006E},{1,0x0006E}}
+  },
+
+  /* block 63 */
+  {{{0,0x00000},{0,0x00000},{1,0x00030},{1,0x00030}},{{0,0x00000},{0,0x00000},{1,0x00031},{1,0x00031}},
+   {{0,0x00000},{0,0x00000},{1,0x00032},{1,0x00032}},{{0,0x00000},{0,0x00000},{1,0x00033},{1,0x00033}},
+   {{0,0x00000},{0,0x00000},{1,0x00034},{1,0x00034}},{{0,0x00000},{0,0x00000},{1,0x00035},{1,0x00035}},
+   {{0,0x00000},{0,0x00000},{1,0x00036},{1,0x00036}},{{0,0x00000},{0,0x00000},{1,0x00037},{1,0x00037}},
+   {{0,0x00000},{0,0x00000},{1,0x00038},{1,0x00038}},{{0,0x00000},{0,0x00000},{1,0x00039},{1,0x00039}},
+   {{0,0x00000},{0,0x00000},{1,0x0002B},{1,0x0002B}},{{0,0x00000},{0,0x00000},{1,0x02212},{1,0x02212}},
+   {{0,0x00000},{0,0x00000},{1,0x0003D},{1,0x0003D}},{{0,0x00000},{0,0x00000},{1,0x00028},{1,0x00028}},
+   {{0,0x00000},{0,0x00000},{1,0x00029},{1,0x00029}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x00061},{1,0x00061}},{{0,0x00000},{0,0x00000},{1,0x00065},{1,0x00065}},
+   {{0,0x00000},{0,0x00000},{1,0x0006F},{1,0x0006F}},{{0,0x00000},{0,0x00000},{1,0x00078},{1,0x00078}},
+   {{0,0x00000},{0,0x00000},{1,0x00259},{1,0x00259}},{{0,0x00000},{0,0x00000},{1,0x00068},{1,0x00068}},
+   {{0,0x00000},{0,0x00000},{1,0x0006B},{1,0x0006B}},{{0,0x00000},{0,0x00000},{1,0x0006C},{1,0x0006C}},
+   {{0,0x00000},{0,0x00000},{1,0x0006D},{1,0x0006D}},{{0,0x00000},{0,0x00000},{1,0x0006E},{1,0x0006E}},
+   {{0,0x00000},{0,0x00000},{1,0x00070},{1,0x00070}},{{0,0x00000},{0,0x00000},{1,0x00073},{1,0x00073}},
+   {{0,0x00000},{0,0x00000},{1,0x00074},{1,0x00074}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{2,0x008FD},{2,0x008FF}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 64 */
+  {{{0,0x00000},{0,0x00000},{3,0x00901},{3,0x00901}},{{0,0x00000},{0,0x00000},{3,0x00904},{3,0x00904}},
+   {{0,0x00000},{0,0x00000},{1,0x00043},{1,0x00063}},{{0,0x00000},{0,0x00000},{2,0x00907},{2,0x00909}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{3,0x0090B},{3,0x0090B}},
+   {{0,0x00000},{0,0x00000},{3,0x0090E},{3,0x0090E}},{{0,0x00000},{0,0x00000},{1,0x00190},{1,0x0025B}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{2,0x00911},{2,0x00913}},
+   {{0,0x00000},{0,0x00000},{1,0x00067},{1,0x00067}},{{0,0x00000},{0,0x00000},{1,0x00048},{1,0x00068}},
+   {{0,0x00000},{0,0x00000},{1,0x00048},{1,0x00068}},{{0,0x00000},{0,0x00000},{1,0x00048},{1,0x00068}},
+   {{0,0x00000},{0,0x00000},{1,0x00068},{1,0x00068}},{{0,0x00000},{0,0x00000},{1,0x00127},{1,0x00127}},
+   {{0,0x00000},{0,0x00000},{1,0x00049},{1,0x00069}},{{0,0x00000},{0,0x00000},{1,0x00049},{1,0x00069}},
+   {{0,0x00000},{0,0x00000},{1,0x0004C},{1,0x0006C}},{{0,0x00000},{0,0x00000},{1,0x0006C},{1,0x0006C}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x0004E},{1,0x0006E}},
+   {{0,0x00000},{0,0x00000},{2,0x00915},{2,0x00917}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x00050},{1,0x00070}},
+   {{0,0x00000},{0,0x00000},{1,0x00051},{1,0x00071}},{{0,0x00000},{0,0x00000},{1,0x00052},{1,0x00072}},
+   {{0,0x00000},{0,0x00000},{1,0x00052},{1,0x00072}},{{0,0x00000},{0,0x00000},{1,0x00052},{1,0x00072}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{2,0x00919},{2,0x0091B}},{{0,0x00000},{0,0x00000},{3,0x0091D},{3,0x00920}},
+   {{0,0x00000},{0,0x00000},{2,0x00923},{2,0x00925}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x0005A},{1,0x0007A}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{1,0x003A9},{1,0x003C9},{1,0x003A9},{1,0x003C9}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x0005A},{1,0x0007A}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{1,0x0004B},{1,0x0006B},{1,0x0004B},{1,0x0006B}},{{2,0x00025},{2,0x00027},{2,0x00025},{2,0x00027}},
+   {{0,0x00000},{0,0x00000},{1,0x00042},{1,0x00062}},{{0,0x00000},{0,0x00000},{1,0x00043},{1,0x00063}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x00065},{1,0x00065}},
+   {{0,0x00000},{0,0x00000},{1,0x00045},{1,0x00065}},{{0,0x00000},{0,0x00000},{1,0x00046},{1,0x00066}},
+   {{0,0x00000},{1,0x0214E},{0,0x00000},{1,0x0214E}},{{0,0x00000},{0,0x00000},{1,0x0004D},{1,0x0006D}},
+   {{0,0x00000},{0,0x00000},{1,0x0006F},{1,0x0006F}},{{0,0x00000},{0,0x00000},{1,0x005D0},{1,0x005D0}},
+   {{0,0x00000},{0,0x00000},{1,0x005D1},{1,0x005D1}},{{0,0x00000},{0,0x00000},{1,0x005D2},{1,0x005D2}},
+   {{0,0x00000},{0,0x00000},{1,0x005D3},{1,0x005D3}},{{0,0x00000},{0,0x00000},{1,0x00069},{1,0x00069}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{3,0x00927},{3,0x0092A}},
+   {{0,0x00000},{0,0x00000},{1,0x003C0},{1,0x003C0}},{{0,0x00000},{0,0x00000},{1,0x003B3},{1,0x003B3}},
+   {{0,0x00000},{0,0x00000},{1,0x00393},{1,0x003B3}},{{0,0x00000},{0,0x00000},{1,0x003A0},{1,0x003C0}}
+  },
+
+  /* block 65 */
+  {{{0,0x00000},{0,0x00000},{1,0x02211},{1,0x02211}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x00044},{1,0x00064}},
+   {{0,0x00000},{0,0x00000},{1,0x00064},{1,0x00064}},{{0,0x00000},{0,0x00000},{1,0x00065},{1,0x00065}},
+   {{0,0x00000},{0,0x00000},{1,0x00069},{1,0x00069}},{{0,0x00000},{0,0x00000},{1,0x0006A},{1,0x0006A}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{3,0x0092D},{3,0x0092D}},{{0,0x00000},{0,0x00000},{3,0x00930},{3,0x00930}},
+   {{0,0x00000},{0,0x00000},{4,0x00933},{4,0x00933}},{{0,0x00000},{0,0x00000},{3,0x00937},{3,0x00937}},
+   {{0,0x00000},{0,0x00000},{3,0x0093A},{3,0x0093A}},{{0,0x00000},{0,0x00000},{3,0x0093D},{3,0x0093D}},
+   {{0,0x00000},{0,0x00000},{3,0x00940},{3,0x00940}},{{0,0x00000},{0,0x00000},{3,0x00943},{3,0x00943}},
+   {{0,0x00000},{0,0x00000},{3,0x00946},{3,0x00946}},{{0,0x00000},{0,0x00000},{3,0x00949},{3,0x00949}},
+   {{0,0x00000},{0,0x00000},{3,0x0094C},{3,0x0094C}},{{0,0x00000},{0,0x00000},{3,0x0094F},{3,0x0094F}},
+   {{0,0x00000},{0,0x00000},{3,0x00952},{3,0x00952}},{{0,0x00000},{0,0x00000},{3,0x00955},{3,0x00955}},
+   {{0,0x00000},{0,0x00000},{3,0x00958},{3,0x00958}},{{0,0x00000},{0,0x00000},{2,0x0095B},{2,0x0095B}},
+   {{0,0x00000},{1,0x02170},{1,0x00049},{1,0x00069}},{{0,0x00000},{1,0x02171},{2,0x0095D},{2,0x0095F}},
+   {{0,0x00000},{1,0x02172},{3,0x00961},{3,0x00964}},{{0,0x00000},{1,0x02173},{2,0x00967},{2,0x00969}},
+   {{0,0x00000},{1,0x02174},{1,0x00056},{1,0x00076}},{{0,0x00000},{1,0x02175},{2,0x0096B},{2,0x0096D}},
+   {{0,0x00000},{1,0x02176},{3,0x0096F},{3,0x00972}},{{0,0x00000},{1,0x02177},{4,0x00975},{4,0x00979}},
+   {{0,0x00000},{1,0x02178},{2,0x0097D},{2,0x0097F}},{{0,0x00000},{1,0x02179},{1,0x00058},{1,0x00078}},
+   {{0,0x00000},{1,0x0217A},{2,0x00981},{2,0x00983}},{{0,0x00000},{1,0x0217B},{3,0x00985},{3,0x00988}},
+   {{0,0x00000},{1,0x0217C},{1,0x0004C},{1,0x0006C}},{{0,0x00000},{1,0x0217D},{1,0x00043},{1,0x00063}},
+   {{0,0x00000},{1,0x0217E},{1,0x00044},{1,0x00064}},{{0,0x00000},{1,0x0217F},{1,0x0004D},{1,0x0006D}},
+   {{0,0x00000},{0,0x00000},{1,0x00069},{1,0x00069}},{{0,0x00000},{0,0x00000},{2,0x0095F},{2,0x0095F}},
+   {{0,0x00000},{0,0x00000},{3,0x00964},{3,0x00964}},{{0,0x00000},{0,0x00000},{2,0x00969},{2,0x00969}},
+   {{0,0x00000},{0,0x00000},{1,0x00076},{1,0x00076}},{{0,0x00000},{0,0x00000},{2,0x0096D},{2,0x0096D}},
+   {{0,0x00000},{0,0x00000},{3,0x00972},{3,0x00972}},{{0,0x00000},{0,0x00000},{4,0x00979},{4,0x00979}},
+   {{0,0x00000},{0,0x00000},{2,0x0097F},{2,0x0097F}},{{0,0x00000},{0,0x00000},{1,0x00078},{1,0x00078}},
+   {{0,0x00000},{0,0x00000},{2,0x00983},{2,0x00983}},{{0,0x00000},{0,0x00000},{3,0x00988},{3,0x00988}},
+   {{0,0x00000},{0,0x00000},{1,0x0006C},{1,0x0006C}},{{0,0x00000},{0,0x00000},{1,0x00063},{1,0x00063}},
+   {{0,0x00000},{0,0x00000},{1,0x00064},{1,0x00064}},{{0,0x00000},{0,0x00000},{1,0x0006D},{1,0x0006D}}
+  },
+
+  /* block 66 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x02184},{0,0x00000},{1,0x02184}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{3,0x0098B},{3,0x0098B}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x0098E},{2,0x0098E},{2,0x0098E},{2,0x0098E}},{{2,0x00990},{2,0x00990},{2,0x00990},{2,0x00990}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00992},{2,0x00992},{2,0x00992},{2,0x00992}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 67 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x00994},{2,0x00994},{2,0x00994},{2,0x00994}},
+   {{2,0x00996},{2,0x00996},{2,0x00996},{2,0x00996}},{{2,0x00998},{2,0x00998},{2,0x00998},{2,0x00998}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 68 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x0099A},{2,0x0099A},{2,0x0099A},{2,0x0099A}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x0099C},{2,0x0099C},{2,0x0099C},{2,0x0099C}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x0099E},{2,0x0099E},{2,0x0099E},{2,0x0099E}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x009A0},{2,0x009A0},{2,0x009A0},{2,0x009A0}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x009A2},{2,0x009A2},{2,0x009A2},{2,0x009A2}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{2,0x009A4},{2,0x009A4}},{{0,0x00000},{0,0x00000},{3,0x009A6},{3,0x009A6}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{2,0x009A9},{2,0x009A9}},
+   {{0,0x00000},{0,0x00000},{3,0x009AB},{3,0x009AB}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 69 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x009AE},{2,0x009AE},{2,0x009AE},{2,0x009AE}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x009B0},{2,0x009B0},{2,0x009B0},{2,0x009B0}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x009B2},{2,0x009B2},{2,0x009B2},{2,0x009B2}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x009B4},{2,0x009B4},{2,0x009B4},{2,0x009B4}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x009B6},{2,0x009B6},{2,0x009B6},{2,0x009B6}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x009B8},{2,0x009B8},{2,0x009B8},{2,0x009B8}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x009BA},{2,0x009BA},{2,0x009BA},{2,0x009BA}},
+   {{2,0x009BC},{2,0x009BC},{2,0x009BC},{2,0x009BC}},{{2,0x009BE},{2,0x009BE},{2,0x009BE},{2,0x009BE}},
+   {{2,0x009C0},{2,0x009C0},{2,0x009C0},{2,0x009C0}},{{2,0x009C2},{2,0x009C2},{2,0x009C2},{2,0x009C2}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x009C4},{2,0x009C4},{2,0x009C4},{2,0x009C4}},{{2,0x009C6},{2,0x009C6},{2,0x009C6},{2,0x009C6}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x009C8},{2,0x009C8},{2,0x009C8},{2,0x009C8}},{{2,0x009CA},{2,0x009CA},{2,0x009CA},{2,0x009CA}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 70 */
+  {{{2,0x009CC},{2,0x009CC},{2,0x009CC},{2,0x009CC}},{{2,0x009CE},{2,0x009CE},{2,0x009CE},{2,0x009CE}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x009D0},{2,0x009D0},{2,0x009D0},{2,0x009D0}},{{2,0x009D2},{2,0x009D2},{2,0x009D2},{2,0x009D2}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x009D4},{2,0x009D4},{2,0x009D4},{2,0x009D4}},{{2,0x009D6},{2,0x009D6},{2,0x009D6},{2,0x009D6}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x009D8},{2,0x009D8},{2,0x009D8},{2,0x009D8}},{{2,0x009DA},{2,0x009DA},{2,0x009DA},{2,0x009DA}},
+   {{2,0x009DC},{2,0x009DC},{2,0x009DC},{2,0x009DC}},{{2,0x009DE},{2,0x009DE},{2,0x009DE},{2,0x009DE}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 71 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x009E0},{2,0x009E0},{2,0x009E0},{2,0x009E0}},{{2,0x009E2},{2,0x009E2},{2,0x009E2},{2,0x009E2}},
+   {{2,0x009E4},{2,0x009E4},{2,0x009E4},{2,0x009E4}},{{2,0x009E6},{2,0x009E6},{2,0x009E6},{2,0x009E6}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x009E8},{2,0x009E8},{2,0x009E8},{2,0x009E8}},{{2,0x009EA},{2,0x009EA},{2,0x009EA},{2,0x009EA}},
+   {{2,0x009EC},{2,0x009EC},{2,0x009EC},{2,0x009EC}},{{2,0x009EE},{2,0x009EE},{2,0x009EE},{2,0x009EE}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 72 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{1,0x03008},{1,0x03008},{1,0x03008},{1,0x03008}},
+   {{1,0x03009},{1,0x03009},{1,0x03009},{1,0x03009}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 73 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x00031},{1,0x00031}},{{0,0x00000},{0,0x00000},{1,0x00032},{1,0x00032}},
+   {{0,0x00000},{0,0x00000},{1,0x00033},{1,0x00033}},{{0,0x00000},{0,0x00000},{1,0x00034},{1,0x00034}},
+   {{0,0x00000},{0,0x00000},{1,0x00035},{1,0x00035}},{{0,0x00000},{0,0x00000},{1,0x00036},{1,0x00036}},
+   {{0,0x00000},{0,0x00000},{1,0x00037},{1,0x00037}},{{0,0x00000},{0,0x00000},{1,0x00038},{1,0x00038}},
+   {{0,0x00000},{0,0x00000},{1,0x00039},{1,0x00039}},{{0,0x00000},{0,0x00000},{2,0x009F0},{2,0x009F0}},
+   {{0,0x00000},{0,0x00000},{2,0x009F2},{2,0x009F2}},{{0,0x00000},{0,0x00000},{2,0x009F4},{2,0x009F4}},
+   {{0,0x00000},{0,0x00000},{2,0x009F6},{2,0x009F6}},{{0,0x00000},{0,0x00000},{2,0x009F8},{2,0x009F8}},
+   {{0,0x00000},{0,0x00000},{2,0x009FA},{2,0x009FA}},{{0,0x00000},{0,0x00000},{2,0x009FC},{2,0x009FC}},
+   {{0,0x00000},{0,0x00000},{2,0x009FE},{2,0x009FE}},{{0,0x00000},{0,0x00000},{2,0x00A00},{2,0x00A00}},
+   {{0,0x00000},{0,0x00000},{2,0x00A02},{2,0x00A02}},{{0,0x00000},{0,0x00000},{2,0x00A04},{2,0x00A04}},
+   {{0,0x00000},{0,0x00000},{3,0x00A06},{3,0x00A06}},{{0,0x00000},{0,0x00000},{3,0x00A09},{3,0x00A09}},
+   {{0,0x00000},{0,0x00000},{3,0x00A0C},{3,0x00A0C}},{{0,0x00000},{0,0x00000},{3,0x00A0F},{3,0x00A0F}},
+   {{0,0x00000},{0,0x00000},{3,0x00A12},{3,0x00A12}},{{0,0x00000},{0,0x00000},{3,0x00A15},{3,0x00A15}},
+   {{0,0x00000},{0,0x00000},{3,0x00A18},{3,0x00A18}},{{0,0x00000},{0,0x00000},{3,0x00A1B},{3,0x00A1B}},
+   {{0,0x00000},{0,0x00000},{3,0x00A1E},{3,0x00A1E}},{{0,0x00000},{0,0x00000},{4,0x00A21},{4,0x00A21}},
+   {{0,0x00000},{0,0x00000},{4,0x00A25},{4,0x00A25}},{{0,0x00000},{0,0x00000},{4,0x00A29},{4,0x00A29}}
+  },
+
+  /* block 74 */
+  {{{0,0x00000},{0,0x00000},{4,0x00A2D},{4,0x00A2D}},{{0,0x00000},{0,0x00000},{4,0x00A31},{4,0x00A31}},
+   {{0,0x00000},{0,0x00000},{4,0x00A35},{4,0x00A35}},{{0,0x00000},{0,0x00000},{4,0x00A39},{4,0x00A39}},
+   {{0,0x00000},{0,0x00000},{4,0x00A3D},{4,0x00A3D}},{{0,0x00000},{0,0x00000},{4,0x00A41},{4,0x00A41}},
+   {{0,0x00000},{0,0x00000},{4,0x00A45},{4,0x00A45}},{{0,0x00000},{0,0x00000},{4,0x00A49},{4,0x00A49}},
+   {{0,0x00000},{0,0x00000},{2,0x00A4D},{2,0x00A4D}},{{0,0x00000},{0,0x00000},{2,0x00A4F},{2,0x00A4F}},
+   {{0,0x00000},{0,0x00000},{2,0x00A51},{2,0x00A51}},{{0,0x00000},{0,0x00000},{2,0x00A53},{2,0x00A53}},
+   {{0,0x00000},{0,0x00000},{2,0x00A55},{2,0x00A55}},{{0,0x00000},{0,0x00000},{2,0x00A57},{2,0x00A57}},
+   {{0,0x00000},{0,0x00000},{2,0x00A59},{2,0x00A59}},{{0,0x00000},{0,0x00000},{2,0x00A5B},{2,0x00A5B}},
+   {{0,0x00000},{0,0x00000},{2,0x00A5D},{2,0x00A5D}},{{0,0x00000},{0,0x00000},{3,0x00A5F},{3,0x00A5F}},
+   {{0,0x00000},{0,0x00000},{3,0x00A62},{3,0x00A62}},{{0,0x00000},{0,0x00000},{3,0x00A65},{3,0x00A65}},
+   {{0,0x00000},{0,0x00000},{3,0x00A68},{3,0x00A68}},{{0,0x00000},{0,0x00000},{3,0x00A6B},{3,0x00A6B}},
+   {{0,0x00000},{0,0x00000},{3,0x00A6E},{3,0x00A6E}},{{0,0x00000},{0,0x00000},{3,0x00A71},{3,0x00A71}},
+   {{0,0x00000},{0,0x00000},{3,0x00A74},{3,0x00A74}},{{0,0x00000},{0,0x00000},{3,0x00A77},{3,0x00A77}},
+   {{0,0x00000},{0,0x00000},{3,0x00A7A},{3,0x00A7A}},{{0,0x00000},{0,0x00000},{3,0x00A7D},{3,0x00A7D}},
+   {{0,0x00000},{0,0x00000},{3,0x00A80},{3,0x00A80}},{{0,0x00000},{0,0x00000},{3,0x00A83},{3,0x00A83}},
+   {{0,0x00000},{0,0x00000},{3,0x00A86},{3,0x00A86}},{{0,0x00000},{0,0x00000},{3,0x00A89},{3,0x00A89}},
+   {{0,0x00000},{0,0x00000},{3,0x00A8C},{3,0x00A8C}},{{0,0x00000},{0,0x00000},{3,0x00A8F},{3,0x00A8F}},
+   {{0,0x00000},{0,0x00000},{3,0x00A92},{3,0x00A92}},{{0,0x00000},{0,0x00000},{3,0x00A95},{3,0x00A95}},
+   {{0,0x00000},{0,0x00000},{3,0x00A98},{3,0x00A98}},{{0,0x00000},{0,0x00000},{3,0x00A9B},{3,0x00A9B}},
+   {{0,0x00000},{0,0x00000},{3,0x00A9E},{3,0x00A9E}},{{0,0x00000},{0,0x00000},{3,0x00AA1},{3,0x00AA1}},
+   {{0,0x00000},{0,0x00000},{3,0x00AA4},{3,0x00AA4}},{{0,0x00000},{0,0x00000},{3,0x00AA7},{3,0x00AA7}},
+   {{0,0x00000},{0,0x00000},{3,0x00AAA},{3,0x00AAA}},{{0,0x00000},{0,0x00000},{3,0x00AAD},{3,0x00AAD}},
+   {{0,0x00000},{0,0x00000},{3,0x00AB0},{3,0x00AB0}},{{0,0x00000},{0,0x00000},{3,0x00AB3},{3,0x00AB3}},
+   {{0,0x00000},{0,0x00000},{3,0x00AB6},{3,0x00AB6}},{{0,0x00000},{0,0x00000},{3,0x00AB9},{3,0x00AB9}},
+   {{0,0x00000},{0,0x00000},{3,0x00ABC},{3,0x00ABC}},{{0,0x00000},{0,0x00000},{3,0x00ABF},{3,0x00ABF}},
+   {{0,0x00000},{0,0x00000},{3,0x00AC2},{3,0x00AC2}},{{0,0x00000},{0,0x00000},{3,0x00AC5},{3,0x00AC5}},
+   {{0,0x00000},{0,0x00000},{3,0x00AC8},{3,0x00AC8}},{{0,0x00000},{0,0x00000},{3,0x00ACB},{3,0x00ACB}},
+   {{0,0x00000},{1,0x024D0},{1,0x00041},{1,0x00061}},{{0,0x00000},{1,0x024D1},{1,0x00042},{1,0x00062}},
+   {{0,0x00000},{1,0x024D2},{1,0x00043},{1,0x00063}},{{0,0x00000},{1,0x024D3},{1,0x00044},{1,0x00064}},
+   {{0,0x00000},{1,0x024D4},{1,0x00045},{1,0x00065}},{{0,0x00000},{1,0x024D5},{1,0x00046},{1,0x00066}},
+   {{0,0x00000},{1,0x024D6},{1,0x00047},{1,0x00067}},{{0,0x00000},{1,0x024D7},{1,0x00048},{1,0x00068}},
+   {{0,0x00000},{1,0x024D8},{1,0x00049},{1,0x00069}},{{0,0x00000},{1,0x024D9},{1,0x0004A},{1,0x0006A}}
+  },
+
+  /* block 75 */
+  {{{0,0x00000},{1,0x024DA},{1,0x0004B},{1,0x0006B}},{{0,0x00000},{1,0x024DB},{1,0x0004C},{1,0x0006C}},
+   {{0,0x00000},{1,0x024DC},{1,0x0004D},{1,0x0006D}},{{0,0x00000},{1,0x024DD},{1,0x0004E},{1,0x0006E}},
+   {{0,0x00000},{1,0x024DE},{1,0x0004F},{1,0x0006F}},{{0,0x00000},{1,0x024DF},{1,0x00050},{1,0x00070}},
+   {{0,0x00000},{1,0x024E0},{1,0x00051},{1,0x00071}},{{0,0x00000},{1,0x024E1},{1,0x00052},{1,0x00072}},
+   {{0,0x00000},{1,0x024E2},{1,0x00053},{1,0x00073}},{{0,0x00000},{1,0x024E3},{1,0x00054},{1,0x00074}},
+   {{0,0x00000},{1,0x024E4},{1,0x00055},{1,0x00075}},{{0,0x00000},{1,0x024E5},{1,0x00056},{1,0x00076}},
+   {{0,0x00000},{1,0x024E6},{1,0x00057},{1,0x00077}},{{0,0x00000},{1,0x024E7},{1,0x00058},{1,0x00078}},
+   {{0,0x00000},{1,0x024E8},{1,0x00059},{1,0x00079}},{{0,0x00000},{1,0x024E9},{1,0x0005A},{1,0x0007A}},
+   {{0,0x00000},{0,0x00000},{1,0x00061},{1,0x00061}},{{0,0x00000},{0,0x00000},{1,0x00062},{1,0x00062}},
+   {{0,0x00000},{0,0x00000},{1,0x00063},{1,0x00063}},{{0,0x00000},{0,0x00000},{1,0x00064},{1,0x00064}},
+   {{0,0x00000},{0,0x00000},{1,0x00065},{1,0x00065}},{{0,0x00000},{0,0x00000},{1,0x00066},{1,0x00066}},
+   {{0,0x00000},{0,0x00000},{1,0x00067},{1,0x00067}},{{0,0x00000},{0,0x00000},{1,0x00068},{1,0x00068}},
+   {{0,0x00000},{0,0x00000},{1,0x00069},{1,0x00069}},{{0,0x00000},{0,0x00000},{1,0x0006A},{1,0x0006A}},
+   {{0,0x00000},{0,0x00000},{1,0x0006B},{1,0x0006B}},{{0,0x00000},{0,0x00000},{1,0x0006C},{1,0x0006C}},
+   {{0,0x00000},{0,0x00000},{1,0x0006D},{1,0x0006D}},{{0,0x00000},{0,0x00000},{1,0x0006E},{1,0x0006E}},
+   {{0,0x00000},{0,0x00000},{1,0x0006F},{1,0x0006F}},{{0,0x00000},{0,0x00000},{1,0x00070},{1,0x00070}},
+   {{0,0x00000},{0,0x00000},{1,0x00071},{1,0x00071}},{{0,0x00000},{0,0x00000},{1,0x00072},{1,0x00072}},
+   {{0,0x00000},{0,0x00000},{1,0x00073},{1,0x00073}},{{0,0x00000},{0,0x00000},{1,0x00074},{1,0x00074}},
+   {{0,0x00000},{0,0x00000},{1,0x00075},{1,0x00075}},{{0,0x00000},{0,0x00000},{1,0x00076},{1,0x00076}},
+   {{0,0x00000},{0,0x00000},{1,0x00077},{1,0x00077}},{{0,0x00000},{0,0x00000},{1,0x00078},{1,0x00078}},
+   {{0,0x00000},{0,0x00000},{1,0x00079},{1,0x00079}},{{0,0x00000},{0,0x00000},{1,0x0007A},{1,0x0007A}},
+   {{0,0x00000},{0,0x00000},{1,0x00030},{1,0x00030}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 76 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{4,0x00ACE},{4,0x00ACE}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 77 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{3,0x00AD2},{3,0x00AD2}},{{0,0x00000},{0,0x00000},{2,0x00AD5},{2,0x00AD5}},
+   {{0,0x00000},{0,0x00000},{3,0x00AD7},{3,0x00AD7}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 78 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00ADA},{2,0x00ADA},{2,0x00ADA},{2,0x00ADA}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 79 */
+  {{{0,0x00000},{1,0x02C30},{0,0x00000},{1,0x02C30}},{{0,0x00000},{1,0x02C31},{0,0x00000},{1,0x02C31}},
+   {{0,0x00000},{1,0x02C32},{0,0x00000},{1,0x02C32}},{{0,0x00000},{1,0x02C33},{0,0x00000},{1,0x02C33}},
+   {{0,0x00000},{1,0x02C34},{0,0x00000},{1,0x02C34}},{{0,0x00000},{1,0x02C35},{0,0x00000},{1,0x02C35}},
+   {{0,0x00000},{1,0x02C36},{0,0x00000},{1,0x02C36}},{{0,0x00000},{1,0x02C37},{0,0x00000},{1,0x02C37}},
+   {{0,0x00000},{1,0x02C38},{0,0x00000},{1,0x02C38}},{{0,0x00000},{1,0x02C39},{0,0x00000},{1,0x02C39}},
+   {{0,0x00000},{1,0x02C3A},{0,0x00000},{1,0x02C3A}},{{0,0x00000},{1,0x02C3B},{0,0x00000},{1,0x02C3B}},
+   {{0,0x00000},{1,0x02C3C},{0,0x00000},{1,0x02C3C}},{{0,0x00000},{1,0x02C3D},{0,0x00000},{1,0x02C3D}},
+   {{0,0x00000},{1,0x02C3E},{0,0x00000},{1,0x02C3E}},{{0,0x00000},{1,0x02C3F},{0,0x00000},{1,0x02C3F}},
+   {{0,0x00000},{1,0x02C40},{0,0x00000},{1,0x02C40}},{{0,0x00000},{1,0x02C41},{0,0x00000},{1,0x02C41}},
+   {{0,0x00000},{1,0x02C42},{0,0x00000},{1,0x02C42}},{{0,0x00000},{1,0x02C43},{0,0x00000},{1,0x02C43}},
+   {{0,0x00000},{1,0x02C44},{0,0x00000},{1,0x02C44}},{{0,0x00000},{1,0x02C45},{0,0x00000},{1,0x02C45}},
+   {{0,0x00000},{1,0x02C46},{0,0x00000},{1,0x02C46}},{{0,0x00000},{1,0x02C47},{0,0x00000},{1,0x02C47}},
+   {{0,0x00000},{1,0x02C48},{0,0x00000},{1,0x02C48}},{{0,0x00000},{1,0x02C49},{0,0x00000},{1,0x02C49}},
+   {{0,0x00000},{1,0x02C4A},{0,0x00000},{1,0x02C4A}},{{0,0x00000},{1,0x02C4B},{0,0x00000},{1,0x02C4B}},
+   {{0,0x00000},{1,0x02C4C},{0,0x00000},{1,0x02C4C}},{{0,0x00000},{1,0x02C4D},{0,0x00000},{1,0x02C4D}},
+   {{0,0x00000},{1,0x02C4E},{0,0x00000},{1,0x02C4E}},{{0,0x00000},{1,0x02C4F},{0,0x00000},{1,0x02C4F}},
+   {{0,0x00000},{1,0x02C50},{0,0x00000},{1,0x02C50}},{{0,0x00000},{1,0x02C51},{0,0x00000},{1,0x02C51}},
+   {{0,0x00000},{1,0x02C52},{0,0x00000},{1,0x02C52}},{{0,0x00000},{1,0x02C53},{0,0x00000},{1,0x02C53}},
+   {{0,0x00000},{1,0x02C54},{0,0x00000},{1,0x02C54}},{{0,0x00000},{1,0x02C55},{0,0x00000},{1,0x02C55}},
+   {{0,0x00000},{1,0x02C56},{0,0x00000},{1,0x02C56}},{{0,0x00000},{1,0x02C57},{0,0x00000},{1,0x02C57}},
+   {{0,0x00000},{1,0x02C58},{0,0x00000},{1,0x02C58}},{{0,0x00000},{1,0x02C59},{0,0x00000},{1,0x02C59}},
+   {{0,0x00000},{1,0x02C5A},{0,0x00000},{1,0x02C5A}},{{0,0x00000},{1,0x02C5B},{0,0x00000},{1,0x02C5B}},
+   {{0,0x00000},{1,0x02C5C},{0,0x00000},{1,0x02C5C}},{{0,0x00000},{1,0x02C5D},{0,0x00000},{1,0x02C5D}},
+   {{0,0x00000},{1,0x02C5E},{0,0x00000},{1,0x02C5E}},{{0,0x00000},{1,0x02C5F},{0,0x00000},{1,0x02C5F}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 80 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02C61},{0,0x00000},{1,0x02C61}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0026B},{0,0x00000},{1,0x0026B}},{{0,0x00000},{1,0x01D7D},{0,0x00000},{1,0x01D7D}},
+   {{0,0x00000},{1,0x0027D},{0,0x00000},{1,0x0027D}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x02C68},{0,0x00000},{1,0x02C68}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x02C6A},{0,0x00000},{1,0x02C6A}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x02C6C},{0,0x00000},{1,0x02C6C}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x00251},{0,0x00000},{1,0x00251}},
+   {{0,0x00000},{1,0x00271},{0,0x00000},{1,0x00271}},{{0,0x00000},{1,0x00250},{0,0x00000},{1,0x00250}},
+   {{0,0x00000},{1,0x00252},{0,0x00000},{1,0x00252}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02C73},{0,0x00000},{1,0x02C73}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x02C76},{0,0x00000},{1,0x02C76}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x0006A},{1,0x0006A}},{{0,0x00000},{0,0x00000},{1,0x00056},{1,0x00076}},
+   {{0,0x00000},{1,0x0023F},{0,0x00000},{1,0x0023F}},{{0,0x00000},{1,0x00240},{0,0x00000},{1,0x00240}}
+  },
+
+  /* block 81 */
+  {{{0,0x00000},{1,0x02C81},{0,0x00000},{1,0x02C81}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02C83},{0,0x00000},{1,0x02C83}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02C85},{0,0x00000},{1,0x02C85}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02C87},{0,0x00000},{1,0x02C87}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02C89},{0,0x00000},{1,0x02C89}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02C8B},{0,0x00000},{1,0x02C8B}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02C8D},{0,0x00000},{1,0x02C8D}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02C8F},{0,0x00000},{1,0x02C8F}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02C91},{0,0x00000},{1,0x02C91}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02C93},{0,0x00000},{1,0x02C93}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02C95},{0,0x00000},{1,0x02C95}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02C97},{0,0x00000},{1,0x02C97}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02C99},{0,0x00000},{1,0x02C99}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02C9B},{0,0x00000},{1,0x02C9B}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02C9D},{0,0x00000},{1,0x02C9D}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02C9F},{0,0x00000},{1,0x02C9F}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02CA1},{0,0x00000},{1,0x02CA1}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02CA3},{0,0x00000},{1,0x02CA3}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02CA5},{0,0x00000},{1,0x02CA5}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02CA7},{0,0x00000},{1,0x02CA7}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02CA9},{0,0x00000},{1,0x02CA9}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02CAB},{0,0x00000},{1,0x02CAB}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02CAD},{0,0x00000},{1,0x02CAD}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02CAF},{0,0x00000},{1,0x02CAF}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02CB1},{0,0x00000},{1,0x02CB1}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02CB3},{0,0x00000},{1,0x02CB3}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02CB5},{0,0x00000},{1,0x02CB5}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02CB7},{0,0x00000},{1,0x02CB7}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02CB9},{0,0x00000},{1,0x02CB9}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02CBB},{0,0x00000},{1,0x02CBB}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02CBD},{0,0x00000},{1,0x02CBD}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02CBF},{0,0x00000},{1,0x02CBF}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 82 */
+  {{{0,0x00000},{1,0x02CC1},{0,0x00000},{1,0x02CC1}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02CC3},{0,0x00000},{1,0x02CC3}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02CC5},{0,0x00000},{1,0x02CC5}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02CC7},{0,0x00000},{1,0x02CC7}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02CC9},{0,0x00000},{1,0x02CC9}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02CCB},{0,0x00000},{1,0x02CCB}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02CCD},{0,0x00000},{1,0x02CCD}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02CCF},{0,0x00000},{1,0x02CCF}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02CD1},{0,0x00000},{1,0x02CD1}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02CD3},{0,0x00000},{1,0x02CD3}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02CD5},{0,0x00000},{1,0x02CD5}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02CD7},{0,0x00000},{1,0x02CD7}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02CD9},{0,0x00000},{1,0x02CD9}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02CDB},{0,0x00000},{1,0x02CDB}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02CDD},{0,0x00000},{1,0x02CDD}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02CDF},{0,0x00000},{1,0x02CDF}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02CE1},{0,0x00000},{1,0x02CE1}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02CE3},{0,0x00000},{1,0x02CE3}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x02CEC},{0,0x00000},{1,0x02CEC}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x02CEE},{0,0x00000},{1,0x02CEE}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x02CF3},{0,0x00000},{1,0x02CF3}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 83 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x02D61},{1,0x02D61}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 84 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x06BCD},{1,0x06BCD}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 85 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x09F9F},{1,0x09F9F}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 86 */
+  {{{0,0x00000},{0,0x00000},{1,0x04E00},{1,0x04E00}},{{0,0x00000},{0,0x00000},{1,0x04E28},{1,0x04E28}},
+   {{0,0x00000},{0,0x00000},{1,0x04E36},{1,0x04E36}},{{0,0x00000},{0,0x00000},{1,0x04E3F},{1,0x04E3F}},
+   {{0,0x00000},{0,0x00000},{1,0x04E59},{1,0x04E59}},{{0,0x00000},{0,0x00000},{1,0x04E85},{1,0x04E85}},
+   {{0,0x00000},{0,0x00000},{1,0x04E8C},{1,0x04E8C}},{{0,0x00000},{0,0x00000},{1,0x04EA0},{1,0x04EA0}},
+   {{0,0x00000},{0,0x00000},{1,0x04EBA},{1,0x04EBA}},{{0,0x00000},{0,0x00000},{1,0x0513F},{1,0x0513F}},
+   {{0,0x00000},{0,0x00000},{1,0x05165},{1,0x05165}},{{0,0x00000},{0,0x00000},{1,0x0516B},{1,0x0516B}},
+   {{0,0x00000},{0,0x00000},{1,0x05182},{1,0x05182}},{{0,0x00000},{0,0x00000},{1,0x05196},{1,0x05196}},
+   {{0,0x00000},{0,0x00000},{1,0x051AB},{1,0x051AB}},{{0,0x00000},{0,0x00000},{1,0x051E0},{1,0x051E0}},
+   {{0,0x00000},{0,0x00000},{1,0x051F5},{1,0x051F5}},{{0,0x00000},{0,0x00000},{1,0x05200},{1,0x05200}},
+   {{0,0x00000},{0,0x00000},{1,0x0529B},{1,0x0529B}},{{0,0x00000},{0,0x00000},{1,0x052F9},{1,0x052F9}},
+   {{0,0x00000},{0,0x00000},{1,0x05315},{1,0x05315}},{{0,0x00000},{0,0x00000},{1,0x0531A},{1,0x0531A}},
+   {{0,0x00000},{0,0x00000},{1,0x05338},{1,0x05338}},{{0,0x00000},{0,0x00000},{1,0x05341},{1,0x05341}},
+   {{0,0x00000},{0,0x00000},{1,0x0535C},{1,0x0535C}},{{0,0x00000},{0,0x00000},{1,0x05369},{1,0x05369}},
+   {{0,0x00000},{0,0x00000},{1,0x05382},{1,0x05382}},{{0,0x00000},{0,0x00000},{1,0x053B6},{1,0x053B6}},
+   {{0,0x00000},{0,0x00000},{1,0x053C8},{1,0x053C8}},{{0,0x00000},{0,0x00000},{1,0x053E3},{1,0x053E3}},
+   {{0,0x00000},{0,0x00000},{1,0x056D7},{1,0x056D7}},{{0,0x00000},{0,0x00000},{1,0x0571F},{1,0x0571F}},
+   {{0,0x00000},{0,0x00000},{1,0x058EB},{1,0x058EB}},{{0,0x00000},{0,0x00000},{1,0x05902},{1,0x05902}},
+   {{0,0x00000},{0,0x00000},{1,0x0590A},{1,0x0590A}},{{0,0x00000},{0,0x00000},{1,0x05915},{1,0x05915}},
+   {{0,0x00000},{0,0x00000},{1,0x05927},{1,0x05927}},{{0,0x00000},{0,0x00000},{1,0x05973},{1,0x05973}},
+   {{0,0x00000},{0,0x00000},{1,0x05B50},{1,0x05B50}},{{0,0x00000},{0,0x00000},{1,0x05B80},{1,0x05B80}},
+   {{0,0x00000},{0,0x00000},{1,0x05BF8},{1,0x05BF8}},{{0,0x00000},{0,0x00000},{1,0x05C0F},{1,0x05C0F}},
+   {{0,0x00000},{0,0x00000},{1,0x05C22},{1,0x05C22}},{{0,0x00000},{0,0x00000},{1,0x05C38},{1,0x05C38}},
+   {{0,0x00000},{0,0x00000},{1,0x05C6E},{1,0x05C6E}},{{0,0x00000},{0,0x00000},{1,0x05C71},{1,0x05C71}},
+   {{0,0x00000},{0,0x00000},{1,0x05DDB},{1,0x05DDB}},{{0,0x00000},{0,0x00000},{1,0x05DE5},{1,0x05DE5}},
+   {{0,0x00000},{0,0x00000},{1,0x05DF1},{1,0x05DF1}},{{0,0x00000},{0,0x00000},{1,0x05DFE},{1,0x05DFE}},
+   {{0,0x00000},{0,0x00000},{1,0x05E72},{1,0x05E72}},{{0,0x00000},{0,0x00000},{1,0x05E7A},{1,0x05E7A}},
+   {{0,0x00000},{0,0x00000},{1,0x05E7F},{1,0x05E7F}},{{0,0x00000},{0,0x00000},{1,0x05EF4},{1,0x05EF4}},
+   {{0,0x00000},{0,0x00000},{1,0x05EFE},{1,0x05EFE}},{{0,0x00000},{0,0x00000},{1,0x05F0B},{1,0x05F0B}},
+   {{0,0x00000},{0,0x00000},{1,0x05F13},{1,0x05F13}},{{0,0x00000},{0,0x00000},{1,0x05F50},{1,0x05F50}},
+   {{0,0x00000},{0,0x00000},{1,0x05F61},{1,0x05F61}},{{0,0x00000},{0,0x00000},{1,0x05F73},{1,0x05F73}},
+   {{0,0x00000},{0,0x00000},{1,0x05FC3},{1,0x05FC3}},{{0,0x00000},{0,0x00000},{1,0x06208},{1,0x06208}},
+   {{0,0x00000},{0,0x00000},{1,0x06236},{1,0x06236}},{{0,0x00000},{0,0x00000},{1,0x0624B},{1,0x0624B}}
+  },
+
+  /* block 87 */
+  {{{0,0x00000},{0,0x00000},{1,0x0652F},{1,0x0652F}},{{0,0x00000},{0,0x00000},{1,0x06534},{1,0x06534}},
+   {{0,0x00000},{0,0x00000},{1,0x06587},{1,0x06587}},{{0,0x00000},{0,0x00000},{1,0x06597},{1,0x06597}},
+   {{0,0x00000},{0,0x00000},{1,0x065A4},{1,0x065A4}},{{0,0x00000},{0,0x00000},{1,0x065B9},{1,0x065B9}},
+   {{0,0x00000},{0,0x00000},{1,0x065E0},{1,0x065E0}},{{0,0x00000},{0,0x00000},{1,0x065E5},{1,0x065E5}},
+   {{0,0x00000},{0,0x00000},{1,0x066F0},{1,0x066F0}},{{0,0x00000},{0,0x00000},{1,0x06708},{1,0x06708}},
+   {{0,0x00000},{0,0x00000},{1,0x06728},{1,0x06728}},{{0,0x00000},{0,0x00000},{1,0x06B20},{1,0x06B20}},
+   {{0,0x00000},{0,0x00000},{1,0x06B62},{1,0x06B62}},{{0,0x00000},{0,0x00000},{1,0x06B79},{1,0x06B79}},
+   {{0,0x00000},{0,0x00000},{1,0x06BB3},{1,0x06BB3}},{{0,0x00000},{0,0x00000},{1,0x06BCB},{1,0x06BCB}},
+   {{0,0x00000},{0,0x00000},{1,0x06BD4},{1,0x06BD4}},{{0,0x00000},{0,0x00000},{1,0x06BDB},{1,0x06BDB}},
+   {{0,0x00000},{0,0x00000},{1,0x06C0F},{1,0x06C0F}},{{0,0x00000},{0,0x00000},{1,0x06C14},{1,0x06C14}},
+   {{0,0x00000},{0,0x00000},{1,0x06C34},{1,0x06C34}},{{0,0x00000},{0,0x00000},{1,0x0706B},{1,0x0706B}},
+   {{0,0x00000},{0,0x00000},{1,0x0722A},{1,0x0722A}},{{0,0x00000},{0,0x00000},{1,0x07236},{1,0x07236}},
+   {{0,0x00000},{0,0x00000},{1,0x0723B},{1,0x0723B}},{{0,0x00000},{0,0x00000},{1,0x0723F},{1,0x0723F}},
+   {{0,0x00000},{0,0x00000},{1,0x07247},{1,0x07247}},{{0,0x00000},{0,0x00000},{1,0x07259},{1,0x07259}},
+   {{0,0x00000},{0,0x00000},{1,0x0725B},{1,0x0725B}},{{0,0x00000},{0,0x00000},{1,0x072AC},{1,0x072AC}},
+   {{0,0x00000},{0,0x00000},{1,0x07384},{1,0x07384}},{{0,0x00000},{0,0x00000},{1,0x07389},{1,0x07389}},
+   {{0,0x00000},{0,0x00000},{1,0x074DC},{1,0x074DC}},{{0,0x00000},{0,0x00000},{1,0x074E6},{1,0x074E6}},
+   {{0,0x00000},{0,0x00000},{1,0x07518},{1,0x07518}},{{0,0x00000},{0,0x00000},{1,0x0751F},{1,0x0751F}},
+   {{0,0x00000},{0,0x00000},{1,0x07528},{1,0x07528}},{{0,0x00000},{0,0x00000},{1,0x07530},{1,0x07530}},
+   {{0,0x00000},{0,0x00000},{1,0x0758B},{1,0x0758B}},{{0,0x00000},{0,0x00000},{1,0x07592},{1,0x07592}},
+   {{0,0x00000},{0,0x00000},{1,0x07676},{1,0x07676}},{{0,0x00000},{0,0x00000},{1,0x0767D},{1,0x0767D}},
+   {{0,0x00000},{0,0x00000},{1,0x076AE},{1,0x076AE}},{{0,0x00000},{0,0x00000},{1,0x076BF},{1,0x076BF}},
+   {{0,0x00000},{0,0x00000},{1,0x076EE},{1,0x076EE}},{{0,0x00000},{0,0x00000},{1,0x077DB},{1,0x077DB}},
+   {{0,0x00000},{0,0x00000},{1,0x077E2},{1,0x077E2}},{{0,0x00000},{0,0x00000},{1,0x077F3},{1,0x077F3}},
+   {{0,0x00000},{0,0x00000},{1,0x0793A},{1,0x0793A}},{{0,0x00000},{0,0x00000},{1,0x079B8},{1,0x079B8}},
+   {{0,0x00000},{0,0x00000},{1,0x079BE},{1,0x079BE}},{{0,0x00000},{0,0x00000},{1,0x07A74},{1,0x07A74}},
+   {{0,0x00000},{0,0x00000},{1,0x07ACB},{1,0x07ACB}},{{0,0x00000},{0,0x00000},{1,0x07AF9},{1,0x07AF9}},
+   {{0,0x00000},{0,0x00000},{1,0x07C73},{1,0x07C73}},{{0,0x00000},{0,0x00000},{1,0x07CF8},{1,0x07CF8}},
+   {{0,0x00000},{0,0x00000},{1,0x07F36},{1,0x07F36}},{{0,0x00000},{0,0x00000},{1,0x07F51},{1,0x07F51}},
+   {{0,0x00000},{0,0x00000},{1,0x07F8A},{1,0x07F8A}},{{0,0x00000},{0,0x00000},{1,0x07FBD},{1,0x07FBD}},
+   {{0,0x00000},{0,0x00000},{1,0x08001},{1,0x08001}},{{0,0x00000},{0,0x00000},{1,0x0800C},{1,0x0800C}},
+   {{0,0x00000},{0,0x00000},{1,0x08012},{1,0x08012}},{{0,0x00000},{0,0x00000},{1,0x08033},{1,0x08033}}
+  },
+
+  /* block 88 */
+  {{{0,0x00000},{0,0x00000},{1,0x0807F},{1,0x0807F}},{{0,0x00000},{0,0x00000},{1,0x08089},{1,0x08089}},
+   {{0,0x00000},{0,0x00000},{1,0x081E3},{1,0x081E3}},{{0,0x00000},{0,0x00000},{1,0x081EA},{1,0x081EA}},
+   {{0,0x00000},{0,0x00000},{1,0x081F3},{1,0x081F3}},{{0,0x00000},{0,0x00000},{1,0x081FC},{1,0x081FC}},
+   {{0,0x00000},{0,0x00000},{1,0x0820C},{1,0x0820C}},{{0,0x00000},{0,0x00000},{1,0x0821B},{1,0x0821B}},
+   {{0,0x00000},{0,0x00000},{1,0x0821F},{1,0x0821F}},{{0,0x00000},{0,0x00000},{1,0x0826E},{1,0x0826E}},
+   {{0,0x00000},{0,0x00000},{1,0x08272},{1,0x08272}},{{0,0x00000},{0,0x00000},{1,0x08278},{1,0x08278}},
+   {{0,0x00000},{0,0x00000},{1,0x0864D},{1,0x0864D}},{{0,0x00000},{0,0x00000},{1,0x0866B},{1,0x0866B}},
+   {{0,0x00000},{0,0x00000},{1,0x08840},{1,0x08840}},{{0,0x00000},{0,0x00000},{1,0x0884C},{1,0x0884C}},
+   {{0,0x00000},{0,0x00000},{1,0x08863},{1,0x08863}},{{0,0x00000},{0,0x00000},{1,0x0897E},{1,0x0897E}},
+   {{0,0x00000},{0,0x00000},{1,0x0898B},{1,0x0898B}},{{0,0x00000},{0,0x00000},{1,0x089D2},{1,0x089D2}},
+   {{0,0x00000},{0,0x00000},{1,0x08A00},{1,0x08A00}},{{0,0x00000},{0,0x00000},{1,0x08C37},{1,0x08C37}},
+   {{0,0x00000},{0,0x00000},{1,0x08C46},{1,0x08C46}},{{0,0x00000},{0,0x00000},{1,0x08C55},{1,0x08C55}},
+   {{0,0x00000},{0,0x00000},{1,0x08C78},{1,0x08C78}},{{0,0x00000},{0,0x00000},{1,0x08C9D},{1,0x08C9D}},
+   {{0,0x00000},{0,0x00000},{1,0x08D64},{1,0x08D64}},{{0,0x00000},{0,0x00000},{1,0x08D70},{1,0x08D70}},
+   {{0,0x00000},{0,0x00000},{1,0x08DB3},{1,0x08DB3}},{{0,0x00000},{0,0x00000},{1,0x08EAB},{1,0x08EAB}},
+   {{0,0x00000},{0,0x00000},{1,0x08ECA},{1,0x08ECA}},{{0,0x00000},{0,0x00000},{1,0x08F9B},{1,0x08F9B}},
+   {{0,0x00000},{0,0x00000},{1,0x08FB0},{1,0x08FB0}},{{0,0x00000},{0,0x00000},{1,0x08FB5},{1,0x08FB5}},
+   {{0,0x00000},{0,0x00000},{1,0x09091},{1,0x09091}},{{0,0x00000},{0,0x00000},{1,0x09149},{1,0x09149}},
+   {{0,0x00000},{0,0x00000},{1,0x091C6},{1,0x091C6}},{{0,0x00000},{0,0x00000},{1,0x091CC},{1,0x091CC}},
+   {{0,0x00000},{0,0x00000},{1,0x091D1},{1,0x091D1}},{{0,0x00000},{0,0x00000},{1,0x09577},{1,0x09577}},
+   {{0,0x00000},{0,0x00000},{1,0x09580},{1,0x09580}},{{0,0x00000},{0,0x00000},{1,0x0961C},{1,0x0961C}},
+   {{0,0x00000},{0,0x00000},{1,0x096B6},{1,0x096B6}},{{0,0x00000},{0,0x00000},{1,0x096B9},{1,0x096B9}},
+   {{0,0x00000},{0,0x00000},{1,0x096E8},{1,0x096E8}},{{0,0x00000},{0,0x00000},{1,0x09751},{1,0x09751}},
+   {{0,0x00000},{0,0x00000},{1,0x0975E},{1,0x0975E}},{{0,0x00000},{0,0x00000},{1,0x09762},{1,0x09762}},
+   {{0,0x00000},{0,0x00000},{1,0x09769},{1,0x09769}},{{0,0x00000},{0,0x00000},{1,0x097CB},{1,0x097CB}},
+   {{0,0x00000},{0,0x00000},{1,0x097ED},{1,0x097ED}},{{0,0x00000},{0,0x00000},{1,0x097F3},{1,0x097F3}},
+   {{0,0x00000},{0,0x00000},{1,0x09801},{1,0x09801}},{{0,0x00000},{0,0x00000},{1,0x098A8},{1,0x098A8}},
+   {{0,0x00000},{0,0x00000},{1,0x098DB},{1,0x098DB}},{{0,0x00000},{0,0x00000},{1,0x098DF},{1,0x098DF}},
+   {{0,0x00000},{0,0x00000},{1,0x09996},{1,0x09996}},{{0,0x00000},{0,0x00000},{1,0x09999},{1,0x09999}},
+   {{0,0x00000},{0,0x00000},{1,0x099AC},{1,0x099AC}},{{0,0x00000},{0,0x00000},{1,0x09AA8},{1,0x09AA8}},
+   {{0,0x00000},{0,0x00000},{1,0x09AD8},{1,0x09AD8}},{{0,0x00000},{0,0x00000},{1,0x09ADF},{1,0x09ADF}},
+   {{0,0x00000},{0,0x00000},{1,0x09B25},{1,0x09B25}},{{0,0x00000},{0,0x00000},{1,0x09B2F},{1,0x09B2F}}
+  },
+
+  /* block 89 */
+  {{{0,0x00000},{0,0x00000},{1,0x09B32},{1,0x09B32}},{{0,0x00000},{0,0x00000},{1,0x09B3C},{1,0x09B3C}},
+   {{0,0x00000},{0,0x00000},{1,0x09B5A},{1,0x09B5A}},{{0,0x00000},{0,0x00000},{1,0x09CE5},{1,0x09CE5}},
+   {{0,0x00000},{0,0x00000},{1,0x09E75},{1,0x09E75}},{{0,0x00000},{0,0x00000},{1,0x09E7F},{1,0x09E7F}},
+   {{0,0x00000},{0,0x00000},{1,0x09EA5},{1,0x09EA5}},{{0,0x00000},{0,0x00000},{1,0x09EBB},{1,0x09EBB}},
+   {{0,0x00000},{0,0x00000},{1,0x09EC3},{1,0x09EC3}},{{0,0x00000},{0,0x00000},{1,0x09ECD},{1,0x09ECD}},
+   {{0,0x00000},{0,0x00000},{1,0x09ED1},{1,0x09ED1}},{{0,0x00000},{0,0x00000},{1,0x09EF9},{1,0x09EF9}},
+   {{0,0x00000},{0,0x00000},{1,0x09EFD},{1,0x09EFD}},{{0,0x00000},{0,0x00000},{1,0x09F0E},{1,0x09F0E}},
+   {{0,0x00000},{0,0x00000},{1,0x09F13},{1,0x09F13}},{{0,0x00000},{0,0x00000},{1,0x09F20},{1,0x09F20}},
+   {{0,0x00000},{0,0x00000},{1,0x09F3B},{1,0x09F3B}},{{0,0x00000},{0,0x00000},{1,0x09F4A},{1,0x09F4A}},
+   {{0,0x00000},{0,0x00000},{1,0x09F52},{1,0x09F52}},{{0,0x00000},{0,0x00000},{1,0x09F8D},{1,0x09F8D}},
+   {{0,0x00000},{0,0x00000},{1,0x09F9C},{1,0x09F9C}},{{0,0x00000},{0,0x00000},{1,0x09FA0},{1,0x09FA0}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 90 */
+  {{{0,0x00000},{0,0x00000},{1,0x00020},{1,0x00020}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x03012},{1,0x03012}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x05341},{1,0x05341}},{{0,0x00000},{0,0x00000},{1,0x05344},{1,0x05344}},
+   {{0,0x00000},{0,0x00000},{1,0x05345},{1,0x05345}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 91 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00ADC},{2,0x00ADC},{2,0x00ADC},{2,0x00ADC}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00ADE},{2,0x00ADE},{2,0x00ADE},{2,0x00ADE}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00AE0},{2,0x00AE0},{2,0x00AE0},{2,0x00AE0}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00AE2},{2,0x00AE2},{2,0x00AE2},{2,0x00AE2}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00AE4},{2,0x00AE4},{2,0x00AE4},{2,0x00AE4}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00AE6},{2,0x00AE6},{2,0x00AE6},{2,0x00AE6}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00AE8},{2,0x00AE8},{2,0x00AE8},{2,0x00AE8}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00AEA},{2,0x00AEA},{2,0x00AEA},{2,0x00AEA}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00AEC},{2,0x00AEC},{2,0x00AEC},{2,0x00AEC}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00AEE},{2,0x00AEE},{2,0x00AEE},{2,0x00AEE}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00AF0},{2,0x00AF0},{2,0x00AF0},{2,0x00AF0}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00AF2},{2,0x00AF2},{2,0x00AF2},{2,0x00AF2}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x00AF4},{2,0x00AF4},{2,0x00AF4},{2,0x00AF4}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x00AF6},{2,0x00AF6},{2,0x00AF6},{2,0x00AF6}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x00AF8},{2,0x00AF8},{2,0x00AF8},{2,0x00AF8}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00AFA},{2,0x00AFA},{2,0x00AFA},{2,0x00AFA}},{{2,0x00AFC},{2,0x00AFC},{2,0x00AFC},{2,0x00AFC}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x00AFE},{2,0x00AFE},{2,0x00AFE},{2,0x00AFE}},
+   {{2,0x00B00},{2,0x00B00},{2,0x00B00},{2,0x00B00}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00B02},{2,0x00B02},{2,0x00B02},{2,0x00B02}},{{2,0x00B04},{2,0x00B04},{2,0x00B04},{2,0x00B04}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x00B06},{2,0x00B06},{2,0x00B06},{2,0x00B06}},
+   {{2,0x00B08},{2,0x00B08},{2,0x00B08},{2,0x00B08}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00B0A},{2,0x00B0A},{2,0x00B0A},{2,0x00B0A}},{{2,0x00B0C},{2,0x00B0C},{2,0x00B0C},{2,0x00B0C}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 92 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00B0E},{2,0x00B0E},{2,0x00B0E},{2,0x00B0E}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{2,0x00B10},{2,0x00B10}},
+   {{0,0x00000},{0,0x00000},{2,0x00B12},{2,0x00B12}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00B14},{2,0x00B14},{2,0x00B14},{2,0x00B14}},{{0,0x00000},{0,0x00000},{2,0x00B16},{2,0x00B16}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00B18},{2,0x00B18},{2,0x00B18},{2,0x00B18}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00B1A},{2,0x00B1A},{2,0x00B1A},{2,0x00B1A}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00B1C},{2,0x00B1C},{2,0x00B1C},{2,0x00B1C}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00B1E},{2,0x00B1E},{2,0x00B1E},{2,0x00B1E}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00B20},{2,0x00B20},{2,0x00B20},{2,0x00B20}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00B22},{2,0x00B22},{2,0x00B22},{2,0x00B22}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00B24},{2,0x00B24},{2,0x00B24},{2,0x00B24}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00B26},{2,0x00B26},{2,0x00B26},{2,0x00B26}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00B28},{2,0x00B28},{2,0x00B28},{2,0x00B28}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00B2A},{2,0x00B2A},{2,0x00B2A},{2,0x00B2A}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 93 */
+  {{{2,0x00B2C},{2,0x00B2C},{2,0x00B2C},{2,0x00B2C}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00B2E},{2,0x00B2E},{2,0x00B2E},{2,0x00B2E}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x00B30},{2,0x00B30},{2,0x00B30},{2,0x00B30}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x00B32},{2,0x00B32},{2,0x00B32},{2,0x00B32}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x00B34},{2,0x00B34},{2,0x00B34},{2,0x00B34}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00B36},{2,0x00B36},{2,0x00B36},{2,0x00B36}},{{2,0x00B38},{2,0x00B38},{2,0x00B38},{2,0x00B38}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x00B3A},{2,0x00B3A},{2,0x00B3A},{2,0x00B3A}},
+   {{2,0x00B3C},{2,0x00B3C},{2,0x00B3C},{2,0x00B3C}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00B3E},{2,0x00B3E},{2,0x00B3E},{2,0x00B3E}},{{2,0x00B40},{2,0x00B40},{2,0x00B40},{2,0x00B40}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x00B42},{2,0x00B42},{2,0x00B42},{2,0x00B42}},
+   {{2,0x00B44},{2,0x00B44},{2,0x00B44},{2,0x00B44}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00B46},{2,0x00B46},{2,0x00B46},{2,0x00B46}},{{2,0x00B48},{2,0x00B48},{2,0x00B48},{2,0x00B48}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00B4A},{2,0x00B4A},{2,0x00B4A},{2,0x00B4A}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x00B4C},{2,0x00B4C},{2,0x00B4C},{2,0x00B4C}},
+   {{2,0x00B4E},{2,0x00B4E},{2,0x00B4E},{2,0x00B4E}},{{2,0x00B50},{2,0x00B50},{2,0x00B50},{2,0x00B50}},
+   {{2,0x00B52},{2,0x00B52},{2,0x00B52},{2,0x00B52}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x00B54},{2,0x00B54},{2,0x00B54},{2,0x00B54}},{{0,0x00000},{0,0x00000},{2,0x00B56},{2,0x00B56}}
+  },
+
+  /* block 94 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x01100},{1,0x01100}},
+   {{0,0x00000},{0,0x00000},{1,0x01101},{1,0x01101}},{{0,0x00000},{0,0x00000},{1,0x011AA},{1,0x011AA}},
+   {{0,0x00000},{0,0x00000},{1,0x01102},{1,0x01102}},{{0,0x00000},{0,0x00000},{1,0x011AC},{1,0x011AC}},
+   {{0,0x00000},{0,0x00000},{1,0x011AD},{1,0x011AD}},{{0,0x00000},{0,0x00000},{1,0x01103},{1,0x01103}},
+   {{0,0x00000},{0,0x00000},{1,0x01104},{1,0x01104}},{{0,0x00000},{0,0x00000},{1,0x01105},{1,0x01105}},
+   {{0,0x00000},{0,0x00000},{1,0x011B0},{1,0x011B0}},{{0,0x00000},{0,0x00000},{1,0x011B1},{1,0x011B1}},
+   {{0,0x00000},{0,0x00000},{1,0x011B2},{1,0x011B2}},{{0,0x00000},{0,0x00000},{1,0x011B3},{1,0x011B3}},
+   {{0,0x00000},{0,0x00000},{1,0x011B4},{1,0x011B4}},{{0,0x00000},{0,0x00000},{1,0x011B5},{1,0x011B5}}
+  },
+
+  /* block 95 */
+  {{{0,0x00000},{0,0x00000},{1,0x0111A},{1,0x0111A}},{{0,0x00000},{0,0x00000},{1,0x01106},{1,0x01106}},
+   {{0,0x00000},{0,0x00000},{1,0x01107},{1,0x01107}},{{0,0x00000},{0,0x00000},{1,0x01108},{1,0x01108}},
+   {{0,0x00000},{0,0x00000},{1,0x01121},{1,0x01121}},{{0,0x00000},{0,0x00000},{1,0x01109},{1,0x01109}},
+   {{0,0x00000},{0,0x00000},{1,0x0110A},{1,0x0110A}},{{0,0x00000},{0,0x00000},{1,0x0110B},{1,0x0110B}},
+   {{0,0x00000},{0,0x00000},{1,0x0110C},{1,0x0110C}},{{0,0x00000},{0,0x00000},{1,0x0110D},{1,0x0110D}},
+   {{0,0x00000},{0,0x00000},{1,0x0110E},{1,0x0110E}},{{0,0x00000},{0,0x00000},{1,0x0110F},{1,0x0110F}},
+   {{0,0x00000},{0,0x00000},{1,0x01110},{1,0x01110}},{{0,0x00000},{0,0x00000},{1,0x01111},{1,0x01111}},
+   {{0,0x00000},{0,0x00000},{1,0x01112},{1,0x01112}},{{0,0x00000},{0,0x00000},{1,0x01161},{1,0x01161}},
+   {{0,0x00000},{0,0x00000},{1,0x01162},{1,0x01162}},{{0,0x00000},{0,0x00000},{1,0x01163},{1,0x01163}},
+   {{0,0x00000},{0,0x00000},{1,0x01164},{1,0x01164}},{{0,0x00000},{0,0x00000},{1,0x01165},{1,0x01165}},
+   {{0,0x00000},{0,0x00000},{1,0x01166},{1,0x01166}},{{0,0x00000},{0,0x00000},{1,0x01167},{1,0x01167}},
+   {{0,0x00000},{0,0x00000},{1,0x01168},{1,0x01168}},{{0,0x00000},{0,0x00000},{1,0x01169},{1,0x01169}},
+   {{0,0x00000},{0,0x00000},{1,0x0116A},{1,0x0116A}},{{0,0x00000},{0,0x00000},{1,0x0116B},{1,0x0116B}},
+   {{0,0x00000},{0,0x00000},{1,0x0116C},{1,0x0116C}},{{0,0x00000},{0,0x00000},{1,0x0116D},{1,0x0116D}},
+   {{0,0x00000},{0,0x00000},{1,0x0116E},{1,0x0116E}},{{0,0x00000},{0,0x00000},{1,0x0116F},{1,0x0116F}},
+   {{0,0x00000},{0,0x00000},{1,0x01170},{1,0x01170}},{{0,0x00000},{0,0x00000},{1,0x01171},{1,0x01171}},
+   {{0,0x00000},{0,0x00000},{1,0x01172},{1,0x01172}},{{0,0x00000},{0,0x00000},{1,0x01173},{1,0x01173}},
+   {{0,0x00000},{0,0x00000},{1,0x01174},{1,0x01174}},{{0,0x00000},{0,0x00000},{1,0x01175},{1,0x01175}},
+   {{0,0x00000},{0,0x00000},{1,0x01160},{1,0x01160}},{{0,0x00000},{0,0x00000},{1,0x01114},{1,0x01114}},
+   {{0,0x00000},{0,0x00000},{1,0x01115},{1,0x01115}},{{0,0x00000},{0,0x00000},{1,0x011C7},{1,0x011C7}},
+   {{0,0x00000},{0,0x00000},{1,0x011C8},{1,0x011C8}},{{0,0x00000},{0,0x00000},{1,0x011CC},{1,0x011CC}},
+   {{0,0x00000},{0,0x00000},{1,0x011CE},{1,0x011CE}},{{0,0x00000},{0,0x00000},{1,0x011D3},{1,0x011D3}},
+   {{0,0x00000},{0,0x00000},{1,0x011D7},{1,0x011D7}},{{0,0x00000},{0,0x00000},{1,0x011D9},{1,0x011D9}},
+   {{0,0x00000},{0,0x00000},{1,0x0111C},{1,0x0111C}},{{0,0x00000},{0,0x00000},{1,0x011DD},{1,0x011DD}},
+   {{0,0x00000},{0,0x00000},{1,0x011DF},{1,0x011DF}},{{0,0x00000},{0,0x00000},{1,0x0111D},{1,0x0111D}},
+   {{0,0x00000},{0,0x00000},{1,0x0111E},{1,0x0111E}},{{0,0x00000},{0,0x00000},{1,0x01120},{1,0x01120}},
+   {{0,0x00000},{0,0x00000},{1,0x01122},{1,0x01122}},{{0,0x00000},{0,0x00000},{1,0x01123},{1,0x01123}},
+   {{0,0x00000},{0,0x00000},{1,0x01127},{1,0x01127}},{{0,0x00000},{0,0x00000},{1,0x01129},{1,0x01129}},
+   {{0,0x00000},{0,0x00000},{1,0x0112B},{1,0x0112B}},{{0,0x00000},{0,0x00000},{1,0x0112C},{1,0x0112C}},
+   {{0,0x00000},{0,0x00000},{1,0x0112D},{1,0x0112D}},{{0,0x00000},{0,0x00000},{1,0x0112E},{1,0x0112E}},
+   {{0,0x00000},{0,0x00000},{1,0x0112F},{1,0x0112F}},{{0,0x00000},{0,0x00000},{1,0x01132},{1,0x01132}},
+   {{0,0x00000},{0,0x00000},{1,0x01136},{1,0x01136}},{{0,0x00000},{0,0x00000},{1,0x01140},{1,0x01140}}
+  },
+
+  /* block 96 */
+  {{{0,0x00000},{0,0x00000},{1,0x01147},{1,0x01147}},{{0,0x00000},{0,0x00000},{1,0x0114C},{1,0x0114C}},
+   {{0,0x00000},{0,0x00000},{1,0x011F1},{1,0x011F1}},{{0,0x00000},{0,0x00000},{1,0x011F2},{1,0x011F2}},
+   {{0,0x00000},{0,0x00000},{1,0x01157},{1,0x01157}},{{0,0x00000},{0,0x00000},{1,0x01158},{1,0x01158}},
+   {{0,0x00000},{0,0x00000},{1,0x01159},{1,0x01159}},{{0,0x00000},{0,0x00000},{1,0x01184},{1,0x01184}},
+   {{0,0x00000},{0,0x00000},{1,0x01185},{1,0x01185}},{{0,0x00000},{0,0x00000},{1,0x01188},{1,0x01188}},
+   {{0,0x00000},{0,0x00000},{1,0x01191},{1,0x01191}},{{0,0x00000},{0,0x00000},{1,0x01192},{1,0x01192}},
+   {{0,0x00000},{0,0x00000},{1,0x01194},{1,0x01194}},{{0,0x00000},{0,0x00000},{1,0x0119E},{1,0x0119E}},
+   {{0,0x00000},{0,0x00000},{1,0x011A1},{1,0x011A1}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x04E00},{1,0x04E00}},{{0,0x00000},{0,0x00000},{1,0x04E8C},{1,0x04E8C}},
+   {{0,0x00000},{0,0x00000},{1,0x04E09},{1,0x04E09}},{{0,0x00000},{0,0x00000},{1,0x056DB},{1,0x056DB}},
+   {{0,0x00000},{0,0x00000},{1,0x04E0A},{1,0x04E0A}},{{0,0x00000},{0,0x00000},{1,0x04E2D},{1,0x04E2D}},
+   {{0,0x00000},{0,0x00000},{1,0x04E0B},{1,0x04E0B}},{{0,0x00000},{0,0x00000},{1,0x07532},{1,0x07532}},
+   {{0,0x00000},{0,0x00000},{1,0x04E59},{1,0x04E59}},{{0,0x00000},{0,0x00000},{1,0x04E19},{1,0x04E19}},
+   {{0,0x00000},{0,0x00000},{1,0x04E01},{1,0x04E01}},{{0,0x00000},{0,0x00000},{1,0x05929},{1,0x05929}},
+   {{0,0x00000},{0,0x00000},{1,0x05730},{1,0x05730}},{{0,0x00000},{0,0x00000},{1,0x04EBA},{1,0x04EBA}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 97 */
+  {{{0,0x00000},{0,0x00000},{3,0x00B58},{3,0x00B58}},{{0,0x00000},{0,0x00000},{3,0x00B5B},{3,0x00B5B}},
+   {{0,0x00000},{0,0x00000},{3,0x00B5E},{3,0x00B5E}},{{0,0x00000},{0,0x00000},{3,0x00B61},{3,0x00B61}},
+   {{0,0x00000},{0,0x00000},{3,0x00B64},{3,0x00B64}},{{0,0x00000},{0,0x00000},{3,0x00B67},{3,0x00B67}},
+   {{0,0x00000},{0,0x00000},{3,0x00B6A},{3,0x00B6A}},{{0,0x00000},{0,0x00000},{3,0x00B6D},{3,0x00B6D}},
+   {{0,0x00000},{0,0x00000},{3,0x00B70},{3,0x00B70}},{{0,0x00000},{0,0x00000},{3,0x00B73},{3,0x00B73}},
+   {{0,0x00000},{0,0x00000},{3,0x00B76},{3,0x00B76}},{{0,0x00000},{0,0x00000},{3,0x00B79},{3,0x00B79}},
+   {{0,0x00000},{0,0x00000},{3,0x00B7C},{3,0x00B7C}},{{0,0x00000},{0,0x00000},{3,0x00B7F},{3,0x00B7F}},
+   {{0,0x00000},{0,0x00000},{4,0x00B82},{4,0x00B82}},{{0,0x00000},{0,0x00000},{4,0x00B86},{4,0x00B86}},
+   {{0,0x00000},{0,0x00000},{4,0x00B8A},{4,0x00B8A}},{{0,0x00000},{0,0x00000},{4,0x00B8E},{4,0x00B8E}},
+   {{0,0x00000},{0,0x00000},{4,0x00B92},{4,0x00B92}},{{0,0x00000},{0,0x00000},{4,0x00B96},{4,0x00B96}},
+   {{0,0x00000},{0,0x00000},{4,0x00B9A},{4,0x00B9A}},{{0,0x00000},{0,0x00000},{4,0x00B9E},{4,0x00B9E}},
+   {{0,0x00000},{0,0x00000},{4,0x00BA2},{4,0x00BA2}},{{0,0x00000},{0,0x00000},{4,0x00BA6},{4,0x00BA6}},
+   {{0,0x00000},{0,0x00000},{4,0x00BAA},{4,0x00BAA}},{{0,0x00000},{0,0x00000},{4,0x00BAE},{4,0x00BAE}},
+   {{0,0x00000},{0,0x00000},{4,0x00BB2},{4,0x00BB2}},{{0,0x00000},{0,0x00000},{4,0x00BB6},{4,0x00BB6}},
+   {{0,0x00000},{0,0x00000},{4,0x00BBA},{4,0x00BBA}},{{0,0x00000},{0,0x00000},{7,0x00BBE},{7,0x00BBE}},
+   {{0,0x00000},{0,0x00000},{6,0x00BC5},{6,0x00BC5}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{3,0x00BCB},{3,0x00BCB}},{{0,0x00000},{0,0x00000},{3,0x00BCE},{3,0x00BCE}},
+   {{0,0x00000},{0,0x00000},{3,0x00BD1},{3,0x00BD1}},{{0,0x00000},{0,0x00000},{3,0x00BD4},{3,0x00BD4}},
+   {{0,0x00000},{0,0x00000},{3,0x00BD7},{3,0x00BD7}},{{0,0x00000},{0,0x00000},{3,0x00BDA},{3,0x00BDA}},
+   {{0,0x00000},{0,0x00000},{3,0x00BDD},{3,0x00BDD}},{{0,0x00000},{0,0x00000},{3,0x00BE0},{3,0x00BE0}},
+   {{0,0x00000},{0,0x00000},{3,0x00BE3},{3,0x00BE3}},{{0,0x00000},{0,0x00000},{3,0x00BE6},{3,0x00BE6}},
+   {{0,0x00000},{0,0x00000},{3,0x00BE9},{3,0x00BE9}},{{0,0x00000},{0,0x00000},{3,0x00BEC},{3,0x00BEC}},
+   {{0,0x00000},{0,0x00000},{3,0x00BEF},{3,0x00BEF}},{{0,0x00000},{0,0x00000},{3,0x00BF2},{3,0x00BF2}},
+   {{0,0x00000},{0,0x00000},{3,0x00BF5},{3,0x00BF5}},{{0,0x00000},{0,0x00000},{3,0x00BF8},{3,0x00BF8}},
+   {{0,0x00000},{0,0x00000},{3,0x00BFB},{3,0x00BFB}},{{0,0x00000},{0,0x00000},{3,0x00BFE},{3,0x00BFE}},
+   {{0,0x00000},{0,0x00000},{3,0x00C01},{3,0x00C01}},{{0,0x00000},{0,0x00000},{3,0x00C04},{3,0x00C04}},
+   {{0,0x00000},{0,0x00000},{3,0x00C07},{3,0x00C07}},{{0,0x00000},{0,0x00000},{3,0x00C0A},{3,0x00C0A}},
+   {{0,0x00000},{0,0x00000},{3,0x00C0D},{3,0x00C0D}},{{0,0x00000},{0,0x00000},{3,0x00C10},{3,0x00C10}},
+   {{0,0x00000},{0,0x00000},{3,0x00C13},{3,0x00C13}},{{0,0x00000},{0,0x00000},{3,0x00C16},{3,0x00C16}},
+   {{0,0x00000},{0,0x00000},{3,0x00C19},{3,0x00C19}},{{0,0x00000},{0,0x00000},{3,0x00C1C},{3,0x00C1C}},
+   {{0,0x00000},{0,0x00000},{3,0x00C1F},{3,0x00C1F}},{{0,0x00000},{0,0x00000},{3,0x00C22},{3,0x00C22}},
+   {{0,0x00000},{0,0x00000},{3,0x00C25},{3,0x00C25}},{{0,0x00000},{0,0x00000},{3,0x00C28},{3,0x00C28}}
+  },
+
+  /* block 98 */
+  {{{0,0x00000},{0,0x00000},{3,0x00C2B},{3,0x00C2B}},{{0,0x00000},{0,0x00000},{3,0x00C2E},{3,0x00C2E}},
+   {{0,0x00000},{0,0x00000},{3,0x00C31},{3,0x00C31}},{{0,0x00000},{0,0x00000},{3,0x00C34},{3,0x00C34}},
+   {{0,0x00000},{0,0x00000},{1,0x0554F},{1,0x0554F}},{{0,0x00000},{0,0x00000},{1,0x05E7C},{1,0x05E7C}},
+   {{0,0x00000},{0,0x00000},{1,0x06587},{1,0x06587}},{{0,0x00000},{0,0x00000},{1,0x07B8F},{1,0x07B8F}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{3,0x00C37},{3,0x00C3A}},{{0,0x00000},{0,0x00000},{2,0x00C3D},{2,0x00C3D}},
+   {{0,0x00000},{0,0x00000},{2,0x00C3F},{2,0x00C3F}},{{0,0x00000},{0,0x00000},{2,0x00C41},{2,0x00C41}},
+   {{0,0x00000},{0,0x00000},{2,0x00C43},{2,0x00C43}},{{0,0x00000},{0,0x00000},{2,0x00C45},{2,0x00C45}},
+   {{0,0x00000},{0,0x00000},{2,0x00C47},{2,0x00C47}},{{0,0x00000},{0,0x00000},{2,0x00C49},{2,0x00C49}},
+   {{0,0x00000},{0,0x00000},{2,0x00C4B},{2,0x00C4B}},{{0,0x00000},{0,0x00000},{2,0x00C4D},{2,0x00C4D}},
+   {{0,0x00000},{0,0x00000},{2,0x00C4F},{2,0x00C4F}},{{0,0x00000},{0,0x00000},{2,0x00C51},{2,0x00C51}},
+   {{0,0x00000},{0,0x00000},{2,0x00C53},{2,0x00C53}},{{0,0x00000},{0,0x00000},{2,0x00C55},{2,0x00C55}},
+   {{0,0x00000},{0,0x00000},{2,0x00C57},{2,0x00C57}},{{0,0x00000},{0,0x00000},{2,0x00C59},{2,0x00C59}},
+   {{0,0x00000},{0,0x00000},{1,0x01100},{1,0x01100}},{{0,0x00000},{0,0x00000},{1,0x01102},{1,0x01102}},
+   {{0,0x00000},{0,0x00000},{1,0x01103},{1,0x01103}},{{0,0x00000},{0,0x00000},{1,0x01105},{1,0x01105}},
+   {{0,0x00000},{0,0x00000},{1,0x01106},{1,0x01106}},{{0,0x00000},{0,0x00000},{1,0x01107},{1,0x01107}},
+   {{0,0x00000},{0,0x00000},{1,0x01109},{1,0x01109}},{{0,0x00000},{0,0x00000},{1,0x0110B},{1,0x0110B}},
+   {{0,0x00000},{0,0x00000},{1,0x0110C},{1,0x0110C}},{{0,0x00000},{0,0x00000},{1,0x0110E},{1,0x0110E}},
+   {{0,0x00000},{0,0x00000},{1,0x0110F},{1,0x0110F}},{{0,0x00000},{0,0x00000},{1,0x01110},{1,0x01110}},
+   {{0,0x00000},{0,0x00000},{1,0x01111},{1,0x01111}},{{0,0x00000},{0,0x00000},{1,0x01112},{1,0x01112}},
+   {{0,0x00000},{0,0x00000},{2,0x00C5B},{2,0x00C5B}},{{0,0x00000},{0,0x00000},{2,0x00C5D},{2,0x00C5D}},
+   {{0,0x00000},{0,0x00000},{2,0x00C5F},{2,0x00C5F}},{{0,0x00000},{0,0x00000},{2,0x00C61},{2,0x00C61}},
+   {{0,0x00000},{0,0x00000},{2,0x00C63},{2,0x00C63}},{{0,0x00000},{0,0x00000},{2,0x00C65},{2,0x00C65}},
+   {{0,0x00000},{0,0x00000},{2,0x00C67},{2,0x00C67}},{{0,0x00000},{0,0x00000},{2,0x00C69},{2,0x00C69}},
+   {{0,0x00000},{0,0x00000},{2,0x00C6B},{2,0x00C6B}},{{0,0x00000},{0,0x00000},{2,0x00C6D},{2,0x00C6D}},
+   {{0,0x00000},{0,0x00000},{2,0x00C6F},{2,0x00C6F}},{{0,0x00000},{0,0x00000},{2,0x00C71},{2,0x00C71}},
+   {{0,0x00000},{0,0x00000},{2,0x00C73},{2,0x00C73}},{{0,0x00000},{0,0x00000},{2,0x00C75},{2,0x00C75}},
+   {{0,0x00000},{0,0x00000},{5,0x00C77},{5,0x00C77}},{{0,0x00000},{0,0x00000},{4,0x00C7C},{4,0x00C7C}},
+   {{0,0x00000},{0,0x00000},{2,0x00C80},{2,0x00C80}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 99 */
+  {{{0,0x00000},{0,0x00000},{1,0x04E00},{1,0x04E00}},{{0,0x00000},{0,0x00000},{1,0x04E8C},{1,0x04E8C}},
+   {{0,0x00000},{0,0x00000},{1,0x04E09},{1,0x04E09}},{{0,0x00000},{0,0x00000},{1,0x056DB},{1,0x056DB}},
+   {{0,0x00000},{0,0x00000},{1,0x04E94},{1,0x04E94}},{{0,0x00000},{0,0x00000},{1,0x0516D},{1,0x0516D}},
+   {{0,0x00000},{0,0x00000},{1,0x04E03},{1,0x04E03}},{{0,0x00000},{0,0x00000},{1,0x0516B},{1,0x0516B}},
+   {{0,0x00000},{0,0x00000},{1,0x04E5D},{1,0x04E5D}},{{0,0x00000},{0,0x00000},{1,0x05341},{1,0x05341}},
+   {{0,0x00000},{0,0x00000},{1,0x06708},{1,0x06708}},{{0,0x00000},{0,0x00000},{1,0x0706B},{1,0x0706B}},
+   {{0,0x00000},{0,0x00000},{1,0x06C34},{1,0x06C34}},{{0,0x00000},{0,0x00000},{1,0x06728},{1,0x06728}},
+   {{0,0x00000},{0,0x00000},{1,0x091D1},{1,0x091D1}},{{0,0x00000},{0,0x00000},{1,0x0571F},{1,0x0571F}},
+   {{0,0x00000},{0,0x00000},{1,0x065E5},{1,0x065E5}},{{0,0x00000},{0,0x00000},{1,0x0682A},{1,0x0682A}},
+   {{0,0x00000},{0,0x00000},{1,0x06709},{1,0x06709}},{{0,0x00000},{0,0x00000},{1,0x0793E},{1,0x0793E}},
+   {{0,0x00000},{0,0x00000},{1,0x0540D},{1,0x0540D}},{{0,0x00000},{0,0x00000},{1,0x07279},{1,0x07279}},
+   {{0,0x00000},{0,0x00000},{1,0x08CA1},{1,0x08CA1}},{{0,0x00000},{0,0x00000},{1,0x0795D},{1,0x0795D}},
+   {{0,0x00000},{0,0x00000},{1,0x052B4},{1,0x052B4}},{{0,0x00000},{0,0x00000},{1,0x079D8},{1,0x079D8}},
+   {{0,0x00000},{0,0x00000},{1,0x07537},{1,0x07537}},{{0,0x00000},{0,0x00000},{1,0x05973},{1,0x05973}},
+   {{0,0x00000},{0,0x00000},{1,0x09069},{1,0x09069}},{{0,0x00000},{0,0x00000},{1,0x0512A},{1,0x0512A}},
+   {{0,0x00000},{0,0x00000},{1,0x05370},{1,0x05370}},{{0,0x00000},{0,0x00000},{1,0x06CE8},{1,0x06CE8}},
+   {{0,0x00000},{0,0x00000},{1,0x09805},{1,0x09805}},{{0,0x00000},{0,0x00000},{1,0x04F11},{1,0x04F11}},
+   {{0,0x00000},{0,0x00000},{1,0x05199},{1,0x05199}},{{0,0x00000},{0,0x00000},{1,0x06B63},{1,0x06B63}},
+   {{0,0x00000},{0,0x00000},{1,0x04E0A},{1,0x04E0A}},{{0,0x00000},{0,0x00000},{1,0x04E2D},{1,0x04E2D}},
+   {{0,0x00000},{0,0x00000},{1,0x04E0B},{1,0x04E0B}},{{0,0x00000},{0,0x00000},{1,0x05DE6},{1,0x05DE6}},
+   {{0,0x00000},{0,0x00000},{1,0x053F3},{1,0x053F3}},{{0,0x00000},{0,0x00000},{1,0x0533B},{1,0x0533B}},
+   {{0,0x00000},{0,0x00000},{1,0x05B97},{1,0x05B97}},{{0,0x00000},{0,0x00000},{1,0x05B66},{1,0x05B66}},
+   {{0,0x00000},{0,0x00000},{1,0x076E3},{1,0x076E3}},{{0,0x00000},{0,0x00000},{1,0x04F01},{1,0x04F01}},
+   {{0,0x00000},{0,0x00000},{1,0x08CC7},{1,0x08CC7}},{{0,0x00000},{0,0x00000},{1,0x05354},{1,0x05354}},
+   {{0,0x00000},{0,0x00000},{1,0x0591C},{1,0x0591C}},{{0,0x00000},{0,0x00000},{2,0x00C82},{2,0x00C82}},
+   {{0,0x00000},{0,0x00000},{2,0x00C84},{2,0x00C84}},{{0,0x00000},{0,0x00000},{2,0x00C86},{2,0x00C86}},
+   {{0,0x00000},{0,0x00000},{2,0x00C88},{2,0x00C88}},{{0,0x00000},{0,0x00000},{2,0x00C8A},{2,0x00C8A}},
+   {{0,0x00000},{0,0x00000},{2,0x00C8C},{2,0x00C8C}},{{0,0x00000},{0,0x00000},{2,0x00C8E},{2,0x00C8E}},
+   {{0,0x00000},{0,0x00000},{2,0x00C90},{2,0x00C90}},{{0,0x00000},{0,0x00000},{2,0x00C92},{2,0x00C92}},
+   {{0,0x00000},{0,0x00000},{2,0x00C94},{2,0x00C94}},{{0,0x00000},{0,0x00000},{2,0x00C96},{2,0x00C96}},
+   {{0,0x00000},{0,0x00000},{2,0x00C98},{2,0x00C98}},{{0,0x00000},{0,0x00000},{2,0x00C9A},{2,0x00C9A}},
+   {{0,0x00000},{0,0x00000},{2,0x00C9C},{2,0x00C9C}},{{0,0x00000},{0,0x00000},{2,0x00C9E},{2,0x00C9E}}
+  },
+
+  /* block 100 */
+  {{{0,0x00000},{0,0x00000},{2,0x00CA0},{2,0x00CA0}},{{0,0x00000},{0,0x00000},{2,0x00CA2},{2,0x00CA2}},
+   {{0,0x00000},{0,0x00000},{2,0x00CA4},{2,0x00CA4}},{{0,0x00000},{0,0x00000},{2,0x00CA6},{2,0x00CA6}},
+   {{0,0x00000},{0,0x00000},{2,0x00CA8},{2,0x00CA8}},{{0,0x00000},{0,0x00000},{2,0x00CAA},{2,0x00CAA}},
+   {{0,0x00000},{0,0x00000},{2,0x00CAC},{2,0x00CAC}},{{0,0x00000},{0,0x00000},{2,0x00CAE},{2,0x00CAE}},
+   {{0,0x00000},{0,0x00000},{2,0x00CB0},{2,0x00CB0}},{{0,0x00000},{0,0x00000},{3,0x00CB2},{3,0x00CB2}},
+   {{0,0x00000},{0,0x00000},{3,0x00CB5},{3,0x00CB5}},{{0,0x00000},{0,0x00000},{3,0x00CB8},{3,0x00CB8}},
+   {{0,0x00000},{0,0x00000},{2,0x00CBB},{2,0x00CBD}},{{0,0x00000},{0,0x00000},{3,0x00CBF},{3,0x00CBF}},
+   {{0,0x00000},{0,0x00000},{2,0x00CC2},{2,0x00CC4}},{{0,0x00000},{0,0x00000},{3,0x00CC6},{3,0x00CC9}},
+   {{0,0x00000},{0,0x00000},{1,0x030A2},{1,0x030A2}},{{0,0x00000},{0,0x00000},{1,0x030A4},{1,0x030A4}},
+   {{0,0x00000},{0,0x00000},{1,0x030A6},{1,0x030A6}},{{0,0x00000},{0,0x00000},{1,0x030A8},{1,0x030A8}},
+   {{0,0x00000},{0,0x00000},{1,0x030AA},{1,0x030AA}},{{0,0x00000},{0,0x00000},{1,0x030AB},{1,0x030AB}},
+   {{0,0x00000},{0,0x00000},{1,0x030AD},{1,0x030AD}},{{0,0x00000},{0,0x00000},{1,0x030AF},{1,0x030AF}},
+   {{0,0x00000},{0,0x00000},{1,0x030B1},{1,0x030B1}},{{0,0x00000},{0,0x00000},{1,0x030B3},{1,0x030B3}},
+   {{0,0x00000},{0,0x00000},{1,0x030B5},{1,0x030B5}},{{0,0x00000},{0,0x00000},{1,0x030B7},{1,0x030B7}},
+   {{0,0x00000},{0,0x00000},{1,0x030B9},{1,0x030B9}},{{0,0x00000},{0,0x00000},{1,0x030BB},{1,0x030BB}},
+   {{0,0x00000},{0,0x00000},{1,0x030BD},{1,0x030BD}},{{0,0x00000},{0,0x00000},{1,0x030BF},{1,0x030BF}},
+   {{0,0x00000},{0,0x00000},{1,0x030C1},{1,0x030C1}},{{0,0x00000},{0,0x00000},{1,0x030C4},{1,0x030C4}},
+   {{0,0x00000},{0,0x00000},{1,0x030C6},{1,0x030C6}},{{0,0x00000},{0,0x00000},{1,0x030C8},{1,0x030C8}},
+   {{0,0x00000},{0,0x00000},{1,0x030CA},{1,0x030CA}},{{0,0x00000},{0,0x00000},{1,0x030CB},{1,0x030CB}},
+   {{0,0x00000},{0,0x00000},{1,0x030CC},{1,0x030CC}},{{0,0x00000},{0,0x00000},{1,0x030CD},{1,0x030CD}},
+   {{0,0x00000},{0,0x00000},{1,0x030CE},{1,0x030CE}},{{0,0x00000},{0,0x00000},{1,0x030CF},{1,0x030CF}},
+   {{0,0x00000},{0,0x00000},{1,0x030D2},{1,0x030D2}},{{0,0x00000},{0,0x00000},{1,0x030D5},{1,0x030D5}},
+   {{0,0x00000},{0,0x00000},{1,0x030D8},{1,0x030D8}},{{0,0x00000},{0,0x00000},{1,0x030DB},{1,0x030DB}},
+   {{0,0x00000},{0,0x00000},{1,0x030DE},{1,0x030DE}},{{0,0x00000},{0,0x00000},{1,0x030DF},{1,0x030DF}},
+   {{0,0x00000},{0,0x00000},{1,0x030E0},{1,0x030E0}},{{0,0x00000},{0,0x00000},{1,0x030E1},{1,0x030E1}},
+   {{0,0x00000},{0,0x00000},{1,0x030E2},{1,0x030E2}},{{0,0x00000},{0,0x00000},{1,0x030E4},{1,0x030E4}},
+   {{0,0x00000},{0,0x00000},{1,0x030E6},{1,0x030E6}},{{0,0x00000},{0,0x00000},{1,0x030E8},{1,0x030E8}},
+   {{0,0x00000},{0,0x00000},{1,0x030E9},{1,0x030E9}},{{0,0x00000},{0,0x00000},{1,0x030EA},{1,0x030EA}},
+   {{0,0x00000},{0,0x00000},{1,0x030EB},{1,0x030EB}},{{0,0x00000},{0,0x00000},{1,0x030EC},{1,0x030EC}},
+   {{0,0x00000},{0,0x00000},{1,0x030ED},{1,0x030ED}},{{0,0x00000},{0,0x00000},{1,0x030EF},{1,0x030EF}},
+   {{0,0x00000},{0,0x00000},{1,0x030F0},{1,0x030F0}},{{0,0x00000},{0,0x00000},{1,0x030F1},{1,0x030F1}},
+   {{0,0x00000},{0,0x00000},{1,0x030F2},{1,0x030F2}},{{0,0x00000},{0,0x00000},{2,0x00CCC},{2,0x00CCC}}
+  },
+
+  /* block 101 */
+  {{{0,0x00000},{0,0x00000},{5,0x00CCE},{5,0x00CCE}},{{0,0x00000},{0,0x00000},{4,0x00CD3},{4,0x00CD3}},
+   {{0,0x00000},{0,0x00000},{5,0x00CD7},{5,0x00CD7}},{{0,0x00000},{0,0x00000},{3,0x00CDC},{3,0x00CDC}},
+   {{0,0x00000},{0,0x00000},{5,0x00CDF},{5,0x00CDF}},{{0,0x00000},{0,0x00000},{3,0x00CE4},{3,0x00CE4}},
+   {{0,0x00000},{0,0x00000},{3,0x00CE7},{3,0x00CE7}},{{0,0x00000},{0,0x00000},{6,0x00CEA},{6,0x00CEA}},
+   {{0,0x00000},{0,0x00000},{4,0x00CF0},{4,0x00CF0}},{{0,0x00000},{0,0x00000},{3,0x00CF4},{3,0x00CF4}},
+   {{0,0x00000},{0,0x00000},{3,0x00CF7},{3,0x00CF7}},{{0,0x00000},{0,0x00000},{3,0x00CFA},{3,0x00CFA}},
+   {{0,0x00000},{0,0x00000},{4,0x00CFD},{4,0x00CFD}},{{0,0x00000},{0,0x00000},{4,0x00D01},{4,0x00D01}},
+   {{0,0x00000},{0,0x00000},{4,0x00D05},{4,0x00D05}},{{0,0x00000},{0,0x00000},{4,0x00D09},{4,0x00D09}},
+   {{0,0x00000},{0,0x00000},{4,0x00D0D},{4,0x00D0D}},{{0,0x00000},{0,0x00000},{4,0x00D11},{4,0x00D11}},
+   {{0,0x00000},{0,0x00000},{4,0x00D15},{4,0x00D15}},{{0,0x00000},{0,0x00000},{6,0x00D19},{6,0x00D19}},
+   {{0,0x00000},{0,0x00000},{2,0x00D1F},{2,0x00D1F}},{{0,0x00000},{0,0x00000},{6,0x00D21},{6,0x00D21}},
+   {{0,0x00000},{0,0x00000},{6,0x00D27},{6,0x00D27}},{{0,0x00000},{0,0x00000},{5,0x00D2D},{5,0x00D2D}},
+   {{0,0x00000},{0,0x00000},{4,0x00D32},{4,0x00D32}},{{0,0x00000},{0,0x00000},{6,0x00D36},{6,0x00D36}},
+   {{0,0x00000},{0,0x00000},{6,0x00D3C},{6,0x00D3C}},{{0,0x00000},{0,0x00000},{4,0x00D42},{4,0x00D42}},
+   {{0,0x00000},{0,0x00000},{3,0x00D46},{3,0x00D46}},{{0,0x00000},{0,0x00000},{3,0x00D49},{3,0x00D49}},
+   {{0,0x00000},{0,0x00000},{4,0x00D4C},{4,0x00D4C}},{{0,0x00000},{0,0x00000},{4,0x00D50},{4,0x00D50}},
+   {{0,0x00000},{0,0x00000},{5,0x00D54},{5,0x00D54}},{{0,0x00000},{0,0x00000},{5,0x00D59},{5,0x00D59}},
+   {{0,0x00000},{0,0x00000},{3,0x00D5E},{3,0x00D5E}},{{0,0x00000},{0,0x00000},{3,0x00D61},{3,0x00D61}},
+   {{0,0x00000},{0,0x00000},{4,0x00D64},{4,0x00D64}},{{0,0x00000},{0,0x00000},{3,0x00D68},{3,0x00D68}},
+   {{0,0x00000},{0,0x00000},{3,0x00D6B},{3,0x00D6B}},{{0,0x00000},{0,0x00000},{2,0x00D6E},{2,0x00D6E}},
+   {{0,0x00000},{0,0x00000},{2,0x00D70},{2,0x00D70}},{{0,0x00000},{0,0x00000},{3,0x00D72},{3,0x00D72}},
+   {{0,0x00000},{0,0x00000},{3,0x00D75},{3,0x00D75}},{{0,0x00000},{0,0x00000},{6,0x00D78},{6,0x00D78}},
+   {{0,0x00000},{0,0x00000},{4,0x00D7E},{4,0x00D7E}},{{0,0x00000},{0,0x00000},{5,0x00D82},{5,0x00D82}},
+   {{0,0x00000},{0,0x00000},{6,0x00D87},{6,0x00D87}},{{0,0x00000},{0,0x00000},{4,0x00D8D},{4,0x00D8D}},
+   {{0,0x00000},{0,0x00000},{3,0x00D91},{3,0x00D91}},{{0,0x00000},{0,0x00000},{3,0x00D94},{3,0x00D94}},
+   {{0,0x00000},{0,0x00000},{6,0x00D97},{6,0x00D97}},{{0,0x00000},{0,0x00000},{4,0x00D9D},{4,0x00D9D}},
+   {{0,0x00000},{0,0x00000},{6,0x00DA1},{6,0x00DA1}},{{0,0x00000},{0,0x00000},{3,0x00DA7},{3,0x00DA7}},
+   {{0,0x00000},{0,0x00000},{5,0x00DAA},{5,0x00DAA}},{{0,0x00000},{0,0x00000},{3,0x00DAF},{3,0x00DAF}},
+   {{0,0x00000},{0,0x00000},{4,0x00DB2},{4,0x00DB2}},{{0,0x00000},{0,0x00000},{3,0x00DB6},{3,0x00DB6}},
+   {{0,0x00000},{0,0x00000},{4,0x00DB9},{4,0x00DB9}},{{0,0x00000},{0,0x00000},{5,0x00DBD},{5,0x00DBD}},
+   {{0,0x00000},{0,0x00000},{4,0x00DC2},{4,0x00DC2}},{{0,0x00000},{0,0x00000},{5,0x00DC6},{5,0x00DC6}},
+   {{0,0x00000},{0,0x00000},{4,0x00DCB},{4,0x00DCB}},{{0,0x00000},{0,0x00000},{2,0x00DCF},{2,0x00DCF}}
+  },
+
+  /* block 102 */
+  {{{0,0x00000},{0,0x00000},{5,0x00DD1},{5,0x00DD1}},{{0,0x00000},{0,0x00000},{3,0x00DD6},{3,0x00DD6}},
+   {{0,0x00000},{0,0x00000},{3,0x00DD9},{3,0x00DD9}},{{0,0x00000},{0,0x00000},{4,0x00DDC},{4,0x00DDC}},
+   {{0,0x00000},{0,0x00000},{3,0x00DE0},{3,0x00DE0}},{{0,0x00000},{0,0x00000},{3,0x00DE3},{3,0x00DE3}},
+   {{0,0x00000},{0,0x00000},{3,0x00DE6},{3,0x00DE6}},{{0,0x00000},{0,0x00000},{5,0x00DE9},{5,0x00DE9}},
+   {{0,0x00000},{0,0x00000},{4,0x00DEE},{4,0x00DEE}},{{0,0x00000},{0,0x00000},{2,0x00DF2},{2,0x00DF2}},
+   {{0,0x00000},{0,0x00000},{6,0x00DF4},{6,0x00DF4}},{{0,0x00000},{0,0x00000},{3,0x00DFA},{3,0x00DFA}},
+   {{0,0x00000},{0,0x00000},{5,0x00DFD},{5,0x00DFD}},{{0,0x00000},{0,0x00000},{4,0x00E02},{4,0x00E02}},
+   {{0,0x00000},{0,0x00000},{4,0x00E06},{4,0x00E06}},{{0,0x00000},{0,0x00000},{3,0x00E0A},{3,0x00E0A}},
+   {{0,0x00000},{0,0x00000},{3,0x00E0D},{3,0x00E0D}},{{0,0x00000},{0,0x00000},{4,0x00E10},{4,0x00E10}},
+   {{0,0x00000},{0,0x00000},{2,0x00E14},{2,0x00E14}},{{0,0x00000},{0,0x00000},{4,0x00E16},{4,0x00E16}},
+   {{0,0x00000},{0,0x00000},{5,0x00E1A},{5,0x00E1A}},{{0,0x00000},{0,0x00000},{2,0x00E1F},{2,0x00E1F}},
+   {{0,0x00000},{0,0x00000},{6,0x00E21},{6,0x00E21}},{{0,0x00000},{0,0x00000},{3,0x00E27},{3,0x00E27}},
+   {{0,0x00000},{0,0x00000},{2,0x00E2A},{2,0x00E2A}},{{0,0x00000},{0,0x00000},{2,0x00E2C},{2,0x00E2C}},
+   {{0,0x00000},{0,0x00000},{2,0x00E2E},{2,0x00E2E}},{{0,0x00000},{0,0x00000},{2,0x00E30},{2,0x00E30}},
+   {{0,0x00000},{0,0x00000},{2,0x00E32},{2,0x00E32}},{{0,0x00000},{0,0x00000},{2,0x00E34},{2,0x00E34}},
+   {{0,0x00000},{0,0x00000},{2,0x00E36},{2,0x00E36}},{{0,0x00000},{0,0x00000},{2,0x00E38},{2,0x00E38}},
+   {{0,0x00000},{0,0x00000},{2,0x00E3A},{2,0x00E3A}},{{0,0x00000},{0,0x00000},{2,0x00E3C},{2,0x00E3C}},
+   {{0,0x00000},{0,0x00000},{3,0x00E3E},{3,0x00E3E}},{{0,0x00000},{0,0x00000},{3,0x00E41},{3,0x00E41}},
+   {{0,0x00000},{0,0x00000},{3,0x00E44},{3,0x00E44}},{{0,0x00000},{0,0x00000},{3,0x00E47},{3,0x00E47}},
+   {{0,0x00000},{0,0x00000},{3,0x00E4A},{3,0x00E4A}},{{0,0x00000},{0,0x00000},{3,0x00E4D},{3,0x00E4D}},
+   {{0,0x00000},{0,0x00000},{3,0x00E50},{3,0x00E50}},{{0,0x00000},{0,0x00000},{3,0x00E53},{3,0x00E53}},
+   {{0,0x00000},{0,0x00000},{3,0x00E56},{3,0x00E56}},{{0,0x00000},{0,0x00000},{3,0x00E59},{3,0x00E59}},
+   {{0,0x00000},{0,0x00000},{3,0x00E5C},{3,0x00E5C}},{{0,0x00000},{0,0x00000},{3,0x00E5F},{3,0x00E5F}},
+   {{0,0x00000},{0,0x00000},{3,0x00E62},{3,0x00E62}},{{0,0x00000},{0,0x00000},{3,0x00E65},{3,0x00E65}},
+   {{0,0x00000},{0,0x00000},{3,0x00E68},{3,0x00E68}},{{0,0x00000},{0,0x00000},{3,0x00E6B},{3,0x00E6E}},
+   {{0,0x00000},{0,0x00000},{2,0x00E71},{2,0x00E71}},{{0,0x00000},{0,0x00000},{2,0x00E73},{2,0x00E75}},
+   {{0,0x00000},{0,0x00000},{3,0x00E77},{3,0x00E77}},{{0,0x00000},{0,0x00000},{2,0x00E7A},{2,0x00E7C}},
+   {{0,0x00000},{0,0x00000},{2,0x00E7E},{2,0x00E7E}},{{0,0x00000},{0,0x00000},{2,0x00E80},{2,0x00E80}},
+   {{0,0x00000},{0,0x00000},{3,0x00E82},{3,0x00E82}},{{0,0x00000},{0,0x00000},{3,0x00E85},{3,0x00E85}},
+   {{0,0x00000},{0,0x00000},{2,0x00E88},{2,0x00E8A}},{{0,0x00000},{0,0x00000},{2,0x00E8C},{2,0x00E8C}},
+   {{0,0x00000},{0,0x00000},{2,0x00E8E},{2,0x00E8E}},{{0,0x00000},{0,0x00000},{2,0x00E90},{2,0x00E90}},
+   {{0,0x00000},{0,0x00000},{2,0x00E92},{2,0x00E92}},{{0,0x00000},{0,0x00000},{4,0x00E94},{4,0x00E94}}
+  },
+
+  /* block 103 */
+  {{{0,0x00000},{0,0x00000},{2,0x00E98},{2,0x00E9A}},{{0,0x00000},{0,0x00000},{2,0x00E9C},{2,0x00E9E}},
+   {{0,0x00000},{0,0x00000},{2,0x00EA0},{2,0x00EA2}},{{0,0x00000},{0,0x00000},{2,0x00EA4},{2,0x00EA6}},
+   {{0,0x00000},{0,0x00000},{2,0x00EA8},{2,0x00EAA}},{{0,0x00000},{0,0x00000},{2,0x00EAC},{2,0x00EAE}},
+   {{0,0x00000},{0,0x00000},{2,0x00EB0},{2,0x00EB2}},{{0,0x00000},{0,0x00000},{2,0x00EB4},{2,0x00EB6}},
+   {{0,0x00000},{0,0x00000},{3,0x00EB8},{3,0x00EB8}},{{0,0x00000},{0,0x00000},{4,0x00EBB},{4,0x00EBB}},
+   {{0,0x00000},{0,0x00000},{2,0x00EBF},{2,0x00EC1}},{{0,0x00000},{0,0x00000},{2,0x00EC3},{2,0x00EC5}},
+   {{0,0x00000},{0,0x00000},{2,0x00EC7},{2,0x00EC9}},{{0,0x00000},{0,0x00000},{2,0x00ECB},{2,0x00ECB}},
+   {{0,0x00000},{0,0x00000},{2,0x00ECD},{2,0x00ECD}},{{0,0x00000},{0,0x00000},{2,0x00ECF},{2,0x00ECF}},
+   {{0,0x00000},{0,0x00000},{2,0x00ED1},{2,0x00ED3}},{{0,0x00000},{0,0x00000},{3,0x00ED5},{3,0x00ED8}},
+   {{0,0x00000},{0,0x00000},{3,0x00EDB},{3,0x00EDE}},{{0,0x00000},{0,0x00000},{3,0x00EE1},{3,0x00EE4}},
+   {{0,0x00000},{0,0x00000},{3,0x00EE7},{3,0x00EEA}},{{0,0x00000},{0,0x00000},{2,0x00EED},{2,0x00EED}},
+   {{0,0x00000},{0,0x00000},{2,0x00EEF},{2,0x00EEF}},{{0,0x00000},{0,0x00000},{2,0x00EF1},{2,0x00EF1}},
+   {{0,0x00000},{0,0x00000},{2,0x00EF3},{2,0x00EF3}},{{0,0x00000},{0,0x00000},{2,0x00EF5},{2,0x00EF5}},
+   {{0,0x00000},{0,0x00000},{2,0x00EF7},{2,0x00EF7}},{{0,0x00000},{0,0x00000},{2,0x00EF9},{2,0x00EF9}},
+   {{0,0x00000},{0,0x00000},{2,0x00EFB},{2,0x00EFB}},{{0,0x00000},{0,0x00000},{2,0x00EFD},{2,0x00EFD}},
+   {{0,0x00000},{0,0x00000},{2,0x00EFF},{2,0x00EFF}},{{0,0x00000},{0,0x00000},{3,0x00F01},{3,0x00F01}},
+   {{0,0x00000},{0,0x00000},{3,0x00F04},{3,0x00F04}},{{0,0x00000},{0,0x00000},{2,0x00F07},{2,0x00F07}},
+   {{0,0x00000},{0,0x00000},{3,0x00F09},{3,0x00F09}},{{0,0x00000},{0,0x00000},{3,0x00F0C},{3,0x00F0C}},
+   {{0,0x00000},{0,0x00000},{3,0x00F0F},{3,0x00F0F}},{{0,0x00000},{0,0x00000},{2,0x00F12},{2,0x00F12}},
+   {{0,0x00000},{0,0x00000},{3,0x00F14},{3,0x00F14}},{{0,0x00000},{0,0x00000},{3,0x00F17},{3,0x00F17}},
+   {{0,0x00000},{0,0x00000},{4,0x00F1A},{4,0x00F1A}},{{0,0x00000},{0,0x00000},{2,0x00F1E},{2,0x00E9A}},
+   {{0,0x00000},{0,0x00000},{3,0x00F20},{3,0x00F23}},{{0,0x00000},{0,0x00000},{3,0x00F26},{3,0x00F29}},
+   {{0,0x00000},{0,0x00000},{3,0x00F2C},{3,0x00F2F}},{{0,0x00000},{0,0x00000},{3,0x00F32},{3,0x00F32}},
+   {{0,0x00000},{0,0x00000},{5,0x00F35},{5,0x00F35}},{{0,0x00000},{0,0x00000},{6,0x00F3A},{6,0x00F3A}},
+   {{0,0x00000},{0,0x00000},{2,0x00F40},{2,0x00F40}},{{0,0x00000},{0,0x00000},{2,0x00F42},{2,0x00F42}},
+   {{0,0x00000},{0,0x00000},{2,0x00F44},{2,0x00F44}},{{0,0x00000},{0,0x00000},{2,0x00F46},{2,0x00F46}},
+   {{0,0x00000},{0,0x00000},{2,0x00F48},{2,0x00F4A}},{{0,0x00000},{0,0x00000},{2,0x00F4C},{2,0x00F4E}},
+   {{0,0x00000},{0,0x00000},{2,0x00F50},{2,0x00F52}},{{0,0x00000},{0,0x00000},{2,0x00F54},{2,0x00F56}},
+   {{0,0x00000},{0,0x00000},{2,0x00F58},{2,0x00F5A}},{{0,0x00000},{0,0x00000},{2,0x00F5C},{2,0x00F56}},
+   {{0,0x00000},{0,0x00000},{2,0x00F5E},{2,0x00F60}},{{0,0x00000},{0,0x00000},{2,0x00F62},{2,0x00F64}},
+   {{0,0x00000},{0,0x00000},{2,0x00F66},{2,0x00F68}},{{0,0x00000},{0,0x00000},{2,0x00F6A},{2,0x00F6C}},
+   {{0,0x00000},{0,0x00000},{2,0x00F6E},{2,0x00F70}},{{0,0x00000},{0,0x00000},{2,0x00F72},{2,0x00F6C}}
+  },
+
+  /* block 104 */
+  {{{0,0x00000},{0,0x00000},{2,0x00F74},{2,0x00F76}},{{0,0x00000},{0,0x00000},{2,0x00F78},{2,0x00F7A}},
+   {{0,0x00000},{0,0x00000},{4,0x00F7C},{4,0x00F7C}},{{0,0x00000},{0,0x00000},{2,0x00F80},{2,0x00F82}},
+   {{0,0x00000},{0,0x00000},{2,0x00F84},{2,0x00F84}},{{0,0x00000},{0,0x00000},{2,0x00F86},{2,0x00F86}},
+   {{0,0x00000},{0,0x00000},{4,0x00F88},{4,0x00F8C}},{{0,0x00000},{0,0x00000},{3,0x00F90},{3,0x00F93}},
+   {{0,0x00000},{0,0x00000},{2,0x00F96},{2,0x00F98}},{{0,0x00000},{0,0x00000},{2,0x00F9A},{2,0x00F9C}},
+   {{0,0x00000},{0,0x00000},{2,0x00F9E},{2,0x00F9E}},{{0,0x00000},{0,0x00000},{2,0x00FA0},{2,0x00FA2}},
+   {{0,0x00000},{0,0x00000},{2,0x00FA4},{2,0x00FA4}},{{0,0x00000},{0,0x00000},{2,0x00FA6},{2,0x00FA8}},
+   {{0,0x00000},{0,0x00000},{2,0x00FAA},{2,0x00EFF}},{{0,0x00000},{0,0x00000},{2,0x00FAC},{2,0x00FAC}},
+   {{0,0x00000},{0,0x00000},{2,0x00FAE},{2,0x00FAE}},{{0,0x00000},{0,0x00000},{2,0x00FB0},{2,0x00FB0}},
+   {{0,0x00000},{0,0x00000},{3,0x00FB2},{3,0x00FB2}},{{0,0x00000},{0,0x00000},{2,0x00FB5},{2,0x00FB5}},
+   {{0,0x00000},{0,0x00000},{2,0x00EB2},{2,0x00EB2}},{{0,0x00000},{0,0x00000},{3,0x00FB7},{3,0x00FB7}},
+   {{0,0x00000},{0,0x00000},{3,0x00FBA},{3,0x00FBA}},{{0,0x00000},{0,0x00000},{2,0x00FBD},{2,0x00FBF}},
+   {{0,0x00000},{0,0x00000},{4,0x00FC1},{4,0x00FC1}},{{0,0x00000},{0,0x00000},{3,0x00FC5},{3,0x00FC8}},
+   {{0,0x00000},{0,0x00000},{2,0x00FCB},{2,0x00FCD}},{{0,0x00000},{0,0x00000},{2,0x00FCF},{2,0x00FCF}},
+   {{0,0x00000},{0,0x00000},{2,0x00FD1},{2,0x00FD3}},{{0,0x00000},{0,0x00000},{2,0x00FD5},{2,0x00FD7}},
+   {{0,0x00000},{0,0x00000},{3,0x00FD9},{3,0x00FDC}},{{0,0x00000},{0,0x00000},{3,0x00FDF},{3,0x00FE2}},
+   {{0,0x00000},{0,0x00000},{2,0x00FE5},{2,0x00FE5}},{{0,0x00000},{0,0x00000},{2,0x00FE7},{2,0x00FE7}},
+   {{0,0x00000},{0,0x00000},{2,0x00FE9},{2,0x00FE9}},{{0,0x00000},{0,0x00000},{2,0x00FEB},{2,0x00FEB}},
+   {{0,0x00000},{0,0x00000},{2,0x00FED},{2,0x00FED}},{{0,0x00000},{0,0x00000},{2,0x00FEF},{2,0x00FEF}},
+   {{0,0x00000},{0,0x00000},{2,0x00FF1},{2,0x00FF1}},{{0,0x00000},{0,0x00000},{2,0x00FF3},{2,0x00FF3}},
+   {{0,0x00000},{0,0x00000},{2,0x00FF5},{2,0x00FF5}},{{0,0x00000},{0,0x00000},{3,0x00FF7},{3,0x00FF7}},
+   {{0,0x00000},{0,0x00000},{3,0x00FFA},{3,0x00FFA}},{{0,0x00000},{0,0x00000},{3,0x00FFD},{3,0x00FFD}},
+   {{0,0x00000},{0,0x00000},{3,0x01000},{3,0x01000}},{{0,0x00000},{0,0x00000},{3,0x01003},{3,0x01003}},
+   {{0,0x00000},{0,0x00000},{3,0x01006},{3,0x01006}},{{0,0x00000},{0,0x00000},{3,0x01009},{3,0x01009}},
+   {{0,0x00000},{0,0x00000},{3,0x0100C},{3,0x0100C}},{{0,0x00000},{0,0x00000},{3,0x0100F},{3,0x0100F}},
+   {{0,0x00000},{0,0x00000},{3,0x01012},{3,0x01012}},{{0,0x00000},{0,0x00000},{3,0x01015},{3,0x01015}},
+   {{0,0x00000},{0,0x00000},{3,0x01018},{3,0x01018}},{{0,0x00000},{0,0x00000},{3,0x0101B},{3,0x0101B}},
+   {{0,0x00000},{0,0x00000},{3,0x0101E},{3,0x0101E}},{{0,0x00000},{0,0x00000},{3,0x01021},{3,0x01021}},
+   {{0,0x00000},{0,0x00000},{3,0x01024},{3,0x01024}},{{0,0x00000},{0,0x00000},{3,0x01027},{3,0x01027}},
+   {{0,0x00000},{0,0x00000},{3,0x0102A},{3,0x0102A}},{{0,0x00000},{0,0x00000},{3,0x0102D},{3,0x0102D}},
+   {{0,0x00000},{0,0x00000},{3,0x01030},{3,0x01030}},{{0,0x00000},{0,0x00000},{3,0x01033},{3,0x01033}},
+   {{0,0x00000},{0,0x00000},{3,0x01036},{3,0x01036}},{{0,0x00000},{0,0x00000},{3,0x01039},{3,0x01039}}
+  },
+
+  /* block 105 */
+  {{{0,0x00000},{1,0x0A641},{0,0x00000},{1,0x0A641}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A643},{0,0x00000},{1,0x0A643}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A645},{0,0x00000},{1,0x0A645}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A647},{0,0x00000},{1,0x0A647}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A649},{0,0x00000},{1,0x0A649}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A64B},{0,0x00000},{1,0x0A64B}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A64D},{0,0x00000},{1,0x0A64D}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A64F},{0,0x00000},{1,0x0A64F}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A651},{0,0x00000},{1,0x0A651}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A653},{0,0x00000},{1,0x0A653}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A655},{0,0x00000},{1,0x0A655}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A657},{0,0x00000},{1,0x0A657}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A659},{0,0x00000},{1,0x0A659}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A65B},{0,0x00000},{1,0x0A65B}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A65D},{0,0x00000},{1,0x0A65D}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A65F},{0,0x00000},{1,0x0A65F}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A661},{0,0x00000},{1,0x0A661}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A663},{0,0x00000},{1,0x0A663}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A665},{0,0x00000},{1,0x0A665}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A667},{0,0x00000},{1,0x0A667}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A669},{0,0x00000},{1,0x0A669}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A66B},{0,0x00000},{1,0x0A66B}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A66D},{0,0x00000},{1,0x0A66D}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 106 */
+  {{{0,0x00000},{1,0x0A681},{0,0x00000},{1,0x0A681}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A683},{0,0x00000},{1,0x0A683}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A685},{0,0x00000},{1,0x0A685}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A687},{0,0x00000},{1,0x0A687}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A689},{0,0x00000},{1,0x0A689}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A68B},{0,0x00000},{1,0x0A68B}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A68D},{0,0x00000},{1,0x0A68D}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A68F},{0,0x00000},{1,0x0A68F}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A691},{0,0x00000},{1,0x0A691}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A693},{0,0x00000},{1,0x0A693}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A695},{0,0x00000},{1,0x0A695}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A697},{0,0x00000},{1,0x0A697}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A699},{0,0x00000},{1,0x0A699}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A69B},{0,0x00000},{1,0x0A69B}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x0044A},{1,0x0044A}},{{0,0x00000},{0,0x00000},{1,0x0044C},{1,0x0044C}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 107 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A723},{0,0x00000},{1,0x0A723}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A725},{0,0x00000},{1,0x0A725}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A727},{0,0x00000},{1,0x0A727}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A729},{0,0x00000},{1,0x0A729}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A72B},{0,0x00000},{1,0x0A72B}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A72D},{0,0x00000},{1,0x0A72D}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A72F},{0,0x00000},{1,0x0A72F}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A733},{0,0x00000},{1,0x0A733}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A735},{0,0x00000},{1,0x0A735}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A737},{0,0x00000},{1,0x0A737}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A739},{0,0x00000},{1,0x0A739}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A73B},{0,0x00000},{1,0x0A73B}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A73D},{0,0x00000},{1,0x0A73D}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A73F},{0,0x00000},{1,0x0A73F}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 108 */
+  {{{0,0x00000},{1,0x0A741},{0,0x00000},{1,0x0A741}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A743},{0,0x00000},{1,0x0A743}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A745},{0,0x00000},{1,0x0A745}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A747},{0,0x00000},{1,0x0A747}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A749},{0,0x00000},{1,0x0A749}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A74B},{0,0x00000},{1,0x0A74B}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A74D},{0,0x00000},{1,0x0A74D}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A74F},{0,0x00000},{1,0x0A74F}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A751},{0,0x00000},{1,0x0A751}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A753},{0,0x00000},{1,0x0A753}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A755},{0,0x00000},{1,0x0A755}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A757},{0,0x00000},{1,0x0A757}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A759},{0,0x00000},{1,0x0A759}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A75B},{0,0x00000},{1,0x0A75B}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A75D},{0,0x00000},{1,0x0A75D}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A75F},{0,0x00000},{1,0x0A75F}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A761},{0,0x00000},{1,0x0A761}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A763},{0,0x00000},{1,0x0A763}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A765},{0,0x00000},{1,0x0A765}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A767},{0,0x00000},{1,0x0A767}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A769},{0,0x00000},{1,0x0A769}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A76B},{0,0x00000},{1,0x0A76B}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A76D},{0,0x00000},{1,0x0A76D}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A76F},{0,0x00000},{1,0x0A76F}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x0A76F},{1,0x0A76F}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x0A77A},{0,0x00000},{1,0x0A77A}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x0A77C},{0,0x00000},{1,0x0A77C}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x01D79},{0,0x00000},{1,0x01D79}},
+   {{0,0x00000},{1,0x0A77F},{0,0x00000},{1,0x0A77F}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 109 */
+  {{{0,0x00000},{1,0x0A781},{0,0x00000},{1,0x0A781}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A783},{0,0x00000},{1,0x0A783}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A785},{0,0x00000},{1,0x0A785}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A787},{0,0x00000},{1,0x0A787}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x0A78C},{0,0x00000},{1,0x0A78C}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x00265},{0,0x00000},{1,0x00265}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A791},{0,0x00000},{1,0x0A791}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A793},{0,0x00000},{1,0x0A793}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A797},{0,0x00000},{1,0x0A797}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A799},{0,0x00000},{1,0x0A799}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A79B},{0,0x00000},{1,0x0A79B}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A79D},{0,0x00000},{1,0x0A79D}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A79F},{0,0x00000},{1,0x0A79F}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A7A1},{0,0x00000},{1,0x0A7A1}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A7A3},{0,0x00000},{1,0x0A7A3}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A7A5},{0,0x00000},{1,0x0A7A5}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A7A7},{0,0x00000},{1,0x0A7A7}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A7A9},{0,0x00000},{1,0x0A7A9}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x00266},{0,0x00000},{1,0x00266}},{{0,0x00000},{1,0x0025C},{0,0x00000},{1,0x0025C}},
+   {{0,0x00000},{1,0x00261},{0,0x00000},{1,0x00261}},{{0,0x00000},{1,0x0026C},{0,0x00000},{1,0x0026C}},
+   {{0,0x00000},{1,0x0026A},{0,0x00000},{1,0x0026A}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0029E},{0,0x00000},{1,0x0029E}},{{0,0x00000},{1,0x00287},{0,0x00000},{1,0x00287}},
+   {{0,0x00000},{1,0x0029D},{0,0x00000},{1,0x0029D}},{{0,0x00000},{1,0x0AB53},{0,0x00000},{1,0x0AB53}},
+   {{0,0x00000},{1,0x0A7B5},{0,0x00000},{1,0x0A7B5}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A7B7},{0,0x00000},{1,0x0A7B7}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A7B9},{0,0x00000},{1,0x0A7B9}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A7BB},{0,0x00000},{1,0x0A7BB}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A7BD},{0,0x00000},{1,0x0A7BD}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A7BF},{0,0x00000},{1,0x0A7BF}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 110 */
+  {{{0,0x00000},{1,0x0A7C1},{0,0x00000},{1,0x0A7C1}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A7C3},{0,0x00000},{1,0x0A7C3}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A794},{0,0x00000},{1,0x0A794}},{{0,0x00000},{1,0x00282},{0,0x00000},{1,0x00282}},
+   {{0,0x00000},{1,0x01D8E},{0,0x00000},{1,0x01D8E}},{{0,0x00000},{1,0x0A7C8},{0,0x00000},{1,0x0A7C8}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{1,0x0A7CA},{0,0x00000},{1,0x0A7CA}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A7D1},{0,0x00000},{1,0x0A7D1}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A7D7},{0,0x00000},{1,0x0A7D7}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x0A7D9},{0,0x00000},{1,0x0A7D9}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x00043},{1,0x00063}},{{0,0x00000},{0,0x00000},{1,0x00046},{1,0x00066}},
+   {{0,0x00000},{0,0x00000},{1,0x00051},{1,0x00071}},{{0,0x00000},{1,0x0A7F6},{0,0x00000},{1,0x0A7F6}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x00126},{1,0x00127}},{{0,0x00000},{0,0x00000},{1,0x00153},{1,0x00153}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 111 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x0A727},{1,0x0A727}},{{0,0x00000},{0,0x00000},{1,0x0AB37},{1,0x0AB37}},
+   {{0,0x00000},{0,0x00000},{1,0x0026B},{1,0x0026B}},{{0,0x00000},{0,0x00000},{1,0x0AB52},{1,0x0AB52}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x0028D},{1,0x0028D}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x013A0},{0,0x00000},{1,0x013A0}},{{0,0x00000},{1,0x013A1},{0,0x00000},{1,0x013A1}},
+   {{0,0x00000},{1,0x013A2},{0,0x00000},{1,0x013A2}},{{0,0x00000},{1,0x013A3},{0,0x00000},{1,0x013A3}},
+   {{0,0x00000},{1,0x013A4},{0,0x00000},{1,0x013A4}},{{0,0x00000},{1,0x013A5},{0,0x00000},{1,0x013A5}},
+   {{0,0x00000},{1,0x013A6},{0,0x00000},{1,0x013A6}},{{0,0x00000},{1,0x013A7},{0,0x00000},{1,0x013A7}},
+   {{0,0x00000},{1,0x013A8},{0,0x00000},{1,0x013A8}},{{0,0x00000},{1,0x013A9},{0,0x00000},{1,0x013A9}},
+   {{0,0x00000},{1,0x013AA},{0,0x00000},{1,0x013AA}},{{0,0x00000},{1,0x013AB},{0,0x00000},{1,0x013AB}},
+   {{0,0x00000},{1,0x013AC},{0,0x00000},{1,0x013AC}},{{0,0x00000},{1,0x013AD},{0,0x00000},{1,0x013AD}},
+   {{0,0x00000},{1,0x013AE},{0,0x00000},{1,0x013AE}},{{0,0x00000},{1,0x013AF},{0,0x00000},{1,0x013AF}}
+  },
+
+  /* block 112 */
+  {{{0,0x00000},{1,0x013B0},{0,0x00000},{1,0x013B0}},{{0,0x00000},{1,0x013B1},{0,0x00000},{1,0x013B1}},
+   {{0,0x00000},{1,0x013B2},{0,0x00000},{1,0x013B2}},{{0,0x00000},{1,0x013B3},{0,0x00000},{1,0x013B3}},
+   {{0,0x00000},{1,0x013B4},{0,0x00000},{1,0x013B4}},{{0,0x00000},{1,0x013B5},{0,0x00000},{1,0x013B5}},
+   {{0,0x00000},{1,0x013B6},{0,0x00000},{1,0x013B6}},{{0,0x00000},{1,0x013B7},{0,0x00000},{1,0x013B7}},
+   {{0,0x00000},{1,0x013B8},{0,0x00000},{1,0x013B8}},{{0,0x00000},{1,0x013B9},{0,0x00000},{1,0x013B9}},
+   {{0,0x00000},{1,0x013BA},{0,0x00000},{1,0x013BA}},{{0,0x00000},{1,0x013BB},{0,0x00000},{1,0x013BB}},
+   {{0,0x00000},{1,0x013BC},{0,0x00000},{1,0x013BC}},{{0,0x00000},{1,0x013BD},{0,0x00000},{1,0x013BD}},
+   {{0,0x00000},{1,0x013BE},{0,0x00000},{1,0x013BE}},{{0,0x00000},{1,0x013BF},{0,0x00000},{1,0x013BF}},
+   {{0,0x00000},{1,0x013C0},{0,0x00000},{1,0x013C0}},{{0,0x00000},{1,0x013C1},{0,0x00000},{1,0x013C1}},
+   {{0,0x00000},{1,0x013C2},{0,0x00000},{1,0x013C2}},{{0,0x00000},{1,0x013C3},{0,0x00000},{1,0x013C3}},
+   {{0,0x00000},{1,0x013C4},{0,0x00000},{1,0x013C4}},{{0,0x00000},{1,0x013C5},{0,0x00000},{1,0x013C5}},
+   {{0,0x00000},{1,0x013C6},{0,0x00000},{1,0x013C6}},{{0,0x00000},{1,0x013C7},{0,0x00000},{1,0x013C7}},
+   {{0,0x00000},{1,0x013C8},{0,0x00000},{1,0x013C8}},{{0,0x00000},{1,0x013C9},{0,0x00000},{1,0x013C9}},
+   {{0,0x00000},{1,0x013CA},{0,0x00000},{1,0x013CA}},{{0,0x00000},{1,0x013CB},{0,0x00000},{1,0x013CB}},
+   {{0,0x00000},{1,0x013CC},{0,0x00000},{1,0x013CC}},{{0,0x00000},{1,0x013CD},{0,0x00000},{1,0x013CD}},
+   {{0,0x00000},{1,0x013CE},{0,0x00000},{1,0x013CE}},{{0,0x00000},{1,0x013CF},{0,0x00000},{1,0x013CF}},
+   {{0,0x00000},{1,0x013D0},{0,0x00000},{1,0x013D0}},{{0,0x00000},{1,0x013D1},{0,0x00000},{1,0x013D1}},
+   {{0,0x00000},{1,0x013D2},{0,0x00000},{1,0x013D2}},{{0,0x00000},{1,0x013D3},{0,0x00000},{1,0x013D3}},
+   {{0,0x00000},{1,0x013D4},{0,0x00000},{1,0x013D4}},{{0,0x00000},{1,0x013D5},{0,0x00000},{1,0x013D5}},
+   {{0,0x00000},{1,0x013D6},{0,0x00000},{1,0x013D6}},{{0,0x00000},{1,0x013D7},{0,0x00000},{1,0x013D7}},
+   {{0,0x00000},{1,0x013D8},{0,0x00000},{1,0x013D8}},{{0,0x00000},{1,0x013D9},{0,0x00000},{1,0x013D9}},
+   {{0,0x00000},{1,0x013DA},{0,0x00000},{1,0x013DA}},{{0,0x00000},{1,0x013DB},{0,0x00000},{1,0x013DB}},
+   {{0,0x00000},{1,0x013DC},{0,0x00000},{1,0x013DC}},{{0,0x00000},{1,0x013DD},{0,0x00000},{1,0x013DD}},
+   {{0,0x00000},{1,0x013DE},{0,0x00000},{1,0x013DE}},{{0,0x00000},{1,0x013DF},{0,0x00000},{1,0x013DF}},
+   {{0,0x00000},{1,0x013E0},{0,0x00000},{1,0x013E0}},{{0,0x00000},{1,0x013E1},{0,0x00000},{1,0x013E1}},
+   {{0,0x00000},{1,0x013E2},{0,0x00000},{1,0x013E2}},{{0,0x00000},{1,0x013E3},{0,0x00000},{1,0x013E3}},
+   {{0,0x00000},{1,0x013E4},{0,0x00000},{1,0x013E4}},{{0,0x00000},{1,0x013E5},{0,0x00000},{1,0x013E5}},
+   {{0,0x00000},{1,0x013E6},{0,0x00000},{1,0x013E6}},{{0,0x00000},{1,0x013E7},{0,0x00000},{1,0x013E7}},
+   {{0,0x00000},{1,0x013E8},{0,0x00000},{1,0x013E8}},{{0,0x00000},{1,0x013E9},{0,0x00000},{1,0x013E9}},
+   {{0,0x00000},{1,0x013EA},{0,0x00000},{1,0x013EA}},{{0,0x00000},{1,0x013EB},{0,0x00000},{1,0x013EB}},
+   {{0,0x00000},{1,0x013EC},{0,0x00000},{1,0x013EC}},{{0,0x00000},{1,0x013ED},{0,0x00000},{1,0x013ED}},
+   {{0,0x00000},{1,0x013EE},{0,0x00000},{1,0x013EE}},{{0,0x00000},{1,0x013EF},{0,0x00000},{1,0x013EF}}
+  },
+
+  /* block 113 */
+  {{{1,0x08C48},{1,0x08C48},{1,0x08C48},{1,0x08C48}},{{1,0x066F4},{1,0x066F4},{1,0x066F4},{1,0x066F4}},
+   {{1,0x08ECA},{1,0x08ECA},{1,0x08ECA},{1,0x08ECA}},{{1,0x08CC8},{1,0x08CC8},{1,0x08CC8},{1,0x08CC8}},
+   {{1,0x06ED1},{1,0x06ED1},{1,0x06ED1},{1,0x06ED1}},{{1,0x04E32},{1,0x04E32},{1,0x04E32},{1,0x04E32}},
+   {{1,0x053E5},{1,0x053E5},{1,0x053E5},{1,0x053E5}},{{1,0x09F9C},{1,0x09F9C},{1,0x09F9C},{1,0x09F9C}},
+   {{1,0x09F9C},{1,0x09F9C},{1,0x09F9C},{1,0x09F9C}},{{1,0x05951},{1,0x05951},{1,0x05951},{1,0x05951}},
+   {{1,0x091D1},{1,0x091D1},{1,0x091D1},{1,0x091D1}},{{1,0x05587},{1,0x05587},{1,0x05587},{1,0x05587}},
+   {{1,0x05948},{1,0x05948},{1,0x05948},{1,0x05948}},{{1,0x061F6},{1,0x061F6},{1,0x061F6},{1,0x061F6}},
+   {{1,0x07669},{1,0x07669},{1,0x07669},{1,0x07669}},{{1,0x07F85},{1,0x07F85},{1,0x07F85},{1,0x07F85}},
+   {{1,0x0863F},{1,0x0863F},{1,0x0863F},{1,0x0863F}},{{1,0x087BA},{1,0x087BA},{1,0x087BA},{1,0x087BA}},
+   {{1,0x088F8},{1,0x088F8},{1,0x088F8},{1,0x088F8}},{{1,0x0908F},{1,0x0908F},{1,0x0908F},{1,0x0908F}},
+   {{1,0x06A02},{1,0x06A02},{1,0x06A02},{1,0x06A02}},{{1,0x06D1B},{1,0x06D1B},{1,0x06D1B},{1,0x06D1B}},
+   {{1,0x070D9},{1,0x070D9},{1,0x070D9},{1,0x070D9}},{{1,0x073DE},{1,0x073DE},{1,0x073DE},{1,0x073DE}},
+   {{1,0x0843D},{1,0x0843D},{1,0x0843D},{1,0x0843D}},{{1,0x0916A},{1,0x0916A},{1,0x0916A},{1,0x0916A}},
+   {{1,0x099F1},{1,0x099F1},{1,0x099F1},{1,0x099F1}},{{1,0x04E82},{1,0x04E82},{1,0x04E82},{1,0x04E82}},
+   {{1,0x05375},{1,0x05375},{1,0x05375},{1,0x05375}},{{1,0x06B04},{1,0x06B04},{1,0x06B04},{1,0x06B04}},
+   {{1,0x0721B},{1,0x0721B},{1,0x0721B},{1,0x0721B}},{{1,0x0862D},{1,0x0862D},{1,0x0862D},{1,0x0862D}},
+   {{1,0x09E1E},{1,0x09E1E},{1,0x09E1E},{1,0x09E1E}},{{1,0x05D50},{1,0x05D50},{1,0x05D50},{1,0x05D50}},
+   {{1,0x06FEB},{1,0x06FEB},{1,0x06FEB},{1,0x06FEB}},{{1,0x085CD},{1,0x085CD},{1,0x085CD},{1,0x085CD}},
+   {{1,0x08964},{1,0x08964},{1,0x08964},{1,0x08964}},{{1,0x062C9},{1,0x062C9},{1,0x062C9},{1,0x062C9}},
+   {{1,0x081D8},{1,0x081D8},{1,0x081D8},{1,0x081D8}},{{1,0x0881F},{1,0x0881F},{1,0x0881F},{1,0x0881F}},
+   {{1,0x05ECA},{1,0x05ECA},{1,0x05ECA},{1,0x05ECA}},{{1,0x06717},{1,0x06717},{1,0x06717},{1,0x06717}},
+   {{1,0x06D6A},{1,0x06D6A},{1,0x06D6A},{1,0x06D6A}},{{1,0x072FC},{1,0x072FC},{1,0x072FC},{1,0x072FC}},
+   {{1,0x090CE},{1,0x090CE},{1,0x090CE},{1,0x090CE}},{{1,0x04F86},{1,0x04F86},{1,0x04F86},{1,0x04F86}},
+   {{1,0x051B7},{1,0x051B7},{1,0x051B7},{1,0x051B7}},{{1,0x052DE},{1,0x052DE},{1,0x052DE},{1,0x052DE}},
+   {{1,0x064C4},{1,0x064C4},{1,0x064C4},{1,0x064C4}},{{1,0x06AD3},{1,0x06AD3},{1,0x06AD3},{1,0x06AD3}},
+   {{1,0x07210},{1,0x07210},{1,0x07210},{1,0x07210}},{{1,0x076E7},{1,0x076E7},{1,0x076E7},{1,0x076E7}},
+   {{1,0x08001},{1,0x08001},{1,0x08001},{1,0x08001}},{{1,0x08606},{1,0x08606},{1,0x08606},{1,0x08606}},
+   {{1,0x0865C},{1,0x0865C},{1,0x0865C},{1,0x0865C}},{{1,0x08DEF},{1,0x08DEF},{1,0x08DEF},{1,0x08DEF}},
+   {{1,0x09732},{1,0x09732},{1,0x09732},{1,0x09732}},{{1,0x09B6F},{1,0x09B6F},{1,0x09B6F},{1,0x09B6F}},
+   {{1,0x09DFA},{1,0x09DFA},{1,0x09DFA},{1,0x09DFA}},{{1,0x0788C},{1,0x0788C},{1,0x0788C},{1,0x0788C}},
+   {{1,0x0797F},{1,0x0797F},{1,0x0797F},{1,0x0797F}},{{1,0x07DA0},{1,0x07DA0},{1,0x07DA0},{1,0x07DA0}},
+   {{1,0x083C9},{1,0x083C9},{1,0x083C9},{1,0x083C9}},{{1,0x09304},{1,0x09304},{1,0x09304},{1,0x09304}}
+  },
+
+  /* block 114 */
+  {{{1,0x09E7F},{1,0x09E7F},{1,0x09E7F},{1,0x09E7F}},{{1,0x08AD6},{1,0x08AD6},{1,0x08AD6},{1,0x08AD6}},
+   {{1,0x058DF},{1,0x058DF},{1,0x058DF},{1,0x058DF}},{{1,0x05F04},{1,0x05F04},{1,0x05F04},{1,0x05F04}},
+   {{1,0x07C60},{1,0x07C60},{1,0x07C60},{1,0x07C60}},{{1,0x0807E},{1,0x0807E},{1,0x0807E},{1,0x0807E}},
+   {{1,0x07262},{1,0x07262},{1,0x07262},{1,0x07262}},{{1,0x078CA},{1,0x078CA},{1,0x078CA},{1,0x078CA}},
+   {{1,0x08CC2},{1,0x08CC2},{1,0x08CC2},{1,0x08CC2}},{{1,0x096F7},{1,0x096F7},{1,0x096F7},{1,0x096F7}},
+   {{1,0x058D8},{1,0x058D8},{1,0x058D8},{1,0x058D8}},{{1,0x05C62},{1,0x05C62},{1,0x05C62},{1,0x05C62}},
+   {{1,0x06A13},{1,0x06A13},{1,0x06A13},{1,0x06A13}},{{1,0x06DDA},{1,0x06DDA},{1,0x06DDA},{1,0x06DDA}},
+   {{1,0x06F0F},{1,0x06F0F},{1,0x06F0F},{1,0x06F0F}},{{1,0x07D2F},{1,0x07D2F},{1,0x07D2F},{1,0x07D2F}},
+   {{1,0x07E37},{1,0x07E37},{1,0x07E37},{1,0x07E37}},{{1,0x0964B},{1,0x0964B},{1,0x0964B},{1,0x0964B}},
+   {{1,0x052D2},{1,0x052D2},{1,0x052D2},{1,0x052D2}},{{1,0x0808B},{1,0x0808B},{1,0x0808B},{1,0x0808B}},
+   {{1,0x051DC},{1,0x051DC},{1,0x051DC},{1,0x051DC}},{{1,0x051CC},{1,0x051CC},{1,0x051CC},{1,0x051CC}},
+   {{1,0x07A1C},{1,0x07A1C},{1,0x07A1C},{1,0x07A1C}},{{1,0x07DBE},{1,0x07DBE},{1,0x07DBE},{1,0x07DBE}},
+   {{1,0x083F1},{1,0x083F1},{1,0x083F1},{1,0x083F1}},{{1,0x09675},{1,0x09675},{1,0x09675},{1,0x09675}},
+   {{1,0x08B80},{1,0x08B80},{1,0x08B80},{1,0x08B80}},{{1,0x062CF},{1,0x062CF},{1,0x062CF},{1,0x062CF}},
+   {{1,0x06A02},{1,0x06A02},{1,0x06A02},{1,0x06A02}},{{1,0x08AFE},{1,0x08AFE},{1,0x08AFE},{1,0x08AFE}},
+   {{1,0x04E39},{1,0x04E39},{1,0x04E39},{1,0x04E39}},{{1,0x05BE7},{1,0x05BE7},{1,0x05BE7},{1,0x05BE7}},
+   {{1,0x06012},{1,0x06012},{1,0x06012},{1,0x06012}},{{1,0x07387},{1,0x07387},{1,0x07387},{1,0x07387}},
+   {{1,0x07570},{1,0x07570},{1,0x07570},{1,0x07570}},{{1,0x05317},{1,0x05317},{1,0x05317},{1,0x05317}},
+   {{1,0x078FB},{1,0x078FB},{1,0x078FB},{1,0x078FB}},{{1,0x04FBF},{1,0x04FBF},{1,0x04FBF},{1,0x04FBF}},
+   {{1,0x05FA9},{1,0x05FA9},{1,0x05FA9},{1,0x05FA9}},{{1,0x04E0D},{1,0x04E0D},{1,0x04E0D},{1,0x04E0D}},
+   {{1,0x06CCC},{1,0x06CCC},{1,0x06CCC},{1,0x06CCC}},{{1,0x06578},{1,0x06578},{1,0x06578},{1,0x06578}},
+   {{1,0x07D22},{1,0x07D22},{1,0x07D22},{1,0x07D22}},{{1,0x053C3},{1,0x053C3},{1,0x053C3},{1,0x053C3}},
+   {{1,0x0585E},{1,0x0585E},{1,0x0585E},{1,0x0585E}},{{1,0x07701},{1,0x07701},{1,0x07701},{1,0x07701}},
+   {{1,0x08449},{1,0x08449},{1,0x08449},{1,0x08449}},{{1,0x08AAA},{1,0x08AAA},{1,0x08AAA},{1,0x08AAA}},
+   {{1,0x06BBA},{1,0x06BBA},{1,0x06BBA},{1,0x06BBA}},{{1,0x08FB0},{1,0x08FB0},{1,0x08FB0},{1,0x08FB0}},
+   {{1,0x06C88},{1,0x06C88},{1,0x06C88},{1,0x06C88}},{{1,0x062FE},{1,0x062FE},{1,0x062FE},{1,0x062FE}},
+   {{1,0x082E5},{1,0x082E5},{1,0x082E5},{1,0x082E5}},{{1,0x063A0},{1,0x063A0},{1,0x063A0},{1,0x063A0}},
+   {{1,0x07565},{1,0x07565},{1,0x07565},{1,0x07565}},{{1,0x04EAE},{1,0x04EAE},{1,0x04EAE},{1,0x04EAE}},
+   {{1,0x05169},{1,0x05169},{1,0x05169},{1,0x05169}},{{1,0x051C9},{1,0x051C9},{1,0x051C9},{1,0x051C9}},
+   {{1,0x06881},{1,0x06881},{1,0x06881},{1,0x06881}},{{1,0x07CE7},{1,0x07CE7},{1,0x07CE7},{1,0x07CE7}},
+   {{1,0x0826F},{1,0x0826F},{1,0x0826F},{1,0x0826F}},{{1,0x08AD2},{1,0x08AD2},{1,0x08AD2},{1,0x08AD2}},
+   {{1,0x091CF},{1,0x091CF},{1,0x091CF},{1,0x091CF}},{{1,0x052F5},{1,0x052F5},{1,0x052F5},{1,0x052F5}}
+  },
+
+  /* block 115 */
+  {{{1,0x05442},{1,0x05442},{1,0x05442},{1,0x05442}},{{1,0x05973},{1,0x05973},{1,0x05973},{1,0x05973}},
+   {{1,0x05EEC},{1,0x05EEC},{1,0x05EEC},{1,0x05EEC}},{{1,0x065C5},{1,0x065C5},{1,0x065C5},{1,0x065C5}},
+   {{1,0x06FFE},{1,0x06FFE},{1,0x06FFE},{1,0x06FFE}},{{1,0x0792A},{1,0x0792A},{1,0x0792A},{1,0x0792A}},
+   {{1,0x095AD},{1,0x095AD},{1,0x095AD},{1,0x095AD}},{{1,0x09A6A},{1,0x09A6A},{1,0x09A6A},{1,0x09A6A}},
+   {{1,0x09E97},{1,0x09E97},{1,0x09E97},{1,0x09E97}},{{1,0x09ECE},{1,0x09ECE},{1,0x09ECE},{1,0x09ECE}},
+   {{1,0x0529B},{1,0x0529B},{1,0x0529B},{1,0x0529B}},{{1,0x066C6},{1,0x066C6},{1,0x066C6},{1,0x066C6}},
+   {{1,0x06B77},{1,0x06B77},{1,0x06B77},{1,0x06B77}},{{1,0x08F62},{1,0x08F62},{1,0x08F62},{1,0x08F62}},
+   {{1,0x05E74},{1,0x05E74},{1,0x05E74},{1,0x05E74}},{{1,0x06190},{1,0x06190},{1,0x06190},{1,0x06190}},
+   {{1,0x06200},{1,0x06200},{1,0x06200},{1,0x06200}},{{1,0x0649A},{1,0x0649A},{1,0x0649A},{1,0x0649A}},
+   {{1,0x06F23},{1,0x06F23},{1,0x06F23},{1,0x06F23}},{{1,0x07149},{1,0x07149},{1,0x07149},{1,0x07149}},
+   {{1,0x07489},{1,0x07489},{1,0x07489},{1,0x07489}},{{1,0x079CA},{1,0x079CA},{1,0x079CA},{1,0x079CA}},
+   {{1,0x07DF4},{1,0x07DF4},{1,0x07DF4},{1,0x07DF4}},{{1,0x0806F},{1,0x0806F},{1,0x0806F},{1,0x0806F}},
+   {{1,0x08F26},{1,0x08F26},{1,0x08F26},{1,0x08F26}},{{1,0x084EE},{1,0x084EE},{1,0x084EE},{1,0x084EE}},
+   {{1,0x09023},{1,0x09023},{1,0x09023},{1,0x09023}},{{1,0x0934A},{1,0x0934A},{1,0x0934A},{1,0x0934A}},
+   {{1,0x05217},{1,0x05217},{1,0x05217},{1,0x05217}},{{1,0x052A3},{1,0x052A3},{1,0x052A3},{1,0x052A3}},
+   {{1,0x054BD},{1,0x054BD},{1,0x054BD},{1,0x054BD}},{{1,0x070C8},{1,0x070C8},{1,0x070C8},{1,0x070C8}},
+   {{1,0x088C2},{1,0x088C2},{1,0x088C2},{1,0x088C2}},{{1,0x08AAA},{1,0x08AAA},{1,0x08AAA},{1,0x08AAA}},
+   {{1,0x05EC9},{1,0x05EC9},{1,0x05EC9},{1,0x05EC9}},{{1,0x05FF5},{1,0x05FF5},{1,0x05FF5},{1,0x05FF5}},
+   {{1,0x0637B},{1,0x0637B},{1,0x0637B},{1,0x0637B}},{{1,0x06BAE},{1,0x06BAE},{1,0x06BAE},{1,0x06BAE}},
+   {{1,0x07C3E},{1,0x07C3E},{1,0x07C3E},{1,0x07C3E}},{{1,0x07375},{1,0x07375},{1,0x07375},{1,0x07375}},
+   {{1,0x04EE4},{1,0x04EE4},{1,0x04EE4},{1,0x04EE4}},{{1,0x056F9},{1,0x056F9},{1,0x056F9},{1,0x056F9}},
+   {{1,0x05BE7},{1,0x05BE7},{1,0x05BE7},{1,0x05BE7}},{{1,0x05DBA},{1,0x05DBA},{1,0x05DBA},{1,0x05DBA}},
+   {{1,0x0601C},{1,0x0601C},{1,0x0601C},{1,0x0601C}},{{1,0x073B2},{1,0x073B2},{1,0x073B2},{1,0x073B2}},
+   {{1,0x07469},{1,0x07469},{1,0x07469},{1,0x07469}},{{1,0x07F9A},{1,0x07F9A},{1,0x07F9A},{1,0x07F9A}},
+   {{1,0x08046},{1,0x08046},{1,0x08046},{1,0x08046}},{{1,0x09234},{1,0x09234},{1,0x09234},{1,0x09234}},
+   {{1,0x096F6},{1,0x096F6},{1,0x096F6},{1,0x096F6}},{{1,0x09748},{1,0x09748},{1,0x09748},{1,0x09748}},
+   {{1,0x09818},{1,0x09818},{1,0x09818},{1,0x09818}},{{1,0x04F8B},{1,0x04F8B},{1,0x04F8B},{1,0x04F8B}},
+   {{1,0x079AE},{1,0x079AE},{1,0x079AE},{1,0x079AE}},{{1,0x091B4},{1,0x091B4},{1,0x091B4},{1,0x091B4}},
+   {{1,0x096B8},{1,0x096B8},{1,0x096B8},{1,0x096B8}},{{1,0x060E1},{1,0x060E1},{1,0x060E1},{1,0x060E1}},
+   {{1,0x04E86},{1,0x04E86},{1,0x04E86},{1,0x04E86}},{{1,0x050DA},{1,0x050DA},{1,0x050DA},{1,0x050DA}},
+   {{1,0x05BEE},{1,0x05BEE},{1,0x05BEE},{1,0x05BEE}},{{1,0x05C3F},{1,0x05C3F},{1,0x05C3F},{1,0x05C3F}},
+   {{1,0x06599},{1,0x06599},{1,0x06599},{1,0x06599}},{{1,0x06A02},{1,0x06A02},{1,0x06A02},{1,0x06A02}}
+  },
+
+  /* block 116 */
+  {{{1,0x071CE},{1,0x071CE},{1,0x071CE},{1,0x071CE}},{{1,0x07642},{1,0x07642},{1,0x07642},{1,0x07642}},
+   {{1,0x084FC},{1,0x084FC},{1,0x084FC},{1,0x084FC}},{{1,0x0907C},{1,0x0907C},{1,0x0907C},{1,0x0907C}},
+   {{1,0x09F8D},{1,0x09F8D},{1,0x09F8D},{1,0x09F8D}},{{1,0x06688},{1,0x06688},{1,0x06688},{1,0x06688}},
+   {{1,0x0962E},{1,0x0962E},{1,0x0962E},{1,0x0962E}},{{1,0x05289},{1,0x05289},{1,0x05289},{1,0x05289}},
+   {{1,0x0677B},{1,0x0677B},{1,0x0677B},{1,0x0677B}},{{1,0x067F3},{1,0x067F3},{1,0x067F3},{1,0x067F3}},
+   {{1,0x06D41},{1,0x06D41},{1,0x06D41},{1,0x06D41}},{{1,0x06E9C},{1,0x06E9C},{1,0x06E9C},{1,0x06E9C}},
+   {{1,0x07409},{1,0x07409},{1,0x07409},{1,0x07409}},{{1,0x07559},{1,0x07559},{1,0x07559},{1,0x07559}},
+   {{1,0x0786B},{1,0x0786B},{1,0x0786B},{1,0x0786B}},{{1,0x07D10},{1,0x07D10},{1,0x07D10},{1,0x07D10}},
+   {{1,0x0985E},{1,0x0985E},{1,0x0985E},{1,0x0985E}},{{1,0x0516D},{1,0x0516D},{1,0x0516D},{1,0x0516D}},
+   {{1,0x0622E},{1,0x0622E},{1,0x0622E},{1,0x0622E}},{{1,0x09678},{1,0x09678},{1,0x09678},{1,0x09678}},
+   {{1,0x0502B},{1,0x0502B},{1,0x0502B},{1,0x0502B}},{{1,0x05D19},{1,0x05D19},{1,0x05D19},{1,0x05D19}},
+   {{1,0x06DEA},{1,0x06DEA},{1,0x06DEA},{1,0x06DEA}},{{1,0x08F2A},{1,0x08F2A},{1,0x08F2A},{1,0x08F2A}},
+   {{1,0x05F8B},{1,0x05F8B},{1,0x05F8B},{1,0x05F8B}},{{1,0x06144},{1,0x06144},{1,0x06144},{1,0x06144}},
+   {{1,0x06817},{1,0x06817},{1,0x06817},{1,0x06817}},{{1,0x07387},{1,0x07387},{1,0x07387},{1,0x07387}},
+   {{1,0x09686},{1,0x09686},{1,0x09686},{1,0x09686}},{{1,0x05229},{1,0x05229},{1,0x05229},{1,0x05229}},
+   {{1,0x0540F},{1,0x0540F},{1,0x0540F},{1,0x0540F}},{{1,0x05C65},{1,0x05C65},{1,0x05C65},{1,0x05C65}},
+   {{1,0x06613},{1,0x06613},{1,0x06613},{1,0x06613}},{{1,0x0674E},{1,0x0674E},{1,0x0674E},{1,0x0674E}},
+   {{1,0x068A8},{1,0x068A8},{1,0x068A8},{1,0x068A8}},{{1,0x06CE5},{1,0x06CE5},{1,0x06CE5},{1,0x06CE5}},
+   {{1,0x07406},{1,0x07406},{1,0x07406},{1,0x07406}},{{1,0x075E2},{1,0x075E2},{1,0x075E2},{1,0x075E2}},
+   {{1,0x07F79},{1,0x07F79},{1,0x07F79},{1,0x07F79}},{{1,0x088CF},{1,0x088CF},{1,0x088CF},{1,0x088CF}},
+   {{1,0x088E1},{1,0x088E1},{1,0x088E1},{1,0x088E1}},{{1,0x091CC},{1,0x091CC},{1,0x091CC},{1,0x091CC}},
+   {{1,0x096E2},{1,0x096E2},{1,0x096E2},{1,0x096E2}},{{1,0x0533F},{1,0x0533F},{1,0x0533F},{1,0x0533F}},
+   {{1,0x06EBA},{1,0x06EBA},{1,0x06EBA},{1,0x06EBA}},{{1,0x0541D},{1,0x0541D},{1,0x0541D},{1,0x0541D}},
+   {{1,0x071D0},{1,0x071D0},{1,0x071D0},{1,0x071D0}},{{1,0x07498},{1,0x07498},{1,0x07498},{1,0x07498}},
+   {{1,0x085FA},{1,0x085FA},{1,0x085FA},{1,0x085FA}},{{1,0x096A3},{1,0x096A3},{1,0x096A3},{1,0x096A3}},
+   {{1,0x09C57},{1,0x09C57},{1,0x09C57},{1,0x09C57}},{{1,0x09E9F},{1,0x09E9F},{1,0x09E9F},{1,0x09E9F}},
+   {{1,0x06797},{1,0x06797},{1,0x06797},{1,0x06797}},{{1,0x06DCB},{1,0x06DCB},{1,0x06DCB},{1,0x06DCB}},
+   {{1,0x081E8},{1,0x081E8},{1,0x081E8},{1,0x081E8}},{{1,0x07ACB},{1,0x07ACB},{1,0x07ACB},{1,0x07ACB}},
+   {{1,0x07B20},{1,0x07B20},{1,0x07B20},{1,0x07B20}},{{1,0x07C92},{1,0x07C92},{1,0x07C92},{1,0x07C92}},
+   {{1,0x072C0},{1,0x072C0},{1,0x072C0},{1,0x072C0}},{{1,0x07099},{1,0x07099},{1,0x07099},{1,0x07099}},
+   {{1,0x08B58},{1,0x08B58},{1,0x08B58},{1,0x08B58}},{{1,0x04EC0},{1,0x04EC0},{1,0x04EC0},{1,0x04EC0}},
+   {{1,0x08336},{1,0x08336},{1,0x08336},{1,0x08336}},{{1,0x0523A},{1,0x0523A},{1,0x0523A},{1,0x0523A}}
+  },
+
+  /* block 117 */
+  {{{1,0x05207},{1,0x05207},{1,0x05207},{1,0x05207}},{{1,0x05EA6},{1,0x05EA6},{1,0x05EA6},{1,0x05EA6}},
+   {{1,0x062D3},{1,0x062D3},{1,0x062D3},{1,0x062D3}},{{1,0x07CD6},{1,0x07CD6},{1,0x07CD6},{1,0x07CD6}},
+   {{1,0x05B85},{1,0x05B85},{1,0x05B85},{1,0x05B85}},{{1,0x06D1E},{1,0x06D1E},{1,0x06D1E},{1,0x06D1E}},
+   {{1,0x066B4},{1,0x066B4},{1,0x066B4},{1,0x066B4}},{{1,0x08F3B},{1,0x08F3B},{1,0x08F3B},{1,0x08F3B}},
+   {{1,0x0884C},{1,0x0884C},{1,0x0884C},{1,0x0884C}},{{1,0x0964D},{1,0x0964D},{1,0x0964D},{1,0x0964D}},
+   {{1,0x0898B},{1,0x0898B},{1,0x0898B},{1,0x0898B}},{{1,0x05ED3},{1,0x05ED3},{1,0x05ED3},{1,0x05ED3}},
+   {{1,0x05140},{1,0x05140},{1,0x05140},{1,0x05140}},{{1,0x055C0},{1,0x055C0},{1,0x055C0},{1,0x055C0}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{1,0x0585A},{1,0x0585A},{1,0x0585A},{1,0x0585A}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{1,0x06674},{1,0x06674},{1,0x06674},{1,0x06674}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{1,0x051DE},{1,0x051DE},{1,0x051DE},{1,0x051DE}},
+   {{1,0x0732A},{1,0x0732A},{1,0x0732A},{1,0x0732A}},{{1,0x076CA},{1,0x076CA},{1,0x076CA},{1,0x076CA}},
+   {{1,0x0793C},{1,0x0793C},{1,0x0793C},{1,0x0793C}},{{1,0x0795E},{1,0x0795E},{1,0x0795E},{1,0x0795E}},
+   {{1,0x07965},{1,0x07965},{1,0x07965},{1,0x07965}},{{1,0x0798F},{1,0x0798F},{1,0x0798F},{1,0x0798F}},
+   {{1,0x09756},{1,0x09756},{1,0x09756},{1,0x09756}},{{1,0x07CBE},{1,0x07CBE},{1,0x07CBE},{1,0x07CBE}},
+   {{1,0x07FBD},{1,0x07FBD},{1,0x07FBD},{1,0x07FBD}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{1,0x08612},{1,0x08612},{1,0x08612},{1,0x08612}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{1,0x08AF8},{1,0x08AF8},{1,0x08AF8},{1,0x08AF8}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{1,0x09038},{1,0x09038},{1,0x09038},{1,0x09038}},
+   {{1,0x090FD},{1,0x090FD},{1,0x090FD},{1,0x090FD}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{1,0x098EF},{1,0x098EF},{1,0x098EF},{1,0x098EF}},{{1,0x098FC},{1,0x098FC},{1,0x098FC},{1,0x098FC}},
+   {{1,0x09928},{1,0x09928},{1,0x09928},{1,0x09928}},{{1,0x09DB4},{1,0x09DB4},{1,0x09DB4},{1,0x09DB4}},
+   {{1,0x090DE},{1,0x090DE},{1,0x090DE},{1,0x090DE}},{{1,0x096B7},{1,0x096B7},{1,0x096B7},{1,0x096B7}},
+   {{1,0x04FAE},{1,0x04FAE},{1,0x04FAE},{1,0x04FAE}},{{1,0x050E7},{1,0x050E7},{1,0x050E7},{1,0x050E7}},
+   {{1,0x0514D},{1,0x0514D},{1,0x0514D},{1,0x0514D}},{{1,0x052C9},{1,0x052C9},{1,0x052C9},{1,0x052C9}},
+   {{1,0x052E4},{1,0x052E4},{1,0x052E4},{1,0x052E4}},{{1,0x05351},{1,0x05351},{1,0x05351},{1,0x05351}},
+   {{1,0x0559D},{1,0x0559D},{1,0x0559D},{1,0x0559D}},{{1,0x05606},{1,0x05606},{1,0x05606},{1,0x05606}},
+   {{1,0x05668},{1,0x05668},{1,0x05668},{1,0x05668}},{{1,0x05840},{1,0x05840},{1,0x05840},{1,0x05840}},
+   {{1,0x058A8},{1,0x058A8},{1,0x058A8},{1,0x058A8}},{{1,0x05C64},{1,0x05C64},{1,0x05C64},{1,0x05C64}},
+   {{1,0x05C6E},{1,0x05C6E},{1,0x05C6E},{1,0x05C6E}},{{1,0x06094},{1,0x06094},{1,0x06094},{1,0x06094}},
+   {{1,0x06168},{1,0x06168},{1,0x06168},{1,0x06168}},{{1,0x0618E},{1,0x0618E},{1,0x0618E},{1,0x0618E}}
+  },
+
+  /* block 118 */
+  {{{1,0x061F2},{1,0x061F2},{1,0x061F2},{1,0x061F2}},{{1,0x0654F},{1,0x0654F},{1,0x0654F},{1,0x0654F}},
+   {{1,0x065E2},{1,0x065E2},{1,0x065E2},{1,0x065E2}},{{1,0x06691},{1,0x06691},{1,0x06691},{1,0x06691}},
+   {{1,0x06885},{1,0x06885},{1,0x06885},{1,0x06885}},{{1,0x06D77},{1,0x06D77},{1,0x06D77},{1,0x06D77}},
+   {{1,0x06E1A},{1,0x06E1A},{1,0x06E1A},{1,0x06E1A}},{{1,0x06F22},{1,0x06F22},{1,0x06F22},{1,0x06F22}},
+   {{1,0x0716E},{1,0x0716E},{1,0x0716E},{1,0x0716E}},{{1,0x0722B},{1,0x0722B},{1,0x0722B},{1,0x0722B}},
+   {{1,0x07422},{1,0x07422},{1,0x07422},{1,0x07422}},{{1,0x07891},{1,0x07891},{1,0x07891},{1,0x07891}},
+   {{1,0x0793E},{1,0x0793E},{1,0x0793E},{1,0x0793E}},{{1,0x07949},{1,0x07949},{1,0x07949},{1,0x07949}},
+   {{1,0x07948},{1,0x07948},{1,0x07948},{1,0x07948}},{{1,0x07950},{1,0x07950},{1,0x07950},{1,0x07950}},
+   {{1,0x07956},{1,0x07956},{1,0x07956},{1,0x07956}},{{1,0x0795D},{1,0x0795D},{1,0x0795D},{1,0x0795D}},
+   {{1,0x0798D},{1,0x0798D},{1,0x0798D},{1,0x0798D}},{{1,0x0798E},{1,0x0798E},{1,0x0798E},{1,0x0798E}},
+   {{1,0x07A40},{1,0x07A40},{1,0x07A40},{1,0x07A40}},{{1,0x07A81},{1,0x07A81},{1,0x07A81},{1,0x07A81}},
+   {{1,0x07BC0},{1,0x07BC0},{1,0x07BC0},{1,0x07BC0}},{{1,0x07DF4},{1,0x07DF4},{1,0x07DF4},{1,0x07DF4}},
+   {{1,0x07E09},{1,0x07E09},{1,0x07E09},{1,0x07E09}},{{1,0x07E41},{1,0x07E41},{1,0x07E41},{1,0x07E41}},
+   {{1,0x07F72},{1,0x07F72},{1,0x07F72},{1,0x07F72}},{{1,0x08005},{1,0x08005},{1,0x08005},{1,0x08005}},
+   {{1,0x081ED},{1,0x081ED},{1,0x081ED},{1,0x081ED}},{{1,0x08279},{1,0x08279},{1,0x08279},{1,0x08279}},
+   {{1,0x08279},{1,0x08279},{1,0x08279},{1,0x08279}},{{1,0x08457},{1,0x08457},{1,0x08457},{1,0x08457}},
+   {{1,0x08910},{1,0x08910},{1,0x08910},{1,0x08910}},{{1,0x08996},{1,0x08996},{1,0x08996},{1,0x08996}},
+   {{1,0x08B01},{1,0x08B01},{1,0x08B01},{1,0x08B01}},{{1,0x08B39},{1,0x08B39},{1,0x08B39},{1,0x08B39}},
+   {{1,0x08CD3},{1,0x08CD3},{1,0x08CD3},{1,0x08CD3}},{{1,0x08D08},{1,0x08D08},{1,0x08D08},{1,0x08D08}},
+   {{1,0x08FB6},{1,0x08FB6},{1,0x08FB6},{1,0x08FB6}},{{1,0x09038},{1,0x09038},{1,0x09038},{1,0x09038}},
+   {{1,0x096E3},{1,0x096E3},{1,0x096E3},{1,0x096E3}},{{1,0x097FF},{1,0x097FF},{1,0x097FF},{1,0x097FF}},
+   {{1,0x0983B},{1,0x0983B},{1,0x0983B},{1,0x0983B}},{{1,0x06075},{1,0x06075},{1,0x06075},{1,0x06075}},
+   {{1,0x242EE},{1,0x242EE},{1,0x242EE},{1,0x242EE}},{{1,0x08218},{1,0x08218},{1,0x08218},{1,0x08218}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{1,0x04E26},{1,0x04E26},{1,0x04E26},{1,0x04E26}},{{1,0x051B5},{1,0x051B5},{1,0x051B5},{1,0x051B5}},
+   {{1,0x05168},{1,0x05168},{1,0x05168},{1,0x05168}},{{1,0x04F80},{1,0x04F80},{1,0x04F80},{1,0x04F80}},
+   {{1,0x05145},{1,0x05145},{1,0x05145},{1,0x05145}},{{1,0x05180},{1,0x05180},{1,0x05180},{1,0x05180}},
+   {{1,0x052C7},{1,0x052C7},{1,0x052C7},{1,0x052C7}},{{1,0x052FA},{1,0x052FA},{1,0x052FA},{1,0x052FA}},
+   {{1,0x0559D},{1,0x0559D},{1,0x0559D},{1,0x0559D}},{{1,0x05555},{1,0x05555},{1,0x05555},{1,0x05555}},
+   {{1,0x05599},{1,0x05599},{1,0x05599},{1,0x05599}},{{1,0x055E2},{1,0x055E2},{1,0x055E2},{1,0x055E2}},
+   {{1,0x0585A},{1,0x0585A},{1,0x0585A},{1,0x0585A}},{{1,0x058B3},{1,0x058B3},{1,0x058B3},{1,0x058B3}},
+   {{1,0x05944},{1,0x05944},{1,0x05944},{1,0x05944}},{{1,0x05954},{1,0x05954},{1,0x05954},{1,0x05954}}
+  },
+
+  /* block 119 */
+  {{{1,0x05A62},{1,0x05A62},{1,0x05A62},{1,0x05A62}},{{1,0x05B28},{1,0x05B28},{1,0x05B28},{1,0x05B28}},
+   {{1,0x05ED2},{1,0x05ED2},{1,0x05ED2},{1,0x05ED2}},{{1,0x05ED9},{1,0x05ED9},{1,0x05ED9},{1,0x05ED9}},
+   {{1,0x05F69},{1,0x05F69},{1,0x05F69},{1,0x05F69}},{{1,0x05FAD},{1,0x05FAD},{1,0x05FAD},{1,0x05FAD}},
+   {{1,0x060D8},{1,0x060D8},{1,0x060D8},{1,0x060D8}},{{1,0x0614E},{1,0x0614E},{1,0x0614E},{1,0x0614E}},
+   {{1,0x06108},{1,0x06108},{1,0x06108},{1,0x06108}},{{1,0x0618E},{1,0x0618E},{1,0x0618E},{1,0x0618E}},
+   {{1,0x06160},{1,0x06160},{1,0x06160},{1,0x06160}},{{1,0x061F2},{1,0x061F2},{1,0x061F2},{1,0x061F2}},
+   {{1,0x06234},{1,0x06234},{1,0x06234},{1,0x06234}},{{1,0x063C4},{1,0x063C4},{1,0x063C4},{1,0x063C4}},
+   {{1,0x0641C},{1,0x0641C},{1,0x0641C},{1,0x0641C}},{{1,0x06452},{1,0x06452},{1,0x06452},{1,0x06452}},
+   {{1,0x06556},{1,0x06556},{1,0x06556},{1,0x06556}},{{1,0x06674},{1,0x06674},{1,0x06674},{1,0x06674}},
+   {{1,0x06717},{1,0x06717},{1,0x06717},{1,0x06717}},{{1,0x0671B},{1,0x0671B},{1,0x0671B},{1,0x0671B}},
+   {{1,0x06756},{1,0x06756},{1,0x06756},{1,0x06756}},{{1,0x06B79},{1,0x06B79},{1,0x06B79},{1,0x06B79}},
+   {{1,0x06BBA},{1,0x06BBA},{1,0x06BBA},{1,0x06BBA}},{{1,0x06D41},{1,0x06D41},{1,0x06D41},{1,0x06D41}},
+   {{1,0x06EDB},{1,0x06EDB},{1,0x06EDB},{1,0x06EDB}},{{1,0x06ECB},{1,0x06ECB},{1,0x06ECB},{1,0x06ECB}},
+   {{1,0x06F22},{1,0x06F22},{1,0x06F22},{1,0x06F22}},{{1,0x0701E},{1,0x0701E},{1,0x0701E},{1,0x0701E}},
+   {{1,0x0716E},{1,0x0716E},{1,0x0716E},{1,0x0716E}},{{1,0x077A7},{1,0x077A7},{1,0x077A7},{1,0x077A7}},
+   {{1,0x07235},{1,0x07235},{1,0x07235},{1,0x07235}},{{1,0x072AF},{1,0x072AF},{1,0x072AF},{1,0x072AF}},
+   {{1,0x0732A},{1,0x0732A},{1,0x0732A},{1,0x0732A}},{{1,0x07471},{1,0x07471},{1,0x07471},{1,0x07471}},
+   {{1,0x07506},{1,0x07506},{1,0x07506},{1,0x07506}},{{1,0x0753B},{1,0x0753B},{1,0x0753B},{1,0x0753B}},
+   {{1,0x0761D},{1,0x0761D},{1,0x0761D},{1,0x0761D}},{{1,0x0761F},{1,0x0761F},{1,0x0761F},{1,0x0761F}},
+   {{1,0x076CA},{1,0x076CA},{1,0x076CA},{1,0x076CA}},{{1,0x076DB},{1,0x076DB},{1,0x076DB},{1,0x076DB}},
+   {{1,0x076F4},{1,0x076F4},{1,0x076F4},{1,0x076F4}},{{1,0x0774A},{1,0x0774A},{1,0x0774A},{1,0x0774A}},
+   {{1,0x07740},{1,0x07740},{1,0x07740},{1,0x07740}},{{1,0x078CC},{1,0x078CC},{1,0x078CC},{1,0x078CC}},
+   {{1,0x07AB1},{1,0x07AB1},{1,0x07AB1},{1,0x07AB1}},{{1,0x07BC0},{1,0x07BC0},{1,0x07BC0},{1,0x07BC0}},
+   {{1,0x07C7B},{1,0x07C7B},{1,0x07C7B},{1,0x07C7B}},{{1,0x07D5B},{1,0x07D5B},{1,0x07D5B},{1,0x07D5B}},
+   {{1,0x07DF4},{1,0x07DF4},{1,0x07DF4},{1,0x07DF4}},{{1,0x07F3E},{1,0x07F3E},{1,0x07F3E},{1,0x07F3E}},
+   {{1,0x08005},{1,0x08005},{1,0x08005},{1,0x08005}},{{1,0x08352},{1,0x08352},{1,0x08352},{1,0x08352}},
+   {{1,0x083EF},{1,0x083EF},{1,0x083EF},{1,0x083EF}},{{1,0x08779},{1,0x08779},{1,0x08779},{1,0x08779}},
+   {{1,0x08941},{1,0x08941},{1,0x08941},{1,0x08941}},{{1,0x08986},{1,0x08986},{1,0x08986},{1,0x08986}},
+   {{1,0x08996},{1,0x08996},{1,0x08996},{1,0x08996}},{{1,0x08ABF},{1,0x08ABF},{1,0x08ABF},{1,0x08ABF}},
+   {{1,0x08AF8},{1,0x08AF8},{1,0x08AF8},{1,0x08AF8}},{{1,0x08ACB},{1,0x08ACB},{1,0x08ACB},{1,0x08ACB}},
+   {{1,0x08B01},{1,0x08B01},{1,0x08B01},{1,0x08B01}},{{1,0x08AFE},{1,0x08AFE},{1,0x08AFE},{1,0x08AFE}},
+   {{1,0x08AED},{1,0x08AED},{1,0x08AED},{1,0x08AED}},{{1,0x08B39},{1,0x08B39},{1,0x08B39},{1,0x08B39}}
+  },
+
+  /* block 120 */
+  {{{1,0x08B8A},{1,0x08B8A},{1,0x08B8A},{1,0x08B8A}},{{1,0x08D08},{1,0x08D08},{1,0x08D08},{1,0x08D08}},
+   {{1,0x08F38},{1,0x08F38},{1,0x08F38},{1,0x08F38}},{{1,0x09072},{1,0x09072},{1,0x09072},{1,0x09072}},
+   {{1,0x09199},{1,0x09199},{1,0x09199},{1,0x09199}},{{1,0x09276},{1,0x09276},{1,0x09276},{1,0x09276}},
+   {{1,0x0967C},{1,0x0967C},{1,0x0967C},{1,0x0967C}},{{1,0x096E3},{1,0x096E3},{1,0x096E3},{1,0x096E3}},
+   {{1,0x09756},{1,0x09756},{1,0x09756},{1,0x09756}},{{1,0x097DB},{1,0x097DB},{1,0x097DB},{1,0x097DB}},
+   {{1,0x097FF},{1,0x097FF},{1,0x097FF},{1,0x097FF}},{{1,0x0980B},{1,0x0980B},{1,0x0980B},{1,0x0980B}},
+   {{1,0x0983B},{1,0x0983B},{1,0x0983B},{1,0x0983B}},{{1,0x09B12},{1,0x09B12},{1,0x09B12},{1,0x09B12}},
+   {{1,0x09F9C},{1,0x09F9C},{1,0x09F9C},{1,0x09F9C}},{{1,0x2284A},{1,0x2284A},{1,0x2284A},{1,0x2284A}},
+   {{1,0x22844},{1,0x22844},{1,0x22844},{1,0x22844}},{{1,0x233D5},{1,0x233D5},{1,0x233D5},{1,0x233D5}},
+   {{1,0x03B9D},{1,0x03B9D},{1,0x03B9D},{1,0x03B9D}},{{1,0x04018},{1,0x04018},{1,0x04018},{1,0x04018}},
+   {{1,0x04039},{1,0x04039},{1,0x04039},{1,0x04039}},{{1,0x25249},{1,0x25249},{1,0x25249},{1,0x25249}},
+   {{1,0x25CD0},{1,0x25CD0},{1,0x25CD0},{1,0x25CD0}},{{1,0x27ED3},{1,0x27ED3},{1,0x27ED3},{1,0x27ED3}},
+   {{1,0x09F43},{1,0x09F43},{1,0x09F43},{1,0x09F43}},{{1,0x09F8E},{1,0x09F8E},{1,0x09F8E},{1,0x09F8E}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 121 */
+  {{{0,0x00000},{2,0x0103C},{2,0x0103C},{2,0x0103C}},{{0,0x00000},{2,0x0103E},{2,0x0103E},{2,0x0103E}},
+   {{0,0x00000},{2,0x01040},{2,0x01040},{2,0x01040}},{{0,0x00000},{3,0x01042},{3,0x01042},{3,0x01042}},
+   {{0,0x00000},{3,0x01045},{3,0x01045},{3,0x01045}},{{0,0x00000},{2,0x01048},{2,0x01048},{2,0x01048}},
+   {{0,0x00000},{2,0x01048},{2,0x01048},{2,0x01048}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{2,0x0104A},{2,0x0104A},{2,0x0104A}},
+   {{0,0x00000},{2,0x0104C},{2,0x0104C},{2,0x0104C}},{{0,0x00000},{2,0x0104E},{2,0x0104E},{2,0x0104E}},
+   {{0,0x00000},{2,0x01050},{2,0x01050},{2,0x01050}},{{0,0x00000},{2,0x01052},{2,0x01052},{2,0x01052}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x01054},{2,0x01054},{2,0x01054},{2,0x01054}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x01056},{2,0x01056},{2,0x01056},{2,0x01056}},
+   {{0,0x00000},{0,0x00000},{1,0x005E2},{1,0x005E2}},{{0,0x00000},{0,0x00000},{1,0x005D0},{1,0x005D0}},
+   {{0,0x00000},{0,0x00000},{1,0x005D3},{1,0x005D3}},{{0,0x00000},{0,0x00000},{1,0x005D4},{1,0x005D4}},
+   {{0,0x00000},{0,0x00000},{1,0x005DB},{1,0x005DB}},{{0,0x00000},{0,0x00000},{1,0x005DC},{1,0x005DC}},
+   {{0,0x00000},{0,0x00000},{1,0x005DD},{1,0x005DD}},{{0,0x00000},{0,0x00000},{1,0x005E8},{1,0x005E8}},
+   {{0,0x00000},{0,0x00000},{1,0x005EA},{1,0x005EA}},{{0,0x00000},{0,0x00000},{1,0x0002B},{1,0x0002B}},
+   {{2,0x01058},{2,0x01058},{2,0x01058},{2,0x01058}},{{2,0x0105A},{2,0x0105A},{2,0x0105A},{2,0x0105A}},
+   {{3,0x0105C},{3,0x0105C},{3,0x0105C},{3,0x0105C}},{{3,0x0105F},{3,0x0105F},{3,0x0105F},{3,0x0105F}},
+   {{2,0x01062},{2,0x01062},{2,0x01062},{2,0x01062}},{{2,0x01064},{2,0x01064},{2,0x01064},{2,0x01064}},
+   {{2,0x01066},{2,0x01066},{2,0x01066},{2,0x01066}},{{2,0x01068},{2,0x01068},{2,0x01068},{2,0x01068}},
+   {{2,0x0106A},{2,0x0106A},{2,0x0106A},{2,0x0106A}},{{2,0x0106C},{2,0x0106C},{2,0x0106C},{2,0x0106C}},
+   {{2,0x0106E},{2,0x0106E},{2,0x0106E},{2,0x0106E}},{{2,0x01070},{2,0x01070},{2,0x01070},{2,0x01070}},
+   {{2,0x01072},{2,0x01072},{2,0x01072},{2,0x01072}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x01074},{2,0x01074},{2,0x01074},{2,0x01074}},{{2,0x01076},{2,0x01076},{2,0x01076},{2,0x01076}},
+   {{2,0x01078},{2,0x01078},{2,0x01078},{2,0x01078}},{{2,0x0107A},{2,0x0107A},{2,0x0107A},{2,0x0107A}},
+   {{2,0x0107C},{2,0x0107C},{2,0x0107C},{2,0x0107C}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x0107E},{2,0x0107E},{2,0x0107E},{2,0x0107E}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 122 */
+  {{{2,0x01080},{2,0x01080},{2,0x01080},{2,0x01080}},{{2,0x01082},{2,0x01082},{2,0x01082},{2,0x01082}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x01084},{2,0x01084},{2,0x01084},{2,0x01084}},
+   {{2,0x01086},{2,0x01086},{2,0x01086},{2,0x01086}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x01088},{2,0x01088},{2,0x01088},{2,0x01088}},{{2,0x0108A},{2,0x0108A},{2,0x0108A},{2,0x0108A}},
+   {{2,0x0108C},{2,0x0108C},{2,0x0108C},{2,0x0108C}},{{2,0x0108E},{2,0x0108E},{2,0x0108E},{2,0x0108E}},
+   {{2,0x01090},{2,0x01090},{2,0x01090},{2,0x01090}},{{2,0x01092},{2,0x01092},{2,0x01092},{2,0x01092}},
+   {{2,0x01094},{2,0x01094},{2,0x01094},{2,0x01094}},{{2,0x01096},{2,0x01096},{2,0x01096},{2,0x01096}},
+   {{2,0x01098},{2,0x01098},{2,0x01098},{2,0x01098}},{{0,0x00000},{0,0x00000},{2,0x0109A},{2,0x0109A}},
+   {{0,0x00000},{0,0x00000},{1,0x00671},{1,0x00671}},{{0,0x00000},{0,0x00000},{1,0x00671},{1,0x00671}},
+   {{0,0x00000},{0,0x00000},{1,0x0067B},{1,0x0067B}},{{0,0x00000},{0,0x00000},{1,0x0067B},{1,0x0067B}},
+   {{0,0x00000},{0,0x00000},{1,0x0067B},{1,0x0067B}},{{0,0x00000},{0,0x00000},{1,0x0067B},{1,0x0067B}},
+   {{0,0x00000},{0,0x00000},{1,0x0067E},{1,0x0067E}},{{0,0x00000},{0,0x00000},{1,0x0067E},{1,0x0067E}},
+   {{0,0x00000},{0,0x00000},{1,0x0067E},{1,0x0067E}},{{0,0x00000},{0,0x00000},{1,0x0067E},{1,0x0067E}},
+   {{0,0x00000},{0,0x00000},{1,0x00680},{1,0x00680}},{{0,0x00000},{0,0x00000},{1,0x00680},{1,0x00680}},
+   {{0,0x00000},{0,0x00000},{1,0x00680},{1,0x00680}},{{0,0x00000},{0,0x00000},{1,0x00680},{1,0x00680}},
+   {{0,0x00000},{0,0x00000},{1,0x0067A},{1,0x0067A}},{{0,0x00000},{0,0x00000},{1,0x0067A},{1,0x0067A}},
+   {{0,0x00000},{0,0x00000},{1,0x0067A},{1,0x0067A}},{{0,0x00000},{0,0x00000},{1,0x0067A},{1,0x0067A}},
+   {{0,0x00000},{0,0x00000},{1,0x0067F},{1,0x0067F}},{{0,0x00000},{0,0x00000},{1,0x0067F},{1,0x0067F}},
+   {{0,0x00000},{0,0x00000},{1,0x0067F},{1,0x0067F}},{{0,0x00000},{0,0x00000},{1,0x0067F},{1,0x0067F}},
+   {{0,0x00000},{0,0x00000},{1,0x00679},{1,0x00679}},{{0,0x00000},{0,0x00000},{1,0x00679},{1,0x00679}},
+   {{0,0x00000},{0,0x00000},{1,0x00679},{1,0x00679}},{{0,0x00000},{0,0x00000},{1,0x00679},{1,0x00679}},
+   {{0,0x00000},{0,0x00000},{1,0x006A4},{1,0x006A4}},{{0,0x00000},{0,0x00000},{1,0x006A4},{1,0x006A4}},
+   {{0,0x00000},{0,0x00000},{1,0x006A4},{1,0x006A4}},{{0,0x00000},{0,0x00000},{1,0x006A4},{1,0x006A4}},
+   {{0,0x00000},{0,0x00000},{1,0x006A6},{1,0x006A6}},{{0,0x00000},{0,0x00000},{1,0x006A6},{1,0x006A6}},
+   {{0,0x00000},{0,0x00000},{1,0x006A6},{1,0x006A6}},{{0,0x00000},{0,0x00000},{1,0x006A6},{1,0x006A6}},
+   {{0,0x00000},{0,0x00000},{1,0x00684},{1,0x00684}},{{0,0x00000},{0,0x00000},{1,0x00684},{1,0x00684}},
+   {{0,0x00000},{0,0x00000},{1,0x00684},{1,0x00684}},{{0,0x00000},{0,0x00000},{1,0x00684},{1,0x00684}},
+   {{0,0x00000},{0,0x00000},{1,0x00683},{1,0x00683}},{{0,0x00000},{0,0x00000},{1,0x00683},{1,0x00683}},
+   {{0,0x00000},{0,0x00000},{1,0x00683},{1,0x00683}},{{0,0x00000},{0,0x00000},{1,0x00683},{1,0x00683}},
+   {{0,0x00000},{0,0x00000},{1,0x00686},{1,0x00686}},{{0,0x00000},{0,0x00000},{1,0x00686},{1,0x00686}},
+   {{0,0x00000},{0,0x00000},{1,0x00686},{1,0x00686}},{{0,0x00000},{0,0x00000},{1,0x00686},{1,0x00686}},
+   {{0,0x00000},{0,0x00000},{1,0x00687},{1,0x00687}},{{0,0x00000},{0,0x00000},{1,0x00687},{1,0x00687}}
+  },
+
+  /* block 123 */
+  {{{0,0x00000},{0,0x00000},{1,0x00687},{1,0x00687}},{{0,0x00000},{0,0x00000},{1,0x00687},{1,0x00687}},
+   {{0,0x00000},{0,0x00000},{1,0x0068D},{1,0x0068D}},{{0,0x00000},{0,0x00000},{1,0x0068D},{1,0x0068D}},
+   {{0,0x00000},{0,0x00000},{1,0x0068C},{1,0x0068C}},{{0,0x00000},{0,0x00000},{1,0x0068C},{1,0x0068C}},
+   {{0,0x00000},{0,0x00000},{1,0x0068E},{1,0x0068E}},{{0,0x00000},{0,0x00000},{1,0x0068E},{1,0x0068E}},
+   {{0,0x00000},{0,0x00000},{1,0x00688},{1,0x00688}},{{0,0x00000},{0,0x00000},{1,0x00688},{1,0x00688}},
+   {{0,0x00000},{0,0x00000},{1,0x00698},{1,0x00698}},{{0,0x00000},{0,0x00000},{1,0x00698},{1,0x00698}},
+   {{0,0x00000},{0,0x00000},{1,0x00691},{1,0x00691}},{{0,0x00000},{0,0x00000},{1,0x00691},{1,0x00691}},
+   {{0,0x00000},{0,0x00000},{1,0x006A9},{1,0x006A9}},{{0,0x00000},{0,0x00000},{1,0x006A9},{1,0x006A9}},
+   {{0,0x00000},{0,0x00000},{1,0x006A9},{1,0x006A9}},{{0,0x00000},{0,0x00000},{1,0x006A9},{1,0x006A9}},
+   {{0,0x00000},{0,0x00000},{1,0x006AF},{1,0x006AF}},{{0,0x00000},{0,0x00000},{1,0x006AF},{1,0x006AF}},
+   {{0,0x00000},{0,0x00000},{1,0x006AF},{1,0x006AF}},{{0,0x00000},{0,0x00000},{1,0x006AF},{1,0x006AF}},
+   {{0,0x00000},{0,0x00000},{1,0x006B3},{1,0x006B3}},{{0,0x00000},{0,0x00000},{1,0x006B3},{1,0x006B3}},
+   {{0,0x00000},{0,0x00000},{1,0x006B3},{1,0x006B3}},{{0,0x00000},{0,0x00000},{1,0x006B3},{1,0x006B3}},
+   {{0,0x00000},{0,0x00000},{1,0x006B1},{1,0x006B1}},{{0,0x00000},{0,0x00000},{1,0x006B1},{1,0x006B1}},
+   {{0,0x00000},{0,0x00000},{1,0x006B1},{1,0x006B1}},{{0,0x00000},{0,0x00000},{1,0x006B1},{1,0x006B1}},
+   {{0,0x00000},{0,0x00000},{1,0x006BA},{1,0x006BA}},{{0,0x00000},{0,0x00000},{1,0x006BA},{1,0x006BA}},
+   {{0,0x00000},{0,0x00000},{1,0x006BB},{1,0x006BB}},{{0,0x00000},{0,0x00000},{1,0x006BB},{1,0x006BB}},
+   {{0,0x00000},{0,0x00000},{1,0x006BB},{1,0x006BB}},{{0,0x00000},{0,0x00000},{1,0x006BB},{1,0x006BB}},
+   {{0,0x00000},{0,0x00000},{2,0x00309},{2,0x00309}},{{0,0x00000},{0,0x00000},{2,0x00309},{2,0x00309}},
+   {{0,0x00000},{0,0x00000},{1,0x006C1},{1,0x006C1}},{{0,0x00000},{0,0x00000},{1,0x006C1},{1,0x006C1}},
+   {{0,0x00000},{0,0x00000},{1,0x006C1},{1,0x006C1}},{{0,0x00000},{0,0x00000},{1,0x006C1},{1,0x006C1}},
+   {{0,0x00000},{0,0x00000},{1,0x006BE},{1,0x006BE}},{{0,0x00000},{0,0x00000},{1,0x006BE},{1,0x006BE}},
+   {{0,0x00000},{0,0x00000},{1,0x006BE},{1,0x006BE}},{{0,0x00000},{0,0x00000},{1,0x006BE},{1,0x006BE}},
+   {{0,0x00000},{0,0x00000},{1,0x006D2},{1,0x006D2}},{{0,0x00000},{0,0x00000},{1,0x006D2},{1,0x006D2}},
+   {{0,0x00000},{0,0x00000},{2,0x0030D},{2,0x0030D}},{{0,0x00000},{0,0x00000},{2,0x0030D},{2,0x0030D}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 124 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x006AD},{1,0x006AD}},
+   {{0,0x00000},{0,0x00000},{1,0x006AD},{1,0x006AD}},{{0,0x00000},{0,0x00000},{1,0x006AD},{1,0x006AD}},
+   {{0,0x00000},{0,0x00000},{1,0x006AD},{1,0x006AD}},{{0,0x00000},{0,0x00000},{1,0x006C7},{1,0x006C7}},
+   {{0,0x00000},{0,0x00000},{1,0x006C7},{1,0x006C7}},{{0,0x00000},{0,0x00000},{1,0x006C6},{1,0x006C6}},
+   {{0,0x00000},{0,0x00000},{1,0x006C6},{1,0x006C6}},{{0,0x00000},{0,0x00000},{1,0x006C8},{1,0x006C8}},
+   {{0,0x00000},{0,0x00000},{1,0x006C8},{1,0x006C8}},{{0,0x00000},{0,0x00000},{2,0x00305},{2,0x00305}},
+   {{0,0x00000},{0,0x00000},{1,0x006CB},{1,0x006CB}},{{0,0x00000},{0,0x00000},{1,0x006CB},{1,0x006CB}},
+   {{0,0x00000},{0,0x00000},{1,0x006C5},{1,0x006C5}},{{0,0x00000},{0,0x00000},{1,0x006C5},{1,0x006C5}},
+   {{0,0x00000},{0,0x00000},{1,0x006C9},{1,0x006C9}},{{0,0x00000},{0,0x00000},{1,0x006C9},{1,0x006C9}},
+   {{0,0x00000},{0,0x00000},{1,0x006D0},{1,0x006D0}},{{0,0x00000},{0,0x00000},{1,0x006D0},{1,0x006D0}},
+   {{0,0x00000},{0,0x00000},{1,0x006D0},{1,0x006D0}},{{0,0x00000},{0,0x00000},{1,0x006D0},{1,0x006D0}},
+   {{0,0x00000},{0,0x00000},{1,0x00649},{1,0x00649}},{{0,0x00000},{0,0x00000},{1,0x00649},{1,0x00649}},
+   {{0,0x00000},{0,0x00000},{3,0x0109C},{3,0x0109C}},{{0,0x00000},{0,0x00000},{3,0x0109C},{3,0x0109C}},
+   {{0,0x00000},{0,0x00000},{3,0x0109F},{3,0x0109F}},{{0,0x00000},{0,0x00000},{3,0x0109F},{3,0x0109F}},
+   {{0,0x00000},{0,0x00000},{3,0x010A2},{3,0x010A2}},{{0,0x00000},{0,0x00000},{3,0x010A2},{3,0x010A2}},
+   {{0,0x00000},{0,0x00000},{3,0x010A5},{3,0x010A5}},{{0,0x00000},{0,0x00000},{3,0x010A5},{3,0x010A5}},
+   {{0,0x00000},{0,0x00000},{3,0x010A8},{3,0x010A8}},{{0,0x00000},{0,0x00000},{3,0x010A8},{3,0x010A8}},
+   {{0,0x00000},{0,0x00000},{3,0x010AB},{3,0x010AB}},{{0,0x00000},{0,0x00000},{3,0x010AB},{3,0x010AB}},
+   {{0,0x00000},{0,0x00000},{3,0x010AE},{3,0x010AE}},{{0,0x00000},{0,0x00000},{3,0x010AE},{3,0x010AE}},
+   {{0,0x00000},{0,0x00000},{3,0x010AE},{3,0x010AE}},{{0,0x00000},{0,0x00000},{3,0x010B1},{3,0x010B1}},
+   {{0,0x00000},{0,0x00000},{3,0x010B1},{3,0x010B1}},{{0,0x00000},{0,0x00000},{3,0x010B1},{3,0x010B1}},
+   {{0,0x00000},{0,0x00000},{1,0x006CC},{1,0x006CC}},{{0,0x00000},{0,0x00000},{1,0x006CC},{1,0x006CC}},
+   {{0,0x00000},{0,0x00000},{1,0x006CC},{1,0x006CC}},{{0,0x00000},{0,0x00000},{1,0x006CC},{1,0x006CC}}
+  },
+
+  /* block 125 */
+  {{{0,0x00000},{0,0x00000},{3,0x010B4},{3,0x010B4}},{{0,0x00000},{0,0x00000},{3,0x010B7},{3,0x010B7}},
+   {{0,0x00000},{0,0x00000},{3,0x010BA},{3,0x010BA}},{{0,0x00000},{0,0x00000},{3,0x010B1},{3,0x010B1}},
+   {{0,0x00000},{0,0x00000},{3,0x010BD},{3,0x010BD}},{{0,0x00000},{0,0x00000},{2,0x010C0},{2,0x010C0}},
+   {{0,0x00000},{0,0x00000},{2,0x010C2},{2,0x010C2}},{{0,0x00000},{0,0x00000},{2,0x010C4},{2,0x010C4}},
+   {{0,0x00000},{0,0x00000},{2,0x010C6},{2,0x010C6}},{{0,0x00000},{0,0x00000},{2,0x010C8},{2,0x010C8}},
+   {{0,0x00000},{0,0x00000},{2,0x010CA},{2,0x010CA}},{{0,0x00000},{0,0x00000},{2,0x010CC},{2,0x010CC}},
+   {{0,0x00000},{0,0x00000},{2,0x010CE},{2,0x010CE}},{{0,0x00000},{0,0x00000},{2,0x010D0},{2,0x010D0}},
+   {{0,0x00000},{0,0x00000},{2,0x010D2},{2,0x010D2}},{{0,0x00000},{0,0x00000},{2,0x010D4},{2,0x010D4}},
+   {{0,0x00000},{0,0x00000},{2,0x010D6},{2,0x010D6}},{{0,0x00000},{0,0x00000},{2,0x010D8},{2,0x010D8}},
+   {{0,0x00000},{0,0x00000},{2,0x010DA},{2,0x010DA}},{{0,0x00000},{0,0x00000},{2,0x010DC},{2,0x010DC}},
+   {{0,0x00000},{0,0x00000},{2,0x010DE},{2,0x010DE}},{{0,0x00000},{0,0x00000},{2,0x010E0},{2,0x010E0}},
+   {{0,0x00000},{0,0x00000},{2,0x010E2},{2,0x010E2}},{{0,0x00000},{0,0x00000},{2,0x010E4},{2,0x010E4}},
+   {{0,0x00000},{0,0x00000},{2,0x010E6},{2,0x010E6}},{{0,0x00000},{0,0x00000},{2,0x010E8},{2,0x010E8}},
+   {{0,0x00000},{0,0x00000},{2,0x010EA},{2,0x010EA}},{{0,0x00000},{0,0x00000},{2,0x010EC},{2,0x010EC}},
+   {{0,0x00000},{0,0x00000},{2,0x010EE},{2,0x010EE}},{{0,0x00000},{0,0x00000},{2,0x010F0},{2,0x010F0}},
+   {{0,0x00000},{0,0x00000},{2,0x010F2},{2,0x010F2}},{{0,0x00000},{0,0x00000},{2,0x010F4},{2,0x010F4}},
+   {{0,0x00000},{0,0x00000},{2,0x010F6},{2,0x010F6}},{{0,0x00000},{0,0x00000},{2,0x010F8},{2,0x010F8}},
+   {{0,0x00000},{0,0x00000},{2,0x010FA},{2,0x010FA}},{{0,0x00000},{0,0x00000},{2,0x010FC},{2,0x010FC}},
+   {{0,0x00000},{0,0x00000},{2,0x010FE},{2,0x010FE}},{{0,0x00000},{0,0x00000},{2,0x01100},{2,0x01100}},
+   {{0,0x00000},{0,0x00000},{2,0x01102},{2,0x01102}},{{0,0x00000},{0,0x00000},{2,0x01104},{2,0x01104}},
+   {{0,0x00000},{0,0x00000},{2,0x01106},{2,0x01106}},{{0,0x00000},{0,0x00000},{2,0x01108},{2,0x01108}},
+   {{0,0x00000},{0,0x00000},{2,0x0110A},{2,0x0110A}},{{0,0x00000},{0,0x00000},{2,0x0110C},{2,0x0110C}},
+   {{0,0x00000},{0,0x00000},{2,0x0110E},{2,0x0110E}},{{0,0x00000},{0,0x00000},{2,0x01110},{2,0x01110}},
+   {{0,0x00000},{0,0x00000},{2,0x01112},{2,0x01112}},{{0,0x00000},{0,0x00000},{2,0x01114},{2,0x01114}},
+   {{0,0x00000},{0,0x00000},{2,0x01116},{2,0x01116}},{{0,0x00000},{0,0x00000},{2,0x01118},{2,0x01118}},
+   {{0,0x00000},{0,0x00000},{2,0x0111A},{2,0x0111A}},{{0,0x00000},{0,0x00000},{2,0x0111C},{2,0x0111C}},
+   {{0,0x00000},{0,0x00000},{2,0x0111E},{2,0x0111E}},{{0,0x00000},{0,0x00000},{2,0x01120},{2,0x01120}},
+   {{0,0x00000},{0,0x00000},{2,0x01122},{2,0x01122}},{{0,0x00000},{0,0x00000},{2,0x01124},{2,0x01124}},
+   {{0,0x00000},{0,0x00000},{2,0x01126},{2,0x01126}},{{0,0x00000},{0,0x00000},{2,0x01128},{2,0x01128}},
+   {{0,0x00000},{0,0x00000},{2,0x0112A},{2,0x0112A}},{{0,0x00000},{0,0x00000},{2,0x0112C},{2,0x0112C}},
+   {{0,0x00000},{0,0x00000},{2,0x0112E},{2,0x0112E}},{{0,0x00000},{0,0x00000},{2,0x01130},{2,0x01130}},
+   {{0,0x00000},{0,0x00000},{2,0x01132},{2,0x01132}},{{0,0x00000},{0,0x00000},{2,0x01134},{2,0x01134}}
+  },
+
+  /* block 126 */
+  {{{0,0x00000},{0,0x00000},{2,0x01136},{2,0x01136}},{{0,0x00000},{0,0x00000},{2,0x01138},{2,0x01138}},
+   {{0,0x00000},{0,0x00000},{2,0x0113A},{2,0x0113A}},{{0,0x00000},{0,0x00000},{2,0x0113C},{2,0x0113C}},
+   {{0,0x00000},{0,0x00000},{2,0x0113E},{2,0x0113E}},{{0,0x00000},{0,0x00000},{2,0x01140},{2,0x01140}},
+   {{0,0x00000},{0,0x00000},{2,0x01142},{2,0x01142}},{{0,0x00000},{0,0x00000},{2,0x01144},{2,0x01144}},
+   {{0,0x00000},{0,0x00000},{2,0x01146},{2,0x01146}},{{0,0x00000},{0,0x00000},{2,0x01148},{2,0x01148}},
+   {{0,0x00000},{0,0x00000},{2,0x0114A},{2,0x0114A}},{{0,0x00000},{0,0x00000},{2,0x0114C},{2,0x0114C}},
+   {{0,0x00000},{0,0x00000},{2,0x0114E},{2,0x0114E}},{{0,0x00000},{0,0x00000},{2,0x01150},{2,0x01150}},
+   {{0,0x00000},{0,0x00000},{2,0x01152},{2,0x01152}},{{0,0x00000},{0,0x00000},{2,0x01154},{2,0x01154}},
+   {{0,0x00000},{0,0x00000},{2,0x01156},{2,0x01156}},{{0,0x00000},{0,0x00000},{2,0x01158},{2,0x01158}},
+   {{0,0x00000},{0,0x00000},{2,0x0115A},{2,0x0115A}},{{0,0x00000},{0,0x00000},{2,0x0115C},{2,0x0115C}},
+   {{0,0x00000},{0,0x00000},{2,0x0115E},{2,0x0115E}},{{0,0x00000},{0,0x00000},{2,0x01160},{2,0x01160}},
+   {{0,0x00000},{0,0x00000},{2,0x01162},{2,0x01162}},{{0,0x00000},{0,0x00000},{2,0x01164},{2,0x01164}},
+   {{0,0x00000},{0,0x00000},{2,0x01166},{2,0x01166}},{{0,0x00000},{0,0x00000},{2,0x01168},{2,0x01168}},
+   {{0,0x00000},{0,0x00000},{2,0x0116A},{2,0x0116A}},{{0,0x00000},{0,0x00000},{2,0x0116C},{2,0x0116C}},
+   {{0,0x00000},{0,0x00000},{2,0x0116E},{2,0x0116E}},{{0,0x00000},{0,0x00000},{2,0x01170},{2,0x01170}},
+   {{0,0x00000},{0,0x00000},{3,0x01172},{3,0x01172}},{{0,0x00000},{0,0x00000},{3,0x01175},{3,0x01175}},
+   {{0,0x00000},{0,0x00000},{3,0x01178},{3,0x01178}},{{0,0x00000},{0,0x00000},{3,0x0117B},{3,0x0117B}},
+   {{0,0x00000},{0,0x00000},{3,0x0117E},{3,0x0117E}},{{0,0x00000},{0,0x00000},{3,0x01181},{3,0x01181}},
+   {{0,0x00000},{0,0x00000},{3,0x01184},{3,0x01184}},{{0,0x00000},{0,0x00000},{3,0x01187},{3,0x01187}},
+   {{0,0x00000},{0,0x00000},{3,0x010BA},{3,0x010BA}},{{0,0x00000},{0,0x00000},{3,0x0118A},{3,0x0118A}},
+   {{0,0x00000},{0,0x00000},{3,0x010B1},{3,0x010B1}},{{0,0x00000},{0,0x00000},{3,0x010BD},{3,0x010BD}},
+   {{0,0x00000},{0,0x00000},{2,0x0118D},{2,0x0118D}},{{0,0x00000},{0,0x00000},{2,0x0118F},{2,0x0118F}},
+   {{0,0x00000},{0,0x00000},{2,0x010C6},{2,0x010C6}},{{0,0x00000},{0,0x00000},{2,0x01191},{2,0x01191}},
+   {{0,0x00000},{0,0x00000},{2,0x010C8},{2,0x010C8}},{{0,0x00000},{0,0x00000},{2,0x010CA},{2,0x010CA}},
+   {{0,0x00000},{0,0x00000},{2,0x01193},{2,0x01193}},{{0,0x00000},{0,0x00000},{2,0x01195},{2,0x01195}},
+   {{0,0x00000},{0,0x00000},{2,0x010D2},{2,0x010D2}},{{0,0x00000},{0,0x00000},{2,0x01197},{2,0x01197}},
+   {{0,0x00000},{0,0x00000},{2,0x010D4},{2,0x010D4}},{{0,0x00000},{0,0x00000},{2,0x010D6},{2,0x010D6}},
+   {{0,0x00000},{0,0x00000},{2,0x01199},{2,0x01199}},{{0,0x00000},{0,0x00000},{2,0x0119B},{2,0x0119B}},
+   {{0,0x00000},{0,0x00000},{2,0x010DA},{2,0x010DA}},{{0,0x00000},{0,0x00000},{2,0x0119D},{2,0x0119D}},
+   {{0,0x00000},{0,0x00000},{2,0x010DC},{2,0x010DC}},{{0,0x00000},{0,0x00000},{2,0x010DE},{2,0x010DE}},
+   {{0,0x00000},{0,0x00000},{2,0x01118},{2,0x01118}},{{0,0x00000},{0,0x00000},{2,0x0111A},{2,0x0111A}},
+   {{0,0x00000},{0,0x00000},{2,0x01120},{2,0x01120}},{{0,0x00000},{0,0x00000},{2,0x01122},{2,0x01122}}
+  },
+
+  /* block 127 */
+  {{{0,0x00000},{0,0x00000},{2,0x01124},{2,0x01124}},{{0,0x00000},{0,0x00000},{2,0x0112C},{2,0x0112C}},
+   {{0,0x00000},{0,0x00000},{2,0x0112E},{2,0x0112E}},{{0,0x00000},{0,0x00000},{2,0x01130},{2,0x01130}},
+   {{0,0x00000},{0,0x00000},{2,0x01132},{2,0x01132}},{{0,0x00000},{0,0x00000},{2,0x0113A},{2,0x0113A}},
+   {{0,0x00000},{0,0x00000},{2,0x0113C},{2,0x0113C}},{{0,0x00000},{0,0x00000},{2,0x0113E},{2,0x0113E}},
+   {{0,0x00000},{0,0x00000},{2,0x0119F},{2,0x0119F}},{{0,0x00000},{0,0x00000},{2,0x01146},{2,0x01146}},
+   {{0,0x00000},{0,0x00000},{2,0x011A1},{2,0x011A1}},{{0,0x00000},{0,0x00000},{2,0x011A3},{2,0x011A3}},
+   {{0,0x00000},{0,0x00000},{2,0x01152},{2,0x01152}},{{0,0x00000},{0,0x00000},{2,0x011A5},{2,0x011A5}},
+   {{0,0x00000},{0,0x00000},{2,0x01154},{2,0x01154}},{{0,0x00000},{0,0x00000},{2,0x01156},{2,0x01156}},
+   {{0,0x00000},{0,0x00000},{2,0x01170},{2,0x01170}},{{0,0x00000},{0,0x00000},{2,0x011A7},{2,0x011A7}},
+   {{0,0x00000},{0,0x00000},{2,0x011A9},{2,0x011A9}},{{0,0x00000},{0,0x00000},{2,0x01166},{2,0x01166}},
+   {{0,0x00000},{0,0x00000},{2,0x011AB},{2,0x011AB}},{{0,0x00000},{0,0x00000},{2,0x01168},{2,0x01168}},
+   {{0,0x00000},{0,0x00000},{2,0x0116A},{2,0x0116A}},{{0,0x00000},{0,0x00000},{3,0x010B4},{3,0x010B4}},
+   {{0,0x00000},{0,0x00000},{3,0x010B7},{3,0x010B7}},{{0,0x00000},{0,0x00000},{3,0x011AD},{3,0x011AD}},
+   {{0,0x00000},{0,0x00000},{3,0x010BA},{3,0x010BA}},{{0,0x00000},{0,0x00000},{3,0x011B0},{3,0x011B0}},
+   {{0,0x00000},{0,0x00000},{2,0x010C0},{2,0x010C0}},{{0,0x00000},{0,0x00000},{2,0x010C2},{2,0x010C2}},
+   {{0,0x00000},{0,0x00000},{2,0x010C4},{2,0x010C4}},{{0,0x00000},{0,0x00000},{2,0x010C6},{2,0x010C6}},
+   {{0,0x00000},{0,0x00000},{2,0x011B3},{2,0x011B3}},{{0,0x00000},{0,0x00000},{2,0x010CC},{2,0x010CC}},
+   {{0,0x00000},{0,0x00000},{2,0x010CE},{2,0x010CE}},{{0,0x00000},{0,0x00000},{2,0x010D0},{2,0x010D0}},
+   {{0,0x00000},{0,0x00000},{2,0x010D2},{2,0x010D2}},{{0,0x00000},{0,0x00000},{2,0x011B5},{2,0x011B5}},
+   {{0,0x00000},{0,0x00000},{2,0x010DA},{2,0x010DA}},{{0,0x00000},{0,0x00000},{2,0x010E0},{2,0x010E0}},
+   {{0,0x00000},{0,0x00000},{2,0x010E2},{2,0x010E2}},{{0,0x00000},{0,0x00000},{2,0x010E4},{2,0x010E4}},
+   {{0,0x00000},{0,0x00000},{2,0x010E6},{2,0x010E6}},{{0,0x00000},{0,0x00000},{2,0x010E8},{2,0x010E8}},
+   {{0,0x00000},{0,0x00000},{2,0x010EC},{2,0x010EC}},{{0,0x00000},{0,0x00000},{2,0x010EE},{2,0x010EE}},
+   {{0,0x00000},{0,0x00000},{2,0x010F0},{2,0x010F0}},{{0,0x00000},{0,0x00000},{2,0x010F2},{2,0x010F2}},
+   {{0,0x00000},{0,0x00000},{2,0x010F4},{2,0x010F4}},{{0,0x00000},{0,0x00000},{2,0x010F6},{2,0x010F6}},
+   {{0,0x00000},{0,0x00000},{2,0x011B7},{2,0x011B7}},{{0,0x00000},{0,0x00000},{2,0x010F8},{2,0x010F8}},
+   {{0,0x00000},{0,0x00000},{2,0x010FA},{2,0x010FA}},{{0,0x00000},{0,0x00000},{2,0x010FC},{2,0x010FC}},
+   {{0,0x00000},{0,0x00000},{2,0x010FE},{2,0x010FE}},{{0,0x00000},{0,0x00000},{2,0x01100},{2,0x01100}},
+   {{0,0x00000},{0,0x00000},{2,0x01102},{2,0x01102}},{{0,0x00000},{0,0x00000},{2,0x01106},{2,0x01106}},
+   {{0,0x00000},{0,0x00000},{2,0x01108},{2,0x01108}},{{0,0x00000},{0,0x00000},{2,0x0110A},{2,0x0110A}},
+   {{0,0x00000},{0,0x00000},{2,0x0110C},{2,0x0110C}},{{0,0x00000},{0,0x00000},{2,0x0110E},{2,0x0110E}},
+   {{0,0x00000},{0,0x00000},{2,0x01110},{2,0x01110}},{{0,0x00000},{0,0x00000},{2,0x01112},{2,0x01112}}
+  },
+
+  /* block 128 */
+  {{{0,0x00000},{0,0x00000},{2,0x01114},{2,0x01114}},{{0,0x00000},{0,0x00000},{2,0x01116},{2,0x01116}},
+   {{0,0x00000},{0,0x00000},{2,0x0111C},{2,0x0111C}},{{0,0x00000},{0,0x00000},{2,0x0111E},{2,0x0111E}},
+   {{0,0x00000},{0,0x00000},{2,0x01126},{2,0x01126}},{{0,0x00000},{0,0x00000},{2,0x01128},{2,0x01128}},
+   {{0,0x00000},{0,0x00000},{2,0x0112A},{2,0x0112A}},{{0,0x00000},{0,0x00000},{2,0x0112C},{2,0x0112C}},
+   {{0,0x00000},{0,0x00000},{2,0x0112E},{2,0x0112E}},{{0,0x00000},{0,0x00000},{2,0x01134},{2,0x01134}},
+   {{0,0x00000},{0,0x00000},{2,0x01136},{2,0x01136}},{{0,0x00000},{0,0x00000},{2,0x01138},{2,0x01138}},
+   {{0,0x00000},{0,0x00000},{2,0x0113A},{2,0x0113A}},{{0,0x00000},{0,0x00000},{2,0x011B9},{2,0x011B9}},
+   {{0,0x00000},{0,0x00000},{2,0x01140},{2,0x01140}},{{0,0x00000},{0,0x00000},{2,0x01142},{2,0x01142}},
+   {{0,0x00000},{0,0x00000},{2,0x01144},{2,0x01144}},{{0,0x00000},{0,0x00000},{2,0x01146},{2,0x01146}},
+   {{0,0x00000},{0,0x00000},{2,0x0114C},{2,0x0114C}},{{0,0x00000},{0,0x00000},{2,0x0114E},{2,0x0114E}},
+   {{0,0x00000},{0,0x00000},{2,0x01150},{2,0x01150}},{{0,0x00000},{0,0x00000},{2,0x01152},{2,0x01152}},
+   {{0,0x00000},{0,0x00000},{2,0x011BB},{2,0x011BB}},{{0,0x00000},{0,0x00000},{2,0x01158},{2,0x01158}},
+   {{0,0x00000},{0,0x00000},{2,0x0115A},{2,0x0115A}},{{0,0x00000},{0,0x00000},{2,0x011BD},{2,0x011BD}},
+   {{0,0x00000},{0,0x00000},{2,0x01160},{2,0x01160}},{{0,0x00000},{0,0x00000},{2,0x01162},{2,0x01162}},
+   {{0,0x00000},{0,0x00000},{2,0x01164},{2,0x01164}},{{0,0x00000},{0,0x00000},{2,0x01166},{2,0x01166}},
+   {{0,0x00000},{0,0x00000},{2,0x011BF},{2,0x011BF}},{{0,0x00000},{0,0x00000},{3,0x010BA},{3,0x010BA}},
+   {{0,0x00000},{0,0x00000},{3,0x011B0},{3,0x011B0}},{{0,0x00000},{0,0x00000},{2,0x010C6},{2,0x010C6}},
+   {{0,0x00000},{0,0x00000},{2,0x011B3},{2,0x011B3}},{{0,0x00000},{0,0x00000},{2,0x010D2},{2,0x010D2}},
+   {{0,0x00000},{0,0x00000},{2,0x011B5},{2,0x011B5}},{{0,0x00000},{0,0x00000},{2,0x010DA},{2,0x010DA}},
+   {{0,0x00000},{0,0x00000},{2,0x011C1},{2,0x011C1}},{{0,0x00000},{0,0x00000},{2,0x010F4},{2,0x010F4}},
+   {{0,0x00000},{0,0x00000},{2,0x011C3},{2,0x011C3}},{{0,0x00000},{0,0x00000},{2,0x011C5},{2,0x011C5}},
+   {{0,0x00000},{0,0x00000},{2,0x011C7},{2,0x011C7}},{{0,0x00000},{0,0x00000},{2,0x0112C},{2,0x0112C}},
+   {{0,0x00000},{0,0x00000},{2,0x0112E},{2,0x0112E}},{{0,0x00000},{0,0x00000},{2,0x0113A},{2,0x0113A}},
+   {{0,0x00000},{0,0x00000},{2,0x01152},{2,0x01152}},{{0,0x00000},{0,0x00000},{2,0x011BB},{2,0x011BB}},
+   {{0,0x00000},{0,0x00000},{2,0x01166},{2,0x01166}},{{0,0x00000},{0,0x00000},{2,0x011BF},{2,0x011BF}},
+   {{0,0x00000},{0,0x00000},{3,0x011C9},{3,0x011C9}},{{0,0x00000},{0,0x00000},{3,0x011CC},{3,0x011CC}},
+   {{0,0x00000},{0,0x00000},{3,0x011CF},{3,0x011CF}},{{0,0x00000},{0,0x00000},{2,0x011D2},{2,0x011D2}},
+   {{0,0x00000},{0,0x00000},{2,0x011D4},{2,0x011D4}},{{0,0x00000},{0,0x00000},{2,0x011D6},{2,0x011D6}},
+   {{0,0x00000},{0,0x00000},{2,0x011D8},{2,0x011D8}},{{0,0x00000},{0,0x00000},{2,0x011DA},{2,0x011DA}},
+   {{0,0x00000},{0,0x00000},{2,0x011DC},{2,0x011DC}},{{0,0x00000},{0,0x00000},{2,0x011DE},{2,0x011DE}},
+   {{0,0x00000},{0,0x00000},{2,0x011E0},{2,0x011E0}},{{0,0x00000},{0,0x00000},{2,0x011E2},{2,0x011E2}},
+   {{0,0x00000},{0,0x00000},{2,0x011E4},{2,0x011E4}},{{0,0x00000},{0,0x00000},{2,0x011E6},{2,0x011E6}}
+  },
+
+  /* block 129 */
+  {{{0,0x00000},{0,0x00000},{2,0x011E8},{2,0x011E8}},{{0,0x00000},{0,0x00000},{2,0x011EA},{2,0x011EA}},
+   {{0,0x00000},{0,0x00000},{2,0x011EC},{2,0x011EC}},{{0,0x00000},{0,0x00000},{2,0x011EE},{2,0x011EE}},
+   {{0,0x00000},{0,0x00000},{2,0x011F0},{2,0x011F0}},{{0,0x00000},{0,0x00000},{2,0x011F2},{2,0x011F2}},
+   {{0,0x00000},{0,0x00000},{2,0x011F4},{2,0x011F4}},{{0,0x00000},{0,0x00000},{2,0x011F6},{2,0x011F6}},
+   {{0,0x00000},{0,0x00000},{2,0x011F8},{2,0x011F8}},{{0,0x00000},{0,0x00000},{2,0x011FA},{2,0x011FA}},
+   {{0,0x00000},{0,0x00000},{2,0x011FC},{2,0x011FC}},{{0,0x00000},{0,0x00000},{2,0x011FE},{2,0x011FE}},
+   {{0,0x00000},{0,0x00000},{2,0x011C5},{2,0x011C5}},{{0,0x00000},{0,0x00000},{2,0x01200},{2,0x01200}},
+   {{0,0x00000},{0,0x00000},{2,0x01202},{2,0x01202}},{{0,0x00000},{0,0x00000},{2,0x01204},{2,0x01204}},
+   {{0,0x00000},{0,0x00000},{2,0x01206},{2,0x01206}},{{0,0x00000},{0,0x00000},{2,0x011D2},{2,0x011D2}},
+   {{0,0x00000},{0,0x00000},{2,0x011D4},{2,0x011D4}},{{0,0x00000},{0,0x00000},{2,0x011D6},{2,0x011D6}},
+   {{0,0x00000},{0,0x00000},{2,0x011D8},{2,0x011D8}},{{0,0x00000},{0,0x00000},{2,0x011DA},{2,0x011DA}},
+   {{0,0x00000},{0,0x00000},{2,0x011DC},{2,0x011DC}},{{0,0x00000},{0,0x00000},{2,0x011DE},{2,0x011DE}},
+   {{0,0x00000},{0,0x00000},{2,0x011E0},{2,0x011E0}},{{0,0x00000},{0,0x00000},{2,0x011E2},{2,0x011E2}},
+   {{0,0x00000},{0,0x00000},{2,0x011E4},{2,0x011E4}},{{0,0x00000},{0,0x00000},{2,0x011E6},{2,0x011E6}},
+   {{0,0x00000},{0,0x00000},{2,0x011E8},{2,0x011E8}},{{0,0x00000},{0,0x00000},{2,0x011EA},{2,0x011EA}},
+   {{0,0x00000},{0,0x00000},{2,0x011EC},{2,0x011EC}},{{0,0x00000},{0,0x00000},{2,0x011EE},{2,0x011EE}},
+   {{0,0x00000},{0,0x00000},{2,0x011F0},{2,0x011F0}},{{0,0x00000},{0,0x00000},{2,0x011F2},{2,0x011F2}},
+   {{0,0x00000},{0,0x00000},{2,0x011F4},{2,0x011F4}},{{0,0x00000},{0,0x00000},{2,0x011F6},{2,0x011F6}},
+   {{0,0x00000},{0,0x00000},{2,0x011F8},{2,0x011F8}},{{0,0x00000},{0,0x00000},{2,0x011FA},{2,0x011FA}},
+   {{0,0x00000},{0,0x00000},{2,0x011FC},{2,0x011FC}},{{0,0x00000},{0,0x00000},{2,0x011FE},{2,0x011FE}},
+   {{0,0x00000},{0,0x00000},{2,0x011C5},{2,0x011C5}},{{0,0x00000},{0,0x00000},{2,0x01200},{2,0x01200}},
+   {{0,0x00000},{0,0x00000},{2,0x01202},{2,0x01202}},{{0,0x00000},{0,0x00000},{2,0x01204},{2,0x01204}},
+   {{0,0x00000},{0,0x00000},{2,0x01206},{2,0x01206}},{{0,0x00000},{0,0x00000},{2,0x011FA},{2,0x011FA}},
+   {{0,0x00000},{0,0x00000},{2,0x011FC},{2,0x011FC}},{{0,0x00000},{0,0x00000},{2,0x011FE},{2,0x011FE}},
+   {{0,0x00000},{0,0x00000},{2,0x011C5},{2,0x011C5}},{{0,0x00000},{0,0x00000},{2,0x011C3},{2,0x011C3}},
+   {{0,0x00000},{0,0x00000},{2,0x011C7},{2,0x011C7}},{{0,0x00000},{0,0x00000},{2,0x01104},{2,0x01104}},
+   {{0,0x00000},{0,0x00000},{2,0x010EE},{2,0x010EE}},{{0,0x00000},{0,0x00000},{2,0x010F0},{2,0x010F0}},
+   {{0,0x00000},{0,0x00000},{2,0x010F2},{2,0x010F2}},{{0,0x00000},{0,0x00000},{2,0x011FA},{2,0x011FA}},
+   {{0,0x00000},{0,0x00000},{2,0x011FC},{2,0x011FC}},{{0,0x00000},{0,0x00000},{2,0x011FE},{2,0x011FE}},
+   {{0,0x00000},{0,0x00000},{2,0x01104},{2,0x01104}},{{0,0x00000},{0,0x00000},{2,0x01106},{2,0x01106}},
+   {{0,0x00000},{0,0x00000},{2,0x01208},{2,0x01208}},{{0,0x00000},{0,0x00000},{2,0x01208},{2,0x01208}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 130 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{3,0x0120A},{3,0x0120A}},{{0,0x00000},{0,0x00000},{3,0x0120D},{3,0x0120D}},
+   {{0,0x00000},{0,0x00000},{3,0x0120D},{3,0x0120D}},{{0,0x00000},{0,0x00000},{3,0x01210},{3,0x01210}},
+   {{0,0x00000},{0,0x00000},{3,0x01213},{3,0x01213}},{{0,0x00000},{0,0x00000},{3,0x01216},{3,0x01216}},
+   {{0,0x00000},{0,0x00000},{3,0x01219},{3,0x01219}},{{0,0x00000},{0,0x00000},{3,0x0121C},{3,0x0121C}},
+   {{0,0x00000},{0,0x00000},{3,0x0121F},{3,0x0121F}},{{0,0x00000},{0,0x00000},{3,0x0121F},{3,0x0121F}},
+   {{0,0x00000},{0,0x00000},{3,0x01222},{3,0x01222}},{{0,0x00000},{0,0x00000},{3,0x01225},{3,0x01225}},
+   {{0,0x00000},{0,0x00000},{3,0x01228},{3,0x01228}},{{0,0x00000},{0,0x00000},{3,0x0122B},{3,0x0122B}},
+   {{0,0x00000},{0,0x00000},{3,0x0122E},{3,0x0122E}},{{0,0x00000},{0,0x00000},{3,0x01231},{3,0x01231}},
+   {{0,0x00000},{0,0x00000},{3,0x01231},{3,0x01231}},{{0,0x00000},{0,0x00000},{3,0x01234},{3,0x01234}},
+   {{0,0x00000},{0,0x00000},{3,0x01237},{3,0x01237}},{{0,0x00000},{0,0x00000},{3,0x01237},{3,0x01237}},
+   {{0,0x00000},{0,0x00000},{3,0x0123A},{3,0x0123A}},{{0,0x00000},{0,0x00000},{3,0x0123A},{3,0x0123A}},
+   {{0,0x00000},{0,0x00000},{3,0x0123D},{3,0x0123D}},{{0,0x00000},{0,0x00000},{3,0x01240},{3,0x01240}},
+   {{0,0x00000},{0,0x00000},{3,0x01240},{3,0x01240}},{{0,0x00000},{0,0x00000},{3,0x01243},{3,0x01243}},
+   {{0,0x00000},{0,0x00000},{3,0x01246},{3,0x01246}},{{0,0x00000},{0,0x00000},{3,0x01246},{3,0x01246}},
+   {{0,0x00000},{0,0x00000},{3,0x01249},{3,0x01249}},{{0,0x00000},{0,0x00000},{3,0x01249},{3,0x01249}},
+   {{0,0x00000},{0,0x00000},{3,0x0124C},{3,0x0124C}},{{0,0x00000},{0,0x00000},{3,0x0124F},{3,0x0124F}},
+   {{0,0x00000},{0,0x00000},{3,0x0124F},{3,0x0124F}},{{0,0x00000},{0,0x00000},{3,0x01252},{3,0x01252}},
+   {{0,0x00000},{0,0x00000},{3,0x01252},{3,0x01252}},{{0,0x00000},{0,0x00000},{3,0x01255},{3,0x01255}},
+   {{0,0x00000},{0,0x00000},{3,0x01258},{3,0x01258}},{{0,0x00000},{0,0x00000},{3,0x0125B},{3,0x0125B}},
+   {{0,0x00000},{0,0x00000},{3,0x0125E},{3,0x0125E}},{{0,0x00000},{0,0x00000},{3,0x0125E},{3,0x0125E}},
+   {{0,0x00000},{0,0x00000},{3,0x01261},{3,0x01261}},{{0,0x00000},{0,0x00000},{3,0x01264},{3,0x01264}},
+   {{0,0x00000},{0,0x00000},{3,0x01267},{3,0x01267}},{{0,0x00000},{0,0x00000},{3,0x0126A},{3,0x0126A}},
+   {{0,0x00000},{0,0x00000},{3,0x0126D},{3,0x0126D}},{{0,0x00000},{0,0x00000},{3,0x0126D},{3,0x0126D}},
+   {{0,0x00000},{0,0x00000},{3,0x01270},{3,0x01270}},{{0,0x00000},{0,0x00000},{3,0x01273},{3,0x01273}}
+  },
+
+  /* block 131 */
+  {{{0,0x00000},{0,0x00000},{3,0x01276},{3,0x01276}},{{0,0x00000},{0,0x00000},{3,0x01279},{3,0x01279}},
+   {{0,0x00000},{0,0x00000},{3,0x0127C},{3,0x0127C}},{{0,0x00000},{0,0x00000},{3,0x0127F},{3,0x0127F}},
+   {{0,0x00000},{0,0x00000},{3,0x0127F},{3,0x0127F}},{{0,0x00000},{0,0x00000},{3,0x01282},{3,0x01282}},
+   {{0,0x00000},{0,0x00000},{3,0x01282},{3,0x01282}},{{0,0x00000},{0,0x00000},{3,0x01285},{3,0x01285}},
+   {{0,0x00000},{0,0x00000},{3,0x01285},{3,0x01285}},{{0,0x00000},{0,0x00000},{3,0x01288},{3,0x01288}},
+   {{0,0x00000},{0,0x00000},{3,0x0128B},{3,0x0128B}},{{0,0x00000},{0,0x00000},{3,0x0128E},{3,0x0128E}},
+   {{0,0x00000},{0,0x00000},{3,0x01291},{3,0x01291}},{{0,0x00000},{0,0x00000},{3,0x01294},{3,0x01294}},
+   {{0,0x00000},{0,0x00000},{3,0x01297},{3,0x01297}},{{0,0x00000},{0,0x00000},{3,0x0129A},{3,0x0129A}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{3,0x0129D},{3,0x0129D}},{{0,0x00000},{0,0x00000},{3,0x012A0},{3,0x012A0}},
+   {{0,0x00000},{0,0x00000},{3,0x012A3},{3,0x012A3}},{{0,0x00000},{0,0x00000},{3,0x012A6},{3,0x012A6}},
+   {{0,0x00000},{0,0x00000},{3,0x012A9},{3,0x012A9}},{{0,0x00000},{0,0x00000},{3,0x012AC},{3,0x012AC}},
+   {{0,0x00000},{0,0x00000},{3,0x012AC},{3,0x012AC}},{{0,0x00000},{0,0x00000},{3,0x012AF},{3,0x012AF}},
+   {{0,0x00000},{0,0x00000},{3,0x012B2},{3,0x012B2}},{{0,0x00000},{0,0x00000},{3,0x012B5},{3,0x012B5}},
+   {{0,0x00000},{0,0x00000},{3,0x012B8},{3,0x012B8}},{{0,0x00000},{0,0x00000},{3,0x012B8},{3,0x012B8}},
+   {{0,0x00000},{0,0x00000},{3,0x012BB},{3,0x012BB}},{{0,0x00000},{0,0x00000},{3,0x012BE},{3,0x012BE}},
+   {{0,0x00000},{0,0x00000},{3,0x012C1},{3,0x012C1}},{{0,0x00000},{0,0x00000},{3,0x012C4},{3,0x012C4}},
+   {{0,0x00000},{0,0x00000},{3,0x012C7},{3,0x012C7}},{{0,0x00000},{0,0x00000},{3,0x012CA},{3,0x012CA}},
+   {{0,0x00000},{0,0x00000},{3,0x012CD},{3,0x012CD}},{{0,0x00000},{0,0x00000},{3,0x012D0},{3,0x012D0}},
+   {{0,0x00000},{0,0x00000},{3,0x012D3},{3,0x012D3}},{{0,0x00000},{0,0x00000},{3,0x012D6},{3,0x012D6}},
+   {{0,0x00000},{0,0x00000},{3,0x012D9},{3,0x012D9}},{{0,0x00000},{0,0x00000},{3,0x012DC},{3,0x012DC}},
+   {{0,0x00000},{0,0x00000},{3,0x012DF},{3,0x012DF}},{{0,0x00000},{0,0x00000},{3,0x012E2},{3,0x012E2}},
+   {{0,0x00000},{0,0x00000},{3,0x012E5},{3,0x012E5}},{{0,0x00000},{0,0x00000},{3,0x012E8},{3,0x012E8}},
+   {{0,0x00000},{0,0x00000},{3,0x012EB},{3,0x012EB}},{{0,0x00000},{0,0x00000},{3,0x012EE},{3,0x012EE}},
+   {{0,0x00000},{0,0x00000},{3,0x012F1},{3,0x012F1}},{{0,0x00000},{0,0x00000},{3,0x012F4},{3,0x012F4}},
+   {{0,0x00000},{0,0x00000},{3,0x012F7},{3,0x012F7}},{{0,0x00000},{0,0x00000},{3,0x012FA},{3,0x012FA}},
+   {{0,0x00000},{0,0x00000},{3,0x01270},{3,0x01270}},{{0,0x00000},{0,0x00000},{3,0x01276},{3,0x01276}},
+   {{0,0x00000},{0,0x00000},{3,0x012FD},{3,0x012FD}},{{0,0x00000},{0,0x00000},{3,0x01300},{3,0x01300}},
+   {{0,0x00000},{0,0x00000},{3,0x01303},{3,0x01303}},{{0,0x00000},{0,0x00000},{3,0x01306},{3,0x01306}},
+   {{0,0x00000},{0,0x00000},{3,0x01309},{3,0x01309}},{{0,0x00000},{0,0x00000},{3,0x0130C},{3,0x0130C}},
+   {{0,0x00000},{0,0x00000},{3,0x01309},{3,0x01309}},{{0,0x00000},{0,0x00000},{3,0x01303},{3,0x01303}},
+   {{0,0x00000},{0,0x00000},{3,0x0130F},{3,0x0130F}},{{0,0x00000},{0,0x00000},{3,0x01312},{3,0x01312}}
+  },
+
+  /* block 132 */
+  {{{0,0x00000},{0,0x00000},{3,0x01315},{3,0x01315}},{{0,0x00000},{0,0x00000},{3,0x01318},{3,0x01318}},
+   {{0,0x00000},{0,0x00000},{3,0x0131B},{3,0x0131B}},{{0,0x00000},{0,0x00000},{3,0x0130C},{3,0x0130C}},
+   {{0,0x00000},{0,0x00000},{3,0x0125B},{3,0x0125B}},{{0,0x00000},{0,0x00000},{3,0x0123D},{3,0x0123D}},
+   {{0,0x00000},{0,0x00000},{3,0x0131E},{3,0x0131E}},{{0,0x00000},{0,0x00000},{3,0x01321},{3,0x01321}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{3,0x01324},{3,0x01324}},{{0,0x00000},{0,0x00000},{3,0x01327},{3,0x01327}},
+   {{0,0x00000},{0,0x00000},{4,0x0132A},{4,0x0132A}},{{0,0x00000},{0,0x00000},{4,0x0132E},{4,0x0132E}},
+   {{0,0x00000},{0,0x00000},{4,0x01332},{4,0x01332}},{{0,0x00000},{0,0x00000},{4,0x01336},{4,0x01336}},
+   {{0,0x00000},{0,0x00000},{4,0x0133A},{4,0x0133A}},{{0,0x00000},{0,0x00000},{4,0x0133E},{4,0x0133E}},
+   {{0,0x00000},{0,0x00000},{4,0x01342},{4,0x01342}},{{0,0x00000},{0,0x00000},{3,0x01346},{3,0x01346}},
+   {{0,0x00000},{0,0x00000},{18,0x01349},{18,0x01349}},{{0,0x00000},{0,0x00000},{8,0x0135B},{8,0x0135B}},
+   {{0,0x00000},{0,0x00000},{4,0x01363},{4,0x01363}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 133 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x0002C},{1,0x0002C}},{{0,0x00000},{0,0x00000},{1,0x03001},{1,0x03001}},
+   {{0,0x00000},{0,0x00000},{1,0x03002},{1,0x03002}},{{0,0x00000},{0,0x00000},{1,0x0003A},{1,0x0003A}},
+   {{0,0x00000},{0,0x00000},{1,0x0003B},{1,0x0003B}},{{0,0x00000},{0,0x00000},{1,0x00021},{1,0x00021}},
+   {{0,0x00000},{0,0x00000},{1,0x0003F},{1,0x0003F}},{{0,0x00000},{0,0x00000},{1,0x03016},{1,0x03016}},
+   {{0,0x00000},{0,0x00000},{1,0x03017},{1,0x03017}},{{0,0x00000},{0,0x00000},{3,0x008E2},{3,0x008E2}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{2,0x008E0},{2,0x008E0}},{{0,0x00000},{0,0x00000},{1,0x02014},{1,0x02014}},
+   {{0,0x00000},{0,0x00000},{1,0x02013},{1,0x02013}},{{0,0x00000},{0,0x00000},{1,0x0005F},{1,0x0005F}},
+   {{0,0x00000},{0,0x00000},{1,0x0005F},{1,0x0005F}},{{0,0x00000},{0,0x00000},{1,0x00028},{1,0x00028}},
+   {{0,0x00000},{0,0x00000},{1,0x00029},{1,0x00029}},{{0,0x00000},{0,0x00000},{1,0x0007B},{1,0x0007B}},
+   {{0,0x00000},{0,0x00000},{1,0x0007D},{1,0x0007D}},{{0,0x00000},{0,0x00000},{1,0x03014},{1,0x03014}},
+   {{0,0x00000},{0,0x00000},{1,0x03015},{1,0x03015}},{{0,0x00000},{0,0x00000},{1,0x03010},{1,0x03010}},
+   {{0,0x00000},{0,0x00000},{1,0x03011},{1,0x03011}},{{0,0x00000},{0,0x00000},{1,0x0300A},{1,0x0300A}},
+   {{0,0x00000},{0,0x00000},{1,0x0300B},{1,0x0300B}},{{0,0x00000},{0,0x00000},{1,0x03008},{1,0x03008}}
+  },
+
+  /* block 134 */
+  {{{0,0x00000},{0,0x00000},{1,0x03009},{1,0x03009}},{{0,0x00000},{0,0x00000},{1,0x0300C},{1,0x0300C}},
+   {{0,0x00000},{0,0x00000},{1,0x0300D},{1,0x0300D}},{{0,0x00000},{0,0x00000},{1,0x0300E},{1,0x0300E}},
+   {{0,0x00000},{0,0x00000},{1,0x0300F},{1,0x0300F}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x0005B},{1,0x0005B}},
+   {{0,0x00000},{0,0x00000},{1,0x0005D},{1,0x0005D}},{{0,0x00000},{0,0x00000},{2,0x008F1},{2,0x008F1}},
+   {{0,0x00000},{0,0x00000},{2,0x008F1},{2,0x008F1}},{{0,0x00000},{0,0x00000},{2,0x008F1},{2,0x008F1}},
+   {{0,0x00000},{0,0x00000},{2,0x008F1},{2,0x008F1}},{{0,0x00000},{0,0x00000},{1,0x0005F},{1,0x0005F}},
+   {{0,0x00000},{0,0x00000},{1,0x0005F},{1,0x0005F}},{{0,0x00000},{0,0x00000},{1,0x0005F},{1,0x0005F}},
+   {{0,0x00000},{0,0x00000},{1,0x0002C},{1,0x0002C}},{{0,0x00000},{0,0x00000},{1,0x03001},{1,0x03001}},
+   {{0,0x00000},{0,0x00000},{1,0x0002E},{1,0x0002E}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x0003B},{1,0x0003B}},{{0,0x00000},{0,0x00000},{1,0x0003A},{1,0x0003A}},
+   {{0,0x00000},{0,0x00000},{1,0x0003F},{1,0x0003F}},{{0,0x00000},{0,0x00000},{1,0x00021},{1,0x00021}},
+   {{0,0x00000},{0,0x00000},{1,0x02014},{1,0x02014}},{{0,0x00000},{0,0x00000},{1,0x00028},{1,0x00028}},
+   {{0,0x00000},{0,0x00000},{1,0x00029},{1,0x00029}},{{0,0x00000},{0,0x00000},{1,0x0007B},{1,0x0007B}},
+   {{0,0x00000},{0,0x00000},{1,0x0007D},{1,0x0007D}},{{0,0x00000},{0,0x00000},{1,0x03014},{1,0x03014}},
+   {{0,0x00000},{0,0x00000},{1,0x03015},{1,0x03015}},{{0,0x00000},{0,0x00000},{1,0x00023},{1,0x00023}},
+   {{0,0x00000},{0,0x00000},{1,0x00026},{1,0x00026}},{{0,0x00000},{0,0x00000},{1,0x0002A},{1,0x0002A}},
+   {{0,0x00000},{0,0x00000},{1,0x0002B},{1,0x0002B}},{{0,0x00000},{0,0x00000},{1,0x0002D},{1,0x0002D}},
+   {{0,0x00000},{0,0x00000},{1,0x0003C},{1,0x0003C}},{{0,0x00000},{0,0x00000},{1,0x0003E},{1,0x0003E}},
+   {{0,0x00000},{0,0x00000},{1,0x0003D},{1,0x0003D}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x0005C},{1,0x0005C}},{{0,0x00000},{0,0x00000},{1,0x00024},{1,0x00024}},
+   {{0,0x00000},{0,0x00000},{1,0x00025},{1,0x00025}},{{0,0x00000},{0,0x00000},{1,0x00040},{1,0x00040}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{2,0x01367},{2,0x01367}},{{0,0x00000},{0,0x00000},{2,0x01369},{2,0x01369}},
+   {{0,0x00000},{0,0x00000},{2,0x0136B},{2,0x0136B}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{2,0x0136D},{2,0x0136D}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{2,0x0136F},{2,0x0136F}},{{0,0x00000},{0,0x00000},{2,0x01371},{2,0x01371}},
+   {{0,0x00000},{0,0x00000},{2,0x01373},{2,0x01373}},{{0,0x00000},{0,0x00000},{2,0x01375},{2,0x01375}},
+   {{0,0x00000},{0,0x00000},{2,0x01377},{2,0x01377}},{{0,0x00000},{0,0x00000},{2,0x01379},{2,0x01379}},
+   {{0,0x00000},{0,0x00000},{2,0x0137B},{2,0x0137B}},{{0,0x00000},{0,0x00000},{2,0x0137D},{2,0x0137D}},
+   {{0,0x00000},{0,0x00000},{2,0x0137F},{2,0x0137F}},{{0,0x00000},{0,0x00000},{2,0x01381},{2,0x01381}}
+  },
+
+  /* block 135 */
+  {{{0,0x00000},{0,0x00000},{1,0x00621},{1,0x00621}},{{0,0x00000},{0,0x00000},{2,0x002F7},{2,0x002F7}},
+   {{0,0x00000},{0,0x00000},{2,0x002F7},{2,0x002F7}},{{0,0x00000},{0,0x00000},{2,0x002F9},{2,0x002F9}},
+   {{0,0x00000},{0,0x00000},{2,0x002F9},{2,0x002F9}},{{0,0x00000},{0,0x00000},{2,0x002FB},{2,0x002FB}},
+   {{0,0x00000},{0,0x00000},{2,0x002FB},{2,0x002FB}},{{0,0x00000},{0,0x00000},{2,0x002FD},{2,0x002FD}},
+   {{0,0x00000},{0,0x00000},{2,0x002FD},{2,0x002FD}},{{0,0x00000},{0,0x00000},{2,0x002FF},{2,0x002FF}},
+   {{0,0x00000},{0,0x00000},{2,0x002FF},{2,0x002FF}},{{0,0x00000},{0,0x00000},{2,0x002FF},{2,0x002FF}},
+   {{0,0x00000},{0,0x00000},{2,0x002FF},{2,0x002FF}},{{0,0x00000},{0,0x00000},{1,0x00627},{1,0x00627}},
+   {{0,0x00000},{0,0x00000},{1,0x00627},{1,0x00627}},{{0,0x00000},{0,0x00000},{1,0x00628},{1,0x00628}},
+   {{0,0x00000},{0,0x00000},{1,0x00628},{1,0x00628}},{{0,0x00000},{0,0x00000},{1,0x00628},{1,0x00628}},
+   {{0,0x00000},{0,0x00000},{1,0x00628},{1,0x00628}},{{0,0x00000},{0,0x00000},{1,0x00629},{1,0x00629}},
+   {{0,0x00000},{0,0x00000},{1,0x00629},{1,0x00629}},{{0,0x00000},{0,0x00000},{1,0x0062A},{1,0x0062A}},
+   {{0,0x00000},{0,0x00000},{1,0x0062A},{1,0x0062A}},{{0,0x00000},{0,0x00000},{1,0x0062A},{1,0x0062A}},
+   {{0,0x00000},{0,0x00000},{1,0x0062A},{1,0x0062A}},{{0,0x00000},{0,0x00000},{1,0x0062B},{1,0x0062B}},
+   {{0,0x00000},{0,0x00000},{1,0x0062B},{1,0x0062B}},{{0,0x00000},{0,0x00000},{1,0x0062B},{1,0x0062B}},
+   {{0,0x00000},{0,0x00000},{1,0x0062B},{1,0x0062B}},{{0,0x00000},{0,0x00000},{1,0x0062C},{1,0x0062C}},
+   {{0,0x00000},{0,0x00000},{1,0x0062C},{1,0x0062C}},{{0,0x00000},{0,0x00000},{1,0x0062C},{1,0x0062C}},
+   {{0,0x00000},{0,0x00000},{1,0x0062C},{1,0x0062C}},{{0,0x00000},{0,0x00000},{1,0x0062D},{1,0x0062D}},
+   {{0,0x00000},{0,0x00000},{1,0x0062D},{1,0x0062D}},{{0,0x00000},{0,0x00000},{1,0x0062D},{1,0x0062D}},
+   {{0,0x00000},{0,0x00000},{1,0x0062D},{1,0x0062D}},{{0,0x00000},{0,0x00000},{1,0x0062E},{1,0x0062E}},
+   {{0,0x00000},{0,0x00000},{1,0x0062E},{1,0x0062E}},{{0,0x00000},{0,0x00000},{1,0x0062E},{1,0x0062E}},
+   {{0,0x00000},{0,0x00000},{1,0x0062E},{1,0x0062E}},{{0,0x00000},{0,0x00000},{1,0x0062F},{1,0x0062F}},
+   {{0,0x00000},{0,0x00000},{1,0x0062F},{1,0x0062F}},{{0,0x00000},{0,0x00000},{1,0x00630},{1,0x00630}},
+   {{0,0x00000},{0,0x00000},{1,0x00630},{1,0x00630}},{{0,0x00000},{0,0x00000},{1,0x00631},{1,0x00631}},
+   {{0,0x00000},{0,0x00000},{1,0x00631},{1,0x00631}},{{0,0x00000},{0,0x00000},{1,0x00632},{1,0x00632}},
+   {{0,0x00000},{0,0x00000},{1,0x00632},{1,0x00632}},{{0,0x00000},{0,0x00000},{1,0x00633},{1,0x00633}},
+   {{0,0x00000},{0,0x00000},{1,0x00633},{1,0x00633}},{{0,0x00000},{0,0x00000},{1,0x00633},{1,0x00633}},
+   {{0,0x00000},{0,0x00000},{1,0x00633},{1,0x00633}},{{0,0x00000},{0,0x00000},{1,0x00634},{1,0x00634}},
+   {{0,0x00000},{0,0x00000},{1,0x00634},{1,0x00634}},{{0,0x00000},{0,0x00000},{1,0x00634},{1,0x00634}},
+   {{0,0x00000},{0,0x00000},{1,0x00634},{1,0x00634}},{{0,0x00000},{0,0x00000},{1,0x00635},{1,0x00635}},
+   {{0,0x00000},{0,0x00000},{1,0x00635},{1,0x00635}},{{0,0x00000},{0,0x00000},{1,0x00635},{1,0x00635}},
+   {{0,0x00000},{0,0x00000},{1,0x00635},{1,0x00635}},{{0,0x00000},{0,0x00000},{1,0x00636},{1,0x00636}},
+   {{0,0x00000},{0,0x00000},{1,0x00636},{1,0x00636}},{{0,0x00000},{0,0x00000},{1,0x00636},{1,0x00636}}
+  },
+
+  /* block 136 */
+  {{{0,0x00000},{0,0x00000},{1,0x00636},{1,0x00636}},{{0,0x00000},{0,0x00000},{1,0x00637},{1,0x00637}},
+   {{0,0x00000},{0,0x00000},{1,0x00637},{1,0x00637}},{{0,0x00000},{0,0x00000},{1,0x00637},{1,0x00637}},
+   {{0,0x00000},{0,0x00000},{1,0x00637},{1,0x00637}},{{0,0x00000},{0,0x00000},{1,0x00638},{1,0x00638}},
+   {{0,0x00000},{0,0x00000},{1,0x00638},{1,0x00638}},{{0,0x00000},{0,0x00000},{1,0x00638},{1,0x00638}},
+   {{0,0x00000},{0,0x00000},{1,0x00638},{1,0x00638}},{{0,0x00000},{0,0x00000},{1,0x00639},{1,0x00639}},
+   {{0,0x00000},{0,0x00000},{1,0x00639},{1,0x00639}},{{0,0x00000},{0,0x00000},{1,0x00639},{1,0x00639}},
+   {{0,0x00000},{0,0x00000},{1,0x00639},{1,0x00639}},{{0,0x00000},{0,0x00000},{1,0x0063A},{1,0x0063A}},
+   {{0,0x00000},{0,0x00000},{1,0x0063A},{1,0x0063A}},{{0,0x00000},{0,0x00000},{1,0x0063A},{1,0x0063A}},
+   {{0,0x00000},{0,0x00000},{1,0x0063A},{1,0x0063A}},{{0,0x00000},{0,0x00000},{1,0x00641},{1,0x00641}},
+   {{0,0x00000},{0,0x00000},{1,0x00641},{1,0x00641}},{{0,0x00000},{0,0x00000},{1,0x00641},{1,0x00641}},
+   {{0,0x00000},{0,0x00000},{1,0x00641},{1,0x00641}},{{0,0x00000},{0,0x00000},{1,0x00642},{1,0x00642}},
+   {{0,0x00000},{0,0x00000},{1,0x00642},{1,0x00642}},{{0,0x00000},{0,0x00000},{1,0x00642},{1,0x00642}},
+   {{0,0x00000},{0,0x00000},{1,0x00642},{1,0x00642}},{{0,0x00000},{0,0x00000},{1,0x00643},{1,0x00643}},
+   {{0,0x00000},{0,0x00000},{1,0x00643},{1,0x00643}},{{0,0x00000},{0,0x00000},{1,0x00643},{1,0x00643}},
+   {{0,0x00000},{0,0x00000},{1,0x00643},{1,0x00643}},{{0,0x00000},{0,0x00000},{1,0x00644},{1,0x00644}},
+   {{0,0x00000},{0,0x00000},{1,0x00644},{1,0x00644}},{{0,0x00000},{0,0x00000},{1,0x00644},{1,0x00644}},
+   {{0,0x00000},{0,0x00000},{1,0x00644},{1,0x00644}},{{0,0x00000},{0,0x00000},{1,0x00645},{1,0x00645}},
+   {{0,0x00000},{0,0x00000},{1,0x00645},{1,0x00645}},{{0,0x00000},{0,0x00000},{1,0x00645},{1,0x00645}},
+   {{0,0x00000},{0,0x00000},{1,0x00645},{1,0x00645}},{{0,0x00000},{0,0x00000},{1,0x00646},{1,0x00646}},
+   {{0,0x00000},{0,0x00000},{1,0x00646},{1,0x00646}},{{0,0x00000},{0,0x00000},{1,0x00646},{1,0x00646}},
+   {{0,0x00000},{0,0x00000},{1,0x00646},{1,0x00646}},{{0,0x00000},{0,0x00000},{1,0x00647},{1,0x00647}},
+   {{0,0x00000},{0,0x00000},{1,0x00647},{1,0x00647}},{{0,0x00000},{0,0x00000},{1,0x00647},{1,0x00647}},
+   {{0,0x00000},{0,0x00000},{1,0x00647},{1,0x00647}},{{0,0x00000},{0,0x00000},{1,0x00648},{1,0x00648}},
+   {{0,0x00000},{0,0x00000},{1,0x00648},{1,0x00648}},{{0,0x00000},{0,0x00000},{1,0x00649},{1,0x00649}},
+   {{0,0x00000},{0,0x00000},{1,0x00649},{1,0x00649}},{{0,0x00000},{0,0x00000},{1,0x0064A},{1,0x0064A}},
+   {{0,0x00000},{0,0x00000},{1,0x0064A},{1,0x0064A}},{{0,0x00000},{0,0x00000},{1,0x0064A},{1,0x0064A}},
+   {{0,0x00000},{0,0x00000},{1,0x0064A},{1,0x0064A}},{{0,0x00000},{0,0x00000},{3,0x01383},{3,0x01383}},
+   {{0,0x00000},{0,0x00000},{3,0x01383},{3,0x01383}},{{0,0x00000},{0,0x00000},{3,0x01386},{3,0x01386}},
+   {{0,0x00000},{0,0x00000},{3,0x01386},{3,0x01386}},{{0,0x00000},{0,0x00000},{3,0x01389},{3,0x01389}},
+   {{0,0x00000},{0,0x00000},{3,0x01389},{3,0x01389}},{{0,0x00000},{0,0x00000},{2,0x0138C},{2,0x0138C}},
+   {{0,0x00000},{0,0x00000},{2,0x0138C},{2,0x0138C}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 137 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x00021},{1,0x00021}},
+   {{0,0x00000},{0,0x00000},{1,0x00022},{1,0x00022}},{{0,0x00000},{0,0x00000},{1,0x00023},{1,0x00023}},
+   {{0,0x00000},{0,0x00000},{1,0x00024},{1,0x00024}},{{0,0x00000},{0,0x00000},{1,0x00025},{1,0x00025}},
+   {{0,0x00000},{0,0x00000},{1,0x00026},{1,0x00026}},{{0,0x00000},{0,0x00000},{1,0x00027},{1,0x00027}},
+   {{0,0x00000},{0,0x00000},{1,0x00028},{1,0x00028}},{{0,0x00000},{0,0x00000},{1,0x00029},{1,0x00029}},
+   {{0,0x00000},{0,0x00000},{1,0x0002A},{1,0x0002A}},{{0,0x00000},{0,0x00000},{1,0x0002B},{1,0x0002B}},
+   {{0,0x00000},{0,0x00000},{1,0x0002C},{1,0x0002C}},{{0,0x00000},{0,0x00000},{1,0x0002D},{1,0x0002D}},
+   {{0,0x00000},{0,0x00000},{1,0x0002E},{1,0x0002E}},{{0,0x00000},{0,0x00000},{1,0x0002F},{1,0x0002F}},
+   {{0,0x00000},{0,0x00000},{1,0x00030},{1,0x00030}},{{0,0x00000},{0,0x00000},{1,0x00031},{1,0x00031}},
+   {{0,0x00000},{0,0x00000},{1,0x00032},{1,0x00032}},{{0,0x00000},{0,0x00000},{1,0x00033},{1,0x00033}},
+   {{0,0x00000},{0,0x00000},{1,0x00034},{1,0x00034}},{{0,0x00000},{0,0x00000},{1,0x00035},{1,0x00035}},
+   {{0,0x00000},{0,0x00000},{1,0x00036},{1,0x00036}},{{0,0x00000},{0,0x00000},{1,0x00037},{1,0x00037}},
+   {{0,0x00000},{0,0x00000},{1,0x00038},{1,0x00038}},{{0,0x00000},{0,0x00000},{1,0x00039},{1,0x00039}},
+   {{0,0x00000},{0,0x00000},{1,0x0003A},{1,0x0003A}},{{0,0x00000},{0,0x00000},{1,0x0003B},{1,0x0003B}},
+   {{0,0x00000},{0,0x00000},{1,0x0003C},{1,0x0003C}},{{0,0x00000},{0,0x00000},{1,0x0003D},{1,0x0003D}},
+   {{0,0x00000},{0,0x00000},{1,0x0003E},{1,0x0003E}},{{0,0x00000},{0,0x00000},{1,0x0003F},{1,0x0003F}},
+   {{0,0x00000},{0,0x00000},{1,0x00040},{1,0x00040}},{{0,0x00000},{1,0x0FF41},{1,0x00041},{1,0x00061}},
+   {{0,0x00000},{1,0x0FF42},{1,0x00042},{1,0x00062}},{{0,0x00000},{1,0x0FF43},{1,0x00043},{1,0x00063}},
+   {{0,0x00000},{1,0x0FF44},{1,0x00044},{1,0x00064}},{{0,0x00000},{1,0x0FF45},{1,0x00045},{1,0x00065}},
+   {{0,0x00000},{1,0x0FF46},{1,0x00046},{1,0x00066}},{{0,0x00000},{1,0x0FF47},{1,0x00047},{1,0x00067}},
+   {{0,0x00000},{1,0x0FF48},{1,0x00048},{1,0x00068}},{{0,0x00000},{1,0x0FF49},{1,0x00049},{1,0x00069}},
+   {{0,0x00000},{1,0x0FF4A},{1,0x0004A},{1,0x0006A}},{{0,0x00000},{1,0x0FF4B},{1,0x0004B},{1,0x0006B}},
+   {{0,0x00000},{1,0x0FF4C},{1,0x0004C},{1,0x0006C}},{{0,0x00000},{1,0x0FF4D},{1,0x0004D},{1,0x0006D}},
+   {{0,0x00000},{1,0x0FF4E},{1,0x0004E},{1,0x0006E}},{{0,0x00000},{1,0x0FF4F},{1,0x0004F},{1,0x0006F}},
+   {{0,0x00000},{1,0x0FF50},{1,0x00050},{1,0x00070}},{{0,0x00000},{1,0x0FF51},{1,0x00051},{1,0x00071}},
+   {{0,0x00000},{1,0x0FF52},{1,0x00052},{1,0x00072}},{{0,0x00000},{1,0x0FF53},{1,0x00053},{1,0x00073}},
+   {{0,0x00000},{1,0x0FF54},{1,0x00054},{1,0x00074}},{{0,0x00000},{1,0x0FF55},{1,0x00055},{1,0x00075}},
+   {{0,0x00000},{1,0x0FF56},{1,0x00056},{1,0x00076}},{{0,0x00000},{1,0x0FF57},{1,0x00057},{1,0x00077}},
+   {{0,0x00000},{1,0x0FF58},{1,0x00058},{1,0x00078}},{{0,0x00000},{1,0x0FF59},{1,0x00059},{1,0x00079}},
+   {{0,0x00000},{1,0x0FF5A},{1,0x0005A},{1,0x0007A}},{{0,0x00000},{0,0x00000},{1,0x0005B},{1,0x0005B}},
+   {{0,0x00000},{0,0x00000},{1,0x0005C},{1,0x0005C}},{{0,0x00000},{0,0x00000},{1,0x0005D},{1,0x0005D}},
+   {{0,0x00000},{0,0x00000},{1,0x0005E},{1,0x0005E}},{{0,0x00000},{0,0x00000},{1,0x0005F},{1,0x0005F}}
+  },
+
+  /* block 138 */
+  {{{0,0x00000},{0,0x00000},{1,0x00060},{1,0x00060}},{{0,0x00000},{0,0x00000},{1,0x00061},{1,0x00061}},
+   {{0,0x00000},{0,0x00000},{1,0x00062},{1,0x00062}},{{0,0x00000},{0,0x00000},{1,0x00063},{1,0x00063}},
+   {{0,0x00000},{0,0x00000},{1,0x00064},{1,0x00064}},{{0,0x00000},{0,0x00000},{1,0x00065},{1,0x00065}},
+   {{0,0x00000},{0,0x00000},{1,0x00066},{1,0x00066}},{{0,0x00000},{0,0x00000},{1,0x00067},{1,0x00067}},
+   {{0,0x00000},{0,0x00000},{1,0x00068},{1,0x00068}},{{0,0x00000},{0,0x00000},{1,0x00069},{1,0x00069}},
+   {{0,0x00000},{0,0x00000},{1,0x0006A},{1,0x0006A}},{{0,0x00000},{0,0x00000},{1,0x0006B},{1,0x0006B}},
+   {{0,0x00000},{0,0x00000},{1,0x0006C},{1,0x0006C}},{{0,0x00000},{0,0x00000},{1,0x0006D},{1,0x0006D}},
+   {{0,0x00000},{0,0x00000},{1,0x0006E},{1,0x0006E}},{{0,0x00000},{0,0x00000},{1,0x0006F},{1,0x0006F}},
+   {{0,0x00000},{0,0x00000},{1,0x00070},{1,0x00070}},{{0,0x00000},{0,0x00000},{1,0x00071},{1,0x00071}},
+   {{0,0x00000},{0,0x00000},{1,0x00072},{1,0x00072}},{{0,0x00000},{0,0x00000},{1,0x00073},{1,0x00073}},
+   {{0,0x00000},{0,0x00000},{1,0x00074},{1,0x00074}},{{0,0x00000},{0,0x00000},{1,0x00075},{1,0x00075}},
+   {{0,0x00000},{0,0x00000},{1,0x00076},{1,0x00076}},{{0,0x00000},{0,0x00000},{1,0x00077},{1,0x00077}},
+   {{0,0x00000},{0,0x00000},{1,0x00078},{1,0x00078}},{{0,0x00000},{0,0x00000},{1,0x00079},{1,0x00079}},
+   {{0,0x00000},{0,0x00000},{1,0x0007A},{1,0x0007A}},{{0,0x00000},{0,0x00000},{1,0x0007B},{1,0x0007B}},
+   {{0,0x00000},{0,0x00000},{1,0x0007C},{1,0x0007C}},{{0,0x00000},{0,0x00000},{1,0x0007D},{1,0x0007D}},
+   {{0,0x00000},{0,0x00000},{1,0x0007E},{1,0x0007E}},{{0,0x00000},{0,0x00000},{1,0x02985},{1,0x02985}},
+   {{0,0x00000},{0,0x00000},{1,0x02986},{1,0x02986}},{{0,0x00000},{0,0x00000},{1,0x03002},{1,0x03002}},
+   {{0,0x00000},{0,0x00000},{1,0x0300C},{1,0x0300C}},{{0,0x00000},{0,0x00000},{1,0x0300D},{1,0x0300D}},
+   {{0,0x00000},{0,0x00000},{1,0x03001},{1,0x03001}},{{0,0x00000},{0,0x00000},{1,0x030FB},{1,0x030FB}},
+   {{0,0x00000},{0,0x00000},{1,0x030F2},{1,0x030F2}},{{0,0x00000},{0,0x00000},{1,0x030A1},{1,0x030A1}},
+   {{0,0x00000},{0,0x00000},{1,0x030A3},{1,0x030A3}},{{0,0x00000},{0,0x00000},{1,0x030A5},{1,0x030A5}},
+   {{0,0x00000},{0,0x00000},{1,0x030A7},{1,0x030A7}},{{0,0x00000},{0,0x00000},{1,0x030A9},{1,0x030A9}},
+   {{0,0x00000},{0,0x00000},{1,0x030E3},{1,0x030E3}},{{0,0x00000},{0,0x00000},{1,0x030E5},{1,0x030E5}},
+   {{0,0x00000},{0,0x00000},{1,0x030E7},{1,0x030E7}},{{0,0x00000},{0,0x00000},{1,0x030C3},{1,0x030C3}},
+   {{0,0x00000},{0,0x00000},{1,0x030FC},{1,0x030FC}},{{0,0x00000},{0,0x00000},{1,0x030A2},{1,0x030A2}},
+   {{0,0x00000},{0,0x00000},{1,0x030A4},{1,0x030A4}},{{0,0x00000},{0,0x00000},{1,0x030A6},{1,0x030A6}},
+   {{0,0x00000},{0,0x00000},{1,0x030A8},{1,0x030A8}},{{0,0x00000},{0,0x00000},{1,0x030AA},{1,0x030AA}},
+   {{0,0x00000},{0,0x00000},{1,0x030AB},{1,0x030AB}},{{0,0x00000},{0,0x00000},{1,0x030AD},{1,0x030AD}},
+   {{0,0x00000},{0,0x00000},{1,0x030AF},{1,0x030AF}},{{0,0x00000},{0,0x00000},{1,0x030B1},{1,0x030B1}},
+   {{0,0x00000},{0,0x00000},{1,0x030B3},{1,0x030B3}},{{0,0x00000},{0,0x00000},{1,0x030B5},{1,0x030B5}},
+   {{0,0x00000},{0,0x00000},{1,0x030B7},{1,0x030B7}},{{0,0x00000},{0,0x00000},{1,0x030B9},{1,0x030B9}},
+   {{0,0x00000},{0,0x00000},{1,0x030BB},{1,0x030BB}},{{0,0x00000},{0,0x00000},{1,0x030BD},{1,0x030BD}}
+  },
+
+  /* block 139 */
+  {{{0,0x00000},{0,0x00000},{1,0x030BF},{1,0x030BF}},{{0,0x00000},{0,0x00000},{1,0x030C1},{1,0x030C1}},
+   {{0,0x00000},{0,0x00000},{1,0x030C4},{1,0x030C4}},{{0,0x00000},{0,0x00000},{1,0x030C6},{1,0x030C6}},
+   {{0,0x00000},{0,0x00000},{1,0x030C8},{1,0x030C8}},{{0,0x00000},{0,0x00000},{1,0x030CA},{1,0x030CA}},
+   {{0,0x00000},{0,0x00000},{1,0x030CB},{1,0x030CB}},{{0,0x00000},{0,0x00000},{1,0x030CC},{1,0x030CC}},
+   {{0,0x00000},{0,0x00000},{1,0x030CD},{1,0x030CD}},{{0,0x00000},{0,0x00000},{1,0x030CE},{1,0x030CE}},
+   {{0,0x00000},{0,0x00000},{1,0x030CF},{1,0x030CF}},{{0,0x00000},{0,0x00000},{1,0x030D2},{1,0x030D2}},
+   {{0,0x00000},{0,0x00000},{1,0x030D5},{1,0x030D5}},{{0,0x00000},{0,0x00000},{1,0x030D8},{1,0x030D8}},
+   {{0,0x00000},{0,0x00000},{1,0x030DB},{1,0x030DB}},{{0,0x00000},{0,0x00000},{1,0x030DE},{1,0x030DE}},
+   {{0,0x00000},{0,0x00000},{1,0x030DF},{1,0x030DF}},{{0,0x00000},{0,0x00000},{1,0x030E0},{1,0x030E0}},
+   {{0,0x00000},{0,0x00000},{1,0x030E1},{1,0x030E1}},{{0,0x00000},{0,0x00000},{1,0x030E2},{1,0x030E2}},
+   {{0,0x00000},{0,0x00000},{1,0x030E4},{1,0x030E4}},{{0,0x00000},{0,0x00000},{1,0x030E6},{1,0x030E6}},
+   {{0,0x00000},{0,0x00000},{1,0x030E8},{1,0x030E8}},{{0,0x00000},{0,0x00000},{1,0x030E9},{1,0x030E9}},
+   {{0,0x00000},{0,0x00000},{1,0x030EA},{1,0x030EA}},{{0,0x00000},{0,0x00000},{1,0x030EB},{1,0x030EB}},
+   {{0,0x00000},{0,0x00000},{1,0x030EC},{1,0x030EC}},{{0,0x00000},{0,0x00000},{1,0x030ED},{1,0x030ED}},
+   {{0,0x00000},{0,0x00000},{1,0x030EF},{1,0x030EF}},{{0,0x00000},{0,0x00000},{1,0x030F3},{1,0x030F3}},
+   {{0,0x00000},{0,0x00000},{1,0x03099},{1,0x03099}},{{0,0x00000},{0,0x00000},{1,0x0309A},{1,0x0309A}},
+   {{0,0x00000},{0,0x00000},{1,0x01160},{1,0x01160}},{{0,0x00000},{0,0x00000},{1,0x01100},{1,0x01100}},
+   {{0,0x00000},{0,0x00000},{1,0x01101},{1,0x01101}},{{0,0x00000},{0,0x00000},{1,0x011AA},{1,0x011AA}},
+   {{0,0x00000},{0,0x00000},{1,0x01102},{1,0x01102}},{{0,0x00000},{0,0x00000},{1,0x011AC},{1,0x011AC}},
+   {{0,0x00000},{0,0x00000},{1,0x011AD},{1,0x011AD}},{{0,0x00000},{0,0x00000},{1,0x01103},{1,0x01103}},
+   {{0,0x00000},{0,0x00000},{1,0x01104},{1,0x01104}},{{0,0x00000},{0,0x00000},{1,0x01105},{1,0x01105}},
+   {{0,0x00000},{0,0x00000},{1,0x011B0},{1,0x011B0}},{{0,0x00000},{0,0x00000},{1,0x011B1},{1,0x011B1}},
+   {{0,0x00000},{0,0x00000},{1,0x011B2},{1,0x011B2}},{{0,0x00000},{0,0x00000},{1,0x011B3},{1,0x011B3}},
+   {{0,0x00000},{0,0x00000},{1,0x011B4},{1,0x011B4}},{{0,0x00000},{0,0x00000},{1,0x011B5},{1,0x011B5}},
+   {{0,0x00000},{0,0x00000},{1,0x0111A},{1,0x0111A}},{{0,0x00000},{0,0x00000},{1,0x01106},{1,0x01106}},
+   {{0,0x00000},{0,0x00000},{1,0x01107},{1,0x01107}},{{0,0x00000},{0,0x00000},{1,0x01108},{1,0x01108}},
+   {{0,0x00000},{0,0x00000},{1,0x01121},{1,0x01121}},{{0,0x00000},{0,0x00000},{1,0x01109},{1,0x01109}},
+   {{0,0x00000},{0,0x00000},{1,0x0110A},{1,0x0110A}},{{0,0x00000},{0,0x00000},{1,0x0110B},{1,0x0110B}},
+   {{0,0x00000},{0,0x00000},{1,0x0110C},{1,0x0110C}},{{0,0x00000},{0,0x00000},{1,0x0110D},{1,0x0110D}},
+   {{0,0x00000},{0,0x00000},{1,0x0110E},{1,0x0110E}},{{0,0x00000},{0,0x00000},{1,0x0110F},{1,0x0110F}},
+   {{0,0x00000},{0,0x00000},{1,0x01110},{1,0x01110}},{{0,0x00000},{0,0x00000},{1,0x01111},{1,0x01111}},
+   {{0,0x00000},{0,0x00000},{1,0x01112},{1,0x01112}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 140 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x01161},{1,0x01161}},{{0,0x00000},{0,0x00000},{1,0x01162},{1,0x01162}},
+   {{0,0x00000},{0,0x00000},{1,0x01163},{1,0x01163}},{{0,0x00000},{0,0x00000},{1,0x01164},{1,0x01164}},
+   {{0,0x00000},{0,0x00000},{1,0x01165},{1,0x01165}},{{0,0x00000},{0,0x00000},{1,0x01166},{1,0x01166}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x01167},{1,0x01167}},{{0,0x00000},{0,0x00000},{1,0x01168},{1,0x01168}},
+   {{0,0x00000},{0,0x00000},{1,0x01169},{1,0x01169}},{{0,0x00000},{0,0x00000},{1,0x0116A},{1,0x0116A}},
+   {{0,0x00000},{0,0x00000},{1,0x0116B},{1,0x0116B}},{{0,0x00000},{0,0x00000},{1,0x0116C},{1,0x0116C}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x0116D},{1,0x0116D}},{{0,0x00000},{0,0x00000},{1,0x0116E},{1,0x0116E}},
+   {{0,0x00000},{0,0x00000},{1,0x0116F},{1,0x0116F}},{{0,0x00000},{0,0x00000},{1,0x01170},{1,0x01170}},
+   {{0,0x00000},{0,0x00000},{1,0x01171},{1,0x01171}},{{0,0x00000},{0,0x00000},{1,0x01172},{1,0x01172}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x01173},{1,0x01173}},{{0,0x00000},{0,0x00000},{1,0x01174},{1,0x01174}},
+   {{0,0x00000},{0,0x00000},{1,0x01175},{1,0x01175}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x000A2},{1,0x000A2}},{{0,0x00000},{0,0x00000},{1,0x000A3},{1,0x000A3}},
+   {{0,0x00000},{0,0x00000},{1,0x000AC},{1,0x000AC}},{{0,0x00000},{0,0x00000},{2,0x00002},{2,0x00002}},
+   {{0,0x00000},{0,0x00000},{1,0x000A6},{1,0x000A6}},{{0,0x00000},{0,0x00000},{1,0x000A5},{1,0x000A5}},
+   {{0,0x00000},{0,0x00000},{1,0x020A9},{1,0x020A9}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x02502},{1,0x02502}},{{0,0x00000},{0,0x00000},{1,0x02190},{1,0x02190}},
+   {{0,0x00000},{0,0x00000},{1,0x02191},{1,0x02191}},{{0,0x00000},{0,0x00000},{1,0x02192},{1,0x02192}},
+   {{0,0x00000},{0,0x00000},{1,0x02193},{1,0x02193}},{{0,0x00000},{0,0x00000},{1,0x025A0},{1,0x025A0}},
+   {{0,0x00000},{0,0x00000},{1,0x025CB},{1,0x025CB}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 141 */
+  {{{0,0x00000},{1,0x10428},{0,0x00000},{1,0x10428}},{{0,0x00000},{1,0x10429},{0,0x00000},{1,0x10429}},
+   {{0,0x00000},{1,0x1042A},{0,0x00000},{1,0x1042A}},{{0,0x00000},{1,0x1042B},{0,0x00000},{1,0x1042B}},
+   {{0,0x00000},{1,0x1042C},{0,0x00000},{1,0x1042C}},{{0,0x00000},{1,0x1042D},{0,0x00000},{1,0x1042D}},
+   {{0,0x00000},{1,0x1042E},{0,0x00000},{1,0x1042E}},{{0,0x00000},{1,0x1042F},{0,0x00000},{1,0x1042F}},
+   {{0,0x00000},{1,0x10430},{0,0x00000},{1,0x10430}},{{0,0x00000},{1,0x10431},{0,0x00000},{1,0x10431}},
+   {{0,0x00000},{1,0x10432},{0,0x00000},{1,0x10432}},{{0,0x00000},{1,0x10433},{0,0x00000},{1,0x10433}},
+   {{0,0x00000},{1,0x10434},{0,0x00000},{1,0x10434}},{{0,0x00000},{1,0x10435},{0,0x00000},{1,0x10435}},
+   {{0,0x00000},{1,0x10436},{0,0x00000},{1,0x10436}},{{0,0x00000},{1,0x10437},{0,0x00000},{1,0x10437}},
+   {{0,0x00000},{1,0x10438},{0,0x00000},{1,0x10438}},{{0,0x00000},{1,0x10439},{0,0x00000},{1,0x10439}},
+   {{0,0x00000},{1,0x1043A},{0,0x00000},{1,0x1043A}},{{0,0x00000},{1,0x1043B},{0,0x00000},{1,0x1043B}},
+   {{0,0x00000},{1,0x1043C},{0,0x00000},{1,0x1043C}},{{0,0x00000},{1,0x1043D},{0,0x00000},{1,0x1043D}},
+   {{0,0x00000},{1,0x1043E},{0,0x00000},{1,0x1043E}},{{0,0x00000},{1,0x1043F},{0,0x00000},{1,0x1043F}},
+   {{0,0x00000},{1,0x10440},{0,0x00000},{1,0x10440}},{{0,0x00000},{1,0x10441},{0,0x00000},{1,0x10441}},
+   {{0,0x00000},{1,0x10442},{0,0x00000},{1,0x10442}},{{0,0x00000},{1,0x10443},{0,0x00000},{1,0x10443}},
+   {{0,0x00000},{1,0x10444},{0,0x00000},{1,0x10444}},{{0,0x00000},{1,0x10445},{0,0x00000},{1,0x10445}},
+   {{0,0x00000},{1,0x10446},{0,0x00000},{1,0x10446}},{{0,0x00000},{1,0x10447},{0,0x00000},{1,0x10447}},
+   {{0,0x00000},{1,0x10448},{0,0x00000},{1,0x10448}},{{0,0x00000},{1,0x10449},{0,0x00000},{1,0x10449}},
+   {{0,0x00000},{1,0x1044A},{0,0x00000},{1,0x1044A}},{{0,0x00000},{1,0x1044B},{0,0x00000},{1,0x1044B}},
+   {{0,0x00000},{1,0x1044C},{0,0x00000},{1,0x1044C}},{{0,0x00000},{1,0x1044D},{0,0x00000},{1,0x1044D}},
+   {{0,0x00000},{1,0x1044E},{0,0x00000},{1,0x1044E}},{{0,0x00000},{1,0x1044F},{0,0x00000},{1,0x1044F}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 142 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x104D8},{0,0x00000},{1,0x104D8}},{{0,0x00000},{1,0x104D9},{0,0x00000},{1,0x104D9}},
+   {{0,0x00000},{1,0x104DA},{0,0x00000},{1,0x104DA}},{{0,0x00000},{1,0x104DB},{0,0x00000},{1,0x104DB}},
+   {{0,0x00000},{1,0x104DC},{0,0x00000},{1,0x104DC}},{{0,0x00000},{1,0x104DD},{0,0x00000},{1,0x104DD}},
+   {{0,0x00000},{1,0x104DE},{0,0x00000},{1,0x104DE}},{{0,0x00000},{1,0x104DF},{0,0x00000},{1,0x104DF}},
+   {{0,0x00000},{1,0x104E0},{0,0x00000},{1,0x104E0}},{{0,0x00000},{1,0x104E1},{0,0x00000},{1,0x104E1}},
+   {{0,0x00000},{1,0x104E2},{0,0x00000},{1,0x104E2}},{{0,0x00000},{1,0x104E3},{0,0x00000},{1,0x104E3}},
+   {{0,0x00000},{1,0x104E4},{0,0x00000},{1,0x104E4}},{{0,0x00000},{1,0x104E5},{0,0x00000},{1,0x104E5}},
+   {{0,0x00000},{1,0x104E6},{0,0x00000},{1,0x104E6}},{{0,0x00000},{1,0x104E7},{0,0x00000},{1,0x104E7}}
+  },
+
+  /* block 143 */
+  {{{0,0x00000},{1,0x104E8},{0,0x00000},{1,0x104E8}},{{0,0x00000},{1,0x104E9},{0,0x00000},{1,0x104E9}},
+   {{0,0x00000},{1,0x104EA},{0,0x00000},{1,0x104EA}},{{0,0x00000},{1,0x104EB},{0,0x00000},{1,0x104EB}},
+   {{0,0x00000},{1,0x104EC},{0,0x00000},{1,0x104EC}},{{0,0x00000},{1,0x104ED},{0,0x00000},{1,0x104ED}},
+   {{0,0x00000},{1,0x104EE},{0,0x00000},{1,0x104EE}},{{0,0x00000},{1,0x104EF},{0,0x00000},{1,0x104EF}},
+   {{0,0x00000},{1,0x104F0},{0,0x00000},{1,0x104F0}},{{0,0x00000},{1,0x104F1},{0,0x00000},{1,0x104F1}},
+   {{0,0x00000},{1,0x104F2},{0,0x00000},{1,0x104F2}},{{0,0x00000},{1,0x104F3},{0,0x00000},{1,0x104F3}},
+   {{0,0x00000},{1,0x104F4},{0,0x00000},{1,0x104F4}},{{0,0x00000},{1,0x104F5},{0,0x00000},{1,0x104F5}},
+   {{0,0x00000},{1,0x104F6},{0,0x00000},{1,0x104F6}},{{0,0x00000},{1,0x104F7},{0,0x00000},{1,0x104F7}},
+   {{0,0x00000},{1,0x104F8},{0,0x00000},{1,0x104F8}},{{0,0x00000},{1,0x104F9},{0,0x00000},{1,0x104F9}},
+   {{0,0x00000},{1,0x104FA},{0,0x00000},{1,0x104FA}},{{0,0x00000},{1,0x104FB},{0,0x00000},{1,0x104FB}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 144 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x10597},{0,0x00000},{1,0x10597}},{{0,0x00000},{1,0x10598},{0,0x00000},{1,0x10598}},
+   {{0,0x00000},{1,0x10599},{0,0x00000},{1,0x10599}},{{0,0x00000},{1,0x1059A},{0,0x00000},{1,0x1059A}},
+   {{0,0x00000},{1,0x1059B},{0,0x00000},{1,0x1059B}},{{0,0x00000},{1,0x1059C},{0,0x00000},{1,0x1059C}},
+   {{0,0x00000},{1,0x1059D},{0,0x00000},{1,0x1059D}},{{0,0x00000},{1,0x1059E},{0,0x00000},{1,0x1059E}},
+   {{0,0x00000},{1,0x1059F},{0,0x00000},{1,0x1059F}},{{0,0x00000},{1,0x105A0},{0,0x00000},{1,0x105A0}},
+   {{0,0x00000},{1,0x105A1},{0,0x00000},{1,0x105A1}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x105A3},{0,0x00000},{1,0x105A3}},{{0,0x00000},{1,0x105A4},{0,0x00000},{1,0x105A4}},
+   {{0,0x00000},{1,0x105A5},{0,0x00000},{1,0x105A5}},{{0,0x00000},{1,0x105A6},{0,0x00000},{1,0x105A6}}
+  },
+
+  /* block 145 */
+  {{{0,0x00000},{1,0x105A7},{0,0x00000},{1,0x105A7}},{{0,0x00000},{1,0x105A8},{0,0x00000},{1,0x105A8}},
+   {{0,0x00000},{1,0x105A9},{0,0x00000},{1,0x105A9}},{{0,0x00000},{1,0x105AA},{0,0x00000},{1,0x105AA}},
+   {{0,0x00000},{1,0x105AB},{0,0x00000},{1,0x105AB}},{{0,0x00000},{1,0x105AC},{0,0x00000},{1,0x105AC}},
+   {{0,0x00000},{1,0x105AD},{0,0x00000},{1,0x105AD}},{{0,0x00000},{1,0x105AE},{0,0x00000},{1,0x105AE}},
+   {{0,0x00000},{1,0x105AF},{0,0x00000},{1,0x105AF}},{{0,0x00000},{1,0x105B0},{0,0x00000},{1,0x105B0}},
+   {{0,0x00000},{1,0x105B1},{0,0x00000},{1,0x105B1}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x105B3},{0,0x00000},{1,0x105B3}},{{0,0x00000},{1,0x105B4},{0,0x00000},{1,0x105B4}},
+   {{0,0x00000},{1,0x105B5},{0,0x00000},{1,0x105B5}},{{0,0x00000},{1,0x105B6},{0,0x00000},{1,0x105B6}},
+   {{0,0x00000},{1,0x105B7},{0,0x00000},{1,0x105B7}},{{0,0x00000},{1,0x105B8},{0,0x00000},{1,0x105B8}},
+   {{0,0x00000},{1,0x105B9},{0,0x00000},{1,0x105B9}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x105BB},{0,0x00000},{1,0x105BB}},{{0,0x00000},{1,0x105BC},{0,0x00000},{1,0x105BC}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 146 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x002D0},{1,0x002D0}},
+   {{0,0x00000},{0,0x00000},{1,0x002D1},{1,0x002D1}},{{0,0x00000},{0,0x00000},{1,0x000E6},{1,0x000E6}},
+   {{0,0x00000},{0,0x00000},{1,0x00299},{1,0x00299}},{{0,0x00000},{0,0x00000},{1,0x00253},{1,0x00253}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x002A3},{1,0x002A3}},
+   {{0,0x00000},{0,0x00000},{1,0x0AB66},{1,0x0AB66}},{{0,0x00000},{0,0x00000},{1,0x002A5},{1,0x002A5}},
+   {{0,0x00000},{0,0x00000},{1,0x002A4},{1,0x002A4}},{{0,0x00000},{0,0x00000},{1,0x00256},{1,0x00256}},
+   {{0,0x00000},{0,0x00000},{1,0x00257},{1,0x00257}},{{0,0x00000},{0,0x00000},{1,0x01D91},{1,0x01D91}},
+   {{0,0x00000},{0,0x00000},{1,0x00258},{1,0x00258}},{{0,0x00000},{0,0x00000},{1,0x0025E},{1,0x0025E}},
+   {{0,0x00000},{0,0x00000},{1,0x002A9},{1,0x002A9}},{{0,0x00000},{0,0x00000},{1,0x00264},{1,0x00264}},
+   {{0,0x00000},{0,0x00000},{1,0x00262},{1,0x00262}},{{0,0x00000},{0,0x00000},{1,0x00260},{1,0x00260}},
+   {{0,0x00000},{0,0x00000},{1,0x0029B},{1,0x0029B}},{{0,0x00000},{0,0x00000},{1,0x00127},{1,0x00127}},
+   {{0,0x00000},{0,0x00000},{1,0x0029C},{1,0x0029C}},{{0,0x00000},{0,0x00000},{1,0x00267},{1,0x00267}},
+   {{0,0x00000},{0,0x00000},{1,0x00284},{1,0x00284}},{{0,0x00000},{0,0x00000},{1,0x002AA},{1,0x002AA}},
+   {{0,0x00000},{0,0x00000},{1,0x002AB},{1,0x002AB}},{{0,0x00000},{0,0x00000},{1,0x0026C},{1,0x0026C}},
+   {{0,0x00000},{0,0x00000},{1,0x1DF04},{1,0x1DF04}},{{0,0x00000},{0,0x00000},{1,0x0A78E},{1,0x0A78E}},
+   {{0,0x00000},{0,0x00000},{1,0x0026E},{1,0x0026E}},{{0,0x00000},{0,0x00000},{1,0x1DF05},{1,0x1DF05}},
+   {{0,0x00000},{0,0x00000},{1,0x0028E},{1,0x0028E}},{{0,0x00000},{0,0x00000},{1,0x1DF06},{1,0x1DF06}},
+   {{0,0x00000},{0,0x00000},{1,0x000F8},{1,0x000F8}},{{0,0x00000},{0,0x00000},{1,0x00276},{1,0x00276}},
+   {{0,0x00000},{0,0x00000},{1,0x00277},{1,0x00277}},{{0,0x00000},{0,0x00000},{1,0x00071},{1,0x00071}},
+   {{0,0x00000},{0,0x00000},{1,0x0027A},{1,0x0027A}},{{0,0x00000},{0,0x00000},{1,0x1DF08},{1,0x1DF08}},
+   {{0,0x00000},{0,0x00000},{1,0x0027D},{1,0x0027D}},{{0,0x00000},{0,0x00000},{1,0x0027E},{1,0x0027E}},
+   {{0,0x00000},{0,0x00000},{1,0x00280},{1,0x00280}},{{0,0x00000},{0,0x00000},{1,0x002A8},{1,0x002A8}},
+   {{0,0x00000},{0,0x00000},{1,0x002A6},{1,0x002A6}},{{0,0x00000},{0,0x00000},{1,0x0AB67},{1,0x0AB67}},
+   {{0,0x00000},{0,0x00000},{1,0x002A7},{1,0x002A7}},{{0,0x00000},{0,0x00000},{1,0x00288},{1,0x00288}},
+   {{0,0x00000},{0,0x00000},{1,0x02C71},{1,0x02C71}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x0028F},{1,0x0028F}},{{0,0x00000},{0,0x00000},{1,0x002A1},{1,0x002A1}},
+   {{0,0x00000},{0,0x00000},{1,0x002A2},{1,0x002A2}},{{0,0x00000},{0,0x00000},{1,0x00298},{1,0x00298}},
+   {{0,0x00000},{0,0x00000},{1,0x001C0},{1,0x001C0}},{{0,0x00000},{0,0x00000},{1,0x001C1},{1,0x001C1}},
+   {{0,0x00000},{0,0x00000},{1,0x001C2},{1,0x001C2}},{{0,0x00000},{0,0x00000},{1,0x1DF0A},{1,0x1DF0A}},
+   {{0,0x00000},{0,0x00000},{1,0x1DF1E},{1,0x1DF1E}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 147 */
+  {{{0,0x00000},{1,0x10CC0},{0,0x00000},{1,0x10CC0}},{{0,0x00000},{1,0x10CC1},{0,0x00000},{1,0x10CC1}},
+   {{0,0x00000},{1,0x10CC2},{0,0x00000},{1,0x10CC2}},{{0,0x00000},{1,0x10CC3},{0,0x00000},{1,0x10CC3}},
+   {{0,0x00000},{1,0x10CC4},{0,0x00000},{1,0x10CC4}},{{0,0x00000},{1,0x10CC5},{0,0x00000},{1,0x10CC5}},
+   {{0,0x00000},{1,0x10CC6},{0,0x00000},{1,0x10CC6}},{{0,0x00000},{1,0x10CC7},{0,0x00000},{1,0x10CC7}},
+   {{0,0x00000},{1,0x10CC8},{0,0x00000},{1,0x10CC8}},{{0,0x00000},{1,0x10CC9},{0,0x00000},{1,0x10CC9}},
+   {{0,0x00000},{1,0x10CCA},{0,0x00000},{1,0x10CCA}},{{0,0x00000},{1,0x10CCB},{0,0x00000},{1,0x10CCB}},
+   {{0,0x00000},{1,0x10CCC},{0,0x00000},{1,0x10CCC}},{{0,0x00000},{1,0x10CCD},{0,0x00000},{1,0x10CCD}},
+   {{0,0x00000},{1,0x10CCE},{0,0x00000},{1,0x10CCE}},{{0,0x00000},{1,0x10CCF},{0,0x00000},{1,0x10CCF}},
+   {{0,0x00000},{1,0x10CD0},{0,0x00000},{1,0x10CD0}},{{0,0x00000},{1,0x10CD1},{0,0x00000},{1,0x10CD1}},
+   {{0,0x00000},{1,0x10CD2},{0,0x00000},{1,0x10CD2}},{{0,0x00000},{1,0x10CD3},{0,0x00000},{1,0x10CD3}},
+   {{0,0x00000},{1,0x10CD4},{0,0x00000},{1,0x10CD4}},{{0,0x00000},{1,0x10CD5},{0,0x00000},{1,0x10CD5}},
+   {{0,0x00000},{1,0x10CD6},{0,0x00000},{1,0x10CD6}},{{0,0x00000},{1,0x10CD7},{0,0x00000},{1,0x10CD7}},
+   {{0,0x00000},{1,0x10CD8},{0,0x00000},{1,0x10CD8}},{{0,0x00000},{1,0x10CD9},{0,0x00000},{1,0x10CD9}},
+   {{0,0x00000},{1,0x10CDA},{0,0x00000},{1,0x10CDA}},{{0,0x00000},{1,0x10CDB},{0,0x00000},{1,0x10CDB}},
+   {{0,0x00000},{1,0x10CDC},{0,0x00000},{1,0x10CDC}},{{0,0x00000},{1,0x10CDD},{0,0x00000},{1,0x10CDD}},
+   {{0,0x00000},{1,0x10CDE},{0,0x00000},{1,0x10CDE}},{{0,0x00000},{1,0x10CDF},{0,0x00000},{1,0x10CDF}},
+   {{0,0x00000},{1,0x10CE0},{0,0x00000},{1,0x10CE0}},{{0,0x00000},{1,0x10CE1},{0,0x00000},{1,0x10CE1}},
+   {{0,0x00000},{1,0x10CE2},{0,0x00000},{1,0x10CE2}},{{0,0x00000},{1,0x10CE3},{0,0x00000},{1,0x10CE3}},
+   {{0,0x00000},{1,0x10CE4},{0,0x00000},{1,0x10CE4}},{{0,0x00000},{1,0x10CE5},{0,0x00000},{1,0x10CE5}},
+   {{0,0x00000},{1,0x10CE6},{0,0x00000},{1,0x10CE6}},{{0,0x00000},{1,0x10CE7},{0,0x00000},{1,0x10CE7}},
+   {{0,0x00000},{1,0x10CE8},{0,0x00000},{1,0x10CE8}},{{0,0x00000},{1,0x10CE9},{0,0x00000},{1,0x10CE9}},
+   {{0,0x00000},{1,0x10CEA},{0,0x00000},{1,0x10CEA}},{{0,0x00000},{1,0x10CEB},{0,0x00000},{1,0x10CEB}},
+   {{0,0x00000},{1,0x10CEC},{0,0x00000},{1,0x10CEC}},{{0,0x00000},{1,0x10CED},{0,0x00000},{1,0x10CED}},
+   {{0,0x00000},{1,0x10CEE},{0,0x00000},{1,0x10CEE}},{{0,0x00000},{1,0x10CEF},{0,0x00000},{1,0x10CEF}},
+   {{0,0x00000},{1,0x10CF0},{0,0x00000},{1,0x10CF0}},{{0,0x00000},{1,0x10CF1},{0,0x00000},{1,0x10CF1}},
+   {{0,0x00000},{1,0x10CF2},{0,0x00000},{1,0x10CF2}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 148 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x0138E},{2,0x0138E},{2,0x0138E},{2,0x0138E}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x01390},{2,0x01390},{2,0x01390},{2,0x01390}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x01392},{2,0x01392},{2,0x01392},{2,0x01392}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 149 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x01394},{2,0x01394},{2,0x01394},{2,0x01394}},{{2,0x01396},{2,0x01396},{2,0x01396},{2,0x01396}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 150 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x01398},{2,0x01398},{2,0x01398},{2,0x01398}},
+   {{2,0x0139A},{2,0x0139A},{2,0x0139A},{2,0x0139A}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 151 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x0139C},{2,0x0139C},{2,0x0139C},{2,0x0139C}},
+   {{2,0x0139E},{2,0x0139E},{2,0x0139E},{2,0x0139E}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x013A0},{2,0x013A0},{2,0x013A0},{2,0x013A0}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 152 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x013A2},{2,0x013A2},{2,0x013A2},{2,0x013A2}},{{2,0x013A4},{2,0x013A4},{2,0x013A4},{2,0x013A4}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 153 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{1,0x118C0},{0,0x00000},{1,0x118C0}},{{0,0x00000},{1,0x118C1},{0,0x00000},{1,0x118C1}},
+   {{0,0x00000},{1,0x118C2},{0,0x00000},{1,0x118C2}},{{0,0x00000},{1,0x118C3},{0,0x00000},{1,0x118C3}},
+   {{0,0x00000},{1,0x118C4},{0,0x00000},{1,0x118C4}},{{0,0x00000},{1,0x118C5},{0,0x00000},{1,0x118C5}},
+   {{0,0x00000},{1,0x118C6},{0,0x00000},{1,0x118C6}},{{0,0x00000},{1,0x118C7},{0,0x00000},{1,0x118C7}},
+   {{0,0x00000},{1,0x118C8},{0,0x00000},{1,0x118C8}},{{0,0x00000},{1,0x118C9},{0,0x00000},{1,0x118C9}},
+   {{0,0x00000},{1,0x118CA},{0,0x00000},{1,0x118CA}},{{0,0x00000},{1,0x118CB},{0,0x00000},{1,0x118CB}},
+   {{0,0x00000},{1,0x118CC},{0,0x00000},{1,0x118CC}},{{0,0x00000},{1,0x118CD},{0,0x00000},{1,0x118CD}},
+   {{0,0x00000},{1,0x118CE},{0,0x00000},{1,0x118CE}},{{0,0x00000},{1,0x118CF},{0,0x00000},{1,0x118CF}},
+   {{0,0x00000},{1,0x118D0},{0,0x00000},{1,0x118D0}},{{0,0x00000},{1,0x118D1},{0,0x00000},{1,0x118D1}},
+   {{0,0x00000},{1,0x118D2},{0,0x00000},{1,0x118D2}},{{0,0x00000},{1,0x118D3},{0,0x00000},{1,0x118D3}},
+   {{0,0x00000},{1,0x118D4},{0,0x00000},{1,0x118D4}},{{0,0x00000},{1,0x118D5},{0,0x00000},{1,0x118D5}},
+   {{0,0x00000},{1,0x118D6},{0,0x00000},{1,0x118D6}},{{0,0x00000},{1,0x118D7},{0,0x00000},{1,0x118D7}},
+   {{0,0x00000},{1,0x118D8},{0,0x00000},{1,0x118D8}},{{0,0x00000},{1,0x118D9},{0,0x00000},{1,0x118D9}},
+   {{0,0x00000},{1,0x118DA},{0,0x00000},{1,0x118DA}},{{0,0x00000},{1,0x118DB},{0,0x00000},{1,0x118DB}},
+   {{0,0x00000},{1,0x118DC},{0,0x00000},{1,0x118DC}},{{0,0x00000},{1,0x118DD},{0,0x00000},{1,0x118DD}},
+   {{0,0x00000},{1,0x118DE},{0,0x00000},{1,0x118DE}},{{0,0x00000},{1,0x118DF},{0,0x00000},{1,0x118DF}}
+  },
+
+  /* block 154 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x013A6},{2,0x013A6},{2,0x013A6},{2,0x013A6}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 155 */
+  {{{0,0x00000},{1,0x16E60},{0,0x00000},{1,0x16E60}},{{0,0x00000},{1,0x16E61},{0,0x00000},{1,0x16E61}},
+   {{0,0x00000},{1,0x16E62},{0,0x00000},{1,0x16E62}},{{0,0x00000},{1,0x16E63},{0,0x00000},{1,0x16E63}},
+   {{0,0x00000},{1,0x16E64},{0,0x00000},{1,0x16E64}},{{0,0x00000},{1,0x16E65},{0,0x00000},{1,0x16E65}},
+   {{0,0x00000},{1,0x16E66},{0,0x00000},{1,0x16E66}},{{0,0x00000},{1,0x16E67},{0,0x00000},{1,0x16E67}},
+   {{0,0x00000},{1,0x16E68},{0,0x00000},{1,0x16E68}},{{0,0x00000},{1,0x16E69},{0,0x00000},{1,0x16E69}},
+   {{0,0x00000},{1,0x16E6A},{0,0x00000},{1,0x16E6A}},{{0,0x00000},{1,0x16E6B},{0,0x00000},{1,0x16E6B}},
+   {{0,0x00000},{1,0x16E6C},{0,0x00000},{1,0x16E6C}},{{0,0x00000},{1,0x16E6D},{0,0x00000},{1,0x16E6D}},
+   {{0,0x00000},{1,0x16E6E},{0,0x00000},{1,0x16E6E}},{{0,0x00000},{1,0x16E6F},{0,0x00000},{1,0x16E6F}},
+   {{0,0x00000},{1,0x16E70},{0,0x00000},{1,0x16E70}},{{0,0x00000},{1,0x16E71},{0,0x00000},{1,0x16E71}},
+   {{0,0x00000},{1,0x16E72},{0,0x00000},{1,0x16E72}},{{0,0x00000},{1,0x16E73},{0,0x00000},{1,0x16E73}},
+   {{0,0x00000},{1,0x16E74},{0,0x00000},{1,0x16E74}},{{0,0x00000},{1,0x16E75},{0,0x00000},{1,0x16E75}},
+   {{0,0x00000},{1,0x16E76},{0,0x00000},{1,0x16E76}},{{0,0x00000},{1,0x16E77},{0,0x00000},{1,0x16E77}},
+   {{0,0x00000},{1,0x16E78},{0,0x00000},{1,0x16E78}},{{0,0x00000},{1,0x16E79},{0,0x00000},{1,0x16E79}},
+   {{0,0x00000},{1,0x16E7A},{0,0x00000},{1,0x16E7A}},{{0,0x00000},{1,0x16E7B},{0,0x00000},{1,0x16E7B}},
+   {{0,0x00000},{1,0x16E7C},{0,0x00000},{1,0x16E7C}},{{0,0x00000},{1,0x16E7D},{0,0x00000},{1,0x16E7D}},
+   {{0,0x00000},{1,0x16E7E},{0,0x00000},{1,0x16E7E}},{{0,0x00000},{1,0x16E7F},{0,0x00000},{1,0x16E7F}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 156 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{2,0x013A8},{2,0x013A8},{2,0x013A8},{2,0x013A8}},{{2,0x013AA},{2,0x013AA},{2,0x013AA},{2,0x013AA}},
+   {{3,0x013AC},{3,0x013AC},{3,0x013AC},{3,0x013AC}},{{3,0x013AF},{3,0x013AF},{3,0x013AF},{3,0x013AF}},
+   {{3,0x013B2},{3,0x013B2},{3,0x013B2},{3,0x013B2}},{{3,0x013B5},{3,0x013B5},{3,0x013B5},{3,0x013B5}},
+   {{3,0x013B8},{3,0x013B8},{3,0x013B8},{3,0x013B8}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 157 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{2,0x013BB},{2,0x013BB},{2,0x013BB},{2,0x013BB}},
+   {{2,0x013BD},{2,0x013BD},{2,0x013BD},{2,0x013BD}},{{3,0x013BF},{3,0x013BF},{3,0x013BF},{3,0x013BF}},
+   {{3,0x013C2},{3,0x013C2},{3,0x013C2},{3,0x013C2}},{{3,0x013C5},{3,0x013C5},{3,0x013C5},{3,0x013C5}}
+  },
+
+  /* block 158 */
+  {{{3,0x013C8},{3,0x013C8},{3,0x013C8},{3,0x013C8}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 159 */
+  {{{0,0x00000},{0,0x00000},{1,0x00041},{1,0x00061}},{{0,0x00000},{0,0x00000},{1,0x00042},{1,0x00062}},
+   {{0,0x00000},{0,0x00000},{1,0x00043},{1,0x00063}},{{0,0x00000},{0,0x00000},{1,0x00044},{1,0x00064}},
+   {{0,0x00000},{0,0x00000},{1,0x00045},{1,0x00065}},{{0,0x00000},{0,0x00000},{1,0x00046},{1,0x00066}},
+   {{0,0x00000},{0,0x00000},{1,0x00047},{1,0x00067}},{{0,0x00000},{0,0x00000},{1,0x00048},{1,0x00068}},
+   {{0,0x00000},{0,0x00000},{1,0x00049},{1,0x00069}},{{0,0x00000},{0,0x00000},{1,0x0004A},{1,0x0006A}},
+   {{0,0x00000},{0,0x00000},{1,0x0004B},{1,0x0006B}},{{0,0x00000},{0,0x00000},{1,0x0004C},{1,0x0006C}},
+   {{0,0x00000},{0,0x00000},{1,0x0004D},{1,0x0006D}},{{0,0x00000},{0,0x00000},{1,0x0004E},{1,0x0006E}},
+   {{0,0x00000},{0,0x00000},{1,0x0004F},{1,0x0006F}},{{0,0x00000},{0,0x00000},{1,0x00050},{1,0x00070}},
+   {{0,0x00000},{0,0x00000},{1,0x00051},{1,0x00071}},{{0,0x00000},{0,0x00000},{1,0x00052},{1,0x00072}},
+   {{0,0x00000},{0,0x00000},{1,0x00053},{1,0x00073}},{{0,0x00000},{0,0x00000},{1,0x00054},{1,0x00074}},
+   {{0,0x00000},{0,0x00000},{1,0x00055},{1,0x00075}},{{0,0x00000},{0,0x00000},{1,0x00056},{1,0x00076}},
+   {{0,0x00000},{0,0x00000},{1,0x00057},{1,0x00077}},{{0,0x00000},{0,0x00000},{1,0x00058},{1,0x00078}},
+   {{0,0x00000},{0,0x00000},{1,0x00059},{1,0x00079}},{{0,0x00000},{0,0x00000},{1,0x0005A},{1,0x0007A}},
+   {{0,0x00000},{0,0x00000},{1,0x00061},{1,0x00061}},{{0,0x00000},{0,0x00000},{1,0x00062},{1,0x00062}},
+   {{0,0x00000},{0,0x00000},{1,0x00063},{1,0x00063}},{{0,0x00000},{0,0x00000},{1,0x00064},{1,0x00064}},
+   {{0,0x00000},{0,0x00000},{1,0x00065},{1,0x00065}},{{0,0x00000},{0,0x00000},{1,0x00066},{1,0x00066}},
+   {{0,0x00000},{0,0x00000},{1,0x00067},{1,0x00067}},{{0,0x00000},{0,0x00000},{1,0x00068},{1,0x00068}},
+   {{0,0x00000},{0,0x00000},{1,0x00069},{1,0x00069}},{{0,0x00000},{0,0x00000},{1,0x0006A},{1,0x0006A}},
+   {{0,0x00000},{0,0x00000},{1,0x0006B},{1,0x0006B}},{{0,0x00000},{0,0x00000},{1,0x0006C},{1,0x0006C}},
+   {{0,0x00000},{0,0x00000},{1,0x0006D},{1,0x0006D}},{{0,0x00000},{0,0x00000},{1,0x0006E},{1,0x0006E}},
+   {{0,0x00000},{0,0x00000},{1,0x0006F},{1,0x0006F}},{{0,0x00000},{0,0x00000},{1,0x00070},{1,0x00070}},
+   {{0,0x00000},{0,0x00000},{1,0x00071},{1,0x00071}},{{0,0x00000},{0,0x00000},{1,0x00072},{1,0x00072}},
+   {{0,0x00000},{0,0x00000},{1,0x00073},{1,0x00073}},{{0,0x00000},{0,0x00000},{1,0x00074},{1,0x00074}},
+   {{0,0x00000},{0,0x00000},{1,0x00075},{1,0x00075}},{{0,0x00000},{0,0x00000},{1,0x00076},{1,0x00076}},
+   {{0,0x00000},{0,0x00000},{1,0x00077},{1,0x00077}},{{0,0x00000},{0,0x00000},{1,0x00078},{1,0x00078}},
+   {{0,0x00000},{0,0x00000},{1,0x00079},{1,0x00079}},{{0,0x00000},{0,0x00000},{1,0x0007A},{1,0x0007A}},
+   {{0,0x00000},{0,0x00000},{1,0x00041},{1,0x00061}},{{0,0x00000},{0,0x00000},{1,0x00042},{1,0x00062}},
+   {{0,0x00000},{0,0x00000},{1,0x00043},{1,0x00063}},{{0,0x00000},{0,0x00000},{1,0x00044},{1,0x00064}},
+   {{0,0x00000},{0,0x00000},{1,0x00045},{1,0x00065}},{{0,0x00000},{0,0x00000},{1,0x00046},{1,0x00066}},
+   {{0,0x00000},{0,0x00000},{1,0x00047},{1,0x00067}},{{0,0x00000},{0,0x00000},{1,0x00048},{1,0x00068}},
+   {{0,0x00000},{0,0x00000},{1,0x00049},{1,0x00069}},{{0,0x00000},{0,0x00000},{1,0x0004A},{1,0x0006A}},
+   {{0,0x00000},{0,0x00000},{1,0x0004B},{1,0x0006B}},{{0,0x00000},{0,0x00000},{1,0x0004C},{1,0x0006C}}
+  },
+
+  /* block 160 */
+  {{{0,0x00000},{0,0x00000},{1,0x0004D},{1,0x0006D}},{{0,0x00000},{0,0x00000},{1,0x0004E},{1,0x0006E}},
+   {{0,0x00000},{0,0x00000},{1,0x0004F},{1,0x0006F}},{{0,0x00000},{0,0x00000},{1,0x00050},{1,0x00070}},
+   {{0,0x00000},{0,0x00000},{1,0x00051},{1,0x00071}},{{0,0x00000},{0,0x00000},{1,0x00052},{1,0x00072}},
+   {{0,0x00000},{0,0x00000},{1,0x00053},{1,0x00073}},{{0,0x00000},{0,0x00000},{1,0x00054},{1,0x00074}},
+   {{0,0x00000},{0,0x00000},{1,0x00055},{1,0x00075}},{{0,0x00000},{0,0x00000},{1,0x00056},{1,0x00076}},
+   {{0,0x00000},{0,0x00000},{1,0x00057},{1,0x00077}},{{0,0x00000},{0,0x00000},{1,0x00058},{1,0x00078}},
+   {{0,0x00000},{0,0x00000},{1,0x00059},{1,0x00079}},{{0,0x00000},{0,0x00000},{1,0x0005A},{1,0x0007A}},
+   {{0,0x00000},{0,0x00000},{1,0x00061},{1,0x00061}},{{0,0x00000},{0,0x00000},{1,0x00062},{1,0x00062}},
+   {{0,0x00000},{0,0x00000},{1,0x00063},{1,0x00063}},{{0,0x00000},{0,0x00000},{1,0x00064},{1,0x00064}},
+   {{0,0x00000},{0,0x00000},{1,0x00065},{1,0x00065}},{{0,0x00000},{0,0x00000},{1,0x00066},{1,0x00066}},
+   {{0,0x00000},{0,0x00000},{1,0x00067},{1,0x00067}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x00069},{1,0x00069}},{{0,0x00000},{0,0x00000},{1,0x0006A},{1,0x0006A}},
+   {{0,0x00000},{0,0x00000},{1,0x0006B},{1,0x0006B}},{{0,0x00000},{0,0x00000},{1,0x0006C},{1,0x0006C}},
+   {{0,0x00000},{0,0x00000},{1,0x0006D},{1,0x0006D}},{{0,0x00000},{0,0x00000},{1,0x0006E},{1,0x0006E}},
+   {{0,0x00000},{0,0x00000},{1,0x0006F},{1,0x0006F}},{{0,0x00000},{0,0x00000},{1,0x00070},{1,0x00070}},
+   {{0,0x00000},{0,0x00000},{1,0x00071},{1,0x00071}},{{0,0x00000},{0,0x00000},{1,0x00072},{1,0x00072}},
+   {{0,0x00000},{0,0x00000},{1,0x00073},{1,0x00073}},{{0,0x00000},{0,0x00000},{1,0x00074},{1,0x00074}},
+   {{0,0x00000},{0,0x00000},{1,0x00075},{1,0x00075}},{{0,0x00000},{0,0x00000},{1,0x00076},{1,0x00076}},
+   {{0,0x00000},{0,0x00000},{1,0x00077},{1,0x00077}},{{0,0x00000},{0,0x00000},{1,0x00078},{1,0x00078}},
+   {{0,0x00000},{0,0x00000},{1,0x00079},{1,0x00079}},{{0,0x00000},{0,0x00000},{1,0x0007A},{1,0x0007A}},
+   {{0,0x00000},{0,0x00000},{1,0x00041},{1,0x00061}},{{0,0x00000},{0,0x00000},{1,0x00042},{1,0x00062}},
+   {{0,0x00000},{0,0x00000},{1,0x00043},{1,0x00063}},{{0,0x00000},{0,0x00000},{1,0x00044},{1,0x00064}},
+   {{0,0x00000},{0,0x00000},{1,0x00045},{1,0x00065}},{{0,0x00000},{0,0x00000},{1,0x00046},{1,0x00066}},
+   {{0,0x00000},{0,0x00000},{1,0x00047},{1,0x00067}},{{0,0x00000},{0,0x00000},{1,0x00048},{1,0x00068}},
+   {{0,0x00000},{0,0x00000},{1,0x00049},{1,0x00069}},{{0,0x00000},{0,0x00000},{1,0x0004A},{1,0x0006A}},
+   {{0,0x00000},{0,0x00000},{1,0x0004B},{1,0x0006B}},{{0,0x00000},{0,0x00000},{1,0x0004C},{1,0x0006C}},
+   {{0,0x00000},{0,0x00000},{1,0x0004D},{1,0x0006D}},{{0,0x00000},{0,0x00000},{1,0x0004E},{1,0x0006E}},
+   {{0,0x00000},{0,0x00000},{1,0x0004F},{1,0x0006F}},{{0,0x00000},{0,0x00000},{1,0x00050},{1,0x00070}},
+   {{0,0x00000},{0,0x00000},{1,0x00051},{1,0x00071}},{{0,0x00000},{0,0x00000},{1,0x00052},{1,0x00072}},
+   {{0,0x00000},{0,0x00000},{1,0x00053},{1,0x00073}},{{0,0x00000},{0,0x00000},{1,0x00054},{1,0x00074}},
+   {{0,0x00000},{0,0x00000},{1,0x00055},{1,0x00075}},{{0,0x00000},{0,0x00000},{1,0x00056},{1,0x00076}},
+   {{0,0x00000},{0,0x00000},{1,0x00057},{1,0x00077}},{{0,0x00000},{0,0x00000},{1,0x00058},{1,0x00078}}
+  },
+
+  /* block 161 */
+  {{{0,0x00000},{0,0x00000},{1,0x00059},{1,0x00079}},{{0,0x00000},{0,0x00000},{1,0x0005A},{1,0x0007A}},
+   {{0,0x00000},{0,0x00000},{1,0x00061},{1,0x00061}},{{0,0x00000},{0,0x00000},{1,0x00062},{1,0x00062}},
+   {{0,0x00000},{0,0x00000},{1,0x00063},{1,0x00063}},{{0,0x00000},{0,0x00000},{1,0x00064},{1,0x00064}},
+   {{0,0x00000},{0,0x00000},{1,0x00065},{1,0x00065}},{{0,0x00000},{0,0x00000},{1,0x00066},{1,0x00066}},
+   {{0,0x00000},{0,0x00000},{1,0x00067},{1,0x00067}},{{0,0x00000},{0,0x00000},{1,0x00068},{1,0x00068}},
+   {{0,0x00000},{0,0x00000},{1,0x00069},{1,0x00069}},{{0,0x00000},{0,0x00000},{1,0x0006A},{1,0x0006A}},
+   {{0,0x00000},{0,0x00000},{1,0x0006B},{1,0x0006B}},{{0,0x00000},{0,0x00000},{1,0x0006C},{1,0x0006C}},
+   {{0,0x00000},{0,0x00000},{1,0x0006D},{1,0x0006D}},{{0,0x00000},{0,0x00000},{1,0x0006E},{1,0x0006E}},
+   {{0,0x00000},{0,0x00000},{1,0x0006F},{1,0x0006F}},{{0,0x00000},{0,0x00000},{1,0x00070},{1,0x00070}},
+   {{0,0x00000},{0,0x00000},{1,0x00071},{1,0x00071}},{{0,0x00000},{0,0x00000},{1,0x00072},{1,0x00072}},
+   {{0,0x00000},{0,0x00000},{1,0x00073},{1,0x00073}},{{0,0x00000},{0,0x00000},{1,0x00074},{1,0x00074}},
+   {{0,0x00000},{0,0x00000},{1,0x00075},{1,0x00075}},{{0,0x00000},{0,0x00000},{1,0x00076},{1,0x00076}},
+   {{0,0x00000},{0,0x00000},{1,0x00077},{1,0x00077}},{{0,0x00000},{0,0x00000},{1,0x00078},{1,0x00078}},
+   {{0,0x00000},{0,0x00000},{1,0x00079},{1,0x00079}},{{0,0x00000},{0,0x00000},{1,0x0007A},{1,0x0007A}},
+   {{0,0x00000},{0,0x00000},{1,0x00041},{1,0x00061}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x00043},{1,0x00063}},{{0,0x00000},{0,0x00000},{1,0x00044},{1,0x00064}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x00047},{1,0x00067}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x0004A},{1,0x0006A}},
+   {{0,0x00000},{0,0x00000},{1,0x0004B},{1,0x0006B}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x0004E},{1,0x0006E}},
+   {{0,0x00000},{0,0x00000},{1,0x0004F},{1,0x0006F}},{{0,0x00000},{0,0x00000},{1,0x00050},{1,0x00070}},
+   {{0,0x00000},{0,0x00000},{1,0x00051},{1,0x00071}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x00053},{1,0x00073}},{{0,0x00000},{0,0x00000},{1,0x00054},{1,0x00074}},
+   {{0,0x00000},{0,0x00000},{1,0x00055},{1,0x00075}},{{0,0x00000},{0,0x00000},{1,0x00056},{1,0x00076}},
+   {{0,0x00000},{0,0x00000},{1,0x00057},{1,0x00077}},{{0,0x00000},{0,0x00000},{1,0x00058},{1,0x00078}},
+   {{0,0x00000},{0,0x00000},{1,0x00059},{1,0x00079}},{{0,0x00000},{0,0x00000},{1,0x0005A},{1,0x0007A}},
+   {{0,0x00000},{0,0x00000},{1,0x00061},{1,0x00061}},{{0,0x00000},{0,0x00000},{1,0x00062},{1,0x00062}},
+   {{0,0x00000},{0,0x00000},{1,0x00063},{1,0x00063}},{{0,0x00000},{0,0x00000},{1,0x00064},{1,0x00064}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x00066},{1,0x00066}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x00068},{1,0x00068}},
+   {{0,0x00000},{0,0x00000},{1,0x00069},{1,0x00069}},{{0,0x00000},{0,0x00000},{1,0x0006A},{1,0x0006A}}
+  },
+
+  /* block 162 */
+  {{{0,0x00000},{0,0x00000},{1,0x0006B},{1,0x0006B}},{{0,0x00000},{0,0x00000},{1,0x0006C},{1,0x0006C}},
+   {{0,0x00000},{0,0x00000},{1,0x0006D},{1,0x0006D}},{{0,0x00000},{0,0x00000},{1,0x0006E},{1,0x0006E}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x00070},{1,0x00070}},
+   {{0,0x00000},{0,0x00000},{1,0x00071},{1,0x00071}},{{0,0x00000},{0,0x00000},{1,0x00072},{1,0x00072}},
+   {{0,0x00000},{0,0x00000},{1,0x00073},{1,0x00073}},{{0,0x00000},{0,0x00000},{1,0x00074},{1,0x00074}},
+   {{0,0x00000},{0,0x00000},{1,0x00075},{1,0x00075}},{{0,0x00000},{0,0x00000},{1,0x00076},{1,0x00076}},
+   {{0,0x00000},{0,0x00000},{1,0x00077},{1,0x00077}},{{0,0x00000},{0,0x00000},{1,0x00078},{1,0x00078}},
+   {{0,0x00000},{0,0x00000},{1,0x00079},{1,0x00079}},{{0,0x00000},{0,0x00000},{1,0x0007A},{1,0x0007A}},
+   {{0,0x00000},{0,0x00000},{1,0x00041},{1,0x00061}},{{0,0x00000},{0,0x00000},{1,0x00042},{1,0x00062}},
+   {{0,0x00000},{0,0x00000},{1,0x00043},{1,0x00063}},{{0,0x00000},{0,0x00000},{1,0x00044},{1,0x00064}},
+   {{0,0x00000},{0,0x00000},{1,0x00045},{1,0x00065}},{{0,0x00000},{0,0x00000},{1,0x00046},{1,0x00066}},
+   {{0,0x00000},{0,0x00000},{1,0x00047},{1,0x00067}},{{0,0x00000},{0,0x00000},{1,0x00048},{1,0x00068}},
+   {{0,0x00000},{0,0x00000},{1,0x00049},{1,0x00069}},{{0,0x00000},{0,0x00000},{1,0x0004A},{1,0x0006A}},
+   {{0,0x00000},{0,0x00000},{1,0x0004B},{1,0x0006B}},{{0,0x00000},{0,0x00000},{1,0x0004C},{1,0x0006C}},
+   {{0,0x00000},{0,0x00000},{1,0x0004D},{1,0x0006D}},{{0,0x00000},{0,0x00000},{1,0x0004E},{1,0x0006E}},
+   {{0,0x00000},{0,0x00000},{1,0x0004F},{1,0x0006F}},{{0,0x00000},{0,0x00000},{1,0x00050},{1,0x00070}},
+   {{0,0x00000},{0,0x00000},{1,0x00051},{1,0x00071}},{{0,0x00000},{0,0x00000},{1,0x00052},{1,0x00072}},
+   {{0,0x00000},{0,0x00000},{1,0x00053},{1,0x00073}},{{0,0x00000},{0,0x00000},{1,0x00054},{1,0x00074}},
+   {{0,0x00000},{0,0x00000},{1,0x00055},{1,0x00075}},{{0,0x00000},{0,0x00000},{1,0x00056},{1,0x00076}},
+   {{0,0x00000},{0,0x00000},{1,0x00057},{1,0x00077}},{{0,0x00000},{0,0x00000},{1,0x00058},{1,0x00078}},
+   {{0,0x00000},{0,0x00000},{1,0x00059},{1,0x00079}},{{0,0x00000},{0,0x00000},{1,0x0005A},{1,0x0007A}},
+   {{0,0x00000},{0,0x00000},{1,0x00061},{1,0x00061}},{{0,0x00000},{0,0x00000},{1,0x00062},{1,0x00062}},
+   {{0,0x00000},{0,0x00000},{1,0x00063},{1,0x00063}},{{0,0x00000},{0,0x00000},{1,0x00064},{1,0x00064}},
+   {{0,0x00000},{0,0x00000},{1,0x00065},{1,0x00065}},{{0,0x00000},{0,0x00000},{1,0x00066},{1,0x00066}},
+   {{0,0x00000},{0,0x00000},{1,0x00067},{1,0x00067}},{{0,0x00000},{0,0x00000},{1,0x00068},{1,0x00068}},
+   {{0,0x00000},{0,0x00000},{1,0x00069},{1,0x00069}},{{0,0x00000},{0,0x00000},{1,0x0006A},{1,0x0006A}},
+   {{0,0x00000},{0,0x00000},{1,0x0006B},{1,0x0006B}},{{0,0x00000},{0,0x00000},{1,0x0006C},{1,0x0006C}},
+   {{0,0x00000},{0,0x00000},{1,0x0006D},{1,0x0006D}},{{0,0x00000},{0,0x00000},{1,0x0006E},{1,0x0006E}},
+   {{0,0x00000},{0,0x00000},{1,0x0006F},{1,0x0006F}},{{0,0x00000},{0,0x00000},{1,0x00070},{1,0x00070}},
+   {{0,0x00000},{0,0x00000},{1,0x00071},{1,0x00071}},{{0,0x00000},{0,0x00000},{1,0x00072},{1,0x00072}},
+   {{0,0x00000},{0,0x00000},{1,0x00073},{1,0x00073}},{{0,0x00000},{0,0x00000},{1,0x00074},{1,0x00074}},
+   {{0,0x00000},{0,0x00000},{1,0x00075},{1,0x00075}},{{0,0x00000},{0,0x00000},{1,0x00076},{1,0x00076}}
+  },
+
+  /* block 163 */
+  {{{0,0x00000},{0,0x00000},{1,0x00077},{1,0x00077}},{{0,0x00000},{0,0x00000},{1,0x00078},{1,0x00078}},
+   {{0,0x00000},{0,0x00000},{1,0x00079},{1,0x00079}},{{0,0x00000},{0,0x00000},{1,0x0007A},{1,0x0007A}},
+   {{0,0x00000},{0,0x00000},{1,0x00041},{1,0x00061}},{{0,0x00000},{0,0x00000},{1,0x00042},{1,0x00062}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x00044},{1,0x00064}},
+   {{0,0x00000},{0,0x00000},{1,0x00045},{1,0x00065}},{{0,0x00000},{0,0x00000},{1,0x00046},{1,0x00066}},
+   {{0,0x00000},{0,0x00000},{1,0x00047},{1,0x00067}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x0004A},{1,0x0006A}},
+   {{0,0x00000},{0,0x00000},{1,0x0004B},{1,0x0006B}},{{0,0x00000},{0,0x00000},{1,0x0004C},{1,0x0006C}},
+   {{0,0x00000},{0,0x00000},{1,0x0004D},{1,0x0006D}},{{0,0x00000},{0,0x00000},{1,0x0004E},{1,0x0006E}},
+   {{0,0x00000},{0,0x00000},{1,0x0004F},{1,0x0006F}},{{0,0x00000},{0,0x00000},{1,0x00050},{1,0x00070}},
+   {{0,0x00000},{0,0x00000},{1,0x00051},{1,0x00071}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x00053},{1,0x00073}},{{0,0x00000},{0,0x00000},{1,0x00054},{1,0x00074}},
+   {{0,0x00000},{0,0x00000},{1,0x00055},{1,0x00075}},{{0,0x00000},{0,0x00000},{1,0x00056},{1,0x00076}},
+   {{0,0x00000},{0,0x00000},{1,0x00057},{1,0x00077}},{{0,0x00000},{0,0x00000},{1,0x00058},{1,0x00078}},
+   {{0,0x00000},{0,0x00000},{1,0x00059},{1,0x00079}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x00061},{1,0x00061}},{{0,0x00000},{0,0x00000},{1,0x00062},{1,0x00062}},
+   {{0,0x00000},{0,0x00000},{1,0x00063},{1,0x00063}},{{0,0x00000},{0,0x00000},{1,0x00064},{1,0x00064}},
+   {{0,0x00000},{0,0x00000},{1,0x00065},{1,0x00065}},{{0,0x00000},{0,0x00000},{1,0x00066},{1,0x00066}},
+   {{0,0x00000},{0,0x00000},{1,0x00067},{1,0x00067}},{{0,0x00000},{0,0x00000},{1,0x00068},{1,0x00068}},
+   {{0,0x00000},{0,0x00000},{1,0x00069},{1,0x00069}},{{0,0x00000},{0,0x00000},{1,0x0006A},{1,0x0006A}},
+   {{0,0x00000},{0,0x00000},{1,0x0006B},{1,0x0006B}},{{0,0x00000},{0,0x00000},{1,0x0006C},{1,0x0006C}},
+   {{0,0x00000},{0,0x00000},{1,0x0006D},{1,0x0006D}},{{0,0x00000},{0,0x00000},{1,0x0006E},{1,0x0006E}},
+   {{0,0x00000},{0,0x00000},{1,0x0006F},{1,0x0006F}},{{0,0x00000},{0,0x00000},{1,0x00070},{1,0x00070}},
+   {{0,0x00000},{0,0x00000},{1,0x00071},{1,0x00071}},{{0,0x00000},{0,0x00000},{1,0x00072},{1,0x00072}},
+   {{0,0x00000},{0,0x00000},{1,0x00073},{1,0x00073}},{{0,0x00000},{0,0x00000},{1,0x00074},{1,0x00074}},
+   {{0,0x00000},{0,0x00000},{1,0x00075},{1,0x00075}},{{0,0x00000},{0,0x00000},{1,0x00076},{1,0x00076}},
+   {{0,0x00000},{0,0x00000},{1,0x00077},{1,0x00077}},{{0,0x00000},{0,0x00000},{1,0x00078},{1,0x00078}},
+   {{0,0x00000},{0,0x00000},{1,0x00079},{1,0x00079}},{{0,0x00000},{0,0x00000},{1,0x0007A},{1,0x0007A}},
+   {{0,0x00000},{0,0x00000},{1,0x00041},{1,0x00061}},{{0,0x00000},{0,0x00000},{1,0x00042},{1,0x00062}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x00044},{1,0x00064}},
+   {{0,0x00000},{0,0x00000},{1,0x00045},{1,0x00065}},{{0,0x00000},{0,0x00000},{1,0x00046},{1,0x00066}},
+   {{0,0x00000},{0,0x00000},{1,0x00047},{1,0x00067}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 164 */
+  {{{0,0x00000},{0,0x00000},{1,0x00049},{1,0x00069}},{{0,0x00000},{0,0x00000},{1,0x0004A},{1,0x0006A}},
+   {{0,0x00000},{0,0x00000},{1,0x0004B},{1,0x0006B}},{{0,0x00000},{0,0x00000},{1,0x0004C},{1,0x0006C}},
+   {{0,0x00000},{0,0x00000},{1,0x0004D},{1,0x0006D}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x0004F},{1,0x0006F}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x00053},{1,0x00073}},{{0,0x00000},{0,0x00000},{1,0x00054},{1,0x00074}},
+   {{0,0x00000},{0,0x00000},{1,0x00055},{1,0x00075}},{{0,0x00000},{0,0x00000},{1,0x00056},{1,0x00076}},
+   {{0,0x00000},{0,0x00000},{1,0x00057},{1,0x00077}},{{0,0x00000},{0,0x00000},{1,0x00058},{1,0x00078}},
+   {{0,0x00000},{0,0x00000},{1,0x00059},{1,0x00079}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x00061},{1,0x00061}},{{0,0x00000},{0,0x00000},{1,0x00062},{1,0x00062}},
+   {{0,0x00000},{0,0x00000},{1,0x00063},{1,0x00063}},{{0,0x00000},{0,0x00000},{1,0x00064},{1,0x00064}},
+   {{0,0x00000},{0,0x00000},{1,0x00065},{1,0x00065}},{{0,0x00000},{0,0x00000},{1,0x00066},{1,0x00066}},
+   {{0,0x00000},{0,0x00000},{1,0x00067},{1,0x00067}},{{0,0x00000},{0,0x00000},{1,0x00068},{1,0x00068}},
+   {{0,0x00000},{0,0x00000},{1,0x00069},{1,0x00069}},{{0,0x00000},{0,0x00000},{1,0x0006A},{1,0x0006A}},
+   {{0,0x00000},{0,0x00000},{1,0x0006B},{1,0x0006B}},{{0,0x00000},{0,0x00000},{1,0x0006C},{1,0x0006C}},
+   {{0,0x00000},{0,0x00000},{1,0x0006D},{1,0x0006D}},{{0,0x00000},{0,0x00000},{1,0x0006E},{1,0x0006E}},
+   {{0,0x00000},{0,0x00000},{1,0x0006F},{1,0x0006F}},{{0,0x00000},{0,0x00000},{1,0x00070},{1,0x00070}},
+   {{0,0x00000},{0,0x00000},{1,0x00071},{1,0x00071}},{{0,0x00000},{0,0x00000},{1,0x00072},{1,0x00072}},
+   {{0,0x00000},{0,0x00000},{1,0x00073},{1,0x00073}},{{0,0x00000},{0,0x00000},{1,0x00074},{1,0x00074}},
+   {{0,0x00000},{0,0x00000},{1,0x00075},{1,0x00075}},{{0,0x00000},{0,0x00000},{1,0x00076},{1,0x00076}},
+   {{0,0x00000},{0,0x00000},{1,0x00077},{1,0x00077}},{{0,0x00000},{0,0x00000},{1,0x00078},{1,0x00078}},
+   {{0,0x00000},{0,0x00000},{1,0x00079},{1,0x00079}},{{0,0x00000},{0,0x00000},{1,0x0007A},{1,0x0007A}},
+   {{0,0x00000},{0,0x00000},{1,0x00041},{1,0x00061}},{{0,0x00000},{0,0x00000},{1,0x00042},{1,0x00062}},
+   {{0,0x00000},{0,0x00000},{1,0x00043},{1,0x00063}},{{0,0x00000},{0,0x00000},{1,0x00044},{1,0x00064}},
+   {{0,0x00000},{0,0x00000},{1,0x00045},{1,0x00065}},{{0,0x00000},{0,0x00000},{1,0x00046},{1,0x00066}},
+   {{0,0x00000},{0,0x00000},{1,0x00047},{1,0x00067}},{{0,0x00000},{0,0x00000},{1,0x00048},{1,0x00068}},
+   {{0,0x00000},{0,0x00000},{1,0x00049},{1,0x00069}},{{0,0x00000},{0,0x00000},{1,0x0004A},{1,0x0006A}},
+   {{0,0x00000},{0,0x00000},{1,0x0004B},{1,0x0006B}},{{0,0x00000},{0,0x00000},{1,0x0004C},{1,0x0006C}},
+   {{0,0x00000},{0,0x00000},{1,0x0004D},{1,0x0006D}},{{0,0x00000},{0,0x00000},{1,0x0004E},{1,0x0006E}},
+   {{0,0x00000},{0,0x00000},{1,0x0004F},{1,0x0006F}},{{0,0x00000},{0,0x00000},{1,0x00050},{1,0x00070}},
+   {{0,0x00000},{0,0x00000},{1,0x00051},{1,0x00071}},{{0,0x00000},{0,0x00000},{1,0x00052},{1,0x00072}},
+   {{0,0x00000},{0,0x00000},{1,0x00053},{1,0x00073}},{{0,0x00000},{0,0x00000},{1,0x00054},{1,0x00074}}
+  },
+
+  /* block 165 */
+  {{{0,0x00000},{0,0x00000},{1,0x00055},{1,0x00075}},{{0,0x00000},{0,0x00000},{1,0x00056},{1,0x00076}},
+   {{0,0x00000},{0,0x00000},{1,0x00057},{1,0x00077}},{{0,0x00000},{0,0x00000},{1,0x00058},{1,0x00078}},
+   {{0,0x00000},{0,0x00000},{1,0x00059},{1,0x00079}},{{0,0x00000},{0,0x00000},{1,0x0005A},{1,0x0007A}},
+   {{0,0x00000},{0,0x00000},{1,0x00061},{1,0x00061}},{{0,0x00000},{0,0x00000},{1,0x00062},{1,0x00062}},
+   {{0,0x00000},{0,0x00000},{1,0x00063},{1,0x00063}},{{0,0x00000},{0,0x00000},{1,0x00064},{1,0x00064}},
+   {{0,0x00000},{0,0x00000},{1,0x00065},{1,0x00065}},{{0,0x00000},{0,0x00000},{1,0x00066},{1,0x00066}},
+   {{0,0x00000},{0,0x00000},{1,0x00067},{1,0x00067}},{{0,0x00000},{0,0x00000},{1,0x00068},{1,0x00068}},
+   {{0,0x00000},{0,0x00000},{1,0x00069},{1,0x00069}},{{0,0x00000},{0,0x00000},{1,0x0006A},{1,0x0006A}},
+   {{0,0x00000},{0,0x00000},{1,0x0006B},{1,0x0006B}},{{0,0x00000},{0,0x00000},{1,0x0006C},{1,0x0006C}},
+   {{0,0x00000},{0,0x00000},{1,0x0006D},{1,0x0006D}},{{0,0x00000},{0,0x00000},{1,0x0006E},{1,0x0006E}},
+   {{0,0x00000},{0,0x00000},{1,0x0006F},{1,0x0006F}},{{0,0x00000},{0,0x00000},{1,0x00070},{1,0x00070}},
+   {{0,0x00000},{0,0x00000},{1,0x00071},{1,0x00071}},{{0,0x00000},{0,0x00000},{1,0x00072},{1,0x00072}},
+   {{0,0x00000},{0,0x00000},{1,0x00073},{1,0x00073}},{{0,0x00000},{0,0x00000},{1,0x00074},{1,0x00074}},
+   {{0,0x00000},{0,0x00000},{1,0x00075},{1,0x00075}},{{0,0x00000},{0,0x00000},{1,0x00076},{1,0x00076}},
+   {{0,0x00000},{0,0x00000},{1,0x00077},{1,0x00077}},{{0,0x00000},{0,0x00000},{1,0x00078},{1,0x00078}},
+   {{0,0x00000},{0,0x00000},{1,0x00079},{1,0x00079}},{{0,0x00000},{0,0x00000},{1,0x0007A},{1,0x0007A}},
+   {{0,0x00000},{0,0x00000},{1,0x00041},{1,0x00061}},{{0,0x00000},{0,0x00000},{1,0x00042},{1,0x00062}},
+   {{0,0x00000},{0,0x00000},{1,0x00043},{1,0x00063}},{{0,0x00000},{0,0x00000},{1,0x00044},{1,0x00064}},
+   {{0,0x00000},{0,0x00000},{1,0x00045},{1,0x00065}},{{0,0x00000},{0,0x00000},{1,0x00046},{1,0x00066}},
+   {{0,0x00000},{0,0x00000},{1,0x00047},{1,0x00067}},{{0,0x00000},{0,0x00000},{1,0x00048},{1,0x00068}},
+   {{0,0x00000},{0,0x00000},{1,0x00049},{1,0x00069}},{{0,0x00000},{0,0x00000},{1,0x0004A},{1,0x0006A}},
+   {{0,0x00000},{0,0x00000},{1,0x0004B},{1,0x0006B}},{{0,0x00000},{0,0x00000},{1,0x0004C},{1,0x0006C}},
+   {{0,0x00000},{0,0x00000},{1,0x0004D},{1,0x0006D}},{{0,0x00000},{0,0x00000},{1,0x0004E},{1,0x0006E}},
+   {{0,0x00000},{0,0x00000},{1,0x0004F},{1,0x0006F}},{{0,0x00000},{0,0x00000},{1,0x00050},{1,0x00070}},
+   {{0,0x00000},{0,0x00000},{1,0x00051},{1,0x00071}},{{0,0x00000},{0,0x00000},{1,0x00052},{1,0x00072}},
+   {{0,0x00000},{0,0x00000},{1,0x00053},{1,0x00073}},{{0,0x00000},{0,0x00000},{1,0x00054},{1,0x00074}},
+   {{0,0x00000},{0,0x00000},{1,0x00055},{1,0x00075}},{{0,0x00000},{0,0x00000},{1,0x00056},{1,0x00076}},
+   {{0,0x00000},{0,0x00000},{1,0x00057},{1,0x00077}},{{0,0x00000},{0,0x00000},{1,0x00058},{1,0x00078}},
+   {{0,0x00000},{0,0x00000},{1,0x00059},{1,0x00079}},{{0,0x00000},{0,0x00000},{1,0x0005A},{1,0x0007A}},
+   {{0,0x00000},{0,0x00000},{1,0x00061},{1,0x00061}},{{0,0x00000},{0,0x00000},{1,0x00062},{1,0x00062}},
+   {{0,0x00000},{0,0x00000},{1,0x00063},{1,0x00063}},{{0,0x00000},{0,0x00000},{1,0x00064},{1,0x00064}},
+   {{0,0x00000},{0,0x00000},{1,0x00065},{1,0x00065}},{{0,0x00000},{0,0x00000},{1,0x00066},{1,0x00066}}
+  },
+
+  /* block 166 */
+  {{{0,0x00000},{0,0x00000},{1,0x00067},{1,0x00067}},{{0,0x00000},{0,0x00000},{1,0x00068},{1,0x00068}},
+   {{0,0x00000},{0,0x00000},{1,0x00069},{1,0x00069}},{{0,0x00000},{0,0x00000},{1,0x0006A},{1,0x0006A}},
+   {{0,0x00000},{0,0x00000},{1,0x0006B},{1,0x0006B}},{{0,0x00000},{0,0x00000},{1,0x0006C},{1,0x0006C}},
+   {{0,0x00000},{0,0x00000},{1,0x0006D},{1,0x0006D}},{{0,0x00000},{0,0x00000},{1,0x0006E},{1,0x0006E}},
+   {{0,0x00000},{0,0x00000},{1,0x0006F},{1,0x0006F}},{{0,0x00000},{0,0x00000},{1,0x00070},{1,0x00070}},
+   {{0,0x00000},{0,0x00000},{1,0x00071},{1,0x00071}},{{0,0x00000},{0,0x00000},{1,0x00072},{1,0x00072}},
+   {{0,0x00000},{0,0x00000},{1,0x00073},{1,0x00073}},{{0,0x00000},{0,0x00000},{1,0x00074},{1,0x00074}},
+   {{0,0x00000},{0,0x00000},{1,0x00075},{1,0x00075}},{{0,0x00000},{0,0x00000},{1,0x00076},{1,0x00076}},
+   {{0,0x00000},{0,0x00000},{1,0x00077},{1,0x00077}},{{0,0x00000},{0,0x00000},{1,0x00078},{1,0x00078}},
+   {{0,0x00000},{0,0x00000},{1,0x00079},{1,0x00079}},{{0,0x00000},{0,0x00000},{1,0x0007A},{1,0x0007A}},
+   {{0,0x00000},{0,0x00000},{1,0x00041},{1,0x00061}},{{0,0x00000},{0,0x00000},{1,0x00042},{1,0x00062}},
+   {{0,0x00000},{0,0x00000},{1,0x00043},{1,0x00063}},{{0,0x00000},{0,0x00000},{1,0x00044},{1,0x00064}},
+   {{0,0x00000},{0,0x00000},{1,0x00045},{1,0x00065}},{{0,0x00000},{0,0x00000},{1,0x00046},{1,0x00066}},
+   {{0,0x00000},{0,0x00000},{1,0x00047},{1,0x00067}},{{0,0x00000},{0,0x00000},{1,0x00048},{1,0x00068}},
+   {{0,0x00000},{0,0x00000},{1,0x00049},{1,0x00069}},{{0,0x00000},{0,0x00000},{1,0x0004A},{1,0x0006A}},
+   {{0,0x00000},{0,0x00000},{1,0x0004B},{1,0x0006B}},{{0,0x00000},{0,0x00000},{1,0x0004C},{1,0x0006C}},
+   {{0,0x00000},{0,0x00000},{1,0x0004D},{1,0x0006D}},{{0,0x00000},{0,0x00000},{1,0x0004E},{1,0x0006E}},
+   {{0,0x00000},{0,0x00000},{1,0x0004F},{1,0x0006F}},{{0,0x00000},{0,0x00000},{1,0x00050},{1,0x00070}},
+   {{0,0x00000},{0,0x00000},{1,0x00051},{1,0x00071}},{{0,0x00000},{0,0x00000},{1,0x00052},{1,0x00072}},
+   {{0,0x00000},{0,0x00000},{1,0x00053},{1,0x00073}},{{0,0x00000},{0,0x00000},{1,0x00054},{1,0x00074}},
+   {{0,0x00000},{0,0x00000},{1,0x00055},{1,0x00075}},{{0,0x00000},{0,0x00000},{1,0x00056},{1,0x00076}},
+   {{0,0x00000},{0,0x00000},{1,0x00057},{1,0x00077}},{{0,0x00000},{0,0x00000},{1,0x00058},{1,0x00078}},
+   {{0,0x00000},{0,0x00000},{1,0x00059},{1,0x00079}},{{0,0x00000},{0,0x00000},{1,0x0005A},{1,0x0007A}},
+   {{0,0x00000},{0,0x00000},{1,0x00061},{1,0x00061}},{{0,0x00000},{0,0x00000},{1,0x00062},{1,0x00062}},
+   {{0,0x00000},{0,0x00000},{1,0x00063},{1,0x00063}},{{0,0x00000},{0,0x00000},{1,0x00064},{1,0x00064}},
+   {{0,0x00000},{0,0x00000},{1,0x00065},{1,0x00065}},{{0,0x00000},{0,0x00000},{1,0x00066},{1,0x00066}},
+   {{0,0x00000},{0,0x00000},{1,0x00067},{1,0x00067}},{{0,0x00000},{0,0x00000},{1,0x00068},{1,0x00068}},
+   {{0,0x00000},{0,0x00000},{1,0x00069},{1,0x00069}},{{0,0x00000},{0,0x00000},{1,0x0006A},{1,0x0006A}},
+   {{0,0x00000},{0,0x00000},{1,0x0006B},{1,0x0006B}},{{0,0x00000},{0,0x00000},{1,0x0006C},{1,0x0006C}},
+   {{0,0x00000},{0,0x00000},{1,0x0006D},{1,0x0006D}},{{0,0x00000},{0,0x00000},{1,0x0006E},{1,0x0006E}},
+   {{0,0x00000},{0,0x00000},{1,0x0006F},{1,0x0006F}},{{0,0x00000},{0,0x00000},{1,0x00070},{1,0x00070}},
+   {{0,0x00000},{0,0x00000},{1,0x00071},{1,0x00071}},{{0,0x00000},{0,0x00000},{1,0x00072},{1,0x00072}}
+  },
+
+  /* block 167 */
+  {{{0,0x00000},{0,0x00000},{1,0x00073},{1,0x00073}},{{0,0x00000},{0,0x00000},{1,0x00074},{1,0x00074}},
+   {{0,0x00000},{0,0x00000},{1,0x00075},{1,0x00075}},{{0,0x00000},{0,0x00000},{1,0x00076},{1,0x00076}},
+   {{0,0x00000},{0,0x00000},{1,0x00077},{1,0x00077}},{{0,0x00000},{0,0x00000},{1,0x00078},{1,0x00078}},
+   {{0,0x00000},{0,0x00000},{1,0x00079},{1,0x00079}},{{0,0x00000},{0,0x00000},{1,0x0007A},{1,0x0007A}},
+   {{0,0x00000},{0,0x00000},{1,0x00041},{1,0x00061}},{{0,0x00000},{0,0x00000},{1,0x00042},{1,0x00062}},
+   {{0,0x00000},{0,0x00000},{1,0x00043},{1,0x00063}},{{0,0x00000},{0,0x00000},{1,0x00044},{1,0x00064}},
+   {{0,0x00000},{0,0x00000},{1,0x00045},{1,0x00065}},{{0,0x00000},{0,0x00000},{1,0x00046},{1,0x00066}},
+   {{0,0x00000},{0,0x00000},{1,0x00047},{1,0x00067}},{{0,0x00000},{0,0x00000},{1,0x00048},{1,0x00068}},
+   {{0,0x00000},{0,0x00000},{1,0x00049},{1,0x00069}},{{0,0x00000},{0,0x00000},{1,0x0004A},{1,0x0006A}},
+   {{0,0x00000},{0,0x00000},{1,0x0004B},{1,0x0006B}},{{0,0x00000},{0,0x00000},{1,0x0004C},{1,0x0006C}},
+   {{0,0x00000},{0,0x00000},{1,0x0004D},{1,0x0006D}},{{0,0x00000},{0,0x00000},{1,0x0004E},{1,0x0006E}},
+   {{0,0x00000},{0,0x00000},{1,0x0004F},{1,0x0006F}},{{0,0x00000},{0,0x00000},{1,0x00050},{1,0x00070}},
+   {{0,0x00000},{0,0x00000},{1,0x00051},{1,0x00071}},{{0,0x00000},{0,0x00000},{1,0x00052},{1,0x00072}},
+   {{0,0x00000},{0,0x00000},{1,0x00053},{1,0x00073}},{{0,0x00000},{0,0x00000},{1,0x00054},{1,0x00074}},
+   {{0,0x00000},{0,0x00000},{1,0x00055},{1,0x00075}},{{0,0x00000},{0,0x00000},{1,0x00056},{1,0x00076}},
+   {{0,0x00000},{0,0x00000},{1,0x00057},{1,0x00077}},{{0,0x00000},{0,0x00000},{1,0x00058},{1,0x00078}},
+   {{0,0x00000},{0,0x00000},{1,0x00059},{1,0x00079}},{{0,0x00000},{0,0x00000},{1,0x0005A},{1,0x0007A}},
+   {{0,0x00000},{0,0x00000},{1,0x00061},{1,0x00061}},{{0,0x00000},{0,0x00000},{1,0x00062},{1,0x00062}},
+   {{0,0x00000},{0,0x00000},{1,0x00063},{1,0x00063}},{{0,0x00000},{0,0x00000},{1,0x00064},{1,0x00064}},
+   {{0,0x00000},{0,0x00000},{1,0x00065},{1,0x00065}},{{0,0x00000},{0,0x00000},{1,0x00066},{1,0x00066}},
+   {{0,0x00000},{0,0x00000},{1,0x00067},{1,0x00067}},{{0,0x00000},{0,0x00000},{1,0x00068},{1,0x00068}},
+   {{0,0x00000},{0,0x00000},{1,0x00069},{1,0x00069}},{{0,0x00000},{0,0x00000},{1,0x0006A},{1,0x0006A}},
+   {{0,0x00000},{0,0x00000},{1,0x0006B},{1,0x0006B}},{{0,0x00000},{0,0x00000},{1,0x0006C},{1,0x0006C}},
+   {{0,0x00000},{0,0x00000},{1,0x0006D},{1,0x0006D}},{{0,0x00000},{0,0x00000},{1,0x0006E},{1,0x0006E}},
+   {{0,0x00000},{0,0x00000},{1,0x0006F},{1,0x0006F}},{{0,0x00000},{0,0x00000},{1,0x00070},{1,0x00070}},
+   {{0,0x00000},{0,0x00000},{1,0x00071},{1,0x00071}},{{0,0x00000},{0,0x00000},{1,0x00072},{1,0x00072}},
+   {{0,0x00000},{0,0x00000},{1,0x00073},{1,0x00073}},{{0,0x00000},{0,0x00000},{1,0x00074},{1,0x00074}},
+   {{0,0x00000},{0,0x00000},{1,0x00075},{1,0x00075}},{{0,0x00000},{0,0x00000},{1,0x00076},{1,0x00076}},
+   {{0,0x00000},{0,0x00000},{1,0x00077},{1,0x00077}},{{0,0x00000},{0,0x00000},{1,0x00078},{1,0x00078}},
+   {{0,0x00000},{0,0x00000},{1,0x00079},{1,0x00079}},{{0,0x00000},{0,0x00000},{1,0x0007A},{1,0x0007A}},
+   {{0,0x00000},{0,0x00000},{1,0x00041},{1,0x00061}},{{0,0x00000},{0,0x00000},{1,0x00042},{1,0x00062}},
+   {{0,0x00000},{0,0x00000},{1,0x00043},{1,0x00063}},{{0,0x00000},{0,0x00000},{1,0x00044},{1,0x00064}}
+  },
+
+  /* block 168 */
+  {{{0,0x00000},{0,0x00000},{1,0x00045},{1,0x00065}},{{0,0x00000},{0,0x00000},{1,0x00046},{1,0x00066}},
+   {{0,0x00000},{0,0x00000},{1,0x00047},{1,0x00067}},{{0,0x00000},{0,0x00000},{1,0x00048},{1,0x00068}},
+   {{0,0x00000},{0,0x00000},{1,0x00049},{1,0x00069}},{{0,0x00000},{0,0x00000},{1,0x0004A},{1,0x0006A}},
+   {{0,0x00000},{0,0x00000},{1,0x0004B},{1,0x0006B}},{{0,0x00000},{0,0x00000},{1,0x0004C},{1,0x0006C}},
+   {{0,0x00000},{0,0x00000},{1,0x0004D},{1,0x0006D}},{{0,0x00000},{0,0x00000},{1,0x0004E},{1,0x0006E}},
+   {{0,0x00000},{0,0x00000},{1,0x0004F},{1,0x0006F}},{{0,0x00000},{0,0x00000},{1,0x00050},{1,0x00070}},
+   {{0,0x00000},{0,0x00000},{1,0x00051},{1,0x00071}},{{0,0x00000},{0,0x00000},{1,0x00052},{1,0x00072}},
+   {{0,0x00000},{0,0x00000},{1,0x00053},{1,0x00073}},{{0,0x00000},{0,0x00000},{1,0x00054},{1,0x00074}},
+   {{0,0x00000},{0,0x00000},{1,0x00055},{1,0x00075}},{{0,0x00000},{0,0x00000},{1,0x00056},{1,0x00076}},
+   {{0,0x00000},{0,0x00000},{1,0x00057},{1,0x00077}},{{0,0x00000},{0,0x00000},{1,0x00058},{1,0x00078}},
+   {{0,0x00000},{0,0x00000},{1,0x00059},{1,0x00079}},{{0,0x00000},{0,0x00000},{1,0x0005A},{1,0x0007A}},
+   {{0,0x00000},{0,0x00000},{1,0x00061},{1,0x00061}},{{0,0x00000},{0,0x00000},{1,0x00062},{1,0x00062}},
+   {{0,0x00000},{0,0x00000},{1,0x00063},{1,0x00063}},{{0,0x00000},{0,0x00000},{1,0x00064},{1,0x00064}},
+   {{0,0x00000},{0,0x00000},{1,0x00065},{1,0x00065}},{{0,0x00000},{0,0x00000},{1,0x00066},{1,0x00066}},
+   {{0,0x00000},{0,0x00000},{1,0x00067},{1,0x00067}},{{0,0x00000},{0,0x00000},{1,0x00068},{1,0x00068}},
+   {{0,0x00000},{0,0x00000},{1,0x00069},{1,0x00069}},{{0,0x00000},{0,0x00000},{1,0x0006A},{1,0x0006A}},
+   {{0,0x00000},{0,0x00000},{1,0x0006B},{1,0x0006B}},{{0,0x00000},{0,0x00000},{1,0x0006C},{1,0x0006C}},
+   {{0,0x00000},{0,0x00000},{1,0x0006D},{1,0x0006D}},{{0,0x00000},{0,0x00000},{1,0x0006E},{1,0x0006E}},
+   {{0,0x00000},{0,0x00000},{1,0x0006F},{1,0x0006F}},{{0,0x00000},{0,0x00000},{1,0x00070},{1,0x00070}},
+   {{0,0x00000},{0,0x00000},{1,0x00071},{1,0x00071}},{{0,0x00000},{0,0x00000},{1,0x00072},{1,0x00072}},
+   {{0,0x00000},{0,0x00000},{1,0x00073},{1,0x00073}},{{0,0x00000},{0,0x00000},{1,0x00074},{1,0x00074}},
+   {{0,0x00000},{0,0x00000},{1,0x00075},{1,0x00075}},{{0,0x00000},{0,0x00000},{1,0x00076},{1,0x00076}},
+   {{0,0x00000},{0,0x00000},{1,0x00077},{1,0x00077}},{{0,0x00000},{0,0x00000},{1,0x00078},{1,0x00078}},
+   {{0,0x00000},{0,0x00000},{1,0x00079},{1,0x00079}},{{0,0x00000},{0,0x00000},{1,0x0007A},{1,0x0007A}},
+   {{0,0x00000},{0,0x00000},{1,0x00041},{1,0x00061}},{{0,0x00000},{0,0x00000},{1,0x00042},{1,0x00062}},
+   {{0,0x00000},{0,0x00000},{1,0x00043},{1,0x00063}},{{0,0x00000},{0,0x00000},{1,0x00044},{1,0x00064}},
+   {{0,0x00000},{0,0x00000},{1,0x00045},{1,0x00065}},{{0,0x00000},{0,0x00000},{1,0x00046},{1,0x00066}},
+   {{0,0x00000},{0,0x00000},{1,0x00047},{1,0x00067}},{{0,0x00000},{0,0x00000},{1,0x00048},{1,0x00068}},
+   {{0,0x00000},{0,0x00000},{1,0x00049},{1,0x00069}},{{0,0x00000},{0,0x00000},{1,0x0004A},{1,0x0006A}},
+   {{0,0x00000},{0,0x00000},{1,0x0004B},{1,0x0006B}},{{0,0x00000},{0,0x00000},{1,0x0004C},{1,0x0006C}},
+   {{0,0x00000},{0,0x00000},{1,0x0004D},{1,0x0006D}},{{0,0x00000},{0,0x00000},{1,0x0004E},{1,0x0006E}},
+   {{0,0x00000},{0,0x00000},{1,0x0004F},{1,0x0006F}},{{0,0x00000},{0,0x00000},{1,0x00050},{1,0x00070}}
+  },
+
+  /* block 169 */
+  {{{0,0x00000},{0,0x00000},{1,0x00051},{1,0x00071}},{{0,0x00000},{0,0x00000},{1,0x00052},{1,0x00072}},
+   {{0,0x00000},{0,0x00000},{1,0x00053},{1,0x00073}},{{0,0x00000},{0,0x00000},{1,0x00054},{1,0x00074}},
+   {{0,0x00000},{0,0x00000},{1,0x00055},{1,0x00075}},{{0,0x00000},{0,0x00000},{1,0x00056},{1,0x00076}},
+   {{0,0x00000},{0,0x00000},{1,0x00057},{1,0x00077}},{{0,0x00000},{0,0x00000},{1,0x00058},{1,0x00078}},
+   {{0,0x00000},{0,0x00000},{1,0x00059},{1,0x00079}},{{0,0x00000},{0,0x00000},{1,0x0005A},{1,0x0007A}},
+   {{0,0x00000},{0,0x00000},{1,0x00061},{1,0x00061}},{{0,0x00000},{0,0x00000},{1,0x00062},{1,0x00062}},
+   {{0,0x00000},{0,0x00000},{1,0x00063},{1,0x00063}},{{0,0x00000},{0,0x00000},{1,0x00064},{1,0x00064}},
+   {{0,0x00000},{0,0x00000},{1,0x00065},{1,0x00065}},{{0,0x00000},{0,0x00000},{1,0x00066},{1,0x00066}},
+   {{0,0x00000},{0,0x00000},{1,0x00067},{1,0x00067}},{{0,0x00000},{0,0x00000},{1,0x00068},{1,0x00068}},
+   {{0,0x00000},{0,0x00000},{1,0x00069},{1,0x00069}},{{0,0x00000},{0,0x00000},{1,0x0006A},{1,0x0006A}},
+   {{0,0x00000},{0,0x00000},{1,0x0006B},{1,0x0006B}},{{0,0x00000},{0,0x00000},{1,0x0006C},{1,0x0006C}},
+   {{0,0x00000},{0,0x00000},{1,0x0006D},{1,0x0006D}},{{0,0x00000},{0,0x00000},{1,0x0006E},{1,0x0006E}},
+   {{0,0x00000},{0,0x00000},{1,0x0006F},{1,0x0006F}},{{0,0x00000},{0,0x00000},{1,0x00070},{1,0x00070}},
+   {{0,0x00000},{0,0x00000},{1,0x00071},{1,0x00071}},{{0,0x00000},{0,0x00000},{1,0x00072},{1,0x00072}},
+   {{0,0x00000},{0,0x00000},{1,0x00073},{1,0x00073}},{{0,0x00000},{0,0x00000},{1,0x00074},{1,0x00074}},
+   {{0,0x00000},{0,0x00000},{1,0x00075},{1,0x00075}},{{0,0x00000},{0,0x00000},{1,0x00076},{1,0x00076}},
+   {{0,0x00000},{0,0x00000},{1,0x00077},{1,0x00077}},{{0,0x00000},{0,0x00000},{1,0x00078},{1,0x00078}},
+   {{0,0x00000},{0,0x00000},{1,0x00079},{1,0x00079}},{{0,0x00000},{0,0x00000},{1,0x0007A},{1,0x0007A}},
+   {{0,0x00000},{0,0x00000},{1,0x00131},{1,0x00131}},{{0,0x00000},{0,0x00000},{1,0x00237},{1,0x00237}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x00391},{1,0x003B1}},{{0,0x00000},{0,0x00000},{1,0x00392},{1,0x003B2}},
+   {{0,0x00000},{0,0x00000},{1,0x00393},{1,0x003B3}},{{0,0x00000},{0,0x00000},{1,0x00394},{1,0x003B4}},
+   {{0,0x00000},{0,0x00000},{1,0x00395},{1,0x003B5}},{{0,0x00000},{0,0x00000},{1,0x00396},{1,0x003B6}},
+   {{0,0x00000},{0,0x00000},{1,0x00397},{1,0x003B7}},{{0,0x00000},{0,0x00000},{1,0x00398},{1,0x003B8}},
+   {{0,0x00000},{0,0x00000},{1,0x00399},{1,0x003B9}},{{0,0x00000},{0,0x00000},{1,0x0039A},{1,0x003BA}},
+   {{0,0x00000},{0,0x00000},{1,0x0039B},{1,0x003BB}},{{0,0x00000},{0,0x00000},{1,0x0039C},{1,0x003BC}},
+   {{0,0x00000},{0,0x00000},{1,0x0039D},{1,0x003BD}},{{0,0x00000},{0,0x00000},{1,0x0039E},{1,0x003BE}},
+   {{0,0x00000},{0,0x00000},{1,0x0039F},{1,0x003BF}},{{0,0x00000},{0,0x00000},{1,0x003A0},{1,0x003C0}},
+   {{0,0x00000},{0,0x00000},{1,0x003A1},{1,0x003C1}},{{0,0x00000},{0,0x00000},{1,0x00398},{1,0x003B8}},
+   {{0,0x00000},{0,0x00000},{1,0x003A3},{1,0x003C3}},{{0,0x00000},{0,0x00000},{1,0x003A4},{1,0x003C4}},
+   {{0,0x00000},{0,0x00000},{1,0x003A5},{1,0x003C5}},{{0,0x00000},{0,0x00000},{1,0x003A6},{1,0x003C6}},
+   {{0,0x00000},{0,0x00000},{1,0x003A7},{1,0x003C7}},{{0,0x00000},{0,0x00000},{1,0x003A8},{1,0x003C8}}
+  },
+
+  /* block 170 */
+  {{{0,0x00000},{0,0x00000},{1,0x003A9},{1,0x003C9}},{{0,0x00000},{0,0x00000},{1,0x02207},{1,0x02207}},
+   {{0,0x00000},{0,0x00000},{1,0x003B1},{1,0x003B1}},{{0,0x00000},{0,0x00000},{1,0x003B2},{1,0x003B2}},
+   {{0,0x00000},{0,0x00000},{1,0x003B3},{1,0x003B3}},{{0,0x00000},{0,0x00000},{1,0x003B4},{1,0x003B4}},
+   {{0,0x00000},{0,0x00000},{1,0x003B5},{1,0x003B5}},{{0,0x00000},{0,0x00000},{1,0x003B6},{1,0x003B6}},
+   {{0,0x00000},{0,0x00000},{1,0x003B7},{1,0x003B7}},{{0,0x00000},{0,0x00000},{1,0x003B8},{1,0x003B8}},
+   {{0,0x00000},{0,0x00000},{1,0x003B9},{1,0x003B9}},{{0,0x00000},{0,0x00000},{1,0x003BA},{1,0x003BA}},
+   {{0,0x00000},{0,0x00000},{1,0x003BB},{1,0x003BB}},{{0,0x00000},{0,0x00000},{1,0x003BC},{1,0x003BC}},
+   {{0,0x00000},{0,0x00000},{1,0x003BD},{1,0x003BD}},{{0,0x00000},{0,0x00000},{1,0x003BE},{1,0x003BE}},
+   {{0,0x00000},{0,0x00000},{1,0x003BF},{1,0x003BF}},{{0,0x00000},{0,0x00000},{1,0x003C0},{1,0x003C0}},
+   {{0,0x00000},{0,0x00000},{1,0x003C1},{1,0x003C1}},{{0,0x00000},{0,0x00000},{1,0x003C2},{1,0x003C3}},
+   {{0,0x00000},{0,0x00000},{1,0x003C3},{1,0x003C3}},{{0,0x00000},{0,0x00000},{1,0x003C4},{1,0x003C4}},
+   {{0,0x00000},{0,0x00000},{1,0x003C5},{1,0x003C5}},{{0,0x00000},{0,0x00000},{1,0x003C6},{1,0x003C6}},
+   {{0,0x00000},{0,0x00000},{1,0x003C7},{1,0x003C7}},{{0,0x00000},{0,0x00000},{1,0x003C8},{1,0x003C8}},
+   {{0,0x00000},{0,0x00000},{1,0x003C9},{1,0x003C9}},{{0,0x00000},{0,0x00000},{1,0x02202},{1,0x02202}},
+   {{0,0x00000},{0,0x00000},{1,0x003B5},{1,0x003B5}},{{0,0x00000},{0,0x00000},{1,0x003B8},{1,0x003B8}},
+   {{0,0x00000},{0,0x00000},{1,0x003BA},{1,0x003BA}},{{0,0x00000},{0,0x00000},{1,0x003C6},{1,0x003C6}},
+   {{0,0x00000},{0,0x00000},{1,0x003C1},{1,0x003C1}},{{0,0x00000},{0,0x00000},{1,0x003C0},{1,0x003C0}},
+   {{0,0x00000},{0,0x00000},{1,0x00391},{1,0x003B1}},{{0,0x00000},{0,0x00000},{1,0x00392},{1,0x003B2}},
+   {{0,0x00000},{0,0x00000},{1,0x00393},{1,0x003B3}},{{0,0x00000},{0,0x00000},{1,0x00394},{1,0x003B4}},
+   {{0,0x00000},{0,0x00000},{1,0x00395},{1,0x003B5}},{{0,0x00000},{0,0x00000},{1,0x00396},{1,0x003B6}},
+   {{0,0x00000},{0,0x00000},{1,0x00397},{1,0x003B7}},{{0,0x00000},{0,0x00000},{1,0x00398},{1,0x003B8}},
+   {{0,0x00000},{0,0x00000},{1,0x00399},{1,0x003B9}},{{0,0x00000},{0,0x00000},{1,0x0039A},{1,0x003BA}},
+   {{0,0x00000},{0,0x00000},{1,0x0039B},{1,0x003BB}},{{0,0x00000},{0,0x00000},{1,0x0039C},{1,0x003BC}},
+   {{0,0x00000},{0,0x00000},{1,0x0039D},{1,0x003BD}},{{0,0x00000},{0,0x00000},{1,0x0039E},{1,0x003BE}},
+   {{0,0x00000},{0,0x00000},{1,0x0039F},{1,0x003BF}},{{0,0x00000},{0,0x00000},{1,0x003A0},{1,0x003C0}},
+   {{0,0x00000},{0,0x00000},{1,0x003A1},{1,0x003C1}},{{0,0x00000},{0,0x00000},{1,0x00398},{1,0x003B8}},
+   {{0,0x00000},{0,0x00000},{1,0x003A3},{1,0x003C3}},{{0,0x00000},{0,0x00000},{1,0x003A4},{1,0x003C4}},
+   {{0,0x00000},{0,0x00000},{1,0x003A5},{1,0x003C5}},{{0,0x00000},{0,0x00000},{1,0x003A6},{1,0x003C6}},
+   {{0,0x00000},{0,0x00000},{1,0x003A7},{1,0x003C7}},{{0,0x00000},{0,0x00000},{1,0x003A8},{1,0x003C8}},
+   {{0,0x00000},{0,0x00000},{1,0x003A9},{1,0x003C9}},{{0,0x00000},{0,0x00000},{1,0x02207},{1,0x02207}},
+   {{0,0x00000},{0,0x00000},{1,0x003B1},{1,0x003B1}},{{0,0x00000},{0,0x00000},{1,0x003B2},{1,0x003B2}},
+   {{0,0x00000},{0,0x00000},{1,0x003B3},{1,0x003B3}},{{0,0x00000},{0,0x00000},{1,0x003B4},{1,0x003B4}}
+  },
+
+  /* block 171 */
+  {{{0,0x00000},{0,0x00000},{1,0x003B5},{1,0x003B5}},{{0,0x00000},{0,0x00000},{1,0x003B6},{1,0x003B6}},
+   {{0,0x00000},{0,0x00000},{1,0x003B7},{1,0x003B7}},{{0,0x00000},{0,0x00000},{1,0x003B8},{1,0x003B8}},
+   {{0,0x00000},{0,0x00000},{1,0x003B9},{1,0x003B9}},{{0,0x00000},{0,0x00000},{1,0x003BA},{1,0x003BA}},
+   {{0,0x00000},{0,0x00000},{1,0x003BB},{1,0x003BB}},{{0,0x00000},{0,0x00000},{1,0x003BC},{1,0x003BC}},
+   {{0,0x00000},{0,0x00000},{1,0x003BD},{1,0x003BD}},{{0,0x00000},{0,0x00000},{1,0x003BE},{1,0x003BE}},
+   {{0,0x00000},{0,0x00000},{1,0x003BF},{1,0x003BF}},{{0,0x00000},{0,0x00000},{1,0x003C0},{1,0x003C0}},
+   {{0,0x00000},{0,0x00000},{1,0x003C1},{1,0x003C1}},{{0,0x00000},{0,0x00000},{1,0x003C2},{1,0x003C3}},
+   {{0,0x00000},{0,0x00000},{1,0x003C3},{1,0x003C3}},{{0,0x00000},{0,0x00000},{1,0x003C4},{1,0x003C4}},
+   {{0,0x00000},{0,0x00000},{1,0x003C5},{1,0x003C5}},{{0,0x00000},{0,0x00000},{1,0x003C6},{1,0x003C6}},
+   {{0,0x00000},{0,0x00000},{1,0x003C7},{1,0x003C7}},{{0,0x00000},{0,0x00000},{1,0x003C8},{1,0x003C8}},
+   {{0,0x00000},{0,0x00000},{1,0x003C9},{1,0x003C9}},{{0,0x00000},{0,0x00000},{1,0x02202},{1,0x02202}},
+   {{0,0x00000},{0,0x00000},{1,0x003B5},{1,0x003B5}},{{0,0x00000},{0,0x00000},{1,0x003B8},{1,0x003B8}},
+   {{0,0x00000},{0,0x00000},{1,0x003BA},{1,0x003BA}},{{0,0x00000},{0,0x00000},{1,0x003C6},{1,0x003C6}},
+   {{0,0x00000},{0,0x00000},{1,0x003C1},{1,0x003C1}},{{0,0x00000},{0,0x00000},{1,0x003C0},{1,0x003C0}},
+   {{0,0x00000},{0,0x00000},{1,0x00391},{1,0x003B1}},{{0,0x00000},{0,0x00000},{1,0x00392},{1,0x003B2}},
+   {{0,0x00000},{0,0x00000},{1,0x00393},{1,0x003B3}},{{0,0x00000},{0,0x00000},{1,0x00394},{1,0x003B4}},
+   {{0,0x00000},{0,0x00000},{1,0x00395},{1,0x003B5}},{{0,0x00000},{0,0x00000},{1,0x00396},{1,0x003B6}},
+   {{0,0x00000},{0,0x00000},{1,0x00397},{1,0x003B7}},{{0,0x00000},{0,0x00000},{1,0x00398},{1,0x003B8}},
+   {{0,0x00000},{0,0x00000},{1,0x00399},{1,0x003B9}},{{0,0x00000},{0,0x00000},{1,0x0039A},{1,0x003BA}},
+   {{0,0x00000},{0,0x00000},{1,0x0039B},{1,0x003BB}},{{0,0x00000},{0,0x00000},{1,0x0039C},{1,0x003BC}},
+   {{0,0x00000},{0,0x00000},{1,0x0039D},{1,0x003BD}},{{0,0x00000},{0,0x00000},{1,0x0039E},{1,0x003BE}},
+   {{0,0x00000},{0,0x00000},{1,0x0039F},{1,0x003BF}},{{0,0x00000},{0,0x00000},{1,0x003A0},{1,0x003C0}},
+   {{0,0x00000},{0,0x00000},{1,0x003A1},{1,0x003C1}},{{0,0x00000},{0,0x00000},{1,0x00398},{1,0x003B8}},
+   {{0,0x00000},{0,0x00000},{1,0x003A3},{1,0x003C3}},{{0,0x00000},{0,0x00000},{1,0x003A4},{1,0x003C4}},
+   {{0,0x00000},{0,0x00000},{1,0x003A5},{1,0x003C5}},{{0,0x00000},{0,0x00000},{1,0x003A6},{1,0x003C6}},
+   {{0,0x00000},{0,0x00000},{1,0x003A7},{1,0x003C7}},{{0,0x00000},{0,0x00000},{1,0x003A8},{1,0x003C8}},
+   {{0,0x00000},{0,0x00000},{1,0x003A9},{1,0x003C9}},{{0,0x00000},{0,0x00000},{1,0x02207},{1,0x02207}},
+   {{0,0x00000},{0,0x00000},{1,0x003B1},{1,0x003B1}},{{0,0x00000},{0,0x00000},{1,0x003B2},{1,0x003B2}},
+   {{0,0x00000},{0,0x00000},{1,0x003B3},{1,0x003B3}},{{0,0x00000},{0,0x00000},{1,0x003B4},{1,0x003B4}},
+   {{0,0x00000},{0,0x00000},{1,0x003B5},{1,0x003B5}},{{0,0x00000},{0,0x00000},{1,0x003B6},{1,0x003B6}},
+   {{0,0x00000},{0,0x00000},{1,0x003B7},{1,0x003B7}},{{0,0x00000},{0,0x00000},{1,0x003B8},{1,0x003B8}},
+   {{0,0x00000},{0,0x00000},{1,0x003B9},{1,0x003B9}},{{0,0x00000},{0,0x00000},{1,0x003BA},{1,0x003BA}}
+  },
+
+  /* block 172 */
+  {{{0,0x00000},{0,0x00000},{1,0x003BB},{1,0x003BB}},{{0,0x00000},{0,0x00000},{1,0x003BC},{1,0x003BC}},
+   {{0,0x00000},{0,0x00000},{1,0x003BD},{1,0x003BD}},{{0,0x00000},{0,0x00000},{1,0x003BE},{1,0x003BE}},
+   {{0,0x00000},{0,0x00000},{1,0x003BF},{1,0x003BF}},{{0,0x00000},{0,0x00000},{1,0x003C0},{1,0x003C0}},
+   {{0,0x00000},{0,0x00000},{1,0x003C1},{1,0x003C1}},{{0,0x00000},{0,0x00000},{1,0x003C2},{1,0x003C3}},
+   {{0,0x00000},{0,0x00000},{1,0x003C3},{1,0x003C3}},{{0,0x00000},{0,0x00000},{1,0x003C4},{1,0x003C4}},
+   {{0,0x00000},{0,0x00000},{1,0x003C5},{1,0x003C5}},{{0,0x00000},{0,0x00000},{1,0x003C6},{1,0x003C6}},
+   {{0,0x00000},{0,0x00000},{1,0x003C7},{1,0x003C7}},{{0,0x00000},{0,0x00000},{1,0x003C8},{1,0x003C8}},
+   {{0,0x00000},{0,0x00000},{1,0x003C9},{1,0x003C9}},{{0,0x00000},{0,0x00000},{1,0x02202},{1,0x02202}},
+   {{0,0x00000},{0,0x00000},{1,0x003B5},{1,0x003B5}},{{0,0x00000},{0,0x00000},{1,0x003B8},{1,0x003B8}},
+   {{0,0x00000},{0,0x00000},{1,0x003BA},{1,0x003BA}},{{0,0x00000},{0,0x00000},{1,0x003C6},{1,0x003C6}},
+   {{0,0x00000},{0,0x00000},{1,0x003C1},{1,0x003C1}},{{0,0x00000},{0,0x00000},{1,0x003C0},{1,0x003C0}},
+   {{0,0x00000},{0,0x00000},{1,0x00391},{1,0x003B1}},{{0,0x00000},{0,0x00000},{1,0x00392},{1,0x003B2}},
+   {{0,0x00000},{0,0x00000},{1,0x00393},{1,0x003B3}},{{0,0x00000},{0,0x00000},{1,0x00394},{1,0x003B4}},
+   {{0,0x00000},{0,0x00000},{1,0x00395},{1,0x003B5}},{{0,0x00000},{0,0x00000},{1,0x00396},{1,0x003B6}},
+   {{0,0x00000},{0,0x00000},{1,0x00397},{1,0x003B7}},{{0,0x00000},{0,0x00000},{1,0x00398},{1,0x003B8}},
+   {{0,0x00000},{0,0x00000},{1,0x00399},{1,0x003B9}},{{0,0x00000},{0,0x00000},{1,0x0039A},{1,0x003BA}},
+   {{0,0x00000},{0,0x00000},{1,0x0039B},{1,0x003BB}},{{0,0x00000},{0,0x00000},{1,0x0039C},{1,0x003BC}},
+   {{0,0x00000},{0,0x00000},{1,0x0039D},{1,0x003BD}},{{0,0x00000},{0,0x00000},{1,0x0039E},{1,0x003BE}},
+   {{0,0x00000},{0,0x00000},{1,0x0039F},{1,0x003BF}},{{0,0x00000},{0,0x00000},{1,0x003A0},{1,0x003C0}},
+   {{0,0x00000},{0,0x00000},{1,0x003A1},{1,0x003C1}},{{0,0x00000},{0,0x00000},{1,0x00398},{1,0x003B8}},
+   {{0,0x00000},{0,0x00000},{1,0x003A3},{1,0x003C3}},{{0,0x00000},{0,0x00000},{1,0x003A4},{1,0x003C4}},
+   {{0,0x00000},{0,0x00000},{1,0x003A5},{1,0x003C5}},{{0,0x00000},{0,0x00000},{1,0x003A6},{1,0x003C6}},
+   {{0,0x00000},{0,0x00000},{1,0x003A7},{1,0x003C7}},{{0,0x00000},{0,0x00000},{1,0x003A8},{1,0x003C8}},
+   {{0,0x00000},{0,0x00000},{1,0x003A9},{1,0x003C9}},{{0,0x00000},{0,0x00000},{1,0x02207},{1,0x02207}},
+   {{0,0x00000},{0,0x00000},{1,0x003B1},{1,0x003B1}},{{0,0x00000},{0,0x00000},{1,0x003B2},{1,0x003B2}},
+   {{0,0x00000},{0,0x00000},{1,0x003B3},{1,0x003B3}},{{0,0x00000},{0,0x00000},{1,0x003B4},{1,0x003B4}},
+   {{0,0x00000},{0,0x00000},{1,0x003B5},{1,0x003B5}},{{0,0x00000},{0,0x00000},{1,0x003B6},{1,0x003B6}},
+   {{0,0x00000},{0,0x00000},{1,0x003B7},{1,0x003B7}},{{0,0x00000},{0,0x00000},{1,0x003B8},{1,0x003B8}},
+   {{0,0x00000},{0,0x00000},{1,0x003B9},{1,0x003B9}},{{0,0x00000},{0,0x00000},{1,0x003BA},{1,0x003BA}},
+   {{0,0x00000},{0,0x00000},{1,0x003BB},{1,0x003BB}},{{0,0x00000},{0,0x00000},{1,0x003BC},{1,0x003BC}},
+   {{0,0x00000},{0,0x00000},{1,0x003BD},{1,0x003BD}},{{0,0x00000},{0,0x00000},{1,0x003BE},{1,0x003BE}},
+   {{0,0x00000},{0,0x00000},{1,0x003BF},{1,0x003BF}},{{0,0x00000},{0,0x00000},{1,0x003C0},{1,0x003C0}}
+  },
+
+  /* block 173 */
+  {{{0,0x00000},{0,0x00000},{1,0x003C1},{1,0x003C1}},{{0,0x00000},{0,0x00000},{1,0x003C2},{1,0x003C3}},
+   {{0,0x00000},{0,0x00000},{1,0x003C3},{1,0x003C3}},{{0,0x00000},{0,0x00000},{1,0x003C4},{1,0x003C4}},
+   {{0,0x00000},{0,0x00000},{1,0x003C5},{1,0x003C5}},{{0,0x00000},{0,0x00000},{1,0x003C6},{1,0x003C6}},
+   {{0,0x00000},{0,0x00000},{1,0x003C7},{1,0x003C7}},{{0,0x00000},{0,0x00000},{1,0x003C8},{1,0x003C8}},
+   {{0,0x00000},{0,0x00000},{1,0x003C9},{1,0x003C9}},{{0,0x00000},{0,0x00000},{1,0x02202},{1,0x02202}},
+   {{0,0x00000},{0,0x00000},{1,0x003B5},{1,0x003B5}},{{0,0x00000},{0,0x00000},{1,0x003B8},{1,0x003B8}},
+   {{0,0x00000},{0,0x00000},{1,0x003BA},{1,0x003BA}},{{0,0x00000},{0,0x00000},{1,0x003C6},{1,0x003C6}},
+   {{0,0x00000},{0,0x00000},{1,0x003C1},{1,0x003C1}},{{0,0x00000},{0,0x00000},{1,0x003C0},{1,0x003C0}},
+   {{0,0x00000},{0,0x00000},{1,0x00391},{1,0x003B1}},{{0,0x00000},{0,0x00000},{1,0x00392},{1,0x003B2}},
+   {{0,0x00000},{0,0x00000},{1,0x00393},{1,0x003B3}},{{0,0x00000},{0,0x00000},{1,0x00394},{1,0x003B4}},
+   {{0,0x00000},{0,0x00000},{1,0x00395},{1,0x003B5}},{{0,0x00000},{0,0x00000},{1,0x00396},{1,0x003B6}},
+   {{0,0x00000},{0,0x00000},{1,0x00397},{1,0x003B7}},{{0,0x00000},{0,0x00000},{1,0x00398},{1,0x003B8}},
+   {{0,0x00000},{0,0x00000},{1,0x00399},{1,0x003B9}},{{0,0x00000},{0,0x00000},{1,0x0039A},{1,0x003BA}},
+   {{0,0x00000},{0,0x00000},{1,0x0039B},{1,0x003BB}},{{0,0x00000},{0,0x00000},{1,0x0039C},{1,0x003BC}},
+   {{0,0x00000},{0,0x00000},{1,0x0039D},{1,0x003BD}},{{0,0x00000},{0,0x00000},{1,0x0039E},{1,0x003BE}},
+   {{0,0x00000},{0,0x00000},{1,0x0039F},{1,0x003BF}},{{0,0x00000},{0,0x00000},{1,0x003A0},{1,0x003C0}},
+   {{0,0x00000},{0,0x00000},{1,0x003A1},{1,0x003C1}},{{0,0x00000},{0,0x00000},{1,0x00398},{1,0x003B8}},
+   {{0,0x00000},{0,0x00000},{1,0x003A3},{1,0x003C3}},{{0,0x00000},{0,0x00000},{1,0x003A4},{1,0x003C4}},
+   {{0,0x00000},{0,0x00000},{1,0x003A5},{1,0x003C5}},{{0,0x00000},{0,0x00000},{1,0x003A6},{1,0x003C6}},
+   {{0,0x00000},{0,0x00000},{1,0x003A7},{1,0x003C7}},{{0,0x00000},{0,0x00000},{1,0x003A8},{1,0x003C8}},
+   {{0,0x00000},{0,0x00000},{1,0x003A9},{1,0x003C9}},{{0,0x00000},{0,0x00000},{1,0x02207},{1,0x02207}},
+   {{0,0x00000},{0,0x00000},{1,0x003B1},{1,0x003B1}},{{0,0x00000},{0,0x00000},{1,0x003B2},{1,0x003B2}},
+   {{0,0x00000},{0,0x00000},{1,0x003B3},{1,0x003B3}},{{0,0x00000},{0,0x00000},{1,0x003B4},{1,0x003B4}},
+   {{0,0x00000},{0,0x00000},{1,0x003B5},{1,0x003B5}},{{0,0x00000},{0,0x00000},{1,0x003B6},{1,0x003B6}},
+   {{0,0x00000},{0,0x00000},{1,0x003B7},{1,0x003B7}},{{0,0x00000},{0,0x00000},{1,0x003B8},{1,0x003B8}},
+   {{0,0x00000},{0,0x00000},{1,0x003B9},{1,0x003B9}},{{0,0x00000},{0,0x00000},{1,0x003BA},{1,0x003BA}},
+   {{0,0x00000},{0,0x00000},{1,0x003BB},{1,0x003BB}},{{0,0x00000},{0,0x00000},{1,0x003BC},{1,0x003BC}},
+   {{0,0x00000},{0,0x00000},{1,0x003BD},{1,0x003BD}},{{0,0x00000},{0,0x00000},{1,0x003BE},{1,0x003BE}},
+   {{0,0x00000},{0,0x00000},{1,0x003BF},{1,0x003BF}},{{0,0x00000},{0,0x00000},{1,0x003C0},{1,0x003C0}},
+   {{0,0x00000},{0,0x00000},{1,0x003C1},{1,0x003C1}},{{0,0x00000},{0,0x00000},{1,0x003C2},{1,0x003C3}},
+   {{0,0x00000},{0,0x00000},{1,0x003C3},{1,0x003C3}},{{0,0x00000},{0,0x00000},{1,0x003C4},{1,0x003C4}},
+   {{0,0x00000},{0,0x00000},{1,0x003C5},{1,0x003C5}},{{0,0x00000},{0,0x00000},{1,0x003C6},{1,0x003C6}}
+  },
+
+  /* block 174 */
+  {{{0,0x00000},{0,0x00000},{1,0x003C7},{1,0x003C7}},{{0,0x00000},{0,0x00000},{1,0x003C8},{1,0x003C8}},
+   {{0,0x00000},{0,0x00000},{1,0x003C9},{1,0x003C9}},{{0,0x00000},{0,0x00000},{1,0x02202},{1,0x02202}},
+   {{0,0x00000},{0,0x00000},{1,0x003B5},{1,0x003B5}},{{0,0x00000},{0,0x00000},{1,0x003B8},{1,0x003B8}},
+   {{0,0x00000},{0,0x00000},{1,0x003BA},{1,0x003BA}},{{0,0x00000},{0,0x00000},{1,0x003C6},{1,0x003C6}},
+   {{0,0x00000},{0,0x00000},{1,0x003C1},{1,0x003C1}},{{0,0x00000},{0,0x00000},{1,0x003C0},{1,0x003C0}},
+   {{0,0x00000},{0,0x00000},{1,0x003DC},{1,0x003DD}},{{0,0x00000},{0,0x00000},{1,0x003DD},{1,0x003DD}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x00030},{1,0x00030}},{{0,0x00000},{0,0x00000},{1,0x00031},{1,0x00031}},
+   {{0,0x00000},{0,0x00000},{1,0x00032},{1,0x00032}},{{0,0x00000},{0,0x00000},{1,0x00033},{1,0x00033}},
+   {{0,0x00000},{0,0x00000},{1,0x00034},{1,0x00034}},{{0,0x00000},{0,0x00000},{1,0x00035},{1,0x00035}},
+   {{0,0x00000},{0,0x00000},{1,0x00036},{1,0x00036}},{{0,0x00000},{0,0x00000},{1,0x00037},{1,0x00037}},
+   {{0,0x00000},{0,0x00000},{1,0x00038},{1,0x00038}},{{0,0x00000},{0,0x00000},{1,0x00039},{1,0x00039}},
+   {{0,0x00000},{0,0x00000},{1,0x00030},{1,0x00030}},{{0,0x00000},{0,0x00000},{1,0x00031},{1,0x00031}},
+   {{0,0x00000},{0,0x00000},{1,0x00032},{1,0x00032}},{{0,0x00000},{0,0x00000},{1,0x00033},{1,0x00033}},
+   {{0,0x00000},{0,0x00000},{1,0x00034},{1,0x00034}},{{0,0x00000},{0,0x00000},{1,0x00035},{1,0x00035}},
+   {{0,0x00000},{0,0x00000},{1,0x00036},{1,0x00036}},{{0,0x00000},{0,0x00000},{1,0x00037},{1,0x00037}},
+   {{0,0x00000},{0,0x00000},{1,0x00038},{1,0x00038}},{{0,0x00000},{0,0x00000},{1,0x00039},{1,0x00039}},
+   {{0,0x00000},{0,0x00000},{1,0x00030},{1,0x00030}},{{0,0x00000},{0,0x00000},{1,0x00031},{1,0x00031}},
+   {{0,0x00000},{0,0x00000},{1,0x00032},{1,0x00032}},{{0,0x00000},{0,0x00000},{1,0x00033},{1,0x00033}},
+   {{0,0x00000},{0,0x00000},{1,0x00034},{1,0x00034}},{{0,0x00000},{0,0x00000},{1,0x00035},{1,0x00035}},
+   {{0,0x00000},{0,0x00000},{1,0x00036},{1,0x00036}},{{0,0x00000},{0,0x00000},{1,0x00037},{1,0x00037}},
+   {{0,0x00000},{0,0x00000},{1,0x00038},{1,0x00038}},{{0,0x00000},{0,0x00000},{1,0x00039},{1,0x00039}},
+   {{0,0x00000},{0,0x00000},{1,0x00030},{1,0x00030}},{{0,0x00000},{0,0x00000},{1,0x00031},{1,0x00031}},
+   {{0,0x00000},{0,0x00000},{1,0x00032},{1,0x00032}},{{0,0x00000},{0,0x00000},{1,0x00033},{1,0x00033}},
+   {{0,0x00000},{0,0x00000},{1,0x00034},{1,0x00034}},{{0,0x00000},{0,0x00000},{1,0x00035},{1,0x00035}},
+   {{0,0x00000},{0,0x00000},{1,0x00036},{1,0x00036}},{{0,0x00000},{0,0x00000},{1,0x00037},{1,0x00037}},
+   {{0,0x00000},{0,0x00000},{1,0x00038},{1,0x00038}},{{0,0x00000},{0,0x00000},{1,0x00039},{1,0x00039}},
+   {{0,0x00000},{0,0x00000},{1,0x00030},{1,0x00030}},{{0,0x00000},{0,0x00000},{1,0x00031},{1,0x00031}},
+   {{0,0x00000},{0,0x00000},{1,0x00032},{1,0x00032}},{{0,0x00000},{0,0x00000},{1,0x00033},{1,0x00033}},
+   {{0,0x00000},{0,0x00000},{1,0x00034},{1,0x00034}},{{0,0x00000},{0,0x00000},{1,0x00035},{1,0x00035}},
+   {{0,0x00000},{0,0x00000},{1,0x00036},{1,0x00036}},{{0,0x00000},{0,0x00000},{1,0x00037},{1,0x00037}},
+   {{0,0x00000},{0,0x00000},{1,0x00038},{1,0x00038}},{{0,0x00000},{0,0x00000},{1,0x00039},{1,0x00039}}
+  },
+
+  /* block 175 */
+  {{{0,0x00000},{1,0x1E922},{0,0x00000},{1,0x1E922}},{{0,0x00000},{1,0x1E923},{0,0x00000},{1,0x1E923}},
+   {{0,0x00000},{1,0x1E924},{0,0x00000},{1,0x1E924}},{{0,0x00000},{1,0x1E925},{0,0x00000},{1,0x1E925}},
+   {{0,0x00000},{1,0x1E926},{0,0x00000},{1,0x1E926}},{{0,0x00000},{1,0x1E927},{0,0x00000},{1,0x1E927}},
+   {{0,0x00000},{1,0x1E928},{0,0x00000},{1,0x1E928}},{{0,0x00000},{1,0x1E929},{0,0x00000},{1,0x1E929}},
+   {{0,0x00000},{1,0x1E92A},{0,0x00000},{1,0x1E92A}},{{0,0x00000},{1,0x1E92B},{0,0x00000},{1,0x1E92B}},
+   {{0,0x00000},{1,0x1E92C},{0,0x00000},{1,0x1E92C}},{{0,0x00000},{1,0x1E92D},{0,0x00000},{1,0x1E92D}},
+   {{0,0x00000},{1,0x1E92E},{0,0x00000},{1,0x1E92E}},{{0,0x00000},{1,0x1E92F},{0,0x00000},{1,0x1E92F}},
+   {{0,0x00000},{1,0x1E930},{0,0x00000},{1,0x1E930}},{{0,0x00000},{1,0x1E931},{0,0x00000},{1,0x1E931}},
+   {{0,0x00000},{1,0x1E932},{0,0x00000},{1,0x1E932}},{{0,0x00000},{1,0x1E933},{0,0x00000},{1,0x1E933}},
+   {{0,0x00000},{1,0x1E934},{0,0x00000},{1,0x1E934}},{{0,0x00000},{1,0x1E935},{0,0x00000},{1,0x1E935}},
+   {{0,0x00000},{1,0x1E936},{0,0x00000},{1,0x1E936}},{{0,0x00000},{1,0x1E937},{0,0x00000},{1,0x1E937}},
+   {{0,0x00000},{1,0x1E938},{0,0x00000},{1,0x1E938}},{{0,0x00000},{1,0x1E939},{0,0x00000},{1,0x1E939}},
+   {{0,0x00000},{1,0x1E93A},{0,0x00000},{1,0x1E93A}},{{0,0x00000},{1,0x1E93B},{0,0x00000},{1,0x1E93B}},
+   {{0,0x00000},{1,0x1E93C},{0,0x00000},{1,0x1E93C}},{{0,0x00000},{1,0x1E93D},{0,0x00000},{1,0x1E93D}},
+   {{0,0x00000},{1,0x1E93E},{0,0x00000},{1,0x1E93E}},{{0,0x00000},{1,0x1E93F},{0,0x00000},{1,0x1E93F}},
+   {{0,0x00000},{1,0x1E940},{0,0x00000},{1,0x1E940}},{{0,0x00000},{1,0x1E941},{0,0x00000},{1,0x1E941}},
+   {{0,0x00000},{1,0x1E942},{0,0x00000},{1,0x1E942}},{{0,0x00000},{1,0x1E943},{0,0x00000},{1,0x1E943}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 176 */
+  {{{0,0x00000},{0,0x00000},{1,0x00627},{1,0x00627}},{{0,0x00000},{0,0x00000},{1,0x00628},{1,0x00628}},
+   {{0,0x00000},{0,0x00000},{1,0x0062C},{1,0x0062C}},{{0,0x00000},{0,0x00000},{1,0x0062F},{1,0x0062F}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x00648},{1,0x00648}},
+   {{0,0x00000},{0,0x00000},{1,0x00632},{1,0x00632}},{{0,0x00000},{0,0x00000},{1,0x0062D},{1,0x0062D}},
+   {{0,0x00000},{0,0x00000},{1,0x00637},{1,0x00637}},{{0,0x00000},{0,0x00000},{1,0x0064A},{1,0x0064A}},
+   {{0,0x00000},{0,0x00000},{1,0x00643},{1,0x00643}},{{0,0x00000},{0,0x00000},{1,0x00644},{1,0x00644}},
+   {{0,0x00000},{0,0x00000},{1,0x00645},{1,0x00645}},{{0,0x00000},{0,0x00000},{1,0x00646},{1,0x00646}},
+   {{0,0x00000},{0,0x00000},{1,0x00633},{1,0x00633}},{{0,0x00000},{0,0x00000},{1,0x00639},{1,0x00639}},
+   {{0,0x00000},{0,0x00000},{1,0x00641},{1,0x00641}},{{0,0x00000},{0,0x00000},{1,0x00635},{1,0x00635}},
+   {{0,0x00000},{0,0x00000},{1,0x00642},{1,0x00642}},{{0,0x00000},{0,0x00000},{1,0x00631},{1,0x00631}},
+   {{0,0x00000},{0,0x00000},{1,0x00634},{1,0x00634}},{{0,0x00000},{0,0x00000},{1,0x0062A},{1,0x0062A}},
+   {{0,0x00000},{0,0x00000},{1,0x0062B},{1,0x0062B}},{{0,0x00000},{0,0x00000},{1,0x0062E},{1,0x0062E}},
+   {{0,0x00000},{0,0x00000},{1,0x00630},{1,0x00630}},{{0,0x00000},{0,0x00000},{1,0x00636},{1,0x00636}},
+   {{0,0x00000},{0,0x00000},{1,0x00638},{1,0x00638}},{{0,0x00000},{0,0x00000},{1,0x0063A},{1,0x0063A}},
+   {{0,0x00000},{0,0x00000},{1,0x0066E},{1,0x0066E}},{{0,0x00000},{0,0x00000},{1,0x006BA},{1,0x006BA}},
+   {{0,0x00000},{0,0x00000},{1,0x006A1},{1,0x006A1}},{{0,0x00000},{0,0x00000},{1,0x0066F},{1,0x0066F}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x00628},{1,0x00628}},
+   {{0,0x00000},{0,0x00000},{1,0x0062C},{1,0x0062C}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x00647},{1,0x00647}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x0062D},{1,0x0062D}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x0064A},{1,0x0064A}},
+   {{0,0x00000},{0,0x00000},{1,0x00643},{1,0x00643}},{{0,0x00000},{0,0x00000},{1,0x00644},{1,0x00644}},
+   {{0,0x00000},{0,0x00000},{1,0x00645},{1,0x00645}},{{0,0x00000},{0,0x00000},{1,0x00646},{1,0x00646}},
+   {{0,0x00000},{0,0x00000},{1,0x00633},{1,0x00633}},{{0,0x00000},{0,0x00000},{1,0x00639},{1,0x00639}},
+   {{0,0x00000},{0,0x00000},{1,0x00641},{1,0x00641}},{{0,0x00000},{0,0x00000},{1,0x00635},{1,0x00635}},
+   {{0,0x00000},{0,0x00000},{1,0x00642},{1,0x00642}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x00634},{1,0x00634}},{{0,0x00000},{0,0x00000},{1,0x0062A},{1,0x0062A}},
+   {{0,0x00000},{0,0x00000},{1,0x0062B},{1,0x0062B}},{{0,0x00000},{0,0x00000},{1,0x0062E},{1,0x0062E}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x00636},{1,0x00636}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x0063A},{1,0x0063A}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 177 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x0062C},{1,0x0062C}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x0062D},{1,0x0062D}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x0064A},{1,0x0064A}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x00644},{1,0x00644}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x00646},{1,0x00646}},
+   {{0,0x00000},{0,0x00000},{1,0x00633},{1,0x00633}},{{0,0x00000},{0,0x00000},{1,0x00639},{1,0x00639}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x00635},{1,0x00635}},
+   {{0,0x00000},{0,0x00000},{1,0x00642},{1,0x00642}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x00634},{1,0x00634}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x0062E},{1,0x0062E}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x00636},{1,0x00636}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x0063A},{1,0x0063A}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x006BA},{1,0x006BA}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x0066F},{1,0x0066F}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x00628},{1,0x00628}},
+   {{0,0x00000},{0,0x00000},{1,0x0062C},{1,0x0062C}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x00647},{1,0x00647}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x0062D},{1,0x0062D}},
+   {{0,0x00000},{0,0x00000},{1,0x00637},{1,0x00637}},{{0,0x00000},{0,0x00000},{1,0x0064A},{1,0x0064A}},
+   {{0,0x00000},{0,0x00000},{1,0x00643},{1,0x00643}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x00645},{1,0x00645}},{{0,0x00000},{0,0x00000},{1,0x00646},{1,0x00646}},
+   {{0,0x00000},{0,0x00000},{1,0x00633},{1,0x00633}},{{0,0x00000},{0,0x00000},{1,0x00639},{1,0x00639}},
+   {{0,0x00000},{0,0x00000},{1,0x00641},{1,0x00641}},{{0,0x00000},{0,0x00000},{1,0x00635},{1,0x00635}},
+   {{0,0x00000},{0,0x00000},{1,0x00642},{1,0x00642}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x00634},{1,0x00634}},{{0,0x00000},{0,0x00000},{1,0x0062A},{1,0x0062A}},
+   {{0,0x00000},{0,0x00000},{1,0x0062B},{1,0x0062B}},{{0,0x00000},{0,0x00000},{1,0x0062E},{1,0x0062E}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x00636},{1,0x00636}},
+   {{0,0x00000},{0,0x00000},{1,0x00638},{1,0x00638}},{{0,0x00000},{0,0x00000},{1,0x0063A},{1,0x0063A}},
+   {{0,0x00000},{0,0x00000},{1,0x0066E},{1,0x0066E}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x006A1},{1,0x006A1}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 178 */
+  {{{0,0x00000},{0,0x00000},{1,0x00627},{1,0x00627}},{{0,0x00000},{0,0x00000},{1,0x00628},{1,0x00628}},
+   {{0,0x00000},{0,0x00000},{1,0x0062C},{1,0x0062C}},{{0,0x00000},{0,0x00000},{1,0x0062F},{1,0x0062F}},
+   {{0,0x00000},{0,0x00000},{1,0x00647},{1,0x00647}},{{0,0x00000},{0,0x00000},{1,0x00648},{1,0x00648}},
+   {{0,0x00000},{0,0x00000},{1,0x00632},{1,0x00632}},{{0,0x00000},{0,0x00000},{1,0x0062D},{1,0x0062D}},
+   {{0,0x00000},{0,0x00000},{1,0x00637},{1,0x00637}},{{0,0x00000},{0,0x00000},{1,0x0064A},{1,0x0064A}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x00644},{1,0x00644}},
+   {{0,0x00000},{0,0x00000},{1,0x00645},{1,0x00645}},{{0,0x00000},{0,0x00000},{1,0x00646},{1,0x00646}},
+   {{0,0x00000},{0,0x00000},{1,0x00633},{1,0x00633}},{{0,0x00000},{0,0x00000},{1,0x00639},{1,0x00639}},
+   {{0,0x00000},{0,0x00000},{1,0x00641},{1,0x00641}},{{0,0x00000},{0,0x00000},{1,0x00635},{1,0x00635}},
+   {{0,0x00000},{0,0x00000},{1,0x00642},{1,0x00642}},{{0,0x00000},{0,0x00000},{1,0x00631},{1,0x00631}},
+   {{0,0x00000},{0,0x00000},{1,0x00634},{1,0x00634}},{{0,0x00000},{0,0x00000},{1,0x0062A},{1,0x0062A}},
+   {{0,0x00000},{0,0x00000},{1,0x0062B},{1,0x0062B}},{{0,0x00000},{0,0x00000},{1,0x0062E},{1,0x0062E}},
+   {{0,0x00000},{0,0x00000},{1,0x00630},{1,0x00630}},{{0,0x00000},{0,0x00000},{1,0x00636},{1,0x00636}},
+   {{0,0x00000},{0,0x00000},{1,0x00638},{1,0x00638}},{{0,0x00000},{0,0x00000},{1,0x0063A},{1,0x0063A}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x00628},{1,0x00628}},
+   {{0,0x00000},{0,0x00000},{1,0x0062C},{1,0x0062C}},{{0,0x00000},{0,0x00000},{1,0x0062F},{1,0x0062F}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x00648},{1,0x00648}},
+   {{0,0x00000},{0,0x00000},{1,0x00632},{1,0x00632}},{{0,0x00000},{0,0x00000},{1,0x0062D},{1,0x0062D}},
+   {{0,0x00000},{0,0x00000},{1,0x00637},{1,0x00637}},{{0,0x00000},{0,0x00000},{1,0x0064A},{1,0x0064A}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{1,0x00644},{1,0x00644}},
+   {{0,0x00000},{0,0x00000},{1,0x00645},{1,0x00645}},{{0,0x00000},{0,0x00000},{1,0x00646},{1,0x00646}},
+   {{0,0x00000},{0,0x00000},{1,0x00633},{1,0x00633}},{{0,0x00000},{0,0x00000},{1,0x00639},{1,0x00639}},
+   {{0,0x00000},{0,0x00000},{1,0x00641},{1,0x00641}},{{0,0x00000},{0,0x00000},{1,0x00635},{1,0x00635}},
+   {{0,0x00000},{0,0x00000},{1,0x00642},{1,0x00642}},{{0,0x00000},{0,0x00000},{1,0x00631},{1,0x00631}},
+   {{0,0x00000},{0,0x00000},{1,0x00634},{1,0x00634}},{{0,0x00000},{0,0x00000},{1,0x0062A},{1,0x0062A}},
+   {{0,0x00000},{0,0x00000},{1,0x0062B},{1,0x0062B}},{{0,0x00000},{0,0x00000},{1,0x0062E},{1,0x0062E}},
+   {{0,0x00000},{0,0x00000},{1,0x00630},{1,0x00630}},{{0,0x00000},{0,0x00000},{1,0x00636},{1,0x00636}},
+   {{0,0x00000},{0,0x00000},{1,0x00638},{1,0x00638}},{{0,0x00000},{0,0x00000},{1,0x0063A},{1,0x0063A}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 179 */
+  {{{0,0x00000},{0,0x00000},{2,0x013CB},{2,0x013CB}},{{0,0x00000},{0,0x00000},{2,0x013CD},{2,0x013CD}},
+   {{0,0x00000},{0,0x00000},{2,0x013CF},{2,0x013CF}},{{0,0x00000},{0,0x00000},{2,0x013D1},{2,0x013D1}},
+   {{0,0x00000},{0,0x00000},{2,0x013D3},{2,0x013D3}},{{0,0x00000},{0,0x00000},{2,0x013D5},{2,0x013D5}},
+   {{0,0x00000},{0,0x00000},{2,0x013D7},{2,0x013D7}},{{0,0x00000},{0,0x00000},{2,0x013D9},{2,0x013D9}},
+   {{0,0x00000},{0,0x00000},{2,0x013DB},{2,0x013DB}},{{0,0x00000},{0,0x00000},{2,0x013DD},{2,0x013DD}},
+   {{0,0x00000},{0,0x00000},{2,0x013DF},{2,0x013DF}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{3,0x013E1},{3,0x00A80}},{{0,0x00000},{0,0x00000},{3,0x013E4},{3,0x00A83}},
+   {{0,0x00000},{0,0x00000},{3,0x013E7},{3,0x00A86}},{{0,0x00000},{0,0x00000},{3,0x013EA},{3,0x00A89}},
+   {{0,0x00000},{0,0x00000},{3,0x013ED},{3,0x00A8C}},{{0,0x00000},{0,0x00000},{3,0x013F0},{3,0x00A8F}},
+   {{0,0x00000},{0,0x00000},{3,0x013F3},{3,0x00A92}},{{0,0x00000},{0,0x00000},{3,0x013F6},{3,0x00A95}},
+   {{0,0x00000},{0,0x00000},{3,0x013F9},{3,0x00A98}},{{0,0x00000},{0,0x00000},{3,0x013FC},{3,0x00A9B}},
+   {{0,0x00000},{0,0x00000},{3,0x013FF},{3,0x00A9E}},{{0,0x00000},{0,0x00000},{3,0x01402},{3,0x00AA1}},
+   {{0,0x00000},{0,0x00000},{3,0x01405},{3,0x00AA4}},{{0,0x00000},{0,0x00000},{3,0x01408},{3,0x00AA7}},
+   {{0,0x00000},{0,0x00000},{3,0x0140B},{3,0x00AAA}},{{0,0x00000},{0,0x00000},{3,0x0140E},{3,0x00AAD}},
+   {{0,0x00000},{0,0x00000},{3,0x01411},{3,0x00AB0}},{{0,0x00000},{0,0x00000},{3,0x01414},{3,0x00AB3}},
+   {{0,0x00000},{0,0x00000},{3,0x01417},{3,0x00AB6}},{{0,0x00000},{0,0x00000},{3,0x0141A},{3,0x00AB9}},
+   {{0,0x00000},{0,0x00000},{3,0x0141D},{3,0x00ABC}},{{0,0x00000},{0,0x00000},{3,0x01420},{3,0x00ABF}},
+   {{0,0x00000},{0,0x00000},{3,0x01423},{3,0x00AC2}},{{0,0x00000},{0,0x00000},{3,0x01426},{3,0x00AC5}},
+   {{0,0x00000},{0,0x00000},{3,0x01429},{3,0x00AC8}},{{0,0x00000},{0,0x00000},{3,0x0142C},{3,0x00ACB}},
+   {{0,0x00000},{0,0x00000},{3,0x0142F},{3,0x01432}},{{0,0x00000},{0,0x00000},{1,0x00043},{1,0x00063}},
+   {{0,0x00000},{0,0x00000},{1,0x00052},{1,0x00072}},{{0,0x00000},{0,0x00000},{2,0x01435},{2,0x00F86}},
+   {{0,0x00000},{0,0x00000},{2,0x01437},{2,0x01439}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x00041},{1,0x00061}},{{0,0x00000},{0,0x00000},{1,0x00042},{1,0x00062}},
+   {{0,0x00000},{0,0x00000},{1,0x00043},{1,0x00063}},{{0,0x00000},{0,0x00000},{1,0x00044},{1,0x00064}},
+   {{0,0x00000},{0,0x00000},{1,0x00045},{1,0x00065}},{{0,0x00000},{0,0x00000},{1,0x00046},{1,0x00066}},
+   {{0,0x00000},{0,0x00000},{1,0x00047},{1,0x00067}},{{0,0x00000},{0,0x00000},{1,0x00048},{1,0x00068}},
+   {{0,0x00000},{0,0x00000},{1,0x00049},{1,0x00069}},{{0,0x00000},{0,0x00000},{1,0x0004A},{1,0x0006A}},
+   {{0,0x00000},{0,0x00000},{1,0x0004B},{1,0x0006B}},{{0,0x00000},{0,0x00000},{1,0x0004C},{1,0x0006C}},
+   {{0,0x00000},{0,0x00000},{1,0x0004D},{1,0x0006D}},{{0,0x00000},{0,0x00000},{1,0x0004E},{1,0x0006E}},
+   {{0,0x00000},{0,0x00000},{1,0x0004F},{1,0x0006F}},{{0,0x00000},{0,0x00000},{1,0x00050},{1,0x00070}}
+  },
+
+  /* block 180 */
+  {{{0,0x00000},{0,0x00000},{1,0x00051},{1,0x00071}},{{0,0x00000},{0,0x00000},{1,0x00052},{1,0x00072}},
+   {{0,0x00000},{0,0x00000},{1,0x00053},{1,0x00073}},{{0,0x00000},{0,0x00000},{1,0x00054},{1,0x00074}},
+   {{0,0x00000},{0,0x00000},{1,0x00055},{1,0x00075}},{{0,0x00000},{0,0x00000},{1,0x00056},{1,0x00076}},
+   {{0,0x00000},{0,0x00000},{1,0x00057},{1,0x00077}},{{0,0x00000},{0,0x00000},{1,0x00058},{1,0x00078}},
+   {{0,0x00000},{0,0x00000},{1,0x00059},{1,0x00079}},{{0,0x00000},{0,0x00000},{1,0x0005A},{1,0x0007A}},
+   {{0,0x00000},{0,0x00000},{2,0x0143B},{2,0x0143D}},{{0,0x00000},{0,0x00000},{2,0x00F5C},{2,0x00F56}},
+   {{0,0x00000},{0,0x00000},{2,0x0143F},{2,0x01441}},{{0,0x00000},{0,0x00000},{2,0x01443},{2,0x00079}},
+   {{0,0x00000},{0,0x00000},{3,0x01445},{3,0x01448}},{{0,0x00000},{0,0x00000},{2,0x0144B},{2,0x0144D}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{2,0x0144F},{2,0x01451}},{{0,0x00000},{0,0x00000},{2,0x01453},{2,0x01455}},
+   {{0,0x00000},{0,0x00000},{2,0x01457},{2,0x01459}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 181 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{2,0x0145B},{2,0x0145D}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 182 */
+  {{{0,0x00000},{0,0x00000},{2,0x0145F},{2,0x0145F}},{{0,0x00000},{0,0x00000},{2,0x01461},{2,0x01461}},
+   {{0,0x00000},{0,0x00000},{1,0x030B5},{1,0x030B5}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x0624B},{1,0x0624B}},{{0,0x00000},{0,0x00000},{1,0x05B57},{1,0x05B57}},
+   {{0,0x00000},{0,0x00000},{1,0x053CC},{1,0x053CC}},{{0,0x00000},{0,0x00000},{2,0x00B32},{2,0x00B32}},
+   {{0,0x00000},{0,0x00000},{1,0x04E8C},{1,0x04E8C}},{{0,0x00000},{0,0x00000},{1,0x0591A},{1,0x0591A}},
+   {{0,0x00000},{0,0x00000},{1,0x089E3},{1,0x089E3}},{{0,0x00000},{0,0x00000},{1,0x05929},{1,0x05929}},
+   {{0,0x00000},{0,0x00000},{1,0x04EA4},{1,0x04EA4}},{{0,0x00000},{0,0x00000},{1,0x06620},{1,0x06620}},
+   {{0,0x00000},{0,0x00000},{1,0x07121},{1,0x07121}},{{0,0x00000},{0,0x00000},{1,0x06599},{1,0x06599}},
+   {{0,0x00000},{0,0x00000},{1,0x0524D},{1,0x0524D}},{{0,0x00000},{0,0x00000},{1,0x05F8C},{1,0x05F8C}},
+   {{0,0x00000},{0,0x00000},{1,0x0518D},{1,0x0518D}},{{0,0x00000},{0,0x00000},{1,0x065B0},{1,0x065B0}},
+   {{0,0x00000},{0,0x00000},{1,0x0521D},{1,0x0521D}},{{0,0x00000},{0,0x00000},{1,0x07D42},{1,0x07D42}},
+   {{0,0x00000},{0,0x00000},{1,0x0751F},{1,0x0751F}},{{0,0x00000},{0,0x00000},{1,0x08CA9},{1,0x08CA9}},
+   {{0,0x00000},{0,0x00000},{1,0x058F0},{1,0x058F0}},{{0,0x00000},{0,0x00000},{1,0x05439},{1,0x05439}},
+   {{0,0x00000},{0,0x00000},{1,0x06F14},{1,0x06F14}},{{0,0x00000},{0,0x00000},{1,0x06295},{1,0x06295}},
+   {{0,0x00000},{0,0x00000},{1,0x06355},{1,0x06355}},{{0,0x00000},{0,0x00000},{1,0x04E00},{1,0x04E00}},
+   {{0,0x00000},{0,0x00000},{1,0x04E09},{1,0x04E09}},{{0,0x00000},{0,0x00000},{1,0x0904A},{1,0x0904A}},
+   {{0,0x00000},{0,0x00000},{1,0x05DE6},{1,0x05DE6}},{{0,0x00000},{0,0x00000},{1,0x04E2D},{1,0x04E2D}},
+   {{0,0x00000},{0,0x00000},{1,0x053F3},{1,0x053F3}},{{0,0x00000},{0,0x00000},{1,0x06307},{1,0x06307}},
+   {{0,0x00000},{0,0x00000},{1,0x08D70},{1,0x08D70}},{{0,0x00000},{0,0x00000},{1,0x06253},{1,0x06253}},
+   {{0,0x00000},{0,0x00000},{1,0x07981},{1,0x07981}},{{0,0x00000},{0,0x00000},{1,0x07A7A},{1,0x07A7A}},
+   {{0,0x00000},{0,0x00000},{1,0x05408},{1,0x05408}},{{0,0x00000},{0,0x00000},{1,0x06E80},{1,0x06E80}},
+   {{0,0x00000},{0,0x00000},{1,0x06709},{1,0x06709}},{{0,0x00000},{0,0x00000},{1,0x06708},{1,0x06708}},
+   {{0,0x00000},{0,0x00000},{1,0x07533},{1,0x07533}},{{0,0x00000},{0,0x00000},{1,0x05272},{1,0x05272}},
+   {{0,0x00000},{0,0x00000},{1,0x055B6},{1,0x055B6}},{{0,0x00000},{0,0x00000},{1,0x0914D},{1,0x0914D}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 183 */
+  {{{0,0x00000},{0,0x00000},{3,0x01463},{3,0x01463}},{{0,0x00000},{0,0x00000},{3,0x01466},{3,0x01466}},
+   {{0,0x00000},{0,0x00000},{3,0x01469},{3,0x01469}},{{0,0x00000},{0,0x00000},{3,0x0146C},{3,0x0146C}},
+   {{0,0x00000},{0,0x00000},{3,0x0146F},{3,0x0146F}},{{0,0x00000},{0,0x00000},{3,0x01472},{3,0x01472}},
+   {{0,0x00000},{0,0x00000},{3,0x01475},{3,0x01475}},{{0,0x00000},{0,0x00000},{3,0x01478},{3,0x01478}},
+   {{0,0x00000},{0,0x00000},{3,0x0147B},{3,0x0147B}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x05F97},{1,0x05F97}},{{0,0x00000},{0,0x00000},{1,0x053EF},{1,0x053EF}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 184 */
+  {{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{1,0x00030},{1,0x00030}},{{0,0x00000},{0,0x00000},{1,0x00031},{1,0x00031}},
+   {{0,0x00000},{0,0x00000},{1,0x00032},{1,0x00032}},{{0,0x00000},{0,0x00000},{1,0x00033},{1,0x00033}},
+   {{0,0x00000},{0,0x00000},{1,0x00034},{1,0x00034}},{{0,0x00000},{0,0x00000},{1,0x00035},{1,0x00035}},
+   {{0,0x00000},{0,0x00000},{1,0x00036},{1,0x00036}},{{0,0x00000},{0,0x00000},{1,0x00037},{1,0x00037}},
+   {{0,0x00000},{0,0x00000},{1,0x00038},{1,0x00038}},{{0,0x00000},{0,0x00000},{1,0x00039},{1,0x00039}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  },
+
+  /* block 185 */
+  {{{1,0x04E3D},{1,0x04E3D},{1,0x04E3D},{1,0x04E3D}},{{1,0x04E38},{1,0x04E38},{1,0x04E38},{1,0x04E38}},
+   {{1,0x04E41},{1,0x04E41},{1,0x04E41},{1,0x04E41}},{{1,0x20122},{1,0x20122},{1,0x20122},{1,0x20122}},
+   {{1,0x04F60},{1,0x04F60},{1,0x04F60},{1,0x04F60}},{{1,0x04FAE},{1,0x04FAE},{1,0x04FAE},{1,0x04FAE}},
+   {{1,0x04FBB},{1,0x04FBB},{1,0x04FBB},{1,0x04FBB}},{{1,0x05002},{1,0x05002},{1,0x05002},{1,0x05002}},
+   {{1,0x0507A},{1,0x0507A},{1,0x0507A},{1,0x0507A}},{{1,0x05099},{1,0x05099},{1,0x05099},{1,0x05099}},
+   {{1,0x050E7},{1,0x050E7},{1,0x050E7},{1,0x050E7}},{{1,0x050CF},{1,0x050CF},{1,0x050CF},{1,0x050CF}},
+   {{1,0x0349E},{1,0x0349E},{1,0x0349E},{1,0x0349E}},{{1,0x2063A},{1,0x2063A},{1,0x2063A},{1,0x2063A}},
+   {{1,0x0514D},{1,0x0514D},{1,0x0514D},{1,0x0514D}},{{1,0x05154},{1,0x05154},{1,0x05154},{1,0x05154}},
+   {{1,0x05164},{1,0x05164},{1,0x05164},{1,0x05164}},{{1,0x05177},{1,0x05177},{1,0x05177},{1,0x05177}},
+   {{1,0x2051C},{1,0x2051C},{1,0x2051C},{1,0x2051C}},{{1,0x034B9},{1,0x034B9},{1,0x034B9},{1,0x034B9}},
+   {{1,0x05167},{1,0x05167},{1,0x05167},{1,0x05167}},{{1,0x0518D},{1,0x0518D},{1,0x0518D},{1,0x0518D}},
+   {{1,0x2054B},{1,0x2054B},{1,0x2054B},{1,0x2054B}},{{1,0x05197},{1,0x05197},{1,0x05197},{1,0x05197}},
+   {{1,0x051A4},{1,0x051A4},{1,0x051A4},{1,0x051A4}},{{1,0x04ECC},{1,0x04ECC},{1,0x04ECC},{1,0x04ECC}},
+   {{1,0x051AC},{1,0x051AC},{1,0x051AC},{1,0x051AC}},{{1,0x051B5},{1,0x051B5},{1,0x051B5},{1,0x051B5}},
+   {{1,0x291DF},{1,0x291DF},{1,0x291DF},{1,0x291DF}},{{1,0x051F5},{1,0x051F5},{1,0x051F5},{1,0x051F5}},
+   {{1,0x05203},{1,0x05203},{1,0x05203},{1,0x05203}},{{1,0x034DF},{1,0x034DF},{1,0x034DF},{1,0x034DF}},
+   {{1,0x0523B},{1,0x0523B},{1,0x0523B},{1,0x0523B}},{{1,0x05246},{1,0x05246},{1,0x05246},{1,0x05246}},
+   {{1,0x05272},{1,0x05272},{1,0x05272},{1,0x05272}},{{1,0x05277},{1,0x05277},{1,0x05277},{1,0x05277}},
+   {{1,0x03515},{1,0x03515},{1,0x03515},{1,0x03515}},{{1,0x052C7},{1,0x052C7},{1,0x052C7},{1,0x052C7}},
+   {{1,0x052C9},{1,0x052C9},{1,0x052C9},{1,0x052C9}},{{1,0x052E4},{1,0x052E4},{1,0x052E4},{1,0x052E4}},
+   {{1,0x052FA},{1,0x052FA},{1,0x052FA},{1,0x052FA}},{{1,0x05305},{1,0x05305},{1,0x05305},{1,0x05305}},
+   {{1,0x05306},{1,0x05306},{1,0x05306},{1,0x05306}},{{1,0x05317},{1,0x05317},{1,0x05317},{1,0x05317}},
+   {{1,0x05349},{1,0x05349},{1,0x05349},{1,0x05349}},{{1,0x05351},{1,0x05351},{1,0x05351},{1,0x05351}},
+   {{1,0x0535A},{1,0x0535A},{1,0x0535A},{1,0x0535A}},{{1,0x05373},{1,0x05373},{1,0x05373},{1,0x05373}},
+   {{1,0x0537D},{1,0x0537D},{1,0x0537D},{1,0x0537D}},{{1,0x0537F},{1,0x0537F},{1,0x0537F},{1,0x0537F}},
+   {{1,0x0537F},{1,0x0537F},{1,0x0537F},{1,0x0537F}},{{1,0x0537F},{1,0x0537F},{1,0x0537F},{1,0x0537F}},
+   {{1,0x20A2C},{1,0x20A2C},{1,0x20A2C},{1,0x20A2C}},{{1,0x07070},{1,0x07070},{1,0x07070},{1,0x07070}},
+   {{1,0x053CA},{1,0x053CA},{1,0x053CA},{1,0x053CA}},{{1,0x053DF},{1,0x053DF},{1,0x053DF},{1,0x053DF}},
+   {{1,0x20B63},{1,0x20B63},{1,0x20B63},{1,0x20B63}},{{1,0x053EB},{1,0x053EB},{1,0x053EB},{1,0x053EB}},
+   {{1,0x053F1},{1,0x053F1},{1,0x053F1},{1,0x053F1}},{{1,0x05406},{1,0x05406},{1,0x05406},{1,0x05406}},
+   {{1,0x0549E},{1,0x0549E},{1,0x0549E},{1,0x0549E}},{{1,0x05438},{1,0x05438},{1,0x05438},{1,0x05438}},
+   {{1,0x05448},{1,0x05448},{1,0x05448},{1,0x05448}},{{1,0x05468},{1,0x05468},{1,0x05468},{1,0x05468}}
+  },
+
+  /* block 186 */
+  {{{1,0x054A2},{1,0x054A2},{1,0x054A2},{1,0x054A2}},{{1,0x054F6},{1,0x054F6},{1,0x054F6},{1,0x054F6}},
+   {{1,0x05510},{1,0x05510},{1,0x05510},{1,0x05510}},{{1,0x05553},{1,0x05553},{1,0x05553},{1,0x05553}},
+   {{1,0x05563},{1,0x05563},{1,0x05563},{1,0x05563}},{{1,0x05584},{1,0x05584},{1,0x05584},{1,0x05584}},
+   {{1,0x05584},{1,0x05584},{1,0x05584},{1,0x05584}},{{1,0x05599},{1,0x05599},{1,0x05599},{1,0x05599}},
+   {{1,0x055AB},{1,0x055AB},{1,0x055AB},{1,0x055AB}},{{1,0x055B3},{1,0x055B3},{1,0x055B3},{1,0x055B3}},
+   {{1,0x055C2},{1,0x055C2},{1,0x055C2},{1,0x055C2}},{{1,0x05716},{1,0x05716},{1,0x05716},{1,0x05716}},
+   {{1,0x05606},{1,0x05606},{1,0x05606},{1,0x05606}},{{1,0x05717},{1,0x05717},{1,0x05717},{1,0x05717}},
+   {{1,0x05651},{1,0x05651},{1,0x05651},{1,0x05651}},{{1,0x05674},{1,0x05674},{1,0x05674},{1,0x05674}},
+   {{1,0x05207},{1,0x05207},{1,0x05207},{1,0x05207}},{{1,0x058EE},{1,0x058EE},{1,0x058EE},{1,0x058EE}},
+   {{1,0x057CE},{1,0x057CE},{1,0x057CE},{1,0x057CE}},{{1,0x057F4},{1,0x057F4},{1,0x057F4},{1,0x057F4}},
+   {{1,0x0580D},{1,0x0580D},{1,0x0580D},{1,0x0580D}},{{1,0x0578B},{1,0x0578B},{1,0x0578B},{1,0x0578B}},
+   {{1,0x05832},{1,0x05832},{1,0x05832},{1,0x05832}},{{1,0x05831},{1,0x05831},{1,0x05831},{1,0x05831}},
+   {{1,0x058AC},{1,0x058AC},{1,0x058AC},{1,0x058AC}},{{1,0x214E4},{1,0x214E4},{1,0x214E4},{1,0x214E4}},
+   {{1,0x058F2},{1,0x058F2},{1,0x058F2},{1,0x058F2}},{{1,0x058F7},{1,0x058F7},{1,0x058F7},{1,0x058F7}},
+   {{1,0x05906},{1,0x05906},{1,0x05906},{1,0x05906}},{{1,0x0591A},{1,0x0591A},{1,0x0591A},{1,0x0591A}},
+   {{1,0x05922},{1,0x05922},{1,0x05922},{1,0x05922}},{{1,0x05962},{1,0x05962},{1,0x05962},{1,0x05962}},
+   {{1,0x216A8},{1,0x216A8},{1,0x216A8},{1,0x216A8}},{{1,0x216EA},{1,0x216EA},{1,0x216EA},{1,0x216EA}},
+   {{1,0x059EC},{1,0x059EC},{1,0x059EC},{1,0x059EC}},{{1,0x05A1B},{1,0x05A1B},{1,0x05A1B},{1,0x05A1B}},
+   {{1,0x05A27},{1,0x05A27},{1,0x05A27},{1,0x05A27}},{{1,0x059D8},{1,0x059D8},{1,0x059D8},{1,0x059D8}},
+   {{1,0x05A66},{1,0x05A66},{1,0x05A66},{1,0x05A66}},{{1,0x036EE},{1,0x036EE},{1,0x036EE},{1,0x036EE}},
+   {{1,0x036FC},{1,0x036FC},{1,0x036FC},{1,0x036FC}},{{1,0x05B08},{1,0x05B08},{1,0x05B08},{1,0x05B08}},
+   {{1,0x05B3E},{1,0x05B3E},{1,0x05B3E},{1,0x05B3E}},{{1,0x05B3E},{1,0x05B3E},{1,0x05B3E},{1,0x05B3E}},
+   {{1,0x219C8},{1,0x219C8},{1,0x219C8},{1,0x219C8}},{{1,0x05BC3},{1,0x05BC3},{1,0x05BC3},{1,0x05BC3}},
+   {{1,0x05BD8},{1,0x05BD8},{1,0x05BD8},{1,0x05BD8}},{{1,0x05BE7},{1,0x05BE7},{1,0x05BE7},{1,0x05BE7}},
+   {{1,0x05BF3},{1,0x05BF3},{1,0x05BF3},{1,0x05BF3}},{{1,0x21B18},{1,0x21B18},{1,0x21B18},{1,0x21B18}},
+   {{1,0x05BFF},{1,0x05BFF},{1,0x05BFF},{1,0x05BFF}},{{1,0x05C06},{1,0x05C06},{1,0x05C06},{1,0x05C06}},
+   {{1,0x05F53},{1,0x05F53},{1,0x05F53},{1,0x05F53}},{{1,0x05C22},{1,0x05C22},{1,0x05C22},{1,0x05C22}},
+   {{1,0x03781},{1,0x03781},{1,0x03781},{1,0x03781}},{{1,0x05C60},{1,0x05C60},{1,0x05C60},{1,0x05C60}},
+   {{1,0x05C6E},{1,0x05C6E},{1,0x05C6E},{1,0x05C6E}},{{1,0x05CC0},{1,0x05CC0},{1,0x05CC0},{1,0x05CC0}},
+   {{1,0x05C8D},{1,0x05C8D},{1,0x05C8D},{1,0x05C8D}},{{1,0x21DE4},{1,0x21DE4},{1,0x21DE4},{1,0x21DE4}},
+   {{1,0x05D43},{1,0x05D43},{1,0x05D43},{1,0x05D43}},{{1,0x21DE6},{1,0x21DE6},{1,0x21DE6},{1,0x21DE6}},
+   {{1,0x05D6E},{1,0x05D6E},{1,0x05D6E},{1,0x05D6E}},{{1,0x05D6B},{1,0x05D6B},{1,0x05D6B},{1,0x05D6B}}
+  },
+
+  /* block 187 */
+  {{{1,0x05D7C},{1,0x05D7C},{1,0x05D7C},{1,0x05D7C}},{{1,0x05DE1},{1,0x05DE1},{1,0x05DE1},{1,0x05DE1}},
+   {{1,0x05DE2},{1,0x05DE2},{1,0x05DE2},{1,0x05DE2}},{{1,0x0382F},{1,0x0382F},{1,0x0382F},{1,0x0382F}},
+   {{1,0x05DFD},{1,0x05DFD},{1,0x05DFD},{1,0x05DFD}},{{1,0x05E28},{1,0x05E28},{1,0x05E28},{1,0x05E28}},
+   {{1,0x05E3D},{1,0x05E3D},{1,0x05E3D},{1,0x05E3D}},{{1,0x05E69},{1,0x05E69},{1,0x05E69},{1,0x05E69}},
+   {{1,0x03862},{1,0x03862},{1,0x03862},{1,0x03862}},{{1,0x22183},{1,0x22183},{1,0x22183},{1,0x22183}},
+   {{1,0x0387C},{1,0x0387C},{1,0x0387C},{1,0x0387C}},{{1,0x05EB0},{1,0x05EB0},{1,0x05EB0},{1,0x05EB0}},
+   {{1,0x05EB3},{1,0x05EB3},{1,0x05EB3},{1,0x05EB3}},{{1,0x05EB6},{1,0x05EB6},{1,0x05EB6},{1,0x05EB6}},
+   {{1,0x05ECA},{1,0x05ECA},{1,0x05ECA},{1,0x05ECA}},{{1,0x2A392},{1,0x2A392},{1,0x2A392},{1,0x2A392}},
+   {{1,0x05EFE},{1,0x05EFE},{1,0x05EFE},{1,0x05EFE}},{{1,0x22331},{1,0x22331},{1,0x22331},{1,0x22331}},
+   {{1,0x22331},{1,0x22331},{1,0x22331},{1,0x22331}},{{1,0x08201},{1,0x08201},{1,0x08201},{1,0x08201}},
+   {{1,0x05F22},{1,0x05F22},{1,0x05F22},{1,0x05F22}},{{1,0x05F22},{1,0x05F22},{1,0x05F22},{1,0x05F22}},
+   {{1,0x038C7},{1,0x038C7},{1,0x038C7},{1,0x038C7}},{{1,0x232B8},{1,0x232B8},{1,0x232B8},{1,0x232B8}},
+   {{1,0x261DA},{1,0x261DA},{1,0x261DA},{1,0x261DA}},{{1,0x05F62},{1,0x05F62},{1,0x05F62},{1,0x05F62}},
+   {{1,0x05F6B},{1,0x05F6B},{1,0x05F6B},{1,0x05F6B}},{{1,0x038E3},{1,0x038E3},{1,0x038E3},{1,0x038E3}},
+   {{1,0x05F9A},{1,0x05F9A},{1,0x05F9A},{1,0x05F9A}},{{1,0x05FCD},{1,0x05FCD},{1,0x05FCD},{1,0x05FCD}},
+   {{1,0x05FD7},{1,0x05FD7},{1,0x05FD7},{1,0x05FD7}},{{1,0x05FF9},{1,0x05FF9},{1,0x05FF9},{1,0x05FF9}},
+   {{1,0x06081},{1,0x06081},{1,0x06081},{1,0x06081}},{{1,0x0393A},{1,0x0393A},{1,0x0393A},{1,0x0393A}},
+   {{1,0x0391C},{1,0x0391C},{1,0x0391C},{1,0x0391C}},{{1,0x06094},{1,0x06094},{1,0x06094},{1,0x06094}},
+   {{1,0x226D4},{1,0x226D4},{1,0x226D4},{1,0x226D4}},{{1,0x060C7},{1,0x060C7},{1,0x060C7},{1,0x060C7}},
+   {{1,0x06148},{1,0x06148},{1,0x06148},{1,0x06148}},{{1,0x0614C},{1,0x0614C},{1,0x0614C},{1,0x0614C}},
+   {{1,0x0614E},{1,0x0614E},{1,0x0614E},{1,0x0614E}},{{1,0x0614C},{1,0x0614C},{1,0x0614C},{1,0x0614C}},
+   {{1,0x0617A},{1,0x0617A},{1,0x0617A},{1,0x0617A}},{{1,0x0618E},{1,0x0618E},{1,0x0618E},{1,0x0618E}},
+   {{1,0x061B2},{1,0x061B2},{1,0x061B2},{1,0x061B2}},{{1,0x061A4},{1,0x061A4},{1,0x061A4},{1,0x061A4}},
+   {{1,0x061AF},{1,0x061AF},{1,0x061AF},{1,0x061AF}},{{1,0x061DE},{1,0x061DE},{1,0x061DE},{1,0x061DE}},
+   {{1,0x061F2},{1,0x061F2},{1,0x061F2},{1,0x061F2}},{{1,0x061F6},{1,0x061F6},{1,0x061F6},{1,0x061F6}},
+   {{1,0x06210},{1,0x06210},{1,0x06210},{1,0x06210}},{{1,0x0621B},{1,0x0621B},{1,0x0621B},{1,0x0621B}},
+   {{1,0x0625D},{1,0x0625D},{1,0x0625D},{1,0x0625D}},{{1,0x062B1},{1,0x062B1},{1,0x062B1},{1,0x062B1}},
+   {{1,0x062D4},{1,0x062D4},{1,0x062D4},{1,0x062D4}},{{1,0x06350},{1,0x06350},{1,0x06350},{1,0x06350}},
+   {{1,0x22B0C},{1,0x22B0C},{1,0x22B0C},{1,0x22B0C}},{{1,0x0633D},{1,0x0633D},{1,0x0633D},{1,0x0633D}},
+   {{1,0x062FC},{1,0x062FC},{1,0x062FC},{1,0x062FC}},{{1,0x06368},{1,0x06368},{1,0x06368},{1,0x06368}},
+   {{1,0x06383},{1,0x06383},{1,0x06383},{1,0x06383}},{{1,0x063E4},{1,0x063E4},{1,0x063E4},{1,0x063E4}},
+   {{1,0x22BF1},{1,0x22BF1},{1,0x22BF1},{1,0x22BF1}},{{1,0x06422},{1,0x06422},{1,0x06422},{1,0x06422}}
+  },
+
+  /* block 188 */
+  {{{1,0x063C5},{1,0x063C5},{1,0x063C5},{1,0x063C5}},{{1,0x063A9},{1,0x063A9},{1,0x063A9},{1,0x063A9}},
+   {{1,0x03A2E},{1,0x03A2E},{1,0x03A2E},{1,0x03A2E}},{{1,0x06469},{1,0x06469},{1,0x06469},{1,0x06469}},
+   {{1,0x0647E},{1,0x0647E},{1,0x0647E},{1,0x0647E}},{{1,0x0649D},{1,0x0649D},{1,0x0649D},{1,0x0649D}},
+   {{1,0x06477},{1,0x06477},{1,0x06477},{1,0x06477}},{{1,0x03A6C},{1,0x03A6C},{1,0x03A6C},{1,0x03A6C}},
+   {{1,0x0654F},{1,0x0654F},{1,0x0654F},{1,0x0654F}},{{1,0x0656C},{1,0x0656C},{1,0x0656C},{1,0x0656C}},
+   {{1,0x2300A},{1,0x2300A},{1,0x2300A},{1,0x2300A}},{{1,0x065E3},{1,0x065E3},{1,0x065E3},{1,0x065E3}},
+   {{1,0x066F8},{1,0x066F8},{1,0x066F8},{1,0x066F8}},{{1,0x06649},{1,0x06649},{1,0x06649},{1,0x06649}},
+   {{1,0x03B19},{1,0x03B19},{1,0x03B19},{1,0x03B19}},{{1,0x06691},{1,0x06691},{1,0x06691},{1,0x06691}},
+   {{1,0x03B08},{1,0x03B08},{1,0x03B08},{1,0x03B08}},{{1,0x03AE4},{1,0x03AE4},{1,0x03AE4},{1,0x03AE4}},
+   {{1,0x05192},{1,0x05192},{1,0x05192},{1,0x05192}},{{1,0x05195},{1,0x05195},{1,0x05195},{1,0x05195}},
+   {{1,0x06700},{1,0x06700},{1,0x06700},{1,0x06700}},{{1,0x0669C},{1,0x0669C},{1,0x0669C},{1,0x0669C}},
+   {{1,0x080AD},{1,0x080AD},{1,0x080AD},{1,0x080AD}},{{1,0x043D9},{1,0x043D9},{1,0x043D9},{1,0x043D9}},
+   {{1,0x06717},{1,0x06717},{1,0x06717},{1,0x06717}},{{1,0x0671B},{1,0x0671B},{1,0x0671B},{1,0x0671B}},
+   {{1,0x06721},{1,0x06721},{1,0x06721},{1,0x06721}},{{1,0x0675E},{1,0x0675E},{1,0x0675E},{1,0x0675E}},
+   {{1,0x06753},{1,0x06753},{1,0x06753},{1,0x06753}},{{1,0x233C3},{1,0x233C3},{1,0x233C3},{1,0x233C3}},
+   {{1,0x03B49},{1,0x03B49},{1,0x03B49},{1,0x03B49}},{{1,0x067FA},{1,0x067FA},{1,0x067FA},{1,0x067FA}},
+   {{1,0x06785},{1,0x06785},{1,0x06785},{1,0x06785}},{{1,0x06852},{1,0x06852},{1,0x06852},{1,0x06852}},
+   {{1,0x06885},{1,0x06885},{1,0x06885},{1,0x06885}},{{1,0x2346D},{1,0x2346D},{1,0x2346D},{1,0x2346D}},
+   {{1,0x0688E},{1,0x0688E},{1,0x0688E},{1,0x0688E}},{{1,0x0681F},{1,0x0681F},{1,0x0681F},{1,0x0681F}},
+   {{1,0x06914},{1,0x06914},{1,0x06914},{1,0x06914}},{{1,0x03B9D},{1,0x03B9D},{1,0x03B9D},{1,0x03B9D}},
+   {{1,0x06942},{1,0x06942},{1,0x06942},{1,0x06942}},{{1,0x069A3},{1,0x069A3},{1,0x069A3},{1,0x069A3}},
+   {{1,0x069EA},{1,0x069EA},{1,0x069EA},{1,0x069EA}},{{1,0x06AA8},{1,0x06AA8},{1,0x06AA8},{1,0x06AA8}},
+   {{1,0x236A3},{1,0x236A3},{1,0x236A3},{1,0x236A3}},{{1,0x06ADB},{1,0x06ADB},{1,0x06ADB},{1,0x06ADB}},
+   {{1,0x03C18},{1,0x03C18},{1,0x03C18},{1,0x03C18}},{{1,0x06B21},{1,0x06B21},{1,0x06B21},{1,0x06B21}},
+   {{1,0x238A7},{1,0x238A7},{1,0x238A7},{1,0x238A7}},{{1,0x06B54},{1,0x06B54},{1,0x06B54},{1,0x06B54}},
+   {{1,0x03C4E},{1,0x03C4E},{1,0x03C4E},{1,0x03C4E}},{{1,0x06B72},{1,0x06B72},{1,0x06B72},{1,0x06B72}},
+   {{1,0x06B9F},{1,0x06B9F},{1,0x06B9F},{1,0x06B9F}},{{1,0x06BBA},{1,0x06BBA},{1,0x06BBA},{1,0x06BBA}},
+   {{1,0x06BBB},{1,0x06BBB},{1,0x06BBB},{1,0x06BBB}},{{1,0x23A8D},{1,0x23A8D},{1,0x23A8D},{1,0x23A8D}},
+   {{1,0x21D0B},{1,0x21D0B},{1,0x21D0B},{1,0x21D0B}},{{1,0x23AFA},{1,0x23AFA},{1,0x23AFA},{1,0x23AFA}},
+   {{1,0x06C4E},{1,0x06C4E},{1,0x06C4E},{1,0x06C4E}},{{1,0x23CBC},{1,0x23CBC},{1,0x23CBC},{1,0x23CBC}},
+   {{1,0x06CBF},{1,0x06CBF},{1,0x06CBF},{1,0x06CBF}},{{1,0x06CCD},{1,0x06CCD},{1,0x06CCD},{1,0x06CCD}},
+   {{1,0x06C67},{1,0x06C67},{1,0x06C67},{1,0x06C67}},{{1,0x06D16},{1,0x06D16},{1,0x06D16},{1,0x06D16}}
+  },
+
+  /* block 189 */
+  {{{1,0x06D3E},{1,0x06D3E},{1,0x06D3E},{1,0x06D3E}},{{1,0x06D77},{1,0x06D77},{1,0x06D77},{1,0x06D77}},
+   {{1,0x06D41},{1,0x06D41},{1,0x06D41},{1,0x06D41}},{{1,0x06D69},{1,0x06D69},{1,0x06D69},{1,0x06D69}},
+   {{1,0x06D78},{1,0x06D78},{1,0x06D78},{1,0x06D78}},{{1,0x06D85},{1,0x06D85},{1,0x06D85},{1,0x06D85}},
+   {{1,0x23D1E},{1,0x23D1E},{1,0x23D1E},{1,0x23D1E}},{{1,0x06D34},{1,0x06D34},{1,0x06D34},{1,0x06D34}},
+   {{1,0x06E2F},{1,0x06E2F},{1,0x06E2F},{1,0x06E2F}},{{1,0x06E6E},{1,0x06E6E},{1,0x06E6E},{1,0x06E6E}},
+   {{1,0x03D33},{1,0x03D33},{1,0x03D33},{1,0x03D33}},{{1,0x06ECB},{1,0x06ECB},{1,0x06ECB},{1,0x06ECB}},
+   {{1,0x06EC7},{1,0x06EC7},{1,0x06EC7},{1,0x06EC7}},{{1,0x23ED1},{1,0x23ED1},{1,0x23ED1},{1,0x23ED1}},
+   {{1,0x06DF9},{1,0x06DF9},{1,0x06DF9},{1,0x06DF9}},{{1,0x06F6E},{1,0x06F6E},{1,0x06F6E},{1,0x06F6E}},
+   {{1,0x23F5E},{1,0x23F5E},{1,0x23F5E},{1,0x23F5E}},{{1,0x23F8E},{1,0x23F8E},{1,0x23F8E},{1,0x23F8E}},
+   {{1,0x06FC6},{1,0x06FC6},{1,0x06FC6},{1,0x06FC6}},{{1,0x07039},{1,0x07039},{1,0x07039},{1,0x07039}},
+   {{1,0x0701E},{1,0x0701E},{1,0x0701E},{1,0x0701E}},{{1,0x0701B},{1,0x0701B},{1,0x0701B},{1,0x0701B}},
+   {{1,0x03D96},{1,0x03D96},{1,0x03D96},{1,0x03D96}},{{1,0x0704A},{1,0x0704A},{1,0x0704A},{1,0x0704A}},
+   {{1,0x0707D},{1,0x0707D},{1,0x0707D},{1,0x0707D}},{{1,0x07077},{1,0x07077},{1,0x07077},{1,0x07077}},
+   {{1,0x070AD},{1,0x070AD},{1,0x070AD},{1,0x070AD}},{{1,0x20525},{1,0x20525},{1,0x20525},{1,0x20525}},
+   {{1,0x07145},{1,0x07145},{1,0x07145},{1,0x07145}},{{1,0x24263},{1,0x24263},{1,0x24263},{1,0x24263}},
+   {{1,0x0719C},{1,0x0719C},{1,0x0719C},{1,0x0719C}},{{1,0x243AB},{1,0x243AB},{1,0x243AB},{1,0x243AB}},
+   {{1,0x07228},{1,0x07228},{1,0x07228},{1,0x07228}},{{1,0x07235},{1,0x07235},{1,0x07235},{1,0x07235}},
+   {{1,0x07250},{1,0x07250},{1,0x07250},{1,0x07250}},{{1,0x24608},{1,0x24608},{1,0x24608},{1,0x24608}},
+   {{1,0x07280},{1,0x07280},{1,0x07280},{1,0x07280}},{{1,0x07295},{1,0x07295},{1,0x07295},{1,0x07295}},
+   {{1,0x24735},{1,0x24735},{1,0x24735},{1,0x24735}},{{1,0x24814},{1,0x24814},{1,0x24814},{1,0x24814}},
+   {{1,0x0737A},{1,0x0737A},{1,0x0737A},{1,0x0737A}},{{1,0x0738B},{1,0x0738B},{1,0x0738B},{1,0x0738B}},
+   {{1,0x03EAC},{1,0x03EAC},{1,0x03EAC},{1,0x03EAC}},{{1,0x073A5},{1,0x073A5},{1,0x073A5},{1,0x073A5}},
+   {{1,0x03EB8},{1,0x03EB8},{1,0x03EB8},{1,0x03EB8}},{{1,0x03EB8},{1,0x03EB8},{1,0x03EB8},{1,0x03EB8}},
+   {{1,0x07447},{1,0x07447},{1,0x07447},{1,0x07447}},{{1,0x0745C},{1,0x0745C},{1,0x0745C},{1,0x0745C}},
+   {{1,0x07471},{1,0x07471},{1,0x07471},{1,0x07471}},{{1,0x07485},{1,0x07485},{1,0x07485},{1,0x07485}},
+   {{1,0x074CA},{1,0x074CA},{1,0x074CA},{1,0x074CA}},{{1,0x03F1B},{1,0x03F1B},{1,0x03F1B},{1,0x03F1B}},
+   {{1,0x07524},{1,0x07524},{1,0x07524},{1,0x07524}},{{1,0x24C36},{1,0x24C36},{1,0x24C36},{1,0x24C36}},
+   {{1,0x0753E},{1,0x0753E},{1,0x0753E},{1,0x0753E}},{{1,0x24C92},{1,0x24C92},{1,0x24C92},{1,0x24C92}},
+   {{1,0x07570},{1,0x07570},{1,0x07570},{1,0x07570}},{{1,0x2219F},{1,0x2219F},{1,0x2219F},{1,0x2219F}},
+   {{1,0x07610},{1,0x07610},{1,0x07610},{1,0x07610}},{{1,0x24FA1},{1,0x24FA1},{1,0x24FA1},{1,0x24FA1}},
+   {{1,0x24FB8},{1,0x24FB8},{1,0x24FB8},{1,0x24FB8}},{{1,0x25044},{1,0x25044},{1,0x25044},{1,0x25044}},
+   {{1,0x03FFC},{1,0x03FFC},{1,0x03FFC},{1,0x03FFC}},{{1,0x04008},{1,0x04008},{1,0x04008},{1,0x04008}}
+  },
+
+  /* block 190 */
+  {{{1,0x076F4},{1,0x076F4},{1,0x076F4},{1,0x076F4}},{{1,0x250F3},{1,0x250F3},{1,0x250F3},{1,0x250F3}},
+   {{1,0x250F2},{1,0x250F2},{1,0x250F2},{1,0x250F2}},{{1,0x25119},{1,0x25119},{1,0x25119},{1,0x25119}},
+   {{1,0x25133},{1,0x25133},{1,0x25133},{1,0x25133}},{{1,0x0771E},{1,0x0771E},{1,0x0771E},{1,0x0771E}},
+   {{1,0x0771F},{1,0x0771F},{1,0x0771F},{1,0x0771F}},{{1,0x0771F},{1,0x0771F},{1,0x0771F},{1,0x0771F}},
+   {{1,0x0774A},{1,0x0774A},{1,0x0774A},{1,0x0774A}},{{1,0x04039},{1,0x04039},{1,0x04039},{1,0x04039}},
+   {{1,0x0778B},{1,0x0778B},{1,0x0778B},{1,0x0778B}},{{1,0x04046},{1,0x04046},{1,0x04046},{1,0x04046}},
+   {{1,0x04096},{1,0x04096},{1,0x04096},{1,0x04096}},{{1,0x2541D},{1,0x2541D},{1,0x2541D},{1,0x2541D}},
+   {{1,0x0784E},{1,0x0784E},{1,0x0784E},{1,0x0784E}},{{1,0x0788C},{1,0x0788C},{1,0x0788C},{1,0x0788C}},
+   {{1,0x078CC},{1,0x078CC},{1,0x078CC},{1,0x078CC}},{{1,0x040E3},{1,0x040E3},{1,0x040E3},{1,0x040E3}},
+   {{1,0x25626},{1,0x25626},{1,0x25626},{1,0x25626}},{{1,0x07956},{1,0x07956},{1,0x07956},{1,0x07956}},
+   {{1,0x2569A},{1,0x2569A},{1,0x2569A},{1,0x2569A}},{{1,0x256C5},{1,0x256C5},{1,0x256C5},{1,0x256C5}},
+   {{1,0x0798F},{1,0x0798F},{1,0x0798F},{1,0x0798F}},{{1,0x079EB},{1,0x079EB},{1,0x079EB},{1,0x079EB}},
+   {{1,0x0412F},{1,0x0412F},{1,0x0412F},{1,0x0412F}},{{1,0x07A40},{1,0x07A40},{1,0x07A40},{1,0x07A40}},
+   {{1,0x07A4A},{1,0x07A4A},{1,0x07A4A},{1,0x07A4A}},{{1,0x07A4F},{1,0x07A4F},{1,0x07A4F},{1,0x07A4F}},
+   {{1,0x2597C},{1,0x2597C},{1,0x2597C},{1,0x2597C}},{{1,0x25AA7},{1,0x25AA7},{1,0x25AA7},{1,0x25AA7}},
+   {{1,0x25AA7},{1,0x25AA7},{1,0x25AA7},{1,0x25AA7}},{{1,0x07AEE},{1,0x07AEE},{1,0x07AEE},{1,0x07AEE}},
+   {{1,0x04202},{1,0x04202},{1,0x04202},{1,0x04202}},{{1,0x25BAB},{1,0x25BAB},{1,0x25BAB},{1,0x25BAB}},
+   {{1,0x07BC6},{1,0x07BC6},{1,0x07BC6},{1,0x07BC6}},{{1,0x07BC9},{1,0x07BC9},{1,0x07BC9},{1,0x07BC9}},
+   {{1,0x04227},{1,0x04227},{1,0x04227},{1,0x04227}},{{1,0x25C80},{1,0x25C80},{1,0x25C80},{1,0x25C80}},
+   {{1,0x07CD2},{1,0x07CD2},{1,0x07CD2},{1,0x07CD2}},{{1,0x042A0},{1,0x042A0},{1,0x042A0},{1,0x042A0}},
+   {{1,0x07CE8},{1,0x07CE8},{1,0x07CE8},{1,0x07CE8}},{{1,0x07CE3},{1,0x07CE3},{1,0x07CE3},{1,0x07CE3}},
+   {{1,0x07D00},{1,0x07D00},{1,0x07D00},{1,0x07D00}},{{1,0x25F86},{1,0x25F86},{1,0x25F86},{1,0x25F86}},
+   {{1,0x07D63},{1,0x07D63},{1,0x07D63},{1,0x07D63}},{{1,0x04301},{1,0x04301},{1,0x04301},{1,0x04301}},
+   {{1,0x07DC7},{1,0x07DC7},{1,0x07DC7},{1,0x07DC7}},{{1,0x07E02},{1,0x07E02},{1,0x07E02},{1,0x07E02}},
+   {{1,0x07E45},{1,0x07E45},{1,0x07E45},{1,0x07E45}},{{1,0x04334},{1,0x04334},{1,0x04334},{1,0x04334}},
+   {{1,0x26228},{1,0x26228},{1,0x26228},{1,0x26228}},{{1,0x26247},{1,0x26247},{1,0x26247},{1,0x26247}},
+   {{1,0x04359},{1,0x04359},{1,0x04359},{1,0x04359}},{{1,0x262D9},{1,0x262D9},{1,0x262D9},{1,0x262D9}},
+   {{1,0x07F7A},{1,0x07F7A},{1,0x07F7A},{1,0x07F7A}},{{1,0x2633E},{1,0x2633E},{1,0x2633E},{1,0x2633E}},
+   {{1,0x07F95},{1,0x07F95},{1,0x07F95},{1,0x07F95}},{{1,0x07FFA},{1,0x07FFA},{1,0x07FFA},{1,0x07FFA}},
+   {{1,0x08005},{1,0x08005},{1,0x08005},{1,0x08005}},{{1,0x264DA},{1,0x264DA},{1,0x264DA},{1,0x264DA}},
+   {{1,0x26523},{1,0x26523},{1,0x26523},{1,0x26523}},{{1,0x08060},{1,0x08060},{1,0x08060},{1,0x08060}},
+   {{1,0x265A8},{1,0x265A8},{1,0x265A8},{1,0x265A8}},{{1,0x08070},{1,0x08070},{1,0x08070},{1,0x08070}}
+  },
+
+  /* block 191 */
+  {{{1,0x2335F},{1,0x2335F},{1,0x2335F},{1,0x2335F}},{{1,0x043D5},{1,0x043D5},{1,0x043D5},{1,0x043D5}},
+   {{1,0x080B2},{1,0x080B2},{1,0x080B2},{1,0x080B2}},{{1,0x08103},{1,0x08103},{1,0x08103},{1,0x08103}},
+   {{1,0x0440B},{1,0x0440B},{1,0x0440B},{1,0x0440B}},{{1,0x0813E},{1,0x0813E},{1,0x0813E},{1,0x0813E}},
+   {{1,0x05AB5},{1,0x05AB5},{1,0x05AB5},{1,0x05AB5}},{{1,0x267A7},{1,0x267A7},{1,0x267A7},{1,0x267A7}},
+   {{1,0x267B5},{1,0x267B5},{1,0x267B5},{1,0x267B5}},{{1,0x23393},{1,0x23393},{1,0x23393},{1,0x23393}},
+   {{1,0x2339C},{1,0x2339C},{1,0x2339C},{1,0x2339C}},{{1,0x08201},{1,0x08201},{1,0x08201},{1,0x08201}},
+   {{1,0x08204},{1,0x08204},{1,0x08204},{1,0x08204}},{{1,0x08F9E},{1,0x08F9E},{1,0x08F9E},{1,0x08F9E}},
+   {{1,0x0446B},{1,0x0446B},{1,0x0446B},{1,0x0446B}},{{1,0x08291},{1,0x08291},{1,0x08291},{1,0x08291}},
+   {{1,0x0828B},{1,0x0828B},{1,0x0828B},{1,0x0828B}},{{1,0x0829D},{1,0x0829D},{1,0x0829D},{1,0x0829D}},
+   {{1,0x052B3},{1,0x052B3},{1,0x052B3},{1,0x052B3}},{{1,0x082B1},{1,0x082B1},{1,0x082B1},{1,0x082B1}},
+   {{1,0x082B3},{1,0x082B3},{1,0x082B3},{1,0x082B3}},{{1,0x082BD},{1,0x082BD},{1,0x082BD},{1,0x082BD}},
+   {{1,0x082E6},{1,0x082E6},{1,0x082E6},{1,0x082E6}},{{1,0x26B3C},{1,0x26B3C},{1,0x26B3C},{1,0x26B3C}},
+   {{1,0x082E5},{1,0x082E5},{1,0x082E5},{1,0x082E5}},{{1,0x0831D},{1,0x0831D},{1,0x0831D},{1,0x0831D}},
+   {{1,0x08363},{1,0x08363},{1,0x08363},{1,0x08363}},{{1,0x083AD},{1,0x083AD},{1,0x083AD},{1,0x083AD}},
+   {{1,0x08323},{1,0x08323},{1,0x08323},{1,0x08323}},{{1,0x083BD},{1,0x083BD},{1,0x083BD},{1,0x083BD}},
+   {{1,0x083E7},{1,0x083E7},{1,0x083E7},{1,0x083E7}},{{1,0x08457},{1,0x08457},{1,0x08457},{1,0x08457}},
+   {{1,0x08353},{1,0x08353},{1,0x08353},{1,0x08353}},{{1,0x083CA},{1,0x083CA},{1,0x083CA},{1,0x083CA}},
+   {{1,0x083CC},{1,0x083CC},{1,0x083CC},{1,0x083CC}},{{1,0x083DC},{1,0x083DC},{1,0x083DC},{1,0x083DC}},
+   {{1,0x26C36},{1,0x26C36},{1,0x26C36},{1,0x26C36}},{{1,0x26D6B},{1,0x26D6B},{1,0x26D6B},{1,0x26D6B}},
+   {{1,0x26CD5},{1,0x26CD5},{1,0x26CD5},{1,0x26CD5}},{{1,0x0452B},{1,0x0452B},{1,0x0452B},{1,0x0452B}},
+   {{1,0x084F1},{1,0x084F1},{1,0x084F1},{1,0x084F1}},{{1,0x084F3},{1,0x084F3},{1,0x084F3},{1,0x084F3}},
+   {{1,0x08516},{1,0x08516},{1,0x08516},{1,0x08516}},{{1,0x273CA},{1,0x273CA},{1,0x273CA},{1,0x273CA}},
+   {{1,0x08564},{1,0x08564},{1,0x08564},{1,0x08564}},{{1,0x26F2C},{1,0x26F2C},{1,0x26F2C},{1,0x26F2C}},
+   {{1,0x0455D},{1,0x0455D},{1,0x0455D},{1,0x0455D}},{{1,0x04561},{1,0x04561},{1,0x04561},{1,0x04561}},
+   {{1,0x26FB1},{1,0x26FB1},{1,0x26FB1},{1,0x26FB1}},{{1,0x270D2},{1,0x270D2},{1,0x270D2},{1,0x270D2}},
+   {{1,0x0456B},{1,0x0456B},{1,0x0456B},{1,0x0456B}},{{1,0x08650},{1,0x08650},{1,0x08650},{1,0x08650}},
+   {{1,0x0865C},{1,0x0865C},{1,0x0865C},{1,0x0865C}},{{1,0x08667},{1,0x08667},{1,0x08667},{1,0x08667}},
+   {{1,0x08669},{1,0x08669},{1,0x08669},{1,0x08669}},{{1,0x086A9},{1,0x086A9},{1,0x086A9},{1,0x086A9}},
+   {{1,0x08688},{1,0x08688},{1,0x08688},{1,0x08688}},{{1,0x0870E},{1,0x0870E},{1,0x0870E},{1,0x0870E}},
+   {{1,0x086E2},{1,0x086E2},{1,0x086E2},{1,0x086E2}},{{1,0x08779},{1,0x08779},{1,0x08779},{1,0x08779}},
+   {{1,0x08728},{1,0x08728},{1,0x08728},{1,0x08728}},{{1,0x0876B},{1,0x0876B},{1,0x0876B},{1,0x0876B}},
+   {{1,0x08786},{1,0x08786},{1,0x08786},{1,0x08786}},{{1,0x045D7},{1,0x045D7},{1,0x045D7},{1,0x045D7}}
+  },
+
+  /* block 192 */
+  {{{1,0x087E1},{1,0x087E1},{1,0x087E1},{1,0x087E1}},{{1,0x08801},{1,0x08801},{1,0x08801},{1,0x08801}},
+   {{1,0x045F9},{1,0x045F9},{1,0x045F9},{1,0x045F9}},{{1,0x08860},{1,0x08860},{1,0x08860},{1,0x08860}},
+   {{1,0x08863},{1,0x08863},{1,0x08863},{1,0x08863}},{{1,0x27667},{1,0x27667},{1,0x27667},{1,0x27667}},
+   {{1,0x088D7},{1,0x088D7},{1,0x088D7},{1,0x088D7}},{{1,0x088DE},{1,0x088DE},{1,0x088DE},{1,0x088DE}},
+   {{1,0x04635},{1,0x04635},{1,0x04635},{1,0x04635}},{{1,0x088FA},{1,0x088FA},{1,0x088FA},{1,0x088FA}},
+   {{1,0x034BB},{1,0x034BB},{1,0x034BB},{1,0x034BB}},{{1,0x278AE},{1,0x278AE},{1,0x278AE},{1,0x278AE}},
+   {{1,0x27966},{1,0x27966},{1,0x27966},{1,0x27966}},{{1,0x046BE},{1,0x046BE},{1,0x046BE},{1,0x046BE}},
+   {{1,0x046C7},{1,0x046C7},{1,0x046C7},{1,0x046C7}},{{1,0x08AA0},{1,0x08AA0},{1,0x08AA0},{1,0x08AA0}},
+   {{1,0x08AED},{1,0x08AED},{1,0x08AED},{1,0x08AED}},{{1,0x08B8A},{1,0x08B8A},{1,0x08B8A},{1,0x08B8A}},
+   {{1,0x08C55},{1,0x08C55},{1,0x08C55},{1,0x08C55}},{{1,0x27CA8},{1,0x27CA8},{1,0x27CA8},{1,0x27CA8}},
+   {{1,0x08CAB},{1,0x08CAB},{1,0x08CAB},{1,0x08CAB}},{{1,0x08CC1},{1,0x08CC1},{1,0x08CC1},{1,0x08CC1}},
+   {{1,0x08D1B},{1,0x08D1B},{1,0x08D1B},{1,0x08D1B}},{{1,0x08D77},{1,0x08D77},{1,0x08D77},{1,0x08D77}},
+   {{1,0x27F2F},{1,0x27F2F},{1,0x27F2F},{1,0x27F2F}},{{1,0x20804},{1,0x20804},{1,0x20804},{1,0x20804}},
+   {{1,0x08DCB},{1,0x08DCB},{1,0x08DCB},{1,0x08DCB}},{{1,0x08DBC},{1,0x08DBC},{1,0x08DBC},{1,0x08DBC}},
+   {{1,0x08DF0},{1,0x08DF0},{1,0x08DF0},{1,0x08DF0}},{{1,0x208DE},{1,0x208DE},{1,0x208DE},{1,0x208DE}},
+   {{1,0x08ED4},{1,0x08ED4},{1,0x08ED4},{1,0x08ED4}},{{1,0x08F38},{1,0x08F38},{1,0x08F38},{1,0x08F38}},
+   {{1,0x285D2},{1,0x285D2},{1,0x285D2},{1,0x285D2}},{{1,0x285ED},{1,0x285ED},{1,0x285ED},{1,0x285ED}},
+   {{1,0x09094},{1,0x09094},{1,0x09094},{1,0x09094}},{{1,0x090F1},{1,0x090F1},{1,0x090F1},{1,0x090F1}},
+   {{1,0x09111},{1,0x09111},{1,0x09111},{1,0x09111}},{{1,0x2872E},{1,0x2872E},{1,0x2872E},{1,0x2872E}},
+   {{1,0x0911B},{1,0x0911B},{1,0x0911B},{1,0x0911B}},{{1,0x09238},{1,0x09238},{1,0x09238},{1,0x09238}},
+   {{1,0x092D7},{1,0x092D7},{1,0x092D7},{1,0x092D7}},{{1,0x092D8},{1,0x092D8},{1,0x092D8},{1,0x092D8}},
+   {{1,0x0927C},{1,0x0927C},{1,0x0927C},{1,0x0927C}},{{1,0x093F9},{1,0x093F9},{1,0x093F9},{1,0x093F9}},
+   {{1,0x09415},{1,0x09415},{1,0x09415},{1,0x09415}},{{1,0x28BFA},{1,0x28BFA},{1,0x28BFA},{1,0x28BFA}},
+   {{1,0x0958B},{1,0x0958B},{1,0x0958B},{1,0x0958B}},{{1,0x04995},{1,0x04995},{1,0x04995},{1,0x04995}},
+   {{1,0x095B7},{1,0x095B7},{1,0x095B7},{1,0x095B7}},{{1,0x28D77},{1,0x28D77},{1,0x28D77},{1,0x28D77}},
+   {{1,0x049E6},{1,0x049E6},{1,0x049E6},{1,0x049E6}},{{1,0x096C3},{1,0x096C3},{1,0x096C3},{1,0x096C3}},
+   {{1,0x05DB2},{1,0x05DB2},{1,0x05DB2},{1,0x05DB2}},{{1,0x09723},{1,0x09723},{1,0x09723},{1,0x09723}},
+   {{1,0x29145},{1,0x29145},{1,0x29145},{1,0x29145}},{{1,0x2921A},{1,0x2921A},{1,0x2921A},{1,0x2921A}},
+   {{1,0x04A6E},{1,0x04A6E},{1,0x04A6E},{1,0x04A6E}},{{1,0x04A76},{1,0x04A76},{1,0x04A76},{1,0x04A76}},
+   {{1,0x097E0},{1,0x097E0},{1,0x097E0},{1,0x097E0}},{{1,0x2940A},{1,0x2940A},{1,0x2940A},{1,0x2940A}},
+   {{1,0x04AB2},{1,0x04AB2},{1,0x04AB2},{1,0x04AB2}},{{1,0x29496},{1,0x29496},{1,0x29496},{1,0x29496}},
+   {{1,0x0980B},{1,0x0980B},{1,0x0980B},{1,0x0980B}},{{1,0x0980B},{1,0x0980B},{1,0x0980B},{1,0x0980B}}
+  },
+
+  /* block 193 */
+  {{{1,0x09829},{1,0x09829},{1,0x09829},{1,0x09829}},{{1,0x295B6},{1,0x295B6},{1,0x295B6},{1,0x295B6}},
+   {{1,0x098E2},{1,0x098E2},{1,0x098E2},{1,0x098E2}},{{1,0x04B33},{1,0x04B33},{1,0x04B33},{1,0x04B33}},
+   {{1,0x09929},{1,0x09929},{1,0x09929},{1,0x09929}},{{1,0x099A7},{1,0x099A7},{1,0x099A7},{1,0x099A7}},
+   {{1,0x099C2},{1,0x099C2},{1,0x099C2},{1,0x099C2}},{{1,0x099FE},{1,0x099FE},{1,0x099FE},{1,0x099FE}},
+   {{1,0x04BCE},{1,0x04BCE},{1,0x04BCE},{1,0x04BCE}},{{1,0x29B30},{1,0x29B30},{1,0x29B30},{1,0x29B30}},
+   {{1,0x09B12},{1,0x09B12},{1,0x09B12},{1,0x09B12}},{{1,0x09C40},{1,0x09C40},{1,0x09C40},{1,0x09C40}},
+   {{1,0x09CFD},{1,0x09CFD},{1,0x09CFD},{1,0x09CFD}},{{1,0x04CCE},{1,0x04CCE},{1,0x04CCE},{1,0x04CCE}},
+   {{1,0x04CED},{1,0x04CED},{1,0x04CED},{1,0x04CED}},{{1,0x09D67},{1,0x09D67},{1,0x09D67},{1,0x09D67}},
+   {{1,0x2A0CE},{1,0x2A0CE},{1,0x2A0CE},{1,0x2A0CE}},{{1,0x04CF8},{1,0x04CF8},{1,0x04CF8},{1,0x04CF8}},
+   {{1,0x2A105},{1,0x2A105},{1,0x2A105},{1,0x2A105}},{{1,0x2A20E},{1,0x2A20E},{1,0x2A20E},{1,0x2A20E}},
+   {{1,0x2A291},{1,0x2A291},{1,0x2A291},{1,0x2A291}},{{1,0x09EBB},{1,0x09EBB},{1,0x09EBB},{1,0x09EBB}},
+   {{1,0x04D56},{1,0x04D56},{1,0x04D56},{1,0x04D56}},{{1,0x09EF9},{1,0x09EF9},{1,0x09EF9},{1,0x09EF9}},
+   {{1,0x09EFE},{1,0x09EFE},{1,0x09EFE},{1,0x09EFE}},{{1,0x09F05},{1,0x09F05},{1,0x09F05},{1,0x09F05}},
+   {{1,0x09F0F},{1,0x09F0F},{1,0x09F0F},{1,0x09F0F}},{{1,0x09F16},{1,0x09F16},{1,0x09F16},{1,0x09F16}},
+   {{1,0x09F3B},{1,0x09F3B},{1,0x09F3B},{1,0x09F3B}},{{1,0x2A600},{1,0x2A600},{1,0x2A600},{1,0x2A600}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},
+   {{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}},{{0,0x00000},{0,0x00000},{0,0x00000},{0,0x00000}}
+  }
+};
+
+static const int32_t normmap_mapping[] = {
+/* 0x0000 */ 0x0020,0x0308,0x0020,0x0304,0x0020,0x0301,0x0020,0x0327,
+/* 0x0008 */ 0x0031,0x2044,0x0034,0x0031,0x2044,0x0032,0x0033,0x2044,
+/* 0x0010 */ 0x0034,0x0041,0x0300,0x0061,0x0300,0x0041,0x0301,0x0061,
+/* 0x0018 */ 0x0301,0x0041,0x0302,0x0061,0x0302,0x0041,0x0303,0x0061,
+/* 0x0020 */ 0x0303,0x0041,0x0308,0x0061,0x0308,0x0041,0x030A,0x0061,
+/* 0x0028 */ 0x030A,0x0043,0x0327,0x0063,0x0327,0x0045,0x0300,0x0065,
+/* 0x0030 */ 0x0300,0x0045,0x0301,0x0065,0x0301,0x0045,0x0302,0x0065,
+/* 0x0038 */ 0x0302,0x0045,0x0308,0x0065,0x0308,0x0049,0x0300,0x0069,
+/* 0x0040 */ 0x0300,0x0049,0x0301,0x0069,0x0301,0x0049,0x0302,0x0069,
+/* 0x0048 */ 0x0302,0x0049,0x0308,0x0069,0x0308,0x004E,0x0303,0x006E,
+/* 0x0050 */ 0x0303,0x004F,0x0300,0x006F,0x0300,0x004F,0x0301,0x006F,
+/* 0x0058 */ 0x0301,0x004F,0x0302,0x006F,0x0302,0x004F,0x0303,0x006F,
+/* 0x0060 */ 0x0303,0x004F,0x0308,0x006F,0x0308,0x0055,0x0300,0x0075,
+/* 0x0068 */ 0x0300,0x0055,0x0301,0x0075,0x0301,0x0055,0x0302,0x0075,
+/* 0x0070 */ 0x0302,0x0055,0x0308,0x0075,0x0308,0x0059,0x0301,0x0079,
+/* 0x0078 */ 0x0301,0x0073,0x0073,0x0079,0x0308,0x0041,0x0304,0x0061,
+/* 0x0080 */ 0x0304,0x0041,0x0306,0x0061,0x0306,0x0041,0x0328,0x0061,
+/* 0x0088 */ 0x0328,0x0043,0x0301,0x0063,0x0301,0x0043,0x0302,0x0063,
+/* 0x0090 */ 0x0302,0x0043,0x0307,0x0063,0x0307,0x0043,0x030C,0x0063,
+/* 0x0098 */ 0x030C,0x0044,0x030C,0x0064,0x030C,0x0045,0x0304,0x0065,
+/* 0x00A0 */ 0x0304,0x0045,0x0306,0x0065,0x0306,0x0045,0x0307,0x0065,
+/* 0x00A8 */ 0x0307,0x0045,0x0328,0x0065,0x0328,0x0045,0x030C,0x0065,
+/* 0x00B0 */ 0x030C,0x0047,0x0302,0x0067,0x0302,0x0047,0x0306,0x0067,
+/* 0x00B8 */ 0x0306,0x0047,0x0307,0x0067,0x0307,0x0047,0x0327,0x0067,
+/* 0x00C0 */ 0x0327,0x0048,0x0302,0x0068,0x0302,0x0049,0x0303,0x0069,
+/* 0x00C8 */ 0x0303,0x0049,0x0304,0x0069,0x0304,0x0049,0x0306,0x0069,
+/* 0x00D0 */ 0x0306,0x0049,0x0328,0x0069,0x0328,0x0049,0x0307,0x0069,
+/* 0x00D8 */ 0x0307,0x0049,0x004A,0x0069,0x006A,0x004A,0x0302,0x006A,
+/* 0x00E0 */ 0x0302,0x004B,0x0327,0x006B,0x0327,0x004C,0x0301,0x006C,
+/* 0x00E8 */ 0x0301,0x004C,0x0327,0x006C,0x0327,0x004C,0x030C,0x006C,
+/* 0x00F0 */ 0x030C,0x004C,0x00B7,0x006C,0x00B7,0x004E,0x0301,0x006E,
+/* 0x00F8 */ 0x0301,0x004E,0x0327,0x006E,0x0327,0x004E,0x030C,0x006E,
+/* 0x0100 */ 0x030C,0x02BC,0x006E,0x004F,0x0304,0x006F,0x0304,0x004F,
+/* 0x0108 */ 0x0306,0x006F,0x0306,0x004F,0x030B,0x006F,0x030B,0x0052,
+/* 0x0110 */ 0x0301,0x0072,0x0301,0x0052,0x0327,0x0072,0x0327,0x0052,
+/* 0x0118 */ 0x030C,0x0072,0x030C,0x0053,0x0301,0x0073,0x0301,0x0053,
+/* 0x0120 */ 0x0302,0x0073,0x0302,0x0053,0x0327,0x0073,0x0327,0x0053,
+/* 0x0128 */ 0x030C,0x0073,0x030C,0x0054,0x0327,0x0074,0x0327,0x0054,
+/* 0x0130 */ 0x030C,0x0074,0x030C,0x0055,0x0303,0x0075,0x0303,0x0055,
+/* 0x0138 */ 0x0304,0x0075,0x0304,0x0055,0x0306,0x0075,0x0306,0x0055,
+/* 0x0140 */ 0x030A,0x0075,0x030A,0x0055,0x030B,0x0075,0x030B,0x0055,
+/* 0x0148 */ 0x0328,0x0075,0x0328,0x0057,0x0302,0x0077,0x0302,0x0059,
+/* 0x0150 */ 0x0302,0x0079,0x0302,0x0059,0x0308,0x005A,0x0301,0x007A,
+/* 0x0158 */ 0x0301,0x005A,0x0307,0x007A,0x0307,0x005A,0x030C,0x007A,
+/* 0x0160 */ 0x030C,0x004F,0x031B,0x006F,0x031B,0x0055,0x031B,0x0075,
+/* 0x0168 */ 0x031B,0x0044,0x005A,0x030C,0x0064,0x007A,0x030C,0x0044,
+/* 0x0170 */ 0x007A,0x030C,0x004C,0x004A,0x006C,0x006A,0x004C,0x006A,
+/* 0x0178 */ 0x004E,0x004A,0x006E,0x006A,0x004E,0x006A,0x0041,0x030C,
+/* 0x0180 */ 0x0061,0x030C,0x0049,0x030C,0x0069,0x030C,0x004F,0x030C,
+/* 0x0188 */ 0x006F,0x030C,0x0055,0x030C,0x0075,0x030C,0x0055,0x0308,
+/* 0x0190 */ 0x0304,0x0075,0x0308,0x0304,0x0055,0x0308,0x0301,0x0075,
+/* 0x0198 */ 0x0308,0x0301,0x0055,0x0308,0x030C,0x0075,0x0308,0x030C,
+/* 0x01A0 */ 0x0055,0x0308,0x0300,0x0075,0x0308,0x0300,0x0041,0x0308,
+/* 0x01A8 */ 0x0304,0x0061,0x0308,0x0304,0x0041,0x0307,0x0304,0x0061,
+/* 0x01B0 */ 0x0307,0x0304,0x00C6,0x0304,0x00E6,0x0304,0x0047,0x030C,
+/* 0x01B8 */ 0x0067,0x030C,0x004B,0x030C,0x006B,0x030C,0x004F,0x0328,
+/* 0x01C0 */ 0x006F,0x0328,0x004F,0x0328,0x0304,0x006F,0x0328,0x0304,
+/* 0x01C8 */ 0x01B7,0x030C,0x0292,0x030C,0x006A,0x030C,0x0044,0x005A,
+/* 0x01D0 */ 0x0064,0x007A,0x0044,0x007A,0x0047,0x0301,0x0067,0x0301,
+/* 0x01D8 */ 0x004E,0x0300,0x006E,0x0300,0x0041,0x030A,0x0301,0x0061,
+/* 0x01E0 */ 0x030A,0x0301,0x00C6,0x0301,0x00E6,0x0301,0x00D8,0x0301,
+/* 0x01E8 */ 0x00F8,0x0301,0x0041,0x030F,0x0061,0x030F,0x0041,0x0311,
+/* 0x01F0 */ 0x0061,0x0311,0x0045,0x030F,0x0065,0x030F,0x0045,0x0311,
+/* 0x01F8 */ 0x0065,0x0311,0x0049,0x030F,0x0069,0x030F,0x0049,0x0311,
+/* 0x0200 */ 0x0069,0x0311,0x004F,0x030F,0x006F,0x030F,0x004F,0x0311,
+/* 0x0208 */ 0x006F,0x0311,0x0052,0x030F,0x0072,0x030F,0x0052,0x0311,
+/* 0x0210 */ 0x0072,0x0311,0x0055,0x030F,0x0075,0x030F,0x0055,0x0311,
+/* 0x0218 */ 0x0075,0x0311,0x0053,0x0326,0x0073,0x0326,0x0054,0x0326,
+/* 0x0220 */ 0x0074,0x0326,0x0048,0x030C,0x0068,0x030C,0x0041,0x0307,
+/* 0x0228 */ 0x0061,0x0307,0x0045,0x0327,0x0065,0x0327,0x004F,0x0308,
+/* 0x0230 */ 0x0304,0x006F,0x0308,0x0304,0x004F,0x0303,0x0304,0x006F,
+/* 0x0238 */ 0x0303,0x0304,0x004F,0x0307,0x006F,0x0307,0x004F,0x0307,
+/* 0x0240 */ 0x0304,0x006F,0x0307,0x0304,0x0059,0x0304,0x0079,0x0304,
+/* 0x0248 */ 0x0020,0x0306,0x0020,0x0307,0x0020,0x030A,0x0020,0x0328,
+/* 0x0250 */ 0x0020,0x0303,0x0020,0x030B,0x0308,0x0301,0x0020,0x0345,
+/* 0x0258 */ 0x0020,0x03B9,0x00A8,0x0301,0x0020,0x0308,0x0301,0x0391,
+/* 0x0260 */ 0x0301,0x03B1,0x0301,0x0395,0x0301,0x03B5,0x0301,0x0397,
+/* 0x0268 */ 0x0301,0x03B7,0x0301,0x0399,0x0301,0x03B9,0x0301,0x039F,
+/* 0x0270 */ 0x0301,0x03BF,0x0301,0x03A5,0x0301,0x03C5,0x0301,0x03A9,
+/* 0x0278 */ 0x0301,0x03C9,0x0301,0x03B9,0x0308,0x0301,0x0399,0x0308,
+/* 0x0280 */ 0x03B9,0x0308,0x03A5,0x0308,0x03C5,0x0308,0x03C5,0x0308,
+/* 0x0288 */ 0x0301,0x03D2,0x0301,0x03D2,0x0308,0x0415,0x0300,0x0435,
+/* 0x0290 */ 0x0300,0x0415,0x0308,0x0435,0x0308,0x0413,0x0301,0x0433,
+/* 0x0298 */ 0x0301,0x0406,0x0308,0x0456,0x0308,0x041A,0x0301,0x043A,
+/* 0x02A0 */ 0x0301,0x0418,0x0300,0x0438,0x0300,0x0423,0x0306,0x0443,
+/* 0x02A8 */ 0x0306,0x0418,0x0306,0x0438,0x0306,0x0474,0x030F,0x0475,
+/* 0x02B0 */ 0x030F,0x0416,0x0306,0x0436,0x0306,0x0410,0x0306,0x0430,
+/* 0x02B8 */ 0x0306,0x0410,0x0308,0x0430,0x0308,0x0415,0x0306,0x0435,
+/* 0x02C0 */ 0x0306,0x04D8,0x0308,0x04D9,0x0308,0x0416,0x0308,0x0436,
+/* 0x02C8 */ 0x0308,0x0417,0x0308,0x0437,0x0308,0x0418,0x0304,0x0438,
+/* 0x02D0 */ 0x0304,0x0418,0x0308,0x0438,0x0308,0x041E,0x0308,0x043E,
+/* 0x02D8 */ 0x0308,0x04E8,0x0308,0x04E9,0x0308,0x042D,0x0308,0x044D,
+/* 0x02E0 */ 0x0308,0x0423,0x0304,0x0443,0x0304,0x0423,0x0308,0x0443,
+/* 0x02E8 */ 0x0308,0x0423,0x030B,0x0443,0x030B,0x0427,0x0308,0x0447,
+/* 0x02F0 */ 0x0308,0x042B,0x0308,0x044B,0x0308,0x0565,0x0582,0x0627,
+/* 0x02F8 */ 0x0653,0x0627,0x0654,0x0648,0x0654,0x0627,0x0655,0x064A,
+/* 0x0300 */ 0x0654,0x0627,0x0674,0x0648,0x0674,0x06C7,0x0674,0x064A,
+/* 0x0308 */ 0x0674,0x06D5,0x0654,0x06C1,0x0654,0x06D2,0x0654,0x0928,
+/* 0x0310 */ 0x093C,0x0930,0x093C,0x0933,0x093C,0x0915,0x093C,0x0916,
+/* 0x0318 */ 0x093C,0x0917,0x093C,0x091C,0x093C,0x0921,0x093C,0x0922,
+/* 0x0320 */ 0x093C,0x092B,0x093C,0x092F,0x093C,0x09C7,0x09BE,0x09C7,
+/* 0x0328 */ 0x09D7,0x09A1,0x09BC,0x09A2,0x09BC,0x09AF,0x09BC,0x0A32,
+/* 0x0330 */ 0x0A3C,0x0A38,0x0A3C,0x0A16,0x0A3C,0x0A17,0x0A3C,0x0A1C,
+/* 0x0338 */ 0x0A3C,0x0A2B,0x0A3C,0x0B47,0x0B56,0x0B47,0x0B3E,0x0B47,
+/* 0x0340 */ 0x0B57,0x0B21,0x0B3C,0x0B22,0x0B3C,0x0B92,0x0BD7,0x0BC6,
+/* 0x0348 */ 0x0BBE,0x0BC7,0x0BBE,0x0BC6,0x0BD7,0x0C46,0x0C56,0x0CBF,
+/* 0x0350 */ 0x0CD5,0x0CC6,0x0CD5,0x0CC6,0x0CD6,0x0CC6,0x0CC2,0x0CC6,
+/* 0x0358 */ 0x0CC2,0x0CD5,0x0D46,0x0D3E,0x0D47,0x0D3E,0x0D46,0x0D57,
+/* 0x0360 */ 0x0DD9,0x0DCA,0x0DD9,0x0DCF,0x0DD9,0x0DCF,0x0DCA,0x0DD9,
+/* 0x0368 */ 0x0DDF,0x0E4D,0x0E32,0x0ECD,0x0EB2,0x0EAB,0x0E99,0x0EAB,
+/* 0x0370 */ 0x0EA1,0x0F42,0x0FB7,0x0F4C,0x0FB7,0x0F51,0x0FB7,0x0F56,
+/* 0x0378 */ 0x0FB7,0x0F5B,0x0FB7,0x0F40,0x0FB5,0x0F71,0x0F72,0x0F71,
+/* 0x0380 */ 0x0F74,0x0FB2,0x0F80,0x0FB2,0x0F71,0x0F80,0x0FB3,0x0F80,
+/* 0x0388 */ 0x0FB3,0x0F71,0x0F80,0x0F71,0x0F80,0x0F92,0x0FB7,0x0F9C,
+/* 0x0390 */ 0x0FB7,0x0FA1,0x0FB7,0x0FA6,0x0FB7,0x0FAB,0x0FB7,0x0F90,
+/* 0x0398 */ 0x0FB5,0x1025,0x102E,0x1B05,0x1B35,0x1B07,0x1B35,0x1B09,
+/* 0x03A0 */ 0x1B35,0x1B0B,0x1B35,0x1B0D,0x1B35,0x1B11,0x1B35,0x1B3A,
+/* 0x03A8 */ 0x1B35,0x1B3C,0x1B35,0x1B3E,0x1B35,0x1B3F,0x1B35,0x1B42,
+/* 0x03B0 */ 0x1B35,0x0041,0x0325,0x0061,0x0325,0x0042,0x0307,0x0062,
+/* 0x03B8 */ 0x0307,0x0042,0x0323,0x0062,0x0323,0x0042,0x0331,0x0062,
+/* 0x03C0 */ 0x0331,0x0043,0x0327,0x0301,0x0063,0x0327,0x0301,0x0044,
+/* 0x03C8 */ 0x0307,0x0064,0x0307,0x0044,0x0323,0x0064,0x0323,0x0044,
+/* 0x03D0 */ 0x0331,0x0064,0x0331,0x0044,0x0327,0x0064,0x0327,0x0044,
+/* 0x03D8 */ 0x032D,0x0064,0x032D,0x0045,0x0304,0x0300,0x0065,0x0304,
+/* 0x03E0 */ 0x0300,0x0045,0x0304,0x0301,0x0065,0x0304,0x0301,0x0045,
+/* 0x03E8 */ 0x032D,0x0065,0x032D,0x0045,0x0330,0x0065,0x0330,0x0045,
+/* 0x03F0 */ 0x0327,0x0306,0x0065,0x0327,0x0306,0x0046,0x0307,0x0066,
+/* 0x03F8 */ 0x0307,0x0047,0x0304,0x0067,0x0304,0x0048,0x0307,0x0068,
+/* 0x0400 */ 0x0307,0x0048,0x0323,0x0068,0x0323,0x0048,0x0308,0x0068,
+/* 0x0408 */ 0x0308,0x0048,0x0327,0x0068,0x0327,0x0048,0x032E,0x0068,
+/* 0x0410 */ 0x032E,0x0049,0x0330,0x0069,0x0330,0x0049,0x0308,0x0301,
+/* 0x0418 */ 0x0069,0x0308,0x0301,0x004B,0x0301,0x006B,0x0301,0x004B,
+/* 0x0420 */ 0x0323,0x006B,0x0323,0x004B,0x0331,0x006B,0x0331,0x004C,
+/* 0x0428 */ 0x0323,0x006C,0x0323,0x004C,0x0323,0x0304,0x006C,0x0323,
+/* 0x0430 */ 0x0304,0x004C,0x0331,0x006C,0x0331,0x004C,0x032D,0x006C,
+/* 0x0438 */ 0x032D,0x004D,0x0301,0x006D,0x0301,0x004D,0x0307,0x006D,
+/* 0x0440 */ 0x0307,0x004D,0x0323,0x006D,0x0323,0x004E,0x0307,0x006E,
+/* 0x0448 */ 0x0307,0x004E,0x0323,0x006E,0x0323,0x004E,0x0331,0x006E,
+/* 0x0450 */ 0x0331,0x004E,0x032D,0x006E,0x032D,0x004F,0x0303,0x0301,
+/* 0x0458 */ 0x006F,0x0303,0x0301,0x004F,0x0303,0x0308,0x006F,0x0303,
+/* 0x0460 */ 0x0308,0x004F,0x0304,0x0300,0x006F,0x0304,0x0300,0x004F,
+/* 0x0468 */ 0x0304,0x0301,0x006F,0x0304,0x0301,0x0050,0x0301,0x0070,
+/* 0x0470 */ 0x0301,0x0050,0x0307,0x0070,0x0307,0x0052,0x0307,0x0072,
+/* 0x0478 */ 0x0307,0x0052,0x0323,0x0072,0x0323,0x0052,0x0323,0x0304,
+/* 0x0480 */ 0x0072,0x0323,0x0304,0x0052,0x0331,0x0072,0x0331,0x0053,
+/* 0x0488 */ 0x0307,0x0073,0x0307,0x0053,0x0323,0x0073,0x0323,0x0053,
+/* 0x0490 */ 0x0301,0x0307,0x0073,0x0301,0x0307,0x0053,0x030C,0x0307,
+/* 0x0498 */ 0x0073,0x030C,0x0307,0x0053,0x0323,0x0307,0x0073,0x0323,
+/* 0x04A0 */ 0x0307,0x0054,0x0307,0x0074,0x0307,0x0054,0x0323,0x0074,
+/* 0x04A8 */ 0x0323,0x0054,0x0331,0x0074,0x0331,0x0054,0x032D,0x0074,
+/* 0x04B0 */ 0x032D,0x0055,0x0324,0x0075,0x0324,0x0055,0x0330,0x0075,
+/* 0x04B8 */ 0x0330,0x0055,0x032D,0x0075,0x032D,0x0055,0x0303,0x0301,
+/* 0x04C0 */ 0x0075,0x0303,0x0301,0x0055,0x0304,0x0308,0x0075,0x0304,
+/* 0x04C8 */ 0x0308,0x0056,0x0303,0x0076,0x0303,0x0056,0x0323,0x0076,
+/* 0x04D0 */ 0x0323,0x0057,0x0300,0x0077,0x0300,0x0057,0x0301,0x0077,
+/* 0x04D8 */ 0x0301,0x0057,0x0308,0x0077,0x0308,0x0057,0x0307,0x0077,
+/* 0x04E0 */ 0x0307,0x0057,0x0323,0x0077,0x0323,0x0058,0x0307,0x0078,
+/* 0x04E8 */ 0x0307,0x0058,0x0308,0x0078,0x0308,0x0059,0x0307,0x0079,
+/* 0x04F0 */ 0x0307,0x005A,0x0302,0x007A,0x0302,0x005A,0x0323,0x007A,
+/* 0x04F8 */ 0x0323,0x005A,0x0331,0x007A,0x0331,0x0068,0x0331,0x0074,
+/* 0x0500 */ 0x0308,0x0077,0x030A,0x0079,0x030A,0x0061,0x02BE,0x017F,
+/* 0x0508 */ 0x0307,0x0041,0x0323,0x0061,0x0323,0x0041,0x0309,0x0061,
+/* 0x0510 */ 0x0309,0x0041,0x0302,0x0301,0x0061,0x0302,0x0301,0x0041,
+/* 0x0518 */ 0x0302,0x0300,0x0061,0x0302,0x0300,0x0041,0x0302,0x0309,
+/* 0x0520 */ 0x0061,0x0302,0x0309,0x0041,0x0302,0x0303,0x0061,0x0302,
+/* 0x0528 */ 0x0303,0x0041,0x0323,0x0302,0x0061,0x0323,0x0302,0x0041,
+/* 0x0530 */ 0x0306,0x0301,0x0061,0x0306,0x0301,0x0041,0x0306,0x0300,
+/* 0x0538 */ 0x0061,0x0306,0x0300,0x0041,0x0306,0x0309,0x0061,0x0306,
+/* 0x0540 */ 0x0309,0x0041,0x0306,0x0303,0x0061,0x0306,0x0303,0x0041,
+/* 0x0548 */ 0x0323,0x0306,0x0061,0x0323,0x0306,0x0045,0x0323,0x0065,
+/* 0x0550 */ 0x0323,0x0045,0x0309,0x0065,0x0309,0x0045,0x0303,0x0065,
+/* 0x0558 */ 0x0303,0x0045,0x0302,0x0301,0x0065,0x0302,0x0301,0x0045,
+/* 0x0560 */ 0x0302,0x0300,0x0065,0x0302,0x0300,0x0045,0x0302,0x0309,
+/* 0x0568 */ 0x0065,0x0302,0x0309,0x0045,0x0302,0x0303,0x0065,0x0302,
+/* 0x0570 */ 0x0303,0x0045,0x0323,0x0302,0x0065,0x0323,0x0302,0x0049,
+/* 0x0578 */ 0x0309,0x0069,0x0309,0x0049,0x0323,0x0069,0x0323,0x004F,
+/* 0x0580 */ 0x0323,0x006F,0x0323,0x004F,0x0309,0x006F,0x0309,0x004F,
+/* 0x0588 */ 0x0302,0x0301,0x006F,0x0302,0x0301,0x004F,0x0302,0x0300,
+/* 0x0590 */ 0x006F,0x0302,0x0300,0x004F,0x0302,0x0309,0x006F,0x0302,
+/* 0x0598 */ 0x0309,0x004F,0x0302,0x0303,0x006F,0x0302,0x0303,0x004F,
+/* 0x05A0 */ 0x0323,0x0302,0x006F,0x0323,0x0302,0x004F,0x031B,0x0301,
+/* 0x05A8 */ 0x006F,0x031B,0x0301,0x004F,0x031B,0x0300,0x006F,0x031B,
+/* 0x05B0 */ 0x0300,0x004F,0x031B,0x0309,0x006F,0x031B,0x0309,0x004F,
+/* 0x05B8 */ 0x031B,0x0303,0x006F,0x031B,0x0303,0x004F,0x031B,0x0323,
+/* 0x05C0 */ 0x006F,0x031B,0x0323,0x0055,0x0323,0x0075,0x0323,0x0055,
+/* 0x05C8 */ 0x0309,0x0075,0x0309,0x0055,0x031B,0x0301,0x0075,0x031B,
+/* 0x05D0 */ 0x0301,0x0055,0x031B,0x0300,0x0075,0x031B,0x0300,0x0055,
+/* 0x05D8 */ 0x031B,0x0309,0x0075,0x031B,0x0309,0x0055,0x031B,0x0303,
+/* 0x05E0 */ 0x0075,0x031B,0x0303,0x0055,0x031B,0x0323,0x0075,0x031B,
+/* 0x05E8 */ 0x0323,0x0059,0x0300,0x0079,0x0300,0x0059,0x0323,0x0079,
+/* 0x05F0 */ 0x0323,0x0059,0x0309,0x0079,0x0309,0x0059,0x0303,0x0079,
+/* 0x05F8 */ 0x0303,0x03B1,0x0313,0x03B1,0x0314,0x03B1,0x0313,0x0300,
+/* 0x0600 */ 0x03B1,0x0314,0x0300,0x03B1,0x0313,0x0301,0x03B1,0x0314,
+/* 0x0608 */ 0x0301,0x03B1,0x0313,0x0342,0x03B1,0x0314,0x0342,0x0391,
+/* 0x0610 */ 0x0313,0x0391,0x0314,0x0391,0x0313,0x0300,0x0391,0x0314,
+/* 0x0618 */ 0x0300,0x0391,0x0313,0x0301,0x0391,0x0314,0x0301,0x0391,
+/* 0x0620 */ 0x0313,0x0342,0x0391,0x0314,0x0342,0x03B5,0x0313,0x03B5,
+/* 0x0628 */ 0x0314,0x03B5,0x0313,0x0300,0x03B5,0x0314,0x0300,0x03B5,
+/* 0x0630 */ 0x0313,0x0301,0x03B5,0x0314,0x0301,0x0395,0x0313,0x0395,
+/* 0x0638 */ 0x0314,0x0395,0x0313,0x0300,0x0395,0x0314,0x0300,0x0395,
+/* 0x0640 */ 0x0313,0x0301,0x0395,0x0314,0x0301,0x03B7,0x0313,0x03B7,
+/* 0x0648 */ 0x0314,0x03B7,0x0313,0x0300,0x03B7,0x0314,0x0300,0x03B7,
+/* 0x0650 */ 0x0313,0x0301,0x03B7,0x0314,0x0301,0x03B7,0x0313,0x0342,
+/* 0x0658 */ 0x03B7,0x0314,0x0342,0x0397,0x0313,0x0397,0x0314,0x0397,
+/* 0x0660 */ 0x0313,0x0300,0x0397,0x0314,0x0300,0x0397,0x0313,0x0301,
+/* 0x0668 */ 0x0397,0x0314,0x0301,0x0397,0x0313,0x0342,0x0397,0x0314,
+/* 0x0670 */ 0x0342,0x03B9,0x0313,0x03B9,0x0314,0x03B9,0x0313,0x0300,
+/* 0x0678 */ 0x03B9,0x0314,0x0300,0x03B9,0x0313,0x0301,0x03B9,0x0314,
+/* 0x0680 */ 0x0301,0x03B9,0x0313,0x0342,0x03B9,0x0314,0x0342,0x0399,
+/* 0x0688 */ 0x0313,0x0399,0x0314,0x0399,0x0313,0x0300,0x0399,0x0314,
+/* 0x0690 */ 0x0300,0x0399,0x0313,0x0301,0x0399,0x0314,0x0301,0x0399,
+/* 0x0698 */ 0x0313,0x0342,0x0399,0x0314,0x0342,0x03BF,0x0313,0x03BF,
+/* 0x06A0 */ 0x0314,0x03BF,0x0313,0x0300,0x03BF,0x0314,0x0300,0x03BF,
+/* 0x06A8 */ 0x0313,0x0301,0x03BF,0x0314,0x0301,0x039F,0x0313,0x039F,
+/* 0x06B0 */ 0x0314,0x039F,0x0313,0x0300,0x039F,0x0314,0x0300,0x039F,
+/* 0x06B8 */ 0x0313,0x0301,0x039F,0x0314,0x0301,0x03C5,0x0313,0x03C5,
+/* 0x06C0 */ 0x0314,0x03C5,0x0313,0x0300,0x03C5,0x0314,0x0300,0x03C5,
+/* 0x06C8 */ 0x0313,0x0301,0x03C5,0x0314,0x0301,0x03C5,0x0313,0x0342,
+/* 0x06D0 */ 0x03C5,0x0314,0x0342,0x03A5,0x0314,0x03A5,0x0314,0x0300,
+/* 0x06D8 */ 0x03A5,0x0314,0x0301,0x03A5,0x0314,0x0342,0x03C9,0x0313,
+/* 0x06E0 */ 0x03C9,0x0314,0x03C9,0x0313,0x0300,0x03C9,0x0314,0x0300,
+/* 0x06E8 */ 0x03C9,0x0313,0x0301,0x03C9,0x0314,0x0301,0x03C9,0x0313,
+/* 0x06F0 */ 0x0342,0x03C9,0x0314,0x0342,0x03A9,0x0313,0x03A9,0x0314,
+/* 0x06F8 */ 0x03A9,0x0313,0x0300,0x03A9,0x0314,0x0300,0x03A9,0x0313,
+/* 0x0700 */ 0x0301,0x03A9,0x0314,0x0301,0x03A9,0x0313,0x0342,0x03A9,
+/* 0x0708 */ 0x0314,0x0342,0x03B1,0x0300,0x03B5,0x0300,0x03B7,0x0300,
+/* 0x0710 */ 0x03B9,0x0300,0x03BF,0x0300,0x03C5,0x0300,0x03C9,0x0300,
+/* 0x0718 */ 0x03B1,0x0313,0x0345,0x03B1,0x0313,0x03B9,0x03B1,0x0314,
+/* 0x0720 */ 0x0345,0x03B1,0x0314,0x03B9,0x03B1,0x0313,0x0300,0x0345,
+/* 0x0728 */ 0x03B1,0x0313,0x0300,0x03B9,0x03B1,0x0314,0x0300,0x0345,
+/* 0x0730 */ 0x03B1,0x0314,0x0300,0x03B9,0x03B1,0x0313,0x0301,0x0345,
+/* 0x0738 */ 0x03B1,0x0313,0x0301,0x03B9,0x03B1,0x0314,0x0301,0x0345,
+/* 0x0740 */ 0x03B1,0x0314,0x0301,0x03B9,0x03B1,0x0313,0x0342,0x0345,
+/* 0x0748 */ 0x03B1,0x0313,0x0342,0x03B9,0x03B1,0x0314,0x0342,0x0345,
+/* 0x0750 */ 0x03B1,0x0314,0x0342,0x03B9,0x0391,0x0313,0x0345,0x0391,
+/* 0x0758 */ 0x0314,0x0345,0x0391,0x0313,0x0300,0x0345,0x0391,0x0314,
+/* 0x0760 */ 0x0300,0x0345,0x0391,0x0313,0x0301,0x0345,0x0391,0x0314,
+/* 0x0768 */ 0x0301,0x0345,0x0391,0x0313,0x0342,0x0345,0x0391,0x0314,
+/* 0x0770 */ 0x0342,0x0345,0x03B7,0x0313,0x0345,0x03B7,0x0313,0x03B9,
+/* 0x0778 */ 0x03B7,0x0314,0x0345,0x03B7,0x0314,0x03B9,0x03B7,0x0313,
+/* 0x0780 */ 0x0300,0x0345,0x03B7,0x0313,0x0300,0x03B9,0x03B7,0x0314,
+/* 0x0788 */ 0x0300,0x0345,0x03B7,0x0314,0x0300,0x03B9,0x03B7,0x0313,
+/* 0x0790 */ 0x0301,0x0345,0x03B7,0x0313,0x0301,0x03B9,0x03B7,0x0314,
+/* 0x0798 */ 0x0301,0x0345,0x03B7,0x0314,0x0301,0x03B9,0x03B7,0x0313,
+/* 0x07A0 */ 0x0342,0x0345,0x03B7,0x0313,0x0342,0x03B9,0x03B7,0x0314,
+/* 0x07A8 */ 0x0342,0x0345,0x03B7,0x0314,0x0342,0x03B9,0x0397,0x0313,
+/* 0x07B0 */ 0x0345,0x0397,0x0314,0x0345,0x0397,0x0313,0x0300,0x0345,
+/* 0x07B8 */ 0x0397,0x0314,0x0300,0x0345,0x0397,0x0313,0x0301,0x0345,
+/* 0x07C0 */ 0x0397,0x0314,0x0301,0x0345,0x0397,0x0313,0x0342,0x0345,
+/* 0x07C8 */ 0x0397,0x0314,0x0342,0x0345,0x03C9,0x0313,0x0345,0x03C9,
+/* 0x07D0 */ 0x0313,0x03B9,0x03C9,0x0314,0x0345,0x03C9,0x0314,0x03B9,
+/* 0x07D8 */ 0x03C9,0x0313,0x0300,0x0345,0x03C9,0x0313,0x0300,0x03B9,
+/* 0x07E0 */ 0x03C9,0x0314,0x0300,0x0345,0x03C9,0x0314,0x0300,0x03B9,
+/* 0x07E8 */ 0x03C9,0x0313,0x0301,0x0345,0x03C9,0x0313,0x0301,0x03B9,
+/* 0x07F0 */ 0x03C9,0x0314,0x0301,0x0345,0x03C9,0x0314,0x0301,0x03B9,
+/* 0x07F8 */ 0x03C9,0x0313,0x0342,0x0345,0x03C9,0x0313,0x0342,0x03B9,
+/* 0x0800 */ 0x03C9,0x0314,0x0342,0x0345,0x03C9,0x0314,0x0342,0x03B9,
+/* 0x0808 */ 0x03A9,0x0313,0x0345,0x03A9,0x0314,0x0345,0x03A9,0x0313,
+/* 0x0810 */ 0x0300,0x0345,0x03A9,0x0314,0x0300,0x0345,0x03A9,0x0313,
+/* 0x0818 */ 0x0301,0x0345,0x03A9,0x0314,0x0301,0x0345,0x03A9,0x0313,
+/* 0x0820 */ 0x0342,0x0345,0x03A9,0x0314,0x0342,0x0345,0x03B1,0x0306,
+/* 0x0828 */ 0x03B1,0x0304,0x03B1,0x0300,0x0345,0x03B1,0x0300,0x03B9,
+/* 0x0830 */ 0x03B1,0x0345,0x03B1,0x03B9,0x03B1,0x0301,0x0345,0x03B1,
+/* 0x0838 */ 0x0301,0x03B9,0x03B1,0x0342,0x03B1,0x0342,0x0345,0x03B1,
+/* 0x0840 */ 0x0342,0x03B9,0x0391,0x0306,0x0391,0x0304,0x0391,0x0300,
+/* 0x0848 */ 0x0391,0x0345,0x0020,0x0313,0x0020,0x0342,0x00A8,0x0342,
+/* 0x0850 */ 0x0020,0x0308,0x0342,0x03B7,0x0300,0x0345,0x03B7,0x0300,
+/* 0x0858 */ 0x03B9,0x03B7,0x0345,0x03B7,0x03B9,0x03B7,0x0301,0x0345,
+/* 0x0860 */ 0x03B7,0x0301,0x03B9,0x03B7,0x0342,0x03B7,0x0342,0x0345,
+/* 0x0868 */ 0x03B7,0x0342,0x03B9,0x0395,0x0300,0x0397,0x0300,0x0397,
+/* 0x0870 */ 0x0345,0x1FBF,0x0300,0x0020,0x0313,0x0300,0x1FBF,0x0301,
+/* 0x0878 */ 0x0020,0x0313,0x0301,0x1FBF,0x0342,0x0020,0x0313,0x0342,
+/* 0x0880 */ 0x03B9,0x0306,0x03B9,0x0304,0x03B9,0x0308,0x0300,0x03B9,
+/* 0x0888 */ 0x0342,0x03B9,0x0308,0x0342,0x0399,0x0306,0x0399,0x0304,
+/* 0x0890 */ 0x0399,0x0300,0x1FFE,0x0300,0x0020,0x0314,0x0300,0x1FFE,
+/* 0x0898 */ 0x0301,0x0020,0x0314,0x0301,0x1FFE,0x0342,0x0020,0x0314,
+/* 0x08A0 */ 0x0342,0x03C5,0x0306,0x03C5,0x0304,0x03C5,0x0308,0x0300,
+/* 0x08A8 */ 0x03C1,0x0313,0x03C1,0x0314,0x03C5,0x0342,0x03C5,0x0308,
+/* 0x08B0 */ 0x0342,0x03A5,0x0306,0x03A5,0x0304,0x03A5,0x0300,0x03A1,
+/* 0x08B8 */ 0x0314,0x00A8,0x0300,0x0020,0x0308,0x0300,0x03C9,0x0300,
+/* 0x08C0 */ 0x0345,0x03C9,0x0300,0x03B9,0x03C9,0x0345,0x03C9,0x03B9,
+/* 0x08C8 */ 0x03C9,0x0301,0x0345,0x03C9,0x0301,0x03B9,0x03C9,0x0342,
+/* 0x08D0 */ 0x03C9,0x0342,0x0345,0x03C9,0x0342,0x03B9,0x039F,0x0300,
+/* 0x08D8 */ 0x03A9,0x0300,0x03A9,0x0345,0x0020,0x0314,0x0020,0x0333,
+/* 0x08E0 */ 0x002E,0x002E,0x002E,0x002E,0x002E,0x2032,0x2032,0x2032,
+/* 0x08E8 */ 0x2032,0x2032,0x2035,0x2035,0x2035,0x2035,0x2035,0x0021,
+/* 0x08F0 */ 0x0021,0x0020,0x0305,0x003F,0x003F,0x003F,0x0021,0x0021,
+/* 0x08F8 */ 0x003F,0x2032,0x2032,0x2032,0x2032,0x0052,0x0073,0x0072,
+/* 0x0900 */ 0x0073,0x0061,0x002F,0x0063,0x0061,0x002F,0x0073,0x00B0,
+/* 0x0908 */ 0x0043,0x00B0,0x0063,0x0063,0x002F,0x006F,0x0063,0x002F,
+/* 0x0910 */ 0x0075,0x00B0,0x0046,0x00B0,0x0066,0x004E,0x006F,0x006E,
+/* 0x0918 */ 0x006F,0x0053,0x004D,0x0073,0x006D,0x0054,0x0045,0x004C,
+/* 0x0920 */ 0x0074,0x0065,0x006C,0x0054,0x004D,0x0074,0x006D,0x0046,
+/* 0x0928 */ 0x0041,0x0058,0x0066,0x0061,0x0078,0x0031,0x2044,0x0037,
+/* 0x0930 */ 0x0031,0x2044,0x0039,0x0031,0x2044,0x0031,0x0030,0x0031,
+/* 0x0938 */ 0x2044,0x0033,0x0032,0x2044,0x0033,0x0031,0x2044,0x0035,
+/* 0x0940 */ 0x0032,0x2044,0x0035,0x0033,0x2044,0x0035,0x0034,0x2044,
+/* 0x0948 */ 0x0035,0x0031,0x2044,0x0036,0x0035,0x2044,0x0036,0x0031,
+/* 0x0950 */ 0x2044,0x0038,0x0033,0x2044,0x0038,0x0035,0x2044,0x0038,
+/* 0x0958 */ 0x0037,0x2044,0x0038,0x0031,0x2044,0x0049,0x0049,0x0069,
+/* 0x0960 */ 0x0069,0x0049,0x0049,0x0049,0x0069,0x0069,0x0069,0x0049,
+/* 0x0968 */ 0x0056,0x0069,0x0076,0x0056,0x0049,0x0076,0x0069,0x0056,
+/* 0x0970 */ 0x0049,0x0049,0x0076,0x0069,0x0069,0x0056,0x0049,0x0049,
+/* 0x0978 */ 0x0049,0x0076,0x0069,0x0069,0x0069,0x0049,0x0058,0x0069,
+/* 0x0980 */ 0x0078,0x0058,0x0049,0x0078,0x0069,0x0058,0x0049,0x0049,
+/* 0x0988 */ 0x0078,0x0069,0x0069,0x0030,0x2044,0x0033,0x2190,0x0338,
+/* 0x0990 */ 0x2192,0x0338,0x2194,0x0338,0x21D0,0x0338,0x21D4,0x0338,
+/* 0x0998 */ 0x21D2,0x0338,0x2203,0x0338,0x2208,0x0338,0x220B,0x0338,
+/* 0x09A0 */ 0x2223,0x0338,0x2225,0x0338,0x222B,0x222B,0x222B,0x222B,
+/* 0x09A8 */ 0x222B,0x222E,0x222E,0x222E,0x222E,0x222E,0x223C,0x0338,
+/* 0x09B0 */ 0x2243,0x0338,0x2245,0x0338,0x2248,0x0338,0x003D,0x0338,
+/* 0x09B8 */ 0x2261,0x0338,0x224D,0x0338,0x003C,0x0338,0x003E,0x0338,
+/* 0x09C0 */ 0x2264,0x0338,0x2265,0x0338,0x2272,0x0338,0x2273,0x0338,
+/* 0x09C8 */ 0x2276,0x0338,0x2277,0x0338,0x227A,0x0338,0x227B,0x0338,
+/* 0x09D0 */ 0x2282,0x0338,0x2283,0x0338,0x2286,0x0338,0x2287,0x0338,
+/* 0x09D8 */ 0x22A2,0x0338,0x22A8,0x0338,0x22A9,0x0338,0x22AB,0x0338,
+/* 0x09E0 */ 0x227C,0x0338,0x227D,0x0338,0x2291,0x0338,0x2292,0x0338,
+/* 0x09E8 */ 0x22B2,0x0338,0x22B3,0x0338,0x22B4,0x0338,0x22B5,0x0338,
+/* 0x09F0 */ 0x0031,0x0030,0x0031,0x0031,0x0031,0x0032,0x0031,0x0033,
+/* 0x09F8 */ 0x0031,0x0034,0x0031,0x0035,0x0031,0x0036,0x0031,0x0037,
+/* 0x0A00 */ 0x0031,0x0038,0x0031,0x0039,0x0032,0x0030,0x0028,0x0031,
+/* 0x0A08 */ 0x0029,0x0028,0x0032,0x0029,0x0028,0x0033,0x0029,0x0028,
+/* 0x0A10 */ 0x0034,0x0029,0x0028,0x0035,0x0029,0x0028,0x0036,0x0029,
+/* 0x0A18 */ 0x0028,0x0037,0x0029,0x0028,0x0038,0x0029,0x0028,0x0039,
+/* 0x0A20 */ 0x0029,0x0028,0x0031,0x0030,0x0029,0x0028,0x0031,0x0031,
+/* 0x0A28 */ 0x0029,0x0028,0x0031,0x0032,0x0029,0x0028,0x0031,0x0033,
+/* 0x0A30 */ 0x0029,0x0028,0x0031,0x0034,0x0029,0x0028,0x0031,0x0035,
+/* 0x0A38 */ 0x0029,0x0028,0x0031,0x0036,0x0029,0x0028,0x0031,0x0037,
+/* 0x0A40 */ 0x0029,0x0028,0x0031,0x0038,0x0029,0x0028,0x0031,0x0039,
+/* 0x0A48 */ 0x0029,0x0028,0x0032,0x0030,0x0029,0x0031,0x002E,0x0032,
+/* 0x0A50 */ 0x002E,0x0033,0x002E,0x0034,0x002E,0x0035,0x002E,0x0036,
+/* 0x0A58 */ 0x002E,0x0037,0x002E,0x0038,0x002E,0x0039,0x002E,0x0031,
+/* 0x0A60 */ 0x0030,0x002E,0x0031,0x0031,0x002E,0x0031,0x0032,0x002E,
+/* 0x0A68 */ 0x0031,0x0033,0x002E,0x0031,0x0034,0x002E,0x0031,0x0035,
+/* 0x0A70 */ 0x002E,0x0031,0x0036,0x002E,0x0031,0x0037,0x002E,0x0031,
+/* 0x0A78 */ 0x0038,0x002E,0x0031,0x0039,0x002E,0x0032,0x0030,0x002E,
+/* 0x0A80 */ 0x0028,0x0061,0x0029,0x0028,0x0062,0x0029,0x0028,0x0063,
+/* 0x0A88 */ 0x0029,0x0028,0x0064,0x0029,0x0028,0x0065,0x0029,0x0028,
+/* 0x0A90 */ 0x0066,0x0029,0x0028,0x0067,0x0029,0x0028,0x0068,0x0029,
+/* 0x0A98 */ 0x0028,0x0069,0x0029,0x0028,0x006A,0x0029,0x0028,0x006B,
+/* 0x0AA0 */ 0x0029,0x0028,0x006C,0x0029,0x0028,0x006D,0x0029,0x0028,
+/* 0x0AA8 */ 0x006E,0x0029,0x0028,0x006F,0x0029,0x0028,0x0070,0x0029,
+/* 0x0AB0 */ 0x0028,0x0071,0x0029,0x0028,0x0072,0x0029,0x0028,0x0073,
+/* 0x0AB8 */ 0x0029,0x0028,0x0074,0x0029,0x0028,0x0075,0x0029,0x0028,
+/* 0x0AC0 */ 0x0076,0x0029,0x0028,0x0077,0x0029,0x0028,0x0078,0x0029,
+/* 0x0AC8 */ 0x0028,0x0079,0x0029,0x0028,0x007A,0x0029,0x222B,0x222B,
+/* 0x0AD0 */ 0x222B,0x222B,0x003A,0x003A,0x003D,0x003D,0x003D,0x003D,
+/* 0x0AD8 */ 0x003D,0x003D,0x2ADD,0x0338,0x304B,0x3099,0x304D,0x3099,
+/* 0x0AE0 */ 0x304F,0x3099,0x3051,0x3099,0x3053,0x3099,0x3055,0x3099,
+/* 0x0AE8 */ 0x3057,0x3099,0x3059,0x3099,0x305B,0x3099,0x305D,0x3099,
+/* 0x0AF0 */ 0x305F,0x3099,0x3061,0x3099,0x3064,0x3099,0x3066,0x3099,
+/* 0x0AF8 */ 0x3068,0x3099,0x306F,0x3099,0x306F,0x309A,0x3072,0x3099,
+/* 0x0B00 */ 0x3072,0x309A,0x3075,0x3099,0x3075,0x309A,0x3078,0x3099,
+/* 0x0B08 */ 0x3078,0x309A,0x307B,0x3099,0x307B,0x309A,0x3046,0x3099,
+/* 0x0B10 */ 0x0020,0x3099,0x0020,0x309A,0x309D,0x3099,0x3088,0x308A,
+/* 0x0B18 */ 0x30AB,0x3099,0x30AD,0x3099,0x30AF,0x3099,0x30B1,0x3099,
+/* 0x0B20 */ 0x30B3,0x3099,0x30B5,0x3099,0x30B7,0x3099,0x30B9,0x3099,
+/* 0x0B28 */ 0x30BB,0x3099,0x30BD,0x3099,0x30BF,0x3099,0x30C1,0x3099,
+/* 0x0B30 */ 0x30C4,0x3099,0x30C6,0x3099,0x30C8,0x3099,0x30CF,0x3099,
+/* 0x0B38 */ 0x30CF,0x309A,0x30D2,0x3099,0x30D2,0x309A,0x30D5,0x3099,
+/* 0x0B40 */ 0x30D5,0x309A,0x30D8,0x3099,0x30D8,0x309A,0x30DB,0x3099,
+/* 0x0B48 */ 0x30DB,0x309A,0x30A6,0x3099,0x30EF,0x3099,0x30F0,0x3099,
+/* 0x0B50 */ 0x30F1,0x3099,0x30F2,0x3099,0x30FD,0x3099,0x30B3,0x30C8,
+/* 0x0B58 */ 0x0028,0x1100,0x0029,0x0028,0x1102,0x0029,0x0028,0x1103,
+/* 0x0B60 */ 0x0029,0x0028,0x1105,0x0029,0x0028,0x1106,0x0029,0x0028,
+/* 0x0B68 */ 0x1107,0x0029,0x0028,0x1109,0x0029,0x0028,0x110B,0x0029,
+/* 0x0B70 */ 0x0028,0x110C,0x0029,0x0028,0x110E,0x0029,0x0028,0x110F,
+/* 0x0B78 */ 0x0029,0x0028,0x1110,0x0029,0x0028,0x1111,0x0029,0x0028,
+/* 0x0B80 */ 0x1112,0x0029,0x0028,0x1100,0x1161,0x0029,0x0028,0x1102,
+/* 0x0B88 */ 0x1161,0x0029,0x0028,0x1103,0x1161,0x0029,0x0028,0x1105,
+/* 0x0B90 */ 0x1161,0x0029,0x0028,0x1106,0x1161,0x0029,0x0028,0x1107,
+/* 0x0B98 */ 0x1161,0x0029,0x0028,0x1109,0x1161,0x0029,0x0028,0x110B,
+/* 0x0BA0 */ 0x1161,0x0029,0x0028,0x110C,0x1161,0x0029,0x0028,0x110E,
+/* 0x0BA8 */ 0x1161,0x0029,0x0028,0x110F,0x1161,0x0029,0x0028,0x1110,
+/* 0x0BB0 */ 0x1161,0x0029,0x0028,0x1111,0x1161,0x0029,0x0028,0x1112,
+/* 0x0BB8 */ 0x1161,0x0029,0x0028,0x110C,0x116E,0x0029,0x0028,0x110B,
+/* 0x0BC0 */ 0x1169,0x110C,0x1165,0x11AB,0x0029,0x0028,0x110B,0x1169,
+/* 0x0BC8 */ 0x1112,0x116E,0x0029,0x0028,0x4E00,0x0029,0x0028,0x4E8C,
+/* 0x0BD0 */ 0x0029,0x0028,0x4E09,0x0029,0x0028,0x56DB,0x0029,0x0028,
+/* 0x0BD8 */ 0x4E94,0x0029,0x0028,0x516D,0x0029,0x0028,0x4E03,0x0029,
+/* 0x0BE0 */ 0x0028,0x516B,0x0029,0x0028,0x4E5D,0x0029,0x0028,0x5341,
+/* 0x0BE8 */ 0x0029,0x0028,0x6708,0x0029,0x0028,0x706B,0x0029,0x0028,
+/* 0x0BF0 */ 0x6C34,0x0029,0x0028,0x6728,0x0029,0x0028,0x91D1,0x0029,
+/* 0x0BF8 */ 0x0028,0x571F,0x0029,0x0028,0x65E5,0x0029,0x0028,0x682A,
+/* 0x0C00 */ 0x0029,0x0028,0x6709,0x0029,0x0028,0x793E,0x0029,0x0028,
+/* 0x0C08 */ 0x540D,0x0029,0x0028,0x7279,0x0029,0x0028,0x8CA1,0x0029,
+/* 0x0C10 */ 0x0028,0x795D,0x0029,0x0028,0x52B4,0x0029,0x0028,0x4EE3,
+/* 0x0C18 */ 0x0029,0x0028,0x547C,0x0029,0x0028,0x5B66,0x0029,0x0028,
+/* 0x0C20 */ 0x76E3,0x0029,0x0028,0x4F01,0x0029,0x0028,0x8CC7,0x0029,
+/* 0x0C28 */ 0x0028,0x5354,0x0029,0x0028,0x796D,0x0029,0x0028,0x4F11,
+/* 0x0C30 */ 0x0029,0x0028,0x81EA,0x0029,0x0028,0x81F3,0x0029,0x0050,
+/* 0x0C38 */ 0x0054,0x0045,0x0070,0x0074,0x0065,0x0032,0x0031,0x0032,
+/* 0x0C40 */ 0x0032,0x0032,0x0033,0x0032,0x0034,0x0032,0x0035,0x0032,
+/* 0x0C48 */ 0x0036,0x0032,0x0037,0x0032,0x0038,0x0032,0x0039,0x0033,
+/* 0x0C50 */ 0x0030,0x0033,0x0031,0x0033,0x0032,0x0033,0x0033,0x0033,
+/* 0x0C58 */ 0x0034,0x0033,0x0035,0x1100,0x1161,0x1102,0x1161,0x1103,
+/* 0x0C60 */ 0x1161,0x1105,0x1161,0x1106,0x1161,0x1107,0x1161,0x1109,
+/* 0x0C68 */ 0x1161,0x110B,0x1161,0x110C,0x1161,0x110E,0x1161,0x110F,
+/* 0x0C70 */ 0x1161,0x1110,0x1161,0x1111,0x1161,0x1112,0x1161,0x110E,
+/* 0x0C78 */ 0x1161,0x11B7,0x1100,0x1169,0x110C,0x116E,0x110B,0x1174,
+/* 0x0C80 */ 0x110B,0x116E,0x0033,0x0036,0x0033,0x0037,0x0033,0x0038,
+/* 0x0C88 */ 0x0033,0x0039,0x0034,0x0030,0x0034,0x0031,0x0034,0x0032,
+/* 0x0C90 */ 0x0034,0x0033,0x0034,0x0034,0x0034,0x0035,0x0034,0x0036,
+/* 0x0C98 */ 0x0034,0x0037,0x0034,0x0038,0x0034,0x0039,0x0035,0x0030,
+/* 0x0CA0 */ 0x0031,0x6708,0x0032,0x6708,0x0033,0x6708,0x0034,0x6708,
+/* 0x0CA8 */ 0x0035,0x6708,0x0036,0x6708,0x0037,0x6708,0x0038,0x6708,
+/* 0x0CB0 */ 0x0039,0x6708,0x0031,0x0030,0x6708,0x0031,0x0031,0x6708,
+/* 0x0CB8 */ 0x0031,0x0032,0x6708,0x0048,0x0067,0x0068,0x0067,0x0065,
+/* 0x0CC0 */ 0x0072,0x0067,0x0065,0x0056,0x0065,0x0076,0x004C,0x0054,
+/* 0x0CC8 */ 0x0044,0x006C,0x0074,0x0064,0x4EE4,0x548C,0x30A2,0x30CF,
+/* 0x0CD0 */ 0x309A,0x30FC,0x30C8,0x30A2,0x30EB,0x30D5,0x30A1,0x30A2,
+/* 0x0CD8 */ 0x30F3,0x30D8,0x309A,0x30A2,0x30A2,0x30FC,0x30EB,0x30A4,
+/* 0x0CE0 */ 0x30CB,0x30F3,0x30AF,0x3099,0x30A4,0x30F3,0x30C1,0x30A6,
+/* 0x0CE8 */ 0x30A9,0x30F3,0x30A8,0x30B9,0x30AF,0x30FC,0x30C8,0x3099,
+/* 0x0CF0 */ 0x30A8,0x30FC,0x30AB,0x30FC,0x30AA,0x30F3,0x30B9,0x30AA,
+/* 0x0CF8 */ 0x30FC,0x30E0,0x30AB,0x30A4,0x30EA,0x30AB,0x30E9,0x30C3,
+/* 0x0D00 */ 0x30C8,0x30AB,0x30ED,0x30EA,0x30FC,0x30AB,0x3099,0x30ED,
+/* 0x0D08 */ 0x30F3,0x30AB,0x3099,0x30F3,0x30DE,0x30AD,0x3099,0x30AB,
+/* 0x0D10 */ 0x3099,0x30AD,0x3099,0x30CB,0x30FC,0x30AD,0x30E5,0x30EA,
+/* 0x0D18 */ 0x30FC,0x30AD,0x3099,0x30EB,0x30BF,0x3099,0x30FC,0x30AD,
+/* 0x0D20 */ 0x30ED,0x30AD,0x30ED,0x30AF,0x3099,0x30E9,0x30E0,0x30AD,
+/* 0x0D28 */ 0x30ED,0x30E1,0x30FC,0x30C8,0x30EB,0x30AD,0x30ED,0x30EF,
+/* 0x0D30 */ 0x30C3,0x30C8,0x30AF,0x3099,0x30E9,0x30E0,0x30AF,0x3099,
+/* 0x0D38 */ 0x30E9,0x30E0,0x30C8,0x30F3,0x30AF,0x30EB,0x30BB,0x3099,
+/* 0x0D40 */ 0x30A4,0x30ED,0x30AF,0x30ED,0x30FC,0x30CD,0x30B1,0x30FC,
+/* 0x0D48 */ 0x30B9,0x30B3,0x30EB,0x30CA,0x30B3,0x30FC,0x30DB,0x309A,
+/* 0x0D50 */ 0x30B5,0x30A4,0x30AF,0x30EB,0x30B5,0x30F3,0x30C1,0x30FC,
+/* 0x0D58 */ 0x30E0,0x30B7,0x30EA,0x30F3,0x30AF,0x3099,0x30BB,0x30F3,
+/* 0x0D60 */ 0x30C1,0x30BB,0x30F3,0x30C8,0x30BF,0x3099,0x30FC,0x30B9,
+/* 0x0D68 */ 0x30C6,0x3099,0x30B7,0x30C8,0x3099,0x30EB,0x30C8,0x30F3,
+/* 0x0D70 */ 0x30CA,0x30CE,0x30CE,0x30C3,0x30C8,0x30CF,0x30A4,0x30C4,
+/* 0x0D78 */ 0x30CF,0x309A,0x30FC,0x30BB,0x30F3,0x30C8,0x30CF,0x309A,
+/* 0x0D80 */ 0x30FC,0x30C4,0x30CF,0x3099,0x30FC,0x30EC,0x30EB,0x30D2,
+/* 0x0D88 */ 0x309A,0x30A2,0x30B9,0x30C8,0x30EB,0x30D2,0x309A,0x30AF,
+/* 0x0D90 */ 0x30EB,0x30D2,0x309A,0x30B3,0x30D2,0x3099,0x30EB,0x30D5,
+/* 0x0D98 */ 0x30A1,0x30E9,0x30C3,0x30C8,0x3099,0x30D5,0x30A3,0x30FC,
+/* 0x0DA0 */ 0x30C8,0x30D5,0x3099,0x30C3,0x30B7,0x30A7,0x30EB,0x30D5,
+/* 0x0DA8 */ 0x30E9,0x30F3,0x30D8,0x30AF,0x30BF,0x30FC,0x30EB,0x30D8,
+/* 0x0DB0 */ 0x309A,0x30BD,0x30D8,0x309A,0x30CB,0x30D2,0x30D8,0x30EB,
+/* 0x0DB8 */ 0x30C4,0x30D8,0x309A,0x30F3,0x30B9,0x30D8,0x309A,0x30FC,
+/* 0x0DC0 */ 0x30B7,0x3099,0x30D8,0x3099,0x30FC,0x30BF,0x30DB,0x309A,
+/* 0x0DC8 */ 0x30A4,0x30F3,0x30C8,0x30DB,0x3099,0x30EB,0x30C8,0x30DB,
+/* 0x0DD0 */ 0x30F3,0x30DB,0x309A,0x30F3,0x30C8,0x3099,0x30DB,0x30FC,
+/* 0x0DD8 */ 0x30EB,0x30DB,0x30FC,0x30F3,0x30DE,0x30A4,0x30AF,0x30ED,
+/* 0x0DE0 */ 0x30DE,0x30A4,0x30EB,0x30DE,0x30C3,0x30CF,0x30DE,0x30EB,
+/* 0x0DE8 */ 0x30AF,0x30DE,0x30F3,0x30B7,0x30E7,0x30F3,0x30DF,0x30AF,
+/* 0x0DF0 */ 0x30ED,0x30F3,0x30DF,0x30EA,0x30DF,0x30EA,0x30CF,0x3099,
+/* 0x0DF8 */ 0x30FC,0x30EB,0x30E1,0x30AB,0x3099,0x30E1,0x30AB,0x3099,
+/* 0x0E00 */ 0x30C8,0x30F3,0x30E1,0x30FC,0x30C8,0x30EB,0x30E4,0x30FC,
+/* 0x0E08 */ 0x30C8,0x3099,0x30E4,0x30FC,0x30EB,0x30E6,0x30A2,0x30F3,
+/* 0x0E10 */ 0x30EA,0x30C3,0x30C8,0x30EB,0x30EA,0x30E9,0x30EB,0x30D2,
+/* 0x0E18 */ 0x309A,0x30FC,0x30EB,0x30FC,0x30D5,0x3099,0x30EB,0x30EC,
+/* 0x0E20 */ 0x30E0,0x30EC,0x30F3,0x30C8,0x30B1,0x3099,0x30F3,0x30EF,
+/* 0x0E28 */ 0x30C3,0x30C8,0x0030,0x70B9,0x0031,0x70B9,0x0032,0x70B9,
+/* 0x0E30 */ 0x0033,0x70B9,0x0034,0x70B9,0x0035,0x70B9,0x0036,0x70B9,
+/* 0x0E38 */ 0x0037,0x70B9,0x0038,0x70B9,0x0039,0x70B9,0x0031,0x0030,
+/* 0x0E40 */ 0x70B9,0x0031,0x0031,0x70B9,0x0031,0x0032,0x70B9,0x0031,
+/* 0x0E48 */ 0x0033,0x70B9,0x0031,0x0034,0x70B9,0x0031,0x0035,0x70B9,
+/* 0x0E50 */ 0x0031,0x0036,0x70B9,0x0031,0x0037,0x70B9,0x0031,0x0038,
+/* 0x0E58 */ 0x70B9,0x0031,0x0039,0x70B9,0x0032,0x0030,0x70B9,0x0032,
+/* 0x0E60 */ 0x0031,0x70B9,0x0032,0x0032,0x70B9,0x0032,0x0033,0x70B9,
+/* 0x0E68 */ 0x0032,0x0034,0x70B9,0x0068,0x0050,0x0061,0x0068,0x0070,
+/* 0x0E70 */ 0x0061,0x0064,0x0061,0x0041,0x0055,0x0061,0x0075,0x0062,
+/* 0x0E78 */ 0x0061,0x0072,0x006F,0x0056,0x006F,0x0076,0x0070,0x0063,
+/* 0x0E80 */ 0x0064,0x006D,0x0064,0x006D,0x0032,0x0064,0x006D,0x0033,
+/* 0x0E88 */ 0x0049,0x0055,0x0069,0x0075,0x5E73,0x6210,0x662D,0x548C,
+/* 0x0E90 */ 0x5927,0x6B63,0x660E,0x6CBB,0x682A,0x5F0F,0x4F1A,0x793E,
+/* 0x0E98 */ 0x0070,0x0041,0x0070,0x0061,0x006E,0x0041,0x006E,0x0061,
+/* 0x0EA0 */ 0x03BC,0x0041,0x03BC,0x0061,0x006D,0x0041,0x006D,0x0061,
+/* 0x0EA8 */ 0x006B,0x0041,0x006B,0x0061,0x004B,0x0042,0x006B,0x0062,
+/* 0x0EB0 */ 0x004D,0x0042,0x006D,0x0062,0x0047,0x0042,0x0067,0x0062,
+/* 0x0EB8 */ 0x0063,0x0061,0x006C,0x006B,0x0063,0x0061,0x006C,0x0070,
+/* 0x0EC0 */ 0x0046,0x0070,0x0066,0x006E,0x0046,0x006E,0x0066,0x03BC,
+/* 0x0EC8 */ 0x0046,0x03BC,0x0066,0x03BC,0x0067,0x006D,0x0067,0x006B,
+/* 0x0ED0 */ 0x0067,0x0048,0x007A,0x0068,0x007A,0x006B,0x0048,0x007A,
+/* 0x0ED8 */ 0x006B,0x0068,0x007A,0x004D,0x0048,0x007A,0x006D,0x0068,
+/* 0x0EE0 */ 0x007A,0x0047,0x0048,0x007A,0x0067,0x0068,0x007A,0x0054,
+/* 0x0EE8 */ 0x0048,0x007A,0x0074,0x0068,0x007A,0x03BC,0x006C,0x006D,
+/* 0x0EF0 */ 0x006C,0x0064,0x006C,0x006B,0x006C,0x0066,0x006D,0x006E,
+/* 0x0EF8 */ 0x006D,0x03BC,0x006D,0x006D,0x006D,0x0063,0x006D,0x006B,
+/* 0x0F00 */ 0x006D,0x006D,0x006D,0x0032,0x0063,0x006D,0x0032,0x006D,
+/* 0x0F08 */ 0x0032,0x006B,0x006D,0x0032,0x006D,0x006D,0x0033,0x0063,
+/* 0x0F10 */ 0x006D,0x0033,0x006D,0x0033,0x006B,0x006D,0x0033,0x006D,
+/* 0x0F18 */ 0x2215,0x0073,0x006D,0x2215,0x0073,0x0032,0x0050,0x0061,
+/* 0x0F20 */ 0x006B,0x0050,0x0061,0x006B,0x0070,0x0061,0x004D,0x0050,
+/* 0x0F28 */ 0x0061,0x006D,0x0070,0x0061,0x0047,0x0050,0x0061,0x0067,
+/* 0x0F30 */ 0x0070,0x0061,0x0072,0x0061,0x0064,0x0072,0x0061,0x0064,
+/* 0x0F38 */ 0x2215,0x0073,0x0072,0x0061,0x0064,0x2215,0x0073,0x0032,
+/* 0x0F40 */ 0x0070,0x0073,0x006E,0x0073,0x03BC,0x0073,0x006D,0x0073,
+/* 0x0F48 */ 0x0070,0x0056,0x0070,0x0076,0x006E,0x0056,0x006E,0x0076,
+/* 0x0F50 */ 0x03BC,0x0056,0x03BC,0x0076,0x006D,0x0056,0x006D,0x0076,
+/* 0x0F58 */ 0x006B,0x0056,0x006B,0x0076,0x004D,0x0056,0x0070,0x0057,
+/* 0x0F60 */ 0x0070,0x0077,0x006E,0x0057,0x006E,0x0077,0x03BC,0x0057,
+/* 0x0F68 */ 0x03BC,0x0077,0x006D,0x0057,0x006D,0x0077,0x006B,0x0057,
+/* 0x0F70 */ 0x006B,0x0077,0x004D,0x0057,0x006B,0x03A9,0x006B,0x03C9,
+/* 0x0F78 */ 0x004D,0x03A9,0x006D,0x03C9,0x0061,0x002E,0x006D,0x002E,
+/* 0x0F80 */ 0x0042,0x0071,0x0062,0x0071,0x0063,0x0063,0x0063,0x0064,
+/* 0x0F88 */ 0x0043,0x2215,0x006B,0x0067,0x0063,0x2215,0x006B,0x0067,
+/* 0x0F90 */ 0x0043,0x006F,0x002E,0x0063,0x006F,0x002E,0x0064,0x0042,
+/* 0x0F98 */ 0x0064,0x0062,0x0047,0x0079,0x0067,0x0079,0x0068,0x0061,
+/* 0x0FA0 */ 0x0048,0x0050,0x0068,0x0070,0x0069,0x006E,0x004B,0x004B,
+/* 0x0FA8 */ 0x006B,0x006B,0x004B,0x004D,0x006B,0x0074,0x006C,0x006D,
+/* 0x0FB0 */ 0x006C,0x006E,0x006C,0x006F,0x0067,0x006C,0x0078,0x006D,
+/* 0x0FB8 */ 0x0069,0x006C,0x006D,0x006F,0x006C,0x0050,0x0048,0x0070,
+/* 0x0FC0 */ 0x0068,0x0070,0x002E,0x006D,0x002E,0x0050,0x0050,0x004D,
+/* 0x0FC8 */ 0x0070,0x0070,0x006D,0x0050,0x0052,0x0070,0x0072,0x0073,
+/* 0x0FD0 */ 0x0072,0x0053,0x0076,0x0073,0x0076,0x0057,0x0062,0x0077,
+/* 0x0FD8 */ 0x0062,0x0056,0x2215,0x006D,0x0076,0x2215,0x006D,0x0041,
+/* 0x0FE0 */ 0x2215,0x006D,0x0061,0x2215,0x006D,0x0031,0x65E5,0x0032,
+/* 0x0FE8 */ 0x65E5,0x0033,0x65E5,0x0034,0x65E5,0x0035,0x65E5,0x0036,
+/* 0x0FF0 */ 0x65E5,0x0037,0x65E5,0x0038,0x65E5,0x0039,0x65E5,0x0031,
+/* 0x0FF8 */ 0x0030,0x65E5,0x0031,0x0031,0x65E5,0x0031,0x0032,0x65E5,
+/* 0x1000 */ 0x0031,0x0033,0x65E5,0x0031,0x0034,0x65E5,0x0031,0x0035,
+/* 0x1008 */ 0x65E5,0x0031,0x0036,0x65E5,0x0031,0x0037,0x65E5,0x0031,
+/* 0x1010 */ 0x0038,0x65E5,0x0031,0x0039,0x65E5,0x0032,0x0030,0x65E5,
+/* 0x1018 */ 0x0032,0x0031,0x65E5,0x0032,0x0032,0x65E5,0x0032,0x0033,
+/* 0x1020 */ 0x65E5,0x0032,0x0034,0x65E5,0x0032,0x0035,0x65E5,0x0032,
+/* 0x1028 */ 0x0036,0x65E5,0x0032,0x0037,0x65E5,0x0032,0x0038,0x65E5,
+/* 0x1030 */ 0x0032,0x0039,0x65E5,0x0033,0x0030,0x65E5,0x0033,0x0031,
+/* 0x1038 */ 0x65E5,0x0067,0x0061,0x006C,0x0066,0x0066,0x0066,0x0069,
+/* 0x1040 */ 0x0066,0x006C,0x0066,0x0066,0x0069,0x0066,0x0066,0x006C,
+/* 0x1048 */ 0x0073,0x0074,0x0574,0x0576,0x0574,0x0565,0x0574,0x056B,
+/* 0x1050 */ 0x057E,0x0576,0x0574,0x056D,0x05D9,0x05B4,0x05F2,0x05B7,
+/* 0x1058 */ 0x05E9,0x05C1,0x05E9,0x05C2,0x05E9,0x05BC,0x05C1,0x05E9,
+/* 0x1060 */ 0x05BC,0x05C2,0x05D0,0x05B7,0x05D0,0x05B8,0x05D0,0x05BC,
+/* 0x1068 */ 0x05D1,0x05BC,0x05D2,0x05BC,0x05D3,0x05BC,0x05D4,0x05BC,
+/* 0x1070 */ 0x05D5,0x05BC,0x05D6,0x05BC,0x05D8,0x05BC,0x05D9,0x05BC,
+/* 0x1078 */ 0x05DA,0x05BC,0x05DB,0x05BC,0x05DC,0x05BC,0x05DE,0x05BC,
+/* 0x1080 */ 0x05E0,0x05BC,0x05E1,0x05BC,0x05E3,0x05BC,0x05E4,0x05BC,
+/* 0x1088 */ 0x05E6,0x05BC,0x05E7,0x05BC,0x05E8,0x05BC,0x05E9,0x05BC,
+/* 0x1090 */ 0x05EA,0x05BC,0x05D5,0x05B9,0x05D1,0x05BF,0x05DB,0x05BF,
+/* 0x1098 */ 0x05E4,0x05BF,0x05D0,0x05DC,0x064A,0x0654,0x0627,0x064A,
+/* 0x10A0 */ 0x0654,0x06D5,0x064A,0x0654,0x0648,0x064A,0x0654,0x06C7,
+/* 0x10A8 */ 0x064A,0x0654,0x06C6,0x064A,0x0654,0x06C8,0x064A,0x0654,
+/* 0x10B0 */ 0x06D0,0x064A,0x0654,0x0649,0x064A,0x0654,0x062C,0x064A,
+/* 0x10B8 */ 0x0654,0x062D,0x064A,0x0654,0x0645,0x064A,0x0654,0x064A,
+/* 0x10C0 */ 0x0628,0x062C,0x0628,0x062D,0x0628,0x062E,0x0628,0x0645,
+/* 0x10C8 */ 0x0628,0x0649,0x0628,0x064A,0x062A,0x062C,0x062A,0x062D,
+/* 0x10D0 */ 0x062A,0x062E,0x062A,0x0645,0x062A,0x0649,0x062A,0x064A,
+/* 0x10D8 */ 0x062B,0x062C,0x062B,0x0645,0x062B,0x0649,0x062B,0x064A,
+/* 0x10E0 */ 0x062C,0x062D,0x062C,0x0645,0x062D,0x062C,0x062D,0x0645,
+/* 0x10E8 */ 0x062E,0x062C,0x062E,0x062D,0x062E,0x0645,0x0633,0x062C,
+/* 0x10F0 */ 0x0633,0x062D,0x0633,0x062E,0x0633,0x0645,0x0635,0x062D,
+/* 0x10F8 */ 0x0635,0x0645,0x0636,0x062C,0x0636,0x062D,0x0636,0x062E,
+/* 0x1100 */ 0x0636,0x0645,0x0637,0x062D,0x0637,0x0645,0x0638,0x0645,
+/* 0x1108 */ 0x0639,0x062C,0x0639,0x0645,0x063A,0x062C,0x063A,0x0645,
+/* 0x1110 */ 0x0641,0x062C,0x0641,0x062D,0x0641,0x062E,0x0641,0x0645,
+/* 0x1118 */ 0x0641,0x0649,0x0641,0x064A,0x0642,0x062D,0x0642,0x0645,
+/* 0x1120 */ 0x0642,0x0649,0x0642,0x064A,0x0643,0x0627,0x0643,0x062C,
+/* 0x1128 */ 0x0643,0x062D,0x0643,0x062E,0x0643,0x0644,0x0643,0x0645,
+/* 0x1130 */ 0x0643,0x0649,0x0643,0x064A,0x0644,0x062C,0x0644,0x062D,
+/* 0x1138 */ 0x0644,0x062E,0x0644,0x0645,0x0644,0x0649,0x0644,0x064A,
+/* 0x1140 */ 0x0645,0x062C,0x0645,0x062D,0x0645,0x062E,0x0645,0x0645,
+/* 0x1148 */ 0x0645,0x0649,0x0645,0x064A,0x0646,0x062C,0x0646,0x062D,
+/* 0x1150 */ 0x0646,0x062E,0x0646,0x0645,0x0646,0x0649,0x0646,0x064A,
+/* 0x1158 */ 0x0647,0x062C,0x0647,0x0645,0x0647,0x0649,0x0647,0x064A,
+/* 0x1160 */ 0x064A,0x062C,0x064A,0x062D,0x064A,0x062E,0x064A,0x0645,
+/* 0x1168 */ 0x064A,0x0649,0x064A,0x064A,0x0630,0x0670,0x0631,0x0670,
+/* 0x1170 */ 0x0649,0x0670,0x0020,0x064C,0x0651,0x0020,0x064D,0x0651,
+/* 0x1178 */ 0x0020,0x064E,0x0651,0x0020,0x064F,0x0651,0x0020,0x0650,
+/* 0x1180 */ 0x0651,0x0020,0x0651,0x0670,0x064A,0x0654,0x0631,0x064A,
+/* 0x1188 */ 0x0654,0x0632,0x064A,0x0654,0x0646,0x0628,0x0631,0x0628,
+/* 0x1190 */ 0x0632,0x0628,0x0646,0x062A,0x0631,0x062A,0x0632,0x062A,
+/* 0x1198 */ 0x0646,0x062B,0x0631,0x062B,0x0632,0x062B,0x0646,0x0645,
+/* 0x11A0 */ 0x0627,0x0646,0x0631,0x0646,0x0632,0x0646,0x0646,0x064A,
+/* 0x11A8 */ 0x0631,0x064A,0x0632,0x064A,0x0646,0x064A,0x0654,0x062E,
+/* 0x11B0 */ 0x064A,0x0654,0x0647,0x0628,0x0647,0x062A,0x0647,0x0635,
+/* 0x11B8 */ 0x062E,0x0644,0x0647,0x0646,0x0647,0x0647,0x0670,0x064A,
+/* 0x11C0 */ 0x0647,0x062B,0x0647,0x0633,0x0647,0x0634,0x0645,0x0634,
+/* 0x11C8 */ 0x0647,0x0640,0x064E,0x0651,0x0640,0x064F,0x0651,0x0640,
+/* 0x11D0 */ 0x0650,0x0651,0x0637,0x0649,0x0637,0x064A,0x0639,0x0649,
+/* 0x11D8 */ 0x0639,0x064A,0x063A,0x0649,0x063A,0x064A,0x0633,0x0649,
+/* 0x11E0 */ 0x0633,0x064A,0x0634,0x0649,0x0634,0x064A,0x062D,0x0649,
+/* 0x11E8 */ 0x062D,0x064A,0x062C,0x0649,0x062C,0x064A,0x062E,0x0649,
+/* 0x11F0 */ 0x062E,0x064A,0x0635,0x0649,0x0635,0x064A,0x0636,0x0649,
+/* 0x11F8 */ 0x0636,0x064A,0x0634,0x062C,0x0634,0x062D,0x0634,0x062E,
+/* 0x1200 */ 0x0634,0x0631,0x0633,0x0631,0x0635,0x0631,0x0636,0x0631,
+/* 0x1208 */ 0x0627,0x064B,0x062A,0x062C,0x0645,0x062A,0x062D,0x062C,
+/* 0x1210 */ 0x062A,0x062D,0x0645,0x062A,0x062E,0x0645,0x062A,0x0645,
+/* 0x1218 */ 0x062C,0x062A,0x0645,0x062D,0x062A,0x0645,0x062E,0x062C,
+/* 0x1220 */ 0x0645,0x062D,0x062D,0x0645,0x064A,0x062D,0x0645,0x0649,
+/* 0x1228 */ 0x0633,0x062D,0x062C,0x0633,0x062C,0x062D,0x0633,0x062C,
+/* 0x1230 */ 0x0649,0x0633,0x0645,0x062D,0x0633,0x0645,0x062C,0x0633,
+/* 0x1238 */ 0x0645,0x0645,0x0635,0x062D,0x062D,0x0635,0x0645,0x0645,
+/* 0x1240 */ 0x0634,0x062D,0x0645,0x0634,0x062C,0x064A,0x0634,0x0645,
+/* 0x1248 */ 0x062E,0x0634,0x0645,0x0645,0x0636,0x062D,0x0649,0x0636,
+/* 0x1250 */ 0x062E,0x0645,0x0637,0x0645,0x062D,0x0637,0x0645,0x0645,
+/* 0x1258 */ 0x0637,0x0645,0x064A,0x0639,0x062C,0x0645,0x0639,0x0645,
+/* 0x1260 */ 0x0645,0x0639,0x0645,0x0649,0x063A,0x0645,0x0645,0x063A,
+/* 0x1268 */ 0x0645,0x064A,0x063A,0x0645,0x0649,0x0641,0x062E,0x0645,
+/* 0x1270 */ 0x0642,0x0645,0x062D,0x0642,0x0645,0x0645,0x0644,0x062D,
+/* 0x1278 */ 0x0645,0x0644,0x062D,0x064A,0x0644,0x062D,0x0649,0x0644,
+/* 0x1280 */ 0x062C,0x062C,0x0644,0x062E,0x0645,0x0644,0x0645,0x062D,
+/* 0x1288 */ 0x0645,0x062D,0x062C,0x0645,0x062D,0x0645,0x0645,0x062D,
+/* 0x1290 */ 0x064A,0x0645,0x062C,0x062D,0x0645,0x062C,0x0645,0x0645,
+/* 0x1298 */ 0x062E,0x062C,0x0645,0x062E,0x0645,0x0645,0x062C,0x062E,
+/* 0x12A0 */ 0x0647,0x0645,0x062C,0x0647,0x0645,0x0645,0x0646,0x062D,
+/* 0x12A8 */ 0x0645,0x0646,0x062D,0x0649,0x0646,0x062C,0x0645,0x0646,
+/* 0x12B0 */ 0x062C,0x0649,0x0646,0x0645,0x064A,0x0646,0x0645,0x0649,
+/* 0x12B8 */ 0x064A,0x0645,0x0645,0x0628,0x062E,0x064A,0x062A,0x062C,
+/* 0x12C0 */ 0x064A,0x062A,0x062C,0x0649,0x062A,0x062E,0x064A,0x062A,
+/* 0x12C8 */ 0x062E,0x0649,0x062A,0x0645,0x064A,0x062A,0x0645,0x0649,
+/* 0x12D0 */ 0x062C,0x0645,0x064A,0x062C,0x062D,0x0649,0x062C,0x0645,
+/* 0x12D8 */ 0x0649,0x0633,0x062E,0x0649,0x0635,0x062D,0x064A,0x0634,
+/* 0x12E0 */ 0x062D,0x064A,0x0636,0x062D,0x064A,0x0644,0x062C,0x064A,
+/* 0x12E8 */ 0x0644,0x0645,0x064A,0x064A,0x062D,0x064A,0x064A,0x062C,
+/* 0x12F0 */ 0x064A,0x064A,0x0645,0x064A,0x0645,0x0645,0x064A,0x0642,
+/* 0x12F8 */ 0x0645,0x064A,0x0646,0x062D,0x064A,0x0639,0x0645,0x064A,
+/* 0x1300 */ 0x0643,0x0645,0x064A,0x0646,0x062C,0x062D,0x0645,0x062E,
+/* 0x1308 */ 0x064A,0x0644,0x062C,0x0645,0x0643,0x0645,0x0645,0x062C,
+/* 0x1310 */ 0x062D,0x064A,0x062D,0x062C,0x064A,0x0645,0x062C,0x064A,
+/* 0x1318 */ 0x0641,0x0645,0x064A,0x0628,0x062D,0x064A,0x0633,0x062E,
+/* 0x1320 */ 0x064A,0x0646,0x062C,0x064A,0x0635,0x0644,0x06D2,0x0642,
+/* 0x1328 */ 0x0644,0x06D2,0x0627,0x0644,0x0644,0x0647,0x0627,0x0643,
+/* 0x1330 */ 0x0628,0x0631,0x0645,0x062D,0x0645,0x062F,0x0635,0x0644,
+/* 0x1338 */ 0x0639,0x0645,0x0631,0x0633,0x0648,0x0644,0x0639,0x0644,
+/* 0x1340 */ 0x064A,0x0647,0x0648,0x0633,0x0644,0x0645,0x0635,0x0644,
+/* 0x1348 */ 0x0649,0x0635,0x0644,0x0649,0x0020,0x0627,0x0644,0x0644,
+/* 0x1350 */ 0x0647,0x0020,0x0639,0x0644,0x064A,0x0647,0x0020,0x0648,
+/* 0x1358 */ 0x0633,0x0644,0x0645,0x062C,0x0644,0x0020,0x062C,0x0644,
+/* 0x1360 */ 0x0627,0x0644,0x0647,0x0631,0x06CC,0x0627,0x0644,0x0020,
+/* 0x1368 */ 0x064B,0x0640,0x064B,0x0020,0x064C,0x0020,0x064D,0x0020,
+/* 0x1370 */ 0x064E,0x0640,0x064E,0x0020,0x064F,0x0640,0x064F,0x0020,
+/* 0x1378 */ 0x0650,0x0640,0x0650,0x0020,0x0651,0x0640,0x0651,0x0020,
+/* 0x1380 */ 0x0652,0x0640,0x0652,0x0644,0x0627,0x0653,0x0644,0x0627,
+/* 0x1388 */ 0x0654,0x0644,0x0627,0x0655,0x0644,0x0627,0x11099,0x110BA,
+/* 0x1390 */ 0x1109B,0x110BA,0x110A5,0x110BA,0x11131,0x11127,0x11132,0x11127,
+/* 0x1398 */ 0x11347,0x1133E,0x11347,0x11357,0x114B9,0x114BA,0x114B9,0x114B0,
+/* 0x13A0 */ 0x114B9,0x114BD,0x115B8,0x115AF,0x115B9,0x115AF,0x11935,0x11930,
+/* 0x13A8 */ 0x1D157,0x1D165,0x1D158,0x1D165,0x1D158,0x1D165,0x1D16E,0x1D158,
+/* 0x13B0 */ 0x1D165,0x1D16F,0x1D158,0x1D165,0x1D170,0x1D158,0x1D165,0x1D171,
+/* 0x13B8 */ 0x1D158,0x1D165,0x1D172,0x1D1B9,0x1D165,0x1D1BA,0x1D165,0x1D1B9,
+/* 0x13C0 */ 0x1D165,0x1D16E,0x1D1BA,0x1D165,0x1D16E,0x1D1B9,0x1D165,0x1D16F,
+/* 0x13C8 */ 0x1D1BA,0x1D165,0x1D16F,0x0030,0x002E,0x0030,0x002C,0x0031,
+/* 0x13D0 */ 0x002C,0x0032,0x002C,0x0033,0x002C,0x0034,0x002C,0x0035,
+/* 0x13D8 */ 0x002C,0x0036,0x002C,0x0037,0x002C,0x0038,0x002C,0x0039,
+/* 0x13E0 */ 0x002C,0x0028,0x0041,0x0029,0x0028,0x0042,0x0029,0x0028,
+/* 0x13E8 */ 0x0043,0x0029,0x0028,0x0044,0x0029,0x0028,0x0045,0x0029,
+/* 0x13F0 */ 0x0028,0x0046,0x0029,0x0028,0x0047,0x0029,0x0028,0x0048,
+/* 0x13F8 */ 0x0029,0x0028,0x0049,0x0029,0x0028,0x004A,0x0029,0x0028,
+/* 0x1400 */ 0x004B,0x0029,0x0028,0x004C,0x0029,0x0028,0x004D,0x0029,
+/* 0x1408 */ 0x0028,0x004E,0x0029,0x0028,0x004F,0x0029,0x0028,0x0050,
+/* 0x1410 */ 0x0029,0x0028,0x0051,0x0029,0x0028,0x0052,0x0029,0x0028,
+/* 0x1418 */ 0x0053,0x0029,0x0028,0x0054,0x0029,0x0028,0x0055,0x0029,
+/* 0x1420 */ 0x0028,0x0056,0x0029,0x0028,0x0057,0x0029,0x0028,0x0058,
+/* 0x1428 */ 0x0029,0x0028,0x0059,0x0029,0x0028,0x005A,0x0029,0x3014,
+/* 0x1430 */ 0x0053,0x3015,0x3014,0x0073,0x3015,0x0043,0x0044,0x0057,
+/* 0x1438 */ 0x005A,0x0077,0x007A,0x0048,0x0056,0x0068,0x0076,0x0053,
+/* 0x1440 */ 0x0044,0x0073,0x0064,0x0053,0x0053,0x0050,0x0050,0x0056,
+/* 0x1448 */ 0x0070,0x0070,0x0076,0x0057,0x0043,0x0077,0x0063,0x004D,
+/* 0x1450 */ 0x0043,0x006D,0x0063,0x004D,0x0044,0x006D,0x0064,0x004D,
+/* 0x1458 */ 0x0052,0x006D,0x0072,0x0044,0x004A,0x0064,0x006A,0x307B,
+/* 0x1460 */ 0x304B,0x30B3,0x30B3,0x3014,0x672C,0x3015,0x3014,0x4E09,
+/* 0x1468 */ 0x3015,0x3014,0x4E8C,0x3015,0x3014,0x5B89,0x3015,0x3014,
+/* 0x1470 */ 0x70B9,0x3015,0x3014,0x6253,0x3015,0x3014,0x76D7,0x3015,
+/* 0x1478 */ 0x3014,0x52DD,0x3015,0x3014,0x6557,0x3015
+};
+
+#endif /* UNICODE_NORMMAP_H */
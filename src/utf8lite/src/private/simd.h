@@ -0,0 +1,90 @@
+/*
+ * Copyright 2017 Patrick O. Perry.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTF8LITE_SIMD_H
+#define UTF8LITE_SIMD_H
+
+/**
+ * \file simd.h
+ *
+ * Vector instruction set support, detected at compile time (SSE2) and
+ * at run time (AVX2). Define `UTF8LITE_NO_SIMD` to build with the scalar
+ * kernels only.
+ */
+
+/**
+ * Defined when SSE2 instructions are available unconditionally (x86-64,
+ * or x86 compiled with SSE2 enabled).
+ */
+#if !defined(UTF8LITE_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) \
+		|| (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#  define UTF8LITE_HAVE_SSE2 1
+#  include <emmintrin.h>
+#endif
+
+/**
+ * Defined when AVX2 kernels can be compiled. These kernels get built
+ * with a function-level target attribute, so they must only get called
+ * after checking `utf8lite_simd_avx2()`. They are disabled on Windows,
+ * where GCC does not align the stack for 32-byte vector spills.
+ */
+#if defined(UTF8LITE_HAVE_SSE2) && defined(__GNUC__) && !defined(_WIN32) \
+		&& (defined(__x86_64__) || defined(__i386__)) \
+		&& (defined(__clang__) || __GNUC__ >= 5)
+#  define UTF8LITE_HAVE_AVX2 1
+#  define UTF8LITE_TARGET_AVX2 __attribute__((target("avx2")))
+#  include <immintrin.h>
+#endif
+
+/**
+ * Test whether the running CPU supports AVX2 instructions.
+ *
+ * \returns non-zero if AVX2 kernels are available and supported
+ */
+static inline int utf8lite_cpu_avx2(void)
+{
+#ifdef UTF8LITE_HAVE_AVX2
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2");
+#else
+	return 0;
+#endif
+}
+
+/**
+ * Test whether to use the AVX2 kernels. Unlike `utf8lite_cpu_avx2()`,
+ * this reads a value detected once at load time, so it is safe to call
+ * from multiple threads.
+ *
+ * \returns non-zero if AVX2 kernels are available and supported
+ */
+int utf8lite_simd_avx2(void);
+
+/**
+ * Select the best kernel for the running CPU from a family of functions
+ * named `name_avx2`, `name_sse2`, and `name_scalar`. Only the variants
+ * that get built must exist.
+ */
+#if defined(UTF8LITE_HAVE_AVX2)
+#  define UTF8LITE_SIMD_KERNEL(name) \
+	(utf8lite_simd_avx2() ? name##_avx2 : name##_sse2)
+#elif defined(UTF8LITE_HAVE_SSE2)
+#  define UTF8LITE_SIMD_KERNEL(name) name##_sse2
+#else
+#  define UTF8LITE_SIMD_KERNEL(name) name##_scalar
+#endif
+
+#endif /* UTF8LITE_SIMD_H */
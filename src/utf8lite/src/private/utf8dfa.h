@@ -0,0 +1,164 @@
+/*
+ * Copyright 2017 Patrick O. Perry.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTF8LITE_UTF8DFA_H
+#define UTF8LITE_UTF8DFA_H
+
+/**
+ * \file utf8dfa.h
+ *
+ * Finite-state machine for validating and decoding UTF-8, in the style
+ * of Bjoern Hoehrmann's "Flexible and Economical UTF-8 Decoder".
+ *
+ * Each byte maps to one of 12 classes; the next state is looked up from
+ * the current state and the byte class. States are stored pre-multiplied
+ * by the number of classes, so that the lookup is a single addition.
+ * The machine accepts exactly the well-formed sequences from Table 3-7
+ * of the Unicode Standard.
+ */
+
+#include <stdint.h>
+
+/** Number of byte classes */
+#define UTF8LITE_DFA_NCLASS	12
+
+/** Start state, and the state after a complete character */
+#define UTF8LITE_DFA_ACCEPT	(0 * UTF8LITE_DFA_NCLASS)
+
+/** Error state; once entered, the machine stays here */
+#define UTF8LITE_DFA_REJECT	(1 * UTF8LITE_DFA_NCLASS)
+
+#define S_CONT1	(2 * UTF8LITE_DFA_NCLASS) // need 1 more byte in 80..BF
+#define S_CONT2	(3 * UTF8LITE_DFA_NCLASS) // need 2 more bytes in 80..BF
+#define S_CONT3	(4 * UTF8LITE_DFA_NCLASS) // need 3 more bytes in 80..BF
+#define S_E0	(5 * UTF8LITE_DFA_NCLASS) // after E0: need A0..BF, then 1
+#define S_ED	(6 * UTF8LITE_DFA_NCLASS) // after ED: need 80..9F, then 1
+#define S_F0	(7 * UTF8LITE_DFA_NCLASS) // after F0: need 90..BF, then 2
+#define S_F4	(8 * UTF8LITE_DFA_NCLASS) // after F4: need 80..8F, then 2
+#define S_REJ	UTF8LITE_DFA_REJECT
+
+/**
+ * Byte classes:
+ *
+ *    0: 00..7F		 6: E0
+ *    1: 80..8F		 7: E1..EC, EE..EF
+ *    2: 90..9F		 8: ED
+ *    3: A0..BF		 9: F0
+ *    4: C0..C1, F5..FF	10: F1..F3
+ *    5: C2..DF		11: F4
+ */
+static const uint8_t utf8lite_dfa_class[256] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 7, 7,
+	9, 10, 10, 10, 11, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4
+};
+
+/** Transition table, indexed by (state + class) */
+static const uint8_t utf8lite_dfa_transition[9 * UTF8LITE_DFA_NCLASS] = {
+	// ACCEPT
+	UTF8LITE_DFA_ACCEPT, S_REJ, S_REJ, S_REJ, S_REJ, S_CONT1,
+	S_E0, S_CONT2, S_ED, S_F0, S_CONT3, S_F4,
+	// REJECT
+	S_REJ, S_REJ, S_REJ, S_REJ, S_REJ, S_REJ,
+	S_REJ, S_REJ, S_REJ, S_REJ, S_REJ, S_REJ,
+	// CONT1
+	S_REJ, UTF8LITE_DFA_ACCEPT, UTF8LITE_DFA_ACCEPT, UTF8LITE_DFA_ACCEPT,
+	S_REJ, S_REJ, S_REJ, S_REJ, S_REJ, S_REJ, S_REJ, S_REJ,
+	// CONT2
+	S_REJ, S_CONT1, S_CONT1, S_CONT1, S_REJ, S_REJ,
+	S_REJ, S_REJ, S_REJ, S_REJ, S_REJ, S_REJ,
+	// CONT3
+	S_REJ, S_CONT2, S_CONT2, S_CONT2, S_REJ, S_REJ,
+	S_REJ, S_REJ, S_REJ, S_REJ, S_REJ, S_REJ,
+	// E0
+	S_REJ, S_REJ, S_REJ, S_CONT1, S_REJ, S_REJ,
+	S_REJ, S_REJ, S_REJ, S_REJ, S_REJ, S_REJ,
+	// ED
+	S_REJ, S_CONT1, S_CONT1, S_REJ, S_REJ, S_REJ,
+	S_REJ, S_REJ, S_REJ, S_REJ, S_REJ, S_REJ,
+	// F0
+	S_REJ, S_REJ, S_CONT2, S_CONT2, S_REJ, S_REJ,
+	S_REJ, S_REJ, S_REJ, S_REJ, S_REJ, S_REJ,
+	// F4
+	S_REJ, S_CONT2, S_REJ, S_REJ, S_REJ, S_REJ,
+	S_REJ, S_REJ, S_REJ, S_REJ, S_REJ, S_REJ
+};
+
+/** Payload bits of a leading byte, indexed by class */
+static const uint8_t utf8lite_dfa_lead_mask[UTF8LITE_DFA_NCLASS] = {
+	0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F,
+	0x0F, 0x0F, 0x0F, 0x07, 0x07, 0x07
+};
+
+#undef S_CONT1
+#undef S_CONT2
+#undef S_CONT3
+#undef S_E0
+#undef S_ED
+#undef S_F0
+#undef S_F4
+#undef S_REJ
+
+/**
+ * Advance the machine by one byte, without decoding.
+ *
+ * \param state the current state
+ * \param ch the next byte
+ *
+ * \returns the next state
+ */
+static inline unsigned utf8lite_dfa_next(unsigned state, uint_fast8_t ch)
+{
+	return utf8lite_dfa_transition[state + utf8lite_dfa_class[ch]];
+}
+
+/**
+ * Advance the machine by one byte, accumulating the decoded codepoint.
+ *
+ * \param state the current state
+ * \param codeptr the partially-decoded codepoint; updated on exit
+ * \param ch the next byte
+ *
+ * \returns the next state
+ */
+static inline unsigned utf8lite_dfa_step(unsigned state, int32_t *codeptr,
+					 uint_fast8_t ch)
+{
+	unsigned cls = utf8lite_dfa_class[ch];
+
+	if (state == UTF8LITE_DFA_ACCEPT) {
+		*codeptr = (int32_t)(ch & utf8lite_dfa_lead_mask[cls]);
+	} else {
+		*codeptr = (*codeptr << 6) | (int32_t)(ch & 0x3F);
+	}
+
+	return utf8lite_dfa_transition[state + cls];
+}
+
+#endif /* UTF8LITE_UTF8DFA_H */
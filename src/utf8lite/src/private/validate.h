@@ -0,0 +1,59 @@
+/*
+ * Copyright 2017 Patrick O. Perry.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTF8LITE_VALIDATE_H
+#define UTF8LITE_VALIDATE_H
+
+/**
+ * \file validate.h
+ *
+ * Bulk UTF-8 validation.
+ */
+
+#include <stdint.h>
+
+/**
+ * Find the first invalid UTF-8 character in a buffer. This uses the
+ * fastest validation kernel supported by the CPU: AVX2, SSE2, or
+ * a scalar kernel that skips ASCII a word at a time. The CPU support
+ * gets detected once, when the library loads.
+ *
+ * The kernels do not report why a character is invalid; to get an
+ * error message, call #utf8lite_scan_utf8 on the returned pointer.
+ *
+ * \param ptr the start of the buffer
+ * \param end the end of the buffer
+ *
+ * \returns a pointer to the start of the first invalid character,
+ * 	or `end` if the buffer is valid UTF-8
+ */
+const uint8_t *utf8lite_find_invalid_utf8(const uint8_t *ptr,
+					  const uint8_t *end);
+
+/**
+ * Find the first non-ASCII byte in a buffer, scanning 16 bytes at a time
+ * with SSE2 if available, otherwise a word at a time.
+ *
+ * \param ptr the start of the buffer
+ * \param end the end of the buffer
+ *
+ * \returns a pointer to the first byte with the high bit set, or `end`
+ * 	if the buffer is all ASCII
+ */
+const uint8_t *utf8lite_find_nonascii(const uint8_t *ptr,
+				      const uint8_t *end);
+
+#endif /* UTF8LITE_VALIDATE_H */
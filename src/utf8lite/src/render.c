@@ -22,6 +22,8 @@
 #include <stdlib.h>
 #include <string.h>
 #include "private/array.h"
+#include "private/inline.h"
+#include "private/simd.h"
 #include "utf8lite.h"
 
 #define CHECK_ERROR(r) \
@@ -41,26 +43,67 @@ enum code_type {
  * the character through the appropriate escaping.
  *
  * \param r the render object
+ * \param flags the render flags, `r->flags` or a constant with the
+ * 	same effect
  * \param ch the character (UTF-32)
  * \param attrptr on exit, a bit mask of #code_type flags
  *
  * \returns 0 on success
  */
-static int utf8lite_render_code(struct utf8lite_render *r, int32_t ch,
-				int *attrptr);
+static UTF8LITE_ALWAYS_INLINE int utf8lite_render_code(
+		struct utf8lite_render *r, int flags, int32_t ch,
+		int *attrptr);
 
-static int utf8lite_render_grow(struct utf8lite_render *r, int nadd)
+static UTF8LITE_ALWAYS_INLINE int utf8lite_render_ascii(
+		struct utf8lite_render *r, int flags, int32_t ch);
+
+static UTF8LITE_ALWAYS_INLINE int render_graph(struct utf8lite_render *r,
+					       int flags,
+					       const struct utf8lite_graph *g);
+
+static UTF8LITE_ALWAYS_INLINE int render_text(struct utf8lite_render *r,
+					      int flags,
+					      const struct utf8lite_text *t);
+
+static UTF8LITE_ALWAYS_INLINE const uint8_t *clean_span(const uint8_t *ptr,
+							const uint8_t *end,
+							int flags);
+
+/*
+ * The ASCII characters that do not render as themselves.
+ */
+struct span_set {
+	int control;	// control characters
+	int dquote;	// "
+	int squote;	// '
+	int bslash;	// \ (backslash)
+};
+
+static size_t ascii_span(const uint8_t *ptr, size_t n,
+			 const struct span_set *set);
+
+static int utf8lite_render_grow(struct utf8lite_render *r, size_t nadd)
 {
 	void *base = r->string;
-	int size = r->length_max + 1;
+	size_t size = r->length_max + 1;
 	int err;
 
-	if (nadd <= 0 || r->length_max - nadd > r->length) {
+	if (nadd == 0 || r->length_max - r->length > nadd) {
 		return 0;
 	}
 
-	if ((err = utf8lite_array_grow(&base, &size, sizeof(*r->string),
-				       r->length + 1, nadd))) {
+	// when streaming, make room by writing out the buffer
+	if (r->flush && r->length > 0) {
+		if ((err = utf8lite_render_flush(r))) {
+			return err;
+		}
+		if (r->length_max - r->length > nadd) {
+			return 0;
+		}
+	}
+
+	if ((err = utf8lite_bigarray_grow(&base, &size, sizeof(*r->string),
+					  r->length + 1, nadd))) {
 		r->error = err;
 		return r->error;
 	}
@@ -116,6 +159,9 @@ int utf8lite_render_init(struct utf8lite_render *r, int flags)
 	r->style_close = NULL;
 	r->style_close_length = 0;
 
+	r->flush = NULL;
+	r->flush_context = NULL;
+
 	utf8lite_render_clear(r);
 
 	return 0;
@@ -145,6 +191,53 @@ int utf8lite_render_set_flags(struct utf8lite_render *r, int flags)
 }
 
 
+int utf8lite_render_reserve(struct utf8lite_render *r, size_t size)
+{
+	CHECK_ERROR(r);
+
+	utf8lite_render_grow(r, size);
+	return r->error;
+}
+
+
+int utf8lite_render_set_flush(struct utf8lite_render *r,
+			      utf8lite_render_flush_func flush,
+			      void *context, size_t size)
+{
+	CHECK_ERROR(r);
+
+	if (flush && size > r->length) {
+		utf8lite_render_grow(r, size - r->length);
+		CHECK_ERROR(r);
+	}
+
+	r->flush = flush;
+	r->flush_context = context;
+	return 0;
+}
+
+
+int utf8lite_render_flush(struct utf8lite_render *r)
+{
+	int err;
+
+	CHECK_ERROR(r);
+
+	if (!r->flush || !r->length) {
+		return 0;
+	}
+
+	if ((err = r->flush(r->flush_context, r->string, r->length))) {
+		r->error = err;
+		return r->error;
+	}
+
+	r->string[0] = '\0';
+	r->length = 0;
+	return 0;
+}
+
+
 int utf8lite_render_set_tab(struct utf8lite_render *r, const char *tab)
 {
 	size_t len;
@@ -388,26 +481,26 @@ static int utf8lite_escape_ascii(struct utf8lite_render *r, int32_t ch)
 }
 
 
-static int utf8lite_render_ascii(struct utf8lite_render *r, int32_t ch)
+int utf8lite_render_ascii(struct utf8lite_render *r, int flags, int32_t ch)
 {
 	if ((ch <= 0x1F || ch == 0x7F)
-			&& (r->flags & UTF8LITE_ESCAPE_CONTROL)) {
+			&& (flags & UTF8LITE_ESCAPE_CONTROL)) {
 		return utf8lite_escape_ascii(r, ch);
 	}
 
 	switch (ch) {
 	case '\"':
-		if (r->flags & UTF8LITE_ESCAPE_DQUOTE) {
+		if (flags & UTF8LITE_ESCAPE_DQUOTE) {
 			return utf8lite_escape_ascii(r, ch);
 		}
 		break;
 	case '\'':
-		if (r->flags & UTF8LITE_ESCAPE_SQUOTE) {
+		if (flags & UTF8LITE_ESCAPE_SQUOTE) {
 			return utf8lite_escape_ascii(r, ch);
 		}
 		break;
 	case '\\':
-		if (r->flags & (UTF8LITE_ESCAPE_CONTROL
+		if (flags & (UTF8LITE_ESCAPE_CONTROL
 					| UTF8LITE_ESCAPE_DQUOTE
 					| UTF8LITE_ESCAPE_SQUOTE
 					| UTF8LITE_ESCAPE_EXTENDED
@@ -428,7 +521,8 @@ static int utf8lite_render_ascii(struct utf8lite_render *r, int32_t ch)
 }
 
 
-int utf8lite_render_code(struct utf8lite_render *r, int32_t ch, int *attrptr)
+int utf8lite_render_code(struct utf8lite_render *r, int flags, int32_t ch,
+			 int *attrptr)
 {
 	char *end;
 	uint8_t *uend;
@@ -445,13 +539,13 @@ int utf8lite_render_code(struct utf8lite_render *r, int32_t ch, int *attrptr)
 
 	end = r->string + r->length;
 	if (UTF8LITE_IS_ASCII(ch)) {
-		return utf8lite_render_ascii(r, ch);
-	} else if (r->flags & UTF8LITE_ESCAPE_UTF8) {
+		return utf8lite_render_ascii(r, flags, ch);
+	} else if (flags & UTF8LITE_ESCAPE_UTF8) {
 		return utf8lite_escape_utf8(r, ch);
 	}
 
 	if (ch > 0xFFFF) {
-		if (r->flags & UTF8LITE_ESCAPE_EXTENDED) {
+		if (flags & UTF8LITE_ESCAPE_EXTENDED) {
 			return utf8lite_escape_utf8(r, ch);
 		} else {
 			*attrptr |= CODE_EXTENDED;
@@ -462,13 +556,13 @@ int utf8lite_render_code(struct utf8lite_render *r, int32_t ch, int *attrptr)
 	type = utf8lite_charwidth(ch);
 	switch (type) {
 	case UTF8LITE_CHARWIDTH_NONE:
-		if (r->flags & UTF8LITE_ESCAPE_CONTROL) {
+		if (flags & UTF8LITE_ESCAPE_CONTROL) {
 			return utf8lite_escape_utf8(r, ch);
 		}
 		break;
 
 	case UTF8LITE_CHARWIDTH_IGNORABLE:
-		if ((r->flags & UTF8LITE_ENCODE_RMDI)
+		if ((flags & UTF8LITE_ENCODE_RMDI)
 				&& (!(*attrptr & CODE_EMOJI))) {
 			return 0;
 		}
@@ -567,25 +661,348 @@ exit:
 }
 
 
+/*
+ * The flags that change how characters render. With
+ * UTF8LITE_ESCAPE_UTF8, every non-ASCII character gets escaped, so
+ * UTF8LITE_ESCAPE_EXTENDED, UTF8LITE_ENCODE_RMDI, and
+ * UTF8LITE_ENCODE_EMOJIZWSP have no effect.
+ */
+#define RENDER_FLAGS \
+	(UTF8LITE_ESCAPE_CONTROL | UTF8LITE_ESCAPE_DQUOTE \
+	 | UTF8LITE_ESCAPE_SQUOTE | UTF8LITE_ESCAPE_EXTENDED \
+	 | UTF8LITE_ESCAPE_UTF8 | UTF8LITE_ENCODE_JSON \
+	 | UTF8LITE_ENCODE_EMOJIZWSP | UTF8LITE_ENCODE_RMDI)
+
+#define RENDER_DISPLAY (UTF8LITE_ENCODE_EMOJIZWSP | UTF8LITE_ENCODE_RMDI)
+
+/*
+ * Copies of the text renderer for the flag combinations that
+ * utf8_format(), utf8_encode(), and utf8_print() use, with the flag
+ * tests folded into constants. Other combinations test `r->flags` for
+ * each character.
+ */
+#define RENDER_TEXT_KERNEL(name, kflags) \
+	static int name(struct utf8lite_render *r, \
+			const struct utf8lite_text *text) \
+	{ \
+		return render_text(r, UTF8LITE_ESCAPE_CONTROL | (kflags), \
+				   text); \
+	}
+
+RENDER_TEXT_KERNEL(render_text_c, 0)
+RENDER_TEXT_KERNEL(render_text_cq, UTF8LITE_ESCAPE_DQUOTE)
+RENDER_TEXT_KERNEL(render_text_cd, RENDER_DISPLAY)
+RENDER_TEXT_KERNEL(render_text_cqd, UTF8LITE_ESCAPE_DQUOTE | RENDER_DISPLAY)
+RENDER_TEXT_KERNEL(render_text_cu, UTF8LITE_ESCAPE_UTF8)
+RENDER_TEXT_KERNEL(render_text_cqu,
+		   UTF8LITE_ESCAPE_DQUOTE | UTF8LITE_ESCAPE_UTF8)
+RENDER_TEXT_KERNEL(render_text_cx, UTF8LITE_ESCAPE_EXTENDED)
+RENDER_TEXT_KERNEL(render_text_cqx,
+		   UTF8LITE_ESCAPE_DQUOTE | UTF8LITE_ESCAPE_EXTENDED)
+RENDER_TEXT_KERNEL(render_text_cdx,
+		   RENDER_DISPLAY | UTF8LITE_ESCAPE_EXTENDED)
+RENDER_TEXT_KERNEL(render_text_cqdx,
+		   UTF8LITE_ESCAPE_DQUOTE | RENDER_DISPLAY
+		   | UTF8LITE_ESCAPE_EXTENDED)
+
+
 int utf8lite_render_text(struct utf8lite_render *r,
 			 const struct utf8lite_text *text)
 {
-	struct utf8lite_graphscan scan;
+	int flags;
 
 	CHECK_ERROR(r);
 
-	utf8lite_graphscan_make(&scan, text);
-	while (utf8lite_graphscan_advance(&scan)) {
-		utf8lite_render_graph(r, &scan.current);
-		CHECK_ERROR(r);
+	flags = r->flags & RENDER_FLAGS;
+	if (flags & UTF8LITE_ESCAPE_UTF8) {
+		flags &= ~(UTF8LITE_ESCAPE_EXTENDED | RENDER_DISPLAY);
 	}
 
-	return 0;
+	switch (flags) {
+	case UTF8LITE_ESCAPE_CONTROL:
+		return render_text_c(r, text);
+	case UTF8LITE_ESCAPE_CONTROL | UTF8LITE_ESCAPE_DQUOTE:
+		return render_text_cq(r, text);
+	case UTF8LITE_ESCAPE_CONTROL | RENDER_DISPLAY:
+		return render_text_cd(r, text);
+	case UTF8LITE_ESCAPE_CONTROL | UTF8LITE_ESCAPE_DQUOTE
+			| RENDER_DISPLAY:
+		return render_text_cqd(r, text);
+	case UTF8LITE_ESCAPE_CONTROL | UTF8LITE_ESCAPE_UTF8:
+		return render_text_cu(r, text);
+	case UTF8LITE_ESCAPE_CONTROL | UTF8LITE_ESCAPE_DQUOTE
+			| UTF8LITE_ESCAPE_UTF8:
+		return render_text_cqu(r, text);
+	case UTF8LITE_ESCAPE_CONTROL | UTF8LITE_ESCAPE_EXTENDED:
+		return render_text_cx(r, text);
+	case UTF8LITE_ESCAPE_CONTROL | UTF8LITE_ESCAPE_DQUOTE
+			| UTF8LITE_ESCAPE_EXTENDED:
+		return render_text_cqx(r, text);
+	case UTF8LITE_ESCAPE_CONTROL | RENDER_DISPLAY
+			| UTF8LITE_ESCAPE_EXTENDED:
+		return render_text_cdx(r, text);
+	case UTF8LITE_ESCAPE_CONTROL | UTF8LITE_ESCAPE_DQUOTE
+			| RENDER_DISPLAY | UTF8LITE_ESCAPE_EXTENDED:
+		return render_text_cqdx(r, text);
+	default:
+		return render_text(r, r->flags, text);
+	}
 }
 
 
 int utf8lite_render_graph(struct utf8lite_render *r,
 			 const struct utf8lite_graph *g)
+{
+	return render_graph(r, r->flags, g);
+}
+
+
+int render_text(struct utf8lite_render *r, int flags,
+		const struct utf8lite_text *text)
+{
+	struct utf8lite_graphscan scan;
+	struct utf8lite_text tail;
+	const uint8_t *ptr, *end, *span;
+
+	CHECK_ERROR(r);
+
+	if (UTF8LITE_TEXT_HAS_ESC(text)) {
+		utf8lite_graphscan_make(&scan, text);
+		while (utf8lite_graphscan_advance(&scan)) {
+			render_graph(r, flags, &scan.current);
+			CHECK_ERROR(r);
+		}
+		return 0;
+	}
+
+	// Copy runs of characters that render as themselves, and render
+	// the graphemes in between one character at a time. A run starts
+	// at the end of a grapheme, or after characters that do not change
+	// how the rest of their grapheme renders, so it does not matter
+	// that the scan restarts there.
+	ptr = text->ptr;
+	end = ptr + UTF8LITE_TEXT_SIZE(text);
+
+	while (ptr != end) {
+		span = clean_span(ptr, end, flags);
+		if (span != ptr) {
+			maybe_indent(r);
+			CHECK_ERROR(r);
+			utf8lite_render_raw(r, (const char *)ptr,
+					    (size_t)(span - ptr));
+			CHECK_ERROR(r);
+			ptr = span;
+		}
+
+		if (ptr == end) {
+			break;
+		}
+
+		tail.ptr = (uint8_t *)ptr;
+		tail.attr = (size_t)(end - ptr) | UTF8LITE_TEXT_BITS(text);
+		utf8lite_graphscan_make(&scan, &tail);
+		while (utf8lite_graphscan_advance(&scan)) {
+			render_graph(r, flags, &scan.current);
+			CHECK_ERROR(r);
+
+			ptr = scan.ptr;
+			if (ptr == end || clean_span(ptr, end, flags) != ptr) {
+				break;
+			}
+		}
+	}
+
+	return 0;
+}
+
+
+/*
+ * Find the end of the leading run of characters that render as
+ * themselves. Characters in the run cannot be emoji or ignorables when
+ * the flags treat those specially, so that the run does not change how
+ * the characters after it in the same grapheme render.
+ */
+const uint8_t *clean_span(const uint8_t *ptr, const uint8_t *end, int flags)
+{
+	struct span_set set;
+	const uint8_t *next;
+	int32_t ch;
+	int cw;
+
+	set.control = flags & UTF8LITE_ESCAPE_CONTROL;
+	set.dquote = flags & UTF8LITE_ESCAPE_DQUOTE;
+	set.squote = flags & UTF8LITE_ESCAPE_SQUOTE;
+	set.bslash = flags & (UTF8LITE_ESCAPE_CONTROL
+			      | UTF8LITE_ESCAPE_DQUOTE
+			      | UTF8LITE_ESCAPE_SQUOTE
+			      | UTF8LITE_ESCAPE_EXTENDED
+			      | UTF8LITE_ESCAPE_UTF8);
+
+	while (ptr != end) {
+		ptr += ascii_span(ptr, (size_t)(end - ptr), &set);
+		if (ptr == end || UTF8LITE_IS_ASCII(*ptr)
+				|| (flags & UTF8LITE_ESCAPE_UTF8)) {
+			break;
+		}
+
+		next = ptr;
+		utf8lite_decode_utf8(&next, &ch);
+		if (ch > 0xFFFF && (flags & UTF8LITE_ESCAPE_EXTENDED)) {
+			break;
+		}
+
+		cw = utf8lite_charwidth(ch);
+		if (cw == UTF8LITE_CHARWIDTH_NONE
+				&& (flags & UTF8LITE_ESCAPE_CONTROL)) {
+			break;
+		}
+		if ((cw == UTF8LITE_CHARWIDTH_IGNORABLE
+					|| cw == UTF8LITE_CHARWIDTH_EMOJI)
+				&& (flags & (UTF8LITE_ENCODE_RMDI
+					     | UTF8LITE_ENCODE_EMOJIZWSP))) {
+			break;
+		}
+		ptr = next;
+	}
+
+	return ptr;
+}
+
+
+/*
+ * ASCII span kernels. Count the leading ASCII bytes that are not in
+ * the set.
+ */
+
+static size_t ascii_span_scalar(const uint8_t *ptr, size_t n,
+				const struct span_set *set)
+{
+	size_t i;
+	uint8_t ch;
+
+	for (i = 0; i < n; i++) {
+		ch = ptr[i];
+		if (ch >= 0x80) {
+			break;
+		} else if (ch < 0x20 || ch == 0x7F) {
+			if (set->control) {
+				break;
+			}
+		} else if (ch == '\"') {
+			if (set->dquote) {
+				break;
+			}
+		} else if (ch == '\'') {
+			if (set->squote) {
+				break;
+			}
+		} else if (ch == '\\') {
+			if (set->bslash) {
+				break;
+			}
+		}
+	}
+
+	return i;
+}
+
+
+#ifdef UTF8LITE_HAVE_SSE2
+
+static size_t ascii_span_sse2(const uint8_t *ptr, size_t n,
+			      const struct span_set *set)
+{
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i ones = _mm_set1_epi8(-1);
+	const __m128i space = _mm_set1_epi8(0x20);
+	const __m128i del = _mm_set1_epi8(0x7F);
+	const __m128i dquote = _mm_set1_epi8('\"');
+	const __m128i squote = _mm_set1_epi8('\'');
+	const __m128i bslash = _mm_set1_epi8('\\');
+	const __m128i control_on = set->control ? ones : zero;
+	const __m128i dquote_on = set->dquote ? ones : zero;
+	const __m128i squote_on = set->squote ? ones : zero;
+	const __m128i bslash_on = set->bslash ? ones : zero;
+	__m128i block, stop;
+	size_t i = 0;
+
+	// non-ASCII bytes are negative, so they compare less than space
+	while (n - i >= 16) {
+		block = _mm_loadu_si128((const __m128i *)(ptr + i));
+		stop = _mm_or_si128(_mm_cmplt_epi8(block, zero),
+			_mm_and_si128(control_on, _mm_or_si128(
+				_mm_cmplt_epi8(block, space),
+				_mm_cmpeq_epi8(block, del))));
+		stop = _mm_or_si128(stop, _mm_and_si128(dquote_on,
+				_mm_cmpeq_epi8(block, dquote)));
+		stop = _mm_or_si128(stop, _mm_and_si128(squote_on,
+				_mm_cmpeq_epi8(block, squote)));
+		stop = _mm_or_si128(stop, _mm_and_si128(bslash_on,
+				_mm_cmpeq_epi8(block, bslash)));
+		if (_mm_movemask_epi8(stop)) {
+			break;
+		}
+		i += 16;
+	}
+
+	return i + ascii_span_scalar(ptr + i, n - i, set);
+}
+
+#endif /* UTF8LITE_HAVE_SSE2 */
+
+
+#ifdef UTF8LITE_HAVE_AVX2
+
+UTF8LITE_TARGET_AVX2
+static size_t ascii_span_avx2(const uint8_t *ptr, size_t n,
+			      const struct span_set *set)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i ones = _mm256_set1_epi8(-1);
+	const __m256i space = _mm256_set1_epi8(0x20);
+	const __m256i del = _mm256_set1_epi8(0x7F);
+	const __m256i dquote = _mm256_set1_epi8('\"');
+	const __m256i squote = _mm256_set1_epi8('\'');
+	const __m256i bslash = _mm256_set1_epi8('\\');
+	const __m256i control_on = set->control ? ones : zero;
+	const __m256i dquote_on = set->dquote ? ones : zero;
+	const __m256i squote_on = set->squote ? ones : zero;
+	const __m256i bslash_on = set->bslash ? ones : zero;
+	__m256i block, stop;
+	size_t i = 0;
+
+	while (n - i >= 32) {
+		block = _mm256_loadu_si256((const __m256i *)(ptr + i));
+		stop = _mm256_or_si256(_mm256_cmpgt_epi8(zero, block),
+			_mm256_and_si256(control_on, _mm256_or_si256(
+				_mm256_cmpgt_epi8(space, block),
+				_mm256_cmpeq_epi8(block, del))));
+		stop = _mm256_or_si256(stop, _mm256_and_si256(dquote_on,
+				_mm256_cmpeq_epi8(block, dquote)));
+		stop = _mm256_or_si256(stop, _mm256_and_si256(squote_on,
+				_mm256_cmpeq_epi8(block, squote)));
+		stop = _mm256_or_si256(stop, _mm256_and_si256(bslash_on,
+				_mm256_cmpeq_epi8(block, bslash)));
+		if (_mm256_movemask_epi8(stop)) {
+			break;
+		}
+		i += 32;
+	}
+
+	return i + ascii_span_sse2(ptr + i, n - i, set);
+}
+
+#endif /* UTF8LITE_HAVE_AVX2 */
+
+
+size_t ascii_span(const uint8_t *ptr, size_t n, const struct span_set *set)
+{
+	return UTF8LITE_SIMD_KERNEL(ascii_span)(ptr, n, set);
+}
+
+
+int render_graph(struct utf8lite_render *r, int flags,
+		 const struct utf8lite_graph *g)
 {
 	struct utf8lite_text_iter it;
 	int attr = CODE_ASCII;
@@ -594,11 +1011,11 @@ int utf8lite_render_graph(struct utf8lite_render *r,
 
 	utf8lite_text_iter_make(&it, &g->text);
 	while (utf8lite_text_iter_advance(&it)) {
-		utf8lite_render_code(r, it.current, &attr);
+		utf8lite_render_code(r, flags, it.current, &attr);
 		CHECK_ERROR(r);
 	}
 
-	if (attr & CODE_EMOJI && (r->flags & UTF8LITE_ENCODE_EMOJIZWSP)) {
+	if (attr & CODE_EMOJI && (flags & UTF8LITE_ENCODE_EMOJIZWSP)) {
 		utf8lite_render_raw(r, "\xE2\x80\x8B", 3); // U+200B, ZWSP
 		CHECK_ERROR(r);
 	}
@@ -610,15 +1027,28 @@ int utf8lite_render_graph(struct utf8lite_render *r,
 int utf8lite_render_raw(struct utf8lite_render *r, const char *bytes,
 			size_t size)
 {
-	if (size > INT_MAX) {
-		r->error = UTF8LITE_ERROR_OVERFLOW;
-		return r->error;
+	int err;
+
+	CHECK_ERROR(r);
+
+	// when streaming, pass large writes through without copying
+	if (r->flush && size > r->length_max - r->length) {
+		utf8lite_render_flush(r);
+		CHECK_ERROR(r);
+
+		if (size > r->length_max) {
+			if ((err = r->flush(r->flush_context, bytes, size))) {
+				r->error = err;
+			}
+			return r->error;
+		}
 	}
-	utf8lite_render_grow(r, (int)size);
+
+	utf8lite_render_grow(r, size);
 	CHECK_ERROR(r);
 
 	memcpy(r->string + r->length, bytes, size);
-	r->length += (int)size;
+	r->length += size;
 	r->string[r->length] = '\0';
 	return 0;
 }
@@ -0,0 +1,49 @@
+/*
+ * Copyright 2017 Patrick O. Perry.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "private/simd.h"
+
+#ifdef UTF8LITE_HAVE_AVX2
+
+/*
+ * Run-time CPU support, set once from a constructor when the library
+ * gets loaded, before any other thread can call in. Kernel selection only
+ * reads it afterwards, so concurrent callers do not race.
+ */
+static int simd_avx2 = -1;
+
+static void simd_init(void) __attribute__((constructor));
+
+void simd_init(void)
+{
+	simd_avx2 = utf8lite_cpu_avx2();
+}
+
+#endif /* UTF8LITE_HAVE_AVX2 */
+
+
+int utf8lite_simd_avx2(void)
+{
+#ifdef UTF8LITE_HAVE_AVX2
+	if (simd_avx2 < 0) {
+		// called from another constructor; detect without caching
+		return utf8lite_cpu_avx2();
+	}
+	return simd_avx2;
+#else
+	return 0;
+#endif
+}
@@ -50,15 +50,7 @@ void utf8lite_text_destroy(struct utf8lite_text *text)
 
 int utf8lite_text_isascii(const struct utf8lite_text *text)
 {
-	struct utf8lite_text_iter it;
-
-	utf8lite_text_iter_make(&it, text);
-	while (utf8lite_text_iter_advance(&it)) {
-		if (!UTF8LITE_IS_ASCII(it.current)) {
-			return 0;
-		}
-	}
-	return 1;
+	return (text->attr & UTF8LITE_TEXT_ASCII_BIT) ? 1 : 0;
 }
 
 
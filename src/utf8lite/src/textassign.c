@@ -14,10 +14,12 @@
  * limitations under the License.
  */
 
+#include <assert.h>
 #include <ctype.h>
 #include <inttypes.h>
 #include <stdio.h>
 #include <string.h>
+#include "private/validate.h"
 #include "utf8lite.h"
 
 
@@ -78,6 +80,15 @@ int assign_raw(struct utf8lite_text *text, const uint8_t *ptr, size_t size,
 
 	text->ptr = (uint8_t *)ptr;
 
+	ptr = utf8lite_find_nonascii(ptr, end);
+	if (ptr == end) {
+		text->attr = size | UTF8LITE_TEXT_ASCII_BIT;
+		return 0;
+	}
+
+	// skip the valid prefix with the bulk kernel, then report the error
+	ptr = utf8lite_find_invalid_utf8(ptr, end);
+
 	while (ptr != end) {
 		ch = *ptr++;
 		if (ch & 0x80) {
@@ -104,24 +115,53 @@ int assign_esc(struct utf8lite_text *text, const uint8_t *ptr, size_t size,
 {
 	const uint8_t *input = ptr;
 	const uint8_t *end = ptr + size;
-	size_t attr = 0;
-	uint_fast8_t ch;
+	const uint8_t *span_end, *bad, *esc;
+	size_t attr = UTF8LITE_TEXT_ASCII_BIT;
+	int32_t code;
 	int err;
 
 	text->ptr = (uint8_t *)ptr;
 
 	while (ptr != end) {
-		ch = *ptr++;
-		if (ch == '\\') {
-			attr |= UTF8LITE_TEXT_ESC_BIT;
+		// validate the span up to the next escape in bulk
+		span_end = memchr(ptr, '\\', (size_t)(end - ptr));
+		if (!span_end) {
+			span_end = end;
+		}
 
-			if ((err = utf8lite_scan_escape(&ptr, end, msg))) {
-				goto error;
+		if (attr & UTF8LITE_TEXT_ASCII_BIT) {
+			ptr = utf8lite_find_nonascii(ptr, span_end);
+			if (ptr != span_end) {
+				attr &= ~UTF8LITE_TEXT_ASCII_BIT;
 			}
-		} else if (ch & 0x80) {
-			ptr--;
-			if ((err = utf8lite_scan_utf8(&ptr, end, msg))) {
-				goto error;
+		}
+
+		bad = utf8lite_find_invalid_utf8(ptr, span_end);
+		if (bad != span_end) {
+			// scan to the true end so that the message matches
+			ptr = bad;
+			err = utf8lite_scan_utf8(&ptr, end, msg);
+			assert(err);
+			goto error;
+		}
+
+		ptr = span_end;
+		if (ptr == end) {
+			break;
+		}
+
+		ptr++;
+		attr |= UTF8LITE_TEXT_ESC_BIT;
+		esc = ptr;
+		if ((err = utf8lite_scan_escape(&ptr, end, msg))) {
+			goto error;
+		}
+
+		if (*esc == 'u' && (attr & UTF8LITE_TEXT_ASCII_BIT)) {
+			esc++;
+			utf8lite_decode_uescape(&esc, &code);
+			if (!UTF8LITE_IS_ASCII(code)) {
+				attr &= ~UTF8LITE_TEXT_ASCII_BIT;
 			}
 		}
 	}
@@ -140,18 +180,15 @@ void assign_raw_unsafe(struct utf8lite_text *text, const uint8_t *ptr,
 		       size_t size)
 {
 	const uint8_t *end = ptr + size;
-	uint_fast8_t ch;
+	size_t attr = size;
 
 	text->ptr = (uint8_t *)ptr;
 
-	while (ptr != end) {
-		ch = *ptr++;
-		if (ch & 0x80) {
-			ptr += UTF8LITE_UTF8_TAIL_LEN(ch);
-		}
+	if (utf8lite_find_nonascii(ptr, end) == end) {
+		attr |= UTF8LITE_TEXT_ASCII_BIT;
 	}
 
-	text->attr = size;
+	text->attr = attr;
 }
 
 
@@ -160,7 +197,7 @@ void assign_esc_unsafe(struct utf8lite_text *text, const uint8_t *ptr,
 		       size_t size)
 {
 	const uint8_t *end = ptr + size;
-	size_t attr = 0;
+	size_t attr = UTF8LITE_TEXT_ASCII_BIT;
 	int32_t code;
 	uint_fast8_t ch;
 
@@ -175,11 +212,15 @@ void assign_esc_unsafe(struct utf8lite_text *text, const uint8_t *ptr,
 			switch (ch) {
 			case 'u':
 				utf8lite_decode_uescape(&ptr, &code);
+				if (!UTF8LITE_IS_ASCII(code)) {
+					attr &= ~UTF8LITE_TEXT_ASCII_BIT;
+				}
 				break;
 			default:
 				break;
 			}
 		} else if (ch & 0x80) {
+			attr &= ~UTF8LITE_TEXT_ASCII_BIT;
 			ptr += UTF8LITE_UTF8_TAIL_LEN(ch);
 		}
 	}
@@ -20,18 +20,58 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
+#include "private/simd.h"
+#include "private/utf8dfa.h"
+#include "private/validate.h"
 #include "utf8lite.h"
 
+// initial output buffer size, in bytes
+#define TEXTMAP_SIZE_INIT 256
+
+// initial scratch buffer size, in codepoints
+#define TEXTMAP_NCODE_INIT 256
+
+// minimum length of an ASCII run to copy in bulk from non-ASCII text
+#define TEXTMAP_ASCII_RUN 16
+
+static void lower_ascii(uint8_t *dst, const uint8_t *src, size_t n);
+
+// the state of a map in progress
+struct textmap_state {
+	size_t len;	// number of codes in the scratch buffer
+	size_t safe;	// last normalization boundary in the scratch buffer
+	size_t mark;	// first code that is not a boundary, or `len` if none
+	size_t size;	// number of bytes in the output buffer
+	size_t attr;	// attributes of the output
+};
+
 
 static void utf8lite_textmap_clear_type(struct utf8lite_textmap *map);
-static int utf8lite_textmap_set_type(struct utf8lite_textmap *map, int type);
 
 static int utf8lite_textmap_reserve(struct utf8lite_textmap *map, size_t size);
+static int utf8lite_textmap_reserve_codes(struct utf8lite_textmap *map,
+					  size_t n);
+static int utf8lite_textmap_isfixed(const struct utf8lite_textmap *map,
+				    const struct utf8lite_text *text);
+static int utf8lite_textmap_keeps(const struct utf8lite_textmap *map,
+				  int32_t code, uint8_t *clptr);
+static int utf8lite_textmap_decode(const uint8_t **bufptr,
+				   const uint8_t *end, int32_t *codeptr);
+static int utf8lite_textmap_push(struct utf8lite_textmap *map,
+				 struct textmap_state *st, int32_t code);
+static int utf8lite_textmap_skip_ascii(struct utf8lite_textmap *map,
+				       struct textmap_state *st,
+				       const uint8_t **bufptr,
+				       const uint8_t *end);
+static int utf8lite_textmap_finish(struct utf8lite_textmap *map,
+				   struct textmap_state *st);
 static int utf8lite_textmap_set_ascii(struct utf8lite_textmap *map,
 			     const struct utf8lite_text *text);
-static int utf8lite_textmap_set_utf32(struct utf8lite_textmap *map,
-				    const int32_t *ptr,
-				    const int32_t *end);
+static int utf8lite_textmap_flush(struct utf8lite_textmap *map,
+				  struct textmap_state *st, size_t n);
+static int utf8lite_textmap_append_ascii(struct utf8lite_textmap *map,
+					 const uint8_t *ptr, size_t n,
+					 size_t *sizeptr);
 
 
 int utf8lite_textmap_init(struct utf8lite_textmap *map, int type)
@@ -40,8 +80,10 @@ int utf8lite_textmap_init(struct utf8lite_textmap *map, int type)
 
 	map->text.ptr = NULL;
 	map->text.attr = 0;
+	map->buf = NULL;
 	map->codes = NULL;
 	map->size_max = 0;
+	map->ncode_max = 0;
 
 	utf8lite_textmap_clear_type(map);
 	err = utf8lite_textmap_set_type(map, type);
@@ -52,7 +94,7 @@ int utf8lite_textmap_init(struct utf8lite_textmap *map, int type)
 void utf8lite_textmap_destroy(struct utf8lite_textmap *map)
 {
 	free(map->codes);
-	free(map->text.ptr);
+	free(map->buf);
 }
 
 
@@ -89,7 +131,7 @@ int utf8lite_textmap_set_type(struct utf8lite_textmap *map, int type)
 	}
 
 	if (type & UTF8LITE_TEXTMAP_COMPAT) {
-		map->charmap_type = UTF8LITE_DECOMP_ALL;
+		map->charmap_type |= UTF8LITE_DECOMP_ALL;
 	}
 
 	map->type = type;
@@ -100,28 +142,57 @@ int utf8lite_textmap_set_type(struct utf8lite_textmap *map, int type)
 
 int utf8lite_textmap_reserve(struct utf8lite_textmap *map, size_t size)
 {
-	uint8_t *ptr = map->text.ptr;
-	int32_t *codes = map->codes;
+	uint8_t *buf = map->buf;
+	size_t size_max = map->size_max;
 
-	if (map->size_max >= size) {
+	if (size_max >= size) {
 		return 0;
 	}
 
-	if (!(ptr = realloc(ptr, size))) {
+	if (!size_max) {
+		size_max = TEXTMAP_SIZE_INIT;
+	}
+	while (size_max < size) {
+		if (size_max > SIZE_MAX / 2) {
+			size_max = size;
+			break;
+		}
+		size_max *= 2;
+	}
+
+	if (!(buf = realloc(buf, size_max))) {
 		return UTF8LITE_ERROR_NOMEM;
 	}
-	map->text.ptr = ptr;
+	map->buf = buf;
+	map->size_max = size_max;
+	return 0;
+}
 
-	if (size > SIZE_MAX / UTF8LITE_UNICODE_DECOMP_MAX) {
-		return UTF8LITE_ERROR_OVERFLOW;
+
+int utf8lite_textmap_reserve_codes(struct utf8lite_textmap *map, size_t n)
+{
+	int32_t *codes = map->codes;
+	size_t ncode_max = map->ncode_max;
+
+	if (ncode_max >= n) {
+		return 0;
+	}
+
+	if (!ncode_max) {
+		ncode_max = TEXTMAP_NCODE_INIT;
+	}
+	while (ncode_max < n) {
+		if (ncode_max > SIZE_MAX / (2 * sizeof(*codes))) {
+			return UTF8LITE_ERROR_OVERFLOW;
+		}
+		ncode_max *= 2;
 	}
 
-	if (!(codes = realloc(codes, size * UTF8LITE_UNICODE_DECOMP_MAX))) {
+	if (!(codes = realloc(codes, ncode_max * sizeof(*codes)))) {
 		return UTF8LITE_ERROR_NOMEM;
 	}
 	map->codes = codes;
-
-	map->size_max = size;
+	map->ncode_max = ncode_max;
 	return 0;
 }
 
@@ -130,56 +201,333 @@ int utf8lite_textmap_set(struct utf8lite_textmap *map,
 		       const struct utf8lite_text *text)
 {
 	struct utf8lite_text_iter it;
-	size_t size = UTF8LITE_TEXT_SIZE(text);
-	int32_t *dst;
-	int err;
+	struct textmap_state st;
+	int err, run_start = 1, esc = UTF8LITE_TEXT_HAS_ESC(text);
+
+	if (utf8lite_textmap_isfixed(map, text)) {
+		map->text = *text;
+		return 0;
+	}
 
 	if (utf8lite_text_isascii(text)) {
 		return utf8lite_textmap_set_ascii(map, text);
 	}
 
-	// For most inputs, mapping to type reduces or preserves the size.
-	// However, for U+0390 and U+03B0, case folding triples the size.
-	// (You can verify this with util/compute-typelen.py)
-	//
-	// Add one for a trailing NUL.
-	if (size > ((SIZE_MAX - 1) / 3)) {
+	st.len = 0;
+	st.safe = 0;
+	st.mark = 0;
+	st.size = 0;
+	st.attr = UTF8LITE_TEXT_ASCII_BIT;
+
+	utf8lite_text_iter_make(&it, text);
+	for (;;) {
+		if (run_start && !esc && it.ptr != it.end
+				&& !(*it.ptr & 0x80)) {
+			if ((err = utf8lite_textmap_skip_ascii(map, &st,
+							       &it.ptr,
+							       it.end))) {
+				goto out;
+			}
+		}
+
+		if (!utf8lite_text_iter_advance(&it)) {
+			break;
+		}
+		run_start = !UTF8LITE_IS_ASCII(it.current);
+
+		if ((err = utf8lite_textmap_push(map, &st, it.current))) {
+			goto out;
+		}
+	}
+
+	err = utf8lite_textmap_finish(map, &st);
+
+out:
+	return err;
+}
+
+
+int utf8lite_textmap_set_utf8(struct utf8lite_textmap *map,
+			      const uint8_t *ptr, size_t size,
+			      struct utf8lite_message *msg)
+{
+	struct utf8lite_text text;
+	struct textmap_state st;
+	const uint8_t *begin = ptr, *end = ptr + size, *bound, *nonascii;
+	const uint8_t *start;
+	int32_t code;
+	uint8_t cl = 0;
+	int err, run_start;
+
+	if (size > UTF8LITE_TEXT_SIZE_MAX) {
 		err = UTF8LITE_ERROR_OVERFLOW;
-		goto out;
+		utf8lite_message_set(msg, "text size (%"PRIu64" bytes)"
+				     " exceeds maximum (%"PRIu64" bytes)",
+				     (uint64_t)size,
+				     (uint64_t)UTF8LITE_TEXT_SIZE_MAX);
+		goto error;
 	}
 
-	if ((err = utf8lite_textmap_reserve(map, 3 * size + 1))) {
-		goto out;
+	// ASCII needs no validation or decoding
+	nonascii = utf8lite_find_nonascii(begin, end);
+	if (nonascii == end) {
+		text.ptr = (uint8_t *)begin;
+		text.attr = UTF8LITE_TEXT_ASCII_BIT | size;
+		if (!(map->type & UTF8LITE_TEXTMAP_CASE)) {
+			map->text = text;
+			return 0;
+		}
+		return utf8lite_textmap_set_ascii(map, &text);
 	}
 
-	dst = map->codes;
-	utf8lite_text_iter_make(&it, text);
-	while (utf8lite_text_iter_advance(&it)) {
-		utf8lite_map(map->charmap_type, it.current, &dst);
+	// Check the input while it stays unchanged, remembering the start
+	// of the last character with a boundary before it. Only case
+	// folding changes ASCII, so skip the ASCII prefix otherwise.
+	bound = begin;
+	if (!(map->type & UTF8LITE_TEXTMAP_CASE)) {
+		ptr = nonascii;
+		if (ptr != begin) {
+			bound = ptr - 1;
+		}
 	}
 
-	size = (size_t)(dst - map->codes);
-	utf8lite_order(map->codes, size);
-	utf8lite_compose(map->codes, &size);
+	while (ptr != end) {
+		start = ptr;
+		if (utf8lite_textmap_decode(&ptr, end, &code)) {
+			goto inval;
+		}
+		if (!utf8lite_textmap_keeps(map, code, &cl)) {
+			goto map;
+		}
+		if (cl == 0 && utf8lite_normal_boundary(code)) {
+			bound = start;
+		}
+	}
 
-	if ((err = utf8lite_textmap_set_utf32(map, map->codes,
-					      map->codes + size))) {
-		goto out;
+	map->text.ptr = (uint8_t *)begin;
+	map->text.attr = size;
+	return 0;
+
+map:
+	// The input before the boundary is unchanged, and nothing after
+	// the boundary interacts with it; copy it and map the rest.
+	st.len = 0;
+	st.safe = 0;
+	st.mark = 0;
+	st.size = (size_t)(bound - begin);
+	st.attr = bound > nonascii ? 0 : UTF8LITE_TEXT_ASCII_BIT;
+
+	if ((err = utf8lite_textmap_reserve(map, st.size))) {
+		goto error;
+	}
+	if (st.size) {
+		memcpy(map->buf, begin, st.size);
 	}
 
-out:
+	ptr = bound;
+	run_start = 1;
+	while (ptr != end) {
+		if (run_start && !(*ptr & 0x80)) {
+			if ((err = utf8lite_textmap_skip_ascii(map, &st, &ptr,
+							       end))) {
+				goto error;
+			}
+		}
+
+		start = ptr;
+		if (utf8lite_textmap_decode(&ptr, end, &code)) {
+			goto inval;
+		}
+		run_start = !UTF8LITE_IS_ASCII(code);
+
+		if ((err = utf8lite_textmap_push(map, &st, code))) {
+			goto error;
+		}
+	}
+
+	if ((err = utf8lite_textmap_finish(map, &st))) {
+		goto error;
+	}
+	return 0;
+
+inval:
+	// report the same error as utf8lite_text_assign()
+	err = utf8lite_scan_utf8(&start, end, msg);
+	assert(err == UTF8LITE_ERROR_INVAL);
+	utf8lite_message_append(msg, " at position %"PRIu64,
+				(uint64_t)(start - begin + 1));
+
+error:
+	map->text.ptr = NULL;
+	map->text.attr = 0;
 	return err;
 }
 
 
-int utf8lite_textmap_set_utf32(struct utf8lite_textmap *map, const int32_t *ptr,
-			     const int32_t *end)
+/*
+ * Decode and validate a UTF-8 character.
+ */
+int utf8lite_textmap_decode(const uint8_t **bufptr, const uint8_t *end,
+			    int32_t *codeptr)
+{
+	const uint8_t *ptr = *bufptr;
+	unsigned state = UTF8LITE_DFA_ACCEPT;
+
+	do {
+		if (ptr == end) {
+			return UTF8LITE_ERROR_INVAL;
+		}
+		state = utf8lite_dfa_step(state, codeptr, *ptr++);
+	} while (state > UTF8LITE_DFA_REJECT);
+
+	if (state == UTF8LITE_DFA_REJECT) {
+		return UTF8LITE_ERROR_INVAL;
+	}
+
+	*bufptr = ptr;
+	return 0;
+}
+
+
+/*
+ * Map a character into the scratch buffer. Reordering and composition
+ * never cross a normalization boundary, so when the buffer fills up,
+ * flush everything before the last boundary. The buffer only grows for a
+ * run of characters with no boundary.
+ */
+int utf8lite_textmap_push(struct utf8lite_textmap *map,
+			  struct textmap_state *st, int32_t code)
+{
+	int32_t *dst;
+	size_t start;
+	int err;
+
+	if (st->len + UTF8LITE_UNICODE_DECOMP_MAX > map->ncode_max) {
+		if (st->safe > 0) {
+			if ((err = utf8lite_textmap_flush(map, st, st->safe))) {
+				return err;
+			}
+		}
+		if ((err = utf8lite_textmap_reserve_codes(map,
+				st->len + UTF8LITE_UNICODE_DECOMP_MAX))) {
+			return err;
+		}
+	}
+
+	start = st->len;
+	dst = map->codes + start;
+	utf8lite_map(map->charmap_type, code, &dst);
+	st->len = (size_t)(dst - map->codes);
+
+	if (start < st->len && utf8lite_normal_boundary(map->codes[start])) {
+		st->safe = start;
+	}
+
+	// look for the first code that reordering or composition might
+	// change; until there is one, flushing can skip those steps
+	if (st->mark == start) {
+		while (st->mark < st->len
+				&& utf8lite_normal_boundary(map->codes[st->mark])) {
+			st->mark++;
+		}
+	}
+
+	return 0;
+}
+
+
+/*
+ * Copy a long run of unescaped ASCII, starting at `*bufptr`, straight to
+ * the output. ASCII characters are normalization boundaries, but the last
+ * one in the run might compose with what follows, so leave that one for
+ * the character map.
+ */
+int utf8lite_textmap_skip_ascii(struct utf8lite_textmap *map,
+				struct textmap_state *st,
+				const uint8_t **bufptr, const uint8_t *end)
+{
+	const uint8_t *ptr = *bufptr;
+	const uint8_t *run = utf8lite_find_nonascii(ptr, end);
+	int err;
+
+	if (run - ptr <= TEXTMAP_ASCII_RUN) {
+		return 0;
+	}
+
+	if ((err = utf8lite_textmap_flush(map, st, st->len))) {
+		return err;
+	}
+
+	if ((err = utf8lite_textmap_append_ascii(map, ptr,
+						 (size_t)(run - 1 - ptr),
+						 &st->size))) {
+		return err;
+	}
+
+	*bufptr = run - 1;
+	return 0;
+}
+
+
+int utf8lite_textmap_finish(struct utf8lite_textmap *map,
+			    struct textmap_state *st)
+{
+	int err;
+
+	if ((err = utf8lite_textmap_flush(map, st, st->len))) {
+		return err;
+	}
+
+	if ((err = utf8lite_textmap_reserve(map, st->size + 1))) {
+		return err;
+	}
+
+	map->buf[st->size] = '\0'; // not necessary, but helps with debugging
+	map->text.ptr = map->buf;
+	map->text.attr = st->attr | (UTF8LITE_TEXT_SIZE_MASK & st->size);
+	return 0;
+}
+
+
+/*
+ * Reorder and compose the first `n` codes in the scratch buffer, which
+ * must end at a normalization boundary, append the result to the output
+ * buffer, and drop them from the scratch buffer. Starters that do not
+ * combine backward are left alone by both steps, so text made up of
+ * only those skips them.
+ */
+int utf8lite_textmap_flush(struct utf8lite_textmap *map,
+			   struct textmap_state *st, size_t n)
 {
 	int map_quote = map->type & UTF8LITE_TEXTMAP_QUOTE;
 	int rm_di = map->type & UTF8LITE_TEXTMAP_RMDI;
-	uint8_t *dst = map->text.ptr;
+	const int32_t *ptr, *end;
+	size_t len = n, attr = st->attr;
+	uint8_t *dst;
 	int32_t code;
 	int8_t ch;
+	int err;
+
+	if (n == 0) {
+		return 0;
+	}
+
+	if (st->mark < n) {
+		utf8lite_order(map->codes, len);
+		utf8lite_compose(map->codes, &len);
+	}
+
+	// each code takes at most 4 bytes
+	if (len > (SIZE_MAX - st->size) / 4) {
+		return UTF8LITE_ERROR_OVERFLOW;
+	}
+	if ((err = utf8lite_textmap_reserve(map, st->size + 4 * len))) {
+		return err;
+	}
+
+	ptr = map->codes;
+	end = ptr + len;
+	dst = map->buf + st->size;
 
 	while (ptr != end) {
 		code = *ptr++;
@@ -209,12 +557,31 @@ int utf8lite_textmap_set_utf32(struct utf8lite_textmap *map, const int32_t *ptr,
 				break;
 			}
 		}
+		if (!UTF8LITE_IS_ASCII(code)) {
+			attr = 0;
+		}
 		utf8lite_encode_utf8(code, &dst);
 	}
 
-	*dst = '\0'; // not necessary, but helps with debugging
-	map->text.attr = (UTF8LITE_TEXT_SIZE_MASK
-			  & ((size_t)(dst - map->text.ptr)));
+	st->size = (size_t)(dst - map->buf);
+	st->attr = attr;
+
+	st->len -= n;
+	if (st->len) {
+		memmove(map->codes, map->codes + n,
+			st->len * sizeof(*map->codes));
+	}
+	st->safe = 0;
+
+	if (st->mark >= n) {
+		st->mark -= n;
+	} else {
+		st->mark = 0;
+		while (st->mark < st->len
+				&& utf8lite_normal_boundary(map->codes[st->mark])) {
+			st->mark++;
+		}
+	}
 	return 0;
 }
 
@@ -234,7 +601,18 @@ int utf8lite_textmap_set_ascii(struct utf8lite_textmap *map,
 		goto error;
 	}
 
-	dst = map->text.ptr;
+	if (!UTF8LITE_TEXT_HAS_ESC(text)) {
+		size = 0;
+		if ((err = utf8lite_textmap_append_ascii(map, text->ptr,
+						UTF8LITE_TEXT_SIZE(text),
+						&size))) {
+			goto error;
+		}
+		dst = map->buf + size;
+		goto out;
+	}
+
+	dst = map->buf;
 
 	utf8lite_text_iter_make(&it, text);
 	while (utf8lite_text_iter_advance(&it)) {
@@ -244,11 +622,192 @@ int utf8lite_textmap_set_ascii(struct utf8lite_textmap *map,
 		}
 	}
 
+out:
 	*dst = '\0'; // not necessary, but helps with debugging
-	map->text.attr = (UTF8LITE_TEXT_SIZE_MASK
-			  & ((size_t)(dst - map->text.ptr)));
+	map->text.ptr = map->buf;
+	map->text.attr = UTF8LITE_TEXT_ASCII_BIT | (UTF8LITE_TEXT_SIZE_MASK
+				 & ((size_t)(dst - map->buf)));
 	return 0;
 
 error:
 	return err;
 }
+
+
+/*
+ * Test whether the map leaves the text unchanged. This only looks at
+ * the text, so it is much faster than mapping when most inputs are
+ * already normalized.
+ */
+int utf8lite_textmap_isfixed(const struct utf8lite_textmap *map,
+			     const struct utf8lite_text *text)
+{
+	struct utf8lite_text_iter it;
+	uint8_t cl = 0;
+
+	// the output never has escapes, so escaped input must change
+	if (UTF8LITE_TEXT_HAS_ESC(text)) {
+		return 0;
+	}
+
+	utf8lite_text_iter_make(&it, text);
+	while (utf8lite_text_iter_advance(&it)) {
+		if (!utf8lite_textmap_keeps(map, it.current, &cl)) {
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+
+/*
+ * Quick check whether the map leaves a character unchanged; see
+ * utf8lite_normal_check() for `clptr`.
+ */
+int utf8lite_textmap_keeps(const struct utf8lite_textmap *map, int32_t code,
+			   uint8_t *clptr)
+{
+	// the map sends ASCII through the ASCII table, not the character
+	// map, so check it against the same table
+	if (code <= 0x7F) {
+		*clptr = 0;
+		return map->ascii_map[code] == code;
+	}
+
+	if (!utf8lite_normal_check(code, map->charmap_type, clptr)) {
+		return 0;
+	}
+
+	switch (code) {
+	case 0x055A: // ARMENIAN APOSTROPHE
+	case 0x2018: // LEFT SINGLE QUOTATION MARK
+	case 0x2019: // RIGHT SINGLE QUOTATION MARK
+	case 0x201B: // SINGLE HIGH-REVERSED-9 QUOTATION MARK
+	case 0xFF07: // FULLWIDTH APOSTROPHE
+		return !(map->type & UTF8LITE_TEXTMAP_QUOTE);
+
+	default:
+		return !((map->type & UTF8LITE_TEXTMAP_RMDI)
+			 && utf8lite_isignorable(code));
+	}
+}
+
+
+/*
+ * Append unescaped ASCII text to the output buffer, which has `*sizeptr`
+ * bytes. The ASCII map is either the identity or lower-casing.
+ */
+int utf8lite_textmap_append_ascii(struct utf8lite_textmap *map,
+				  const uint8_t *ptr, size_t n,
+				  size_t *sizeptr)
+{
+	int err;
+
+	if (n > SIZE_MAX - *sizeptr) {
+		return UTF8LITE_ERROR_OVERFLOW;
+	}
+	if ((err = utf8lite_textmap_reserve(map, *sizeptr + n))) {
+		return err;
+	}
+
+	if (map->type & UTF8LITE_TEXTMAP_CASE) {
+		lower_ascii(map->buf + *sizeptr, ptr, n);
+	} else if (n) {
+		memcpy(map->buf + *sizeptr, ptr, n);
+	}
+
+	*sizeptr += n;
+	return 0;
+}
+
+
+/*
+ * Lower-case ASCII kernels. The input must be all ASCII; the kernels add
+ * 0x20 to the bytes in the range 'A'-'Z'.
+ */
+
+static void lower_scalar(uint8_t *dst, const uint8_t *src, size_t n)
+{
+	const uint64_t high = UINT64_C(0x8080808080808080);
+	uint64_t word, ge_a, gt_z;
+
+	// a byte's high bit is set after the add iff it is >= 'A'
+	// (resp. > 'Z'); the bytes are ASCII, so no add carries over
+	while (n >= 8) {
+		memcpy(&word, src, sizeof(word));
+		ge_a = word + UINT64_C(0x3F3F3F3F3F3F3F3F);
+		gt_z = word + UINT64_C(0x2525252525252525);
+		word |= ((ge_a & ~gt_z) & high) >> 2;
+		memcpy(dst, &word, sizeof(word));
+		src += 8;
+		dst += 8;
+		n -= 8;
+	}
+
+	while (n-- > 0) {
+		*dst++ = (uint8_t)((*src >= 'A' && *src <= 'Z')
+				   ? *src + ('a' - 'A') : *src);
+		src++;
+	}
+}
+
+
+#ifdef UTF8LITE_HAVE_SSE2
+
+static void lower_sse2(uint8_t *dst, const uint8_t *src, size_t n)
+{
+	const __m128i before_a = _mm_set1_epi8('A' - 1);
+	const __m128i after_z = _mm_set1_epi8('Z' + 1);
+	const __m128i delta = _mm_set1_epi8('a' - 'A');
+	__m128i block, upper;
+
+	// ASCII bytes are non-negative, so the signed compares work
+	while (n >= 16) {
+		block = _mm_loadu_si128((const __m128i *)src);
+		upper = _mm_and_si128(_mm_cmpgt_epi8(block, before_a),
+				      _mm_cmplt_epi8(block, after_z));
+		block = _mm_add_epi8(block, _mm_and_si128(upper, delta));
+		_mm_storeu_si128((__m128i *)dst, block);
+		src += 16;
+		dst += 16;
+		n -= 16;
+	}
+
+	lower_scalar(dst, src, n);
+}
+
+#endif /* UTF8LITE_HAVE_SSE2 */
+
+
+#ifdef UTF8LITE_HAVE_AVX2
+
+UTF8LITE_TARGET_AVX2
+static void lower_avx2(uint8_t *dst, const uint8_t *src, size_t n)
+{
+	const __m256i before_a = _mm256_set1_epi8('A' - 1);
+	const __m256i after_z = _mm256_set1_epi8('Z' + 1);
+	const __m256i delta = _mm256_set1_epi8('a' - 'A');
+	__m256i block, upper;
+
+	while (n >= 32) {
+		block = _mm256_loadu_si256((const __m256i *)src);
+		upper = _mm256_and_si256(_mm256_cmpgt_epi8(block, before_a),
+					 _mm256_cmpgt_epi8(after_z, block));
+		block = _mm256_add_epi8(block, _mm256_and_si256(upper, delta));
+		_mm256_storeu_si256((__m256i *)dst, block);
+		src += 32;
+		dst += 32;
+		n -= 32;
+	}
+
+	lower_sse2(dst, src, n);
+}
+
+#endif /* UTF8LITE_HAVE_AVX2 */
+
+
+void lower_ascii(uint8_t *dst, const uint8_t *src, size_t n)
+{
+	UTF8LITE_SIMD_KERNEL(lower)(dst, src, n);
+}
@@ -403,6 +403,36 @@ void utf8lite_order(int32_t *ptr, size_t len);
  */
 void utf8lite_compose(int32_t *ptr, size_t *lenptr);
 
+/**
+ * Get whether there is a normalization boundary before a fully-decomposed
+ * Unicode character: the character has canonical combining class 0 and
+ * never composes with a preceding character. Neither utf8lite_order()
+ * nor utf8lite_compose() act across such a boundary, so the codepoints
+ * on either side of it can get normalized separately.
+ *
+ * \param code the codepoint
+ *
+ * \returns 1 if there is a boundary before the character, 0 otherwise
+ */
+int utf8lite_normal_boundary(int32_t code);
+
+/**
+ * Quick check whether a character can appear unchanged in the output of
+ * utf8lite_map() followed by utf8lite_order() and utf8lite_compose().
+ * Call this for each character of a string in turn, starting with
+ * `*clptr` set to 0; the string is in normal form if every call succeeds.
+ *
+ * \param code the codepoint
+ * \param type the map type, a bitmask of #utf8lite_decomp_type and
+ * 	#utf8lite_casefold_type values
+ * \param clptr on entry, the canonical combining class of the previous
+ * 	character; on exit, the combining class of this character
+ *
+ * \returns 1 if the character passes the check, 0 if it fails or
+ * 	if deciding would take a full normalization
+ */
+int utf8lite_normal_check(int32_t code, int type, uint8_t *clptr);
+
 /**@}*/
 
 /**
@@ -414,10 +444,17 @@ void utf8lite_compose(int32_t *ptr, size_t *lenptr);
  * interpreted as an escape */
 #define UTF8LITE_TEXT_ESC_BIT	((size_t)1 << (CHAR_BIT * sizeof(size_t) - 1))
 
+/** Whether the text is known to decode to ASCII; utf8lite_text_assign()
+ *  sets this bit whenever the text is ASCII and has no escapes that decode
+ *  to non-ASCII codepoints */
+#define UTF8LITE_TEXT_ASCII_BIT	((size_t)1 << (CHAR_BIT * sizeof(size_t) - 2))
+
 /** Size of the encoded text, in bytes; (decoded size) <= (encoded size) */
-#define UTF8LITE_TEXT_SIZE_MASK	((size_t)SIZE_MAX >> 1)
+#define UTF8LITE_TEXT_SIZE_MASK	((size_t)SIZE_MAX >> 2)
 
-/** Maximum size of encode text, in bytes. */
+/** Maximum size of encode text, in bytes. On 32-bit platforms this is
+ *  1 GiB, so utf8lite_text_assign() fails with #UTF8LITE_ERROR_OVERFLOW
+ *  for some strings that R can hold. */
 #define UTF8LITE_TEXT_SIZE_MAX	UTF8LITE_TEXT_SIZE_MASK
 
 /** The encoded size of the text, in bytes */
@@ -485,10 +522,27 @@ int utf8lite_text_init_copy(struct utf8lite_text *text,
 
 /** Indicates whether the text definitely decodes to ASCII. For this to be true,
  *  the text must be encoded in ASCII and not have any escapes that decode to
- *  non-ASCII codepoints.
+ *  non-ASCII codepoints. This tests the #UTF8LITE_TEXT_ASCII_BIT attribute,
+ *  so it takes constant time.
  */
 int utf8lite_text_isascii(const struct utf8lite_text *text);
 
+/**
+ * Quick check whether text is already in normal form, so that applying
+ * utf8lite_map() with the given type followed by utf8lite_order() and
+ * utf8lite_compose() would leave it unchanged. This uses the NFC_QC and
+ * NFKC_QC properties, as described in
+ * [UAX #15 Sec. 9](http://www.unicode.org/reports/tr15/#Detecting_Normalization_Forms).
+ *
+ * \param text the text
+ * \param type a bitmask composed from #utf8lite_decomp_type and
+ * 	#utf8lite_casefold_type values specifying the mapping type
+ *
+ * \returns 1 if the text is in normal form, 0 if it is not or if that
+ * 	cannot be decided without normalizing it
+ */
+int utf8lite_text_isnormal(const struct utf8lite_text *text, int type);
+
 /**
  * Free the resources associated with a text object.
  *
@@ -636,12 +690,17 @@ enum utf8lite_textmap_type {
  */
 struct utf8lite_textmap {
 	struct utf8lite_text text;/**< result of the most recent call to
-				    utf8lite_textmap_set() */
+				    utf8lite_textmap_set(); this points to
+				    the input when the map leaves it
+				    unchanged */
 	int8_t ascii_map[128];	/**< a lookup table for the mappings of ASCII
 				  characters; -1 indicates deletion */
+	uint8_t *buf;		/**< buffer for the mapped text */
 	int32_t *codes;		/**< buffer for intermediate UTF-32 decoding */
-	size_t size_max;	/**< text size maximum; normalizing a larger
-				 	text will force a reallocation */
+	size_t size_max;	/**< capacity of the mapped text buffer, in
+				  bytes */
+	size_t ncode_max;	/**< capacity of the UTF-32 buffer, in
+				  codepoints */
 	int type;		/**< the map type descriptor, a bit mask
 				  of #utf8lite_textmap_type values */
 	int charmap_type;	/**< the unicode map type, a bit mask of
@@ -668,7 +727,21 @@ int utf8lite_textmap_init(struct utf8lite_textmap *map, int type);
 void utf8lite_textmap_destroy(struct utf8lite_textmap *map);
 
 /**
- * Given input text, set a map to the corresponding output text.
+ * Change the kind of a text map, keeping its buffers.
+ *
+ * \param map the text map
+ * \param type a bitmask of #utf8lite_textmap_type values, specifying
+ * 	the map type
+ *
+ * \returns 0 on success
+ */
+int utf8lite_textmap_set_type(struct utf8lite_textmap *map, int type);
+
+/**
+ * Given input text, set a map to the corresponding output text. If the
+ * text is already in normal form for the map type, then the output
+ * aliases the input, without copying it; in this case `map->text.ptr`
+ * equals `text->ptr`, and the output is only valid while the input is.
  *
  * \param map the text map
  * \param text the text
@@ -678,6 +751,26 @@ void utf8lite_textmap_destroy(struct utf8lite_textmap *map);
 int utf8lite_textmap_set(struct utf8lite_textmap *map,
 			 const struct utf8lite_text *text);
 
+/**
+ * Validate UTF-8 input and set a map to the corresponding output text, in
+ * a single pass over the input. The result is the same as calling
+ * utf8lite_text_assign() with no flags, then utf8lite_textmap_set().
+ * As with that function, the output aliases the input when the map leaves
+ * it unchanged, except that case folding always copies ASCII input.
+ *
+ * \param map the text map
+ * \param ptr a pointer to the input bytes
+ * \param size the number of input bytes
+ * \param msg an error message buffer, or NULL
+ *
+ * \returns 0 on success, #UTF8LITE_ERROR_INVAL for invalid UTF-8 (with
+ * 	the position of the error in the message), or another error code
+ * 	on failure
+ */
+int utf8lite_textmap_set_utf8(struct utf8lite_textmap *map,
+			      const uint8_t *ptr, size_t size,
+			      struct utf8lite_message *msg);
+
 /**@}*/
 
 /**
@@ -748,6 +841,24 @@ void utf8lite_graphscan_reset(struct utf8lite_graphscan *scan);
  */
 void utf8lite_graphscan_skip(struct utf8lite_graphscan *scan);
 
+/**
+ * Find a grapheme boundary at or after a given position that does not
+ * depend on the surrounding context: the graphemes of the text are the
+ * graphemes before the boundary followed by those after it. Scanning
+ * the two halves separately gives the same results as scanning the
+ * whole text, so this is a safe place to split a text for parallel
+ * processing.
+ *
+ * \param text a text without escapes
+ * \param ptr a position in the text, not necessarily at the start
+ * 	of a character
+ *
+ * \returns the boundary, or the end of the text if there is no
+ * 	context-free boundary after `ptr` (or if the text has escapes)
+ */
+const uint8_t *utf8lite_graph_boundary(const struct utf8lite_text *text,
+				       const uint8_t *ptr);
+
 /**@}*/
 
 /**
@@ -851,14 +962,136 @@ enum utf8lite_encode_type {
 int utf8lite_graph_measure(const struct utf8lite_graph *g, int flags,
 			   int *widthptr);
 
+/**
+ * Get the width of a text under the specified render settings, stopping
+ * once the width exceeds a limit. The width is the sum of the widths
+ * that utf8lite_graph_measure() reports for the text's graphemes, but
+ * this function segments and measures the text in a single pass.
+ *
+ * \param text the text
+ * \param flags a bitmask of #utf8lite_escape_type and #utf8lite_encode_type
+ * 			values specifying the encoding settings
+ * \param limit the maximum width
+ * \param widthptr if non-NULL, a pointer to store the width on exit:
+ * 	-1 if a grapheme with width -1 comes before the limit gets
+ * 	exceeded; for #UTF8LITE_ERROR_RANGE, the width of the longest
+ * 	leading sequence of graphemes that fits within the limit
+ *
+ * \returns 0 on success, #UTF8LITE_ERROR_RANGE if the width exceeds
+ * 	`limit`, or #UTF8LITE_ERROR_OVERFLOW if a grapheme width exceeds
+ * 	`INT_MAX`
+ */
+int utf8lite_text_width(const struct utf8lite_text *text, int flags,
+			int limit, int *widthptr);
+
+/**
+ * Width index for a text, for truncating the same text to several
+ * widths. The index records the byte offset of every `step`-th grapheme
+ * and the width of the text before it. Graphemes with width -1 count as
+ * zero in these widths; the index remembers where they are.
+ */
+struct utf8lite_widthindex {
+	struct utf8lite_text text;	/**< the indexed text */
+	int flags;		/**< the width flags, a bitmask of
+				  #utf8lite_escape_type and
+				  #utf8lite_encode_type values */
+	int step;		/**< the number of graphemes between
+				  samples */
+	int width;		/**< the total width, counting graphemes
+				  with width -1 as zero */
+	size_t *offset;		/**< the byte offset of each sample; the
+				  last sample is the end of the text */
+	int *cumwidth;		/**< the width before each sample */
+	int nsample;		/**< the number of samples */
+	int nbad;		/**< the number of graphemes with width -1 */
+	size_t bad_begin;	/**< the byte offset of the first grapheme
+				  with width -1 */
+	size_t bad_end;		/**< the byte offset of the end of the last
+				  grapheme with width -1 */
+};
+
+/**
+ * Build a width index for a text. The index refers to the text's data,
+ * so the data must outlive it.
+ *
+ * \param index the index
+ * \param text the text
+ * \param flags a bitmask of #utf8lite_escape_type and #utf8lite_encode_type
+ * 			values specifying the encoding settings
+ * \param step the number of graphemes between samples (positive)
+ *
+ * \returns 0 on success, #UTF8LITE_ERROR_INVAL if `step` is not
+ * 	positive, #UTF8LITE_ERROR_OVERFLOW if the width exceeds `INT_MAX`,
+ * 	or #UTF8LITE_ERROR_NOMEM on memory allocation failure
+ */
+int utf8lite_widthindex_init(struct utf8lite_widthindex *index,
+			     const struct utf8lite_text *text, int flags,
+			     int step);
+
+/**
+ * Release the resources associated with a width index.
+ *
+ * \param index the index
+ */
+void utf8lite_widthindex_destroy(struct utf8lite_widthindex *index);
+
+/**
+ * Find the longest leading sequence of graphemes that fits within a
+ * width, with the same result as utf8lite_text_width() but without
+ * scanning the text from the start.
+ *
+ * \param index the index
+ * \param limit the maximum width
+ * \param sizeptr on exit, the size in bytes of the leading graphemes;
+ * 	if a grapheme with width -1 comes first, the size of the text
+ * 	before it
+ * \param widthptr on exit, the width of the leading graphemes, or -1 if
+ * 	a grapheme with width -1 comes before the limit gets exceeded
+ *
+ * \returns 0 if the whole text fits or has width -1, or
+ * 	#UTF8LITE_ERROR_RANGE if it does not fit
+ */
+int utf8lite_widthindex_prefix(const struct utf8lite_widthindex *index,
+			       int limit, size_t *sizeptr, int *widthptr);
+
+/**
+ * Find the longest trailing sequence of graphemes that fits within a
+ * width, measuring back from the end of the text.
+ *
+ * \param index the index
+ * \param limit the maximum width
+ * \param beginptr on exit, the byte offset where the trailing
+ * 	graphemes start; if a grapheme with width -1 comes first (from
+ * 	the end), the offset of the text after it
+ * \param widthptr on exit, the width of the trailing graphemes, or -1
+ * 	if a grapheme with width -1 comes before the limit gets exceeded
+ *
+ * \returns 0 if the whole text fits or has width -1, or
+ * 	#UTF8LITE_ERROR_RANGE if it does not fit
+ */
+int utf8lite_widthindex_suffix(const struct utf8lite_widthindex *index,
+			       int limit, size_t *beginptr, int *widthptr);
+
+/**
+ * Callback for writing out rendered bytes.
+ *
+ * \param context the context passed to utf8lite_render_set_flush()
+ * \param bytes the rendered bytes (not null terminated)
+ * \param size the number of bytes
+ *
+ * \returns 0 on success, or an #utf8lite_error_type code on failure
+ */
+typedef int (*utf8lite_render_flush_func)(void *context, const char *bytes,
+					  size_t size);
+
 /**
  * Renderer, for printing objects as strings.
  */
 struct utf8lite_render {
 	char *string;		/**< the rendered string (null terminated) */
-	int length;		/**< the length of the rendered string, not
+	size_t length;		/**< the length of the rendered string, not
 				  including the null terminator */
-	int length_max;		/**< the maximum capacity of the rendered
+	size_t length_max;	/**< the maximum capacity of the rendered
 				  string before requiring reallocation, not
 				  including the null terminator */
 	int flags;		/**< the flags, a bitmask of
@@ -888,6 +1121,10 @@ struct utf8lite_render {
 	int indent;		/**< the current indent level */
 	int needs_indent;	/**< whether to indent before the next
 				  character */
+	utf8lite_render_flush_func flush; /**< the callback for writing out
+				  the rendered string, or NULL to keep
+				  all of it in memory */
+	void *flush_context;	/**< the context for the flush callback */
 	int error;		/**< the code for the last error that
 				  occurred, or zero if none */
 };
@@ -912,8 +1149,9 @@ void utf8lite_render_destroy(struct utf8lite_render *r);
 
 /**
  * Reset the render object to the empty string and set the indent level to 0.
- * Leave the escape flags, the tab, and the newline string at their current
- * values.
+ * Leave the escape flags, the tab, the newline string, and the flush
+ * callback at their current values. Discard any output that has not been
+ * flushed.
  *
  * \param r the render object
  */
@@ -967,6 +1205,46 @@ int utf8lite_render_set_newline(struct utf8lite_render *r, const char *newline);
 int utf8lite_render_set_style(struct utf8lite_render *r,
 			      const char *open, const char *close);
 
+/**
+ * Make room in the render buffer for at least `size` more bytes, so that
+ * rendering them does not need to reallocate.
+ *
+ * \param r the render object
+ * \param size the number of bytes
+ *
+ * \returns 0 on success
+ */
+int utf8lite_render_reserve(struct utf8lite_render *r, size_t size);
+
+/**
+ * Stream the rendered output through a callback instead of keeping all of
+ * it in memory. Once the buffer holds `size` bytes, the next write passes
+ * the buffered string to `flush` and starts over with an empty buffer;
+ * writes that do not fit in the buffer go to `flush` directly. Call
+ * utf8lite_render_flush() after the last write to pass on the rest.
+ *
+ * \param r the render object
+ * \param flush the callback, or NULL to go back to keeping the output in
+ * 	`r->string`
+ * \param context the context to pass to the callback
+ * \param size the buffer size, in bytes
+ *
+ * \returns 0 on success
+ */
+int utf8lite_render_set_flush(struct utf8lite_render *r,
+			      utf8lite_render_flush_func flush,
+			      void *context, size_t size);
+
+/**
+ * Pass the buffered output to the flush callback and empty the buffer.
+ * Do nothing if there is no callback.
+ *
+ * \param r the render object
+ *
+ * \returns 0 on success, or the error code from the callback
+ */
+int utf8lite_render_flush(struct utf8lite_render *r);
+
 /**
  * Increase or decrease the indent level.
  *
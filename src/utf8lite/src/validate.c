@@ -0,0 +1,371 @@
+/*
+ * Copyright 2017 Patrick O. Perry.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "private/simd.h"
+#include "private/utf8dfa.h"
+#include "private/validate.h"
+#include "utf8lite.h"
+
+static const uint8_t *find_invalid(const uint8_t *ptr, const uint8_t *end);
+
+
+const uint8_t *utf8lite_find_invalid_utf8(const uint8_t *ptr,
+					  const uint8_t *end)
+{
+	return find_invalid(ptr, end);
+}
+
+
+const uint8_t *utf8lite_find_nonascii(const uint8_t *ptr,
+				      const uint8_t *end)
+{
+#ifdef UTF8LITE_HAVE_SSE2
+	__m128i block;
+
+	while (end - ptr >= 16) {
+		block = _mm_loadu_si128((const __m128i *)ptr);
+		if (_mm_movemask_epi8(block)) {
+			break;
+		}
+		ptr += 16;
+	}
+#else
+	uint64_t word;
+
+	while (end - ptr >= 8) {
+		memcpy(&word, ptr, sizeof(word));
+		if (word & UINT64_C(0x8080808080808080)) {
+			break;
+		}
+		ptr += 8;
+	}
+#endif
+	while (ptr != end && !(*ptr & 0x80)) {
+		ptr++;
+	}
+
+	return ptr;
+}
+
+
+/*
+ * Run the state machine over a run of non-ASCII characters, stopping at
+ * the next ASCII character. On success, return the end of the run; on failure, return
+ * the start of the invalid character.
+ */
+static const uint8_t *validate_run(const uint8_t *ptr, const uint8_t *end,
+				   int *okptr)
+{
+	const uint8_t *start = ptr;
+	unsigned state = UTF8LITE_DFA_ACCEPT;
+
+	while (ptr != end) {
+		if (state == UTF8LITE_DFA_ACCEPT) {
+			if (!(*ptr & 0x80)) {
+				break;
+			}
+			start = ptr;
+		}
+
+		state = utf8lite_dfa_next(state, *ptr++);
+		if (state == UTF8LITE_DFA_REJECT) {
+			break;
+		}
+	}
+
+	if (state != UTF8LITE_DFA_ACCEPT) {
+		*okptr = 0;
+		return start;
+	}
+
+	*okptr = 1;
+	return ptr;
+}
+
+
+#ifndef UTF8LITE_HAVE_SSE2
+
+static const uint8_t *find_invalid_scalar(const uint8_t *ptr,
+					  const uint8_t *end)
+{
+	uint64_t word;
+	int ok;
+
+	while (ptr != end) {
+		// skip ASCII, a word at a time
+		while (end - ptr >= 8) {
+			memcpy(&word, ptr, sizeof(word));
+			if (word & UINT64_C(0x8080808080808080)) {
+				break;
+			}
+			ptr += 8;
+		}
+
+		if (ptr == end) {
+			break;
+		}
+
+		if (!(*ptr & 0x80)) {
+			ptr++;
+			continue;
+		}
+
+		ptr = validate_run(ptr, end, &ok);
+		if (!ok) {
+			return ptr;
+		}
+	}
+
+	return ptr;
+}
+
+#else /* UTF8LITE_HAVE_SSE2 */
+
+static const uint8_t *find_invalid_sse2(const uint8_t *ptr,
+					const uint8_t *end)
+{
+	__m128i block;
+	int ok;
+
+	while (ptr != end) {
+		// skip ASCII, 16 bytes at a time
+		while (end - ptr >= 16) {
+			block = _mm_loadu_si128((const __m128i *)ptr);
+			if (_mm_movemask_epi8(block)) {
+				break;
+			}
+			ptr += 16;
+		}
+
+		if (ptr == end) {
+			break;
+		}
+
+		if (!(*ptr & 0x80)) {
+			ptr++;
+			continue;
+		}
+
+		ptr = validate_run(ptr, end, &ok);
+		if (!ok) {
+			return ptr;
+		}
+	}
+
+	return ptr;
+}
+
+#endif /* UTF8LITE_HAVE_SSE2 */
+
+
+#ifdef UTF8LITE_HAVE_AVX2
+
+/*
+ * The AVX2 kernel validates 32 bytes at a time using the lookup
+ * algorithm from Keiser and Lemire, "Validating UTF-8 In Less Than One
+ * Instruction Per Byte" (2021). Each byte gets classified along with
+ * its predecessor by three 16-entry table lookups, keyed on the high
+ * and low nibbles of the previous byte and the high nibble of the
+ * current byte. The tables flag the following errors:
+ */
+
+#define TOO_SHORT	0x01 // 11______ 0_______, 11______ 11______
+#define TOO_LONG	0x02 // 0_______ 10______
+#define OVERLONG_3	0x04 // 11100000 100_____
+#define TOO_LARGE	0x08 // 11110100 1001____, 11110100 101_____, ...
+#define SURROGATE	0x10 // 11101101 101_____
+#define OVERLONG_2	0x20 // 1100000_ 10______
+#define TOO_LARGE_1000	0x40 // 11110101 1000____, 1111011_ 1000____, ...
+#define OVERLONG_4	0x40 // 11110000 1000____
+#define TWO_CONTS	0x80 // 10______ 10______
+#define CARRY		(TOO_SHORT | TOO_LONG | TWO_CONTS)
+
+static const uint8_t byte1_high_table[16] = {
+	// 0_______ ________ (ASCII)
+	TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+	TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+	// 10______ ________ (continuation)
+	TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+	// 1100____ ________ (2-byte lead)
+	TOO_SHORT | OVERLONG_2,
+	// 1101____ ________ (2-byte lead)
+	TOO_SHORT,
+	// 1110____ ________ (3-byte lead)
+	TOO_SHORT | OVERLONG_3 | SURROGATE,
+	// 1111____ ________ (4-byte lead)
+	TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4
+};
+
+static const uint8_t byte1_low_table[16] = {
+	// ____0000 ________
+	CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,
+	// ____0001 ________
+	CARRY | OVERLONG_2,
+	// ____001_ ________
+	CARRY,
+	CARRY,
+	// ____0100 ________
+	CARRY | TOO_LARGE,
+	// ____0101 ________
+	CARRY | TOO_LARGE | TOO_LARGE_1000,
+	// ____011_ ________
+	CARRY | TOO_LARGE | TOO_LARGE_1000,
+	CARRY | TOO_LARGE | TOO_LARGE_1000,
+	// ____1___ ________
+	CARRY | TOO_LARGE | TOO_LARGE_1000,
+	CARRY | TOO_LARGE | TOO_LARGE_1000,
+	CARRY | TOO_LARGE | TOO_LARGE_1000,
+	CARRY | TOO_LARGE | TOO_LARGE_1000,
+	CARRY | TOO_LARGE | TOO_LARGE_1000,
+	// ____1101 ________
+	CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,
+	CARRY | TOO_LARGE | TOO_LARGE_1000,
+	CARRY | TOO_LARGE | TOO_LARGE_1000
+};
+
+static const uint8_t byte2_high_table[16] = {
+	// ________ 0_______ (ASCII)
+	TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+	TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+	// ________ 1000____
+	TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000
+		| OVERLONG_4,
+	// ________ 1001____
+	TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+	// ________ 101_____
+	TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+	TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+	// ________ 11______ (lead)
+	TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT
+};
+
+// a block is incomplete if it ends in the middle of a sequence
+static const uint8_t incomplete_table[32] = {
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1
+};
+
+
+UTF8LITE_TARGET_AVX2
+static __m256i load_table(const uint8_t *table)
+{
+	return _mm256_broadcastsi128_si256(
+			_mm_loadu_si128((const __m128i *)table));
+}
+
+
+/*
+ * Back up from a block boundary to the start of the character that
+ * straddles it, if any, so that another kernel can resume from there.
+ */
+static const uint8_t *block_start(const uint8_t *begin, const uint8_t *ptr)
+{
+	const uint8_t *start = ptr;
+	int i;
+
+	for (i = 0; i < 3 && start != begin; i++) {
+		start--;
+		if ((*start & 0xC0) != 0x80) {
+			return (*start & 0x80) ? start : ptr;
+		}
+	}
+
+	return ptr;
+}
+
+
+UTF8LITE_TARGET_AVX2
+static const uint8_t *find_invalid_avx2(const uint8_t *ptr,
+					const uint8_t *end)
+{
+	const uint8_t *begin = ptr;
+	const __m256i byte1_high = load_table(byte1_high_table);
+	const __m256i byte1_low = load_table(byte1_low_table);
+	const __m256i byte2_high = load_table(byte2_high_table);
+	const __m256i incomplete_max =
+		_mm256_loadu_si256((const __m256i *)incomplete_table);
+	const __m256i nibble = _mm256_set1_epi8(0x0F);
+	const __m256i third = _mm256_set1_epi8(0xE0 - 0x80);
+	const __m256i fourth = _mm256_set1_epi8(0xF0 - 0x80);
+	const __m256i high = _mm256_set1_epi8((char)0x80);
+	__m256i input, prev, prev1, prev2, prev3, shift, special, must23;
+	__m256i incomplete, err;
+
+	prev = _mm256_setzero_si256();
+	incomplete = _mm256_setzero_si256();
+
+	while (end - ptr >= 32) {
+		input = _mm256_loadu_si256((const __m256i *)ptr);
+
+		if (!_mm256_movemask_epi8(input)) {
+			// ASCII block; error if the previous one was cut off
+			err = incomplete;
+			incomplete = _mm256_setzero_si256();
+		} else {
+			shift = _mm256_permute2x128_si256(prev, input, 0x21);
+			prev1 = _mm256_alignr_epi8(input, shift, 15);
+			prev2 = _mm256_alignr_epi8(input, shift, 14);
+			prev3 = _mm256_alignr_epi8(input, shift, 13);
+
+			special = _mm256_and_si256(
+				_mm256_and_si256(
+					_mm256_shuffle_epi8(byte1_high,
+						_mm256_and_si256(
+						    _mm256_srli_epi16(prev1, 4),
+						    nibble)),
+					_mm256_shuffle_epi8(byte1_low,
+						_mm256_and_si256(prev1,
+								 nibble))),
+				_mm256_shuffle_epi8(byte2_high,
+					_mm256_and_si256(
+						_mm256_srli_epi16(input, 4),
+						nibble)));
+
+			// the 2nd and 3rd bytes after a 3- or 4-byte lead
+			// must be continuations
+			must23 = _mm256_or_si256(
+					_mm256_subs_epu8(prev2, third),
+					_mm256_subs_epu8(prev3, fourth));
+			err = _mm256_xor_si256(
+				_mm256_and_si256(must23, high), special);
+
+			incomplete = _mm256_subs_epu8(input, incomplete_max);
+		}
+
+		if (!_mm256_testz_si256(err, err)) {
+			break;
+		}
+
+		prev = input;
+		ptr += 32;
+	}
+
+	// finish the tail or locate the error with the byte-wise kernel
+	return find_invalid_sse2(block_start(begin, ptr), end);
+}
+
+#endif /* UTF8LITE_HAVE_AVX2 */
+
+
+const uint8_t *find_invalid(const uint8_t *ptr, const uint8_t *end)
+{
+	return UTF8LITE_SIMD_KERNEL(find_invalid)(ptr, end);
+}
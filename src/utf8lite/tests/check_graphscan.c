@@ -14,8 +14,10 @@
  * limitations under the License.
  */
 
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <check.h>
 #include "../src/utf8lite.h"
 #include "testutil.h"
@@ -348,6 +350,314 @@ START_TEST(test_unicode_backward)
 END_TEST
 
 
+START_TEST(test_unicode_boundary)
+{
+	struct unitest *test;
+	const uint8_t *ptr, *end, *b;
+	unsigned i, j;
+	int found;
+
+	for (i = 0; i < nunitest; i++) {
+		test = &unitests[i];
+		ptr = test->text.ptr;
+		end = ptr + UTF8LITE_TEXT_SIZE(&test->text);
+
+		for (; ptr <= end; ptr++) {
+			b = utf8lite_graph_boundary(&test->text, ptr);
+			ck_assert(ptr <= b && b <= end);
+			if (b == end) {
+				continue;
+			}
+
+			found = 0;
+			for (j = 0; j < test->nbreak; j++) {
+				if (test->break_begin[j] == b) {
+					found = 1;
+				}
+			}
+			ck_assert_msg(found, "line %u: boundary at byte %d"
+				      " is not a grapheme break", test->line,
+				      (int)(b - test->text.ptr));
+		}
+	}
+}
+END_TEST
+
+
+/*
+ * Measure a text one grapheme at a time, the way utf8lite_text_width()
+ * should.
+ */
+static int measure_graphs(const struct utf8lite_text *text, int flags,
+			  int limit, int *widthptr)
+{
+	int err = 0, w, width = 0;
+
+	utf8lite_graphscan_make(&scan, text);
+	while (utf8lite_graphscan_advance(&scan)) {
+		if ((err = utf8lite_graph_measure(&scan.current, flags, &w))) {
+			width = -1;
+			break;
+		}
+		if (w < 0) {
+			width = -1;
+			break;
+		}
+		if (width > limit - w) {
+			err = UTF8LITE_ERROR_RANGE;
+			break;
+		}
+		width += w;
+	}
+
+	*widthptr = width;
+	return err;
+}
+
+
+START_TEST(test_unicode_width)
+{
+	const int flags[] = {
+		0,
+		UTF8LITE_ESCAPE_DQUOTE,
+		UTF8LITE_ESCAPE_CONTROL,
+		UTF8LITE_ESCAPE_CONTROL | UTF8LITE_ESCAPE_DQUOTE
+			| UTF8LITE_ESCAPE_UTF8,
+		UTF8LITE_ESCAPE_CONTROL | UTF8LITE_ENCODE_AMBIGWIDE,
+		UTF8LITE_ESCAPE_CONTROL | UTF8LITE_ESCAPE_EXTENDED,
+		UTF8LITE_ESCAPE_CONTROL | UTF8LITE_ESCAPE_UTF8
+			| UTF8LITE_ENCODE_JSON
+	};
+	const int nflag = (int)(sizeof(flags) / sizeof(flags[0]));
+	struct unitest *test;
+	unsigned i;
+	int err, err0, f, limit, width, width0, total;
+
+	for (i = 0; i < nunitest; i++) {
+		test = &unitests[i];
+
+		for (f = 0; f < nflag; f++) {
+			err0 = measure_graphs(&test->text, flags[f], INT_MAX,
+					      &total);
+			err = utf8lite_text_width(&test->text, flags[f],
+						  INT_MAX, &width);
+			ck_assert_int_eq(err, err0);
+			ck_assert_int_eq(width, total);
+
+			// a limit inside the text finds the grapheme breaks
+			for (limit = 0; limit <= total; limit++) {
+				err0 = measure_graphs(&test->text, flags[f],
+						      limit, &width0);
+				err = utf8lite_text_width(&test->text,
+							  flags[f], limit,
+							  &width);
+				ck_assert_msg(err == err0 && width == width0,
+					      "line %u, flags %d, limit %d:"
+					      " got (%d, %d), expected (%d, %d)",
+					      test->line, flags[f], limit,
+					      err, width, err0, width0);
+			}
+		}
+	}
+}
+END_TEST
+
+
+/*
+ * Find the longest leading and trailing sequences of graphemes that fit
+ * within a limit, one grapheme at a time.
+ */
+static int measure_prefix(const struct utf8lite_text *text, int flags,
+			  int limit, size_t *sizeptr, int *widthptr)
+{
+	size_t size = 0;
+	int err = 0, w, width = 0;
+
+	utf8lite_graphscan_make(&scan, text);
+	while (utf8lite_graphscan_advance(&scan)) {
+		ck_assert(!utf8lite_graph_measure(&scan.current, flags, &w));
+		if (w < 0) {
+			width = -1;
+			break;
+		}
+		if (width > limit - w) {
+			err = UTF8LITE_ERROR_RANGE;
+			break;
+		}
+		width += w;
+		size += UTF8LITE_TEXT_SIZE(&scan.current.text);
+	}
+
+	*sizeptr = size;
+	*widthptr = width;
+	return err;
+}
+
+
+static int measure_suffix(const struct utf8lite_text *text, int flags,
+			  int limit, size_t *beginptr, int *widthptr)
+{
+	size_t begin = UTF8LITE_TEXT_SIZE(text);
+	int err = 0, w, width = 0;
+
+	utf8lite_graphscan_make(&scan, text);
+	utf8lite_graphscan_skip(&scan);
+	while (utf8lite_graphscan_retreat(&scan)) {
+		ck_assert(!utf8lite_graph_measure(&scan.current, flags, &w));
+		if (w < 0) {
+			width = -1;
+			break;
+		}
+		if (width > limit - w) {
+			err = UTF8LITE_ERROR_RANGE;
+			break;
+		}
+		width += w;
+		begin -= UTF8LITE_TEXT_SIZE(&scan.current.text);
+	}
+
+	*beginptr = begin;
+	*widthptr = width;
+	return err;
+}
+
+
+START_TEST(test_unicode_widthindex)
+{
+	const int flags[] = {
+		0,
+		UTF8LITE_ESCAPE_CONTROL,
+		UTF8LITE_ESCAPE_CONTROL | UTF8LITE_ESCAPE_UTF8
+	};
+	const int nflag = (int)(sizeof(flags) / sizeof(flags[0]));
+	const int steps[] = { 1, 3, 16 };
+	const int nstep = (int)(sizeof(steps) / sizeof(steps[0]));
+	static uint8_t buf[64 * 4096];
+	struct utf8lite_widthindex index;
+	struct utf8lite_text text;
+	size_t pos, pos0, size;
+	unsigned i, j;
+	int err, err0, f, k, limit, width, width0;
+
+	// join runs of the tests into longer texts
+	for (i = 0; i < nunitest; i += 64) {
+		size = 0;
+		for (j = i; j < i + 64 && j < nunitest; j++) {
+			memcpy(buf + size, unitests[j].text.ptr,
+			       UTF8LITE_TEXT_SIZE(&unitests[j].text));
+			size += UTF8LITE_TEXT_SIZE(&unitests[j].text);
+		}
+		text.ptr = buf;
+		text.attr = size;
+
+		for (f = 0; f < nflag; f++) {
+			for (k = 0; k < nstep; k++) {
+				ck_assert(!utf8lite_widthindex_init(&index,
+						&text, flags[f], steps[k]));
+
+				for (limit = -1; limit <= index.width + 1;
+						limit++) {
+					err0 = measure_prefix(&text, flags[f],
+							      limit, &pos0,
+							      &width0);
+					err = utf8lite_widthindex_prefix(
+						&index, limit, &pos, &width);
+					ck_assert_msg(err == err0
+						&& width == width0
+						&& pos == pos0,
+						"prefix %u, flags %d, step %d,"
+						" limit %d: got (%d, %d, %zu),"
+						" expected (%d, %d, %zu)",
+						i, flags[f], steps[k], limit,
+						err, width, pos,
+						err0, width0, pos0);
+
+					err0 = measure_suffix(&text, flags[f],
+							      limit, &pos0,
+							      &width0);
+					err = utf8lite_widthindex_suffix(
+						&index, limit, &pos, &width);
+					ck_assert_msg(err == err0
+						&& width == width0
+						&& pos == pos0,
+						"suffix %u, flags %d, step %d,"
+						" limit %d: got (%d, %d, %zu),"
+						" expected (%d, %d, %zu)",
+						i, flags[f], steps[k], limit,
+						err, width, pos,
+						err0, width0, pos0);
+				}
+
+				utf8lite_widthindex_destroy(&index);
+			}
+		}
+	}
+}
+END_TEST
+
+
+START_TEST(test_ascii_width)
+{
+	const char pool[] = "ab \"'\\\a\b\t\n\v\f\r\x01\x1B\x1F\x7F";
+	const int npool = (int)(sizeof(pool) - 1);
+	const int flags[] = {
+		0,
+		UTF8LITE_ESCAPE_CONTROL,
+		UTF8LITE_ESCAPE_CONTROL | UTF8LITE_ENCODE_JSON,
+		UTF8LITE_ESCAPE_CONTROL | UTF8LITE_ESCAPE_DQUOTE,
+		UTF8LITE_ESCAPE_CONTROL | UTF8LITE_ESCAPE_SQUOTE
+			| UTF8LITE_ENCODE_JSON,
+		UTF8LITE_ESCAPE_DQUOTE,
+		UTF8LITE_ESCAPE_UTF8
+	};
+	const int nflag = (int)(sizeof(flags) / sizeof(flags[0]));
+	uint8_t buf[200];
+	struct utf8lite_text text;
+	unsigned seed = 1, trial;
+	size_t size, i;
+	int err, err0, f, limit, width, width0, total;
+
+	for (trial = 0; trial < 200; trial++) {
+		seed = seed * 1103515245 + 12345;
+		size = (seed >> 8) % sizeof(buf);
+
+		// mostly plain characters, so that the text often fits
+		for (i = 0; i < size; i++) {
+			seed = seed * 1103515245 + 12345;
+			if (trial % 2 == 0 || (seed >> 8) % 8 == 0) {
+				buf[i] = (uint8_t)pool[(seed >> 12) % npool];
+			} else {
+				buf[i] = (uint8_t)pool[(seed >> 12) % 2];
+			}
+		}
+
+		text.ptr = buf;
+		text.attr = size | UTF8LITE_TEXT_ASCII_BIT;
+
+		for (f = 0; f < nflag; f++) {
+			err0 = measure_graphs(&text, flags[f], INT_MAX, &total);
+			err = utf8lite_text_width(&text, flags[f], INT_MAX,
+						  &width);
+			ck_assert_int_eq(err, err0);
+			ck_assert_int_eq(width, total);
+
+			for (limit = 0; limit <= total + 1; limit++) {
+				err0 = measure_graphs(&text, flags[f], limit,
+						      &width0);
+				err = utf8lite_text_width(&text, flags[f],
+							  limit, &width);
+				ck_assert_msg(err == err0 && width == width0,
+					      "trial %u, flags %d, limit %d:"
+					      " got (%d, %d), expected (%d, %d)",
+					      trial, flags[f], limit,
+					      err, width, err0, width0);
+			}
+		}
+	}
+}
+END_TEST
+
+
 Suite *graphscan_suite(void)
 {
         Suite *s;
@@ -361,12 +671,16 @@ Suite *graphscan_suite(void)
         tcase_add_test(tc, test_emoji_modifier);
 	tcase_add_test(tc, test_emoji_zwj_sequence);
 	tcase_add_test(tc, test_isolated);
+	tcase_add_test(tc, test_ascii_width);
         suite_add_tcase(s, tc);
 
         tc = tcase_create("Unicode GraphemeBreakTest.txt");
         tcase_add_checked_fixture(tc, setup_unicode, teardown_unicode);
         tcase_add_test(tc, test_unicode_forward);
         tcase_add_test(tc, test_unicode_backward);
+        tcase_add_test(tc, test_unicode_boundary);
+        tcase_add_test(tc, test_unicode_width);
+        tcase_add_test(tc, test_unicode_widthindex);
         suite_add_tcase(s, tc);
 
 	return s;
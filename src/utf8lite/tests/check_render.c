@@ -18,6 +18,7 @@
 #include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "../src/utf8lite.h"
 #include "testutil.h"
 
@@ -613,6 +614,165 @@ START_TEST(test_encode_emoji_zwj_sequence)
 END_TEST
 
 
+START_TEST(test_encode_flags)
+{
+	// texts without escapes take the span-copying path
+	const char *raw[] = {
+		// ASCII escapes, an ignorable, an ambiguous-width
+		// character, an emoji, and an extended-plane character
+		// with a combining mark
+		"a\"'\\\t\x01\xE2\x80\x8B\xC2\xA1\xE2\x98\x94"
+			"\xF0\x9F\x93\xB8\xE2\x83\xA0\r\n",
+		// clean runs longer than a vector, broken by each escape
+		"the quick brown fox jumps over the lazy dog, twice over "
+			"\"the quick brown fox jumps over the lazy dog\" "
+			"'the quick brown fox jumps over the lazy dog' "
+			"the quick brown fox jumps over the lazy dog\\ "
+			"the quick brown fox jumps over the lazy dog\x7F"
+			"\xC3\xA9t\xC3\xA9 \xE6\xBC\xA2\xE5\xAD\x97 "
+			"the quick brown fox jumps over the lazy dog\n",
+		// controls at the edges of the control range, inside a vector
+		"the quick brown fox\x1F jumps over the lazy dog "
+			"the quick brown fox\x01 jumps over the lazy dog",
+		// prepend, ignorables inside graphemes, and emoji sequences
+		"\xD8\x80" "1a\xCC\x81\xE2\x80\x8D\xCC\x81"
+			"\xC2\xA9\xE2\x80\x8D\xF0\x9F\x9A\x80"
+			"1\xEF\xB8\x8F\xE2\x83\xA3"
+			"\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x92\xBB"
+			"\xCC\x81x",
+		// regional indicators and Hangul
+		"\xF0\x9F\x87\xBA\xF0\x9F\x87\xB8\xF0\x9F\x87\xAB"
+			"x\xE1\x84\x80\xE1\x85\xA1\xE1\x86\xA8"
+			"\xEA\xB0\x80\xE2\x80\x8B",
+		// characters with no width
+		"\xEF\xBF\xB9" "ab\xC2\x85\xE2\x80\xA8"
+	};
+	const struct utf8lite_text *text;
+	struct utf8lite_render ref;
+	struct utf8lite_graphscan scan;
+	int flags, i, n = (int)(sizeof(raw) / sizeof(raw[0]));
+
+	ck_assert(!utf8lite_render_init(&ref, 0));
+
+	for (i = -1; i < n; i++) {
+		if (i < 0) {
+			text = JS("a\\\"'\\\\\\t\\u0001\\u200B\\u00A1"
+				  "\\u2614\\uD83D\\uDCF8\\u20E0\\r\\n");
+		} else {
+			text = S(raw[i]);
+		}
+
+		// the specialized renderers match the general one
+		for (flags = 0; flags < (1 << 8); flags++) {
+			set_flags(flags);
+			ck_assert(!utf8lite_render_text(&render, text));
+
+			ck_assert(!utf8lite_render_set_flags(&ref, flags));
+			utf8lite_graphscan_make(&scan, text);
+			while (utf8lite_graphscan_advance(&scan)) {
+				ck_assert(!utf8lite_render_graph(&ref,
+							&scan.current));
+			}
+
+			ck_assert_msg(!strcmp(render.string, ref.string),
+				      "text %d, flags %d: got \"%s\","
+				      " expected \"%s\"", i, flags,
+				      render.string, ref.string);
+			clear();
+			utf8lite_render_clear(&ref);
+		}
+	}
+
+	utf8lite_render_destroy(&ref);
+}
+END_TEST
+
+
+static int flush_append(void *context, const char *bytes, size_t size)
+{
+	struct utf8lite_render *sink = context;
+	ck_assert(size > 0);
+	return utf8lite_render_raw(sink, bytes, size);
+}
+
+
+static int flush_fail(void *context, const char *bytes, size_t size)
+{
+	(void)context;
+	(void)bytes;
+	(void)size;
+	return UTF8LITE_ERROR_OS;
+}
+
+
+static void render_sample(struct utf8lite_render *r)
+{
+	int i;
+
+	ck_assert(!utf8lite_render_set_style(r, "<", ">"));
+	for (i = 0; i < 20; i++) {
+		ck_assert(!utf8lite_render_indent(r, i % 3));
+		ck_assert(!utf8lite_render_string(r, "a\t\"b\"\xE2\x98\x94"));
+		ck_assert(!utf8lite_render_chars(r, ' ', i));
+		ck_assert(!utf8lite_render_printf(r, "%d", i));
+		ck_assert(!utf8lite_render_string(r, "a clean run of text "
+						  "longer than the buffer"));
+		ck_assert(!utf8lite_render_newlines(r, 1));
+		ck_assert(!utf8lite_render_indent(r, -(i % 3)));
+	}
+}
+
+
+START_TEST(test_flush)
+{
+	struct utf8lite_render sink, ref;
+	int size;
+
+	ck_assert(!utf8lite_render_init(&ref, 0));
+	set_flags(UTF8LITE_ESCAPE_CONTROL | UTF8LITE_ESCAPE_DQUOTE
+		  | UTF8LITE_ESCAPE_UTF8);
+	ck_assert(!utf8lite_render_set_flags(&ref, render.flags));
+	render_sample(&ref);
+	ck_assert(ref.length > 1024);
+
+	// the buffer stays small
+	for (size = 1; size <= 64; size *= 2) {
+		ck_assert(!utf8lite_render_init(&sink, 0));
+		ck_assert(!utf8lite_render_set_flush(&render, flush_append,
+						     &sink, size));
+		render_sample(&render);
+		ck_assert(render.length_max < 256);
+		ck_assert(!utf8lite_render_flush(&render));
+		ck_assert_int_eq(render.length, 0);
+		ck_assert_str_eq(sink.string, ref.string);
+		utf8lite_render_destroy(&sink);
+		clear();
+	}
+
+	// the output stays in memory after removing the callback
+	ck_assert(!utf8lite_render_set_flush(&render, NULL, NULL, 0));
+	render_sample(&render);
+	ck_assert(!utf8lite_render_flush(&render));
+	ck_assert_str_eq(render.string, ref.string);
+
+	utf8lite_render_destroy(&ref);
+}
+END_TEST
+
+
+START_TEST(test_flush_error)
+{
+	ck_assert(!utf8lite_render_set_flush(&render, flush_fail, NULL, 4));
+	ck_assert(!utf8lite_render_string(&render, "abc"));
+	ck_assert_int_eq(utf8lite_render_string(&render, "a string that"
+						" does not fit in the buffer"),
+			 UTF8LITE_ERROR_OS);
+	ck_assert_int_eq(render.error, UTF8LITE_ERROR_OS);
+	ck_assert_int_eq(utf8lite_render_flush(&render), UTF8LITE_ERROR_OS);
+}
+END_TEST
+
+
 START_TEST(test_byte_single)
 {
 	char byte;
@@ -924,6 +1084,7 @@ Suite *render_suite(void)
         tcase_add_test(tc, test_encode_emoji_extended_zwsp);
         tcase_add_test(tc, test_encode_emoji_zwsp_rmdi);
 	tcase_add_test(tc, test_encode_emoji_zwj_sequence);
+	tcase_add_test(tc, test_encode_flags);
         suite_add_tcase(s, tc);
 
 	tc = tcase_create("bytes");
@@ -949,6 +1110,12 @@ Suite *render_suite(void)
         tcase_add_test(tc, test_width_emoji_escape);
         suite_add_tcase(s, tc);
 
+	tc = tcase_create("flush");
+        tcase_add_checked_fixture(tc, setup_render, teardown_render);
+	tcase_add_test(tc, test_flush);
+	tcase_add_test(tc, test_flush_error);
+        suite_add_tcase(s, tc);
+
 	return s;
 }
 
@@ -168,6 +168,142 @@ START_TEST(test_invalid_raw)
 END_TEST
 
 
+START_TEST(test_size_max)
+{
+	struct utf8lite_text text;
+	const uint8_t ptr[] = "a";
+	int err;
+
+	// the size gets checked before reading the input
+	err = utf8lite_text_assign(&text, ptr, UTF8LITE_TEXT_SIZE_MAX + 1,
+				   0, NULL);
+	ck_assert_int_eq(err, UTF8LITE_ERROR_OVERFLOW);
+	ck_assert(text.ptr == NULL);
+	ck_assert(text.attr == 0);
+
+	err = utf8lite_text_assign(&text, ptr, UTF8LITE_TEXT_SIZE_MAX + 1,
+				   UTF8LITE_TEXT_UNESCAPE, NULL);
+	ck_assert_int_eq(err, UTF8LITE_ERROR_OVERFLOW);
+	ck_assert(text.attr == 0);
+}
+END_TEST
+
+
+static const char *long_tokens[] = {
+	"a", "bc", "\\n", "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9D\x84\x9E",
+	"defghijklmnopqrstuvwxyz"
+};
+
+
+static size_t append_tokens(uint8_t *buffer, size_t size, size_t min)
+{
+	int ntoken = sizeof(long_tokens) / sizeof(long_tokens[0]);
+	size_t len, start = size;
+	int i = 0;
+
+	while (size - start < min) {
+		len = strlen(long_tokens[i % ntoken]);
+		memcpy(buffer + size, long_tokens[i % ntoken], len);
+		size += len;
+		i++;
+	}
+	return size;
+}
+
+
+START_TEST(test_valid_long)
+{
+	struct utf8lite_text text;
+	uint8_t buffer[1024];
+	size_t size;
+
+	size = append_tokens(buffer, 0, 256 + (size_t)_i);
+
+	ck_assert(!utf8lite_text_assign(&text, buffer, size, 0, NULL));
+	ck_assert_uint_eq(UTF8LITE_TEXT_SIZE(&text), size);
+
+	ck_assert(!utf8lite_text_assign(&text, buffer, size,
+					UTF8LITE_TEXT_UNESCAPE, NULL));
+	ck_assert_uint_eq(UTF8LITE_TEXT_SIZE(&text), size);
+}
+END_TEST
+
+
+START_TEST(test_invalid_long)
+{
+	const char *invalid[] = {
+		"\xBF", "\xC0\xAF", "\xC2\x7F", "\xE0\x80\x80", "\xED\xA0\x80",
+		"\xF4\x90\x80\x80", "\xF5\x80", "\xC3"
+	};
+	int ninvalid = sizeof(invalid) / sizeof(invalid[0]);
+	struct utf8lite_text text;
+	struct utf8lite_message msg, expect;
+	uint8_t buffer[1024];
+	const uint8_t *ptr;
+	size_t pos, len, size;
+	int i;
+
+	for (i = 0; i < ninvalid; i++) {
+		// valid prefix of at least _i bytes, error, valid suffix
+		pos = append_tokens(buffer, 0, (size_t)_i);
+		len = strlen(invalid[i]);
+		memcpy(buffer + pos, invalid[i], len);
+		size = append_tokens(buffer, pos + len, 128);
+
+		ptr = buffer + pos;
+		ck_assert(utf8lite_scan_utf8(&ptr, buffer + size, &expect));
+		utf8lite_message_append(&expect, " at position %d",
+					(int)(ptr - buffer) + 1);
+
+		ck_assert(utf8lite_text_assign(&text, buffer, size, 0, &msg));
+		ck_assert_str_eq(msg.string, expect.string);
+
+		ck_assert(utf8lite_text_assign(&text, buffer, size,
+					       UTF8LITE_TEXT_UNESCAPE, &msg));
+		ck_assert_str_eq(msg.string, expect.string);
+	}
+}
+END_TEST
+
+
+static int isascii_text(const char *str, int flags)
+{
+	struct utf8lite_text text;
+	size_t n = strlen(str);
+	int ascii;
+
+	ck_assert(!utf8lite_text_assign(&text, (const uint8_t *)str, n, flags,
+					NULL));
+	ascii = utf8lite_text_isascii(&text);
+
+	ck_assert(!utf8lite_text_assign(&text, (const uint8_t *)str, n,
+					flags | UTF8LITE_TEXT_VALID, NULL));
+	ck_assert_int_eq(utf8lite_text_isascii(&text), ascii);
+
+	return ascii;
+}
+
+
+START_TEST(test_isascii)
+{
+	ck_assert(isascii_text("", 0));
+	ck_assert(isascii_text("hello world", 0));
+	ck_assert(isascii_text("a much longer string, spanning several words",
+			       0));
+	ck_assert(!isascii_text("caf\xC3\xA9", 0));
+	ck_assert(!isascii_text("a much longer string, ending in caf\xC3\xA9",
+				0));
+	ck_assert(isascii_text("\\u00e9", 0));
+
+	ck_assert(isascii_text("escape: \\n\\u0041", UTF8LITE_TEXT_UNESCAPE));
+	ck_assert(!isascii_text("escape: \\u00e9", UTF8LITE_TEXT_UNESCAPE));
+	ck_assert(!isascii_text("escape: \\uD834\\uDD1E",
+				UTF8LITE_TEXT_UNESCAPE));
+	ck_assert(!isascii_text("raw: \\n caf\xC3\xA9", UTF8LITE_TEXT_UNESCAPE));
+}
+END_TEST
+
+
 START_TEST(test_unescape_escape)
 {
 	ck_assert_str_eq(unescape(JS("\\\\")), "\\");
@@ -513,6 +649,37 @@ START_TEST(test_iter_utf8)
 END_TEST
 
 
+START_TEST(test_iter_utf8_all)
+{
+	struct utf8lite_text text;
+	struct utf8lite_text_iter iter;
+	uint8_t buffer[4], *end;
+	int32_t code;
+
+	for (code = 0; code <= UTF8LITE_CODE_MAX; code++) {
+		end = buffer;
+		utf8lite_encode_utf8(code, &end);
+
+		if (0xD800 <= code && code <= 0xDFFF) {
+			// surrogates are not valid UTF-8
+			ck_assert(utf8lite_text_assign(&text, buffer,
+						       (size_t)(end - buffer),
+						       0, NULL));
+			continue;
+		}
+
+		ck_assert(!utf8lite_text_assign(&text, buffer,
+						(size_t)(end - buffer), 0,
+						NULL));
+		utf8lite_text_iter_make(&iter, &text);
+		ck_assert(utf8lite_text_iter_advance(&iter));
+		ck_assert_int_eq(iter.current, code);
+		ck_assert(!utf8lite_text_iter_advance(&iter));
+	}
+}
+END_TEST
+
+
 START_TEST(test_iter_escape)
 {
 	start(JS("nn\\\\\\n\\nn\\\\n"));
@@ -623,7 +790,7 @@ START_TEST(test_iter_random)
 
 	ntok = (337 * (_i))  % ntok_max;
 	size = 0;
-	attr = 0;
+	attr = UTF8LITE_TEXT_ASCII_BIT;
 	for (i = 0; i < ntok; i++) {
 		id = rand() % ntype;
 		toks[i] = id;
@@ -632,6 +799,9 @@ START_TEST(test_iter_random)
 		memcpy(buffer + size, types[id].string, len);
 		size += len;
 		attr |= types[id].attr;
+		if (!UTF8LITE_IS_ASCII(types[id].value)) {
+			attr &= ~UTF8LITE_TEXT_ASCII_BIT;
+		}
 	}
 
 	ptr = buffer;
@@ -701,6 +871,9 @@ Suite *text_suite(void)
 	tcase_add_test(tc, test_invalid_text);
 	tcase_add_test(tc, test_valid_raw);
 	tcase_add_test(tc, test_invalid_raw);
+	tcase_add_test(tc, test_size_max);
+	tcase_add_loop_test(tc, test_valid_long, 0, 96);
+	tcase_add_loop_test(tc, test_invalid_long, 0, 96);
 	suite_add_tcase(s, tc);
 
 	tc = tcase_create("unescaping");
@@ -708,6 +881,7 @@ Suite *text_suite(void)
 	tcase_add_test(tc, test_unescape_escape);
 	tcase_add_test(tc, test_unescape_raw);
 	tcase_add_test(tc, test_unescape_utf16);
+	tcase_add_test(tc, test_isascii);
 	suite_add_tcase(s, tc);
 
 	tc = tcase_create("comparison");
@@ -729,6 +903,7 @@ Suite *text_suite(void)
 	tcase_add_test(tc, test_iter_bidi1);
 	tcase_add_test(tc, test_iter_bidi2);
 	tcase_add_test(tc, test_iter_utf8);
+	tcase_add_test(tc, test_iter_utf8_all);
 	tcase_add_test(tc, test_iter_escape);
 	tcase_add_test(tc, test_iter_uescape);
 	tcase_add_loop_test(tc, test_iter_random, 0, 50);
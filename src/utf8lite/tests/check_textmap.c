@@ -425,6 +425,346 @@ START_TEST(test_nomap_quote)
 END_TEST
 
 
+START_TEST(test_casefold_compat)
+{
+	int type = TEXTMAP_CASE | TEXTMAP_COMPAT;
+
+	assert_text_eq(get_map(JS("\\u00DF"), type), S("ss"));
+	assert_text_eq(get_map(JS("\\u1E9E"), type), S("ss"));
+	assert_text_eq(get_map(JS("\\uFF21"), type), S("a"));
+	assert_text_eq(get_map(JS("\\u2160"), type), S("i"));
+	assert_text_eq(get_map(JS("\\u00C5"), type), JS("\\u00E5"));
+	assert_text_eq(get_map(JS("\\u212B"), type), JS("\\u00E5"));
+	assert_text_eq(get_map(JS("\\uFB01"), type), S("fi"));
+}
+END_TEST
+
+
+static int is_aliased(const struct utf8lite_text *text, int flags)
+{
+	struct utf8lite_textmap map;
+	int aliased;
+
+	ck_assert(!utf8lite_textmap_init(&map, flags));
+	ck_assert(!utf8lite_textmap_set(&map, text));
+	aliased = (map.text.ptr == text->ptr);
+	utf8lite_textmap_destroy(&map);
+	return aliased;
+}
+
+
+START_TEST(test_map_unchanged)
+{
+	ck_assert(is_aliased(S("hello"), 0));
+	ck_assert(is_aliased(S("hello"), TEXTMAP_CASE));
+	ck_assert(!is_aliased(S("Hello"), TEXTMAP_CASE));
+	ck_assert(!is_aliased(S("Hello"), TEXTMAP_CASE | TEXTMAP_COMPAT));
+	ck_assert(!is_aliased(JS("hell\\u006f"), 0));
+
+	// composed and decomposed e-acute
+	ck_assert(is_aliased(S("caf\xC3\xA9"), 0));
+	ck_assert(!is_aliased(S("cafe\xCC\x81"), 0));
+	ck_assert(!is_aliased(S("CAF\xC3\x89"), TEXTMAP_CASE));
+
+	// fi ligature
+	ck_assert(is_aliased(S("\xEF\xAC\x81"), 0));
+	ck_assert(!is_aliased(S("\xEF\xAC\x81"), TEXTMAP_COMPAT));
+
+	// right single quotation mark, soft hyphen
+	ck_assert(is_aliased(S("\xE2\x80\x99"), 0));
+	ck_assert(!is_aliased(S("\xE2\x80\x99"), TEXTMAP_QUOTE));
+	ck_assert(is_aliased(S("\xC2\xAD"), 0));
+	ck_assert(!is_aliased(S("\xC2\xAD"), TEXTMAP_RMDI));
+
+	assert_text_eq(get_map(S("cafe\xCC\x81"), 0), S("caf\xC3\xA9"));
+	assert_text_eq(get_map(S("caf\xC3\xA9"), 0), S("caf\xC3\xA9"));
+}
+END_TEST
+
+
+// map a sequence of codes all at once, without segmenting
+static size_t map_whole(const struct utf8lite_textmap *map,
+			const int32_t *codes, size_t ncode, uint8_t *buf)
+{
+	int32_t *work = alloc(ncode * UTF8LITE_UNICODE_DECOMP_MAX
+			      * sizeof(*work));
+	int32_t *dst = work;
+	uint8_t *out = buf;
+	size_t i, len;
+
+	for (i = 0; i < ncode; i++) {
+		utf8lite_map(map->charmap_type, codes[i], &dst);
+	}
+	len = (size_t)(dst - work);
+	utf8lite_order(work, len);
+	utf8lite_compose(work, &len);
+
+	for (i = 0; i < len; i++) {
+		if (work[i] <= 0x7F) {
+			*out++ = (uint8_t)map->ascii_map[work[i]];
+		} else {
+			utf8lite_encode_utf8(work[i], &out);
+		}
+	}
+	return (size_t)(out - buf);
+}
+
+
+START_TEST(test_map_segments)
+{
+	const int32_t pool[] = {
+		'a', 'A', 'e', 's', 0x00C5, 0x00DF, 0x00E9, 0x0301, 0x0307,
+		0x0316, 0x0323, 0x0344, 0x0F73, 0x1100, 0x1161, 0x11A8,
+		0x1E9B, 0x212B, 0xAC00, 0xFB01, 0x1D15E
+	};
+	const int types[] = { 0, TEXTMAP_CASE, TEXTMAP_COMPAT,
+			      TEXTMAP_CASE | TEXTMAP_COMPAT };
+	const int npool = (int)(sizeof(pool) / sizeof(pool[0]));
+	struct utf8lite_textmap map;
+	struct utf8lite_text text;
+	int32_t codes[4096];
+	uint8_t src[4 * 4096], *end;
+	uint8_t *expect;
+	size_t i, ncode, size;
+	unsigned seed = 1, t, trial;
+
+	expect = alloc(4 * 4096 * UTF8LITE_UNICODE_DECOMP_MAX);
+
+	for (t = 0; t < sizeof(types) / sizeof(types[0]); t++) {
+		ck_assert(!utf8lite_textmap_init(&map, types[t]));
+
+		for (trial = 0; trial < 200; trial++) {
+			seed = seed * 1103515245 + 12345;
+			ncode = (seed >> 8) % 4096;
+
+			end = src;
+			for (i = 0; i < ncode; i++) {
+				seed = seed * 1103515245 + 12345;
+				if (trial % 4 == 0 && i > 0 && i < ncode / 2) {
+					// long run of combining marks
+					codes[i] = (i % 2) ? 0x0301 : 0x0316;
+				} else if (trial % 4 == 1 && i < ncode / 2) {
+					// long run of starters, ending with
+					// one that composes with what follows
+					codes[i] = pool[(seed >> 8) % 7];
+				} else {
+					codes[i] = pool[(seed >> 8) % npool];
+				}
+				utf8lite_encode_utf8(codes[i], &end);
+			}
+
+			ck_assert(!utf8lite_text_assign(&text, src,
+							(size_t)(end - src),
+							0, NULL));
+			ck_assert(!utf8lite_textmap_set(&map, &text));
+
+			size = map_whole(&map, codes, ncode, expect);
+			ck_assert_uint_eq(UTF8LITE_TEXT_SIZE(&map.text), size);
+			ck_assert(!memcmp(map.text.ptr, expect, size));
+		}
+
+		utf8lite_textmap_destroy(&map);
+	}
+}
+END_TEST
+
+
+START_TEST(test_map_ascii_runs)
+{
+	const int32_t pool[] = {
+		0x00C5, 0x00DF, 0x00E9, 0x0301, 0x0316, 0x1E9B, 0x212B,
+		0xFB01
+	};
+	const int types[] = { 0, TEXTMAP_CASE, TEXTMAP_COMPAT,
+			      TEXTMAP_CASE | TEXTMAP_COMPAT };
+	const int npool = (int)(sizeof(pool) / sizeof(pool[0]));
+	struct utf8lite_textmap map;
+	struct utf8lite_text text;
+	int32_t codes[4096];
+	uint8_t src[4 * 4096], *end;
+	uint8_t *expect;
+	size_t i, ncode, size, run;
+	unsigned seed = 1, t, trial;
+
+	expect = alloc(4 * 4096 * UTF8LITE_UNICODE_DECOMP_MAX);
+
+	for (t = 0; t < sizeof(types) / sizeof(types[0]); t++) {
+		ck_assert(!utf8lite_textmap_init(&map, types[t]));
+
+		for (trial = 0; trial < 200; trial++) {
+			seed = seed * 1103515245 + 12345;
+			ncode = (seed >> 8) % 4096;
+
+			// runs of printable ASCII of varying lengths, each
+			// followed by a non-ASCII character that might
+			// combine with the end of the run
+			end = src;
+			i = 0;
+			while (i < ncode) {
+				seed = seed * 1103515245 + 12345;
+				run = (seed >> 8) % 80;
+				while (run-- > 0 && i < ncode) {
+					seed = seed * 1103515245 + 12345;
+					codes[i] = 0x20 + (int32_t)((seed >> 8)
+								    % 0x5F);
+					utf8lite_encode_utf8(codes[i++], &end);
+				}
+				if (i < ncode) {
+					seed = seed * 1103515245 + 12345;
+					codes[i] = pool[(seed >> 8) % npool];
+					utf8lite_encode_utf8(codes[i++], &end);
+				}
+			}
+
+			ck_assert(!utf8lite_text_assign(&text, src,
+							(size_t)(end - src),
+							0, NULL));
+			ck_assert(!utf8lite_textmap_set(&map, &text));
+
+			size = map_whole(&map, codes, ncode, expect);
+			ck_assert_uint_eq(UTF8LITE_TEXT_SIZE(&map.text), size);
+			ck_assert(!memcmp(map.text.ptr, expect, size));
+		}
+
+		utf8lite_textmap_destroy(&map);
+	}
+
+	assert_text_eq(casefold(S("The Quick Brown Fox Jumps Over The Lazy Dog"
+				  " @[`{ AZ az")),
+		       S("the quick brown fox jumps over the lazy dog"
+			 " @[`{ az az"));
+	assert_text_eq(casefold(S("THE QUICK BROWN FOX JUMPS OVER THE LAZY "
+				  "DOGE\xCC\x81")),
+		       S("the quick brown fox jumps over the lazy "
+			 "dog\xC3\xA9"));
+	assert_text_eq(get_map(S("the quick brown fox jumps over the lazy "
+				 "doge\xCC\x81!"), 0),
+		       S("the quick brown fox jumps over the lazy "
+			 "dog\xC3\xA9!"));
+}
+END_TEST
+
+
+// map bytes with utf8lite_textmap_set_utf8, and check that the result
+// matches validating and mapping them separately
+static void check_set_utf8(const uint8_t *ptr, size_t size, int type)
+{
+	struct utf8lite_textmap map, map2;
+	struct utf8lite_message msg, msg2;
+	struct utf8lite_text text;
+	int err, err2;
+
+	ck_assert(!utf8lite_textmap_init(&map, type));
+	ck_assert(!utf8lite_textmap_init(&map2, type));
+
+	err = utf8lite_textmap_set_utf8(&map, ptr, size, &msg);
+	err2 = utf8lite_text_assign(&text, ptr, size, 0, &msg2);
+	ck_assert_int_eq(err, err2);
+
+	if (err) {
+		ck_assert_str_eq(msg.string, msg2.string);
+	} else {
+		ck_assert(!utf8lite_textmap_set(&map2, &text));
+		ck_assert_uint_eq(map.text.attr, map2.text.attr);
+		ck_assert(!memcmp(map.text.ptr, map2.text.ptr,
+				  UTF8LITE_TEXT_SIZE(&map.text)));
+		// ASCII gets lowered without checking whether it changes
+		if (map2.text.ptr == text.ptr
+				&& !(utf8lite_text_isascii(&text)
+				     && (type & TEXTMAP_CASE))) {
+			ck_assert(map.text.ptr == ptr);
+		}
+	}
+
+	utf8lite_textmap_destroy(&map2);
+	utf8lite_textmap_destroy(&map);
+}
+
+
+START_TEST(test_map_utf8)
+{
+	const int32_t pool[] = {
+		'a', 'A', 'e', 0x00C5, 0x00DF, 0x00E9, 0x0301, 0x0316,
+		0x0F73, 0x1100, 0x1161, 0x2019, 0x212B, 0xAC00, 0xFB01,
+		0x1D15E
+	};
+	const int types[] = { 0, TEXTMAP_CASE, TEXTMAP_COMPAT, TEXTMAP_QUOTE,
+			      TEXTMAP_CASE | TEXTMAP_COMPAT | TEXTMAP_QUOTE
+			      | TEXTMAP_RMDI };
+	const int npool = (int)(sizeof(pool) / sizeof(pool[0]));
+	uint8_t src[4 * 512], *end;
+	size_t i, ncode, t;
+	unsigned seed = 1, trial;
+
+	for (t = 0; t < sizeof(types) / sizeof(types[0]); t++) {
+		for (trial = 0; trial < 400; trial++) {
+			seed = seed * 1103515245 + 12345;
+			ncode = (seed >> 8) % 512;
+
+			// mostly normalized text, with long ASCII runs
+			end = src;
+			for (i = 0; i < ncode; i++) {
+				seed = seed * 1103515245 + 12345;
+				if ((seed >> 8) % 64 < (trial % 8) * 8) {
+					*end++ = 'a' + (seed >> 16) % 26;
+				} else if ((seed >> 8) % 4 == 0) {
+					utf8lite_encode_utf8(
+						pool[(seed >> 16) % npool],
+						&end);
+				} else {
+					utf8lite_encode_utf8(0x00E0
+						+ (int32_t)((seed >> 16) % 16),
+						&end);
+				}
+			}
+
+			// corrupt a byte in some of the inputs
+			if (trial % 5 == 0 && end != src) {
+				seed = seed * 1103515245 + 12345;
+				src[(seed >> 8) % (size_t)(end - src)] = 0xFF;
+			}
+
+			check_set_utf8(src, (size_t)(end - src), types[t]);
+		}
+	}
+
+	check_set_utf8((const uint8_t *)"", 0, TEXTMAP_CASE);
+	check_set_utf8((const uint8_t *)"Hello", 5, 0);
+	check_set_utf8((const uint8_t *)"Hello", 5, TEXTMAP_CASE);
+	check_set_utf8((const uint8_t *)"caf\xC3\xA9", 5, TEXTMAP_CASE);
+	check_set_utf8((const uint8_t *)"cafe\xCC\x81", 6, 0);
+	check_set_utf8((const uint8_t *)"caf\xC3", 4, 0);
+	check_set_utf8((const uint8_t *)"caf\xC3\xA9\xED\xA0\x80", 8, 0);
+}
+END_TEST
+
+
+START_TEST(test_map_set_type)
+{
+	const struct utf8lite_text *text, *expect;
+	struct utf8lite_textmap map;
+	const int types[] = { TEXTMAP_CASE | TEXTMAP_COMPAT, 0, TEXTMAP_QUOTE,
+			      TEXTMAP_CASE, TEXTMAP_COMPAT | TEXTMAP_RMDI, 0 };
+	size_t t, size;
+
+	text = JS("Caf\\u00E9 \\uFB01 \\u2019S\\u00AD");
+
+	// a reused map gives the same results as a new one
+	ck_assert(!utf8lite_textmap_init(&map, TEXTMAP_CASE));
+	for (t = 0; t < sizeof(types) / sizeof(types[0]); t++) {
+		ck_assert(!utf8lite_textmap_set_type(&map, types[t]));
+		ck_assert(!utf8lite_textmap_set(&map, text));
+
+		expect = get_map(text, types[t]);
+		size = UTF8LITE_TEXT_SIZE(&map.text);
+		ck_assert_uint_eq(size, UTF8LITE_TEXT_SIZE(expect));
+		ck_assert(!memcmp(map.text.ptr, expect->ptr, size));
+	}
+	utf8lite_textmap_destroy(&map);
+}
+END_TEST
+
+
 Suite *textmap_suite(void)
 {
 	Suite *s;
@@ -445,10 +785,16 @@ Suite *textmap_suite(void)
 	tcase_add_test(tc, test_keep_ws_utf8);
 	tcase_add_test(tc, test_casefold_ascii);
 	tcase_add_test(tc, test_casefold_utf8);
+	tcase_add_test(tc, test_casefold_compat);
 	// tcase_add_test(tc, test_fold_dash);
 	// tcase_add_test(tc, test_nofold_dash);
 	tcase_add_test(tc, test_map_quote);
 	tcase_add_test(tc, test_nomap_quote);
+	tcase_add_test(tc, test_map_unchanged);
+	tcase_add_test(tc, test_map_segments);
+	tcase_add_test(tc, test_map_ascii_runs);
+	tcase_add_test(tc, test_map_utf8);
+	tcase_add_test(tc, test_map_set_type);
 	suite_add_tcase(s, tc);
 
 	return s;
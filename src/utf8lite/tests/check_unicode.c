@@ -578,6 +578,117 @@ START_TEST(test_normalize_nfkc_nfkd)
 END_TEST
 
 
+static int isnormal(int type, const int32_t *codes, int len)
+{
+	struct utf8lite_text text;
+	uint8_t buf[4 * 128];
+	uint8_t *dst = buf;
+	int i;
+
+	for (i = 0; i < len; i++) {
+		utf8lite_encode_utf8(codes[i], &dst);
+	}
+	ck_assert(!utf8lite_text_assign(&text, buf, (size_t)(dst - buf), 0,
+					NULL));
+	return utf8lite_text_isnormal(&text, type);
+}
+
+
+static int codes_eq(const int32_t *codes1, int len1, const int32_t *codes2,
+		    int len2)
+{
+	int i;
+
+	if (len1 != len2) {
+		return 0;
+	}
+	for (i = 0; i < len1; i++) {
+		if (codes1[i] != codes2[i]) {
+			return 0;
+		}
+	}
+	return 1;
+}
+
+
+START_TEST(test_normalize_quick_check)
+{
+	int i, j, n = num_normalization_test, nyes = 0;
+	struct normalization_test *test;
+	const int32_t *codes[5];
+	int lens[5];
+
+	for (i = 0; i < n; i++) {
+		test = &normalization_tests[i];
+		codes[0] = test->source; lens[0] = test->source_len;
+		codes[1] = test->nfc; lens[1] = test->nfc_len;
+		codes[2] = test->nfd; lens[2] = test->nfd_len;
+		codes[3] = test->nfkc; lens[3] = test->nfkc_len;
+		codes[4] = test->nfkd; lens[4] = test->nfkd_len;
+
+		// NFC(source) = NFC(nfc) = NFC(nfd) = nfc, and
+		// NFC(nfkc) = NFC(nfkd) = nfkc
+		for (j = 0; j < 5; j++) {
+			if (isnormal(0, codes[j], lens[j])) {
+				ck_assert(codes_eq(codes[j], lens[j],
+						   j < 3 ? test->nfc : test->nfkc,
+						   j < 3 ? test->nfc_len
+							 : test->nfkc_len));
+				nyes++;
+			}
+			if (isnormal(UTF8LITE_DECOMP_ALL, codes[j], lens[j])) {
+				ck_assert(codes_eq(codes[j], lens[j],
+						   test->nfkc,
+						   test->nfkc_len));
+			}
+		}
+	}
+
+	// most of the composed forms should pass the quick check
+	ck_assert(nyes > n);
+}
+END_TEST
+
+
+START_TEST(test_normalize_quick_check_codes)
+{
+	const int types[] = { 0, UTF8LITE_DECOMP_ALL, UTF8LITE_CASEFOLD_ALL,
+			      UTF8LITE_DECOMP_ALL | UTF8LITE_CASEFOLD_ALL };
+	int32_t buf[3 * UTF8LITE_UNICODE_DECOMP_MAX];
+	int32_t code, *dst;
+	size_t len;
+	unsigned i;
+
+	for (i = 0; i < sizeof(types) / sizeof(types[0]); i++) {
+		for (code = 0; code <= UTF8LITE_CODE_MAX; code++) {
+			if (!UTF8LITE_IS_UNICODE(code)
+					|| !isnormal(types[i], &code, 1)) {
+				continue;
+			}
+
+			dst = buf;
+			utf8lite_map(types[i], code, &dst);
+			len = (size_t)(dst - buf);
+			utf8lite_order(buf, len);
+			utf8lite_compose(buf, &len);
+
+			ck_assert_uint_eq(len, 1);
+			ck_assert_int_eq(buf[0], code);
+		}
+	}
+
+	ck_assert(isnormal(0, (const int32_t[]){ 0x00E9 }, 1));
+	ck_assert(!isnormal(0, (const int32_t[]){ 0x0065, 0x0301 }, 2));
+	ck_assert(!isnormal(0, (const int32_t[]){ 0x0061, 0x0301, 0x0316 },
+			    3));
+	ck_assert(!isnormal(UTF8LITE_DECOMP_ALL,
+			    (const int32_t[]){ 0xFB01 }, 1));
+	ck_assert(!isnormal(UTF8LITE_CASEFOLD_ALL,
+			    (const int32_t[]){ 0x00C9 }, 1));
+}
+END_TEST
+
+
 START_TEST(test_whitespace)
 {
 	ck_assert(!utf8lite_isspace(0x08));
@@ -669,6 +780,8 @@ Suite *unicode_suite(void)
 				  teardown_normalization);
 	tcase_add_test(tc, test_normalize_nfc_nfd);
 	tcase_add_test(tc, test_normalize_nfkc_nfkd);
+	tcase_add_test(tc, test_normalize_quick_check);
+	tcase_add_test(tc, test_normalize_quick_check_codes);
 	suite_add_tcase(s, tc);
 
 	tc = tcase_create("utf8 character properties");
@@ -0,0 +1,351 @@
+#!/usr/bin/env python3
+
+# Copyright 2017 Patrick O. Perry.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import math
+
+try:
+    import property
+    import unicode_data
+except ModuleNotFoundError:
+    from util import property
+    from util import unicode_data
+
+
+DERIVED_CORE_PROPERTIES = "data/ucd/DerivedCoreProperties.txt"
+EAST_ASIAN_WIDTH = "data/ucd/EastAsianWidth.txt"
+EMOJI_DATA = "data/ucd/emoji/emoji-data.txt"
+GRAPHEME_BREAK_PROPERTY = "data/ucd/auxiliary/GraphemeBreakProperty.txt"
+PROP_LIST = "data/ucd/PropList.txt"
+UNICODE_MAX = 0x10FFFF
+
+emoji_props = property.read(EMOJI_DATA, sets=True)
+
+
+# Grapheme_Cluster_Break, with Extended_Pictographic as an extra value
+
+graph_break = property.read(GRAPHEME_BREAK_PROPERTY)
+
+for i in range(len(graph_break)):
+    if graph_break[i] is None:
+        graph_break[i] = 'Other'
+
+for i in emoji_props['Extended_Pictographic']:
+    assert graph_break[i] == 'Other'
+    graph_break[i] = 'Extended_Pictographic'
+
+graph_break_names = set(graph_break)
+graph_break_names.remove('Other')
+
+graph_break_vals = {}
+graph_break_vals['Other'] = 0
+
+for p in sorted(graph_break_names):
+    graph_break_vals[p] = len(graph_break_vals)
+
+
+# Character width, from East_Asian_Width with overrides for ignorables,
+# emoji, marks, and unassigned characters
+
+east_asian_width = property.read(EAST_ASIAN_WIDTH)
+# A:  Ambiguous (can be narrow or wide depending on context; treat as wide)
+# F:  Fullwidth (always wide)
+# H:  Halfwidth (always narrow)
+# Na: Narrow    (always narrow)
+# N:  Neutral   (non-East Asian; treat as single)
+# W:  Wide      (always wide)
+
+# https://www.unicode.org/reports/tr51/#def_basic_emoji_set
+emoji = ((emoji_props['Emoji'] - emoji_props['Emoji_Component'])
+         & emoji_props['Emoji_Presentation'])
+
+# Treat ignorables as invisible
+derived_core_properties = property.read(DERIVED_CORE_PROPERTIES, sets=True)
+default_ignorable = derived_core_properties['Default_Ignorable_Code_Point']
+
+# unassigned: not assigned, other, surrogate
+none_cats = set(['Cc', 'Cn', 'Co', 'Cs', 'Zl', 'Zp'])
+mark_cats = set(['Cf', 'Me', 'Mn'])
+none = set([0xFFF9, 0xFFFA, 0xFFFB]) # interlinear annotation markers
+mark = set()
+for code in range(len(unicode_data.uchars)):
+    u = unicode_data.uchars[code]
+    if code in none or code in mark:
+        pass
+    elif u is None or u.category in none_cats:
+        none.add(code)
+    elif u.category in mark_cats:
+        mark.add(code)
+
+charwidth = [None] * (UNICODE_MAX + 1)
+for code in range(len(charwidth)):
+    eaw = east_asian_width[code]
+    if code in default_ignorable: # default ingorable overrides
+        charwidth[code] = 'Ignorable'
+    elif code in emoji: # emoji overrides
+        charwidth[code] = 'Emoji'
+    elif code in mark: # mark overrides
+        charwidth[code] = 'Mark'
+    elif code in none: # none overrides
+        charwidth[code] = 'None'
+    elif eaw == 'F' or eaw == 'W':
+        charwidth[code] = 'Wide'
+    elif eaw == 'H' or eaw == 'Na' or eaw == 'N':
+        charwidth[code] = 'Narrow'
+    elif eaw == 'A':
+        charwidth[code] = 'Ambiguous'
+    else:
+        charwidth[code] = 'Narrow' # default to narrow
+
+charwidth_names = [
+        'None', 'Ignorable', 'Mark', 'Narrow', 'Ambiguous', 'Wide', 'Emoji'
+        ]
+charwidth_vals = {}
+for p in charwidth_names:
+    charwidth_vals[p] = len(charwidth_vals)
+
+
+# White_Space
+
+white_space = property.read(PROP_LIST, sets=True)['White_Space']
+
+
+# Canonical_Combining_Class
+
+def ccc(code):
+    u = unicode_data.uchars[code]
+    if u is None or u.ccc is None:
+        return 0
+    return u.ccc
+
+
+# Pack the properties into a 16-bit record:
+#
+#   bits 0-3   Grapheme_Cluster_Break
+#   bits 4-6   character width
+#   bit  7     White_Space
+#   bits 8-15  Canonical_Combining_Class
+
+assert len(graph_break_vals) <= 16
+assert len(charwidth_vals) <= 8
+
+code_props = [0] * (UNICODE_MAX + 1)
+for code in range(len(code_props)):
+    code_props[code] = (graph_break_vals[graph_break[code]]
+                        | (charwidth_vals[charwidth[code]] << 4)
+                        | ((code in white_space) << 7)
+                        | (ccc(code) << 8))
+
+# Most characters share a handful of records; store each one once and
+# look it up by its index, so that the per-character table takes one
+# byte per entry.
+
+records = sorted(set(code_props))
+record_index = {}
+for i, r in enumerate(records):
+    record_index[r] = i
+
+assert len(records) <= 256
+code_index = [record_index[p] for p in code_props]
+
+
+def compute_tables(block_size):
+    nblock = len(code_index) // block_size
+    stage1 = [None] * nblock
+    stage2 = []
+    stage2_dict = {}
+    for i in range(nblock):
+        begin = i * block_size
+        end = begin + block_size
+        block = tuple(code_index[begin:end])
+        if block in stage2_dict:
+            j = stage2_dict[block]
+        else:
+            j = len(stage2)
+            stage2_dict[block] = j
+            stage2.append(block)
+        stage1[i] = j
+    return (stage1,stage2)
+
+
+def stage1_item_size(nstage2):
+    nbyte = math.ceil(math.log(nstage2, 2) / 8)
+    size = 2**math.ceil(math.log(nbyte, 2))
+    return size
+
+page_size = 4096
+block_size = 256
+
+nbytes = {}
+
+best_block_size = 1
+smallest_size = len(code_index)
+
+for i in range(1,17):
+    block_size = 2**i
+    stage1,stage2 = compute_tables(block_size)
+
+    nbyte1 = len(stage1) * stage1_item_size(len(stage2))
+    nbyte2 = len(stage2) * block_size
+
+    nbyte1 = math.ceil(nbyte1 / page_size) * page_size
+    nbyte2 = math.ceil(nbyte2 / page_size) * page_size
+    nbyte = nbyte1 + nbyte2
+    nbytes[block_size] = nbyte
+
+    if nbyte < smallest_size:
+        smallest_size = nbyte
+        best_block_size = block_size
+
+
+block_size = best_block_size
+stage1,stage2 = compute_tables(block_size)
+
+type1_size = stage1_item_size(len(stage2))
+
+if type1_size == 1:
+    type1 = 'uint8_t'
+elif type1_size == 2:
+    type1 = 'uint16_t'
+elif type1_size == 4:
+    type1 = 'uint32_t'
+else:
+    type1 = 'uint64_t'
+
+type2 = 'uint8_t'
+
+
+# Write charprop.h to stdout
+
+print("/* This file is automatically generated. DO NOT EDIT!")
+print("   Instead, edit gen-charprop.py and re-run.  */")
+print("")
+print("/*")
+print(" * Character properties used for segmentation, width, and")
+print(" * normalization, packed into one record per character so that")
+print(" * looking up several of them for the same character touches the")
+print(" * same cache lines:")
+print(" *")
+print(" *   Grapheme_Cluster_Break, defined in UAX #29 \"Unicode Text")
+print(" *   Segmentation\", Section 4.1, Table 3, with Extended_Pictographic")
+print(" *   as an extra value;")
+print(" *")
+print(" *   the character width, derived from East_Asian_Width (UAX #11),")
+print(" *   Default_Ignorable_Code_Point, the Emoji properties (UTS #51),")
+print(" *   and the General_Category;")
+print(" *")
+print(" *   White_Space;")
+print(" *")
+print(" *   Canonical_Combining_Class, defined in UAX #44, Section 5.7.4.")
+print(" *")
+print(" *")
+print(" * We use the two-stage lookup strategy described at")
+print(" *")
+print(" *     http://www.strchr.com/multi-stage_tables")
+print(" *")
+print(" * with the second stage holding indices into a table of the")
+print(" * distinct records.")
+print(" */")
+print("")
+print("#ifndef UNICODE_CHARPROP_H")
+print("#define UNICODE_CHARPROP_H")
+print("")
+print("#include <stdint.h>")
+print("")
+print("enum graph_break_prop {")
+print("\tGRAPH_BREAK_OTHER = 0", end="")
+for prop in sorted(graph_break_names):
+    print(",\n\tGRAPH_BREAK_" + prop.upper() + " = "
+          + str(graph_break_vals[prop]), end="")
+print("\n};")
+print("")
+print("enum charwidth_prop {")
+first = True
+for prop in charwidth_names:
+    if not first:
+        print(",\n", end="")
+    else:
+        first = False
+    print("\tCHARWIDTH_" + prop.upper() + " = " + str(charwidth_vals[prop]),
+          end="")
+print("\n};")
+print("")
+print("#define CHARPROP_GRAPH_BREAK(prop) ((prop) & 0xF)")
+print("#define CHARPROP_CHARWIDTH(prop) (((prop) >> 4) & 0x7)")
+print("#define CHARPROP_SPACE(prop) (((prop) >> 7) & 0x1)")
+print("#define CHARPROP_COMBINING_CLASS(prop) ((prop) >> 8)")
+print("")
+print("static const uint16_t charprop_record[] = {")
+for i in range(len(records) - 1):
+    if i % 8 == 0:
+        print("/* " + "{0: >3}".format(i) + " */ ", end="")
+    print("0x{0:04X},".format(records[i]), end="")
+    if i % 8 == 7:
+        print("")
+print("0x{0:04X}".format(records[len(records) - 1]))
+print("};")
+print("")
+print("static const " + type1 + " charprop_stage1[] = {")
+for i in range(len(stage1) - 1):
+    if i % 16  == 0:
+        print("/* U+{:04X} */".format(i * block_size), end="")
+    print("{0: >3},".format(stage1[i]), end="")
+    if i % 16 == 15:
+        print("")
+print("{0: >3}".format(stage1[len(stage1) - 1]))
+print("};")
+print("")
+print("static const " + type2 + " charprop_stage2[][" +
+        str(block_size) + "] = {")
+for i in range(len(stage2)):
+    print("  /* block " + str(i) + " */")
+    print("  {", end="")
+    for j in range(block_size):
+        print("{0: >3}".format(stage2[i][j]), end="")
+        if j + 1 == block_size:
+            print("\n  }", end="")
+        else:
+            print(",", end="")
+            if j % 16 == 15:
+                print("\n   ", end="")
+    if i + 1 != len(stage2):
+        print(",\n")
+    else:
+        print("")
+print("};")
+print("")
+print("static inline int charprop(int32_t code)")
+print("{")
+print("\tconst int32_t block_size = " + str(block_size) + ";")
+print("\t" + type1 + " i = charprop_stage1[code / block_size];")
+print("\treturn charprop_record[charprop_stage2[i][code % block_size]];")
+print("}")
+print("")
+print("static inline int graph_break(int32_t code)")
+print("{")
+print("\treturn CHARPROP_GRAPH_BREAK(charprop(code));")
+print("}")
+print("")
+print("static inline int charwidth(int32_t code)")
+print("{")
+print("\treturn CHARPROP_CHARWIDTH(charprop(code));")
+print("}")
+print("")
+print("static inline uint8_t combining_class(int32_t code)")
+print("{")
+print("\treturn (uint8_t)CHARPROP_COMBINING_CLASS(charprop(code));")
+print("}")
+print("")
+print("#endif /* UNICODE_CHARPROP_H */")
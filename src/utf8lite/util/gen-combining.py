@@ -1,167 +0,0 @@
-#!/usr/bin/env python3
-
-# Copyright 2017 Patrick O. Perry.
-#
-# Licensed under the Apache License, Version 2.0 (the "License");
-# you may not use this file except in compliance with the License.
-# You may obtain a copy of the License at
-#
-#     http://www.apache.org/licenses/LICENSE-2.0
-#
-# Unless required by applicable law or agreed to in writing, software
-# distributed under the License is distributed on an "AS IS" BASIS,
-# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
-# See the License for the specific language governing permissions and
-# limitations under the License.
-
-import math
-
-try:
-    import unicode_data
-except ModuleNotFoundError:
-    from util import unicode_data
-
-
-combin_vals = set([0])
-combin = []
-
-for code in range(len(unicode_data.uchars)):
-    u = unicode_data.uchars[code]
-
-    if u is None or u.ccc is None:
-        combin.append(0)
-    else:
-        ccc = u.ccc
-        combin_vals.add(ccc)
-        combin.append(ccc)
-
-
-def compute_tables(block_size):
-    nblock = len(combin) // block_size
-    stage1 = [None] * nblock
-    stage2 = []
-    stage2_dict = {}
-    for i in range(nblock):
-        begin = i * block_size
-        end = begin + block_size
-        block = tuple(combin[begin:end])
-        if block in stage2_dict:
-            j = stage2_dict[block]
-        else:
-            j = len(stage2)
-            stage2_dict[block] = j
-            stage2.append(block)
-        stage1[i] = j
-    return (stage1,stage2)
-
-
-def stage1_item_size(nstage2):
-    nbyte = math.ceil(math.log(nstage2, 2) / 8)
-    size = 2**math.ceil(math.log(nbyte, 2))
-    return size
-
-page_size = 4096
-block_size = 256
-
-nbytes = {}
-
-best_block_size = 1
-smallest_size = len(combin)
-
-for i in range(1,17):
-    block_size = 2**i
-    stage1,stage2 = compute_tables(block_size)
-
-    nbyte1 = len(stage1) * stage1_item_size(len(stage2))
-    nbyte2 = len(stage2) * block_size
-
-    nbyte1 = math.ceil(nbyte1 / page_size) * page_size
-    nbyte2 = math.ceil(nbyte2 / page_size) * page_size
-    nbyte = nbyte1 + nbyte2
-    nbytes[block_size] = nbyte
-
-    if nbyte < smallest_size:
-        smallest_size = nbyte
-        best_block_size = block_size
-
-
-block_size = best_block_size
-stage1,stage2 = compute_tables(block_size)
-
-type1_size = stage1_item_size(len(stage2))
-if type1_size == 1:
-    type1 = 'uint8_t'
-elif type1_size == 2:
-    type1 = 'uint16_t'
-elif type1_size == 4:
-    type1 = 'uint32_t'
-else:
-    type1 = 'uint64_t'
-
-type2 = 'uint8_t'
-
-
-# Write combining.h to stdout
-
-print("/* This file is automatically generated. DO NOT EDIT!")
-print("   Instead, edit gen-combining.py and re-run.  */")
-print("")
-print("/*")
-print(" * Canonical_Combining_Class property values.")
-print(" *")
-print(" * Defined in UAX #44 \"Unicode Character Database\"")
-print(" *")
-print(" *     http://www.unicode.org/reports/tr44/")
-print(" *")
-print(" * Section 5.7.4, Table 15.")
-print(" *")
-print(" *")
-print(" * We use the two-stage lookup strategy described at")
-print(" *")
-print(" *     http://www.strchr.com/multi-stage_tables")
-print(" *")
-print(" */")
-print("")
-print("#ifndef UNICODE_COMBINING_H")
-print("#define UNICODE_COMBINING_H")
-print("")
-print("#include <stdint.h>")
-print("")
-print("static const " + type1 + " combining_class_stage1[] = {")
-for i in range(len(stage1) - 1):
-    if i % 16  == 0:
-        print("/* U+{:04X} */".format(i * block_size), end="")
-    print("{0: >3},".format(stage1[i]), end="")
-    if i % 16 == 15:
-        print("")
-print("{0: >3}".format(stage1[len(stage1) - 1]))
-print("};")
-print("")
-print("static const " + type2 + " combining_class_stage2[][" +
-        str(block_size) + "] = {")
-for i in range(len(stage2)):
-    print("  /* block " + str(i) + " */")
-    print("  {", end="")
-    for j in range(block_size):
-        print("{0: >3}".format(stage2[i][j]), end="")
-        if j + 1 == block_size:
-            print("\n  }", end="")
-        else:
-            print(",", end="")
-            if j % 16 == 15:
-                print("\n   ", end="")
-    if i + 1 != len(stage2):
-        print(",\n")
-    else:
-        print("")
-print("};")
-print("")
-print("static uint8_t combining_class(int32_t code)")
-print("{")
-print("\tconst int32_t block_size = " + str(block_size) + ";")
-print("\t" + type1 + " i = combining_class_stage1[code / block_size];")
-print("\treturn combining_class_stage2[i][code % block_size];")
-print("}")
-print("")
-print("#endif /* UNICODE_COMBINING_H */")
-
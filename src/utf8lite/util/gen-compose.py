@@ -86,16 +86,14 @@ for p,d in decomp_map.items():
     compose_map[l].append((c, p))
 
 compose = []
-combiner = []
-primary = []
+pairs = []
 off = 0
 for code in range(len(unicode_data.uchars)):
     if code in compose_map:
         maps = compose_map[code]
         maps.sort()
         compose.append((off, len(maps)))
-        combiner.extend([c for (c,p) in maps])
-        primary.extend([p for (c,p) in maps])
+        pairs.extend([(code, c, p) for (c,p) in maps])
         off += len(maps)
     else:
         compose.append((0,0))
@@ -112,6 +110,51 @@ for code in range(0xAC00, 0xD7A4):
         compose[code] = (hangul_lvpart, 1)
 
 
+# Perfect hash of the (starter, combiner) pairs, using "hash and
+# displace": the pairs get split into buckets by one hash, and each bucket
+# gets the first seed that puts all of its pairs in free slots of the
+# table under a second, seeded hash.
+
+HASH_BITS = 11
+BUCKET_BITS = 9
+HASH_MULT = 0x9E3779B97F4A7C15
+BUCKET_MULT = 0xC2B2AE3D27D4EB4F
+MASK64 = 2**64 - 1
+
+def pair_key(left, code):
+    return (left << 21) | code
+
+def pair_bucket(key):
+    return ((key * BUCKET_MULT) & MASK64) >> (64 - BUCKET_BITS)
+
+def pair_slot(key, seed):
+    return (((key ^ (seed << 42)) * HASH_MULT) & MASK64) >> (64 - HASH_BITS)
+
+assert len(pairs) < 2**HASH_BITS
+
+buckets = [[] for i in range(2**BUCKET_BITS)]
+for (l, c, p) in pairs:
+    buckets[pair_bucket(pair_key(l, c))].append((l, c, p))
+
+hash_seed = [0] * len(buckets)
+hash_table = [(0, 0, 0)] * 2**HASH_BITS
+
+for b in sorted(range(len(buckets)), key=lambda b: -len(buckets[b])):
+    if not buckets[b]:
+        break
+    seed = 0
+    while True:
+        slots = [pair_slot(pair_key(l, c), seed) for (l, c, p) in buckets[b]]
+        if (len(set(slots)) == len(slots)
+                and all(hash_table[i][0] == 0 for i in slots)):
+            break
+        seed += 1
+    assert seed < 2**16
+    hash_seed[b] = seed
+    for i, item in zip(slots, buckets[b]):
+        hash_table[i] = item
+
+
 def compute_tables(block_size):
     nblock = len(compose) // block_size
     stage1 = [None] * nblock
@@ -201,8 +244,9 @@ print("#include <stdint.h>")
 print("")
 print("/* composition")
 print(" * -----------")
-print(" * offset: the offset into the primary and combiner arrays,")
-print(" *         or 0 if there are no compositions")
+print(" * offset: the position of the codepoint's first composition, in order;")
+print(" *         COMPOSITION_HANGUL_LPART or COMPOSITION_HANGUL_LVPART")
+print(" *         for Hangul syllables composed algorithmically")
 print(" * length: the number of compositions for the codepont")
 print(" */")
 print("struct composition {")
@@ -248,24 +292,59 @@ for i in range(len(stage2)):
         print("")
 print("};")
 print("")
-print("static const int32_t composition_combiner[] = {")
-for i in range(len(combiner) - 1):
-    if i % 8  == 0:
-        print("/* {0: >3} */ ".format(i), end="")
-    print("0x{0:04X},".format(combiner[i]), end="")
-    if i % 8 == 7:
-        print("")
-print("0x{0:04X}".format(combiner[len(combiner) - 1]))
+print("/* composition_pair")
+print(" * ----------------")
+print(" * a starter, a combining character, and their primary composite;")
+print(" * all zero for an empty slot")
+print(" */")
+print("struct composition_pair {")
+print("\tint32_t left;")
+print("\tint32_t code;")
+print("\tint32_t primary;")
 print("};")
 print("")
-print("static const int32_t composition_primary[] = {")
-for i in range(len(primary) - 1):
-    if i % 8  == 0:
+print("#define COMPOSITION_HASH_BITS", HASH_BITS)
+print("")
+print("#define COMPOSITION_BUCKET_BITS", BUCKET_BITS)
+print("")
+print("static const uint16_t composition_seed[] = {")
+for i in range(len(hash_seed) - 1):
+    if i % 16 == 0:
         print("/* {0: >3} */ ".format(i), end="")
-    print("0x{0:04X},".format(primary[i]), end="")
-    if i % 8 == 7:
+    print("{0: >2},".format(hash_seed[i]), end="")
+    if i % 16 == 15:
         print("")
-print("0x{0:04X}".format(primary[len(primary) - 1]))
+print("{0: >2}".format(hash_seed[len(hash_seed) - 1]))
 print("};")
 print("")
+print("static const struct composition_pair composition_table[] = {")
+for i in range(len(hash_table)):
+    l, c, p = hash_table[i]
+    print("\t{{0x{0:04X},0x{1:04X},0x{2:04X}}}".format(l, c, p), end="")
+    if i + 1 != len(hash_table):
+        print(",", end="")
+    print("")
+print("};")
+print("")
+print("/*")
+print(" * Look up the primary composite of a starter and a combining")
+print(" * character; returns 0 if there is none.")
+print(" */")
+print("static int32_t composition_find(int32_t left, int32_t code)")
+print("{")
+print("\tuint64_t key = ((uint64_t)left << 21) | (uint64_t)code;")
+print("\tuint64_t b = (key * UINT64_C(0x{0:016X}))".format(BUCKET_MULT))
+print("\t\t>> (64 - COMPOSITION_BUCKET_BITS);")
+print("\tuint64_t seed = composition_seed[b];")
+print("\tuint64_t i = ((key ^ (seed << 42)) * UINT64_C(0x{0:016X}))"
+      .format(HASH_MULT))
+print("\t\t>> (64 - COMPOSITION_HASH_BITS);")
+print("\tconst struct composition_pair *pair = &composition_table[i];")
+print("")
+print("\tif (pair->left == left && pair->code == code) {")
+print("\t\treturn pair->primary;")
+print("\t}")
+print("\treturn 0;")
+print("}")
+print("")
 print("#endif /* UNICODE_COMPOSE_H */")
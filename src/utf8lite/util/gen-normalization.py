@@ -15,61 +15,130 @@
 # limitations under the License.
 
 import math
-import re
-
-PATTERN = re.compile(r"""^([0-9A-Fa-f]+)        # (first code)
-                          (\.\.([0-9A-Fa-f]+))? # (.. last code)?
-                          \s*
-                          ;                     # ;
-                          \s*
-                          (\w+)                 # (property name)
-                          \s*
-                          ;                     # ;
-                          \s*
-                          (\w+)                 # (property value)
-                          \s*
-                          (\#.*)?$              # (# comment)?""", re.X)
 
+try:
+    import unicode_data
+except ModuleNotFoundError:
+    from util import unicode_data
+
+
+CASE_FOLDING = 'data/ucd/CaseFolding.txt'
+EXCLUSIONS = 'data/ucd/CompositionExclusions.txt'
 UNICODE_MAX = 0x10FFFF
 
-DERIVED_NORMALIZATION_PROPS = "data/ucd/DerivedNormalizationProps.txt"
+# The NFC_QC and NFKC_QC properties are listed in
+# DerivedNormalizationProps.txt, but they are fully determined by the
+# decomposition mappings and the composition exclusions. We derive them
+# here following UAX #15 Sec. 9 and the notes in that file, so that we
+# do not need another data file.
+
+uchars = unicode_data.uchars
+
+def ccc(code):
+    u = uchars[code]
+    if u is None or u.ccc is None:
+        return 0
+    return u.ccc
+
+def canonical_map(code):
+    u = uchars[code]
+    if u is None or u.decomp is None or u.decomp.type is not None:
+        return None
+    return u.decomp.map
+
+
+# Full_Composition_Exclusion: the composition exclusions, the singleton
+# decompositions, and the non-starter decompositions
+
 try:
-    infile = open(DERIVED_NORMALIZATION_PROPS)
+    file = open(EXCLUSIONS, 'r')
 except FileNotFoundError:
-    infile = open("../" + DERIVED_NORMALIZATION_PROPS, "r")
+    file = open('../' + EXCLUSIONS, 'r')
 
-code_props = ['Yes'] * (UNICODE_MAX + 1)
+exclusion = set()
 
-for line in infile:
-    m = PATTERN.match(line)
-    if m is None or m.group(4) != 'NFC_QC':
+with file:
+    for line in file:
+        fields = line.partition('#')
+        code = fields[0].strip()
+        if len(code) > 0:
+            exclusion.add(int(code, 16))
+
+for code in range(UNICODE_MAX + 1):
+    d = canonical_map(code)
+    if d is None:
         continue
-    begin = int(m.group(1), 16)
-    if m.group(3) is None:
-        end = begin + 1
-    else:
-        end = int(m.group(3), 16) + 1
-    prop = m.group(5)
-    if prop == 'M':
-        prop = 'Maybe'
-    elif prop == 'N':
-        prop = 'No'
-    elif prop == 'Y':
-        prop = 'Yes'
-    for code in range(begin, end):
-        code_props[code] = prop
-    #print(line, end = "")
-    #print('[', '{:04X}'.format(begin), ',', '{:04X}'.format(end), '): ',
-    #      prop, sep = '')
-infile.close()
-
-
-prop_names = set(code_props)
-
-prop_vals = {}
-prop_vals['No'] = 0
-prop_vals['Yes'] = 1
-prop_vals['Maybe'] = -1
+    if len(d) == 1 or ccc(code) != 0 or ccc(d[0]) != 0:
+        exclusion.add(code)
+
+
+# characters that can combine with a preceding character: the second
+# characters of the primary composites, and the Hangul V and T jamo
+
+combine_back = set()
+
+for code in range(UNICODE_MAX + 1):
+    d = canonical_map(code)
+    if d is not None and len(d) == 2 and code not in exclusion:
+        combine_back.add(d[1])
+
+combine_back.update(range(0x1161, 0x1176)) # Hangul V jamo
+combine_back.update(range(0x11A8, 0x11C3)) # Hangul T jamo
+
+
+# characters with case foldings
+
+try:
+    file = open(CASE_FOLDING, 'r')
+except FileNotFoundError:
+    file = open('../' + CASE_FOLDING, 'r')
+
+casefold = set()
+
+with file:
+    for line in file:
+        if line[0] != '#' and line[0] != '\n':
+            fields = line.split(';')
+            status = fields[1].strip()
+            if status == 'C' or status == 'F':
+                casefold.add(int(fields[0], 16))
+
+
+def full_decompose(code, compat):
+    d = unicode_data.decompose(code, compat)
+    if d is None:
+        return (code,)
+    return tuple(c for x in d for c in full_decompose(x, compat))
+
+
+NFC_NO = 1 << 0
+NFC_MAYBE = 1 << 1
+NFKC_NO = 1 << 2
+NFKC_MAYBE = 1 << 3
+CASEFOLD_NO = 1 << 4
+
+code_props = [0] * (UNICODE_MAX + 1)
+
+for code in range(UNICODE_MAX + 1):
+    prop = 0
+    canon = full_decompose(code, False)
+    compat = full_decompose(code, True)
+
+    if code in exclusion:
+        prop |= NFC_NO | NFKC_NO
+    elif code in combine_back:
+        prop |= NFC_MAYBE
+
+    if compat != canon:
+        prop |= NFKC_NO
+    elif not prop & NFKC_NO and code in combine_back:
+        prop |= NFKC_MAYBE
+
+    if code in casefold or any(c in casefold for c in canon):
+        prop |= CASEFOLD_NO
+
+    code_props[code] = prop
+
 
 def compute_tables(block_size):
     nblock = len(code_props) // block_size
@@ -133,17 +202,17 @@ elif type1_size == 4:
 else:
     type1 = 'uint64_t'
 
-type2 = 'int8_t'
+type2 = 'uint8_t'
 
 
 
-# Write normalizationprop.h to stdout
+# Write normalization.h to stdout
 
 print("/* This file is automatically generated. DO NOT EDIT!")
 print("   Instead, edit gen-normalization.py and re-run.  */")
 print("")
 print("/*")
-print(" * Unicode NFC_QC property values.")
+print(" * Unicode NFC_QC and NFKC_QC property values.")
 print(" *")
 print(" * Defined in UAX #15 \"Unicode Normalization Forms\"")
 print(" *")
@@ -151,6 +220,10 @@ print(" *     http://www.unicode.org/reports/tr15/")
 print(" *")
 print(" * Section 9, \"Detecting Normalization Forms.\"")
 print(" *")
+print(" * The NORMALIZATION_CASEFOLD_NO bit gets set for characters that")
+print(" * change under case folding, either directly or after canonical")
+print(" * decomposition.")
+print(" *")
 print(" *")
 print(" * We use the two-stage lookup strategy described at")
 print(" *")
@@ -158,20 +231,20 @@ print(" *     http://www.strchr.com/multi-stage_tables")
 print(" *")
 print(" */")
 print("")
-print("#ifndef NORMALIZATIONPROP_H")
-print("#define NORMALIZATIONPROP_H")
+print("#ifndef UNICODE_NORMALIZATION_H")
+print("#define UNICODE_NORMALIZATION_H")
 print("")
 print("#include <stdint.h>")
 print("")
-print("enum nfc_qc_prop {")
-for i in range(len(prop_names)):
-    prop = sorted(prop_names)[i]
-    if i > 0:
-        print(",")
-    print("\tNFC_QC_" + prop.upper() + " = " + str(prop_vals[prop]), end="")
-print("\n};")
+print("enum normalization_prop {")
+print("\tNORMALIZATION_NFC_NO = " + str(NFC_NO) + ",")
+print("\tNORMALIZATION_NFC_MAYBE = " + str(NFC_MAYBE) + ",")
+print("\tNORMALIZATION_NFKC_NO = " + str(NFKC_NO) + ",")
+print("\tNORMALIZATION_NFKC_MAYBE = " + str(NFKC_MAYBE) + ",")
+print("\tNORMALIZATION_CASEFOLD_NO = " + str(CASEFOLD_NO))
+print("};")
 print("")
-print("static const " + type1 + " nfc_qc_stage1[] = {")
+print("static const " + type1 + " normalization_stage1[] = {")
 for i in range(len(stage1) - 1):
     if i % 16  == 0:
         print("/* U+{:04X} */".format(i * block_size), end="")
@@ -181,13 +254,13 @@ for i in range(len(stage1) - 1):
 print("{0: >3}".format(stage1[len(stage1) - 1]))
 print("};")
 print("")
-print("static const " + type2 + " nfc_qc_stage2[][" +
+print("static const " + type2 + " normalization_stage2[][" +
         str(block_size) + "] = {")
 for i in range(len(stage2)):
     print("  /* block " + str(i) + " */")
     print("  {", end="")
     for j in range(block_size):
-        print("{0: >3}".format(prop_vals[stage2[i][j]]), end="")
+        print("{0: >3}".format(stage2[i][j]), end="")
         if j + 1 == block_size:
             print("\n  }", end="")
         else:
@@ -201,11 +274,11 @@ for i in range(len(stage2)):
 print("};")
 
 print("")
-print("static int nfc_qc(uint32_t code)")
+print("static int normalization_prop(int32_t code)")
 print("{")
-print("\tconst uint32_t block_size = " + str(block_size) + ";")
-print("\t" + type1 + " i = nfc_qc_stage1[code / block_size];")
-print("\treturn nfc_qc_stage2[i][code % block_size];")
+print("\tconst int32_t block_size = " + str(block_size) + ";")
+print("\t" + type1 + " i = normalization_stage1[code / block_size];")
+print("\treturn normalization_stage2[i][code % block_size];")
 print("}")
 print("")
-print("#endif /* NORMALIZATIONPROP_H */")
+print("#endif /* UNICODE_NORMALIZATION_H */")
@@ -0,0 +1,255 @@
+#!/usr/bin/env python3
+
+# Copyright 2017 Patrick O. Perry.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import math
+
+try:
+    import unicode_data
+except ModuleNotFoundError:
+    from util import unicode_data
+
+
+CASE_FOLDING = 'data/ucd/CaseFolding.txt'
+UNICODE_MAX = 0x10FFFF
+
+# Parse CaseFolding.txt
+
+try:
+    file = open(CASE_FOLDING, 'r')
+except FileNotFoundError:
+    file = open('../' + CASE_FOLDING, 'r')
+
+casefold = {}
+
+with file:
+    for line in file:
+        if line[0] != '#' and line[0] != '\n':
+            fields = line.split(';')
+            code = int(fields[0], 16)
+            status = fields[1].strip();
+            if status == 'C' or status == 'F':
+                casefold[code] = [int(x,16) for x in fields[2].split()]
+
+
+# Expand the maps the same way as the recursive utf8lite_map does:
+# decompose, case fold what does not decompose, and map the results
+# again. Hangul syllables get decomposed algorithmically, so we leave
+# them out of the table.
+
+HANGUL_SBASE = 0xAC00
+HANGUL_SCOUNT = 11172
+
+def expand(code, compat, fold):
+    if HANGUL_SBASE <= code < HANGUL_SBASE + HANGUL_SCOUNT:
+        return list(unicode_data.hangul_decompose(code))
+    d = unicode_data.uchars[code]
+    d = None if d is None else d.decomp
+    if d is not None and d.map is not None and (compat or d.type is None):
+        return [c for x in d.map for c in expand(x, compat, fold)]
+    elif fold and code in casefold:
+        return [c for x in casefold[code] for c in expand(x, compat, fold)]
+    else:
+        return [code]
+
+# map kinds, in table order: (compat, fold)
+kinds = [(False, False), (False, True), (True, False), (True, True)]
+
+normmap_map = []
+normmap_offset = {}
+normmap = []
+length_max = 0
+
+for code in range(UNICODE_MAX + 1):
+    item = []
+    for compat, fold in kinds:
+        if HANGUL_SBASE <= code < HANGUL_SBASE + HANGUL_SCOUNT:
+            m = [code]
+        else:
+            m = expand(code, compat, fold)
+
+        if m == [code]:
+            item.append((0, 0))
+        elif len(m) == 1:
+            item.append((1, m[0]))
+        else:
+            m = tuple(m)
+            if m not in normmap_offset:
+                normmap_offset[m] = len(normmap_map)
+                normmap_map.extend(m)
+            item.append((len(m), normmap_offset[m]))
+        length_max = max(length_max, len(m))
+    normmap.append(tuple(item))
+
+assert length_max < 32
+assert len(normmap_map) < 2**21
+
+
+def compute_tables(block_size):
+    nblock = len(normmap) // block_size
+    stage1 = [None] * nblock
+    stage2 = []
+    stage2_dict = {}
+    for i in range(nblock):
+        begin = i * block_size
+        end = begin + block_size
+        block = tuple(normmap[begin:end])
+        if block in stage2_dict:
+            j = stage2_dict[block]
+        else:
+            j = len(stage2)
+            stage2_dict[block] = j
+            stage2.append(block)
+        stage1[i] = j
+    return (stage1,stage2)
+
+
+def stage1_item_size(nstage2):
+    nbyte = math.ceil(math.log(nstage2, 2) / 8)
+    size = 2**math.ceil(math.log(nbyte, 2))
+    return size
+
+page_size = 4096
+block_size = 256
+
+nbytes = {}
+
+best_block_size = 1
+smallest_size = len(normmap) * 4 * len(kinds)
+
+for i in range(1,17):
+    block_size = 2**i
+    stage1,stage2 = compute_tables(block_size)
+
+    nbyte1 = len(stage1) * stage1_item_size(len(stage2))
+    nbyte2 = len(stage2) * block_size * 4 * len(kinds)
+
+    nbyte1 = math.ceil(nbyte1 / page_size) * page_size
+    nbyte2 = math.ceil(nbyte2 / page_size) * page_size
+    nbyte = nbyte1 + nbyte2
+    nbytes[block_size] = nbyte
+
+    if nbyte < smallest_size:
+        smallest_size = nbyte
+        best_block_size = block_size
+
+
+block_size = best_block_size
+stage1,stage2 = compute_tables(block_size)
+
+type1_size = stage1_item_size(len(stage2))
+if type1_size == 1:
+    type1 = 'uint8_t'
+elif type1_size == 2:
+    type1 = 'uint16_t'
+elif type1_size == 4:
+    type1 = 'uint32_t'
+else:
+    type1 = 'uint64_t'
+
+# Write normmap.h to stdout
+
+print("/* This file is automatically generated. DO NOT EDIT!")
+print("   Instead, edit gen-normmap.py and re-run.  */")
+print("")
+print("/*")
+print(" * Fully expanded normalization mappings: the canonical or")
+print(" * compatibility decomposition of each character, optionally")
+print(" * followed by case folding, applied until nothing changes. This")
+print(" * lets utf8lite_map() find the result with a single lookup.")
+print(" *")
+print(" * Hangul syllables are not in the table; decompose them")
+print(" * algorithmically.")
+print(" *")
+print(" *")
+print(" * We use a two-stage lookup strategy as described at")
+print(" *")
+print(" *     http://www.strchr.com/multi-stage_tables")
+print(" *")
+print(" */")
+print("")
+print("#ifndef UNICODE_NORMMAP_H")
+print("#define UNICODE_NORMMAP_H")
+print("")
+print("#include <stdint.h>")
+print("")
+print("/* normmap_kind")
+print(" * ------------")
+print(" * index of the map in a table entry")
+print(" */")
+print("enum normmap_kind {")
+print("\tNORMMAP_NFD = 0,")
+print("\tNORMMAP_NFD_CASEFOLD = 1,")
+print("\tNORMMAP_NFKD = 2,")
+print("\tNORMMAP_NFKD_CASEFOLD = 3")
+print("};")
+print("")
+print("/* normmap")
+print(" * -------")
+print(" * length: the length (in codepoints) of the mapping,")
+print(" *         or 0 if the character maps to itself")
+print(" *")
+print(" * data:   the mapped-to codepoint (length = 1), or")
+print(" *         an index into the `normmap_mapping` array, pointing")
+print(" *         to the first codepoint in the mapping (length > 1)")
+print(" */")
+print("struct normmap {")
+print("\tunsigned length : 5;")
+print("\tunsigned data : 21;")
+print("};")
+print("")
+print("#define NORMMAP_BLOCK_SIZE", block_size)
+print("")
+print("static const " + type1 + " normmap_stage1[] = {")
+for i in range(len(stage1) - 1):
+    if i % 16  == 0:
+        print("/* U+{:04X} */".format(i * block_size), end="")
+    print("{0: >3},".format(stage1[i]), end="")
+    if i % 16 == 15:
+        print("")
+print("{0: >3}".format(stage1[len(stage1) - 1]))
+print("};")
+print("")
+print("static const struct normmap normmap_stage2[][" + str(block_size)
+      + "][" + str(len(kinds)) + "] = {")
+for i in range(len(stage2)):
+    print("  /* block " + str(i) + " */")
+    print("  {", end="")
+    for j in range(block_size):
+        print("{" + ",".join("{{{0},0x{1:05X}}}".format(l, d)
+                             for l, d in stage2[i][j]) + "}", end="")
+        if j + 1 == block_size:
+            print("\n  }", end="")
+        else:
+            print(",", end="")
+            if j % 2 == 1:
+                print("\n   ", end="")
+    if i + 1 != len(stage2):
+        print(",\n")
+    else:
+        print("")
+print("};")
+print("")
+print("static const int32_t normmap_mapping[] = {")
+for i in range(len(normmap_map) - 1):
+    if i % 8  == 0:
+        print("/* 0x{:04X} */ ".format(i), end="")
+    print("0x{0:04X},".format(normmap_map[i]), end="")
+    if i % 8 == 7:
+        print("")
+print("0x{0:04X}".format(normmap_map[len(normmap_map) - 1]))
+print("};")
+print("")
+print("#endif /* UNICODE_NORMMAP_H */")
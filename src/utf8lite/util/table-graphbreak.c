@@ -1,8 +1,7 @@
 #include <assert.h>
 #include <inttypes.h>
 #include <stdio.h>
-#include "../src/private/charwidth.h"
-#include "../src/private/graphbreak.h"
+#include "../src/private/charprop.h"
 #include "../src/utf8lite.h"
 
 const char *str_charwidth(enum charwidth_prop prop)